@@ -22,24 +22,110 @@
 # include  "Attrib.h"
 # include  <cassert>
 
+/*
+ * An interned attribute table. The tables are immutable once created
+ * and live in a pool for the life of the compiler, chained into a
+ * fixed size hash table by a hash of their contents. Attrib objects
+ * only ever point at pooled tables, so identical attribute sets cost
+ * their storage exactly once no matter how many netlist objects carry
+ * them.
+ */
+struct Attrib::table_s_ {
+      struct Attrib::table_s_*next;
+      unsigned hash;
+      unsigned nlist;
+      struct Attrib::cell_*list;
+};
+
+const unsigned ATTRIB_POOL_SIZE = 1024;
+
+static unsigned hash_attr_value(unsigned hash, const verinum&val)
+{
+      hash = hash*13 + val.len();
+      for (unsigned idx = 0 ;  idx < val.len() ;  idx += 1)
+	    hash = hash*13 + val.get(idx);
+      return hash;
+}
+
+/*
+ * Structural equality for pooled values. The verinum comparison
+ * operators do numeric compares, which is too loose for sharing
+ * storage, so compare the exact shape here.
+ */
+static bool same_attr_value(const verinum&a, const verinum&b)
+{
+      if (a.len() != b.len()) return false;
+      if (a.has_sign() != b.has_sign()) return false;
+      if (a.is_string() != b.is_string()) return false;
+
+      for (unsigned idx = 0 ;  idx < a.len() ;  idx += 1) {
+	    if (a.get(idx) != b.get(idx)) return false;
+      }
+
+      return true;
+}
+
+const struct Attrib::table_s_* Attrib::intern_(unsigned nlist,
+					       const struct cell_*list)
+{
+      static struct table_s_*pool[ATTRIB_POOL_SIZE];
+
+      unsigned hash = nlist;
+      for (unsigned idx = 0 ;  idx < nlist ;  idx += 1) {
+	    const char*cp = list[idx].key.str();
+	    while (cp && *cp) {
+		  hash = hash*13 + (unsigned char) *cp;
+		  cp += 1;
+	    }
+	    hash = hash_attr_value(hash, list[idx].val);
+      }
+
+      struct table_s_**bucket = pool + hash % ATTRIB_POOL_SIZE;
+      for (struct table_s_*cur = *bucket ;  cur ;  cur = cur->next) {
+	    if (cur->hash != hash) continue;
+	    if (cur->nlist != nlist) continue;
+
+	    bool match = true;
+	    for (unsigned idx = 0 ;  match && idx < nlist ;  idx += 1) {
+		  if (! (cur->list[idx].key == list[idx].key))
+			match = false;
+		  else if (! same_attr_value(cur->list[idx].val,
+					     list[idx].val))
+			match = false;
+	    }
+	    if (match) return cur;
+      }
+
+      struct table_s_*tmp = new struct table_s_;
+      tmp->hash = hash;
+      tmp->nlist = nlist;
+      tmp->list = new struct cell_[nlist];
+      for (unsigned idx = 0 ;  idx < nlist ;  idx += 1)
+	    tmp->list[idx] = list[idx];
+
+      tmp->next = *bucket;
+      *bucket = tmp;
+      return tmp;
+}
+
 Attrib::Attrib()
 {
-      nlist_ = 0;
-      list_ = 0;
+      table_ = 0;
 }
 
 Attrib::~Attrib()
 {
-      delete[] list_;
+	/* The table, if any, is owned by the intern pool. */
 }
 
 
 const verinum& Attrib::attribute(perm_string key) const
 {
-      for (unsigned idx = 0 ;  idx < nlist_ ;  idx += 1) {
+      unsigned nlist = table_? table_->nlist : 0;
+      for (unsigned idx = 0 ;  idx < nlist ;  idx += 1) {
 
-	    if (key == list_[idx].key)
-		  return list_[idx].val;
+	    if (key == table_->list[idx].key)
+		  return table_->list[idx].val;
       }
 
       static const verinum null;
@@ -49,34 +135,46 @@ const verinum& Attrib::attribute(perm_string key) const
 void Attrib::attribute(perm_string key, const verinum&value)
 {
       unsigned idx;
-
-      for (idx = 0 ; idx < nlist_ ;  idx += 1) {
-	    if (key == list_[idx].key) {
-		  list_[idx].val = value;
-		  return;
+      unsigned nlist = table_? table_->nlist : 0;
+
+	/* Build the edited set in a scratch array, then intern it
+	   and point at the pooled result. */
+      struct cell_*tmp = new struct cell_[nlist+1];
+      unsigned cnt = nlist;
+      bool found = false;
+
+      for (idx = 0 ;  idx < nlist ;  idx += 1) {
+	    tmp[idx] = table_->list[idx];
+	    if (key == tmp[idx].key) {
+		  tmp[idx].val = value;
+		  found = true;
 	    }
       }
 
-      struct cell_*tmp = new struct cell_[nlist_+1];
-      for (idx = 0 ;  idx < nlist_ ;  idx += 1)
-	    tmp[idx] = list_[idx];
-
-      tmp[nlist_].key = key;
-      tmp[nlist_].val = value;
+      if (! found) {
+	    tmp[cnt].key = key;
+	    tmp[cnt].val = value;
+	    cnt += 1;
+      }
 
-      nlist_ += 1;
-      delete[]list_;
-      list_ = tmp;
+      table_ = intern_(cnt, tmp);
+      delete[]tmp;
 }
 
 bool Attrib::has_compat_attributes(const Attrib&that) const
 {
       unsigned idx;
 
-      for (idx = 0 ;  idx < that.nlist_ ;  idx += 1) {
+	/* Shared tables make the common identical case a pointer
+	   compare. */
+      if (table_ == that.table_)
+	    return true;
+
+      unsigned that_cnt = that.table_? that.table_->nlist : 0;
+      for (idx = 0 ;  idx < that_cnt ;  idx += 1) {
 
-	    verinum tmp = attribute(that.list_[idx].key);
-	    if (tmp != that.list_[idx].val)
+	    verinum tmp = attribute(that.table_->list[idx].key);
+	    if (tmp != that.table_->list[idx].val)
 		  return false;
       }
 
@@ -85,17 +183,17 @@ bool Attrib::has_compat_attributes(const Attrib&that) const
 
 unsigned Attrib::attr_cnt() const
 {
-      return nlist_;
+      return table_? table_->nlist : 0;
 }
 
 perm_string Attrib::attr_key(unsigned idx) const
 {
-      assert(idx < nlist_);
-      return list_[idx].key;
+      assert(table_ && idx < table_->nlist);
+      return table_->list[idx].key;
 }
 
 const verinum& Attrib::attr_value(unsigned idx) const
 {
-      assert(idx < nlist_);
-      return list_[idx].val;
+      assert(table_ && idx < table_->nlist);
+      return table_->list[idx].val;
 }
@@ -49,8 +49,18 @@ class Attrib {
 	    verinum val;
       };
 
-      unsigned nlist_;
-      struct cell_*list_;
+	// Attribute sets are stored as immutable tables that are
+	// interned in a pool, so the many objects of a synthesized
+	// netlist that carry identical attribute sets (cell name,
+	// timing class, etc.) all share a single table. This points
+	// to the table for this object, or is nil if the object has
+	// no attributes. Editing an attribute replaces the pointer
+	// with that of another interned table.
+      struct table_s_;
+      const struct table_s_*table_;
+
+      static const struct table_s_* intern_(unsigned nlist,
+					    const struct cell_*list);
 
     private: // not implemented
       Attrib(const Attrib&);
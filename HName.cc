@@ -28,21 +28,24 @@
 hname_t::hname_t()
 {
       number_ = INT_MIN;
+      calc_hash_();
 }
 
 hname_t::hname_t(perm_string text)
 : name_(text)
 {
       number_ = INT_MIN;
+      calc_hash_();
 }
 
 hname_t::hname_t(perm_string text, int num)
 : name_(text), number_(num)
 {
+      calc_hash_();
 }
 
 hname_t::hname_t(const hname_t&that)
-: name_(that.name_), number_(that.number_)
+: name_(that.name_), number_(that.number_), hash_(that.hash_)
 {
 }
 
@@ -50,14 +53,38 @@ hname_t& hname_t::operator = (const hname_t&that)
 {
       name_ = that.name_;
       number_ = that.number_;
+      hash_ = that.hash_;
       return *this;
 }
 
+void hname_t::calc_hash_()
+{
+      unsigned tmp = 0;
+      if (const char*cp = name_.str()) {
+	    while (*cp != 0) {
+		  tmp = tmp*13 + (unsigned char) *cp;
+		  cp += 1;
+	    }
+      }
+      hash_ = tmp;
+}
+
 bool operator < (const hname_t&l, const hname_t&r)
 {
-      int cmp = strcmp(l.peek_name(), r.peek_name());
-      if (cmp < 0) return true;
-      if (cmp > 0) return false;
+	/* Order by the cached hash first, so that map lookups almost
+	   never need to touch the name text at all. Only names that
+	   collide in the hash fall back to a string compare, and the
+	   common collision (array instances of the same scope name)
+	   is caught by the pointer compare of the interned strings. */
+      if (l.peek_hash() != r.peek_hash())
+	    return l.peek_hash() < r.peek_hash();
+
+      if (l.peek_name().str() != r.peek_name().str()) {
+	    int cmp = strcmp(l.peek_name(), r.peek_name());
+	    if (cmp < 0) return true;
+	    if (cmp > 0) return false;
+      }
+
       if (l.has_number() && r.has_number())
 	    return l.peek_number() < r.peek_number();
       else
@@ -66,6 +93,9 @@ bool operator < (const hname_t&l, const hname_t&r)
 
 bool operator == (const hname_t&l, const hname_t&r)
 {
+      if (l.peek_hash() != r.peek_hash())
+	    return false;
+
       if (l.peek_name() == r.peek_name()) {
 	    if (l.has_number() && r.has_number())
 		  return l.peek_number() == r.peek_number();
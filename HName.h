@@ -54,12 +54,23 @@ class hname_t {
       bool has_number() const;
       int peek_number() const;
 
+	// Return the hash of the name text. This is computed once at
+	// construction, so ordered containers can compare names
+	// without re-hashing or strcmp.
+      unsigned peek_hash(void) const;
+
     private:
       perm_string name_;
 	// If the number is anything other than INT_MIN, then this is
 	// the numeric part of the name. Otherwise, it is not part of
 	// the name at all.
       int number_;
+	// Cached hash of the name text. The number is not included,
+	// so that names that differ only in the number stay
+	// equivalent under the comparison operators.
+      unsigned hash_;
+
+      void calc_hash_();
 
     private: // not implemented
 };
@@ -83,6 +94,11 @@ inline bool hname_t::has_number() const
       return number_ != INT_MIN;
 }
 
+inline unsigned hname_t::peek_hash() const
+{
+      return hash_;
+}
+
 extern bool operator <  (const hname_t&, const hname_t&);
 extern bool operator == (const hname_t&, const hname_t&);
 extern ostream& operator<< (ostream&, const hname_t&);
@@ -38,6 +38,7 @@ Module::Module(LexicalScope*parent, perm_string n)
       time_unit = 0;
       time_precision = 0;
       time_from_timescale = false;
+      port_checks_done_ = false;
 }
 
 Module::~Module()
@@ -153,8 +153,15 @@ class Module : public PScopeExtra, public LineInfo {
 
     private:
       void dump_specparams_(ostream&out, unsigned indent) const;
+      void elaborate_sig_ports_(Design*des) const;
       list<PGate*> gates_;
 
+	// Set once the port declaration checks in elaborate_sig have
+	// run. The checks depend only on the module definition and
+	// not on the instance, so they are skipped for the second and
+	// subsequent instances of the module.
+      mutable bool port_checks_done_;
+
     private: // Not implemented
       Module(const Module&);
       Module& operator= (const Module&);
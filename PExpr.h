@@ -56,6 +56,16 @@ class PExpr : public LineInfo {
       PExpr();
       virtual ~PExpr();
 
+	// The pform holds millions of expression nodes for a large
+	// design, so allocate them from a dedicated heap.
+      static void* operator new(std::size_t size) { return heap_.alloc(size); }
+      static void operator delete(void*ptr, std::size_t size)
+      { heap_.free(ptr, size); }
+
+	// Give the whole expression heap back at once. Only valid
+	// when the pform is completely dead. (See pform_release_nodes.)
+      static void heap_release() { heap_.release_all(); }
+
       virtual void dump(ostream&) const;
 
         // This method tests whether the expression contains any identifiers
@@ -183,6 +193,9 @@ class PExpr : public LineInfo {
       unsigned min_width_;
       bool signed_flag_;
 
+    private:
+      static ObjHeap heap_;
+
     private: // not implemented
       PExpr(const PExpr&);
       PExpr& operator= (const PExpr&);
@@ -617,6 +630,10 @@ class PEBinary : public PExpr {
                                      unsigned flags) const;
       virtual verinum* eval_const(Design*des, NetScope*sc) const;
 
+      inline char get_op() const { return op_; }
+      inline PExpr*get_left() const { return left_; }
+      inline PExpr*get_right() const { return right_; }
+
     protected:
       char op_;
       PExpr*left_;
@@ -24,6 +24,8 @@
 # include  "verinum.h"
 # include  <cassert>
 
+ObjHeap PGate::heap_;
+
 void PGate::set_pins_(list<PExpr*>*pins)
 {
       assert(pins);
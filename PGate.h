@@ -60,6 +60,15 @@ class PGate : public LineInfo {
 
       virtual ~PGate();
 
+	// Gates are parse-time objects created at very high rates
+	// (one per instance in a gate netlist), so allocate them from
+	// a dedicated heap that is released in bulk once elaboration
+	// has consumed the pform.
+      static void* operator new(std::size_t size) { return heap_.alloc(size); }
+      static void operator delete(void*ptr, std::size_t size)
+      { heap_.free(ptr, size); }
+      static void heap_release() { heap_.release_all(); }
+
       perm_string get_name() const { return name_; }
 
 	// This evaluates the delays as far as possible, but returns
@@ -101,6 +110,8 @@ class PGate : public LineInfo {
 
       ivl_drive_t str0_, str1_;
 
+      static ObjHeap heap_;
+
       void set_pins_(list<PExpr*>*pins);
 
     private: // not implemented
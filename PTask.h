@@ -75,6 +75,11 @@ class PTask  : public PScope, public LineInfo {
 	// Elaborate the statement to finish off the task definition.
       void elaborate(Design*des, NetScope*scope) const;
 
+	// Elaborate everything except the statement, and attach a
+	// stub body instead. This is used for tasks that nothing in
+	// the design calls. (See elaborate.cc.)
+      void elaborate_stub(Design*des, NetScope*scope) const;
+
       bool is_auto() const { return is_auto_; };
 
       void dump(ostream&, unsigned) const;
@@ -114,6 +119,9 @@ class PFunction : public PScope, public LineInfo {
 	/* Elaborate the behavioral statement. */
       void elaborate(Design *des, NetScope*) const;
 
+	/* Attach a stub body to a function that nothing calls. */
+      void elaborate_stub(Design *des, NetScope*) const;
+
       bool is_auto() const { return is_auto_; };
 
       void dump(ostream&, unsigned) const;
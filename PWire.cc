@@ -22,6 +22,8 @@
 # include  "PExpr.h"
 # include  <cassert>
 
+ObjHeap PWire::heap_;
+
 PWire::PWire(perm_string n,
 	     NetNet::Type t,
 	     NetNet::PortType pt,
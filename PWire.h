@@ -59,6 +59,14 @@ class PWire : public LineInfo {
 	    NetNet::PortType pt,
 	    ivl_variable_type_t dt);
 
+	// Wires are parse-time objects created at very high rates,
+	// so allocate them from a dedicated heap that is released in
+	// bulk once elaboration has consumed the pform.
+      static void* operator new(std::size_t size) { return heap_.alloc(size); }
+      static void operator delete(void*ptr, std::size_t size)
+      { heap_.free(ptr, size); }
+      static void heap_release() { heap_.release_all(); }
+
 	// Return a hierarchical name.
       perm_string basename() const;
 
@@ -124,6 +132,8 @@ class PWire : public LineInfo {
 
       ivl_discipline_t discipline_;
 
+      static ObjHeap heap_;
+
     private: // not implemented
       PWire(const PWire&);
       PWire& operator= (const PWire&);
@@ -22,6 +22,8 @@
 # include  "Statement.h"
 # include  "PExpr.h"
 
+ObjHeap Statement::heap_;
+
 Statement::~Statement()
 {
 }
@@ -79,12 +79,23 @@ class Statement : public LineInfo {
       Statement() { }
       virtual ~Statement() =0;
 
+	// Statements are parse-time objects created at very high
+	// rates, so allocate them from a dedicated heap that is
+	// released in bulk once elaboration has consumed the pform.
+      static void* operator new(std::size_t size) { return heap_.alloc(size); }
+      static void operator delete(void*ptr, std::size_t size)
+      { heap_.free(ptr, size); }
+      static void heap_release() { heap_.release_all(); }
+
       virtual void dump(ostream&out, unsigned ind) const;
       virtual NetProc* elaborate(Design*des, NetScope*scope) const;
       virtual void elaborate_scope(Design*des, NetScope*scope) const;
       virtual void elaborate_sig(Design*des, NetScope*scope) const;
 
       map<perm_string,PExpr*> attributes;
+
+    private:
+      static ObjHeap heap_;
 };
 
 /*
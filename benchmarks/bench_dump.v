@@ -0,0 +1,41 @@
+/*
+ * Benchmark: waveform dumping.
+ *
+ * Many signals changing every time step with $dumpvars active, so the
+ * run time is dominated by the dumper callbacks and file output. The
+ * harness runs this with the -fst extended argument; without it the
+ * default VCD dumper is measured instead.
+ */
+
+`timescale 1ns/1ns
+
+module bench_dump;
+
+   parameter SIGNALS = 64;
+   parameter STEPS = 20000;
+
+   reg clk = 0;
+   reg [255:0] bus = 0;
+
+   genvar i;
+   generate
+      for (i = 0 ; i < SIGNALS ; i = i + 1) begin : sig
+	 reg [31:0] count = 0;
+	 always @(posedge clk) count = count + i + 1;
+      end
+   endgenerate
+
+   integer j;
+
+   initial begin
+      $dumpfile("bench_dump.out");
+      $dumpvars(0, bench_dump);
+      for (j = 0 ; j < STEPS ; j = j + 1) begin
+	 #1 clk = ~clk;
+	 bus = {bus[254:0], bus[255] ^ clk};
+      end
+      $display("bench_dump: bus=%h", bus[31:0]);
+      $finish(0);
+   end
+
+endmodule
@@ -0,0 +1,50 @@
+/*
+ * Benchmark: gate level propagation.
+ *
+ * A wide ripple-carry adder built from gate primitives, driven with
+ * inputs that flip most bits, so every step sends long propagation
+ * waves through the logic functors.
+ */
+
+`timescale 1ns/1ns
+
+module bench_gates;
+
+   parameter WIDTH = 256;
+   parameter STEPS = 20000;
+
+   reg [WIDTH-1:0] a, b;
+   wire [WIDTH-1:0] sum;
+   wire [WIDTH:0]   carry;
+
+   assign carry[0] = 1'b0;
+
+   genvar i;
+   generate
+      for (i = 0 ; i < WIDTH ; i = i + 1) begin : cell
+	 wire axb, t1, t2;
+	 xor g1 (axb, a[i], b[i]);
+	 xor g2 (sum[i], axb, carry[i]);
+	 and g3 (t1, a[i], b[i]);
+	 and g4 (t2, axb, carry[i]);
+	 or  g5 (carry[i+1], t1, t2);
+      end
+   endgenerate
+
+   integer j;
+   reg [31:0] acc;
+
+   initial begin
+      a = 0;
+      b = 0;
+      acc = 0;
+      for (j = 0 ; j < STEPS ; j = j + 1) begin
+	 a = a + 64'h9e3779b97f4a7c15;
+	 b = b ^ {b[WIDTH-2:0], b[WIDTH-1]} ^ j;
+	 #1 acc = acc ^ sum[31:0] ^ {31'd0, carry[WIDTH]};
+      end
+      $display("bench_gates: acc=%h", acc);
+      $finish(0);
+   end
+
+endmodule
@@ -0,0 +1,33 @@
+/*
+ * Benchmark: big memory traffic.
+ *
+ * Scattered reads and writes over a large memory, with addresses from
+ * a multiplicative generator so the access pattern defeats any
+ * locality in the array word storage.
+ */
+
+`timescale 1ns/1ns
+
+module bench_memory;
+
+   parameter LOG2WORDS = 20;
+   parameter STEPS = 2000000;
+
+   reg [31:0] mem [0:(1<<LOG2WORDS)-1];
+
+   integer j;
+   reg [31:0] addr, acc;
+
+   initial begin
+      addr = 0;
+      acc = 0;
+      for (j = 0 ; j < STEPS ; j = j + 1) begin
+	 mem[addr[LOG2WORDS-1:0]] = acc ^ j;
+	 acc = acc + mem[addr[31:32-LOG2WORDS]];
+	 addr = addr * 32'h0019660d + 32'h3c6ef35f;
+      end
+      $display("bench_memory: acc=%h", acc);
+      $finish(0);
+   end
+
+endmodule
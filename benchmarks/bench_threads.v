@@ -0,0 +1,43 @@
+/*
+ * Benchmark: behavioral thread engine.
+ *
+ * Many concurrent threads with short delays and fork/join traffic,
+ * so the run time is dominated by thread scheduling and the vthread
+ * instruction loop.
+ */
+
+`timescale 1ns/1ns
+
+module bench_threads;
+
+   parameter THREADS = 64;
+   parameter STEPS = 20000;
+
+   integer done_count = 0;
+
+   genvar i;
+   generate
+      for (i = 0 ; i < THREADS ; i = i + 1) begin : thr
+	 integer count;
+	 initial begin : body
+	    integer j;
+	    count = 0;
+	    for (j = 0 ; j < STEPS ; j = j + 1) begin
+	       #1 count = count + 1;
+	       fork
+		  count = count + 1;
+		  count = count + 2;
+	       join
+	    end
+	    done_count = done_count + 1;
+	 end
+      end
+   endgenerate
+
+   initial begin
+      wait (done_count == THREADS);
+      $display("bench_threads: %0d threads finished", done_count);
+      $finish(0);
+   end
+
+endmodule
@@ -0,0 +1,32 @@
+/*
+ * Benchmark: wide vector arithmetic.
+ *
+ * Behavioral arithmetic and shifts on very wide vectors, so the run
+ * time is dominated by the word-at-a-time vector operations in the
+ * runtime rather than by scheduling.
+ */
+
+`timescale 1ns/1ns
+
+module bench_wide;
+
+   parameter WIDTH = 2048;
+   parameter STEPS = 100000;
+
+   reg [WIDTH-1:0] a, b, c;
+   integer j;
+
+   initial begin
+      a = {WIDTH/32{32'hdeadbeef}};
+      b = {WIDTH/32{32'h12345678}};
+      c = 0;
+      for (j = 0 ; j < STEPS ; j = j + 1) begin
+	 c = c ^ (a + b);
+	 a = {a[WIDTH-2:0], b[WIDTH-1]};
+	 b = b + c;
+      end
+      $display("bench_wide: c=%h", c[31:0]);
+      $finish(0);
+   end
+
+endmodule
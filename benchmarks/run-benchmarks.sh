@@ -0,0 +1,113 @@
+#!/bin/sh
+#
+# Driver for the simulator benchmark suite. Normally run from the top
+# of the build tree by "make benchmark" or "make benchmark-baseline".
+#
+#    run-benchmarks.sh <builddir> <srcdir> [run|baseline]
+#
+# Each benchmark is compiled with the just-built compiler and run with
+# the just-built vvp in verbose mode. Wall time, cpu time, peak memory
+# and the event counts that vvp -v reports are written to
+# benchmark-results.json (or benchmark-baseline.json), one flat record
+# per benchmark so revisions are easy to compare. When a baseline file
+# is present, a "run" compares against it and fails if any benchmark
+# got 10% or more slower.
+
+builddir=`cd "${1:-.}" && pwd`
+srcdir=`cd "${2:-.}" && pwd`
+mode="${3:-run}"
+
+work="$builddir/benchmark-work"
+mkdir -p "$work" || exit 1
+
+case "$mode" in
+    baseline) out="$builddir/benchmark-baseline.json" ;;
+    *)        out="$builddir/benchmark-results.json" ;;
+esac
+
+BENCHES="threads gates wide memory dump"
+
+# Extra vvp extended arguments for a benchmark.
+extra_args()
+{
+    case "$1" in
+	dump) echo "-fst" ;;
+    esac
+}
+
+{
+    printf '{ "generated": "%s",\n' "`date`"
+    printf '  "benchmarks": [\n'
+} > "$out.tmp" || exit 1
+
+first=yes
+status=0
+for name in $BENCHES ; do
+    src="$srcdir/benchmarks/bench_$name.v"
+    vvpfile="$work/bench_$name.vvp"
+    log="$work/bench_$name.log"
+
+    if ! "$builddir/driver/iverilog" -B"$builddir" -BP"$builddir/ivlpp" \
+	 -o "$vvpfile" "$src" > "$log" 2>&1 ; then
+	echo "benchmark $name: COMPILE FAILED (see $log)" >&2
+	status=1
+	continue
+    fi
+
+    t0=`date +%s`
+    if ! ( cd "$work" && "$builddir/vvp/vvp" -M- -M"$builddir/vpi" -n -v \
+	   "$vvpfile" `extra_args $name` ) > "$log" 2>&1 ; then
+	echo "benchmark $name: RUN FAILED (see $log)" >&2
+	status=1
+	continue
+    fi
+    t1=`date +%s`
+    wall=`expr $t1 - $t0`
+
+    # The last rusage line of the verbose output covers the run phase:
+    #   " ... 1.23 seconds, 1024.0/512.0/128.0 KBytes size/rss/shared"
+    cpu=`grep 'seconds,' "$log" | tail -1 | awk '{print $2}'`
+    peak=`grep 'seconds,' "$log" | tail -1 \
+	  | awk '{split($4, m, "/"); print m[1]}'`
+    time_steps=`awk '/time steps/ {print $1}' "$log"`
+    thread_events=`awk '/thread schedule events/ {print $1}' "$log"`
+    assign_events=`awk '/assign events/ {print $1}' "$log"`
+    other_events=`awk '/other events/ {print $1}' "$log"`
+
+    [ "$first" = yes ] || printf ',\n' >> "$out.tmp"
+    first=no
+    printf '    { "name": "%s", "wall_seconds": %s, "cpu_seconds": %s, "peak_kbytes": %s, "time_steps": %s, "thread_events": %s, "assign_events": %s, "other_events": %s }' \
+	"$name" "${wall:-0}" "${cpu:-0}" "${peak:-0}" \
+	"${time_steps:-0}" "${thread_events:-0}" \
+	"${assign_events:-0}" "${other_events:-0}" >> "$out.tmp"
+
+    echo "benchmark $name: cpu ${cpu:-?}s wall ${wall}s peak ${peak:-?}KB"
+done
+
+printf '\n  ]\n}\n' >> "$out.tmp"
+mv "$out.tmp" "$out"
+echo "benchmark results written to $out"
+
+# Compare a run against the recorded baseline, if there is one.
+base="$builddir/benchmark-baseline.json"
+if [ "$mode" = run ] && [ -f "$base" ] ; then
+    for name in $BENCHES ; do
+	old=`sed -n 's/.*"name": "'$name'", .*"cpu_seconds": \([0-9.][0-9.eE+-]*\),.*/\1/p' "$base"`
+	new=`sed -n 's/.*"name": "'$name'", .*"cpu_seconds": \([0-9.][0-9.eE+-]*\),.*/\1/p' "$out"`
+	[ -n "$old" ] && [ -n "$new" ] || continue
+	awk -v n="$name" -v old="$old" -v new="$new" 'BEGIN {
+	    if (old+0 <= 0) exit 0;
+	    pct = 100 * (new - old) / old;
+	    if (pct >= 10) {
+		printf("benchmark %s: REGRESSION +%.1f%% (%.2fs -> %.2fs)\n",
+		       n, pct, old, new);
+		exit 1;
+	    }
+	    if (pct <= -10)
+		printf("benchmark %s: improved %.1f%% (%.2fs -> %.2fs)\n",
+		       n, -pct, old, new);
+	}' || status=1
+    done
+fi
+
+exit $status
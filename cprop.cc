@@ -20,6 +20,7 @@
 # include "config.h"
 
 # include  <algorithm>
+# include  <set>
 # include  <vector>
 # include  <cstdlib>
 # include  "netlist.h"
@@ -40,6 +41,15 @@ struct cprop_functor  : public functor_t {
 
       unsigned count;
 
+	// Nodes that should be revisited because a nexus they are
+	// attached to was changed by a replacement. The driver drains
+	// this set instead of rescanning the whole design.
+      std::set<NetNode*> worklist;
+
+      virtual unsigned scan_mask() const
+      { return SCAN_SIGNAL | SCAN_ADD_SUB | SCAN_COMPARE | SCAN_CONCAT
+	     | SCAN_FF | SCAN_LOGIC | SCAN_MUX | SCAN_PART_SELECT; }
+
       virtual void signal(Design*des, NetNet*obj);
       virtual void lpm_add_sub(Design*des, NetAddSub*obj);
       virtual void lpm_compare(Design*des, NetCompare*obj);
@@ -50,8 +60,59 @@ struct cprop_functor  : public functor_t {
       virtual void lpm_part_select(Design*des, NetPartSelect*obj);
 
       void lpm_compare_eq_(Design*des, NetCompare*obj);
+
+	// Dispatch a queued node to the handler for its type.
+      void dispatch_node_(Design*des, NetNode*obj);
+
+	// Queue all the nodes that share a nexus with obj, in
+	// anticipation of obj being replaced or removed.
+      void queue_neighbors_(NetNode*obj);
+
+	// Forget a node that is about to be deleted.
+      void retire_(NetNode*obj);
  };
 
+void cprop_functor::dispatch_node_(Design*des, NetNode*obj)
+{
+	// Only the types with non-trivial handlers can lead to more
+	// work, so only those types are dispatched here.
+      if (NetConcat*tmp_concat = dynamic_cast<NetConcat*>(obj)) {
+	    lpm_concat(des, tmp_concat);
+      } else if (NetFF*tmp_ff = dynamic_cast<NetFF*>(obj)) {
+	    lpm_ff(des, tmp_ff);
+      } else if (NetMux*tmp_mux = dynamic_cast<NetMux*>(obj)) {
+	    lpm_mux(des, tmp_mux);
+      } else if (NetPartSelect*tmp_ps = dynamic_cast<NetPartSelect*>(obj)) {
+	    lpm_part_select(des, tmp_ps);
+      }
+}
+
+void cprop_functor::queue_neighbors_(NetNode*obj)
+{
+      for (unsigned idx = 0 ;  idx < obj->pin_count() ;  idx += 1) {
+	    Nexus*nex = obj->pin(idx).nexus();
+	    if (nex == 0)
+		  continue;
+
+	    for (Link*cur = nex->first_nlink() ; cur ; cur = cur->next_nlink()) {
+		  NetPins*tmp;
+		  unsigned tmp_pin;
+		  cur->cur_link(tmp, tmp_pin);
+
+		  NetNode*node = dynamic_cast<NetNode*>(tmp);
+		  if (node == 0 || node == obj)
+			continue;
+
+		  worklist.insert(node);
+	    }
+      }
+}
+
+void cprop_functor::retire_(NetNode*obj)
+{
+      worklist.erase(obj);
+}
+
 void cprop_functor::signal(Design*, NetNet*)
 {
 }
@@ -117,6 +178,8 @@ void cprop_functor::lpm_concat(Design*des, NetConcat*obj)
 
 	// Note that this will leave the const inputs to dangle. They
 	// will be reaped by other passes of cprop_functor.
+      queue_neighbors_(obj);
+      retire_(obj);
       delete obj;
 
       count += 1;
@@ -133,6 +196,8 @@ void cprop_functor::lpm_ff(Design*, NetFF*obj)
 	  && (! obj->pin_Sset().is_linked())
 	  && (! obj->pin_Aclr().is_linked())
 	  && (! obj->pin_Aset().is_linked())) {
+	    queue_neighbors_(obj);
+	    retire_(obj);
 	    obj->pin_Data().unlink();
 	    obj->pin_Q().unlink();
 	    delete obj;
@@ -193,6 +258,8 @@ void cprop_functor::lpm_mux(Design*des, NetMux*obj)
 	    connect(tmp->pin(1), obj->pin_Data(1));
       else
 	    connect(tmp->pin(1), obj->pin_Data(0));
+      queue_neighbors_(obj);
+      retire_(obj);
       delete obj;
       des->add_node(tmp);
       count += 1;
@@ -328,6 +395,8 @@ void cprop_functor::lpm_part_select(Design*des, NetPartSelect*obj)
       ivl_assert(*obj, concat_pin == concat->pin_count());
 
       for (size_t idx = 0 ; idx < obj_set.size() ; idx += 1) {
+	    queue_neighbors_(obj_set[idx]);
+	    retire_(obj_set[idx]);
 	    delete obj_set[idx];
       }
 
@@ -342,6 +411,8 @@ void cprop_functor::lpm_part_select(Design*des, NetPartSelect*obj)
  */
 struct cprop_dc_functor  : public functor_t {
 
+      virtual unsigned scan_mask() const { return SCAN_CONST; }
+
       virtual void lpm_const(Design*des, NetConst*obj);
 };
 
@@ -433,17 +504,33 @@ void cprop_dc_functor::lpm_const(Design*, NetConst*obj)
 
 void cprop(Design*des)
 {
-	// Continually propagate constants until a scan finds nothing
-	// to do.
+	// Run one full scan of the design to seed the work. Each
+	// replacement queues the nodes adjacent to the changed nexa,
+	// so after the seed scan it is enough to drain that work list
+	// instead of rescanning the whole design until a scan comes
+	// up empty.
       cprop_functor prop;
-      do {
+      prop.count = 0;
+      des->functor(&prop);
+      if (verbose_flag) {
+	    cout << " ... Seed scan detected "
+		 << prop.count << " optimizations." << endl << flush;
+      }
+
+      unsigned worked = 0;
+      while (! prop.worklist.empty()) {
+	    NetNode*cur = *prop.worklist.begin();
+	    prop.worklist.erase(prop.worklist.begin());
+
 	    prop.count = 0;
-	    des->functor(&prop);
-	    if (verbose_flag) {
-		  cout << " ... Iteration detected "
-		       << prop.count << " optimizations." << endl << flush;
-	    }
-      } while (prop.count > 0);
+	    prop.dispatch_node_(des, cur);
+	    worked += prop.count;
+      }
+
+      if (verbose_flag) {
+	    cout << " ... Work list detected "
+		 << worked << " more optimizations." << endl << flush;
+      }
 
       if (verbose_flag) {
 	    cout << " ... Look for dangling constants" << endl << flush;
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2012 Stephen Williams (steve@icarus.com)
+ *
+ *    This source code is free software; you can redistribute it
+ *    and/or modify it in source code form under the terms of the GNU
+ *    General Public License as published by the Free Software
+ *    Foundation; either version 2 of the License, or (at your option)
+ *    any later version.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this program; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+# include "config.h"
+
+# include  <list>
+# include  <set>
+# include  <vector>
+# include  "netlist.h"
+# include  "compiler.h"
+
+/*
+ * This pass removes tasks and functions that are never called. Calls
+ * are counted on the NetScope by the statement and expression nodes
+ * that make them (NetUTask, NetEUFunc, NetUserFunc and NetDisable),
+ * so a task or function scope with no call references has a body
+ * that can never execute. Deleting such a body releases the call
+ * references that it holds in turn, which can expose more dead tasks,
+ * so the deletion is iterated to a fixpoint.
+ *
+ * A gutted scope is dropped from the scope tree entirely when nothing
+ * else in the design references its contents, so the code generator
+ * does not emit it at all. If some live code still refers to a signal
+ * or event in the scope (a hierarchical reference from a testbench,
+ * for example), the scope is kept with an empty body so that the
+ * referenced items are still emitted.
+ */
+
+static void collect_tf_scopes(NetScope*scope, std::vector<NetScope*>&res)
+{
+      if (scope->type() == NetScope::TASK || scope->type() == NetScope::FUNC)
+	    res.push_back(scope);
+
+      std::list<NetScope*> children;
+      scope->child_scopes(children);
+      for (std::list<NetScope*>::iterator cur = children.begin()
+		 ; cur != children.end() ; ++ cur )
+	    collect_tf_scopes(*cur, res);
+}
+
+void deadtask(Design*des)
+{
+      std::vector<NetScope*> tf_scopes;
+
+      std::list<NetScope*> roots = des->find_root_scopes();
+      for (std::list<NetScope*>::iterator cur = roots.begin()
+		 ; cur != roots.end() ; ++ cur )
+	    collect_tf_scopes(*cur, tf_scopes);
+
+	// Delete the bodies of uncalled tasks and functions. The
+	// statement destructors release the call references the body
+	// held, so iterate until no more bodies become dead.
+      std::set<NetScope*> gutted;
+      bool changed = true;
+      while (changed) {
+	    changed = false;
+
+	    for (size_t idx = 0 ; idx < tf_scopes.size() ; idx += 1) {
+		  NetScope*scope = tf_scopes[idx];
+		  if (gutted.count(scope))
+			continue;
+		  if (scope->peek_call_ref() > 0)
+			continue;
+
+		  if (NetTaskDef*tdef = scope->task_def()) {
+			delete tdef->take_proc();
+			tdef->set_proc(new NetBlock(NetBlock::SEQU, 0));
+		  } else if (NetFuncDef*fdef = scope->func_def()) {
+			delete fdef->take_proc();
+			fdef->set_proc(new NetBlock(NetBlock::SEQU, 0));
+		  } else {
+			continue;
+		  }
+
+		  if (debug_optimizer)
+			cerr << "deadtask: Deleted unreachable body of "
+			     << scope_path(scope) << "." << endl;
+
+		  gutted.insert(scope);
+		  changed = true;
+	    }
+      }
+
+	// Drop the scopes that nothing references any more. The
+	// scope objects leak, but they are tiny compared to the
+	// bodies reclaimed above and the process is near its end.
+      unsigned dropped = 0;
+      for (std::set<NetScope*>::iterator cur = gutted.begin()
+		 ; cur != gutted.end() ; ++ cur ) {
+
+	    NetScope*scope = *cur;
+	    NetScope*parent = scope->parent();
+	    if (parent == 0)
+		  continue;
+	    if (! scope->no_external_refs())
+		  continue;
+
+	    parent->unlink_child(scope);
+	    dropped += 1;
+      }
+
+      if (verbose_flag) {
+	    cout << " ... deleted " << gutted.size()
+		 << " unreachable task/function bodies, dropped "
+		 << dropped << " scopes." << endl << flush;
+      }
+}
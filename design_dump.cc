@@ -25,6 +25,7 @@
 # include  <typeinfo>
 # include  <iostream>
 # include  <iomanip>
+# include  <sstream>
 # include  "netlist.h"
 # include  "compiler.h"
 # include  "discipline.h"
@@ -1174,6 +1175,16 @@ void NetRepeat::dump(ostream&o, unsigned ind) const
 }
 
 void NetScope::dump(ostream&o) const
+{
+      dump_local(o);
+
+	/* Dump any sub-scopes. */
+      for (map<hname_t,NetScope*>::const_iterator cur = children_.begin()
+		 ; cur != children_.end() ; ++ cur )
+	    cur->second->dump(o);
+}
+
+void NetScope::dump_local(ostream&o) const
 {
 	/* This is a constructed hierarchical name. */
       o << scope_path(this) << " ";
@@ -1315,11 +1326,19 @@ void NetScope::dump(ostream&o) const
 	  default:
 	    break;
       }
+}
+
+void NetScope::dump_indexed(ostream&o, list<pair<string,long> >&index) const
+{
+      ostringstream name;
+      name << scope_path(this);
+      index.push_back(make_pair(name.str(), (long) o.tellp()));
+
+      dump_local(o);
 
-	/* Dump any sub-scopes. */
       for (map<hname_t,NetScope*>::const_iterator cur = children_.begin()
 		 ; cur != children_.end() ; ++ cur )
-	    cur->second->dump(o);
+	    cur->second->dump_indexed(o, index);
 }
 
 void NetSTask::dump(ostream&o, unsigned ind) const
@@ -1684,3 +1703,88 @@ void Design::dump(ostream&o) const
       for (const NetAnalogTop*idx = aprocs_ ; idx ; idx = idx->next_)
 	    idx->dump(o, 0);
 }
+
+/*
+ * The indexed dump writes the same text as the plain dump, but as a
+ * sequence of sections -- one per scope, plus one each for the nodes,
+ * branches and processes -- followed by an index that gives the file
+ * offset of every section. The second line of the file carries the
+ * offset of the index in a fixed width field that is patched once the
+ * sections are written, so a tool reads two lines, seeks to the
+ * index, and from there seeks directly to the scope it wants instead
+ * of scanning the whole file.
+ */
+void Design::dump_indexed(ostream&o) const
+{
+      list<pair<string,long> > index;
+
+      o << "INDEXED NETLIST DUMP" << endl;
+
+	// Placeholder for the index offset, patched below.
+      long patch_off = o.tellp();
+      o << "INDEX AT: " << setw(12) << setfill('0') << 0
+	<< setfill(' ') << endl;
+
+      o << "DESIGN TIME PRECISION: 10e" << get_precision() << endl;
+
+      o << "PACKAGES:" << endl;
+      for (map<perm_string,NetScope*>::const_iterator cur = packages_.begin()
+		 ; cur != packages_.end() ; ++cur) {
+	    cur->second->dump_indexed(o, index);
+      }
+
+      o << "SCOPES:" << endl;
+      for (list<NetScope*>::const_iterator scope = root_scopes_.begin();
+	   scope != root_scopes_.end(); ++ scope ) {
+	    (*scope)->dump_indexed(o, index);
+      }
+
+      index.push_back(make_pair(string("ELABORATED NODES"),
+				(long) o.tellp()));
+      o << "ELABORATED NODES:" << endl;
+
+      if (nodes_) {
+	    NetNode*cur = nodes_->node_next_;
+	    do {
+		  assert(cur);
+		  cur->dump_node(o, 0);
+		  cur = cur->node_next_;
+	    } while (cur != nodes_->node_next_);
+      }
+
+      index.push_back(make_pair(string("ELABORATED BRANCHES"),
+				(long) o.tellp()));
+      o << "ELABORATED BRANCHES:" << endl;
+
+      if (branches_) {
+	    for (NetBranch*cur = branches_ ; cur ; cur = cur->next_)
+		  cur->dump(o, 0);
+      }
+
+      index.push_back(make_pair(string("ELABORATED PROCESSES"),
+				(long) o.tellp()));
+      o << "ELABORATED PROCESSES:" << endl;
+
+      for (const NetProcTop*idx = procs_ ;  idx ;  idx = idx->next_)
+	    idx->dump(o, 0);
+
+      for (const NetAnalogTop*idx = aprocs_ ; idx ; idx = idx->next_)
+	    idx->dump(o, 0);
+
+	// Write the index itself: one line per section, with the
+	// decimal file offset first so tools can sscanf it.
+      long index_off = o.tellp();
+      o << "INDEX:" << endl;
+      for (list<pair<string,long> >::const_iterator cur = index.begin()
+		 ; cur != index.end() ; ++ cur) {
+	    o << setw(12) << setfill('0') << cur->second
+	      << setfill(' ') << " " << cur->first << endl;
+      }
+      o << "END INDEX" << endl;
+
+	// Go back and patch the index offset into the header.
+      o.seekp(patch_off);
+      o << "INDEX AT: " << setw(12) << setfill('0') << index_off
+	<< setfill(' ');
+      o.seekp(0, ios::end);
+}
@@ -252,43 +252,87 @@ NetExpr* PEBinary::elaborate_expr(Design*des, NetScope*scope,
 {
       flags &= ~SYS_TASK_ARG; // don't propagate the SYS_TASK_ARG flag
 
-      ivl_assert(*this, left_);
-      ivl_assert(*this, right_);
+	// Generated code can chain thousands of binary operators
+	// down the left spine (a left-associative a+b+c+... parse),
+	// and elaborating that with one call frame per operator can
+	// run the compiler out of stack. So collect the spine into an
+	// explicit stack first, then elaborate the operands and fold
+	// the results back up in post-order. Only plain PEBinary
+	// nodes join the spine; the operator subclasses have their
+	// own elaborate_expr methods and are elaborated through the
+	// virtual call like any other operand.
+      struct spine_cell {
+	    const PEBinary*node;
+	    unsigned wid;
+	    unsigned l_width;
+	    unsigned r_width;
+      };
+      vector<spine_cell> spine;
+
+      const PEBinary*cur = this;
+      unsigned cur_wid = expr_wid;
+      for (;;) {
+	    ivl_assert(*cur, cur->left_);
+	    ivl_assert(*cur, cur->right_);
+
+	      // Handle the special case that one of the operands is a
+	      // real value and the other is a vector type. In that case,
+	      // elaborate the vectorable argument as self-determined.
+	      // Propagate the expression type (signed/unsigned) down to
+	      // any context-determined operands.
+	    spine_cell cell;
+	    cell.node = cur;
+	    cell.wid = cur_wid;
+	    cell.l_width = cur_wid;
+	    cell.r_width = cur_wid;
+	    if (cur->left_->expr_type()==IVL_VT_REAL
+		&& type_is_vectorable(cur->right_->expr_type())) {
+		  cell.r_width = cur->right_->expr_width();
+	    } else {
+		  cur->right_->cast_signed(cur->signed_flag_);
+	    }
+	    if (cur->right_->expr_type()==IVL_VT_REAL
+		&& type_is_vectorable(cur->left_->expr_type())) {
+		  cell.l_width = cur->left_->expr_width();
+	    } else {
+		  cur->left_->cast_signed(cur->signed_flag_);
+	    }
+	    spine.push_back(cell);
 
-	// Handle the special case that one of the operands is a real
-	// value and the other is a vector type. In that case,
-	// elaborate the vectorable argument as self-determined.
-        // Propagate the expression type (signed/unsigned) down to
-        // any context-determined operands.
-      unsigned l_width = expr_wid;
-      unsigned r_width = expr_wid;
-      if (left_->expr_type()==IVL_VT_REAL
-	  && type_is_vectorable(right_->expr_type())) {
-	    r_width = right_->expr_width();
-      } else {
-            right_->cast_signed(signed_flag_);
-      }
-      if (right_->expr_type()==IVL_VT_REAL
-	  && type_is_vectorable(left_->expr_type())) {
-	    l_width = left_->expr_width();
-      } else {
-            left_->cast_signed(signed_flag_);
+	    if (typeid(*cur->left_) != typeid(PEBinary))
+		  break;
+	    cur = static_cast<const PEBinary*> (cur->left_);
+	    cur_wid = cell.l_width;
       }
 
-      NetExpr*lp =  left_->elaborate_expr(des, scope, l_width, flags);
-      NetExpr*rp = right_->elaborate_expr(des, scope, r_width, flags);
-      if ((lp == 0) || (rp == 0)) {
-	    delete lp;
-	    delete rp;
-	    return 0;
-      }
+	// Elaborate the deepest left operand, then fold the spine
+	// back up, elaborating each right operand in turn. The lp
+	// value carries the accumulated result from node to node.
+      NetExpr*lp = spine.back().node->left_
+	    ->elaborate_expr(des, scope, spine.back().l_width, flags);
 
-	// If either expression can be evaluated ahead of time, then
-	// do so. This can prove helpful later.
-      eval_expr(lp, l_width);
-      eval_expr(rp, r_width);
+      for (size_t idx = spine.size() ; idx > 0 ; idx -= 1) {
+	    const spine_cell&cell = spine[idx-1];
+
+	    NetExpr*rp = cell.node->right_
+		  ->elaborate_expr(des, scope, cell.r_width, flags);
+	    if ((lp == 0) || (rp == 0)) {
+		  delete lp;
+		  delete rp;
+		  return 0;
+	    }
+
+	      // If either expression can be evaluated ahead of time,
+	      // then do so. This can prove helpful later.
+	    eval_expr(lp, cell.l_width);
+	    eval_expr(rp, cell.r_width);
+
+	    lp = cell.node->elaborate_expr_base_(des, lp, rp, cell.wid);
+	    if (lp == 0)
+		  return 0;
+      }
 
-      return elaborate_expr_base_(des, lp, rp, expr_wid);
+      return lp;
 }
 
 /*
@@ -663,6 +663,166 @@ bool PGenerate::generate_scope(Design*des, NetScope*container)
       }
 }
 
+/*
+ * The test and step expressions of a generate loop are re-evaluated
+ * for every iteration, and elab_and_eval builds, elaborates and
+ * deletes a NetExpr tree each time. The overwhelmingly common
+ * expressions ("lp<SIZE", "lp=lp+1") involve only the genvar,
+ * literals, and parameters that are already evaluated constants, so
+ * analyze the expression once up front and then re-evaluate it per
+ * iteration with plain long arithmetic - the same semantics that
+ * PEBinary::eval_const uses. Anything the analysis cannot prove safe
+ * (hierarchical names, unevaluated parameters, width-sensitive
+ * operators, values that do not fit in a long) falls back to the
+ * full elaboration path.
+ *
+ * The analysis caches the value of every invariant (non-genvar) leaf
+ * in the map, so the per-iteration evaluation never needs to touch
+ * the symbol tables.
+ */
+static bool genvar_fast_analyze_(Design*des, NetScope*scope, PExpr*expr,
+				 perm_string genvar_name,
+				 map<PExpr*,long>&invariant)
+{
+      if (PENumber*num = dynamic_cast<PENumber*>(expr)) {
+	    const verinum&val = num->value();
+	    if (! val.is_defined())
+		  return false;
+	    if (val.len() >= 8*sizeof(long))
+		  return false;
+	    invariant[expr] = val.as_long();
+	    return true;
+      }
+
+      if (PEIdent*id = dynamic_cast<PEIdent*>(expr)) {
+	    const pform_name_t&path = id->path();
+	    if (path.size() != 1 || ! path.back().index.empty())
+		  return false;
+
+	      // The genvar itself. Leave it out of the invariant map
+	      // so the evaluator substitutes the iteration value.
+	    if (peek_tail_name(path) == genvar_name)
+		  return true;
+
+	      // Otherwise the name is only usable if it resolves to a
+	      // parameter that has already been evaluated down to a
+	      // constant.
+	    NetNet*net = 0;
+	    NetEvent*eve = 0;
+	    const NetExpr*par = 0;
+	    symbol_search(id, des, scope, path, net, par, eve);
+	    const NetEConst*parc = dynamic_cast<const NetEConst*>(par);
+	    if (parc == 0)
+		  return false;
+
+	    const verinum&val = parc->value();
+	    if (! val.is_defined())
+		  return false;
+	    if (val.len() >= 8*sizeof(long))
+		  return false;
+	    invariant[expr] = val.as_long();
+	    return true;
+      }
+
+      if (PEUnary*unary = dynamic_cast<PEUnary*>(expr)) {
+	    switch (unary->get_op()) {
+		case '+':
+		case '-':
+		case '!':
+		  return genvar_fast_analyze_(des, scope, unary->get_expr(),
+					      genvar_name, invariant);
+		default:
+		  return false;
+	    }
+      }
+
+      if (PEBinary*binary = dynamic_cast<PEBinary*>(expr)) {
+	    switch (binary->get_op()) {
+		case '+':
+		case '-':
+		case '*':
+		case '/':
+		case '%':
+		case '<':
+		case '>':
+		case 'L': // <=
+		case 'G': // >=
+		case 'e': // ==
+		case 'n': // !=
+		  return genvar_fast_analyze_(des, scope, binary->get_left(),
+					      genvar_name, invariant)
+			&& genvar_fast_analyze_(des, scope, binary->get_right(),
+						genvar_name, invariant);
+		default:
+		  return false;
+	    }
+      }
+
+      return false;
+}
+
+static bool genvar_fast_eval_(PExpr*expr, long genvar_val,
+			      const map<PExpr*,long>&invariant, long&result)
+{
+      map<PExpr*,long>::const_iterator cur = invariant.find(expr);
+      if (cur != invariant.end()) {
+	    result = cur->second;
+	    return true;
+      }
+
+	// The only identifier the analysis admits without caching a
+	// value is the genvar itself.
+      if (dynamic_cast<PEIdent*>(expr)) {
+	    result = genvar_val;
+	    return true;
+      }
+
+      if (PEUnary*unary = dynamic_cast<PEUnary*>(expr)) {
+	    long val;
+	    if (! genvar_fast_eval_(unary->get_expr(), genvar_val,
+				    invariant, val))
+		  return false;
+	    switch (unary->get_op()) {
+		case '+': result = val;        return true;
+		case '-': result = -val;       return true;
+		case '!': result = (val == 0); return true;
+		default:  return false;
+	    }
+      }
+
+      if (PEBinary*binary = dynamic_cast<PEBinary*>(expr)) {
+	    long lval, rval;
+	    if (! genvar_fast_eval_(binary->get_left(), genvar_val,
+				    invariant, lval))
+		  return false;
+	    if (! genvar_fast_eval_(binary->get_right(), genvar_val,
+				    invariant, rval))
+		  return false;
+	    switch (binary->get_op()) {
+		case '+': result = lval + rval;  return true;
+		case '-': result = lval - rval;  return true;
+		case '*': result = lval * rval;  return true;
+		case '/':
+		  if (rval == 0) return false;
+		  result = lval / rval;
+		  return true;
+		case '%':
+		  if (rval == 0) return false;
+		  result = lval % rval;
+		  return true;
+		case '<': result = lval < rval;  return true;
+		case '>': result = lval > rval;  return true;
+		case 'L': result = lval <= rval; return true;
+		case 'G': result = lval >= rval; return true;
+		case 'e': result = lval == rval; return true;
+		case 'n': result = lval != rval; return true;
+		default:  return false;
+	    }
+      }
+
+      return false;
+}
+
 /*
  * This is the elaborate scope method for a generate loop.
  */
@@ -751,6 +911,20 @@ bool PGenerate::generate_scope_loop_(Design*des, NetScope*container)
 	    cerr << get_fileline() << ": debug: genvar init = " << genvar << endl;
       container->genvar_tmp = loop_index;
       container->genvar_tmp_val = genvar;
+
+	// Try to analyze the test and step expressions for fast
+	// re-evaluation, so the iterations below do not pay for a
+	// full elaboration of each. If the analysis fails, every
+	// iteration uses elab_and_eval as before.
+      map<PExpr*,long> fast_invariant;
+      bool fast_flag = genvar_fast_analyze_(des, container, loop_test,
+					    loop_index, fast_invariant)
+	    && genvar_fast_analyze_(des, container, loop_step,
+				    loop_index, fast_invariant);
+      if (debug_scopes && fast_flag)
+	    cerr << get_fileline() << ": debug: genvar test/step"
+		 << " expressions qualify for fast evaluation." << endl;
+
       NetExpr*test_ex = elab_and_eval(des, container, loop_test, -1, true);
       NetEConst*test = dynamic_cast<NetEConst*>(test_ex);
       if (test == 0) {
@@ -759,7 +933,10 @@ bool PGenerate::generate_scope_loop_(Design*des, NetScope*container)
 	    des->errors += 1;
 	    return false;
       }
-      while (test->value().as_long()) {
+      bool test_flag = test->value().as_long() != 0;
+      delete test_ex;
+
+      while (test_flag) {
 
 	      // The actual name of the scope includes the genvar so
 	      // that each instance has a unique name in the
@@ -796,26 +973,44 @@ bool PGenerate::generate_scope_loop_(Design*des, NetScope*container)
 
 	    elaborate_subscope_(des, scope);
 
-	      // Calculate the step for the loop variable.
-	    NetExpr*step_ex = elab_and_eval(des, container, loop_step, -1, true);
-	    NetEConst*step = dynamic_cast<NetEConst*>(step_ex);
-	    if (step == 0) {
-		  cerr << get_fileline() << ": error: Cannot evaluate genvar"
-		       << " step expression: " << *loop_step << endl;
-		  des->errors += 1;
-		  return false;
-	    }
-	    if (debug_scopes)
-		  cerr << get_fileline() << ": debug: genvar step from "
-		       << genvar << " to " << step->value().as_long() << endl;
+	      // Calculate the step for the loop variable. The fast
+	      // evaluator can fail at run time (e.g. division by
+	      // zero), so fall back to full elaboration in that case.
+	    long fast_val;
+	    if (fast_flag && genvar_fast_eval_(loop_step, genvar,
+					       fast_invariant, fast_val)) {
+		  if (debug_scopes)
+			cerr << get_fileline() << ": debug: genvar step from "
+			     << genvar << " to " << fast_val << endl;
+		  genvar = fast_val;
+	    } else {
+		  NetExpr*step_ex = elab_and_eval(des, container, loop_step, -1, true);
+		  NetEConst*step = dynamic_cast<NetEConst*>(step_ex);
+		  if (step == 0) {
+			cerr << get_fileline() << ": error: Cannot evaluate genvar"
+			     << " step expression: " << *loop_step << endl;
+			des->errors += 1;
+			return false;
+		  }
+		  if (debug_scopes)
+			cerr << get_fileline() << ": debug: genvar step from "
+			     << genvar << " to " << step->value().as_long() << endl;
 
-	    genvar = step->value().as_long();
+		  genvar = step->value().as_long();
+		  delete step;
+	    }
 	    container->genvar_tmp_val = genvar;
-	    delete step;
-	    delete test_ex;
-	    test_ex = elab_and_eval(des, container, loop_test, -1);
-	    test = dynamic_cast<NetEConst*>(test_ex);
-	    assert(test);
+
+	    if (fast_flag && genvar_fast_eval_(loop_test, genvar,
+					       fast_invariant, fast_val)) {
+		  test_flag = fast_val != 0;
+	    } else {
+		  test_ex = elab_and_eval(des, container, loop_test, -1);
+		  test = dynamic_cast<NetEConst*>(test_ex);
+		  assert(test);
+		  test_flag = test->value().as_long() != 0;
+		  delete test_ex;
+	    }
       }
 
 	// Clear the genvar_tmp field in the scope to reflect that the
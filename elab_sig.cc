@@ -183,12 +183,8 @@ static void elaborate_sig_tasks(Design*des, NetScope*scope,
 }
 
 
-bool Module::elaborate_sig(Design*des, NetScope*scope) const
+void Module::elaborate_sig_ports_(Design*des) const
 {
-      bool flag = true;
-
-	// Scan all the ports of the module, and make sure that each
-	// is connected to wires that have port declarations.
       for (unsigned idx = 0 ;  idx < ports.size() ;  idx += 1) {
 	    Module::port_t*pp = ports[idx];
 	    if (pp == 0)
@@ -230,6 +226,21 @@ bool Module::elaborate_sig(Design*des, NetScope*scope) const
 		  }
 	    }
       }
+}
+
+bool Module::elaborate_sig(Design*des, NetScope*scope) const
+{
+      bool flag = true;
+
+	// Scan all the ports of the module, and make sure that each
+	// is connected to wires that have port declarations. These
+	// checks look only at the module definition, so for modules
+	// instantiated many times (the common case in gate netlists)
+	// run them once instead of once per instance.
+      if (! port_checks_done_) {
+	    port_checks_done_ = true;
+	    elaborate_sig_ports_(des);
+      }
 
       flag = elaborate_sig_wires_(des, scope) && flag;
 
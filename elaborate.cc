@@ -4163,6 +4163,32 @@ void PFunction::elaborate(Design*des, NetScope*scope) const
       def->set_proc(st);
 }
 
+/*
+ * A function that nothing in the design references does not need its
+ * body elaborated. Give the definition an empty statement instead,
+ * which is the same shape the deadtask pass leaves behind when it
+ * removes a body. If the body was already elaborated on demand (for
+ * example to evaluate a constant expression) then leave it alone.
+ */
+void PFunction::elaborate_stub(Design*, NetScope*scope) const
+{
+      if (scope->elab_stage() > 2)
+            return;
+
+      scope->set_elab_stage(3);
+
+      NetFuncDef*def = scope->func_def();
+      if (def == 0)
+	    return;
+
+      if (debug_elaborate)
+	    cerr << get_fileline() << ": debug: Function "
+		 << scope_path(scope) << " is never called, "
+		 << "so give it a stub body." << endl;
+
+      def->set_proc(new NetBlock(NetBlock::SEQU, 0));
+}
+
 NetProc* PRelease::elaborate(Design*des, NetScope*scope) const
 {
       assert(scope);
@@ -4276,6 +4302,28 @@ void PTask::elaborate(Design*des, NetScope*task) const
       def->set_proc(st);
 }
 
+/*
+ * A task that nothing in the design calls (or disables) does not
+ * need its statement elaborated. Any variable initialization
+ * processes in the task scope still need to run, so elaborate those
+ * as usual, then give the definition an empty body the same way the
+ * deadtask pass does when it removes one.
+ */
+void PTask::elaborate_stub(Design*des, NetScope*task) const
+{
+      elaborate_behaviors_(des, task);
+
+      NetTaskDef*def = task->task_def();
+      assert(def);
+
+      if (debug_elaborate)
+	    cerr << get_fileline() << ": debug: Task "
+		 << scope_path(task) << " is never called, "
+		 << "so give it a stub body." << endl;
+
+      def->set_proc(new NetBlock(NetBlock::SEQU, 0));
+}
+
 NetProc* PTrigger::elaborate(Design*des, NetScope*scope) const
 {
       assert(scope);
@@ -4621,7 +4669,25 @@ void PSpecPath::elaborate(Design*des, NetScope*scope) const
       }
 }
 
-static void elaborate_functions(Design*des, NetScope*scope,
+/*
+ * Task and function bodies are elaborated on demand. The module
+ * elaboration records each body here instead of elaborating it
+ * inline, and the fixpoint at the end of elaborate() below
+ * elaborates the bodies that the design actually references,
+ * leaving stubs for the rest. The reference counts on the scopes
+ * are maintained by the NetUTask, NetEUFunc, NetUserFunc and
+ * NetDisable objects that process and net elaboration create, so by
+ * the time the fixpoint runs the seed set is exactly the items that
+ * the behaviors and continuous assignments reach.
+ */
+struct deferred_tf_body {
+      const PFunction*func;
+      const PTask*task;
+      NetScope*scope;
+};
+static list<deferred_tf_body> deferred_tf_bodies;
+
+static void elaborate_functions(Design*, NetScope*scope,
 				const map<perm_string,PFunction*>&funcs)
 {
       typedef map<perm_string,PFunction*>::const_iterator mfunc_it_t;
@@ -4631,11 +4697,15 @@ static void elaborate_functions(Design*des, NetScope*scope,
 	    hname_t use_name ( (*cur).first );
 	    NetScope*fscope = scope->child(use_name);
 	    assert(fscope);
-	    (*cur).second->elaborate(des, fscope);
+
+	      // Defer the body. The fixpoint in elaborate() comes
+	      // back to it if anything calls the function.
+	    deferred_tf_body item = { (*cur).second, 0, fscope };
+	    deferred_tf_bodies.push_back(item);
       }
 }
 
-static void elaborate_tasks(Design*des, NetScope*scope,
+static void elaborate_tasks(Design*, NetScope*scope,
 			    const map<perm_string,PTask*>&tasks)
 {
       typedef map<perm_string,PTask*>::const_iterator mtask_it_t;
@@ -4645,7 +4715,10 @@ static void elaborate_tasks(Design*des, NetScope*scope,
 	    hname_t use_name ( (*cur).first );
 	    NetScope*tscope = scope->child(use_name);
 	    assert(tscope);
-	    (*cur).second->elaborate(des, tscope);
+
+	      // Defer the body, just like the functions above.
+	    deferred_tf_body item = { 0, (*cur).second, tscope };
+	    deferred_tf_bodies.push_back(item);
       }
 }
 
@@ -4665,12 +4738,12 @@ bool Module::elaborate(Design*des, NetScope*scope) const
 	    (*cur)->elaborate(des, scope);
       }
 
-	// Elaborate functions.
+	// Queue the function bodies for demand elaboration.
       elaborate_functions(des, scope, funcs);
 
-	// Elaborate the task definitions. This is done before the
-	// behaviors so that task calls may reference these, and after
-	// the signals so that the tasks can reference them.
+	// Queue the task bodies as well. The NetTaskDef objects
+	// already exist from signal elaboration, so the behaviors
+	// can elaborate calls to these without the bodies.
       elaborate_tasks(des, scope, tasks);
 
 	// Get all the gates of the module and elaborate them by
@@ -5111,12 +5184,11 @@ Design* elaborate(list<perm_string>roots)
 	      // by a generate construct or instance array.
 	    des->elaboration_work_list.push_back(new top_defparams(des));
 
-	      // Transfer the queue to a temporary queue.
+	      // Transfer the queue to a temporary queue. The splice
+	      // moves the list nodes themselves, so this is cheap
+	      // even with millions of pending scope work items.
 	    list<elaborator_work_item_t*> cur_queue;
-	    while (! des->elaboration_work_list.empty()) {
-		  cur_queue.push_back(des->elaboration_work_list.front());
-		  des->elaboration_work_list.pop_front();
-	    }
+	    cur_queue.splice(cur_queue.end(), des->elaboration_work_list);
 
 	      // Run from the temporary queue. If the temporary queue
 	      // items create new work queue items, they will show up
@@ -5203,6 +5275,46 @@ Design* elaborate(list<perm_string>roots)
 	    delete root_elems[i];
       }
 
+	// The passes above deferred the task and function bodies
+	// instead of elaborating them inline. Now elaborate the
+	// bodies that are actually referenced. Elaborating a body
+	// may create references to further tasks and functions, so
+	// iterate until no more bodies become reachable.
+      bool deferred_changed = true;
+      while (deferred_changed) {
+	    deferred_changed = false;
+	    for (list<deferred_tf_body>::iterator cur = deferred_tf_bodies.begin()
+		       ; cur != deferred_tf_bodies.end() ; ) {
+		  if (cur->scope->peek_call_ref() == 0) {
+			++ cur;
+			continue;
+		  }
+		  if (cur->func)
+			cur->func->elaborate(des, cur->scope);
+		  else
+			cur->task->elaborate(des, cur->scope);
+		  cur = deferred_tf_bodies.erase(cur);
+		  deferred_changed = true;
+	    }
+      }
+
+	// Whatever is left over is never referenced, so skip the
+	// body and attach a stub instead. The deadtask pass would
+	// have reduced these items to the same shape anyhow.
+      while (! deferred_tf_bodies.empty()) {
+	    deferred_tf_body cur = deferred_tf_bodies.front();
+	    deferred_tf_bodies.pop_front();
+	    if (cur.func)
+		  cur.func->elaborate_stub(des, cur.scope);
+	    else
+		  cur.task->elaborate_stub(des, cur.scope);
+      }
+
+	// Elaboration is done making nets, and the cleanup passes
+	// that follow may delete some, so drop the coercion cache
+	// (see pad_to_width.cc) before it can go stale.
+      flush_coerced_nets();
+
       if (rc == false) {
 	    delete des;
 	    return 0;
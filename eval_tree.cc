@@ -23,7 +23,9 @@
 # include  <iostream>
 # include  <cstdlib>
 # include  <cstring>
+# include  <cstdio>
 # include  <cmath>
+# include  <map>
 
 # include  "netlist.h"
 # include  "ivl_assert.h"
@@ -34,6 +36,47 @@ NetExpr* NetExpr::eval_tree()
       return 0;
 }
 
+/*
+ * Parameter-heavy designs fold structurally identical constant
+ * expressions over and over, once per instance. The folded NetEConst
+ * nodes themselves cannot be shared - NetExpr trees are single-owner
+ * objects that callers delete freely - but the expensive part of a
+ * refold is re-running the wide verinum multiply, divide or power, so
+ * memoize those results here keyed on the operator, result width and
+ * operand values. A hit hands back a copy of the cached verinum that
+ * the caller wraps in a fresh NetEConst it owns outright.
+ */
+static map<string,verinum> fold_cache;
+
+static string fold_cache_key(char op, unsigned wid,
+			     const verinum&lval, const verinum&rval)
+{
+      static const char bit_chars[4] = { '0', '1', 'x', 'z' };
+      char head[64];
+      snprintf(head, sizeof head, "%c%u:%d%d%d%d:", op, wid,
+	       lval.has_sign(), lval.has_len(),
+	       rval.has_sign(), rval.has_len());
+
+      string key = head;
+      key.reserve(key.size() + lval.len() + rval.len() + 1);
+      for (unsigned idx = 0 ;  idx < lval.len() ;  idx += 1)
+	    key += bit_chars[lval.get(idx)];
+      key += ':';
+      for (unsigned idx = 0 ;  idx < rval.len() ;  idx += 1)
+	    key += bit_chars[rval.get(idx)];
+
+      return key;
+}
+
+static bool fold_cache_find(const string&key, verinum&val)
+{
+      map<string,verinum>::const_iterator cur = fold_cache.find(key);
+      if (cur == fold_cache.end())
+	    return false;
+      val = cur->second;
+      return true;
+}
+
 static void eval_debug(const NetExpr*expr, NetExpr*res, bool is_real)
 {
       if (res != 0) {
@@ -799,16 +842,20 @@ NetExpr* NetEBDiv::eval_arguments_(const NetExpr*l, const NetExpr*r) const
       ivl_assert(*this, lval.len() == wid);
       ivl_assert(*this, rval.len() == wid);
 
+      string key = fold_cache_key(op_, wid, lval, rval);
       verinum val;
-      switch (op_) {
-	  case '/':
-	    val = verinum(lval / rval, wid);
-	    break;
-	  case '%':
-	    val = verinum(lval % rval, wid);
-	    break;
-	  default:
-	    return 0;
+      if (! fold_cache_find(key, val)) {
+	    switch (op_) {
+		case '/':
+		  val = verinum(lval / rval, wid);
+		  break;
+		case '%':
+		  val = verinum(lval % rval, wid);
+		  break;
+		default:
+		  return 0;
+	    }
+	    fold_cache[key] = val;
       }
       NetExpr*tmp = new NetEConst(val);
       ivl_assert(*this, tmp);
@@ -1012,7 +1059,12 @@ NetExpr* NetEBMult::eval_arguments_(const NetExpr*l, const NetExpr*r) const
       ivl_assert(*this, lval.len() == wid);
       ivl_assert(*this, rval.len() == wid);
 
-      verinum val(lval * rval, wid);
+      string key = fold_cache_key(op_, wid, lval, rval);
+      verinum val;
+      if (! fold_cache_find(key, val)) {
+	    val = verinum(lval * rval, wid);
+	    fold_cache[key] = val;
+      }
       NetEConst*tmp = new NetEConst(val);
       ivl_assert(*this, tmp);
       eval_debug(this, tmp, false);
@@ -1049,7 +1101,12 @@ NetExpr* NetEBPow::eval_arguments_(const NetExpr*l, const NetExpr*r) const
       ivl_assert(*this, wid > 0);
       ivl_assert(*this, lval.len() == wid);
 
-      verinum val(pow(lval, rval), wid);
+      string key = fold_cache_key(op_, wid, lval, rval);
+      verinum val;
+      if (! fold_cache_find(key, val)) {
+	    val = verinum(pow(lval, rval), wid);
+	    fold_cache[key] = val;
+      }
       NetEConst*res = new NetEConst(val);
       ivl_assert(*this, res);
       eval_debug(this, res, false);
@@ -30,6 +30,11 @@ functor_t::~functor_t()
 {
 }
 
+unsigned functor_t::scan_mask() const
+{
+      return SCAN_ALL;
+}
+
 void functor_t::event(Design*, NetEvent*)
 {
 }
@@ -132,21 +137,33 @@ void NetScope::run_functor(Design*des, functor_t*fun)
 
 void Design::functor(functor_t*fun)
 {
-	// Scan the scopes
-      for (list<NetScope*>::const_iterator scope = root_scopes_.begin();
-	   scope != root_scopes_.end(); ++ scope )
-	    (*scope)->run_functor(this, fun);
+      unsigned mask = fun->scan_mask();
+
+	// Scan the scopes. This is where the events and signals are.
+      if (mask & (functor_t::SCAN_EVENT|functor_t::SCAN_SIGNAL)) {
+	    for (list<NetScope*>::const_iterator scope = root_scopes_.begin();
+		 scope != root_scopes_.end(); ++ scope )
+		  (*scope)->run_functor(this, fun);
+      }
 
 	// apply to processes
-      procs_idx_ = procs_;
-      while (procs_idx_) {
-	    NetProcTop*idx = procs_idx_;
-	    procs_idx_ = idx->next_;
-	    fun->process(this, idx);
+      if (mask & functor_t::SCAN_PROCESS) {
+	    procs_idx_ = procs_;
+	    while (procs_idx_) {
+		  NetProcTop*idx = procs_idx_;
+		  procs_idx_ = idx->next_;
+		  fun->process(this, idx);
+	    }
       }
 
-	// apply to nodes
-      if (nodes_) {
+	// apply to nodes, one class ring at a time, skipping the
+	// classes the functor does not handle.
+      for (unsigned cls = 0 ;  cls < NetNode::CLASS_COUNT ;  cls += 1) {
+	    if (! (mask & (functor_t::SCAN_NODE_BASE << cls)))
+		  continue;
+	    if (class_nodes_[cls] == 0)
+		  continue;
+
 	    assert(nodes_functor_cur_ == 0);
 	    assert(nodes_functor_nxt_ == 0);
 
@@ -159,19 +176,18 @@ void Design::functor(functor_t*fun)
 		 the del_node method, which checks with the
 		 nodes_functor_* members, to keep the iterator
 		 operating safely. */
-	    nodes_functor_cur_ = nodes_;
+	    nodes_functor_cur_ = class_nodes_[cls];
 	    do {
-		  nodes_functor_nxt_ = nodes_functor_cur_->node_next_;
+		  nodes_functor_nxt_ = nodes_functor_cur_->class_next_;
 		  nodes_functor_cur_->functor_node(this, fun);
 
 		  if (nodes_functor_nxt_ == 0)
 			break;
 
 		  nodes_functor_cur_ = nodes_functor_nxt_;
-	    } while (nodes_ && (nodes_functor_cur_ != nodes_));
+	    } while (class_nodes_[cls] && (nodes_functor_cur_ != class_nodes_[cls]));
 	    nodes_functor_cur_ = 0;
 	    nodes_functor_nxt_ = 0;
-
       }
 }
 
@@ -39,6 +39,41 @@ class NetProcTop;
 struct functor_t {
       virtual ~functor_t();
 
+	/* Scan categories, for use in the scan_mask method below.
+	   The node bits are one per node class, in the order of the
+	   NetNode::node_class_t enum, starting at SCAN_NODE_BASE. */
+      enum scan_item_t {
+	    SCAN_EVENT       = 0x00000001,
+	    SCAN_SIGNAL      = 0x00000002,
+	    SCAN_PROCESS     = 0x00000004,
+	    SCAN_NODE_BASE   = 0x00000008,
+	    SCAN_ABS         = 0x00000008,
+	    SCAN_ADD_SUB     = 0x00000010,
+	    SCAN_COMPARE     = 0x00000020,
+	    SCAN_CONCAT      = 0x00000040,
+	    SCAN_CONST       = 0x00000080,
+	    SCAN_DIVIDE      = 0x00000100,
+	    SCAN_LITERAL     = 0x00000200,
+	    SCAN_MODULO      = 0x00000400,
+	    SCAN_FF          = 0x00000800,
+	    SCAN_LOGIC       = 0x00001000,
+	    SCAN_MULT        = 0x00002000,
+	    SCAN_MUX         = 0x00004000,
+	    SCAN_PART_SELECT = 0x00008000,
+	    SCAN_POW         = 0x00010000,
+	    SCAN_SIGN_EXTEND = 0x00020000,
+	    SCAN_UREDUCE     = 0x00040000,
+	    SCAN_OTHER_NODES = 0x00080000,
+	    SCAN_ALL         = ~0U
+      };
+
+	/* The categories of objects this functor actually handles.
+	   Design::functor only scans the object lists selected
+	   here, so a pass that only rewrites logic gates does not
+	   touch every constant and multiplier in the design. The
+	   default is to scan everything. */
+      virtual unsigned scan_mask() const;
+
 	/* Events are scanned here. */
       virtual void event(class Design*des, class NetEvent*);
 
@@ -443,6 +443,13 @@ typedef int (*ivl_process_f)(ivl_process_t net, void*cd);
    the user passes to the scanner. */
 typedef int (ivl_scope_f)(ivl_scope_t net, void*cd);
 
+/* These are the types of functions that the bulk scope scan methods
+   (ivl_scope_scan_logs, etc.) apply to each device of a scope. The cd
+   parameter is client data that the user passes to the scanner. */
+typedef int (*ivl_net_logic_f)(ivl_net_logic_t net, void*cd);
+typedef int (*ivl_lpm_f)(ivl_lpm_t net, void*cd);
+typedef int (*ivl_signal_f)(ivl_signal_t net, void*cd);
+
 /* Attributes, which can be attached to various object types, have
    this form. */
 typedef enum ivl_attribute_type_e {
@@ -976,6 +983,13 @@ extern unsigned ivl_logic_lineno(ivl_net_logic_t net);
  *    together, then these values are the same. Use the nexus
  *    functions to find other pins that are connected to this nexus.
  *
+ * ivl_logic_pin_array
+ *    Return a read-only array of all the pin nexa of the device,
+ *    with ivl_logic_pins elements. This is equivalent to calling
+ *    ivl_logic_pin for each index, but allows the code generator to
+ *    iterate without a function call per pin. The array is owned by
+ *    the core and remains valid for the life of the design.
+ *
  * ivl_logic_width
  *    This returns the width of the logic array. This does not affect
  *    the number of pins, but implies the width of the vector at each
@@ -1047,6 +1061,7 @@ extern const char* ivl_logic_basename(ivl_net_logic_t net);
 extern ivl_scope_t ivl_logic_scope(ivl_net_logic_t net);
 extern ivl_logic_t ivl_logic_type(ivl_net_logic_t net);
 extern ivl_nexus_t ivl_logic_pin(ivl_net_logic_t net, unsigned pin);
+extern ivl_nexus_t const* ivl_logic_pin_array(ivl_net_logic_t net);
 extern unsigned    ivl_logic_pins(ivl_net_logic_t net);
 extern ivl_udp_t   ivl_logic_udp(ivl_net_logic_t net);
 extern ivl_expr_t  ivl_logic_delay(ivl_net_logic_t net, unsigned transition);
@@ -1504,6 +1519,13 @@ extern ivl_signal_t ivl_lval_sig(ivl_lval_t net);
  * ivl_nexus_ptr
  *    Return a nexus pointer given the nexus and an index.
  *
+ * ivl_nexus_ptr_array
+ *    Fill the caller supplied array with all the pointers of the
+ *    nexus, ivl_nexus_ptrs elements in all. This is equivalent to
+ *    calling ivl_nexus_ptr for each index, but with a single call
+ *    for the whole set. The pointers themselves remain owned by the
+ *    core and valid for the life of the design.
+ *
  * ivl_nexus_set_private
  * ivl_nexus_get_private
  *    The target module often needs to associate data with a nexus for
@@ -1563,6 +1585,8 @@ extern ivl_signal_t ivl_lval_sig(ivl_lval_t net);
 extern const char*     ivl_nexus_name(ivl_nexus_t net) __attribute__((deprecated));
 extern unsigned        ivl_nexus_ptrs(ivl_nexus_t net);
 extern ivl_nexus_ptr_t ivl_nexus_ptr(ivl_nexus_t net, unsigned idx);
+extern void            ivl_nexus_ptr_array(ivl_nexus_t net,
+					   ivl_nexus_ptr_t*ptrs);
 
 extern void  ivl_nexus_set_private(ivl_nexus_t net, void*data);
 extern void* ivl_nexus_get_private(ivl_nexus_t net);
@@ -1727,6 +1751,17 @@ extern unsigned ivl_parameter_lineno(ivl_parameter_t net);
  *    includes the return value, as port 0. The remaining ports are
  *    the input ports in order.
  *
+ * ivl_scope_scan_logs
+ * ivl_scope_scan_lpms
+ * ivl_scope_scan_sigs
+ *    These methods iterate the logic devices, LPM devices or signals
+ *    of a scope in one call, applying the user function to each
+ *    element in index order. They are equivalent to an index loop
+ *    over the corresponding count/index methods, but make a single
+ *    API crossing for the whole scope. Like ivl_scope_children, the
+ *    iteration stops early if the function returns non-0, and that
+ *    value is returned.
+ *
  * ivl_scope_sig
  * ivl_scope_sigs
  *    Scopes have 0 or more signals in them. These signals are
@@ -1789,6 +1824,12 @@ extern unsigned ivl_scope_mod_module_port_width(ivl_scope_t net, unsigned idx );
 extern unsigned     ivl_scope_ports(ivl_scope_t net);
 extern ivl_signal_t ivl_scope_port(ivl_scope_t net, unsigned idx);
 extern ivl_nexus_t  ivl_scope_mod_port(ivl_scope_t net, unsigned idx);
+extern int          ivl_scope_scan_logs(ivl_scope_t net,
+					ivl_net_logic_f func, void*cd);
+extern int          ivl_scope_scan_lpms(ivl_scope_t net,
+					ivl_lpm_f func, void*cd);
+extern int          ivl_scope_scan_sigs(ivl_scope_t net,
+					ivl_signal_f func, void*cd);
 extern unsigned     ivl_scope_sigs(ivl_scope_t net);
 extern ivl_signal_t ivl_scope_sig(ivl_scope_t net, unsigned idx);
 extern unsigned     ivl_scope_switches(ivl_scope_t net);
@@ -2127,6 +2168,12 @@ extern unsigned ivl_stmt_block_count(ivl_statement_t net);
 extern ivl_scope_t ivl_stmt_block_scope(ivl_statement_t net);
   /* IVL_ST_BLOCK, IVL_ST_FORK, IVL_ST_FORK_JOIN_ANY, IVL_ST_FORK_JOIN_NONE */
 extern ivl_statement_t ivl_stmt_block_stmt(ivl_statement_t net, unsigned i);
+  /* IVL_ST_BLOCK, IVL_ST_FORK, IVL_ST_FORK_JOIN_ANY, IVL_ST_FORK_JOIN_NONE
+     Fill the caller supplied array with all the sub-statements of the
+     block, ivl_stmt_block_count elements in all, as a bulk
+     alternative to calling ivl_stmt_block_stmt per index. */
+extern void ivl_stmt_block_stmt_array(ivl_statement_t net,
+				      ivl_statement_t*stmts);
   /* IVL_ST_UTASK IVL_ST_DISABLE */
 extern ivl_scope_t ivl_stmt_call(ivl_statement_t net);
   /* IVL_ST_CASE,IVL_ST_CASER,IVL_ST_CASEX,IVL_ST_CASEZ */
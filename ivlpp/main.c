@@ -396,6 +396,12 @@ int main(int argc, char*argv[])
 	    out = stdout;
       }
 
+	/* The output is normally a pipe into the compiler, and the
+	   lexer emits it in small pieces. A large output buffer
+	   batches those into few big writes, so the reader is not
+	   woken for every ECHO. */
+      setvbuf(out, NULL, _IOFBF, 256*1024);
+
       if (precomp_out_path) {
 	    precomp_out = fopen(precomp_out_path, "wb");
 	    if (precomp_out == 0) {
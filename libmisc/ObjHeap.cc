@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2012 Stephen Williams (steve@icarus.com)
+ *
+ *    This source code is free software; you can redistribute it
+ *    and/or modify it in source code form under the terms of the GNU
+ *    General Public License as published by the Free Software
+ *    Foundation; either version 2 of the License, or (at your option)
+ *    any later version.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this program; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+# include  "ObjHeap.h"
+# include  <new>
+# include  <cassert>
+
+ObjHeap::ObjHeap()
+{
+      cell_base_ = 0;
+      cell_ptr_ = HEAPCELL;
+      chunk_list_ = 0;
+      for (unsigned idx = 0 ;  idx < NLISTS ;  idx += 1)
+	    free_list_[idx] = 0;
+}
+
+ObjHeap::~ObjHeap()
+{
+	// This is a planned memory leak. The chunks live for the
+	// life of the process, and the process exit reclaims them
+	// far faster than walking the heap would.
+}
+
+void* ObjHeap::alloc(size_t size)
+{
+      size_t use_size = (size + 7) & ~(size_t)7;
+      if (use_size == 0)
+	    use_size = 8;
+
+      size_t list = use_size/8 - 1;
+      if (list >= NLISTS)
+	    return ::operator new(size);
+
+	// Recycle a freed block of this size if there is one.
+      if (free_list_[list]) {
+	    void*res = free_list_[list];
+	    free_list_[list] = *(void**)res;
+	    return res;
+      }
+
+      if (use_size > HEAPCELL - cell_ptr_) {
+	      // The remainder of the current chunk is lost, but it
+	      // is at most 8*NLISTS bytes out of HEAPCELL. The first
+	      // 8 bytes of the new chunk chain it behind the older
+	      // chunks for release_all().
+	    cell_base_ = (char*)::operator new(HEAPCELL);
+	    *(char**)cell_base_ = chunk_list_;
+	    chunk_list_ = cell_base_;
+	    cell_ptr_ = 8;
+      }
+
+      void*res = cell_base_ + cell_ptr_;
+      cell_ptr_ += use_size;
+      return res;
+}
+
+void ObjHeap::free(void*ptr, size_t size)
+{
+      size_t use_size = (size + 7) & ~(size_t)7;
+      if (use_size == 0)
+	    use_size = 8;
+
+      size_t list = use_size/8 - 1;
+      if (list >= NLISTS) {
+	    ::operator delete(ptr);
+	    return;
+      }
+
+      *(void**)ptr = free_list_[list];
+      free_list_[list] = ptr;
+}
+
+void ObjHeap::release_all()
+{
+      while (chunk_list_) {
+	    char*next = *(char**)chunk_list_;
+	    ::operator delete(chunk_list_);
+	    chunk_list_ = next;
+      }
+
+      cell_base_ = 0;
+      cell_ptr_ = HEAPCELL;
+      for (unsigned idx = 0 ;  idx < NLISTS ;  idx += 1)
+	    free_list_[idx] = 0;
+}
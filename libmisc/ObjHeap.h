@@ -0,0 +1,73 @@
+#ifndef __ObjHeap_H
+#define __ObjHeap_H
+/*
+ * Copyright (c) 2012 Stephen Williams (steve@icarus.com)
+ *
+ *    This source code is free software; you can redistribute it
+ *    and/or modify it in source code form under the terms of the GNU
+ *    General Public License as published by the Free Software
+ *    Foundation; either version 2 of the License, or (at your option)
+ *    any later version.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this program; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+# include  <cstddef>
+
+/*
+ * The object heap hands out small allocations carved from large
+ * chunks, for the classes whose instances the compiler creates by
+ * the million (expression and netlist nodes). It is the object
+ * analog of the StringHeap: allocation is a pointer bump with no
+ * per-object malloc overhead, and consecutively created objects land
+ * next to each other in memory.
+ *
+ * Unlike the strings, these objects are also deleted individually,
+ * so freed blocks are kept on per-size free lists and reused by
+ * later allocations of the same size. The chunks themselves are
+ * never returned to the system; they are given back to the OS when
+ * the process exits.
+ */
+class ObjHeap {
+
+    public:
+      ObjHeap();
+      ~ObjHeap();
+
+      void* alloc(size_t size);
+      void free(void*ptr, size_t size);
+
+	// Hand every chunk back to the system in one pass and reset
+	// the heap to empty. No destructors are run, so this is only
+	// for heaps whose objects are all dead, such as the pform
+	// node heaps once elaboration is complete. Oversize
+	// allocations that fell through to the global operator new
+	// are not tracked and are not reclaimed here.
+      void release_all();
+
+    private:
+	// Allocations are rounded up to a multiple of 8 bytes, so
+	// the free lists cover sizes up to 8*NLISTS. Anything larger
+	// falls through to the global operator new.
+      enum { HEAPCELL = 256*1024, NLISTS = 64 };
+
+      char*cell_base_;
+      size_t cell_ptr_;
+	// Chunks are chained through their first 8 bytes so that
+	// release_all() can find them.
+      char*chunk_list_;
+      void*free_list_[NLISTS];
+
+    private: // not implemented
+      ObjHeap(const ObjHeap&);
+      ObjHeap& operator= (const ObjHeap&);
+};
+
+#endif
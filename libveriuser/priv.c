@@ -18,11 +18,72 @@
  */
 
 # include  "priv.h"
+# include  <vpi_user.h>
 # include  <string.h>
+# include  <stdlib.h>
 # include  <assert.h>
+# include  "ivl_alloc.h"
 
 FILE* pli_trace = 0;
 
+/*
+ * The tf_getp/tf_putp style routines address system task arguments
+ * by index, and the VPI expression of that is an iterate/scan walk
+ * for every call. Legacy PLI applications call these routines
+ * millions of times per run, so keep the argument handles of each
+ * call instance in this hash table, filled in the one time the
+ * instance is first seen. Argument handles are stable for the life
+ * of the simulation, so the cells are never invalidated.
+ */
+# define ARG_CACHE_SIZE 256
+
+struct arg_cache_cell {
+      vpiHandle sys_h;
+      int nargs;
+      vpiHandle*args;
+      struct arg_cache_cell*next;
+};
+
+static struct arg_cache_cell*arg_cache[ARG_CACHE_SIZE];
+
+vpiHandle __tf_find_arg(vpiHandle sys_h, int n)
+{
+      unsigned hash = ((unsigned long)sys_h >> 4) % ARG_CACHE_SIZE;
+      struct arg_cache_cell*cur;
+      vpiHandle sys_i, arg_h;
+      int idx;
+
+      for (cur = arg_cache[hash] ;  cur ;  cur = cur->next)
+	    if (cur->sys_h == sys_h) goto found;
+
+	/* First time this instance is seen. Scan the argument list
+	   once and save the handles. */
+      cur = malloc(sizeof(struct arg_cache_cell));
+      cur->sys_h = sys_h;
+      cur->nargs = 0;
+      cur->args = 0;
+
+      sys_i = vpi_iterate(vpiArgument, sys_h);
+      if (sys_i) {
+	    while ((arg_h = vpi_scan(sys_i)) != 0) {
+		  cur->nargs += 1;
+		  cur->args = realloc(cur->args,
+				      cur->nargs * sizeof(vpiHandle));
+		  cur->args[cur->nargs-1] = arg_h;
+	    }
+      }
+
+      cur->next = arg_cache[hash];
+      arg_cache[hash] = cur;
+
+found:
+      idx = n - 1;
+      if (idx < 0 || idx >= cur->nargs)
+	    return 0;
+
+      return cur->args[idx];
+}
+
 static char string_buffer[8192];
 static unsigned string_fill = 0;
 
@@ -20,6 +20,7 @@
  */
 
 # include  <stdio.h>
+# include  <vpi_user.h>
 
 /*
  * This function implements the acc_ string buffer, by adding the
@@ -28,6 +29,14 @@
  */
 extern char* __acc_newstring(const char*txt);
 
+/*
+ * Map a 1-based tf_ argument index to the argument vpiHandle of the
+ * given system task/function call instance. The argument handles are
+ * cached per instance, so repeated lookups avoid the VPI argument
+ * iterator. Returns 0 if the index is out of range.
+ */
+extern vpiHandle __tf_find_arg(vpiHandle sys_h, int n);
+
 /*
  * Trace file for logging ACC and TF calls.
  */
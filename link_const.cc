@@ -118,7 +118,7 @@ verinum::V Nexus::driven_value() const
 	    break;
       }
 
-      const Link*cur = list_;
+      const Link*cur = first_;
 
       verinum::V val = verinum::Vz;
 
@@ -176,7 +176,7 @@ verinum::V Nexus::driven_value() const
 
 verinum Nexus::driven_vector() const
 {
-      const Link*cur = list_;
+      const Link*cur = first_;
 
       verinum val;
 
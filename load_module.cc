@@ -27,29 +27,113 @@
 # include  <cstring>
 # include  <string>
 # include  <sys/types.h>
+# include  <sys/stat.h>
 # include  <dirent.h>
+# include  <unistd.h>
 # include  <cctype>
 # include  <cassert>
 # include  "ivl_alloc.h"
 
 /*
- * The module library items are maps of key names to file name within
- * the directory.
+ * The module library items record the directories given with -y, in
+ * command line order. The name indexes themselves are combined
+ * across all the libraries (see below), so this list mostly carries
+ * the directory names and their ordering.
  */
 struct module_library {
       char*dir;
       bool key_case_sensitive;
-      map<string,const char*>name_map;
+	/* Position in command line order, for resolving a name that
+	   is indexed under both key forms. */
+      unsigned seq;
       struct module_library*next;
 };
 
 static struct module_library*library_list = 0;
 static struct module_library*library_last = 0;
 
+/*
+ * All the library directories share these two name indexes, so
+ * resolving a module name is a couple of map lookups no matter how
+ * many -y directories are given. That matters most for names that
+ * are in no library at all, which with per-directory maps paid a
+ * probe per directory. Keys from case sensitive directories go in
+ * the exact index under the file name as is; keys from case
+ * insensitive directories go in the lower index, lowercased. The
+ * first directory to claim a key keeps it, matching the old
+ * first-match-wins scan order.
+ */
+struct library_index_cell {
+      struct module_library*lib;
+      const char*file;
+};
+
+static map<string,library_index_cell> library_index_exact;
+static map<string,library_index_cell> library_index_lower;
+
+static void library_index_add(map<string,library_index_cell>&index,
+			      const string&key,
+			      struct module_library*lib, const char*file)
+{
+      map<string,library_index_cell>::iterator cur = index.find(key);
+      if (cur == index.end()) {
+	    library_index_cell tmp;
+	    tmp.lib = lib;
+	    tmp.file = file;
+	    index[key] = tmp;
+
+      } else if ((*cur).second.lib == lib) {
+	      /* Within a single directory, a later file with the
+		 same key replaces the earlier one, as the old
+		 per-directory map did. Keys already claimed by an
+		 earlier directory are left alone. */
+	    (*cur).second.file = file;
+      }
+}
+
 const char dir_character = '/';
 extern char depfile_mode;
 extern FILE *depend_file;
 
+/*
+ * Library cell files rarely change, but each one loaded costs an
+ * ivlpp process spawn and a full preprocess on every compile. When
+ * the IVERILOG_MODULE_CACHE environment variable names a writable
+ * directory, keep the preprocessed text of library files there,
+ * keyed by file name, path hash, mtime and size, and parse from the
+ * cache on later compiles instead of re-running the preprocessor.
+ *
+ * The key deliberately does not cover the macro environment: the
+ * defines file is a fresh temporary on every compile, so including
+ * it would defeat the cache. Cell libraries are expected to be
+ * self-contained; clear the cache directory if command line defines
+ * that library files depend on change.
+ */
+static char*module_cache_file(const char*path)
+{
+      const char*cache_dir = getenv("IVERILOG_MODULE_CACHE");
+      if (cache_dir == 0 || cache_dir[0] == 0)
+	    return 0;
+
+      struct stat sb;
+      if (stat(path, &sb) < 0)
+	    return 0;
+
+      unsigned long hash = 5381;
+      for (const char*cp = path ; *cp ; cp += 1)
+	    hash = hash*33 + (unsigned char)*cp;
+
+      const char*base = strrchr(path, dir_character);
+      base = base? base+1 : path;
+
+      char*res = (char*)malloc(strlen(cache_dir) + strlen(base) + 64);
+      sprintf(res, "%s%c%s-%08lx-%llx-%llx.vpp",
+	      cache_dir, dir_character, base, hash & 0xffffffffUL,
+	      (unsigned long long)sb.st_mtime,
+	      (unsigned long long)sb.st_size);
+      return res;
+}
+
 /*
  * Use the type name as a key, and search the module library for a
  * file name that has that key.
@@ -62,16 +146,25 @@ bool load_module(const char*type)
       for (char*tmp = ltype ; *tmp ;  tmp += 1)
 	    *tmp = tolower(*tmp);
 
-      for (struct module_library*lcur = library_list
-		 ; lcur != 0 ;  lcur = lcur->next) {
+	/* Look the name up under both key forms, and when both hit,
+	   take the entry from the earlier directory. This gives the
+	   same answer as scanning the directories in order. */
+      const struct library_index_cell*hit = 0;
+      map<string,library_index_cell>::const_iterator cur;
 
-	    const char*key = lcur->key_case_sensitive? type : ltype;
-	    map<string,const char*>::const_iterator cur;
-	    cur = lcur->name_map.find(key);
-	    if (cur == lcur->name_map.end())
-		  continue;
+      cur = library_index_exact.find(type);
+      if (cur != library_index_exact.end())
+	    hit = &(*cur).second;
+
+      cur = library_index_lower.find(ltype);
+      if (cur != library_index_lower.end()) {
+	    if (hit == 0 || (*cur).second.lib->seq < hit->lib->seq)
+		  hit = &(*cur).second;
+      }
 
-	    sprintf(path, "%s%c%s", lcur->dir, dir_character, (*cur).second);
+      if (hit) {
+
+	    sprintf(path, "%s%c%s", hit->lib->dir, dir_character, hit->file);
 
 	    if(depend_file) {
                   if (depfile_mode == 'p') {
@@ -83,6 +176,22 @@ bool load_module(const char*type)
 	    }
 
 	    if (ivlpp_string) {
+		  char*cache_path = module_cache_file(path);
+
+		  if (cache_path) {
+			FILE*file = fopen(cache_path, "r");
+			if (file) {
+			      if (verbose_flag)
+				    cerr << "Loading preprocessed library file "
+					 << cache_path << "." << endl;
+			      pform_parse(path, file);
+			      fclose(file);
+			      free(cache_path);
+			      free(ltype);
+			      return true;
+			}
+		  }
+
 		  char*cmdline = (char*)malloc(strlen(ivlpp_string) +
 					       strlen(path) + 4);
 		  strcpy(cmdline, ivlpp_string);
@@ -98,9 +207,39 @@ bool load_module(const char*type)
 		  if (verbose_flag)
 			cerr << "...parsing output from preprocessor..." << endl << flush;
 
-		  pform_parse(path, file);
-		  pclose(file);
+		  if (cache_path) {
+			  /* Parse the preprocessor output and tee it
+			     into the cache. Write to a temporary and
+			     rename so concurrent compiles only ever
+			     see complete entries. */
+			char*tmp_path = (char*)malloc(strlen(cache_path) + 32);
+			sprintf(tmp_path, "%s.%ld.tmp", cache_path,
+			        (long)getpid());
+			FILE*cache = fopen(tmp_path, "w+");
+			if (cache) {
+			      char block[8192];
+			      size_t got;
+			      while ((got = fread(block, 1, sizeof block,
+			                          file)) > 0)
+				    fwrite(block, 1, got, cache);
+			      rewind(cache);
+			      pform_parse(path, cache);
+			      fclose(cache);
+			      if (pclose(file) == 0)
+				    rename(tmp_path, cache_path);
+			      else
+				    remove(tmp_path);
+			} else {
+			      pform_parse(path, file);
+			      pclose(file);
+			}
+			free(tmp_path);
+		  } else {
+			pform_parse(path, file);
+			pclose(file);
+		  }
 		  free(cmdline);
+		  free(cache_path);
 
 	    } else {
 		  if (verbose_flag)
@@ -140,6 +279,7 @@ int build_library_index(const char*path, bool key_case_sensitive)
       struct module_library*mlp = new struct module_library;
       mlp->dir = strdup(path);
       mlp->key_case_sensitive = key_case_sensitive;
+      mlp->seq = library_last? library_last->seq + 1 : 0;
 
 	/* Scan the director for files. check each file name to see if
 	   it has one of the configured suffixes. If it does, then use
@@ -184,7 +324,10 @@ int build_library_index(const char*path, bool key_case_sensitive)
 		  for (char*tmp = key ;  *tmp ;  tmp += 1)
 			*tmp = tolower(*tmp);
 
-	    mlp->name_map[key] = strdup(de->d_name);
+	    library_index_add(key_case_sensitive
+			      ? library_index_exact
+			      : library_index_lower,
+			      key, mlp, strdup(de->d_name));
 	    delete[]key;
       }
 
@@ -49,6 +49,7 @@ const char NOTICE[] =
 # include  <cstdlib>
 #if defined(HAVE_TIMES)
 # include  <sys/times.h>
+# include  <sys/resource.h>
 #endif
 #if defined(HAVE_GETOPT_H)
 # include  <getopt.h>
@@ -212,6 +213,7 @@ const bool CASE_SENSITIVE = true;
 bool synthesis = false;
 
 extern void cprop(Design*des);
+extern void deadtask(Design*des);
 extern void synth(Design*des);
 extern void synth2(Design*des);
 extern void syn_rules(Design*des);
@@ -223,6 +225,7 @@ static struct net_func_map {
       void (*func)(Design*);
 } func_table[] = {
       { "cprop",   &cprop },
+      { "deadtask",&deadtask },
       { "nodangle",&nodangle },
       { "synth",   &synth },
       { "synth2",  &synth2 },
@@ -738,11 +741,24 @@ static double cycles_diff(struct tms *a, struct tms *b)
 
       return (aa-bb)/(double)sysconf(_SC_CLK_TCK);
 }
+/*
+ * Report the peak resident set size so far, as reported by the
+ * kernel. The growth of this number across a phase tells which phase
+ * drives the high-water mark of the compiler.
+ */
+static unsigned long peak_rss(void)
+{
+      struct rusage ru;
+      if (getrusage(RUSAGE_SELF, &ru) != 0)
+	    return 0;
+      return (unsigned long)ru.ru_maxrss;
+}
 #else // ! defined(HAVE_TIMES)
 // Provide dummies
 struct tms { int x; };
 inline static void times(struct tms *) { }
 inline static double cycles_diff(struct tms *, struct tms *) { return 0; }
+inline static unsigned long peak_rss(void) { return 0; }
 #endif // ! defined(HAVE_TIMES)
 
 static void EOC_cleanup(void)
@@ -770,6 +786,26 @@ static void EOC_cleanup(void)
       filename_strings.cleanup();
 }
 
+	/* Write the -N netlist dump. The dump methods emit many small
+	   writes and the files can be enormous, so give the stream a
+	   large buffer. The NETLIST_INDEX flag selects the indexed
+	   format, which appends a seek index of the per-scope
+	   sections. */
+static bool net_path_indexed = false;
+
+static void dump_netlist(const Design*des, const char*path)
+{
+      vector<char> buffer (1048576);
+      ofstream out;
+      out.rdbuf()->pubsetbuf(&buffer[0], buffer.size());
+      out.open(path);
+
+      if (net_path_indexed)
+	    des->dump_indexed(out);
+      else
+	    des->dump(out);
+}
+
 int main(int argc, char*argv[])
 {
       bool help_flag = false;
@@ -971,6 +1007,9 @@ int main(int argc, char*argv[])
       flag_tmp = flags["DISABLE_CONCATZ_GENERATION"];
       if (flag_tmp) disable_concatz_generation = strcmp(flag_tmp,"true")==0;
 
+      flag_tmp = flags["NETLIST_INDEX"];
+      if (flag_tmp) net_path_indexed = strcmp(flag_tmp,"true")==0;
+
 	/* Parse the input. Make the pform. */
       pform_set_timescale(def_ts_units, def_ts_prec, 0, 0);
       int rc = pform_parse(argv[optind]);
@@ -1057,7 +1096,8 @@ int main(int argc, char*argv[])
 	    if (times_flag) {
 		  times(cycles+1);
 		  cerr<<" ... done, "
-		      <<cycles_diff(cycles+1, cycles+0)<<" seconds."<<endl;
+		      <<cycles_diff(cycles+1, cycles+0)<<" seconds,"
+		      <<" peak RSS "<<peak_rss()<<" KBytes."<<endl;
 	    }
 	    cout << "ELABORATING DESIGN" << endl;
       }
@@ -1075,10 +1115,8 @@ int main(int argc, char*argv[])
 	    if (des != 0) {
 		  cerr << des->errors
 		       << " error(s) during elaboration." << endl;
-		  if (net_path) {
-			ofstream out (net_path);
-			des->dump(out);
-		  }
+		  if (net_path)
+			dump_netlist(des, net_path);
 	    } else {
 		  cerr << "Elaboration failed" << endl;
 	    }
@@ -1102,19 +1140,24 @@ int main(int argc, char*argv[])
 	    assert(0);
       }
 
-	/* Done with all the pform data. Delete the modules. */
+	/* Done with all the pform data. Delete the modules, then
+	   hand the pooled AST nodes back in bulk so the functors and
+	   code generation do not pay for the parse in RSS. */
       for (map<perm_string,Module*>::iterator idx = pform_modules.begin()
 		 ; idx != pform_modules.end() ; ++ idx ) {
 
 	    delete (*idx).second;
 	    (*idx).second = 0;
       }
+      pform_modules.clear();
+      pform_release_nodes();
 
       if (verbose_flag) {
 	    if (times_flag) {
 		  times(cycles+2);
 		  cerr<<" ... done, "
-		      <<cycles_diff(cycles+2, cycles+1)<<" seconds."<<endl;
+		      <<cycles_diff(cycles+2, cycles+1)<<" seconds,"
+		      <<" peak RSS "<<peak_rss()<<" KBytes."<<endl;
 	    }
 	    cout << "RUNNING FUNCTORS" << endl;
       }
@@ -1124,7 +1167,16 @@ int main(int argc, char*argv[])
 	    net_func_queue.pop();
 	    if (verbose_flag)
 		  cerr<<" -F "<<net_func_to_name(func)<< " ..." <<endl;
+	    struct tms func_cycles[2];
+	    if (verbose_flag && times_flag)
+		  times(func_cycles+0);
 	    func(des);
+	    if (verbose_flag && times_flag) {
+		  times(func_cycles+1);
+		  cerr<<" -F "<<net_func_to_name(func)<<" took "
+		      <<cycles_diff(func_cycles+1, func_cycles+0)
+		      <<" seconds, peak RSS "<<peak_rss()<<" KBytes."<<endl;
+	    }
       }
 
       if (verbose_flag) {
@@ -1136,8 +1188,7 @@ int main(int argc, char*argv[])
 	    if (verbose_flag)
 		  cerr<<" dumping netlist to " <<net_path<< "..." <<endl;
 
-	    ofstream out (net_path);
-	    des->dump(out);
+	    dump_netlist(des, net_path);
       }
 
       if (des->errors) {
@@ -1151,7 +1202,8 @@ int main(int argc, char*argv[])
 	    if (times_flag) {
 		  times(cycles+3);
 		  cerr<<" ... done, "
-		      <<cycles_diff(cycles+3, cycles+2)<<" seconds."<<endl;
+		      <<cycles_diff(cycles+3, cycles+2)<<" seconds,"
+		      <<" peak RSS "<<peak_rss()<<" KBytes."<<endl;
 	    }
       }
 
@@ -1177,7 +1229,8 @@ int main(int argc, char*argv[])
 	    if (times_flag) {
 		  times(cycles+4);
 		  cerr<<" ... done, "
-		      <<cycles_diff(cycles+4, cycles+3)<<" seconds."<<endl;
+		      <<cycles_diff(cycles+4, cycles+3)<<" seconds,"
+		      <<" peak RSS "<<peak_rss()<<" KBytes."<<endl;
 	    } else {
 		  cout << "DONE." << endl;
 	    }
@@ -45,6 +45,8 @@ Design:: Design()
       des_precision_ = 0;
       nodes_functor_cur_ = 0;
       nodes_functor_nxt_ = 0;
+      for (unsigned idx = 0 ;  idx < NetNode::CLASS_COUNT ;  idx += 1)
+	    class_nodes_[idx] = 0;
       des_delay_sel_ = Design::TYP;
 }
 
@@ -831,6 +833,33 @@ NetScope* Design::find_task(NetScope*scope, const pform_name_t&name)
       return 0;
 }
 
+/*
+ * Sort the node into one of the classes that the functor scanner
+ * distinguishes. The tests are roughly in order of how common the
+ * node types are. Callers always pass fully constructed nodes, so
+ * the dynamic_cast sees the final type.
+ */
+static unsigned classify_node(NetNode*net)
+{
+      if (dynamic_cast<NetLogic*>(net))      return NetNode::CLASS_LOGIC;
+      if (dynamic_cast<NetConst*>(net))      return NetNode::CLASS_CONST;
+      if (dynamic_cast<NetConcat*>(net))     return NetNode::CLASS_CONCAT;
+      if (dynamic_cast<NetPartSelect*>(net)) return NetNode::CLASS_PART_SELECT;
+      if (dynamic_cast<NetMux*>(net))        return NetNode::CLASS_MUX;
+      if (dynamic_cast<NetFF*>(net))         return NetNode::CLASS_FF;
+      if (dynamic_cast<NetAddSub*>(net))     return NetNode::CLASS_ADD_SUB;
+      if (dynamic_cast<NetCompare*>(net))    return NetNode::CLASS_COMPARE;
+      if (dynamic_cast<NetSignExtend*>(net)) return NetNode::CLASS_SIGN_EXTEND;
+      if (dynamic_cast<NetUReduce*>(net))    return NetNode::CLASS_UREDUCE;
+      if (dynamic_cast<NetMult*>(net))       return NetNode::CLASS_MULT;
+      if (dynamic_cast<NetDivide*>(net))     return NetNode::CLASS_DIVIDE;
+      if (dynamic_cast<NetModulo*>(net))     return NetNode::CLASS_MODULO;
+      if (dynamic_cast<NetPow*>(net))        return NetNode::CLASS_POW;
+      if (dynamic_cast<NetAbs*>(net))        return NetNode::CLASS_ABS;
+      if (dynamic_cast<NetLiteral*>(net))    return NetNode::CLASS_LITERAL;
+      return NetNode::CLASS_OTHER;
+}
+
 void Design::add_node(NetNode*net)
 {
       assert(net->design_ == 0);
@@ -844,6 +873,21 @@ void Design::add_node(NetNode*net)
 	    net->node_prev_->node_next_ = net;
       }
       nodes_ = net;
+
+	// Also link the node into the ring for its class.
+      net->node_class_ = classify_node(net);
+      NetNode*&chead = class_nodes_[net->node_class_];
+      if (chead == 0) {
+	    net->class_next_ = net;
+	    net->class_prev_ = net;
+      } else {
+	    net->class_next_ = chead->class_next_;
+	    net->class_prev_ = chead;
+	    net->class_next_->class_prev_ = net;
+	    net->class_prev_->class_next_ = net;
+      }
+      chead = net;
+
       net->design_ = this;
 }
 
@@ -853,15 +897,29 @@ void Design::del_node(NetNode*net)
       assert(net != 0);
 
 	/* Interact with the Design::functor method by manipulating the
-	   cur and nxt pointers that it is using. */
+	   cur and nxt pointers that it is using. The functor scans
+	   the class rings, so the nxt pointer advances within the
+	   class of the deleted node. */
       if (net == nodes_functor_nxt_)
-	    nodes_functor_nxt_ = nodes_functor_nxt_->node_next_;
+	    nodes_functor_nxt_ = nodes_functor_nxt_->class_next_;
       if (net == nodes_functor_nxt_)
 	    nodes_functor_nxt_ = 0;
 
       if (net == nodes_functor_cur_)
 	    nodes_functor_cur_ = 0;
 
+	/* Unlink the node from the ring for its class. */
+      NetNode*&chead = class_nodes_[net->node_class_];
+      if (chead == net)
+	    chead = net->class_prev_;
+
+      if (chead == net) {
+	    chead = 0;
+      } else {
+	    net->class_next_->class_prev_ = net->class_prev_;
+	    net->class_prev_->class_next_ = net->class_next_;
+      }
+
 	/* Now perform the actual delete. */
       if (nodes_ == net)
 	    nodes_ = net->node_prev_;
@@ -915,6 +973,26 @@ void Design::delete_process(NetProcTop*top)
       delete top;
 }
 
+void Design::delete_processes(const std::set<NetProcTop*>&dead)
+{
+      if (dead.empty())
+	    return;
+
+      NetProcTop**link = &procs_;
+      while (NetProcTop*cur = *link) {
+	    if (dead.count(cur) == 0) {
+		  link = &cur->next_;
+		  continue;
+	    }
+
+	    if (procs_idx_ == cur)
+		  procs_idx_ = cur->next_;
+
+	    *link = cur->next_;
+	    delete cur;
+      }
+}
+
 void Design::join_islands(void)
 {
       if (nodes_ == 0)
@@ -34,6 +34,7 @@ NetUserFunc::NetUserFunc(NetScope*s, perm_string n, NetScope*d,
 : NetNode(s, n, d->func_def()->port_count()+1),
   def_(d), trigger_(trigger__)
 {
+      def_->incr_call_ref();
       pin(0).set_dir(Link::OUTPUT);
 
       for (unsigned idx = 1 ;  idx < pin_count() ;  idx += 1) {
@@ -46,6 +47,7 @@ NetUserFunc::NetUserFunc(NetScope*s, perm_string n, NetScope*d,
 
 NetUserFunc::~NetUserFunc()
 {
+      def_->decr_call_ref();
 }
 
 ivl_variable_type_t NetUserFunc::data_type(unsigned port) const
@@ -31,61 +31,81 @@
 
 void Nexus::connect(Link&r)
 {
-      Nexus*r_nexus = r.next_? r.find_nexus_() : 0;
-      if (this == r_nexus)
+      if (this == r.nexus_)
 	    return;
 
       delete[] name_;
       name_ = 0;
 
-	// Special case: This nexus is empty. Simply copy all the
-	// links of the other nexus to this one, and delete the old
-	// nexus.
-      if (list_ == 0) {
-	    if (r.next_ == 0) {
-		  list_ = &r;
-		  r.next_ = &r;
-		  r.nexus_ = this;
-		  driven_ = NO_GUESS;
-	    } else {
-		  driven_ = r_nexus->driven_;
-		  list_ = r_nexus->list_;
-		  list_->nexus_ = this;
-		  r_nexus->list_ = 0;
-		  delete r_nexus;
-	    }
-	    return;
-      }
-
-	// Special case: The Link is unconnected. Put it at the end of
-	// the current list and move the list_ pointer and nexus_ back
-	// pointer to suit.
-      if (r.next_ == 0) {
-	    if (r.get_dir() != Link::INPUT)
+	// Special case: The Link is unconnected. Simply append it to
+	// the list of this nexus.
+      if (r.nexus_ == 0) {
+	    if (first_ == 0 || r.get_dir() != Link::INPUT)
 		  driven_ = NO_GUESS;
 
-	    r.nexus_ = this;
-	    r.next_ = list_->next_;
-	    list_->next_ = &r;
-	    list_->nexus_ = 0;
-	    list_ = &r;
+	    relink_(r);
 	    return;
       }
 
-      if (r_nexus->driven_ != Vz)
+	// The Link is in another nexus. Move all the links of that
+	// nexus to the end of this one, and delete the emptied husk.
+      Nexus*tmp = r.nexus_;
+      if (first_ == 0)
+	    driven_ = tmp->driven_;
+      else if (tmp->driven_ != Vz)
 	    driven_ = NO_GUESS;
 
-	// Splice the list of links from the "tmp" nexus to the end of
-	// this nexus. Adjust the nexus pointers as needed.
-      Link*save_first = list_->next_;
-      list_->next_ = r_nexus->list_->next_;
-      r_nexus->list_->next_ = save_first;
-      list_->nexus_ = 0;
-      list_ = r_nexus->list_;
-      list_->nexus_ = this;
+      for (Link*cur = tmp->first_ ; cur ; cur = cur->next_)
+	    cur->nexus_ = this;
+
+      if (first_ == 0) {
+	    first_ = tmp->first_;
+      } else {
+	    last_->next_ = tmp->first_;
+	    tmp->first_->prev_ = last_;
+      }
+      last_ = tmp->last_;
+      nlinks_ += tmp->nlinks_;
+      ninputs_ += tmp->ninputs_;
+      noutputs_ += tmp->noutputs_;
 
-      r_nexus->list_ = 0;
-      delete r_nexus;
+      tmp->first_ = 0;
+      tmp->last_ = 0;
+      tmp->nlinks_ = 0;
+      delete tmp;
+}
+
+/*
+ * Append the unconnected link r to the end of the list of links, and
+ * update the cached counts.
+ */
+void Nexus::relink_(Link&r)
+{
+      r.nexus_ = this;
+      r.next_ = 0;
+      r.prev_ = last_;
+      if (last_)
+	    last_->next_ = &r;
+      else
+	    first_ = &r;
+      last_ = &r;
+
+      nlinks_ += 1;
+      count_dir_(r.get_dir(), 1);
+}
+
+void Nexus::count_dir_(Link::DIR dir, int delta)
+{
+      switch (dir) {
+	  case Link::INPUT:
+	    ninputs_ += delta;
+	    break;
+	  case Link::OUTPUT:
+	    noutputs_ += delta;
+	    break;
+	  default:
+	    break;
+      }
 }
 
 void connect(Link&l, Link&r)
@@ -103,49 +123,49 @@ void connect(Link&l, Link&r)
 
 Link::Link()
 : dir_(PASSIVE), drive0_(IVL_DR_STRONG), drive1_(IVL_DR_STRONG),
-  next_(0), nexus_(0)
+  next_(0), prev_(0), nexus_(0)
 {
 }
 
 Link::~Link()
 {
-      if (next_) {
-	    Nexus*tmp = nexus();
+      if (nexus_) {
+	    Nexus*tmp = nexus_;
 	    tmp->unlink(this);
-	    if (tmp->list_ == 0)
+	    if (tmp->first_ == 0)
 		  delete tmp;
       }
 }
 
 Nexus* Link::find_nexus_() const
 {
-      assert(next_);
-      if (nexus_) return nexus_;
-      for (Link*cur = next_ ; cur != this ; cur = cur->next_) {
-	    if (cur->nexus_) return cur->nexus_;
-      }
-      return 0;
+      assert(nexus_);
+      return nexus_;
 }
 
 Nexus* Link::nexus()
 {
-      if (next_ == 0) {
-	    assert(nexus_ == 0);
+      if (nexus_ == 0) {
 	    Nexus*tmp = new Nexus(*this);
 	    return tmp;
       }
 
-      return find_nexus_();
+      return nexus_;
 }
 
 const Nexus* Link::nexus() const
 {
-      if (next_ == 0) return 0;
-      return find_nexus_();
+      return nexus_;
 }
 
 void Link::set_dir(DIR d)
 {
+	// Keep the cached counts in the nexus in step with the
+	// direction changes.
+      if (nexus_ && dir_ != d) {
+	    nexus_->count_dir_(dir_, -1);
+	    nexus_->count_dir_(d, 1);
+      }
       dir_ = d;
 }
 
@@ -212,28 +232,23 @@ bool Link::is_equal(const Link&that) const
 
 bool Link::is_linked() const
 {
-      if (next_ == 0)
-	    return false;
-      if (next_ == this)
+      if (nexus_ == 0)
 	    return false;
 
-      return true;
+	// A nexus with only this link in it does not count as being
+	// connected to anything.
+      return nexus_->nlinks_ > 1;
 }
 
 bool Link::is_linked(const Link&that) const
 {
-      if (next_ == 0)
-	    return false;
-      if (that.next_ == 0)
+      if (this == &that)
 	    return false;
 
-      const Link*cur = next_;
-      while (cur != this) {
-	    if (cur == &that) return true;
-	    cur = cur->next_;
-      }
+      if (nexus_ == 0)
+	    return false;
 
-      return false;
+      return nexus_ == that.nexus_;
 }
 
 Nexus::Nexus(Link&that)
@@ -241,21 +256,31 @@ Nexus::Nexus(Link&that)
       name_ = 0;
       driven_ = NO_GUESS;
       t_cookie_ = 0;
+      first_ = 0;
+      last_ = 0;
+      nlinks_ = 0;
+      ninputs_ = 0;
+      noutputs_ = 0;
 
-      if (that.next_ == 0) {
-	    list_ = &that;
-	    that.next_ = &that;
-	    that.nexus_ = this;
-	    driven_ = NO_GUESS;
+      if (that.nexus_ == 0) {
+	    relink_(that);
 
       } else {
-	    Nexus*tmp = that.find_nexus_();
-	    list_ = tmp->list_;
-	    list_->nexus_ = this;
+	    Nexus*tmp = that.nexus_;
+	    first_ = tmp->first_;
+	    last_ = tmp->last_;
+	    nlinks_ = tmp->nlinks_;
+	    ninputs_ = tmp->ninputs_;
+	    noutputs_ = tmp->noutputs_;
 	    driven_ = tmp->driven_;
 	    name_ = tmp->name_;
 
-	    tmp->list_ = 0;
+	    for (Link*cur = first_ ; cur ; cur = cur->next_)
+		  cur->nexus_ = this;
+
+	    tmp->first_ = 0;
+	    tmp->last_ = 0;
+	    tmp->nlinks_ = 0;
 	    tmp->name_ = 0;
 	    delete tmp;
       }
@@ -263,7 +288,7 @@ Nexus::Nexus(Link&that)
 
 Nexus::~Nexus()
 {
-      assert(list_ == 0);
+      assert(first_ == 0);
       delete[] name_;
 }
 
@@ -287,22 +312,20 @@ bool Nexus::assign_lval() const
 
 void Nexus::count_io(unsigned&inp, unsigned&out) const
 {
-      for (const Link*cur = first_nlink() ;  cur ; cur = cur->next_nlink()) {
-	    switch (cur->get_dir()) {
-		case Link::INPUT:
-		  inp += 1;
-		  break;
-		case Link::OUTPUT:
-		  out += 1;
-		  break;
-		default:
-		  break;
-	    }
-      }
+      inp += ninputs_;
+      out += noutputs_;
 }
 
 bool Nexus::drivers_present() const
 {
+	// The counts answer the easy cases without a scan: an OUTPUT
+	// link is a driver, and a nexus of nothing but INPUT links
+	// has none.
+      if (noutputs_ > 0)
+	    return true;
+      if (ninputs_ == nlinks_)
+	    return false;
+
       for (const Link*cur = first_nlink() ;  cur ; cur = cur->next_nlink()) {
 	    if (cur->get_dir() == Link::OUTPUT)
 		  return true;
@@ -368,72 +391,50 @@ void Nexus::unlink(Link*that)
       name_ = 0;
 
       assert(that);
+      assert(that->nexus_ == this);
 
-	// Special case: the Link is the only link in the nexus. In
-	// this case, the unlink is trivial. Also clear the Nexus
-	// pointers.
-      if (that->next_ == that) {
-	    assert(that->nexus_ == this);
-	    assert(list_ == that);
-	    list_ = 0;
+	// If the link I'm removing was a driver for this nexus, or
+	// was the only link, then cancel my guess of the driven
+	// value.
+      if (nlinks_ == 1 || that->get_dir() != Link::INPUT)
 	    driven_ = NO_GUESS;
-	    that->nexus_ = 0;
-	    that->next_ = 0;
-	    return;
-      }
 
-	// If the link I'm removing was a driver for this nexus, then
-	// cancel my guess of the driven value.
-      if (that->get_dir() != Link::INPUT)
-	    driven_ = NO_GUESS;
+      if (that->prev_)
+	    that->prev_->next_ = that->next_;
+      else
+	    first_ = that->next_;
 
-	// Look for the Link that points to "that". We know that there
-	// will be one because the list is a circle. When we find the
-	// prev pointer, then remove that from the list.
-      Link*prev = list_;
-      while (prev->next_ != that)
-	    prev = prev->next_;
-
-      prev->next_ = that->next_;
-
-	// If "that" was the last item in the list, then change the
-	// list_ pointer to point to the new end of the list.
-      if (list_ == that) {
-	    assert(that->nexus_ == this);
-	    list_ = prev;
-	    list_->nexus_ = this;
-      }
+      if (that->next_)
+	    that->next_->prev_ = that->prev_;
+      else
+	    last_ = that->prev_;
+
+      nlinks_ -= 1;
+      count_dir_(that->get_dir(), -1);
 
       that->nexus_ = 0;
       that->next_ = 0;
+      that->prev_ = 0;
 }
 
 Link* Nexus::first_nlink()
 {
-      if (list_) return list_->next_;
-      else return 0;
+      return first_;
 }
 
 const Link* Nexus::first_nlink() const
 {
-      if (list_) return list_->next_;
-      else return 0;
+      return first_;
 }
 
 /*
  * The t_cookie can be set exactly once. This attaches an ivl_nexus_t
- * object to the Nexus, and causes the Link list to be marked up for
- * efficient use by the code generator. The change is to give all the
- * links a valid nexus_ pointer. This breaks most of the other
- * methods, but they are not used during code generation.
+ * object to the Nexus for use by the code generator.
 */
 void Nexus::t_cookie(ivl_nexus_t val) const
 {
       assert(val && !t_cookie_);
       t_cookie_ = val;
-
-      for (Link*cur = list_->next_ ; cur->nexus_ == 0 ; cur = cur->next_)
-	    cur->nexus_ = const_cast<Nexus*> (this);
 }
 
 unsigned Nexus::vector_width() const
@@ -524,17 +525,17 @@ const char* Nexus::name() const
 NexusSet::NexusSet()
 {
       items_ = 0;
+      sorted_ = 0;
       nitems_ = 0;
+      nalloc_ = 0;
 }
 
 NexusSet::~NexusSet()
 {
-      if (nitems_ > 0) {
-	    assert(items_ != 0);
+      if (items_)
 	    free(items_);
-      } else {
-	    assert(items_ == 0);
-      }
+      if (sorted_)
+	    free(sorted_);
 }
 
 unsigned NexusSet::count() const
@@ -545,31 +546,85 @@ unsigned NexusSet::count() const
 void NexusSet::add(Nexus*that)
 {
       assert(that);
-      if (nitems_ == 0) {
-	    assert(items_ == 0);
-	    items_ = (Nexus**)malloc(sizeof(Nexus*));
-	    items_[0] = that;
-	    nitems_ = 1;
-	    return;
-      }
 
-      unsigned ptr = bsearch_(that);
-      if (ptr < nitems_) {
-	    assert(items_[ptr] == that);
+      unsigned ptr = lower_bound_(that);
+      if (ptr < nitems_ && sorted_[ptr] == that)
 	    return;
+
+      if (nitems_ == nalloc_) {
+	    nalloc_ = nalloc_? 2*nalloc_ : 4;
+	    items_  = (Nexus**)realloc(items_,  nalloc_ * sizeof(Nexus*));
+	    sorted_ = (Nexus**)realloc(sorted_, nalloc_ * sizeof(Nexus*));
       }
 
-      assert(ptr == nitems_);
+      for (unsigned idx = nitems_ ;  idx > ptr ;  idx -= 1)
+	    sorted_[idx] = sorted_[idx-1];
+      sorted_[ptr] = that;
 
-      items_ = (Nexus**)realloc(items_, (nitems_+1) * sizeof(Nexus*));
-      items_[ptr] = that;
+      items_[nitems_] = that;
       nitems_ += 1;
 }
 
 void NexusSet::add(const NexusSet&that)
 {
-      for (unsigned idx = 0 ;  idx < that.nitems_ ;  idx += 1)
-	    add(that.items_[idx]);
+      if (that.nitems_ == 0)
+	    return;
+
+	// Starting empty, so this is a plain copy.
+      if (nitems_ == 0) {
+	    if (nalloc_ < that.nitems_) {
+		  nalloc_ = that.nitems_;
+		  items_  = (Nexus**)realloc(items_,  nalloc_ * sizeof(Nexus*));
+		  sorted_ = (Nexus**)realloc(sorted_, nalloc_ * sizeof(Nexus*));
+	    }
+	    memcpy(items_,  that.items_,  that.nitems_ * sizeof(Nexus*));
+	    memcpy(sorted_, that.sorted_, that.nitems_ * sizeof(Nexus*));
+	    nitems_ = that.nitems_;
+	    return;
+      }
+
+	// Merge the two sorted arrays in a single linear pass,
+	// instead of insertion-sorting the items one at a time.
+      unsigned cap = nitems_ + that.nitems_;
+      Nexus**merged = (Nexus**)malloc(cap * sizeof(Nexus*));
+      unsigned pa = 0, pb = 0, nmerged = 0;
+      while (pa < nitems_ && pb < that.nitems_) {
+	    if (sorted_[pa] < that.sorted_[pb]) {
+		  merged[nmerged++] = sorted_[pa++];
+	    } else if (that.sorted_[pb] < sorted_[pa]) {
+		  merged[nmerged++] = that.sorted_[pb++];
+	    } else {
+		  merged[nmerged++] = sorted_[pa++];
+		  pb += 1;
+	    }
+      }
+      while (pa < nitems_)
+	    merged[nmerged++] = sorted_[pa++];
+      while (pb < that.nitems_)
+	    merged[nmerged++] = that.sorted_[pb++];
+
+	// Nothing new, so keep the arrays we have.
+      if (nmerged == nitems_) {
+	    free(merged);
+	    return;
+      }
+
+	// Append the new items to the insertion-order list, in the
+	// order they appear in "that". The bsearch_ here still sees
+	// the pre-merge sorted array, which is what we want.
+      unsigned fill = nitems_;
+      items_ = (Nexus**)realloc(items_, cap * sizeof(Nexus*));
+      for (unsigned idx = 0 ;  idx < that.nitems_ ;  idx += 1) {
+	    Nexus*cur = that.items_[idx];
+	    if (bsearch_(cur) == nitems_)
+		  items_[fill++] = cur;
+      }
+      assert(fill == nmerged);
+
+      free(sorted_);
+      sorted_ = merged;
+      nitems_ = nmerged;
+      nalloc_ = cap;
 }
 
 void NexusSet::rem(Nexus*that)
@@ -582,17 +637,17 @@ void NexusSet::rem(Nexus*that)
       if (ptr >= nitems_)
 	    return;
 
-      if (nitems_ == 1) {
-	    free(items_);
-	    items_ = 0;
-	    nitems_ = 0;
-	    return;
-      }
-
       for (unsigned idx = ptr ;  idx < (nitems_-1) ;  idx += 1)
+	    sorted_[idx] = sorted_[idx+1];
+
+	// Find the item in the insertion ordered list, and close the
+	// gap there as well.
+      unsigned where = 0;
+      while (items_[where] != that)
+	    where += 1;
+      for (unsigned idx = where ;  idx < (nitems_-1) ;  idx += 1)
 	    items_[idx] = items_[idx+1];
 
-      items_ = (Nexus**)realloc(items_, (nitems_-1) * sizeof(Nexus*));
       nitems_ -= 1;
 }
 
@@ -608,23 +663,36 @@ Nexus* NexusSet::operator[] (unsigned idx) const
       return items_[idx];
 }
 
-unsigned NexusSet::bsearch_(Nexus*that) const
-{
-      for (unsigned idx = 0 ;  idx < nitems_ ;  idx += 1) {
-	    if (items_[idx] == that)
-		  return idx;
+/*
+ * Return the position in the sorted_ array of the first item that is
+ * not less than "that". This is the insertion point, and the place
+ * to look for a match.
+ */
+unsigned NexusSet::lower_bound_(Nexus*that) const
+{
+      unsigned lo = 0, hi = nitems_;
+      while (lo < hi) {
+	    unsigned mid = (lo + hi) / 2;
+	    if (sorted_[mid] < that)
+		  lo = mid + 1;
+	    else
+		  hi = mid;
       }
+      return lo;
+}
 
+unsigned NexusSet::bsearch_(Nexus*that) const
+{
+      unsigned ptr = lower_bound_(that);
+      if (ptr < nitems_ && sorted_[ptr] == that)
+	    return ptr;
       return nitems_;
 }
 
 bool NexusSet::contains(const NexusSet&that) const
 {
       for (unsigned idx = 0 ;  idx < that.nitems_ ;  idx += 1) {
-	    unsigned where = bsearch_(that[idx]);
-	    if (where == nitems_)
-		  return false;
-	    if (items_[where] != that[idx])
+	    if (bsearch_(that[idx]) == nitems_)
 		  return false;
       }
 
@@ -634,10 +702,7 @@ bool NexusSet::contains(const NexusSet&that) const
 bool NexusSet::intersect(const NexusSet&that) const
 {
       for (unsigned idx = 0 ;  idx < that.nitems_ ;  idx += 1) {
-	    unsigned where = bsearch_(that[idx]);
-	    if (where == nitems_)
-		  continue;
-	    if (items_[where] == that[idx])
+	    if (bsearch_(that[idx]) < nitems_)
 		  return true;
       }
 
@@ -105,10 +105,12 @@ void NetCase::set_case(unsigned idx, NetExpr*e, NetProc*p)
 NetDisable::NetDisable(NetScope*tgt)
 : target_(tgt)
 {
+      target_->incr_call_ref();
 }
 
 NetDisable::~NetDisable()
 {
+      target_->decr_call_ref();
 }
 
 const NetScope* NetDisable::target() const
@@ -43,6 +43,7 @@ NetScope::NetScope(NetScope*up, const hname_t&n, NetScope::TYPE t, bool nest, bo
 : type_(t), name_(n), nested_module_(nest), program_block_(prog), up_(up)
 {
       events_ = 0;
+      call_ref_count_ = 0;
       lcounter_ = 0;
       need_const_func_ = false;
       is_const_func_ = false;
@@ -459,6 +460,9 @@ void NetScope::add_event(NetEvent*ev)
       ev->scope_ = this;
       ev->snext_ = events_;
       events_ = ev;
+	// The newest event shadows any older event with the same
+	// name, just as a scan of the list from the front would.
+      events_map_[ev->name()] = ev;
 }
 
 void NetScope::rem_event(NetEvent*ev)
@@ -478,14 +482,82 @@ void NetScope::rem_event(NetEvent*ev)
       }
 
       ev->snext_ = 0;
+
+	// Keep the name index consistent. If the removed event was
+	// the indexed one, fall back to the next event in the list
+	// with the same name, if any.
+      map<perm_string,NetEvent*>::iterator idx = events_map_.find(ev->name());
+      if (idx != events_map_.end() && idx->second == ev) {
+	    events_map_.erase(idx);
+	    for (NetEvent*cur = events_ ;  cur ;  cur = cur->snext_) {
+		  if (cur->name() == ev->name()) {
+			events_map_[cur->name()] = cur;
+			break;
+		  }
+	    }
+      }
+}
+
+
+void NetScope::incr_call_ref()
+{
+      call_ref_count_ += 1;
+}
+
+void NetScope::decr_call_ref()
+{
+      assert(call_ref_count_ > 0);
+      call_ref_count_ -= 1;
+}
+
+void NetScope::child_scopes(list<NetScope*>&res) const
+{
+      for (map<hname_t,NetScope*>::const_iterator cur = children_.begin()
+		 ; cur != children_.end() ; ++ cur )
+	    res.push_back(cur->second);
 }
 
+bool NetScope::no_external_refs() const
+{
+      if (call_ref_count_ > 0)
+	    return false;
+
+      for (map<perm_string,NetNet*>::const_iterator cur = signals_map_.begin()
+		 ; cur != signals_map_.end() ; ++ cur ) {
+	    if (cur->second->peek_eref() > 0)
+		  return false;
+	    if (cur->second->peek_lref() > 0)
+		  return false;
+      }
+
+      for (NetEvent*cur = events_ ;  cur ;  cur = cur->snext_) {
+	    if ((cur->nwait() + cur->ntrig() + cur->nexpr()) > 0)
+		  return false;
+      }
+
+      for (map<hname_t,NetScope*>::const_iterator cur = children_.begin()
+		 ; cur != children_.end() ; ++ cur ) {
+	    if (! cur->second->no_external_refs())
+		  return false;
+      }
+
+      return true;
+}
+
+void NetScope::unlink_child(NetScope*child)
+{
+      assert(child->up_ == this);
+      map<hname_t,NetScope*>::iterator cur = children_.find(child->name_);
+      assert(cur != children_.end() && cur->second == child);
+      children_.erase(cur);
+      child->up_ = 0;
+}
 
 NetEvent* NetScope::find_event(perm_string name)
 {
-      for (NetEvent*cur = events_;  cur ;  cur = cur->snext_)
-	    if (cur->name() == name)
-		  return cur;
+      map<perm_string,NetEvent*>::iterator idx = events_map_.find(name);
+      if (idx != events_map_.end())
+	    return idx->second;
 
       return 0;
 }
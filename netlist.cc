@@ -131,6 +131,8 @@ const NetNet* find_link_signal(const NetObj*net, unsigned pin, unsigned&bidx)
 Link* find_next_output(Link*lnk)
 {
       Link*cur = lnk->next_nlink();
+      if (cur == 0)
+	    cur = lnk->nexus()->first_nlink();
       while (cur != lnk) {
 	    if (cur->get_dir() == Link::OUTPUT)
 		  return cur;
@@ -230,6 +232,9 @@ bool NetPins::is_linked(void)
       return linked_flag;
 }
 
+ObjHeap NetObj::heap_;
+ObjHeap NetExpr::heap_;
+
 NetObj::NetObj(NetScope*s, perm_string n, unsigned np)
 : NetPins(np), scope_(s), name_(n), delay1_(0), delay2_(0), delay3_(0)
 {
@@ -255,7 +260,8 @@ const NetScope* NetObj::scope() const
 }
 
 NetNode::NetNode(NetScope*s, perm_string n, unsigned npins)
-: NetObj(s, n, npins), node_next_(0), node_prev_(0), design_(0)
+: NetObj(s, n, npins), node_next_(0), node_prev_(0),
+  class_next_(0), class_prev_(0), node_class_(CLASS_OTHER), design_(0)
 {
 }
 
@@ -2007,14 +2013,48 @@ NetProc* NetCondit::else_clause()
       return else_;
 }
 
+/*
+ * Tie-off constants dominate gate level netlists: huge numbers of
+ * NetConst devices all driving 1'b0 or 1'b1, or all-zero pad
+ * vectors. Each device needs its own pin (a pin links to exactly
+ * one nexus, so distinct nets cannot share a driver), but the value
+ * payload can be shared. Intern uniform values (all bits the same)
+ * per (bit, width); the copy-on-write verinum storage then makes
+ * every such NetConst share one bit array.
+ */
+static verinum intern_const_value(const verinum&val)
+{
+      if (val.len() == 0 || val.is_string())
+	    return val;
+
+      verinum::V bit = val.get(0);
+      for (unsigned idx = 1 ;  idx < val.len() ;  idx += 1)
+	    if (val.get(idx) != bit)
+		  return val;
+
+      static map<pair<int,unsigned>, verinum> cache;
+      pair<int,unsigned> key ((int)bit, val.len());
+      map<pair<int,unsigned>, verinum>::iterator cur = cache.find(key);
+      if (cur == cache.end())
+	    cur = cache.insert(make_pair(key, val)).first;
+
+	// This copy shares the cached bits. The flags are per-object,
+	// so carry them over from the value the caller gave us.
+      verinum use_val = cur->second;
+      use_val.has_len(val.has_len());
+      use_val.has_sign(val.has_sign());
+      use_val.is_single(val.is_single());
+      return use_val;
+}
+
 NetConst::NetConst(NetScope*s, perm_string n, verinum::V v)
-: NetNode(s, n, 1), value_(v, 1)
+: NetNode(s, n, 1), value_(intern_const_value(verinum(v, 1)))
 {
       pin(0).set_dir(Link::OUTPUT);
 }
 
 NetConst::NetConst(NetScope*s, perm_string n, const verinum&val)
-: NetNode(s, n, 1), value_(val)
+: NetNode(s, n, 1), value_(intern_const_value(val))
 {
       pin(0).set_dir(Link::OUTPUT);
 }
@@ -2038,6 +2078,13 @@ NetFuncDef::~NetFuncDef()
 {
 }
 
+NetProc* NetFuncDef::take_proc()
+{
+      NetProc*res = statement_;
+      statement_ = 0;
+      return res;
+}
+
 const NetScope* NetFuncDef::scope() const
 {
       return scope_;
@@ -2117,10 +2164,12 @@ NetEUFunc::NetEUFunc(NetScope*scope, NetScope*def, NetESignal*res,
 : scope_(scope), func_(def), result_sig_(res), parms_(p), need_const_(nc)
 {
       expr_width(result_sig_->expr_width());
+      func_->incr_call_ref();
 }
 
 NetEUFunc::~NetEUFunc()
 {
+      func_->decr_call_ref();
       for (unsigned idx = 0 ;  idx < parms_.size() ;  idx += 1)
 	    delete parms_[idx];
 }
@@ -2162,10 +2211,12 @@ ivl_variable_type_t NetEUFunc::expr_type() const
 NetUTask::NetUTask(NetScope*def)
 : task_(def)
 {
+      task_->incr_call_ref();
 }
 
 NetUTask::~NetUTask()
 {
+      task_->decr_call_ref();
 }
 
 const NetScope* NetUTask::task() const
@@ -2616,6 +2667,13 @@ NetTaskDef::~NetTaskDef()
       delete proc_;
 }
 
+NetProc* NetTaskDef::take_proc()
+{
+      NetProc*res = proc_;
+      proc_ = 0;
+      return res;
+}
+
 void NetTaskDef::set_proc(NetProc*p)
 {
       assert(proc_ == 0);
@@ -41,6 +41,7 @@
 # include  "verinum.h"
 # include  "verireal.h"
 # include  "StringHeap.h"
+# include  "ObjHeap.h"
 # include  "HName.h"
 # include  "LineInfo.h"
 # include  "svector.h"
@@ -176,8 +177,9 @@ class Link {
     private:
 	// The Nexus uses these to maintain its list of Link
 	// objects. If this link is not connected to anything,
-	// then these pointers are both nil.
+	// then these pointers are all nil.
       Link *next_;
+      Link *prev_;
       Nexus*nexus_;
 
     private: // not implemented
@@ -254,6 +256,15 @@ class NetObj  : public NetPins, public Attrib {
 
       void dump_obj_attr(ostream&, unsigned) const;
 
+	// Netlist nodes number in the millions, so carve them from a
+	// dedicated heap instead of allocating them one by one.
+      static void* operator new(std::size_t size) { return heap_.alloc(size); }
+      static void operator delete(void*ptr, std::size_t size)
+      { heap_.free(ptr, size); }
+
+    private:
+      static ObjHeap heap_;
+
     private:
       NetScope*scope_;
       perm_string name_;
@@ -318,18 +329,17 @@ class NetBranch  : public NetPins, public IslandBranch {
  * together. Each link has its own properties, this class holds the
  * properties of the group.
  *
- * The links in a nexus are grouped into a circularly linked list,
- * with the nexus pointing to the last Link. Each link in turn points
- * to the next link in the nexus, with the last link pointing back to
- * the first. The last link also has a non-nil nexus_ pointer back to
- * this nexus.
+ * The links in a nexus are grouped into a doubly linked list, with
+ * the nexus pointing to the first and last Link. Every link in the
+ * list carries a pointer back to the nexus, so that finding the
+ * nexus of a link, appending a link, and unlinking a link are all
+ * constant time. The nexus also keeps running counts of the INPUT
+ * and OUTPUT links, so passes that repeatedly ask about drivers and
+ * loads do not need to walk the list.
  *
  * The t_cookie() is an ivl_nexus_t that the code generator uses to
  * store data in the nexus. When a Nexus is created, this cookie is
- * set to nil. The code generator may set the cookie once. This locks
- * the nexus, and rewrites the Link list to be optimal for the code
- * generator. In the process, *all* of the other methods are no longer
- * functional.
+ * set to nil. The code generator may set the cookie once.
  */
 class Nexus {
 
@@ -388,8 +398,17 @@ class Nexus {
       void t_cookie(ivl_nexus_t) const;
 
     private:
-      Link*list_;
+      Link*first_;
+      Link*last_;
+      unsigned nlinks_;
+
+	// Running counts of the INPUT and OUTPUT links in the list.
+      unsigned ninputs_;
+      unsigned noutputs_;
+
+      void relink_(Link&r);
       void unlink(Link*);
+      void count_dir_(Link::DIR dir, int delta);
 
       mutable char* name_; /* Cache the calculated name for the Nexus. */
       mutable ivl_nexus_t t_cookie_;
@@ -429,9 +448,15 @@ class NexusSet {
       bool intersect(const NexusSet&that) const;
 
     private:
+	// The nexus pointers in insertion order. This is the order
+	// that operator[] exposes, so it is stable from run to run.
       Nexus**items_;
+	// The same pointers sorted by value, for fast lookup.
+      Nexus**sorted_;
       unsigned nitems_;
+      unsigned nalloc_;
 
+      unsigned lower_bound_(Nexus*that) const;
       unsigned bsearch_(Nexus*that) const;
 
     private: // not implemented
@@ -474,9 +499,26 @@ class NetNode  : public NetObj {
 	// This is used to scan a modifiable netlist, one node at a time.
       virtual void functor_node(Design*, functor_t*);
 
+	// Node classes for the per-class rings that the Design
+	// keeps, so functor passes can scan only the classes they
+	// handle. The order here matches the SCAN_* bits in
+	// functor.h, starting at SCAN_NODE_BASE.
+      enum node_class_t {
+	    CLASS_ABS = 0, CLASS_ADD_SUB, CLASS_COMPARE, CLASS_CONCAT,
+	    CLASS_CONST, CLASS_DIVIDE, CLASS_LITERAL, CLASS_MODULO,
+	    CLASS_FF, CLASS_LOGIC, CLASS_MULT, CLASS_MUX,
+	    CLASS_PART_SELECT, CLASS_POW, CLASS_SIGN_EXTEND,
+	    CLASS_UREDUCE, CLASS_OTHER, CLASS_COUNT
+      };
+
     private:
       friend class Design;
       NetNode*node_next_, *node_prev_;
+	// The same ring structure again, but linking only the nodes
+	// of the same class. Design::add_node classifies the node
+	// and links it in here.
+      NetNode*class_next_, *class_prev_;
+      unsigned node_class_;
       Design*design_;
 };
 
@@ -849,6 +891,27 @@ class NetScope : public Attrib {
       const NetScope* parent() const { return up_; }
       const NetScope* child(const hname_t&name) const;
 
+	/* These methods support dead task/function elimination. The
+	   statement and expression nodes that call into a task or
+	   function scope count themselves here, so a scope with no
+	   call references has a provably unreachable body. */
+      void incr_call_ref();
+      void decr_call_ref();
+      unsigned peek_call_ref() const { return call_ref_count_; }
+
+	/* Append the child scopes of this scope to the list. */
+      void child_scopes(std::list<NetScope*>&res) const;
+
+	/* Return true if no signal, event or scope in this scope
+	   subtree carries references. Only meaningful after the
+	   bodies of the dead scopes involved have been deleted, so
+	   that remaining counts all come from live code. */
+      bool no_external_refs() const;
+
+	/* Remove a child scope from this scope. The child scope
+	   object itself is not deleted. */
+      void unlink_child(NetScope*child);
+
 	// Nested modules have slightly different scope search rules.
       inline bool nested_module() const { return nested_module_; }
 	// Program blocks have elaboration constraints.
@@ -969,6 +1032,14 @@ class NetScope : public Attrib {
       perm_string local_symbol();
 
       void dump(ostream&) const;
+	// Like dump(), but do not descend into child scopes. The
+	// indexed design dump uses this to write each scope as its
+	// own seekable section.
+      void dump_local(ostream&) const;
+	// Dump this scope and its children as indexed sections,
+	// appending a (section name, file offset) record for each
+	// section written.
+      void dump_indexed(ostream&, std::list<std::pair<std::string,long> >&index) const;
       void emit_scope(struct target_t*tgt) const;
       bool emit_defs(struct target_t*tgt) const;
 
@@ -1066,6 +1137,13 @@ class NetScope : public Attrib {
       bool time_from_timescale_;
 
       NetEvent *events_;
+	// Name index over events_, so find_event does not need to
+	// walk the list. Duplicate names resolve to the same event
+	// that a front-to-back scan of the list would find.
+      std::map<perm_string,NetEvent*> events_map_;
+
+	// Count of task/function call references to this scope.
+      unsigned call_ref_count_;
 
       map<perm_string,LineInfo*> genvars_;
 
@@ -1831,10 +1909,19 @@ class NetExpr  : public LineInfo {
 	//                 the expression output.
       virtual NetNet*synthesize(Design*des, NetScope*scope, NetExpr*root);
 
+	// Expression nodes are created and deleted at a furious rate
+	// during elaboration, so allocate them from a dedicated heap.
+      static void* operator new(std::size_t size) { return heap_.alloc(size); }
+      static void operator delete(void*ptr, std::size_t size)
+      { heap_.free(ptr, size); }
+
     protected:
       void expr_width(unsigned wid) { width_ = wid; }
       void cast_signed_base_(bool flag) { signed_flag_ = flag; }
 
+    private:
+      static ObjHeap heap_;
+
     private:
       ivl_type_t net_type_;
       unsigned width_;
@@ -3114,6 +3201,10 @@ class NetFuncDef {
 
       void set_proc(NetProc*st);
 
+	// Detach and return the statement, leaving the definition
+	// empty. Used by dead task/function elimination.
+      NetProc* take_proc();
+
 	//const string name() const;
       const NetProc*proc() const;
       const NetScope*scope() const;
@@ -3270,6 +3361,10 @@ class NetTaskDef {
 
       void set_proc(NetProc*p);
 
+	// Detach and return the statement, leaving the definition
+	// empty. Used by dead task/function elimination.
+      NetProc* take_proc();
+
 	//const string& name() const;
       const NetScope* scope() const;
       const NetProc*proc() const;
@@ -4358,12 +4453,22 @@ class Design {
       void add_process(NetProcTop*);
       void add_process(NetAnalogTop*);
       void delete_process(NetProcTop*);
+	// Delete a batch of processes in one pass over the process
+	// list. This is what the synthesis driver uses to commit all
+	// its deletions at once, instead of searching the list once
+	// per process.
+      void delete_processes(const std::set<NetProcTop*>&dead);
       bool check_proc_delay() const;
 
       NetNet* find_discipline_reference(ivl_discipline_t dis, NetScope*scope);
 
 	// Iterate over the design...
       void dump(ostream&) const;
+	// Like dump(), but write the design as per-scope sections
+	// followed by an index of file offsets, so that tools can
+	// seek directly to a section instead of scanning the whole
+	// file. The stream must be seekable.
+      void dump_indexed(ostream&) const;
       void functor(struct functor_t*);
       void join_islands(void);
       int emit(struct target_t*) const;
@@ -4383,6 +4488,9 @@ class Design {
 
 	// List the nodes in the design.
       NetNode*nodes_;
+	// The same nodes again, one ring per node class so functor
+	// passes can scan just the classes they handle.
+      NetNode*class_nodes_[NetNode::CLASS_COUNT];
 	// These are in support of the node functor iterator.
       NetNode*nodes_functor_cur_;
       NetNode*nodes_functor_nxt_;
@@ -4459,19 +4567,17 @@ inline __ScopePathManip scope_path(const NetScope*scope)
 extern ostream& operator << (ostream&o, __ScopePathManip);
 
 /*
- * If this link has a nexus_ pointer, then it is the last Link in the
- * list. next_nlink() returns 0 for the last Link.
+ * The links of a nexus are strung into a nil terminated list, so the
+ * next link is simply the next_ pointer.
  */
 inline Link* Link::next_nlink()
 {
-      if (nexus_) return 0;
-      else return next_;
+      return next_;
 }
 
 inline const Link* Link::next_nlink() const
 {
-      if (nexus_) return 0;
-      else return next_;
+      return next_;
 }
 
 inline NetPins*Link::get_obj()
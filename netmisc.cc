@@ -31,7 +31,7 @@
 
 NetNet* sub_net_from(Design*des, NetScope*scope, long val, NetNet*sig)
 {
-      netvector_t*zero_vec = new netvector_t(sig->data_type(),
+      netvector_t*zero_vec = netvector_t::intern(sig->data_type(),
 					     sig->vector_width()-1, 0);
       NetNet*zero_net = new NetNet(scope, scope->local_symbol(),
 				   NetNet::WIRE, zero_vec);
@@ -65,7 +65,7 @@ NetNet* sub_net_from(Design*des, NetScope*scope, long val, NetNet*sig)
       connect(zero_net->pin(0), adder->pin_DataA());
       connect(adder->pin_DataB(), sig->pin(0));
 
-      netvector_t*tmp_vec = new netvector_t(sig->data_type(),
+      netvector_t*tmp_vec = netvector_t::intern(sig->data_type(),
 					    sig->vector_width()-1, 0);
       NetNet*tmp = new NetNet(scope, scope->local_symbol(),
 			      NetNet::WIRE, tmp_vec);
@@ -82,7 +82,10 @@ NetNet* cast_to_int2(Design*des, NetScope*scope, NetNet*src, unsigned wid)
       if (src->data_type() == IVL_VT_BOOL)
 	    return src;
 
-      netvector_t*tmp_vec = new netvector_t(IVL_VT_BOOL, wid-1, 0);
+      if (NetNet*tmp = lookup_coerced_net(scope, src, COERCE_INT2, wid))
+	    return tmp;
+
+      netvector_t*tmp_vec = netvector_t::intern(IVL_VT_BOOL, wid-1, 0);
       NetNet*tmp = new NetNet(scope, scope->local_symbol(), NetNet::WIRE, tmp_vec);
       tmp->set_line(*src);
       tmp->local_flag(true);
@@ -94,6 +97,7 @@ NetNet* cast_to_int2(Design*des, NetScope*scope, NetNet*src, unsigned wid)
       connect(cast->pin(0), tmp->pin(0));
       connect(cast->pin(1), src->pin(0));
 
+      save_coerced_net(scope, src, COERCE_INT2, wid, tmp);
       return tmp;
 }
 
@@ -102,7 +106,10 @@ NetNet* cast_to_int4(Design*des, NetScope*scope, NetNet*src, unsigned wid)
       if (src->data_type() != IVL_VT_REAL)
 	    return src;
 
-      netvector_t*tmp_vec = new netvector_t(IVL_VT_LOGIC, wid-1, 0);
+      if (NetNet*tmp = lookup_coerced_net(scope, src, COERCE_INT4, wid))
+	    return tmp;
+
+      netvector_t*tmp_vec = netvector_t::intern(IVL_VT_LOGIC, wid-1, 0);
       NetNet*tmp = new NetNet(scope, scope->local_symbol(), NetNet::WIRE, tmp_vec);
       tmp->set_line(*src);
       tmp->local_flag(true);
@@ -114,6 +121,7 @@ NetNet* cast_to_int4(Design*des, NetScope*scope, NetNet*src, unsigned wid)
       connect(cast->pin(0), tmp->pin(0));
       connect(cast->pin(1), src->pin(0));
 
+      save_coerced_net(scope, src, COERCE_INT4, wid, tmp);
       return tmp;
 }
 
@@ -122,7 +130,10 @@ NetNet* cast_to_real(Design*des, NetScope*scope, NetNet*src)
       if (src->data_type() == IVL_VT_REAL)
 	    return src;
 
-      netvector_t*tmp_vec = new netvector_t(IVL_VT_REAL);
+      if (NetNet*tmp = lookup_coerced_net(scope, src, COERCE_REAL, 0))
+	    return tmp;
+
+      netvector_t*tmp_vec = netvector_t::intern(IVL_VT_REAL);
       NetNet*tmp = new NetNet(scope, scope->local_symbol(), NetNet::WIRE, tmp_vec);
       tmp->set_line(*src);
       tmp->local_flag(true);
@@ -134,6 +145,7 @@ NetNet* cast_to_real(Design*des, NetScope*scope, NetNet*src)
       connect(cast->pin(0), tmp->pin(0));
       connect(cast->pin(1), src->pin(0));
 
+      save_coerced_net(scope, src, COERCE_REAL, 0, tmp);
       return tmp;
 }
 
@@ -653,7 +665,7 @@ NetNet* make_const_x(Design*des, NetScope*scope, unsigned long wid)
       NetConst*res = new NetConst(scope, scope->local_symbol(), xxx);
       des->add_node(res);
 
-      netvector_t*sig_vec = new netvector_t(IVL_VT_LOGIC, wid-1, 0);
+      netvector_t*sig_vec = netvector_t::intern(IVL_VT_LOGIC, wid-1, 0);
       NetNet*sig = new NetNet(scope, scope->local_symbol(), NetNet::WIRE, sig_vec);
       sig->local_flag(true);
 
@@ -667,7 +679,7 @@ NetNet* make_const_z(Design*des, NetScope*scope, unsigned long wid)
       NetConst*res = new NetConst(scope, scope->local_symbol(), xxx);
       des->add_node(res);
 
-      netvector_t*sig_vec = new netvector_t(IVL_VT_LOGIC, wid-1, 0);
+      netvector_t*sig_vec = netvector_t::intern(IVL_VT_LOGIC, wid-1, 0);
       NetNet*sig = new NetNet(scope, scope->local_symbol(), NetNet::WIRE, sig_vec);
       sig->local_flag(true);
 
@@ -95,6 +95,23 @@ extern NetExpr*condition_reduce(NetExpr*expr);
  */
 extern NetNet*crop_to_width(Design*des, NetNet*n, unsigned w);
 
+/*
+ * The net versions of pad_to_width/crop_to_width/cast_to_* above
+ * memoize their results, so call sites that request the same
+ * coercion of the same net share one network instead of each
+ * building their own. These are the cache internals. The cache
+ * holds bare pointers into the netlist, so elaborate() flushes and
+ * disables it before the cleanup passes start deleting nets; after
+ * that the helpers build fresh nodes every time, as they always did.
+ */
+enum coercion_style_t { COERCE_PAD, COERCE_PAD_SIGNED, COERCE_CROP,
+			COERCE_INT2, COERCE_INT4, COERCE_REAL };
+extern NetNet*lookup_coerced_net(const NetScope*scope, const NetNet*src,
+				 coercion_style_t style, unsigned wid);
+extern void save_coerced_net(const NetScope*scope, const NetNet*src,
+			     coercion_style_t style, unsigned wid, NetNet*net);
+extern void flush_coerced_nets(void);
+
 extern bool calculate_part(const LineInfo*li, Design*des, NetScope*scope,
 			   const index_component_t&index,
 			   long&off, unsigned long&wid);
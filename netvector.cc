@@ -45,6 +45,72 @@ netvector_t::~netvector_t()
 {
 }
 
+/*
+ * The interned instances are kept in this fixed size hash table,
+ * chained by cells that carry the key alongside the object. Only the
+ * constructor-argument shapes are keyed; the flag setters must not
+ * be used on instances handed out from here.
+ */
+struct intern_cell_s {
+      netvector_t*obj;
+      ivl_variable_type_t type;
+      long msb, lsb;
+      bool signed_flag;
+      bool scalar_flag;
+      struct intern_cell_s*next;
+};
+
+static const unsigned INTERN_HASH_SIZE = 512;
+static struct intern_cell_s* intern_table[INTERN_HASH_SIZE] = { 0 };
+
+static netvector_t* intern_search(ivl_variable_type_t type,
+				  long msb, long lsb,
+				  bool signed_flag, bool scalar_flag)
+{
+      unsigned hash = (unsigned)type;
+      hash = hash*13 + (unsigned long)msb;
+      hash = hash*13 + (unsigned long)lsb;
+      hash = hash*13 + (signed_flag? 1 : 0);
+      hash = hash*13 + (scalar_flag? 1 : 0);
+
+      struct intern_cell_s**bucket = intern_table + hash%INTERN_HASH_SIZE;
+      for (struct intern_cell_s*cur = *bucket ;  cur ;  cur = cur->next) {
+	    if (cur->type != type) continue;
+	    if (cur->scalar_flag != scalar_flag) continue;
+	    if (!scalar_flag && (cur->msb != msb || cur->lsb != lsb))
+		  continue;
+	    if (cur->signed_flag != signed_flag) continue;
+	    return cur->obj;
+      }
+
+      struct intern_cell_s*cell = new struct intern_cell_s;
+      if (scalar_flag) {
+	    cell->obj = new netvector_t(type);
+	    cell->obj->set_signed(signed_flag);
+      } else {
+	    cell->obj = new netvector_t(type, msb, lsb, signed_flag);
+      }
+      cell->type = type;
+      cell->msb = msb;
+      cell->lsb = lsb;
+      cell->signed_flag = signed_flag;
+      cell->scalar_flag = scalar_flag;
+      cell->next = *bucket;
+      *bucket = cell;
+      return cell->obj;
+}
+
+netvector_t* netvector_t::intern(ivl_variable_type_t type, long msb, long lsb,
+				 bool signed_flag)
+{
+      return intern_search(type, msb, lsb, signed_flag, false);
+}
+
+netvector_t* netvector_t::intern(ivl_variable_type_t type)
+{
+      return intern_search(type, 0, 0, false, true);
+}
+
 ivl_variable_type_t netvector_t::base_type() const
 {
       return type_;
@@ -46,6 +46,19 @@ class netvector_t : public ivl_type_s {
 
       ~netvector_t();
 
+	// Return a shared instance equivalent to the single-range or
+	// scalar constructor forms. Elaboration creates the same few
+	// vector shapes over and over for temporaries and padding, so
+	// these pool the instances in a hash table for the life of
+	// the compiler. Interned instances must never be modified
+	// through set_signed() and friends; use the constructors when
+	// the flags need adjusting after the fact. (NetNet does not
+	// take ownership of its type, so handing out shared types is
+	// safe.)
+      static netvector_t* intern(ivl_variable_type_t type, long msb, long lsb,
+				 bool signed_flag =false);
+      static netvector_t* intern(ivl_variable_type_t type);
+
 	// Vectors can be interpreted as signed or unsigned when
 	// handled as vectors.
       inline void set_signed(bool flag) { signed_ = flag; }
@@ -25,21 +25,63 @@
  * for proper functioning of anything, but they can clean up the
  * appearance of design files that are generated.
  */
+# include  <set>
 # include  "functor.h"
 # include  "netlist.h"
 # include  "compiler.h"
 
 class nodangle_f  : public functor_t {
     public:
+      unsigned scan_mask() const { return SCAN_EVENT | SCAN_SIGNAL; }
+
       void event(Design*des, NetEvent*ev);
       void signal(Design*des, NetNet*sig);
 
+	// Process the signals that deletions above may have left
+	// dangling, cascading until the work list is empty.
+      void drain_signals(Design*des);
+
       unsigned iteration;
       unsigned stotal, etotal;
       bool scontinue, econtinue;
       bool scomplete, ecomplete;
+
+    private:
+	// Queue the signals that share a nexus with the pins of this
+	// object, since removing the object may leave them dangling.
+      void queue_linked_signals_(NetPins*obj);
+
+      std::set<NetNet*> swork_;
 };
 
+void nodangle_f::queue_linked_signals_(NetPins*obj)
+{
+      for (unsigned idx = 0 ;  idx < obj->pin_count() ;  idx += 1) {
+	    Nexus*nex = obj->pin(idx).nexus();
+	    if (nex == 0)
+		  continue;
+
+	    for (Link*cur = nex->first_nlink()
+		       ; cur ;  cur = cur->next_nlink()) {
+
+		  NetNet*sig = dynamic_cast<NetNet*>(cur->get_obj());
+		  if (sig == 0 || sig == obj)
+			continue;
+
+		  swork_.insert(sig);
+	    }
+      }
+}
+
+void nodangle_f::drain_signals(Design*des)
+{
+      while (! swork_.empty()) {
+	    NetNet*cur = *swork_.begin();
+	    swork_.erase(swork_.begin());
+	    signal(des, cur);
+      }
+}
+
 void nodangle_f::event(Design*, NetEvent*ev)
 {
       if (ecomplete) return;
@@ -48,6 +90,10 @@ void nodangle_f::event(Design*, NetEvent*ev)
 	   ahead and delete it. There is no use looking further at
 	   it. */
       if ((ev->nwait() + ev->ntrig() + ev->nexpr()) == 0) {
+	      // Deleting the event unlinks its probes, which may
+	      // leave the probed signals dangling in turn.
+	    for (unsigned idx = 0 ;  idx < ev->nprobe() ;  idx += 1)
+		  queue_linked_signals_(ev->probe(idx));
 	    delete ev;
 	    etotal += 1;
 	    return;
@@ -147,6 +193,8 @@ void nodangle_f::signal(Design*, NetNet*sig)
 	/* Check to see if the signal is completely unconnected. If
 	   all the bits are unlinked, then delete it. */
       if (! sig->is_linked()) {
+	    queue_linked_signals_(sig);
+	    swork_.erase(sig);
 	    delete sig;
 	    stotal += 1;
 	    return;
@@ -187,6 +235,8 @@ void nodangle_f::signal(Design*, NetNet*sig)
 	/* If every pin is connected to another significant signal,
 	   then I can delete this one. */
       if (significant_flags == sig->pin_count()) {
+	    queue_linked_signals_(sig);
+	    swork_.erase(sig);
 	    delete sig;
 	    stotal += 1;
       }
@@ -223,7 +273,17 @@ void nodangle(Design*des)
 
       } while (fun.scontinue || fun.econtinue);
 
+	/* The event deletions above may have left probed signals
+	   dangling, and deleting a dangling signal can in turn
+	   dangle its neighbors. Drain the queued signals until the
+	   cascade settles, instead of rescanning the design. */
+      fun.scomplete = false;
+      fun.drain_signals(des);
+
       if (verbose_flag) {
+	    cout << " ... after worklist drain, deleted " << fun.stotal
+		 << " dangling signals and " << fun.etotal
+		 << " events in total." << endl << flush;
 	    cout << " ... done" << endl << flush;
       }
 }
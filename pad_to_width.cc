@@ -19,10 +19,73 @@
 
 # include "config.h"
 
+# include  <map>
 # include  "netlist.h"
 # include  "netvector.h"
 # include  "netmisc.h"
 
+/*
+ * Identical coercions of the same net are requested over and over
+ * during elaboration: a narrow signal that feeds many wider
+ * contexts gets a fresh NetConcat/NetSignExtend network from every
+ * call site, and in width-mismatch heavy code these duplicates are
+ * a large share of the nodes made here. Memoize the result net per
+ * (scope, source net, style, width) so the call sites share one
+ * network. The extra connections to the shared result net are just
+ * fanout on its nexus.
+ *
+ * The cache holds bare pointers into the netlist and has no way to
+ * notice a net being deleted, so elaborate() flushes and disables
+ * it before the cleanup passes run. After that, lookups miss and
+ * the helpers below build fresh nodes every time, as they always
+ * did for the synthesis passes.
+ */
+struct coerced_net_key_t {
+      const NetScope*scope;
+      const NetNet*src;
+      int style;
+      unsigned wid;
+      bool operator < (const coerced_net_key_t&that) const {
+	    if (scope != that.scope) return scope < that.scope;
+	    if (src != that.src) return src < that.src;
+	    if (style != that.style) return style < that.style;
+	    return wid < that.wid;
+      }
+};
+
+static map<coerced_net_key_t,NetNet*> coerced_net_map;
+static bool coerced_net_cache_active = true;
+
+NetNet* lookup_coerced_net(const NetScope*scope, const NetNet*src,
+			   coercion_style_t style, unsigned wid)
+{
+      if (! coerced_net_cache_active)
+	    return 0;
+
+      coerced_net_key_t key = { scope, src, style, wid };
+      map<coerced_net_key_t,NetNet*>::const_iterator cur
+	    = coerced_net_map.find(key);
+      if (cur == coerced_net_map.end())
+	    return 0;
+
+      return cur->second;
+}
+
+void save_coerced_net(const NetScope*scope, const NetNet*src,
+		      coercion_style_t style, unsigned wid, NetNet*net)
+{
+      if (! coerced_net_cache_active)
+	    return;
+
+      coerced_net_key_t key = { scope, src, style, wid };
+      coerced_net_map[key] = net;
+}
+
+void flush_coerced_nets(void)
+{
+      coerced_net_map.clear();
+      coerced_net_cache_active = false;
+}
 
 /*
  * This function transforms an expression by padding the high bits
@@ -63,6 +126,9 @@ NetNet*pad_to_width(Design*des, NetNet*net, unsigned wid, const LineInfo&info)
       if (net->vector_width() >= wid)
 	    return net;
 
+      if (NetNet*tmp = lookup_coerced_net(scope, net, COERCE_PAD, wid))
+	    return tmp;
+
 	// Make the NetConcat and connect the input net to the lsb input.
       NetConcat*cc = new NetConcat(scope, scope->local_symbol(), wid, 2);
       cc->set_line(info);
@@ -78,7 +144,7 @@ NetNet*pad_to_width(Design*des, NetNet*net, unsigned wid, const LineInfo&info)
       connect(cc->pin(2), con->pin(0));
 
 	// Make a NetNet for the NetConst to NetConcat link.
-      netvector_t*tmp_vec = new netvector_t(net->data_type(),
+      netvector_t*tmp_vec = netvector_t::intern(net->data_type(),
 					    wid - net->vector_width() - 1, 0);
       NetNet*tmp = new NetNet(scope, scope->local_symbol(),
 			      NetNet::WIRE, tmp_vec);
@@ -88,13 +154,14 @@ NetNet*pad_to_width(Design*des, NetNet*net, unsigned wid, const LineInfo&info)
 
 	// Create a NetNet of the output width and connect it to the
 	// NetConcat node output pin.
-      tmp_vec = new netvector_t(net->data_type(), wid-1, 0);
+      tmp_vec = netvector_t::intern(net->data_type(), wid-1, 0);
       tmp = new NetNet(scope, scope->local_symbol(),
 		       NetNet::WIRE, tmp_vec);
       tmp->set_line(info);
       tmp->local_flag(true);
       connect(cc->pin(0), tmp->pin(0));
 
+      save_coerced_net(scope, net, COERCE_PAD, wid, tmp);
       return tmp;
 }
 
@@ -106,13 +173,16 @@ NetNet*pad_to_width_signed(Design*des, NetNet*net, unsigned wid,
       if (net->vector_width() >= wid)
 	    return net;
 
+      if (NetNet*tmp = lookup_coerced_net(scope, net, COERCE_PAD_SIGNED, wid))
+	    return tmp;
+
       NetSignExtend*se
 	    = new NetSignExtend(scope, scope->local_symbol(), wid);
       se->set_line(info);
       des->add_node(se);
 
-      netvector_t*tmp_vec = new netvector_t(net->data_type(), wid-1, 0);
-      tmp_vec->set_signed(true);
+      netvector_t*tmp_vec = netvector_t::intern(net->data_type(), wid-1, 0,
+						true);
       NetNet*tmp = new NetNet(scope, scope->local_symbol(), NetNet::WIRE, tmp_vec);
       tmp->set_line(info);
       tmp->local_flag(true);
@@ -120,6 +190,7 @@ NetNet*pad_to_width_signed(Design*des, NetNet*net, unsigned wid,
       connect(tmp->pin(0), se->pin(0));
       connect(se->pin(1), net->pin(0));
 
+      save_coerced_net(scope, net, COERCE_PAD_SIGNED, wid, tmp);
       return tmp;
 }
 
@@ -130,16 +201,20 @@ NetNet*crop_to_width(Design*des, NetNet*net, unsigned wid)
       if (net->vector_width() <= wid)
 	    return net;
 
+      if (NetNet*tmp = lookup_coerced_net(scope, net, COERCE_CROP, wid))
+	    return tmp;
+
       NetPartSelect*ps = new NetPartSelect(net, 0, wid, NetPartSelect::VP);
       ps->set_line(*net);
       des->add_node(ps);
 
-      netvector_t*tmp_vec = new netvector_t(net->data_type(), wid-1, 0);
+      netvector_t*tmp_vec = netvector_t::intern(net->data_type(), wid-1, 0);
       NetNet*tmp = new NetNet(scope, scope->local_symbol(),
 			      NetNet::WIRE, tmp_vec);
       tmp->set_line(*net);
       tmp->local_flag(true);
       connect(ps->pin(0), tmp->pin(0));
 
+      save_coerced_net(scope, net, COERCE_CROP, wid, tmp);
       return tmp;
 }
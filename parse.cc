@@ -0,0 +1,14659 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison implementation for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* C LALR(1) parser skeleton written by Richard Stallman, by
+   simplifying the original so-called "semantic" parser.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+/* All symbols defined below should begin with yy or YY, to avoid
+   infringing on user name space.  This should be done even for local
+   variables, as they might otherwise be expanded by user macros.
+   There are some unavoidable exceptions within include files to
+   define necessary library symbols; they are noted "INFRINGES ON
+   USER NAME SPACE" below.  */
+
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
+
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
+
+/* Skeleton name.  */
+#define YYSKELETON_NAME "yacc.c"
+
+/* Pure parsers.  */
+#define YYPURE 0
+
+/* Push parsers.  */
+#define YYPUSH 0
+
+/* Pull parsers.  */
+#define YYPULL 1
+
+
+/* Substitute the variable and function names.  */
+#define yyparse         VLparse
+#define yylex           VLlex
+#define yyerror         VLerror
+#define yydebug         VLdebug
+#define yynerrs         VLnerrs
+#define yylval          VLlval
+#define yychar          VLchar
+#define yylloc          VLlloc
+
+/* First part of user prologue.  */
+#line 2 "parse.y"
+
+/*
+ * Copyright (c) 1998-2013 Stephen Williams (steve@icarus.com)
+ * Copyright CERN 2012-2013 / Stephen Williams (steve@icarus.com)
+ *
+ *    This source code is free software; you can redistribute it
+ *    and/or modify it in source code form under the terms of the GNU
+ *    General Public License as published by the Free Software
+ *    Foundation; either version 2 of the License, or (at your option)
+ *    any later version.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this program; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+# include "config.h"
+
+# include  "parse_misc.h"
+# include  "compiler.h"
+# include  "pform.h"
+# include  "Statement.h"
+# include  "PSpec.h"
+# include  <stack>
+# include  <cstring>
+# include  <sstream>
+
+class PSpecPath;
+
+extern void lex_start_table();
+extern void lex_end_table();
+
+bool have_timeunit_decl = false;
+bool have_timeprec_decl = false;
+
+static list<pform_range_t>* param_active_range = 0;
+static bool param_active_signed = false;
+static ivl_variable_type_t param_active_type = IVL_VT_LOGIC;
+
+/* Port declaration lists use this structure for context. */
+static struct {
+      NetNet::Type port_net_type;
+      NetNet::PortType port_type;
+      ivl_variable_type_t var_type;
+      bool sign_flag;
+      data_type_t* data_type;
+      list<pform_range_t>* range;
+} port_declaration_context = {NetNet::NONE, NetNet::NOT_A_PORT,
+                              IVL_VT_NO_TYPE, false, 0, 0};
+
+/* The task and function rules need to briefly hold the pointer to the
+   task/function that is currently in progress. */
+static PTask* current_task = 0;
+static PFunction* current_function = 0;
+static stack<PBlock*> current_block_stack;
+
+/* This is used to keep track of the extra arguments after the notifier
+ * in the $setuphold and $recrem timing checks. This allows us to print
+ * a warning message that the delayed signals will not be created. We
+ * need to do this since not driving these signals creates real
+ * simulation issues. */
+static unsigned args_after_notifier;
+
+/* The rules sometimes push attributes into a global context where
+   sub-rules may grab them. This makes parser rules a little easier to
+   write in some cases. */
+static list<named_pexpr_t>*attributes_in_context = 0;
+
+/* Later version of bison (including 1.35) will not compile in stack
+   extension if the output is compiled with C++ and either the YYSTYPE
+   or YYLTYPE are provided by the source code. However, I can get the
+   old behavior back by defining these symbols. */
+# define YYSTYPE_IS_TRIVIAL 1
+# define YYLTYPE_IS_TRIVIAL 1
+
+/* Recent version of bison expect that the user supply a
+   YYLLOC_DEFAULT macro that makes up a yylloc value from existing
+   values. I need to supply an explicit version to account for the
+   text field, that otherwise won't be copied. */
+# define YYLLOC_DEFAULT(Current, Rhs, N)  do {       \
+  (Current).first_line   = (Rhs)[1].first_line;      \
+  (Current).first_column = (Rhs)[1].first_column;    \
+  (Current).last_line    = (Rhs)[N].last_line;       \
+  (Current).last_column  = (Rhs)[N].last_column;     \
+  (Current).text         = (Rhs)[1].text;   } while (0)
+
+/*
+ * These are some common strength pairs that are used as defaults when
+ * the user is not otherwise specific.
+ */
+static const struct str_pair_t pull_strength = { IVL_DR_PULL,  IVL_DR_PULL };
+static const struct str_pair_t str_strength = { IVL_DR_STRONG, IVL_DR_STRONG };
+
+static list<pair<perm_string,PExpr*> >* make_port_list(char*id, PExpr*expr)
+{
+      list<pair<perm_string,PExpr*> >*tmp = new list<pair<perm_string,PExpr*> >;
+      tmp->push_back(make_pair(lex_strings.make(id), expr));
+      delete[]id;
+      return tmp;
+}
+static list<pair<perm_string,PExpr*> >* make_port_list(list<pair<perm_string, PExpr*> >*tmp,
+                                                       char*id, PExpr*expr)
+{
+      tmp->push_back(make_pair(lex_strings.make(id), expr));
+      delete[]id;
+      return tmp;
+}
+
+list<pform_range_t>* make_range_from_width(uint64_t wid)
+{
+      pform_range_t range;
+      range.first  = new PENumber(new verinum(wid-1, integer_width));
+      range.second = new PENumber(new verinum((uint64_t)0, integer_width));
+
+      list<pform_range_t>*rlist = new list<pform_range_t>;
+      rlist->push_back(range);
+      return rlist;
+}
+
+static list<perm_string>* list_from_identifier(char*id)
+{
+      list<perm_string>*tmp = new list<perm_string>;
+      tmp->push_back(lex_strings.make(id));
+      delete[]id;
+      return tmp;
+}
+
+static list<perm_string>* list_from_identifier(list<perm_string>*tmp, char*id)
+{
+      tmp->push_back(lex_strings.make(id));
+      delete[]id;
+      return tmp;
+}
+
+list<pform_range_t>* copy_range(list<pform_range_t>* orig)
+{
+      list<pform_range_t>*copy = 0;
+
+      if (orig)
+	    copy = new list<pform_range_t> (*orig);
+
+      return copy;
+}
+
+template <class T> void append(vector<T>&out, const vector<T>&in)
+{
+      for (size_t idx = 0 ; idx < in.size() ; idx += 1)
+	    out.push_back(in[idx]);
+}
+
+/*
+ * This is a shorthand for making a PECallFunction that takes a single
+ * arg. This is used by some of the code that detects built-ins.
+ */
+static PECallFunction*make_call_function(perm_string tn, PExpr*arg)
+{
+      vector<PExpr*> parms(1);
+      parms[0] = arg;
+      PECallFunction*tmp = new PECallFunction(tn, parms);
+      return tmp;
+}
+
+static PECallFunction*make_call_function(perm_string tn, PExpr*arg1, PExpr*arg2)
+{
+      vector<PExpr*> parms(2);
+      parms[0] = arg1;
+      parms[1] = arg2;
+      PECallFunction*tmp = new PECallFunction(tn, parms);
+      return tmp;
+}
+
+static list<named_pexpr_t>* make_named_numbers(perm_string name, long first, long last, PExpr*val =0)
+{
+      list<named_pexpr_t>*lst = new list<named_pexpr_t>;
+      named_pexpr_t tmp;
+	// We are counting up.
+      if (first <= last) {
+	    for (long idx = first ; idx <= last ; idx += 1) {
+		  ostringstream buf;
+		  buf << name.str() << idx << ends;
+		  tmp.name = lex_strings.make(buf.str());
+		  tmp.parm = val;
+		  val = 0;
+		  lst->push_back(tmp);
+	    }
+	// We are counting down.
+      } else {
+	    for (long idx = first ; idx >= last ; idx -= 1) {
+		  ostringstream buf;
+		  buf << name.str() << idx << ends;
+		  tmp.name = lex_strings.make(buf.str());
+		  tmp.parm = val;
+		  val = 0;
+		  lst->push_back(tmp);
+	    }
+      }
+      return lst;
+}
+
+static list<named_pexpr_t>* make_named_number(perm_string name, PExpr*val =0)
+{
+      list<named_pexpr_t>*lst = new list<named_pexpr_t>;
+      named_pexpr_t tmp;
+      tmp.name = name;
+      tmp.parm = val;
+      lst->push_back(tmp);
+      return lst;
+}
+
+static long check_enum_seq_value(const YYLTYPE&loc, verinum *arg, bool zero_ok)
+{
+      long value = 1;
+	// We can never have an undefined value in an enumeration name
+	// declaration sequence.
+      if (! arg->is_defined()) {
+	    yyerror(loc, "error: undefined value used in enum name sequence.");
+	// We can never have a negative value in an enumeration name
+	// declaration sequence.
+      } else if (arg->is_negative()) {
+	    yyerror(loc, "error: negative value used in enum name sequence.");
+      } else {
+	    value = arg->as_ulong();
+	      // We cannot have a zero enumeration name declaration count.
+	    if (! zero_ok && (value == 0)) {
+		  yyerror(loc, "error: zero count used in enum name sequence.");
+		  value = 1;
+	    }
+      }
+      return value;
+}
+
+static void current_task_set_statement(const YYLTYPE&loc, vector<Statement*>*s)
+{
+      if (s == 0) {
+	      /* if the statement list is null, then the parser
+		 detected the case that there are no statements in the
+		 task. If this is System Verilog, handle it as an
+		 an empty block. */
+	    if (!gn_system_verilog()) {
+		  yyerror(loc, "error: Support for empty tasks requires SystemVerilog.");
+	    }
+	    PBlock*tmp = new PBlock(PBlock::BL_SEQ);
+	    FILE_NAME(tmp, loc);
+	    current_task->set_statement(tmp);
+	    return;
+      }
+      assert(s);
+
+        /* An empty vector represents one or more null statements. Handle
+           this as a simple null statement. */
+      if (s->empty())
+            return;
+
+	/* A vector of 1 is handled as a simple statement. */
+      if (s->size() == 1) {
+	    current_task->set_statement((*s)[0]);
+	    return;
+      }
+
+      if (!gn_system_verilog()) {
+	    yyerror(loc, "error: Task body with multiple statements requires SystemVerilog.");
+      }
+
+      PBlock*tmp = new PBlock(PBlock::BL_SEQ);
+      FILE_NAME(tmp, loc);
+      tmp->set_statement(*s);
+      current_task->set_statement(tmp);
+}
+
+static void current_function_set_statement(const YYLTYPE&loc, vector<Statement*>*s)
+{
+      if (s == 0) {
+	      /* if the statement list is null, then the parser
+		 detected the case that there are no statements in the
+		 task. If this is System Verilog, handle it as an
+		 an empty block. */
+	    if (!gn_system_verilog()) {
+		  yyerror(loc, "error: Support for empty functions requires SystemVerilog.");
+	    }
+	    PBlock*tmp = new PBlock(PBlock::BL_SEQ);
+	    FILE_NAME(tmp, loc);
+	    current_function->set_statement(tmp);
+	    return;
+      }
+      assert(s);
+
+        /* An empty vector represents one or more null statements. Handle
+           this as a simple null statement. */
+      if (s->empty())
+            return;
+
+	/* A vector of 1 is handled as a simple statement. */
+      if (s->size() == 1) {
+	    current_function->set_statement((*s)[0]);
+	    return;
+      }
+
+      if (!gn_system_verilog()) {
+	    yyerror(loc, "error: Function body with multiple statements requires SystemVerilog.");
+      }
+
+      PBlock*tmp = new PBlock(PBlock::BL_SEQ);
+      FILE_NAME(tmp, loc);
+      tmp->set_statement(*s);
+      current_function->set_statement(tmp);
+}
+
+
+#line 393 "parse.cc"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+#include "parse.hh"
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_IDENTIFIER = 3,                 /* IDENTIFIER  */
+  YYSYMBOL_SYSTEM_IDENTIFIER = 4,          /* SYSTEM_IDENTIFIER  */
+  YYSYMBOL_STRING = 5,                     /* STRING  */
+  YYSYMBOL_TIME_LITERAL = 6,               /* TIME_LITERAL  */
+  YYSYMBOL_TYPE_IDENTIFIER = 7,            /* TYPE_IDENTIFIER  */
+  YYSYMBOL_DISCIPLINE_IDENTIFIER = 8,      /* DISCIPLINE_IDENTIFIER  */
+  YYSYMBOL_PATHPULSE_IDENTIFIER = 9,       /* PATHPULSE_IDENTIFIER  */
+  YYSYMBOL_BASED_NUMBER = 10,              /* BASED_NUMBER  */
+  YYSYMBOL_DEC_NUMBER = 11,                /* DEC_NUMBER  */
+  YYSYMBOL_UNBASED_NUMBER = 12,            /* UNBASED_NUMBER  */
+  YYSYMBOL_REALTIME = 13,                  /* REALTIME  */
+  YYSYMBOL_K_PLUS_EQ = 14,                 /* K_PLUS_EQ  */
+  YYSYMBOL_K_MINUS_EQ = 15,                /* K_MINUS_EQ  */
+  YYSYMBOL_K_INCR = 16,                    /* K_INCR  */
+  YYSYMBOL_K_DECR = 17,                    /* K_DECR  */
+  YYSYMBOL_K_LE = 18,                      /* K_LE  */
+  YYSYMBOL_K_GE = 19,                      /* K_GE  */
+  YYSYMBOL_K_EG = 20,                      /* K_EG  */
+  YYSYMBOL_K_EQ = 21,                      /* K_EQ  */
+  YYSYMBOL_K_NE = 22,                      /* K_NE  */
+  YYSYMBOL_K_CEQ = 23,                     /* K_CEQ  */
+  YYSYMBOL_K_CNE = 24,                     /* K_CNE  */
+  YYSYMBOL_K_LP = 25,                      /* K_LP  */
+  YYSYMBOL_K_LS = 26,                      /* K_LS  */
+  YYSYMBOL_K_RS = 27,                      /* K_RS  */
+  YYSYMBOL_K_RSS = 28,                     /* K_RSS  */
+  YYSYMBOL_K_SG = 29,                      /* K_SG  */
+  YYSYMBOL_K_CONTRIBUTE = 30,              /* K_CONTRIBUTE  */
+  YYSYMBOL_K_PO_POS = 31,                  /* K_PO_POS  */
+  YYSYMBOL_K_PO_NEG = 32,                  /* K_PO_NEG  */
+  YYSYMBOL_K_POW = 33,                     /* K_POW  */
+  YYSYMBOL_K_PSTAR = 34,                   /* K_PSTAR  */
+  YYSYMBOL_K_STARP = 35,                   /* K_STARP  */
+  YYSYMBOL_K_DOTSTAR = 36,                 /* K_DOTSTAR  */
+  YYSYMBOL_K_LOR = 37,                     /* K_LOR  */
+  YYSYMBOL_K_LAND = 38,                    /* K_LAND  */
+  YYSYMBOL_K_NAND = 39,                    /* K_NAND  */
+  YYSYMBOL_K_NOR = 40,                     /* K_NOR  */
+  YYSYMBOL_K_NXOR = 41,                    /* K_NXOR  */
+  YYSYMBOL_K_TRIGGER = 42,                 /* K_TRIGGER  */
+  YYSYMBOL_K_SCOPE_RES = 43,               /* K_SCOPE_RES  */
+  YYSYMBOL_K_edge_descriptor = 44,         /* K_edge_descriptor  */
+  YYSYMBOL_K_always = 45,                  /* K_always  */
+  YYSYMBOL_K_and = 46,                     /* K_and  */
+  YYSYMBOL_K_assign = 47,                  /* K_assign  */
+  YYSYMBOL_K_begin = 48,                   /* K_begin  */
+  YYSYMBOL_K_buf = 49,                     /* K_buf  */
+  YYSYMBOL_K_bufif0 = 50,                  /* K_bufif0  */
+  YYSYMBOL_K_bufif1 = 51,                  /* K_bufif1  */
+  YYSYMBOL_K_case = 52,                    /* K_case  */
+  YYSYMBOL_K_casex = 53,                   /* K_casex  */
+  YYSYMBOL_K_casez = 54,                   /* K_casez  */
+  YYSYMBOL_K_cmos = 55,                    /* K_cmos  */
+  YYSYMBOL_K_deassign = 56,                /* K_deassign  */
+  YYSYMBOL_K_default = 57,                 /* K_default  */
+  YYSYMBOL_K_defparam = 58,                /* K_defparam  */
+  YYSYMBOL_K_disable = 59,                 /* K_disable  */
+  YYSYMBOL_K_edge = 60,                    /* K_edge  */
+  YYSYMBOL_K_else = 61,                    /* K_else  */
+  YYSYMBOL_K_end = 62,                     /* K_end  */
+  YYSYMBOL_K_endcase = 63,                 /* K_endcase  */
+  YYSYMBOL_K_endfunction = 64,             /* K_endfunction  */
+  YYSYMBOL_K_endmodule = 65,               /* K_endmodule  */
+  YYSYMBOL_K_endprimitive = 66,            /* K_endprimitive  */
+  YYSYMBOL_K_endspecify = 67,              /* K_endspecify  */
+  YYSYMBOL_K_endtable = 68,                /* K_endtable  */
+  YYSYMBOL_K_endtask = 69,                 /* K_endtask  */
+  YYSYMBOL_K_event = 70,                   /* K_event  */
+  YYSYMBOL_K_for = 71,                     /* K_for  */
+  YYSYMBOL_K_force = 72,                   /* K_force  */
+  YYSYMBOL_K_forever = 73,                 /* K_forever  */
+  YYSYMBOL_K_fork = 74,                    /* K_fork  */
+  YYSYMBOL_K_function = 75,                /* K_function  */
+  YYSYMBOL_K_highz0 = 76,                  /* K_highz0  */
+  YYSYMBOL_K_highz1 = 77,                  /* K_highz1  */
+  YYSYMBOL_K_if = 78,                      /* K_if  */
+  YYSYMBOL_K_ifnone = 79,                  /* K_ifnone  */
+  YYSYMBOL_K_initial = 80,                 /* K_initial  */
+  YYSYMBOL_K_inout = 81,                   /* K_inout  */
+  YYSYMBOL_K_input = 82,                   /* K_input  */
+  YYSYMBOL_K_integer = 83,                 /* K_integer  */
+  YYSYMBOL_K_join = 84,                    /* K_join  */
+  YYSYMBOL_K_large = 85,                   /* K_large  */
+  YYSYMBOL_K_macromodule = 86,             /* K_macromodule  */
+  YYSYMBOL_K_medium = 87,                  /* K_medium  */
+  YYSYMBOL_K_module = 88,                  /* K_module  */
+  YYSYMBOL_K_nand = 89,                    /* K_nand  */
+  YYSYMBOL_K_negedge = 90,                 /* K_negedge  */
+  YYSYMBOL_K_nmos = 91,                    /* K_nmos  */
+  YYSYMBOL_K_nor = 92,                     /* K_nor  */
+  YYSYMBOL_K_not = 93,                     /* K_not  */
+  YYSYMBOL_K_notif0 = 94,                  /* K_notif0  */
+  YYSYMBOL_K_notif1 = 95,                  /* K_notif1  */
+  YYSYMBOL_K_or = 96,                      /* K_or  */
+  YYSYMBOL_K_output = 97,                  /* K_output  */
+  YYSYMBOL_K_parameter = 98,               /* K_parameter  */
+  YYSYMBOL_K_pmos = 99,                    /* K_pmos  */
+  YYSYMBOL_K_posedge = 100,                /* K_posedge  */
+  YYSYMBOL_K_primitive = 101,              /* K_primitive  */
+  YYSYMBOL_K_pull0 = 102,                  /* K_pull0  */
+  YYSYMBOL_K_pull1 = 103,                  /* K_pull1  */
+  YYSYMBOL_K_pulldown = 104,               /* K_pulldown  */
+  YYSYMBOL_K_pullup = 105,                 /* K_pullup  */
+  YYSYMBOL_K_rcmos = 106,                  /* K_rcmos  */
+  YYSYMBOL_K_real = 107,                   /* K_real  */
+  YYSYMBOL_K_realtime = 108,               /* K_realtime  */
+  YYSYMBOL_K_reg = 109,                    /* K_reg  */
+  YYSYMBOL_K_release = 110,                /* K_release  */
+  YYSYMBOL_K_repeat = 111,                 /* K_repeat  */
+  YYSYMBOL_K_rnmos = 112,                  /* K_rnmos  */
+  YYSYMBOL_K_rpmos = 113,                  /* K_rpmos  */
+  YYSYMBOL_K_rtran = 114,                  /* K_rtran  */
+  YYSYMBOL_K_rtranif0 = 115,               /* K_rtranif0  */
+  YYSYMBOL_K_rtranif1 = 116,               /* K_rtranif1  */
+  YYSYMBOL_K_scalared = 117,               /* K_scalared  */
+  YYSYMBOL_K_small = 118,                  /* K_small  */
+  YYSYMBOL_K_specify = 119,                /* K_specify  */
+  YYSYMBOL_K_specparam = 120,              /* K_specparam  */
+  YYSYMBOL_K_strong0 = 121,                /* K_strong0  */
+  YYSYMBOL_K_strong1 = 122,                /* K_strong1  */
+  YYSYMBOL_K_supply0 = 123,                /* K_supply0  */
+  YYSYMBOL_K_supply1 = 124,                /* K_supply1  */
+  YYSYMBOL_K_table = 125,                  /* K_table  */
+  YYSYMBOL_K_task = 126,                   /* K_task  */
+  YYSYMBOL_K_time = 127,                   /* K_time  */
+  YYSYMBOL_K_tran = 128,                   /* K_tran  */
+  YYSYMBOL_K_tranif0 = 129,                /* K_tranif0  */
+  YYSYMBOL_K_tranif1 = 130,                /* K_tranif1  */
+  YYSYMBOL_K_tri = 131,                    /* K_tri  */
+  YYSYMBOL_K_tri0 = 132,                   /* K_tri0  */
+  YYSYMBOL_K_tri1 = 133,                   /* K_tri1  */
+  YYSYMBOL_K_triand = 134,                 /* K_triand  */
+  YYSYMBOL_K_trior = 135,                  /* K_trior  */
+  YYSYMBOL_K_trireg = 136,                 /* K_trireg  */
+  YYSYMBOL_K_vectored = 137,               /* K_vectored  */
+  YYSYMBOL_K_wait = 138,                   /* K_wait  */
+  YYSYMBOL_K_wand = 139,                   /* K_wand  */
+  YYSYMBOL_K_weak0 = 140,                  /* K_weak0  */
+  YYSYMBOL_K_weak1 = 141,                  /* K_weak1  */
+  YYSYMBOL_K_while = 142,                  /* K_while  */
+  YYSYMBOL_K_wire = 143,                   /* K_wire  */
+  YYSYMBOL_K_wor = 144,                    /* K_wor  */
+  YYSYMBOL_K_xnor = 145,                   /* K_xnor  */
+  YYSYMBOL_K_xor = 146,                    /* K_xor  */
+  YYSYMBOL_K_Shold = 147,                  /* K_Shold  */
+  YYSYMBOL_K_Snochange = 148,              /* K_Snochange  */
+  YYSYMBOL_K_Speriod = 149,                /* K_Speriod  */
+  YYSYMBOL_K_Srecovery = 150,              /* K_Srecovery  */
+  YYSYMBOL_K_Ssetup = 151,                 /* K_Ssetup  */
+  YYSYMBOL_K_Ssetuphold = 152,             /* K_Ssetuphold  */
+  YYSYMBOL_K_Sskew = 153,                  /* K_Sskew  */
+  YYSYMBOL_K_Swidth = 154,                 /* K_Swidth  */
+  YYSYMBOL_KK_attribute = 155,             /* KK_attribute  */
+  YYSYMBOL_K_bool = 156,                   /* K_bool  */
+  YYSYMBOL_K_logic = 157,                  /* K_logic  */
+  YYSYMBOL_K_automatic = 158,              /* K_automatic  */
+  YYSYMBOL_K_endgenerate = 159,            /* K_endgenerate  */
+  YYSYMBOL_K_generate = 160,               /* K_generate  */
+  YYSYMBOL_K_genvar = 161,                 /* K_genvar  */
+  YYSYMBOL_K_localparam = 162,             /* K_localparam  */
+  YYSYMBOL_K_noshowcancelled = 163,        /* K_noshowcancelled  */
+  YYSYMBOL_K_pulsestyle_onevent = 164,     /* K_pulsestyle_onevent  */
+  YYSYMBOL_K_pulsestyle_ondetect = 165,    /* K_pulsestyle_ondetect  */
+  YYSYMBOL_K_showcancelled = 166,          /* K_showcancelled  */
+  YYSYMBOL_K_signed = 167,                 /* K_signed  */
+  YYSYMBOL_K_unsigned = 168,               /* K_unsigned  */
+  YYSYMBOL_K_Sfullskew = 169,              /* K_Sfullskew  */
+  YYSYMBOL_K_Srecrem = 170,                /* K_Srecrem  */
+  YYSYMBOL_K_Sremoval = 171,               /* K_Sremoval  */
+  YYSYMBOL_K_Stimeskew = 172,              /* K_Stimeskew  */
+  YYSYMBOL_K_cell = 173,                   /* K_cell  */
+  YYSYMBOL_K_config = 174,                 /* K_config  */
+  YYSYMBOL_K_design = 175,                 /* K_design  */
+  YYSYMBOL_K_endconfig = 176,              /* K_endconfig  */
+  YYSYMBOL_K_incdir = 177,                 /* K_incdir  */
+  YYSYMBOL_K_include = 178,                /* K_include  */
+  YYSYMBOL_K_instance = 179,               /* K_instance  */
+  YYSYMBOL_K_liblist = 180,                /* K_liblist  */
+  YYSYMBOL_K_library = 181,                /* K_library  */
+  YYSYMBOL_K_use = 182,                    /* K_use  */
+  YYSYMBOL_K_wone = 183,                   /* K_wone  */
+  YYSYMBOL_K_uwire = 184,                  /* K_uwire  */
+  YYSYMBOL_K_alias = 185,                  /* K_alias  */
+  YYSYMBOL_K_always_comb = 186,            /* K_always_comb  */
+  YYSYMBOL_K_always_ff = 187,              /* K_always_ff  */
+  YYSYMBOL_K_always_latch = 188,           /* K_always_latch  */
+  YYSYMBOL_K_assert = 189,                 /* K_assert  */
+  YYSYMBOL_K_assume = 190,                 /* K_assume  */
+  YYSYMBOL_K_before = 191,                 /* K_before  */
+  YYSYMBOL_K_bind = 192,                   /* K_bind  */
+  YYSYMBOL_K_bins = 193,                   /* K_bins  */
+  YYSYMBOL_K_binsof = 194,                 /* K_binsof  */
+  YYSYMBOL_K_bit = 195,                    /* K_bit  */
+  YYSYMBOL_K_break = 196,                  /* K_break  */
+  YYSYMBOL_K_byte = 197,                   /* K_byte  */
+  YYSYMBOL_K_chandle = 198,                /* K_chandle  */
+  YYSYMBOL_K_class = 199,                  /* K_class  */
+  YYSYMBOL_K_clocking = 200,               /* K_clocking  */
+  YYSYMBOL_K_const = 201,                  /* K_const  */
+  YYSYMBOL_K_constraint = 202,             /* K_constraint  */
+  YYSYMBOL_K_context = 203,                /* K_context  */
+  YYSYMBOL_K_continue = 204,               /* K_continue  */
+  YYSYMBOL_K_cover = 205,                  /* K_cover  */
+  YYSYMBOL_K_covergroup = 206,             /* K_covergroup  */
+  YYSYMBOL_K_coverpoint = 207,             /* K_coverpoint  */
+  YYSYMBOL_K_cross = 208,                  /* K_cross  */
+  YYSYMBOL_K_dist = 209,                   /* K_dist  */
+  YYSYMBOL_K_do = 210,                     /* K_do  */
+  YYSYMBOL_K_endclass = 211,               /* K_endclass  */
+  YYSYMBOL_K_endclocking = 212,            /* K_endclocking  */
+  YYSYMBOL_K_endgroup = 213,               /* K_endgroup  */
+  YYSYMBOL_K_endinterface = 214,           /* K_endinterface  */
+  YYSYMBOL_K_endpackage = 215,             /* K_endpackage  */
+  YYSYMBOL_K_endprogram = 216,             /* K_endprogram  */
+  YYSYMBOL_K_endproperty = 217,            /* K_endproperty  */
+  YYSYMBOL_K_endsequence = 218,            /* K_endsequence  */
+  YYSYMBOL_K_enum = 219,                   /* K_enum  */
+  YYSYMBOL_K_expect = 220,                 /* K_expect  */
+  YYSYMBOL_K_export = 221,                 /* K_export  */
+  YYSYMBOL_K_extends = 222,                /* K_extends  */
+  YYSYMBOL_K_extern = 223,                 /* K_extern  */
+  YYSYMBOL_K_final = 224,                  /* K_final  */
+  YYSYMBOL_K_first_match = 225,            /* K_first_match  */
+  YYSYMBOL_K_foreach = 226,                /* K_foreach  */
+  YYSYMBOL_K_forkjoin = 227,               /* K_forkjoin  */
+  YYSYMBOL_K_iff = 228,                    /* K_iff  */
+  YYSYMBOL_K_ignore_bins = 229,            /* K_ignore_bins  */
+  YYSYMBOL_K_illegal_bins = 230,           /* K_illegal_bins  */
+  YYSYMBOL_K_import = 231,                 /* K_import  */
+  YYSYMBOL_K_inside = 232,                 /* K_inside  */
+  YYSYMBOL_K_int = 233,                    /* K_int  */
+  YYSYMBOL_K_interface = 234,              /* K_interface  */
+  YYSYMBOL_K_intersect = 235,              /* K_intersect  */
+  YYSYMBOL_K_join_any = 236,               /* K_join_any  */
+  YYSYMBOL_K_join_none = 237,              /* K_join_none  */
+  YYSYMBOL_K_local = 238,                  /* K_local  */
+  YYSYMBOL_K_longint = 239,                /* K_longint  */
+  YYSYMBOL_K_matches = 240,                /* K_matches  */
+  YYSYMBOL_K_modport = 241,                /* K_modport  */
+  YYSYMBOL_K_new = 242,                    /* K_new  */
+  YYSYMBOL_K_null = 243,                   /* K_null  */
+  YYSYMBOL_K_package = 244,                /* K_package  */
+  YYSYMBOL_K_packed = 245,                 /* K_packed  */
+  YYSYMBOL_K_priority = 246,               /* K_priority  */
+  YYSYMBOL_K_program = 247,                /* K_program  */
+  YYSYMBOL_K_property = 248,               /* K_property  */
+  YYSYMBOL_K_protected = 249,              /* K_protected  */
+  YYSYMBOL_K_pure = 250,                   /* K_pure  */
+  YYSYMBOL_K_rand = 251,                   /* K_rand  */
+  YYSYMBOL_K_randc = 252,                  /* K_randc  */
+  YYSYMBOL_K_randcase = 253,               /* K_randcase  */
+  YYSYMBOL_K_randsequence = 254,           /* K_randsequence  */
+  YYSYMBOL_K_ref = 255,                    /* K_ref  */
+  YYSYMBOL_K_return = 256,                 /* K_return  */
+  YYSYMBOL_K_sequence = 257,               /* K_sequence  */
+  YYSYMBOL_K_shortint = 258,               /* K_shortint  */
+  YYSYMBOL_K_shortreal = 259,              /* K_shortreal  */
+  YYSYMBOL_K_solve = 260,                  /* K_solve  */
+  YYSYMBOL_K_static = 261,                 /* K_static  */
+  YYSYMBOL_K_string = 262,                 /* K_string  */
+  YYSYMBOL_K_struct = 263,                 /* K_struct  */
+  YYSYMBOL_K_super = 264,                  /* K_super  */
+  YYSYMBOL_K_tagged = 265,                 /* K_tagged  */
+  YYSYMBOL_K_this = 266,                   /* K_this  */
+  YYSYMBOL_K_throughout = 267,             /* K_throughout  */
+  YYSYMBOL_K_timeprecision = 268,          /* K_timeprecision  */
+  YYSYMBOL_K_timeunit = 269,               /* K_timeunit  */
+  YYSYMBOL_K_type = 270,                   /* K_type  */
+  YYSYMBOL_K_typedef = 271,                /* K_typedef  */
+  YYSYMBOL_K_union = 272,                  /* K_union  */
+  YYSYMBOL_K_unique = 273,                 /* K_unique  */
+  YYSYMBOL_K_var = 274,                    /* K_var  */
+  YYSYMBOL_K_virtual = 275,                /* K_virtual  */
+  YYSYMBOL_K_void = 276,                   /* K_void  */
+  YYSYMBOL_K_wait_order = 277,             /* K_wait_order  */
+  YYSYMBOL_K_wildcard = 278,               /* K_wildcard  */
+  YYSYMBOL_K_with = 279,                   /* K_with  */
+  YYSYMBOL_K_within = 280,                 /* K_within  */
+  YYSYMBOL_K_timeprecision_check = 281,    /* K_timeprecision_check  */
+  YYSYMBOL_K_timeunit_check = 282,         /* K_timeunit_check  */
+  YYSYMBOL_K_accept_on = 283,              /* K_accept_on  */
+  YYSYMBOL_K_checker = 284,                /* K_checker  */
+  YYSYMBOL_K_endchecker = 285,             /* K_endchecker  */
+  YYSYMBOL_K_eventually = 286,             /* K_eventually  */
+  YYSYMBOL_K_global = 287,                 /* K_global  */
+  YYSYMBOL_K_implies = 288,                /* K_implies  */
+  YYSYMBOL_K_let = 289,                    /* K_let  */
+  YYSYMBOL_K_nexttime = 290,               /* K_nexttime  */
+  YYSYMBOL_K_reject_on = 291,              /* K_reject_on  */
+  YYSYMBOL_K_restrict = 292,               /* K_restrict  */
+  YYSYMBOL_K_s_always = 293,               /* K_s_always  */
+  YYSYMBOL_K_s_eventually = 294,           /* K_s_eventually  */
+  YYSYMBOL_K_s_nexttime = 295,             /* K_s_nexttime  */
+  YYSYMBOL_K_s_until = 296,                /* K_s_until  */
+  YYSYMBOL_K_s_until_with = 297,           /* K_s_until_with  */
+  YYSYMBOL_K_strong = 298,                 /* K_strong  */
+  YYSYMBOL_K_sync_accept_on = 299,         /* K_sync_accept_on  */
+  YYSYMBOL_K_sync_reject_on = 300,         /* K_sync_reject_on  */
+  YYSYMBOL_K_unique0 = 301,                /* K_unique0  */
+  YYSYMBOL_K_until = 302,                  /* K_until  */
+  YYSYMBOL_K_until_with = 303,             /* K_until_with  */
+  YYSYMBOL_K_untyped = 304,                /* K_untyped  */
+  YYSYMBOL_K_weak = 305,                   /* K_weak  */
+  YYSYMBOL_K_above = 306,                  /* K_above  */
+  YYSYMBOL_K_abs = 307,                    /* K_abs  */
+  YYSYMBOL_K_absdelay = 308,               /* K_absdelay  */
+  YYSYMBOL_K_abstol = 309,                 /* K_abstol  */
+  YYSYMBOL_K_access = 310,                 /* K_access  */
+  YYSYMBOL_K_acos = 311,                   /* K_acos  */
+  YYSYMBOL_K_acosh = 312,                  /* K_acosh  */
+  YYSYMBOL_K_ac_stim = 313,                /* K_ac_stim  */
+  YYSYMBOL_K_aliasparam = 314,             /* K_aliasparam  */
+  YYSYMBOL_K_analog = 315,                 /* K_analog  */
+  YYSYMBOL_K_analysis = 316,               /* K_analysis  */
+  YYSYMBOL_K_asin = 317,                   /* K_asin  */
+  YYSYMBOL_K_asinh = 318,                  /* K_asinh  */
+  YYSYMBOL_K_atan = 319,                   /* K_atan  */
+  YYSYMBOL_K_atan2 = 320,                  /* K_atan2  */
+  YYSYMBOL_K_atanh = 321,                  /* K_atanh  */
+  YYSYMBOL_K_branch = 322,                 /* K_branch  */
+  YYSYMBOL_K_ceil = 323,                   /* K_ceil  */
+  YYSYMBOL_K_connect = 324,                /* K_connect  */
+  YYSYMBOL_K_connectmodule = 325,          /* K_connectmodule  */
+  YYSYMBOL_K_connectrules = 326,           /* K_connectrules  */
+  YYSYMBOL_K_continuous = 327,             /* K_continuous  */
+  YYSYMBOL_K_cos = 328,                    /* K_cos  */
+  YYSYMBOL_K_cosh = 329,                   /* K_cosh  */
+  YYSYMBOL_K_ddt = 330,                    /* K_ddt  */
+  YYSYMBOL_K_ddt_nature = 331,             /* K_ddt_nature  */
+  YYSYMBOL_K_ddx = 332,                    /* K_ddx  */
+  YYSYMBOL_K_discipline = 333,             /* K_discipline  */
+  YYSYMBOL_K_discrete = 334,               /* K_discrete  */
+  YYSYMBOL_K_domain = 335,                 /* K_domain  */
+  YYSYMBOL_K_driver_update = 336,          /* K_driver_update  */
+  YYSYMBOL_K_endconnectrules = 337,        /* K_endconnectrules  */
+  YYSYMBOL_K_enddiscipline = 338,          /* K_enddiscipline  */
+  YYSYMBOL_K_endnature = 339,              /* K_endnature  */
+  YYSYMBOL_K_endparamset = 340,            /* K_endparamset  */
+  YYSYMBOL_K_exclude = 341,                /* K_exclude  */
+  YYSYMBOL_K_exp = 342,                    /* K_exp  */
+  YYSYMBOL_K_final_step = 343,             /* K_final_step  */
+  YYSYMBOL_K_flicker_noise = 344,          /* K_flicker_noise  */
+  YYSYMBOL_K_floor = 345,                  /* K_floor  */
+  YYSYMBOL_K_flow = 346,                   /* K_flow  */
+  YYSYMBOL_K_from = 347,                   /* K_from  */
+  YYSYMBOL_K_ground = 348,                 /* K_ground  */
+  YYSYMBOL_K_hypot = 349,                  /* K_hypot  */
+  YYSYMBOL_K_idt = 350,                    /* K_idt  */
+  YYSYMBOL_K_idtmod = 351,                 /* K_idtmod  */
+  YYSYMBOL_K_idt_nature = 352,             /* K_idt_nature  */
+  YYSYMBOL_K_inf = 353,                    /* K_inf  */
+  YYSYMBOL_K_initial_step = 354,           /* K_initial_step  */
+  YYSYMBOL_K_laplace_nd = 355,             /* K_laplace_nd  */
+  YYSYMBOL_K_laplace_np = 356,             /* K_laplace_np  */
+  YYSYMBOL_K_laplace_zd = 357,             /* K_laplace_zd  */
+  YYSYMBOL_K_laplace_zp = 358,             /* K_laplace_zp  */
+  YYSYMBOL_K_last_crossing = 359,          /* K_last_crossing  */
+  YYSYMBOL_K_limexp = 360,                 /* K_limexp  */
+  YYSYMBOL_K_ln = 361,                     /* K_ln  */
+  YYSYMBOL_K_log = 362,                    /* K_log  */
+  YYSYMBOL_K_max = 363,                    /* K_max  */
+  YYSYMBOL_K_merged = 364,                 /* K_merged  */
+  YYSYMBOL_K_min = 365,                    /* K_min  */
+  YYSYMBOL_K_nature = 366,                 /* K_nature  */
+  YYSYMBOL_K_net_resolution = 367,         /* K_net_resolution  */
+  YYSYMBOL_K_noise_table = 368,            /* K_noise_table  */
+  YYSYMBOL_K_paramset = 369,               /* K_paramset  */
+  YYSYMBOL_K_potential = 370,              /* K_potential  */
+  YYSYMBOL_K_pow = 371,                    /* K_pow  */
+  YYSYMBOL_K_resolveto = 372,              /* K_resolveto  */
+  YYSYMBOL_K_sin = 373,                    /* K_sin  */
+  YYSYMBOL_K_sinh = 374,                   /* K_sinh  */
+  YYSYMBOL_K_slew = 375,                   /* K_slew  */
+  YYSYMBOL_K_split = 376,                  /* K_split  */
+  YYSYMBOL_K_sqrt = 377,                   /* K_sqrt  */
+  YYSYMBOL_K_tan = 378,                    /* K_tan  */
+  YYSYMBOL_K_tanh = 379,                   /* K_tanh  */
+  YYSYMBOL_K_timer = 380,                  /* K_timer  */
+  YYSYMBOL_K_transition = 381,             /* K_transition  */
+  YYSYMBOL_K_units = 382,                  /* K_units  */
+  YYSYMBOL_K_white_noise = 383,            /* K_white_noise  */
+  YYSYMBOL_K_wreal = 384,                  /* K_wreal  */
+  YYSYMBOL_K_zi_nd = 385,                  /* K_zi_nd  */
+  YYSYMBOL_K_zi_np = 386,                  /* K_zi_np  */
+  YYSYMBOL_K_zi_zd = 387,                  /* K_zi_zd  */
+  YYSYMBOL_K_zi_zp = 388,                  /* K_zi_zp  */
+  YYSYMBOL_K_TAND = 389,                   /* K_TAND  */
+  YYSYMBOL_K_MUL_EQ = 390,                 /* K_MUL_EQ  */
+  YYSYMBOL_K_DIV_EQ = 391,                 /* K_DIV_EQ  */
+  YYSYMBOL_K_MOD_EQ = 392,                 /* K_MOD_EQ  */
+  YYSYMBOL_K_AND_EQ = 393,                 /* K_AND_EQ  */
+  YYSYMBOL_K_OR_EQ = 394,                  /* K_OR_EQ  */
+  YYSYMBOL_K_XOR_EQ = 395,                 /* K_XOR_EQ  */
+  YYSYMBOL_K_LS_EQ = 396,                  /* K_LS_EQ  */
+  YYSYMBOL_K_RS_EQ = 397,                  /* K_RS_EQ  */
+  YYSYMBOL_K_RSS_EQ = 398,                 /* K_RSS_EQ  */
+  YYSYMBOL_399_ = 399,                     /* '?'  */
+  YYSYMBOL_400_ = 400,                     /* ':'  */
+  YYSYMBOL_401_ = 401,                     /* '|'  */
+  YYSYMBOL_402_ = 402,                     /* '^'  */
+  YYSYMBOL_403_ = 403,                     /* '&'  */
+  YYSYMBOL_404_ = 404,                     /* '<'  */
+  YYSYMBOL_405_ = 405,                     /* '>'  */
+  YYSYMBOL_406_ = 406,                     /* '+'  */
+  YYSYMBOL_407_ = 407,                     /* '-'  */
+  YYSYMBOL_408_ = 408,                     /* '*'  */
+  YYSYMBOL_409_ = 409,                     /* '/'  */
+  YYSYMBOL_410_ = 410,                     /* '%'  */
+  YYSYMBOL_UNARY_PREC = 411,               /* UNARY_PREC  */
+  YYSYMBOL_less_than_K_else = 412,         /* less_than_K_else  */
+  YYSYMBOL_413_ = 413,                     /* '('  */
+  YYSYMBOL_414_ = 414,                     /* '}'  */
+  YYSYMBOL_415_ = 415,                     /* ';'  */
+  YYSYMBOL_416_ = 416,                     /* ')'  */
+  YYSYMBOL_417_ = 417,                     /* '.'  */
+  YYSYMBOL_418_ = 418,                     /* '{'  */
+  YYSYMBOL_419_ = 419,                     /* '['  */
+  YYSYMBOL_420_ = 420,                     /* ']'  */
+  YYSYMBOL_421_ = 421,                     /* ','  */
+  YYSYMBOL_422_ = 422,                     /* '='  */
+  YYSYMBOL_423_ = 423,                     /* '$'  */
+  YYSYMBOL_424_ = 424,                     /* '#'  */
+  YYSYMBOL_425_ = 425,                     /* '@'  */
+  YYSYMBOL_426_ = 426,                     /* '~'  */
+  YYSYMBOL_427_ = 427,                     /* '!'  */
+  YYSYMBOL_428_ = 428,                     /* '\''  */
+  YYSYMBOL_429_0_ = 429,                   /* '0'  */
+  YYSYMBOL_430_1_ = 430,                   /* '1'  */
+  YYSYMBOL_431_x_ = 431,                   /* 'x'  */
+  YYSYMBOL_432_b_ = 432,                   /* 'b'  */
+  YYSYMBOL_433_f_ = 433,                   /* 'f'  */
+  YYSYMBOL_434_F_ = 434,                   /* 'F'  */
+  YYSYMBOL_435_l_ = 435,                   /* 'l'  */
+  YYSYMBOL_436_h_ = 436,                   /* 'h'  */
+  YYSYMBOL_437_B_ = 437,                   /* 'B'  */
+  YYSYMBOL_438_r_ = 438,                   /* 'r'  */
+  YYSYMBOL_439_R_ = 439,                   /* 'R'  */
+  YYSYMBOL_440_M_ = 440,                   /* 'M'  */
+  YYSYMBOL_441_n_ = 441,                   /* 'n'  */
+  YYSYMBOL_442_N_ = 442,                   /* 'N'  */
+  YYSYMBOL_443_p_ = 443,                   /* 'p'  */
+  YYSYMBOL_444_P_ = 444,                   /* 'P'  */
+  YYSYMBOL_445_Q_ = 445,                   /* 'Q'  */
+  YYSYMBOL_446_q_ = 446,                   /* 'q'  */
+  YYSYMBOL_447___ = 447,                   /* '_'  */
+  YYSYMBOL_YYACCEPT = 448,                 /* $accept  */
+  YYSYMBOL_source_text = 449,              /* source_text  */
+  YYSYMBOL_assignment_pattern = 450,       /* assignment_pattern  */
+  YYSYMBOL_class_declaration = 451,        /* class_declaration  */
+  YYSYMBOL_452_1 = 452,                    /* $@1  */
+  YYSYMBOL_453_2 = 453,                    /* $@2  */
+  YYSYMBOL_class_constraint = 454,         /* class_constraint  */
+  YYSYMBOL_class_identifier = 455,         /* class_identifier  */
+  YYSYMBOL_class_declaration_endname_opt = 456, /* class_declaration_endname_opt  */
+  YYSYMBOL_class_declaration_extends_opt = 457, /* class_declaration_extends_opt  */
+  YYSYMBOL_class_items_opt = 458,          /* class_items_opt  */
+  YYSYMBOL_class_items = 459,              /* class_items  */
+  YYSYMBOL_class_item = 460,               /* class_item  */
+  YYSYMBOL_class_item_qualifier = 461,     /* class_item_qualifier  */
+  YYSYMBOL_class_new = 462,                /* class_new  */
+  YYSYMBOL_constraint_block_item = 463,    /* constraint_block_item  */
+  YYSYMBOL_constraint_block_item_list = 464, /* constraint_block_item_list  */
+  YYSYMBOL_constraint_block_item_list_opt = 465, /* constraint_block_item_list_opt  */
+  YYSYMBOL_constraint_declaration = 466,   /* constraint_declaration  */
+  YYSYMBOL_constraint_expression = 467,    /* constraint_expression  */
+  YYSYMBOL_constraint_expression_list = 468, /* constraint_expression_list  */
+  YYSYMBOL_constraint_prototype = 469,     /* constraint_prototype  */
+  YYSYMBOL_constraint_set = 470,           /* constraint_set  */
+  YYSYMBOL_data_type = 471,                /* data_type  */
+  YYSYMBOL_data_type_or_implicit = 472,    /* data_type_or_implicit  */
+  YYSYMBOL_description = 473,              /* description  */
+  YYSYMBOL_description_list = 474,         /* description_list  */
+  YYSYMBOL_endnew_opt = 475,               /* endnew_opt  */
+  YYSYMBOL_dynamic_array_new = 476,        /* dynamic_array_new  */
+  YYSYMBOL_for_step = 477,                 /* for_step  */
+  YYSYMBOL_function_declaration = 478,     /* function_declaration  */
+  YYSYMBOL_479_3 = 479,                    /* $@3  */
+  YYSYMBOL_480_4 = 480,                    /* $@4  */
+  YYSYMBOL_481_5 = 481,                    /* $@5  */
+  YYSYMBOL_482_6 = 482,                    /* $@6  */
+  YYSYMBOL_483_7 = 483,                    /* $@7  */
+  YYSYMBOL_implicit_class_handle = 484,    /* implicit_class_handle  */
+  YYSYMBOL_inc_or_dec_expression = 485,    /* inc_or_dec_expression  */
+  YYSYMBOL_inside_expression = 486,        /* inside_expression  */
+  YYSYMBOL_integer_vector_type = 487,      /* integer_vector_type  */
+  YYSYMBOL_join_keyword = 488,             /* join_keyword  */
+  YYSYMBOL_jump_statement = 489,           /* jump_statement  */
+  YYSYMBOL_loop_statement = 490,           /* loop_statement  */
+  YYSYMBOL_list_of_variable_decl_assignments = 491, /* list_of_variable_decl_assignments  */
+  YYSYMBOL_variable_decl_assignment = 492, /* variable_decl_assignment  */
+  YYSYMBOL_loop_variables = 493,           /* loop_variables  */
+  YYSYMBOL_method_qualifier = 494,         /* method_qualifier  */
+  YYSYMBOL_method_qualifier_opt = 495,     /* method_qualifier_opt  */
+  YYSYMBOL_non_integer_type = 496,         /* non_integer_type  */
+  YYSYMBOL_number = 497,                   /* number  */
+  YYSYMBOL_open_range_list = 498,          /* open_range_list  */
+  YYSYMBOL_package_declaration = 499,      /* package_declaration  */
+  YYSYMBOL_500_8 = 500,                    /* $@8  */
+  YYSYMBOL_501_9 = 501,                    /* $@9  */
+  YYSYMBOL_package_import_declaration = 502, /* package_import_declaration  */
+  YYSYMBOL_package_import_item = 503,      /* package_import_item  */
+  YYSYMBOL_package_import_item_list = 504, /* package_import_item_list  */
+  YYSYMBOL_package_item = 505,             /* package_item  */
+  YYSYMBOL_package_item_list = 506,        /* package_item_list  */
+  YYSYMBOL_package_item_list_opt = 507,    /* package_item_list_opt  */
+  YYSYMBOL_port_direction = 508,           /* port_direction  */
+  YYSYMBOL_port_direction_opt = 509,       /* port_direction_opt  */
+  YYSYMBOL_property_qualifier = 510,       /* property_qualifier  */
+  YYSYMBOL_property_qualifier_opt = 511,   /* property_qualifier_opt  */
+  YYSYMBOL_property_qualifier_list = 512,  /* property_qualifier_list  */
+  YYSYMBOL_random_qualifier = 513,         /* random_qualifier  */
+  YYSYMBOL_real_or_realtime = 514,         /* real_or_realtime  */
+  YYSYMBOL_signing = 515,                  /* signing  */
+  YYSYMBOL_statement = 516,                /* statement  */
+  YYSYMBOL_statement_or_null = 517,        /* statement_or_null  */
+  YYSYMBOL_stream_expression = 518,        /* stream_expression  */
+  YYSYMBOL_stream_expression_list = 519,   /* stream_expression_list  */
+  YYSYMBOL_stream_operator = 520,          /* stream_operator  */
+  YYSYMBOL_streaming_concatenation = 521,  /* streaming_concatenation  */
+  YYSYMBOL_task_declaration = 522,         /* task_declaration  */
+  YYSYMBOL_523_10 = 523,                   /* $@10  */
+  YYSYMBOL_524_11 = 524,                   /* $@11  */
+  YYSYMBOL_525_12 = 525,                   /* $@12  */
+  YYSYMBOL_526_13 = 526,                   /* $@13  */
+  YYSYMBOL_527_14 = 527,                   /* $@14  */
+  YYSYMBOL_528_15 = 528,                   /* $@15  */
+  YYSYMBOL_529_16 = 529,                   /* $@16  */
+  YYSYMBOL_tf_port_declaration = 530,      /* tf_port_declaration  */
+  YYSYMBOL_tf_port_item = 531,             /* tf_port_item  */
+  YYSYMBOL_tf_port_item_expr_opt = 532,    /* tf_port_item_expr_opt  */
+  YYSYMBOL_tf_port_list = 533,             /* tf_port_list  */
+  YYSYMBOL_timeunits_declaration = 534,    /* timeunits_declaration  */
+  YYSYMBOL_value_range = 535,              /* value_range  */
+  YYSYMBOL_variable_dimension = 536,       /* variable_dimension  */
+  YYSYMBOL_attribute_list_opt = 537,       /* attribute_list_opt  */
+  YYSYMBOL_attribute_instance_list = 538,  /* attribute_instance_list  */
+  YYSYMBOL_attribute_list = 539,           /* attribute_list  */
+  YYSYMBOL_attribute = 540,                /* attribute  */
+  YYSYMBOL_block_item_decl = 541,          /* block_item_decl  */
+  YYSYMBOL_block_item_decls = 542,         /* block_item_decls  */
+  YYSYMBOL_block_item_decls_opt = 543,     /* block_item_decls_opt  */
+  YYSYMBOL_type_declaration = 544,         /* type_declaration  */
+  YYSYMBOL_enum_data_type = 545,           /* enum_data_type  */
+  YYSYMBOL_enum_name_list = 546,           /* enum_name_list  */
+  YYSYMBOL_pos_neg_number = 547,           /* pos_neg_number  */
+  YYSYMBOL_enum_name = 548,                /* enum_name  */
+  YYSYMBOL_struct_data_type = 549,         /* struct_data_type  */
+  YYSYMBOL_struct_union_member_list = 550, /* struct_union_member_list  */
+  YYSYMBOL_struct_union_member = 551,      /* struct_union_member  */
+  YYSYMBOL_case_item = 552,                /* case_item  */
+  YYSYMBOL_case_items = 553,               /* case_items  */
+  YYSYMBOL_charge_strength = 554,          /* charge_strength  */
+  YYSYMBOL_charge_strength_opt = 555,      /* charge_strength_opt  */
+  YYSYMBOL_defparam_assign = 556,          /* defparam_assign  */
+  YYSYMBOL_defparam_assign_list = 557,     /* defparam_assign_list  */
+  YYSYMBOL_delay1 = 558,                   /* delay1  */
+  YYSYMBOL_delay3 = 559,                   /* delay3  */
+  YYSYMBOL_delay3_opt = 560,               /* delay3_opt  */
+  YYSYMBOL_delay_value_list = 561,         /* delay_value_list  */
+  YYSYMBOL_delay_value = 562,              /* delay_value  */
+  YYSYMBOL_delay_value_simple = 563,       /* delay_value_simple  */
+  YYSYMBOL_optional_semicolon = 564,       /* optional_semicolon  */
+  YYSYMBOL_discipline_declaration = 565,   /* discipline_declaration  */
+  YYSYMBOL_566_17 = 566,                   /* $@17  */
+  YYSYMBOL_discipline_items = 567,         /* discipline_items  */
+  YYSYMBOL_discipline_item = 568,          /* discipline_item  */
+  YYSYMBOL_nature_declaration = 569,       /* nature_declaration  */
+  YYSYMBOL_570_18 = 570,                   /* $@18  */
+  YYSYMBOL_nature_items = 571,             /* nature_items  */
+  YYSYMBOL_nature_item = 572,              /* nature_item  */
+  YYSYMBOL_config_declaration = 573,       /* config_declaration  */
+  YYSYMBOL_lib_cell_identifiers = 574,     /* lib_cell_identifiers  */
+  YYSYMBOL_list_of_config_rule_statements = 575, /* list_of_config_rule_statements  */
+  YYSYMBOL_config_rule_statement = 576,    /* config_rule_statement  */
+  YYSYMBOL_opt_config = 577,               /* opt_config  */
+  YYSYMBOL_lib_cell_id = 578,              /* lib_cell_id  */
+  YYSYMBOL_list_of_libraries = 579,        /* list_of_libraries  */
+  YYSYMBOL_drive_strength = 580,           /* drive_strength  */
+  YYSYMBOL_drive_strength_opt = 581,       /* drive_strength_opt  */
+  YYSYMBOL_dr_strength0 = 582,             /* dr_strength0  */
+  YYSYMBOL_dr_strength1 = 583,             /* dr_strength1  */
+  YYSYMBOL_event_control = 584,            /* event_control  */
+  YYSYMBOL_event_expression_list = 585,    /* event_expression_list  */
+  YYSYMBOL_event_expression = 586,         /* event_expression  */
+  YYSYMBOL_branch_probe_expression = 587,  /* branch_probe_expression  */
+  YYSYMBOL_expression = 588,               /* expression  */
+  YYSYMBOL_expr_mintypmax = 589,           /* expr_mintypmax  */
+  YYSYMBOL_expression_list_with_nuls = 590, /* expression_list_with_nuls  */
+  YYSYMBOL_expression_list_proper = 591,   /* expression_list_proper  */
+  YYSYMBOL_expr_primary = 592,             /* expr_primary  */
+  YYSYMBOL_function_item_list_opt = 593,   /* function_item_list_opt  */
+  YYSYMBOL_function_item_list = 594,       /* function_item_list  */
+  YYSYMBOL_function_item = 595,            /* function_item  */
+  YYSYMBOL_gate_instance = 596,            /* gate_instance  */
+  YYSYMBOL_gate_instance_list = 597,       /* gate_instance_list  */
+  YYSYMBOL_gatetype = 598,                 /* gatetype  */
+  YYSYMBOL_switchtype = 599,               /* switchtype  */
+  YYSYMBOL_hierarchy_identifier = 600,     /* hierarchy_identifier  */
+  YYSYMBOL_list_of_identifiers = 601,      /* list_of_identifiers  */
+  YYSYMBOL_list_of_port_identifiers = 602, /* list_of_port_identifiers  */
+  YYSYMBOL_list_of_ports = 603,            /* list_of_ports  */
+  YYSYMBOL_list_of_port_declarations = 604, /* list_of_port_declarations  */
+  YYSYMBOL_port_declaration = 605,         /* port_declaration  */
+  YYSYMBOL_net_type_opt = 606,             /* net_type_opt  */
+  YYSYMBOL_unsigned_signed_opt = 607,      /* unsigned_signed_opt  */
+  YYSYMBOL_signed_unsigned_opt = 608,      /* signed_unsigned_opt  */
+  YYSYMBOL_atom2_type = 609,               /* atom2_type  */
+  YYSYMBOL_lpvalue = 610,                  /* lpvalue  */
+  YYSYMBOL_cont_assign = 611,              /* cont_assign  */
+  YYSYMBOL_cont_assign_list = 612,         /* cont_assign_list  */
+  YYSYMBOL_local_timeunit_prec_decl_opt = 613, /* local_timeunit_prec_decl_opt  */
+  YYSYMBOL_local_timeunit_prec_decl = 614, /* local_timeunit_prec_decl  */
+  YYSYMBOL_module = 615,                   /* module  */
+  YYSYMBOL_616_19 = 616,                   /* $@19  */
+  YYSYMBOL_617_20 = 617,                   /* $@20  */
+  YYSYMBOL_618_21 = 618,                   /* $@21  */
+  YYSYMBOL_619_22 = 619,                   /* $@22  */
+  YYSYMBOL_module_start = 620,             /* module_start  */
+  YYSYMBOL_module_end = 621,               /* module_end  */
+  YYSYMBOL_endname_opt = 622,              /* endname_opt  */
+  YYSYMBOL_module_attribute_foreign = 623, /* module_attribute_foreign  */
+  YYSYMBOL_module_port_list_opt = 624,     /* module_port_list_opt  */
+  YYSYMBOL_module_parameter_port_list_opt = 625, /* module_parameter_port_list_opt  */
+  YYSYMBOL_module_parameter_port_list = 626, /* module_parameter_port_list  */
+  YYSYMBOL_module_item = 627,              /* module_item  */
+  YYSYMBOL_628_23 = 628,                   /* $@23  */
+  YYSYMBOL_629_24 = 629,                   /* $@24  */
+  YYSYMBOL_630_25 = 630,                   /* $@25  */
+  YYSYMBOL_631_26 = 631,                   /* $@26  */
+  YYSYMBOL_632_27 = 632,                   /* $@27  */
+  YYSYMBOL_generate_if = 633,              /* generate_if  */
+  YYSYMBOL_generate_case_items = 634,      /* generate_case_items  */
+  YYSYMBOL_generate_case_item = 635,       /* generate_case_item  */
+  YYSYMBOL_636_28 = 636,                   /* $@28  */
+  YYSYMBOL_637_29 = 637,                   /* $@29  */
+  YYSYMBOL_module_item_list = 638,         /* module_item_list  */
+  YYSYMBOL_module_item_list_opt = 639,     /* module_item_list_opt  */
+  YYSYMBOL_generate_block = 640,           /* generate_block  */
+  YYSYMBOL_generate_block_opt = 641,       /* generate_block_opt  */
+  YYSYMBOL_net_decl_assign = 642,          /* net_decl_assign  */
+  YYSYMBOL_net_decl_assigns = 643,         /* net_decl_assigns  */
+  YYSYMBOL_bit_logic = 644,                /* bit_logic  */
+  YYSYMBOL_net_type = 645,                 /* net_type  */
+  YYSYMBOL_var_type = 646,                 /* var_type  */
+  YYSYMBOL_param_type = 647,               /* param_type  */
+  YYSYMBOL_parameter_assign_list = 648,    /* parameter_assign_list  */
+  YYSYMBOL_localparam_assign_list = 649,   /* localparam_assign_list  */
+  YYSYMBOL_parameter_assign = 650,         /* parameter_assign  */
+  YYSYMBOL_localparam_assign = 651,        /* localparam_assign  */
+  YYSYMBOL_parameter_value_ranges_opt = 652, /* parameter_value_ranges_opt  */
+  YYSYMBOL_parameter_value_ranges = 653,   /* parameter_value_ranges  */
+  YYSYMBOL_parameter_value_range = 654,    /* parameter_value_range  */
+  YYSYMBOL_value_range_expression = 655,   /* value_range_expression  */
+  YYSYMBOL_from_exclude = 656,             /* from_exclude  */
+  YYSYMBOL_parameter_value_opt = 657,      /* parameter_value_opt  */
+  YYSYMBOL_parameter_value_byname = 658,   /* parameter_value_byname  */
+  YYSYMBOL_parameter_value_byname_list = 659, /* parameter_value_byname_list  */
+  YYSYMBOL_port = 660,                     /* port  */
+  YYSYMBOL_port_opt = 661,                 /* port_opt  */
+  YYSYMBOL_port_name = 662,                /* port_name  */
+  YYSYMBOL_port_name_list = 663,           /* port_name_list  */
+  YYSYMBOL_port_reference = 664,           /* port_reference  */
+  YYSYMBOL_port_reference_list = 665,      /* port_reference_list  */
+  YYSYMBOL_range = 666,                    /* range  */
+  YYSYMBOL_range_opt = 667,                /* range_opt  */
+  YYSYMBOL_dimensions_opt = 668,           /* dimensions_opt  */
+  YYSYMBOL_dimensions = 669,               /* dimensions  */
+  YYSYMBOL_function_range_or_type_opt = 670, /* function_range_or_type_opt  */
+  YYSYMBOL_register_variable = 671,        /* register_variable  */
+  YYSYMBOL_register_variable_list = 672,   /* register_variable_list  */
+  YYSYMBOL_net_variable = 673,             /* net_variable  */
+  YYSYMBOL_net_variable_list = 674,        /* net_variable_list  */
+  YYSYMBOL_specify_item = 675,             /* specify_item  */
+  YYSYMBOL_specify_item_list = 676,        /* specify_item_list  */
+  YYSYMBOL_specify_edge_path_decl = 677,   /* specify_edge_path_decl  */
+  YYSYMBOL_edge_operator = 678,            /* edge_operator  */
+  YYSYMBOL_specify_edge_path = 679,        /* specify_edge_path  */
+  YYSYMBOL_polarity_operator = 680,        /* polarity_operator  */
+  YYSYMBOL_specify_simple_path_decl = 681, /* specify_simple_path_decl  */
+  YYSYMBOL_specify_simple_path = 682,      /* specify_simple_path  */
+  YYSYMBOL_specify_path_identifiers = 683, /* specify_path_identifiers  */
+  YYSYMBOL_specparam = 684,                /* specparam  */
+  YYSYMBOL_specparam_list = 685,           /* specparam_list  */
+  YYSYMBOL_specparam_decl = 686,           /* specparam_decl  */
+  YYSYMBOL_687_30 = 687,                   /* $@30  */
+  YYSYMBOL_spec_polarity = 688,            /* spec_polarity  */
+  YYSYMBOL_spec_reference_event = 689,     /* spec_reference_event  */
+  YYSYMBOL_edge_descriptor_list = 690,     /* edge_descriptor_list  */
+  YYSYMBOL_spec_notifier_opt = 691,        /* spec_notifier_opt  */
+  YYSYMBOL_spec_notifier = 692,            /* spec_notifier  */
+  YYSYMBOL_statement_item = 693,           /* statement_item  */
+  YYSYMBOL_694_31 = 694,                   /* $@31  */
+  YYSYMBOL_695_32 = 695,                   /* $@32  */
+  YYSYMBOL_compressed_statement = 696,     /* compressed_statement  */
+  YYSYMBOL_statement_or_null_list_opt = 697, /* statement_or_null_list_opt  */
+  YYSYMBOL_statement_or_null_list = 698,   /* statement_or_null_list  */
+  YYSYMBOL_analog_statement = 699,         /* analog_statement  */
+  YYSYMBOL_task_item = 700,                /* task_item  */
+  YYSYMBOL_task_item_list = 701,           /* task_item_list  */
+  YYSYMBOL_task_item_list_opt = 702,       /* task_item_list_opt  */
+  YYSYMBOL_tf_port_list_opt = 703,         /* tf_port_list_opt  */
+  YYSYMBOL_udp_body = 704,                 /* udp_body  */
+  YYSYMBOL_705_33 = 705,                   /* $@33  */
+  YYSYMBOL_udp_entry_list = 706,           /* udp_entry_list  */
+  YYSYMBOL_udp_comb_entry = 707,           /* udp_comb_entry  */
+  YYSYMBOL_udp_comb_entry_list = 708,      /* udp_comb_entry_list  */
+  YYSYMBOL_udp_sequ_entry_list = 709,      /* udp_sequ_entry_list  */
+  YYSYMBOL_udp_sequ_entry = 710,           /* udp_sequ_entry  */
+  YYSYMBOL_udp_initial = 711,              /* udp_initial  */
+  YYSYMBOL_udp_init_opt = 712,             /* udp_init_opt  */
+  YYSYMBOL_udp_input_list = 713,           /* udp_input_list  */
+  YYSYMBOL_udp_input_sym = 714,            /* udp_input_sym  */
+  YYSYMBOL_udp_output_sym = 715,           /* udp_output_sym  */
+  YYSYMBOL_udp_port_decl = 716,            /* udp_port_decl  */
+  YYSYMBOL_udp_port_decls = 717,           /* udp_port_decls  */
+  YYSYMBOL_udp_port_list = 718,            /* udp_port_list  */
+  YYSYMBOL_udp_reg_opt = 719,              /* udp_reg_opt  */
+  YYSYMBOL_udp_initial_expr_opt = 720,     /* udp_initial_expr_opt  */
+  YYSYMBOL_udp_input_declaration_list = 721, /* udp_input_declaration_list  */
+  YYSYMBOL_udp_primitive = 722,            /* udp_primitive  */
+  YYSYMBOL_K_automatic_opt = 723,          /* K_automatic_opt  */
+  YYSYMBOL_K_packed_opt = 724,             /* K_packed_opt  */
+  YYSYMBOL_K_reg_opt = 725,                /* K_reg_opt  */
+  YYSYMBOL_K_static_opt = 726,             /* K_static_opt  */
+  YYSYMBOL_K_virtual_opt = 727             /* K_virtual_opt  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
+
+
+
+#ifdef short
+# undef short
+#endif
+
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
+
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
+#else
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
+#endif
+
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
+#else
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
+#endif
+
+#ifndef YYSIZE_T
+# ifdef __SIZE_TYPE__
+#  define YYSIZE_T __SIZE_TYPE__
+# elif defined size_t
+#  define YYSIZE_T size_t
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYSIZE_T size_t
+# else
+#  define YYSIZE_T unsigned
+# endif
+#endif
+
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
+#endif
+
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
+
+# ifdef YYSTACK_USE_ALLOCA
+#  if YYSTACK_USE_ALLOCA
+#   ifdef __GNUC__
+#    define YYSTACK_ALLOC __builtin_alloca
+#   elif defined __BUILTIN_VA_ARG_INCR
+#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
+#   elif defined _AIX
+#    define YYSTACK_ALLOC __alloca
+#   elif defined _MSC_VER
+#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
+#    define alloca _alloca
+#   else
+#    define YYSTACK_ALLOC alloca
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
+#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
+#     endif
+#    endif
+#   endif
+#  endif
+# endif
+
+# ifdef YYSTACK_ALLOC
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+    /* The OS might guarantee only one guard page at the bottom of the stack,
+       and a page size can be as small as 4096 bytes.  So we cannot safely
+       invoke alloca (N) if N exceeds 4096.  Use a slightly smaller number
+       to allow for a few compiler-allocated temporary stack slots.  */
+#   define YYSTACK_ALLOC_MAXIMUM 4032 /* reasonable circa 2006 */
+#  endif
+# else
+#  define YYSTACK_ALLOC YYMALLOC
+#  define YYSTACK_FREE YYFREE
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+#   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
+#  endif
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
+       && ! ((defined YYMALLOC || defined malloc) \
+             && (defined YYFREE || defined free)))
+#   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
+#   endif
+#  endif
+#  ifndef YYMALLOC
+#   define YYMALLOC malloc
+#   if ! defined malloc && ! defined EXIT_SUCCESS
+void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+#  ifndef YYFREE
+#   define YYFREE free
+#   if ! defined free && ! defined EXIT_SUCCESS
+void free (void *); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+# endif
+#endif /* !defined yyoverflow */
+
+#if (! defined yyoverflow \
+     && (! defined __cplusplus \
+         || (defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL \
+             && defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+
+/* A type that is properly aligned for any stack member.  */
+union yyalloc
+{
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+  YYLTYPE yyls_alloc;
+};
+
+/* The size of the maximum gap between one aligned stack and the next.  */
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
+
+/* The size of an array large to enough to hold all stacks, each with
+   N elements.  */
+# define YYSTACK_BYTES(N) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE) \
+             + YYSIZEOF (YYLTYPE)) \
+      + 2 * YYSTACK_GAP_MAXIMUM)
+
+# define YYCOPY_NEEDED 1
+
+/* Relocate STACK from its old location to the new one.  The
+   local variables YYSIZE and YYSTACKSIZE give the old and new number of
+   elements in the stack, and YYPTR gives the new location of the
+   stack.  Advance YYPTR to a properly aligned location for the next
+   stack.  */
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
+
+#endif
+
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
+/* YYFINAL -- State number of the termination state.  */
+#define YYFINAL  34
+/* YYLAST -- Last index in YYTABLE.  */
+#define YYLAST   17793
+
+/* YYNTOKENS -- Number of terminals.  */
+#define YYNTOKENS  448
+/* YYNNTS -- Number of nonterminals.  */
+#define YYNNTS  280
+/* YYNRULES -- Number of rules.  */
+#define YYNRULES  984
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  2242
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   655
+
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_int16 yytranslate[] =
+{
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,   427,     2,   424,   423,   410,   403,   428,
+     413,   416,   408,   406,   421,   407,   417,   409,   429,   430,
+       2,     2,     2,     2,     2,     2,     2,     2,   400,   415,
+     404,   422,   405,   399,   425,     2,   437,     2,     2,     2,
+     434,     2,     2,     2,     2,     2,     2,   440,   442,     2,
+     444,   445,   439,     2,     2,     2,     2,     2,     2,     2,
+       2,   419,     2,   420,   402,   447,     2,     2,   432,     2,
+       2,     2,   433,     2,   436,     2,     2,     2,   435,     2,
+     441,     2,   443,   446,   438,     2,     2,     2,     2,     2,
+     431,     2,     2,   418,   401,   414,   426,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
+      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
+      95,    96,    97,    98,    99,   100,   101,   102,   103,   104,
+     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
+     115,   116,   117,   118,   119,   120,   121,   122,   123,   124,
+     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
+     135,   136,   137,   138,   139,   140,   141,   142,   143,   144,
+     145,   146,   147,   148,   149,   150,   151,   152,   153,   154,
+     155,   156,   157,   158,   159,   160,   161,   162,   163,   164,
+     165,   166,   167,   168,   169,   170,   171,   172,   173,   174,
+     175,   176,   177,   178,   179,   180,   181,   182,   183,   184,
+     185,   186,   187,   188,   189,   190,   191,   192,   193,   194,
+     195,   196,   197,   198,   199,   200,   201,   202,   203,   204,
+     205,   206,   207,   208,   209,   210,   211,   212,   213,   214,
+     215,   216,   217,   218,   219,   220,   221,   222,   223,   224,
+     225,   226,   227,   228,   229,   230,   231,   232,   233,   234,
+     235,   236,   237,   238,   239,   240,   241,   242,   243,   244,
+     245,   246,   247,   248,   249,   250,   251,   252,   253,   254,
+     255,   256,   257,   258,   259,   260,   261,   262,   263,   264,
+     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
+     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
+     285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
+     295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
+     305,   306,   307,   308,   309,   310,   311,   312,   313,   314,
+     315,   316,   317,   318,   319,   320,   321,   322,   323,   324,
+     325,   326,   327,   328,   329,   330,   331,   332,   333,   334,
+     335,   336,   337,   338,   339,   340,   341,   342,   343,   344,
+     345,   346,   347,   348,   349,   350,   351,   352,   353,   354,
+     355,   356,   357,   358,   359,   360,   361,   362,   363,   364,
+     365,   366,   367,   368,   369,   370,   371,   372,   373,   374,
+     375,   376,   377,   378,   379,   380,   381,   382,   383,   384,
+     385,   386,   387,   388,   389,   390,   391,   392,   393,   394,
+     395,   396,   397,   398,   411,   412
+};
+
+#if YYDEBUG
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
+{
+       0,   634,   634,   634,   637,   643,   653,   659,   652,   672,
+     673,   677,   686,   699,   708,   711,   723,   726,   733,   734,
+     738,   739,   745,   757,   768,   773,   778,   786,   791,   796,
+     801,   806,   814,   815,   816,   820,   825,   829,   837,   841,
+     842,   846,   847,   851,   856,   861,   862,   863,   864,   865,
+     866,   870,   871,   875,   880,   881,   885,   897,   902,   904,
+     906,   911,   915,   929,   931,   937,   944,   957,   958,   959,
+     960,   961,   962,   963,   964,   973,   974,   980,   980,   986,
+     990,   999,  1004,  1006,  1017,  1022,  1016,  1041,  1048,  1040,
+    1072,  1071,  1096,  1097,  1107,  1112,  1117,  1122,  1130,  1137,
+    1138,  1139,  1140,  1144,  1146,  1148,  1153,  1157,  1161,  1170,
+    1177,  1183,  1189,  1195,  1201,  1211,  1217,  1223,  1228,  1233,
+    1242,  1247,  1255,  1265,  1272,  1283,  1289,  1298,  1299,  1303,
+    1304,  1309,  1310,  1311,  1314,  1316,  1318,  1321,  1323,  1330,
+    1331,  1336,  1340,  1335,  1356,  1361,  1366,  1373,  1374,  1378,
+    1379,  1380,  1381,  1382,  1386,  1387,  1390,  1390,  1393,  1394,
+    1395,  1396,  1410,  1411,  1419,  1420,  1424,  1425,  1429,  1430,
+    1434,  1435,  1441,  1442,  1446,  1447,  1451,  1461,  1463,  1468,
+    1472,  1473,  1477,  1478,  1482,  1502,  1508,  1501,  1534,  1541,
+    1533,  1564,  1570,  1563,  1598,  1597,  1621,  1632,  1641,  1650,
+    1671,  1697,  1720,  1770,  1780,  1781,  1786,  1800,  1805,  1809,
+    1813,  1825,  1827,  1832,  1834,  1839,  1845,  1859,  1865,  1883,
+    1884,  1888,  1889,  1890,  1891,  1902,  1908,  1918,  1925,  1948,
+    1952,  1959,  1963,  1967,  1971,  1972,  1976,  1981,  1986,  1991,
+    1995,  2002,  2003,  2007,  2008,  2014,  2022,  2030,  2032,  2034,
+    2036,  2052,  2061,  2070,  2079,  2088,  2097,  2109,  2112,  2121,
+    2124,  2132,  2137,  2144,  2152,  2157,  2164,  2175,  2182,  2193,
+    2198,  2206,  2214,  2222,  2233,  2240,  2245,  2250,  2257,  2263,
+    2271,  2272,  2273,  2277,  2278,  2282,  2289,  2290,  2294,  2298,
+    2303,  2311,  2316,  2321,  2327,  2337,  2338,  2342,  2347,  2355,
+    2359,  2365,  2376,  2386,  2392,  2415,  2415,  2419,  2418,  2425,
+    2426,  2430,  2432,  2434,  2436,  2442,  2441,  2449,  2450,  2454,
+    2456,  2457,  2459,  2461,  2466,  2477,  2479,  2483,  2484,  2488,
+    2489,  2491,  2493,  2494,  2498,  2499,  2503,  2505,  2510,  2511,
+    2516,  2520,  2524,  2528,  2532,  2536,  2543,  2544,  2548,  2549,
+    2550,  2551,  2555,  2556,  2557,  2558,  2562,  2570,  2576,  2583,
+    2585,  2591,  2600,  2607,  2614,  2628,  2630,  2635,  2637,  2639,
+    2641,  2643,  2648,  2653,  2658,  2663,  2668,  2673,  2678,  2683,
+    2688,  2693,  2698,  2703,  2708,  2713,  2718,  2723,  2728,  2733,
+    2738,  2743,  2748,  2753,  2758,  2763,  2768,  2773,  2778,  2783,
+    2788,  2793,  2798,  2803,  2808,  2813,  2818,  2823,  2828,  2833,
+    2838,  2846,  2848,  2895,  2900,  2906,  2910,  2918,  2923,  2931,
+    2937,  2942,  2947,  2958,  2965,  2972,  2978,  2985,  2995,  3007,
+    3012,  3020,  3027,  3034,  3041,  3048,  3055,  3062,  3069,  3076,
+    3083,  3090,  3097,  3104,  3111,  3118,  3125,  3132,  3139,  3146,
+    3153,  3160,  3171,  3177,  3183,  3191,  3196,  3202,  3209,  3220,
+    3232,  3247,  3251,  3254,  3267,  3268,  3272,  3274,  3290,  3292,
+    3299,  3309,  3324,  3335,  3353,  3364,  3380,  3393,  3408,  3416,
+    3425,  3426,  3427,  3428,  3429,  3430,  3431,  3432,  3433,  3434,
+    3435,  3436,  3440,  3441,  3442,  3443,  3444,  3445,  3446,  3447,
+    3448,  3449,  3450,  3451,  3461,  3466,  3472,  3481,  3491,  3501,
+    3517,  3519,  3524,  3526,  3528,  3530,  3552,  3558,  3566,  3572,
+    3577,  3598,  3603,  3611,  3627,  3645,  3661,  3679,  3708,  3726,
+    3761,  3762,  3776,  3777,  3778,  3782,  3783,  3784,  3792,  3793,
+    3794,  3795,  3803,  3810,  3818,  3825,  3835,  3844,  3850,  3856,
+    3857,  3858,  3864,  3868,  3880,  3884,  3886,  3892,  3879,  3945,
+    3946,  3947,  3951,  3952,  3956,  3957,  3961,  3962,  3966,  3967,
+    3968,  3969,  3980,  3981,  3985,  3986,  3987,  3993,  3995,  4010,
+    4020,  4030,  4047,  4061,  4071,  4077,  4085,  4090,  4106,  4115,
+    4121,  4127,  4138,  4144,  4144,  4151,  4157,  4160,  4163,  4166,
+    4170,  4173,  4179,  4181,  4184,  4187,  4190,  4193,  4196,  4199,
+    4206,  4214,  4225,  4230,  4234,  4238,  4243,  4246,  4248,  4250,
+    4258,  4268,  4274,  4271,  4281,  4278,  4285,  4290,  4289,  4296,
+    4303,  4303,  4314,  4318,  4322,  4325,  4329,  4338,  4343,  4349,
+    4355,  4364,  4371,  4374,  4376,  4380,  4383,  4384,  4388,  4388,
+    4390,  4390,  4395,  4396,  4400,  4401,  4411,  4412,  4413,  4417,
+    4417,  4428,  4439,  4445,  4451,  4452,  4456,  4457,  4458,  4459,
+    4460,  4461,  4462,  4463,  4464,  4465,  4466,  4471,  4475,  4480,
+    4484,  4489,  4494,  4499,  4504,  4509,  4514,  4527,  4528,  4532,
+    4533,  4537,  4546,  4554,  4554,  4557,  4559,  4564,  4566,  4568,
+    4570,  4572,  4577,  4578,  4579,  4580,  4583,  4583,  4602,  4608,
+    4614,  4626,  4637,  4643,  4647,  4654,  4664,  4670,  4693,  4701,
+    4712,  4721,  4730,  4731,  4739,  4746,  4754,  4761,  4769,  4778,
+    4784,  4805,  4813,  4836,  4858,  4872,  4874,  4884,  4886,  4897,
+    4898,  4902,  4903,  4907,  4909,  4923,  4930,  4937,  4944,  4945,
+    4946,  4947,  4948,  4949,  4950,  4951,  4952,  4961,  4968,  4978,
+    4984,  4993,  5003,  5009,  5018,  5019,  5022,  5025,  5033,  5041,
+    5049,  5054,  5059,  5063,  5068,  5072,  5076,  5081,  5085,  5089,
+    5094,  5098,  5102,  5107,  5110,  5113,  5116,  5119,  5125,  5126,
+    5130,  5132,  5139,  5139,  5142,  5146,  5150,  5154,  5161,  5162,
+    5163,  5167,  5169,  5174,  5182,  5185,  5188,  5195,  5201,  5207,
+    5213,  5222,  5228,  5267,  5271,  5279,  5280,  5284,  5286,  5285,
+    5292,  5293,  5294,  5298,  5300,  5302,  5306,  5310,  5312,  5316,
+    5320,  5329,  5330,  5335,  5336,  5340,  5342,  5344,  5346,  5355,
+    5367,  5373,  5383,  5388,  5400,  5405,  5413,  5412,  5434,  5439,
+    5447,  5446,  5464,  5470,  5477,  5479,  5481,  5486,  5491,  5496,
+    5498,  5500,  5502,  5507,  5512,  5516,  5522,  5528,  5533,  5542,
+    5552,  5558,  5567,  5573,  5578,  5583,  5588,  5595,  5602,  5607,
+    5613,  5618,  5629,  5638,  5644,  5652,  5659,  5667,  5675,  5692,
+    5701,  5709,  5718,  5727,  5732,  5737,  5742,  5747,  5752,  5757,
+    5762,  5767,  5772,  5777,  5786,  5789,  5793,  5798,  5806,  5813,
+    5814,  5818,  5824,  5829,  5832,  5836,  5837,  5841,  5841,  5847,
+    5848,  5852,  5865,  5871,  5880,  5886,  5895,  5909,  5920,  5921,
+    5925,  5931,  5943,  5944,  5945,  5946,  5947,  5948,  5949,  5950,
+    5951,  5952,  5953,  5954,  5955,  5956,  5957,  5958,  5959,  5960,
+    5961,  5962,  5963,  5964,  5965,  5969,  5970,  5971,  5972,  5979,
+    5981,  5989,  5997,  6008,  6010,  6019,  6025,  6033,  6033,  6036,
+    6037,  6041,  6047,  6060,  6075,  6094,  6094,  6095,  6095,  6096,
+    6096,  6097,  6097,  6098,  6098
+};
+#endif
+
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
+/* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+   First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
+static const char *const yytname[] =
+{
+  "\"end of file\"", "error", "\"invalid token\"", "IDENTIFIER",
+  "SYSTEM_IDENTIFIER", "STRING", "TIME_LITERAL", "TYPE_IDENTIFIER",
+  "DISCIPLINE_IDENTIFIER", "PATHPULSE_IDENTIFIER", "BASED_NUMBER",
+  "DEC_NUMBER", "UNBASED_NUMBER", "REALTIME", "K_PLUS_EQ", "K_MINUS_EQ",
+  "K_INCR", "K_DECR", "K_LE", "K_GE", "K_EG", "K_EQ", "K_NE", "K_CEQ",
+  "K_CNE", "K_LP", "K_LS", "K_RS", "K_RSS", "K_SG", "K_CONTRIBUTE",
+  "K_PO_POS", "K_PO_NEG", "K_POW", "K_PSTAR", "K_STARP", "K_DOTSTAR",
+  "K_LOR", "K_LAND", "K_NAND", "K_NOR", "K_NXOR", "K_TRIGGER",
+  "K_SCOPE_RES", "K_edge_descriptor", "K_always", "K_and", "K_assign",
+  "K_begin", "K_buf", "K_bufif0", "K_bufif1", "K_case", "K_casex",
+  "K_casez", "K_cmos", "K_deassign", "K_default", "K_defparam",
+  "K_disable", "K_edge", "K_else", "K_end", "K_endcase", "K_endfunction",
+  "K_endmodule", "K_endprimitive", "K_endspecify", "K_endtable",
+  "K_endtask", "K_event", "K_for", "K_force", "K_forever", "K_fork",
+  "K_function", "K_highz0", "K_highz1", "K_if", "K_ifnone", "K_initial",
+  "K_inout", "K_input", "K_integer", "K_join", "K_large", "K_macromodule",
+  "K_medium", "K_module", "K_nand", "K_negedge", "K_nmos", "K_nor",
+  "K_not", "K_notif0", "K_notif1", "K_or", "K_output", "K_parameter",
+  "K_pmos", "K_posedge", "K_primitive", "K_pull0", "K_pull1", "K_pulldown",
+  "K_pullup", "K_rcmos", "K_real", "K_realtime", "K_reg", "K_release",
+  "K_repeat", "K_rnmos", "K_rpmos", "K_rtran", "K_rtranif0", "K_rtranif1",
+  "K_scalared", "K_small", "K_specify", "K_specparam", "K_strong0",
+  "K_strong1", "K_supply0", "K_supply1", "K_table", "K_task", "K_time",
+  "K_tran", "K_tranif0", "K_tranif1", "K_tri", "K_tri0", "K_tri1",
+  "K_triand", "K_trior", "K_trireg", "K_vectored", "K_wait", "K_wand",
+  "K_weak0", "K_weak1", "K_while", "K_wire", "K_wor", "K_xnor", "K_xor",
+  "K_Shold", "K_Snochange", "K_Speriod", "K_Srecovery", "K_Ssetup",
+  "K_Ssetuphold", "K_Sskew", "K_Swidth", "KK_attribute", "K_bool",
+  "K_logic", "K_automatic", "K_endgenerate", "K_generate", "K_genvar",
+  "K_localparam", "K_noshowcancelled", "K_pulsestyle_onevent",
+  "K_pulsestyle_ondetect", "K_showcancelled", "K_signed", "K_unsigned",
+  "K_Sfullskew", "K_Srecrem", "K_Sremoval", "K_Stimeskew", "K_cell",
+  "K_config", "K_design", "K_endconfig", "K_incdir", "K_include",
+  "K_instance", "K_liblist", "K_library", "K_use", "K_wone", "K_uwire",
+  "K_alias", "K_always_comb", "K_always_ff", "K_always_latch", "K_assert",
+  "K_assume", "K_before", "K_bind", "K_bins", "K_binsof", "K_bit",
+  "K_break", "K_byte", "K_chandle", "K_class", "K_clocking", "K_const",
+  "K_constraint", "K_context", "K_continue", "K_cover", "K_covergroup",
+  "K_coverpoint", "K_cross", "K_dist", "K_do", "K_endclass",
+  "K_endclocking", "K_endgroup", "K_endinterface", "K_endpackage",
+  "K_endprogram", "K_endproperty", "K_endsequence", "K_enum", "K_expect",
+  "K_export", "K_extends", "K_extern", "K_final", "K_first_match",
+  "K_foreach", "K_forkjoin", "K_iff", "K_ignore_bins", "K_illegal_bins",
+  "K_import", "K_inside", "K_int", "K_interface", "K_intersect",
+  "K_join_any", "K_join_none", "K_local", "K_longint", "K_matches",
+  "K_modport", "K_new", "K_null", "K_package", "K_packed", "K_priority",
+  "K_program", "K_property", "K_protected", "K_pure", "K_rand", "K_randc",
+  "K_randcase", "K_randsequence", "K_ref", "K_return", "K_sequence",
+  "K_shortint", "K_shortreal", "K_solve", "K_static", "K_string",
+  "K_struct", "K_super", "K_tagged", "K_this", "K_throughout",
+  "K_timeprecision", "K_timeunit", "K_type", "K_typedef", "K_union",
+  "K_unique", "K_var", "K_virtual", "K_void", "K_wait_order", "K_wildcard",
+  "K_with", "K_within", "K_timeprecision_check", "K_timeunit_check",
+  "K_accept_on", "K_checker", "K_endchecker", "K_eventually", "K_global",
+  "K_implies", "K_let", "K_nexttime", "K_reject_on", "K_restrict",
+  "K_s_always", "K_s_eventually", "K_s_nexttime", "K_s_until",
+  "K_s_until_with", "K_strong", "K_sync_accept_on", "K_sync_reject_on",
+  "K_unique0", "K_until", "K_until_with", "K_untyped", "K_weak", "K_above",
+  "K_abs", "K_absdelay", "K_abstol", "K_access", "K_acos", "K_acosh",
+  "K_ac_stim", "K_aliasparam", "K_analog", "K_analysis", "K_asin",
+  "K_asinh", "K_atan", "K_atan2", "K_atanh", "K_branch", "K_ceil",
+  "K_connect", "K_connectmodule", "K_connectrules", "K_continuous",
+  "K_cos", "K_cosh", "K_ddt", "K_ddt_nature", "K_ddx", "K_discipline",
+  "K_discrete", "K_domain", "K_driver_update", "K_endconnectrules",
+  "K_enddiscipline", "K_endnature", "K_endparamset", "K_exclude", "K_exp",
+  "K_final_step", "K_flicker_noise", "K_floor", "K_flow", "K_from",
+  "K_ground", "K_hypot", "K_idt", "K_idtmod", "K_idt_nature", "K_inf",
+  "K_initial_step", "K_laplace_nd", "K_laplace_np", "K_laplace_zd",
+  "K_laplace_zp", "K_last_crossing", "K_limexp", "K_ln", "K_log", "K_max",
+  "K_merged", "K_min", "K_nature", "K_net_resolution", "K_noise_table",
+  "K_paramset", "K_potential", "K_pow", "K_resolveto", "K_sin", "K_sinh",
+  "K_slew", "K_split", "K_sqrt", "K_tan", "K_tanh", "K_timer",
+  "K_transition", "K_units", "K_white_noise", "K_wreal", "K_zi_nd",
+  "K_zi_np", "K_zi_zd", "K_zi_zp", "K_TAND", "K_MUL_EQ", "K_DIV_EQ",
+  "K_MOD_EQ", "K_AND_EQ", "K_OR_EQ", "K_XOR_EQ", "K_LS_EQ", "K_RS_EQ",
+  "K_RSS_EQ", "'?'", "':'", "'|'", "'^'", "'&'", "'<'", "'>'", "'+'",
+  "'-'", "'*'", "'/'", "'%'", "UNARY_PREC", "less_than_K_else", "'('",
+  "'}'", "';'", "')'", "'.'", "'{'", "'['", "']'", "','", "'='", "'$'",
+  "'#'", "'@'", "'~'", "'!'", "'\\''", "'0'", "'1'", "'x'", "'b'", "'f'",
+  "'F'", "'l'", "'h'", "'B'", "'r'", "'R'", "'M'", "'n'", "'N'", "'p'",
+  "'P'", "'Q'", "'q'", "'_'", "$accept", "source_text",
+  "assignment_pattern", "class_declaration", "$@1", "$@2",
+  "class_constraint", "class_identifier", "class_declaration_endname_opt",
+  "class_declaration_extends_opt", "class_items_opt", "class_items",
+  "class_item", "class_item_qualifier", "class_new",
+  "constraint_block_item", "constraint_block_item_list",
+  "constraint_block_item_list_opt", "constraint_declaration",
+  "constraint_expression", "constraint_expression_list",
+  "constraint_prototype", "constraint_set", "data_type",
+  "data_type_or_implicit", "description", "description_list", "endnew_opt",
+  "dynamic_array_new", "for_step", "function_declaration", "$@3", "$@4",
+  "$@5", "$@6", "$@7", "implicit_class_handle", "inc_or_dec_expression",
+  "inside_expression", "integer_vector_type", "join_keyword",
+  "jump_statement", "loop_statement", "list_of_variable_decl_assignments",
+  "variable_decl_assignment", "loop_variables", "method_qualifier",
+  "method_qualifier_opt", "non_integer_type", "number", "open_range_list",
+  "package_declaration", "$@8", "$@9", "package_import_declaration",
+  "package_import_item", "package_import_item_list", "package_item",
+  "package_item_list", "package_item_list_opt", "port_direction",
+  "port_direction_opt", "property_qualifier", "property_qualifier_opt",
+  "property_qualifier_list", "random_qualifier", "real_or_realtime",
+  "signing", "statement", "statement_or_null", "stream_expression",
+  "stream_expression_list", "stream_operator", "streaming_concatenation",
+  "task_declaration", "$@10", "$@11", "$@12", "$@13", "$@14", "$@15",
+  "$@16", "tf_port_declaration", "tf_port_item", "tf_port_item_expr_opt",
+  "tf_port_list", "timeunits_declaration", "value_range",
+  "variable_dimension", "attribute_list_opt", "attribute_instance_list",
+  "attribute_list", "attribute", "block_item_decl", "block_item_decls",
+  "block_item_decls_opt", "type_declaration", "enum_data_type",
+  "enum_name_list", "pos_neg_number", "enum_name", "struct_data_type",
+  "struct_union_member_list", "struct_union_member", "case_item",
+  "case_items", "charge_strength", "charge_strength_opt",
+  "defparam_assign", "defparam_assign_list", "delay1", "delay3",
+  "delay3_opt", "delay_value_list", "delay_value", "delay_value_simple",
+  "optional_semicolon", "discipline_declaration", "$@17",
+  "discipline_items", "discipline_item", "nature_declaration", "$@18",
+  "nature_items", "nature_item", "config_declaration",
+  "lib_cell_identifiers", "list_of_config_rule_statements",
+  "config_rule_statement", "opt_config", "lib_cell_id",
+  "list_of_libraries", "drive_strength", "drive_strength_opt",
+  "dr_strength0", "dr_strength1", "event_control", "event_expression_list",
+  "event_expression", "branch_probe_expression", "expression",
+  "expr_mintypmax", "expression_list_with_nuls", "expression_list_proper",
+  "expr_primary", "function_item_list_opt", "function_item_list",
+  "function_item", "gate_instance", "gate_instance_list", "gatetype",
+  "switchtype", "hierarchy_identifier", "list_of_identifiers",
+  "list_of_port_identifiers", "list_of_ports", "list_of_port_declarations",
+  "port_declaration", "net_type_opt", "unsigned_signed_opt",
+  "signed_unsigned_opt", "atom2_type", "lpvalue", "cont_assign",
+  "cont_assign_list", "local_timeunit_prec_decl_opt",
+  "local_timeunit_prec_decl", "module", "$@19", "$@20", "$@21", "$@22",
+  "module_start", "module_end", "endname_opt", "module_attribute_foreign",
+  "module_port_list_opt", "module_parameter_port_list_opt",
+  "module_parameter_port_list", "module_item", "$@23", "$@24", "$@25",
+  "$@26", "$@27", "generate_if", "generate_case_items",
+  "generate_case_item", "$@28", "$@29", "module_item_list",
+  "module_item_list_opt", "generate_block", "generate_block_opt",
+  "net_decl_assign", "net_decl_assigns", "bit_logic", "net_type",
+  "var_type", "param_type", "parameter_assign_list",
+  "localparam_assign_list", "parameter_assign", "localparam_assign",
+  "parameter_value_ranges_opt", "parameter_value_ranges",
+  "parameter_value_range", "value_range_expression", "from_exclude",
+  "parameter_value_opt", "parameter_value_byname",
+  "parameter_value_byname_list", "port", "port_opt", "port_name",
+  "port_name_list", "port_reference", "port_reference_list", "range",
+  "range_opt", "dimensions_opt", "dimensions",
+  "function_range_or_type_opt", "register_variable",
+  "register_variable_list", "net_variable", "net_variable_list",
+  "specify_item", "specify_item_list", "specify_edge_path_decl",
+  "edge_operator", "specify_edge_path", "polarity_operator",
+  "specify_simple_path_decl", "specify_simple_path",
+  "specify_path_identifiers", "specparam", "specparam_list",
+  "specparam_decl", "$@30", "spec_polarity", "spec_reference_event",
+  "edge_descriptor_list", "spec_notifier_opt", "spec_notifier",
+  "statement_item", "$@31", "$@32", "compressed_statement",
+  "statement_or_null_list_opt", "statement_or_null_list",
+  "analog_statement", "task_item", "task_item_list", "task_item_list_opt",
+  "tf_port_list_opt", "udp_body", "$@33", "udp_entry_list",
+  "udp_comb_entry", "udp_comb_entry_list", "udp_sequ_entry_list",
+  "udp_sequ_entry", "udp_initial", "udp_init_opt", "udp_input_list",
+  "udp_input_sym", "udp_output_sym", "udp_port_decl", "udp_port_decls",
+  "udp_port_list", "udp_reg_opt", "udp_initial_expr_opt",
+  "udp_input_declaration_list", "udp_primitive", "K_automatic_opt",
+  "K_packed_opt", "K_reg_opt", "K_static_opt", "K_virtual_opt", YY_NULLPTR
+};
+
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
+#endif
+
+#define YYPACT_NINF (-2140)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-985)
+
+#define yytable_value_is_error(Yyn) \
+  0
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int16 yypact[] =
+{
+    1236,   350,    67,  -271,   262,   304,   417,   442,   364,   521,
+     553, -2140,  1768, -2140, -2140,   133,   601, -2140, -2140, -2140,
+   -2140, -2140,   255, -2140,    10, -2140,   232,   720,   276,   340,
+     353,   396,   407,   407, -2140, -2140, -2140, -2140, -2140,   827,
+     507,  9042, -2140,   905,   236,   419,   741, -2140, -2140, -2140,
+   -2140, -2140, -2140, -2140, -2140,    12,   877,   547, -2140, -2140,
+      45, -2140, -2140,    33,    33,  7383, 10497, 10497, 10497, -2140,
+   -2140, -2140,   559,   568,   584,   604,   655,   675,   687,   737,
+     775,   819,   822,   859,   892,   895,   917,   936,   963,   970,
+    1004,  1071,  1079,  1099,  1115,  1125, 10497,  9735, 10497, 10497,
+   10497,  9042,  5911,  9946,  9864, -2140,   636, -2140, -2140, -2140,
+     871, 15895, -2140,   138,  1015, -2140, -2140,  1114,   157,   926,
+   -2140,   778,   421,   291,   861, -2140,  1366,  7500, -2140, -2140,
+    1138, -2140,  6355,   973, -2140,   293, -2140, -2140, -2140, 15895,
+     -14,  5911,  1058, -2140, -2140,   570, -2140, -2140,  9042,  9042,
+    9042,  9042,  9042,  9042,  9042,  9042,  9042,  9042,  9042,  9042,
+    9042,  9042,  9042,  9042,  9042,  9042,  9042,  9042,  9042,  9042,
+    9042,  9042, -2140, -2140, -2140, -2140, -2140, -2140, 15562,  1132,
+   -2140, -2140, -2140,   983, 11141,   402, 10497, 10497, 10497, -2140,
+   -2140, -2140,  1492,  9042,  9042,  9042,  9042,  9042,  9042,  9042,
+    9042,  9042,  9042,  9042,  9042,  9042,  9042,  9042,  1140,  9042,
+    9042,  9042,  9042,  9042,  9042,  9042,  9042,  9042,  9042,  9042,
+    7710,  1581,  9042, -2140, -2140, -2140,  1584,  1153,  1588,  1172,
+      69,  1453,   797,   797,  2100, -2140, -2140,   778,  1405, -2140,
+   -2140,   509,  1618,  1621,   555, -2140,  1206,  1207,  1208,  1210,
+    1211,   646, -2140,  1221,  1222, -2140, -2140,   528,  9042,   445,
+    1492, -2140,  9042,   448,  1492, 11295, 11328, 11919, 11959, 12017,
+   12041,  2954, 12066, 12098, 12139, 12166, 12196, 12220,  3049, 12248,
+   12355,  4354,  4499,  5064, 12494, 12644, 12673, 12697, 12751,  9042,
+   -2140,  9042,  9042,  1108, -2140, -2140, -2140,   186,   544,   544,
+    1109,  1109,  1109,  1109,   286,   286,   286, -2140,  2155,  3629,
+    1320,  5475,  5475,  7827, 15596,  5298,  5475,  1320,   544,   544,
+     173,   173,  1604,  1604,  1604, -2140,   603, -2140,  7531,  1217,
+     539, -2140,  1635,  1224, -2140, -2140, -2140,  1518, -2140, -2140,
+   -2140, -2140,  1223, -2140, -2140, -2140, -2140,  6472, -2140, -2140,
+   -2140,  1640,  1223,  1641,  1231,  1223, -2140, -2140, -2140, -2140,
+   -2140, -2140,  1645,   557, -2140, -2140,    51,  1646,  1647,  1253,
+   -2140, -2140, -2140,  1292, -2140, -2140,  1237,  1238,  1261,  1266,
+   -2140, -2140,  9042,  1648,  1679,  1680,  1685, -2140, -2140,  1586,
+     312,  1661, -2140, 12775, -2140,   293, 15895, -2140,   293, -2140,
+   -2140, -2140, -2140, -2140, -2140,  9042, -2140, -2140, -2140, -2140,
+   -2140, -2140,  9042, -2140, -2140,  9042,  9042,  9042, -2140, -2140,
+   -2140, -2140, -2140, 15620, -2140,   450, 15895,   453,  9042,   454,
+   -2140, 15895,  9042, -2140,  9042,  9042,  9042, -2140,  9042,  1275,
+    1694,  1699,   246, -2140,   837,  1287,  1702,   488, -2140, -2140,
+   -2140,  1253, -2140, -2140, -2140, -2140, -2140, -2140, -2140,  1223,
+    1341,  1253,  1703,  1223, -2140,  1288,  7975,  1285,   377, -2140,
+   -2140,  1290,   464, -2140, -2140,  1223, -2140,  1302,  1304,  1292,
+    1253,  1253,  1253,  1717,  1292,  1308, -2140,  1316,  1322,  1323,
+    1223, -2140, -2140, -2140,  1335, -2140, -2140, -2140, -2140, 14236,
+    1324,  1327,  1328,  1329,   797,   702,  1330,  1326,  1744,  1745,
+     624,   794,   618, -2140, -2140, -2140, -2140,  1746,  1337, -2140,
+   12799, 12823, 12893, 12917, 12941,  9042,  1336,  9042,    36, 15644,
+   -2140,  7827, 15895,  8863,  9413,  9967, 15895,  1672, -2140,   514,
+    1343,  1344,  1753,  1758, -2140,  1638, -2140, -2140, -2140,  1585,
+    1761, -2140,  1492, -2140,  1223, -2140, -2140, -2140,  1223,   146,
+   -2140,  9042, -2140,  9042, -2140,  1640,  9042, -2140,  1641, -2140,
+   -2140,  1348,  1223,  1223,  1223,   259,   518, -2140,  1352, -2140,
+     857, -2140, -2140, -2140,  1771, -2140, -2140, -2140, -2140, -2140,
+   -2140,  1640, -2140,   219, -2140,  4310,  1358, -2140,   548,  2800,
+    3477,  3495, -2140,    85, -2140, -2140,   111,  1696, -2140, -2140,
+   -2140, -2140, -2140, -2140, 15895, -2140, -2140,  1367, -2140,  9042,
+   -2140, -2140, -2140, -2140,  1779,   832, -2140,  1780, -2140, -2140,
+    1370,  1364, -2140,  1721, -2140,   598,   174, -2140, -2140,  1725,
+   -2140,  1377, 10377, 15489, -2140, 15895, -2140,  1717,  1144,  1146,
+    1148,   139,  9042, -2140,  1717,  1717,  1381,   569,     8, -2140,
+   -2140, -2140,   797, -2140,  1371,  8419,    38, -2140,  1745, -2140,
+   -2140, -2140, -2140, -2140, -2140, -2140, -2140, -2140, -2140, -2140,
+   -2140,  1793,  1565, -2140,  1794,  1565,  1796,  1565, -2140, -2140,
+   -2140,  1797,  1305, -2140, 10994, -2140,  1386,  1733, -2140, -2140,
+    1512, 10767, -2140,    75, -2140,  1761, -2140,  1761, -2140, 17522,
+    9669, -2140,  9276, -2140, -2140,   248, -2140,   651,   585,  1717,
+    1717,  1717,  1049,  1512, -2140,    18, 15895, -2140,   588, -2140,
+    1223,  1223,  1813, -2140, -2140,  1640, -2140,  9042, -2140,  1745,
+    1401, -2140, -2140, -2140, -2140,   703,  1573, -2140,  1816,  1223,
+    1223, -2140,  1817, -2140,  1818,  1400,  1820,  1823, -2140,  1305,
+   -2140,  1638,  1827,  1416, -2140, -2140, -2140, -2140, -2140, -2140,
+   -2140, -2140, -2140, -2140, -2140, -2140, -2140, -2140, -2140, -2140,
+   -2140, -2140, -2140, -2140, -2140, -2140, -2140,  1764, -2140, 10767,
+   10767, -2140,  5566, -2140, -2140, -2140,    86,  1440,    92,  1440,
+    1335,  1694, -2140, -2140,   638, -2140,   429,  5879,  1177,   549,
+   -2140,  1838,   730, -2140, -2140, -2140, 17466, -2140,  1421, -2140,
+    1770, -2140,   661,  1427, 15895, -2140,  7944,  7944, -2140,   594,
+     597,   599, -2140,   139,  1428, -2140,  1813,  1813,   381,   668,
+   -2140, -2140, 11034,   602, -2140, -2140, -2140, -2140,  1429,  1844,
+    1437,  1439, 16369, -2140,  1789, -2140, -2140, -2140, -2140,  6093,
+   -2140,  8897, 10131, -2140, -2140,  1683,  1443, -2140,  1444, -2140,
+     670,  1446,  1838,  1447,  1640,  1838,  1448,   743, -2140,   677,
+    1449,  1641,   678,  1694, -2140,  1694,  1694,  1253, -2140, -2140,
+    2533, -2140,  1801,   808,   190,  1863,  1865,  1867, -2140,   627,
+    1456, -2140, 10293, 10381, 15895,  1473,  1476, -2140, -2140, -2140,
+    1460,  9042,   686,   688,  8154, -2140, -2140,  1223, -2140,  1813,
+   -2140,  1465,  9042,  1467, -2140, -2140,  1468,  1694,    95,  1471,
+      56,  1472,   883,  1474,  1777,  1777,  1777,    80,   141,  2000,
+    1453,  1485,  1487, 16611,  1694,  1898, -2140,  1900,  1901, -2140,
+   -2140, -2140,  2649, -2140, 17310, -2140, -2140, 10846, 16127,    15,
+    1711, -2140,   308, 10767, -2140,  1501,  1502,  1507,  1524,  1513,
+   -2140, -2140, -2140, -2140, -2140,   689, -2140,   690,   693, -2140,
+    9042, -2140, -2140,  1838, -2140,   698, -2140,   705,   717,   718,
+    1223,    84,   918,  1492,    33,   184,  1516,  1517,  1519,    33,
+    1492,  1520,    33,  1897,   307,  1521,    33,  1523,  1528,  1530,
+    1529,  1533,  8271, -2140,   201,   221,  1522,  1532, -2140, -2140,
+    1897,  1897,   432,   897, -2140,  1534, -2140, -2140, -2140,  1223,
+    1223,    99, -2140,  3282, -2140, -2140,  7944,  7944,  1535, 15895,
+   -2140, -2140,  1543, 15895, -2140, -2140, -2140, 15895,  1913, -2140,
+     719,   556,  1135, -2140,  1536,  9042, -2140,   728,   768,    56,
+    1955,  1895,  9042, -2140,  1253,  1253,  1253,   745,  5402, -2140,
+     746,  5402,   748,  1894, -2140,  1551,  1553,    55,  1555,  1556,
+    1557,  1558,  1559,  1560,  1562,  1563,  1975,  1975,  1975,  1975,
+    1566,  1570,  1572,  1574,   671, -2140,  5281,  1571,  1568,  1576,
+    1575,  1989,   640, -2140,  1223,  1295, 11529,  1834,   758,  1951,
+   -2140,   760,  1583,  1587,  1694,  1223,  1253,  1580,  9657, -2140,
+   -2140, -2140, -2140, -2140,  9657, -2140, -2140, -2140, -2140, -2140,
+   -2140, -2140, -2140, -2140, -2140, -2140, -2140, -2140, -2140,    55,
+   -2140, -2140, -2140, -2140, -2140,  9657,  1993,    31,    22,    23,
+    3282,  1565, 11771, -2140, -2140, -2140,  1938, -2140, -2140, -2140,
+   -2140,   275, -2140, -2140, -2140,   308, -2140, -2140, -2140, -2140,
+   15895, -2140, -2140, -2140, -2140, -2140,  1694,  9042, -2140,  9042,
+    9042, -2140,   903,  1578, -2140,  2002,   302,  9042,  9042,  9042,
+    1591,  1019,   562,  1589, -2140, -2140, -2140, -2140,  2004, -2140,
+     495,  4460,  1595,  9042,  9042,  4653, -2140,  2010, -2140, 14260,
+   -2140, -2140, -2140, -2140,  9042, -2140,  1897,  2501,   293,  1492,
+   -2140, -2140, -2140,  1596,  2881, -2140,  9042,  9042,  6028,  9042,
+    9042,  9042,  9042,  9042,  9042,  9042,  9042,  9042,  5785, -2140,
+    1335,  1600,  1600, -2140,  1600, -2140,  3282,   252,   178,   211,
+    9042,  1601, -2140, -2140, -2140,  9042,  1602,  1603, -2140, -2140,
+   -2140, -2140, -2140, -2140, -2140, -2140,  1605,  1606,   217, -2140,
+      33, 12978, -2140,  1492,  9042, -2140,  1609, -2140, 13096,  1223,
+    1223,  1223,  2070,   747,   839,  1613, 15895,   853, -2140,   155,
+    1614,   888, -2140, -2140,  9042,  1610,  1623,  1617,  1619,  1223,
+   -2140,  1628,  1625, 10114, 10114, 10114, 10114, 10114, 10114, 10114,
+   10114,  1631,   761,   762,   793,   798, 10114, 10114, 10114, 10114,
+    1642, -2140, -2140,  1975,   425, -2140, -2140, -2140,   234, -2140,
+     349,   151,  1643,  1644,  1649,  1536,  1650,  1630,  2041,  1994,
+   -2140, -2140,    73, -2140,  1898, -2140, -2140,   803,  1536,  1223,
+     198,    76, -2140, -2140,  1653, -2140,  1656,  2027, -2140,   770,
+    2058, -2140,   810, -2140,   813,  5270,   155,    23,   824,  9042,
+     155,   829, -2140,  -104,  2067,  2022, -2140,  1335, -2140, -2140,
+    1850,  1670,   831, 14294, 14390,   945, -2140,  9042, -2140, -2140,
+   13219, 13243, 13374, -2140, -2140,  1673,  2085,  1668,  9042, -2140,
+   -2140,  1675, 13398, -2140, 13422, 13446,  1676, 13492,  1674, -2140,
+    1678, 15668, -2140,  1681,  9042,  9042,  1686,   119, -2140, 15895,
+     643,  6682,  1689,   957, 15895, 15895,  1695,   172,  9042,  9042,
+   14418, 15895, 15895, 15895, 15895, 15895, 15895, 15895, 15895, 15895,
+    1700,   849,  1684,  1697,  9042,  9042, 14448, -2140,  9042, -2140,
+   -2140, -2140, -2140,  2050, -2140, -2140, -2140, -2140, 15895, -2140,
+   14689,   732,   865,   860,   872,  9042, -2140,  1693, -2140,   850,
+   -2140, -2140, 15895,  9042, -2140,  1694,  1694,  2113,  1701, -2140,
+    2115,   988, -2140,   997,  2305,   155,   732,   865, -2140,  9042,
+   -2140,   732,   155,   865, 13516, -2140, -2140,  9042,  9159,   967,
+     967, -2140,  1704,  9042,  9042,  1730,  1705,  1706,  1707,  1708,
+    1709,  1710,  1712,  1715, 10497, -2140,  2118, -2140, -2140, -2140,
+    1716,  1719,  1720,  1722, -2140,   425, -2140, -2140,   622,  9042,
+   -2140,  4803, -2140,  2053,  1726, -2140, -2140, -2140, -2140,  1694,
+    1723,  2119, -2140,  1966, -2140, -2140, -2140, -2140,  1498,  1694,
+   -2140, -2140, -2140,  8388,  1729,   852, -2140,  2142,  9042,  9042,
+   -2140,  1223,   862, -2140,  2143, -2140,  2058,   863,   155,   882,
+   -2140,   885, -2140,  2152,  2143, 16853, -2140, 17095, -2140,  2149,
+    1742, -2140, -2140, -2140, -2140,  1743, 14713,  3282,  3698,  3843,
+    4041,  1897,  1737,  9042, 14737,  3282,  1897,  1897,  1897,  1897,
+    1897,  1897,  1526, -2140,  9042, -2140, 15895, 15895,  1897,  6815,
+   -2140,  6815,  9042,  1748,  1749, -2140,  6682,  1766, -2140, 14211,
+    1760,  1769,  9042,  3005, 14843, 14868, -2140,  9042,  8598,  9042,
+   -2140, -2140, 14892, 14916, -2140, 15895, -2140, -2140,  1774,  1775,
+    1776,  1781,  1783,  1784,  1031,  9042, -2140,    33,  8715, 14940,
+     886,   906,  1763,   914, -2140,  1773, -2140, -2140,     3,  1785,
+    1032,  1033,   919,  1786,  1788, 15895,  1790,   935,  1803,  1553,
+   15692,  9042, 15895,  1628, -2140,  2161, 15895,  1798, 15895,  1828,
+    9042, 10114, 10114,  9042, 10114, 10114, 10114, 10114,  9042,  1792,
+    1805, 10114, 10114, 10114, 10114,   731,   189,   207,  1034, -2140,
+    1809,  1041, -2140,  1811,  5862, 17522,   937, -2140,  1807, 16853,
+   -2140,  1814,   947,   949,  2227,  1042, -2140,  1045, -2140, -2140,
+    1051, 14964, 15895, -2140,  1810, -2140, -2140, -2140,   956, -2140,
+   -2140,   965,   977,   982,  2169, -2140, -2140, -2140, -2140, -2140,
+     378,   -19,    26, -2140,  3155,   223,    -2,  3424,    34,  3574,
+   -2140,  9042, 14988, -2140,   533,  2173,  2176, -2140, -2140, -2140,
+   -2140,  1819, -2140,  1161, 15716, -2140, -2140, -2140,  1052,  9042,
+    2235, -2140,  1825,  6939,  1824, -2140, -2140, -2140, 13540, -2140,
+   -2140, 13564, -2140,  1053, 11092, -2140, -2140,  1335, -2140, -2140,
+   -2140, -2140, -2140, -2140, -2140,  9042, 15895, -2140,  1843,   363,
+    7266, -2140,  9042, -2140, -2140,  9042, -2140,  2241,  4186, -2140,
+   -2140, -2140, -2140, -2140,   155,   155,   155, -2140,   155,  1830,
+    1831,  9042,  3887, -2140,  1178,  9042,  9042, 15895,  1826,  1832,
+      46,  1833,  1837,  1839,  1840,  1061, -2140, 10497,  1841,  1845,
+    1848,  1853,  1835,  1842,  1975,  1062,  1975,  1065, -2140,  9042,
+   -2140, -2140,  1335, -2140,   658, -2140, -2140, -2140, 17522,   243,
+   -2140,  2246,  2190, -2140, -2140, -2140,  1846, -2140, -2140,  1847,
+   -2140,  2262, -2140, -2140, -2140, -2140, -2140, -2140,  7223,  2213,
+   -2140,  1897,  1897, -2140,  1876, -2140, -2140,  1897, -2140, -2140,
+   -2140, -2140, 15022,  4927,   260,  1897,  1897,  1866,  1868,  2278,
+    9042,  1870, 13642,  1864, -2140,  5528, -2140, -2140,  1872,  1862,
+    1862, -2140,  1875, -2140,  1075, -2140, -2140, -2140, -2140, 15143,
+   15895,  1869,  1873, -2140, 13671,   984,   985,   993,  1014, -2140,
+   -2140, 15741,  9042, 10497,  2248, 15895, 15895,  9042,  9042, -2140,
+    1492,  1874,  1877,  9042,  9042,  9042,  9042,  1878,  9042,  1880,
+    9042,  9042,  9042,  9042,  1975,  1975,    21, -2140,    21, -2140,
+   -2140, -2140,  3282,  1881, -2140,  2232,  1886,  2146,  8832, -2140,
+    1891,  1896, -2140, -2140, -2140, -2140,  2110, -2140, -2140,  2103,
+   17320, -2140,   209, -2140, -2140, -2140,   214, -2140,  4956,   820,
+   -2140,  2121, -2140, -2140, -2140, -2140,  9042,  1905, 15167, -2140,
+   -2140, -2140,  1897,  1897, -2140, 15895, -2140,  6939,  2321, -2140,
+    6238, 11116,  1910,  9042,  9042,  9042, -2140,  9042, 10846, 10846,
+    2323,  9042, -2140, -2140, -2140, -2140, -2140, -2140,  9042, 13695,
+    1939, -2140,    46,  1906,   293,  1914,  1492,    46,    46,  1911,
+      46, -2140,  1404, -2140,  1916,  1917,    46,    46,    21,    21,
+   -2140, -2140, -2140,  9042,  9042,  1897,  3282, -2140,  1920, -2140,
+   -2140, 13719, -2140, -2140, -2140, -2140,   -10, -2140, -2140,  2330,
+    1538, -2140, -2140, -2140,  2337, 15417,    68,   140, -2140, -2140,
+    2281,  1183, -2140, -2140, -2140, 15441, 15465, 13960,  1927, -2140,
+   -2140,  1925, 15895, 15895, -2140,  9042,  1932,  9042, -2140,   293,
+    1933,  1934,  9042,  1936,  1937,  9042,  9042,  1944,  1945,  9042,
+    9042, 13984, 14115,   323,   243,  1335, -2140, -2140,  1954,   112,
+    1940,  1949,  1018,   123,    68,  1950, -2140,  1265, -2140,  1952,
+    1953,  6939,  1957, -2140, -2140, -2140, -2140,  9042, 15895,  1956,
+      46,  1959,  1960,    46,  1961,  1963,    46,    46,  1964,  1965,
+   14139, 14163,  1967,  1968, -2140,  2296, -2140,   497, -2140,  2303,
+    9669, -2140, -2140, -2140, -2140,  2736,  1969,  1897,  9042,  1897,
+    1897, -2140,  6939, 14187, -2140,  1970, -2140, -2140,  1976, -2140,
+   -2140,  1978,  1979, -2140, -2140,  1980,  1981, -2140, -2140,  1335,
+   -2140, -2140, -2140,  2001,  1984,  1988,  1990,  1897, -2140, 15895,
+   -2140, -2140, -2140, -2140,  1991,  1992,  1995,  1996, -2140, -2140,
+   -2140,  1335,  2128, -2140,  1999, -2140, -2140, -2140, 17095, -2140,
+   -2140, -2140, -2140, -2140, -2140, 17522, -2140,   252, 17522,  2533,
+    2339,  2003,  2001,    59, -2140,  2005,  9042,  1082,   252,  2341,
+    2001, -2140
+};
+
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int16 yydefact[] =
+{
+     220,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    75,   220,    71,    73,     0,   219,    72,    70,    69,
+      67,    68,   227,   221,     0,   226,     0,     0,     0,     0,
+       0,     0,   306,   306,     1,    76,   560,   559,   561,     0,
+       0,     0,   222,     0,     0,     0,     0,   141,   212,   211,
+     305,   307,   315,   554,   223,     0,   504,   422,   421,   134,
+     135,   137,   420,     0,     0,     0,     0,     0,     0,   463,
+      93,    92,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   461,   429,   368,   369,   419,
+     462,   228,   367,   423,     0,   225,   965,   968,     0,     0,
+     325,   157,     0,     0,   572,   224,     0,     0,   136,   138,
+       0,   504,     0,     0,   545,   542,    94,    96,     5,   418,
+       0,     0,   429,   462,   380,   423,   381,   382,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   375,   384,   376,   373,   370,   371,   411,     0,
+     182,   183,   459,     0,   418,     0,     0,     0,     0,   372,
+     383,   374,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    95,    97,   967,     0,     0,     0,     0,
+       0,   976,   679,   679,     0,   153,   155,   156,     0,   149,
+     152,     0,     0,     0,     0,   310,     0,     0,     0,     0,
+       0,     0,   318,     0,   570,   424,   428,     0,     0,     0,
+       0,     4,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     455,     0,     0,   456,   378,   379,   377,   430,   404,   405,
+     402,   406,   403,   407,   399,   400,   401,   386,   408,   409,
+     394,   395,   396,     0,     0,   393,   385,   392,   397,   398,
+     390,   391,   387,   388,   389,   427,     0,   505,     0,   970,
+       0,   966,     0,   336,   327,   326,   975,   534,   683,   172,
+     173,   684,   681,   538,   540,   541,   539,     0,   685,   737,
+     686,     0,   680,     0,     0,   740,   131,   132,    99,   102,
+     101,   100,     0,     0,   133,    62,   978,     0,     0,   534,
+      57,    59,    58,   537,   154,   142,     0,     0,     0,     0,
+     308,   309,     0,     0,     0,     0,     0,   316,   317,     0,
+       0,   567,   426,     0,   544,   543,   417,   456,   430,   452,
+     431,   432,   433,   434,   435,     0,   436,   438,   439,   440,
+     441,   442,     0,   444,   445,     0,     0,     0,   447,   448,
+     449,   450,   451,     0,   181,     0,   179,     0,     0,     0,
+     140,   213,     0,   425,     0,     0,     0,   506,     0,     0,
+       0,     0,     0,   963,   929,     0,     0,     0,   748,   749,
+     750,   534,   752,   664,   532,   533,   665,   751,   753,   740,
+     754,   534,     0,   682,   217,     0,     0,     0,     0,   687,
+     738,     0,     0,   689,   250,   739,    61,     0,     0,   537,
+     534,   534,   534,     0,   537,     0,   977,     0,     0,     0,
+     740,   535,   536,    60,   565,   312,   311,   314,   313,     0,
+       0,     0,     0,     0,   679,     0,     0,   731,     0,     0,
+       0,     0,     0,   518,   722,   516,   718,     0,     0,   460,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      98,     0,   410,     0,     0,     0,   969,     0,   510,     0,
+       0,     0,     0,     0,   928,     0,   964,    74,   337,     0,
+       0,   324,     0,   328,   740,   745,   755,   756,   740,     0,
+     218,     0,   216,     0,   150,     0,     0,   151,     0,   246,
+     247,     0,     0,     0,     0,   261,     0,   257,     0,   248,
+       0,   249,   245,    56,     0,   143,   320,   321,   323,   322,
+     319,     0,   573,     0,   571,     0,     0,   735,     0,   531,
+     531,   531,   568,   723,   522,   569,   220,     0,   555,   437,
+     443,   453,   454,   446,   412,   184,   180,     0,   457,     0,
+     139,   508,   509,   507,     0,     0,   959,     0,   960,   961,
+       0,     0,   917,     0,   338,     0,     0,   746,   747,     0,
+      84,     0,     0,   694,   688,   692,   690,     0,     0,     0,
+       0,     0,     0,   251,     0,     0,     0,     0,   220,   270,
+     564,   574,   679,   575,     0,     0,     0,   720,     0,   669,
+     673,   667,   672,   668,   671,   675,   670,   666,   674,   676,
+     677,     0,    66,   530,     0,    66,     0,    66,   517,   520,
+     519,     0,   549,   458,     0,   971,     0,     0,   511,   962,
+       0,     0,   973,     0,   338,     0,   338,     0,    90,     0,
+       0,   215,   707,   706,   691,   693,   696,     0,     0,     0,
+       0,     0,   135,     0,   259,     0,   264,   258,     0,   268,
+     740,   740,     0,   267,   269,     0,   734,     0,   733,     0,
+       0,   736,   526,   174,   175,     0,   978,    63,     0,   740,
+      65,   524,     0,   528,     0,     0,     0,     0,   556,   550,
+     214,     0,     0,     0,   935,   954,   937,   938,   932,   933,
+     934,   936,   939,   940,   941,   942,   943,   944,   945,   946,
+     947,   948,   949,   950,   951,   952,   953,     0,   922,   919,
+     920,   924,     0,   930,   339,   329,     0,   334,     0,   334,
+     565,     0,   160,   158,     0,   159,     0,    99,     0,     0,
+     161,     0,   980,   468,   469,   236,   220,   466,     0,   162,
+      66,   207,   915,     0,   701,   695,     0,     0,   253,     0,
+       0,     0,   260,     0,   262,   252,     0,     0,   741,     0,
+     120,   576,     0,     0,   719,   525,    64,   523,   527,     0,
+       0,     0,     0,   551,     0,   972,   927,   918,   923,     0,
+     925,     0,     0,   931,   332,     0,     0,   330,     0,    91,
+       0,     0,     0,     0,     0,     0,     0,   741,   759,     0,
+       0,     0,     0,     0,   979,     0,     0,   534,   177,   907,
+       0,   467,     0,   220,   163,     0,     0,     0,   210,   163,
+       0,   703,     0,     0,   702,     0,     0,   255,   254,   256,
+       0,     0,     0,     0,     0,   743,   122,   742,   273,     0,
+     732,     0,     0,     0,   553,   552,     0,     0,     0,     0,
+       0,     0,     0,     0,   160,   158,   159,     0,     0,     0,
+     976,   284,     0,     0,     0,     0,   983,     0,     0,   617,
+     619,   632,   534,   618,   593,   577,   653,     0,     0,     0,
+       0,   974,     0,     0,   958,   932,   933,   934,     0,     0,
+     335,   333,   331,   233,   237,     0,   239,     0,     0,   238,
+       0,   757,   230,     0,   240,     0,   231,     0,     0,     0,
+     740,     0,     0,     0,     0,   220,     0,     0,     0,     0,
+       0,     0,     0,   220,   220,     0,     0,     0,     0,     0,
+       0,     0,     0,   178,     0,     0,     0,     0,   855,   854,
+     220,   220,   542,     0,   176,     0,    85,   906,   208,   740,
+     740,     0,   206,   244,   704,   705,     0,     0,   263,   265,
+     272,   271,     0,   123,   744,   121,   721,   529,     0,   637,
+       0,     0,     0,   346,   296,     0,   286,     0,     0,     0,
+       0,     0,     0,   678,   534,   534,   534,     0,   415,   479,
+       0,   415,     0,     0,   634,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   788,     0,     0,     0,     0,
+       0,     0,     0,   283,   740,     0,     0,     0,     0,     0,
+     148,     0,     0,     0,     0,   740,   534,   713,     0,   480,
+     486,   487,   488,   496,     0,   481,   492,   483,   489,   490,
+     491,   482,   494,   497,   493,   495,   499,   502,   503,     0,
+     498,   500,   501,   485,   484,     0,     0,     0,     0,     0,
+       0,    66,     0,   660,   656,   659,   626,   652,   562,   563,
+     557,     0,   955,   956,   957,     0,   921,   229,   234,   232,
+     758,   760,   235,   197,   198,   199,     0,     0,   892,     0,
+     415,   886,     0,     0,   844,     0,   220,     0,     0,     0,
+       0,     0,     0,     0,   111,   103,   105,   104,     0,   848,
+     220,     0,     0,     0,     0,     0,   106,     0,   107,     0,
+     303,   304,   301,   302,     0,   289,   220,     0,   356,     0,
+     867,   868,   869,     0,     0,   890,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   866,
+     565,   205,   205,   203,   205,   241,   243,   220,     0,     0,
+       0,     0,   566,   592,   639,     0,     0,     0,   350,   354,
+     349,   353,   348,   352,   351,   355,     0,     0,     0,   295,
+       0,     0,   595,     0,     0,   287,     0,   640,     0,   740,
+     740,   740,     0,   473,     0,     0,   414,     0,   603,     0,
+       0,     0,   602,   636,     0,     0,     0,     0,     0,   818,
+     815,   817,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   807,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   793,   792,     0,   822,   635,   789,   766,     0,   765,
+       0,     0,     0,     0,     0,   296,     0,     0,     0,     0,
+     620,   621,     0,   144,     0,   644,   643,     0,   296,   740,
+       0,     0,   613,   614,     0,   615,     0,     0,   616,   741,
+       0,   663,     0,   762,     0,   415,     0,     0,     0,   415,
+       0,     0,   594,   296,     0,     0,   624,   565,    11,    12,
+      17,     0,     0,     0,     0,     0,   853,     0,   846,   845,
+       0,     0,     0,   841,   852,     0,     0,     0,     0,   850,
+     849,     0,     0,   843,     0,     0,     0,     0,     0,   108,
+       0,   299,   870,     0,     0,     0,     0,     0,   359,   364,
+     543,    41,     0,     0,   893,   894,     0,     0,     0,     0,
+       0,   895,   896,   897,   898,   899,   900,   901,   902,   903,
+       0,    37,     0,     0,     0,     0,     0,    86,     0,   200,
+     201,   202,   242,     0,   700,   699,   698,   697,   266,   124,
+       0,     0,     0,     0,     0,     0,   291,     0,   548,     0,
+     627,   288,   285,     0,   645,     0,     0,     0,     0,   728,
+       0,     0,   730,     0,     0,     0,     0,     0,   472,   416,
+     478,     0,     0,     0,     0,   770,   769,     0,     0,     0,
+       0,   764,     0,     0,     0,   830,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   787,     0,   784,   785,   786,
+       0,     0,     0,     0,   806,   822,   820,   821,     0,     0,
+     791,     0,   802,     0,   188,   185,   282,   281,   280,     0,
+       0,     0,   630,     0,   145,   146,   147,   588,     0,     0,
+     712,   710,   711,   415,     0,     0,   633,     0,     0,     0,
+     761,   741,     0,   583,     0,   580,     0,     0,     0,     0,
+     596,     0,   600,     0,     0,     0,   657,     0,   558,     0,
+       0,   926,   196,   875,   873,     0,     0,   244,     0,     0,
+       0,   220,     0,     0,     0,   244,   220,   220,   220,   220,
+     220,   220,     0,   290,     0,   358,   363,   362,   220,     0,
+     357,     0,   415,     0,     0,    40,    42,     0,    38,     0,
+       0,     0,     0,     0,     0,     0,   874,     0,     0,     0,
+     883,   882,     0,     0,   872,   204,    88,   638,     0,     0,
+       0,     0,     0,     0,     0,     0,   612,     0,     0,     0,
+       0,     0,   512,     0,   476,   727,   470,   474,     0,     0,
+       0,     0,     0,     0,     0,   413,     0,     0,     0,     0,
+     811,     0,   813,   819,   816,     0,   824,   367,   823,   367,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     809,     0,     0,     0,     0,     0,     0,     0,     0,   297,
+       0,     0,   194,     0,     0,   914,     0,   642,     0,     0,
+     629,     0,     0,     0,     0,     0,   716,     0,   611,   610,
+       0,     0,   661,   579,     0,   662,   763,   597,     0,   598,
+     601,     0,     0,     0,     0,   625,    16,     6,   885,   840,
+     220,     0,   220,   279,     0,     0,     0,     0,     0,     0,
+     117,     0,     0,   842,   220,   864,   862,   112,   884,   118,
+     113,     0,   126,     0,     0,   871,   360,   361,     0,     0,
+       0,    39,     0,     0,     0,    45,   891,   887,     0,   877,
+     880,     0,    35,     0,     0,   876,   878,   565,   345,   344,
+     342,   340,   343,   341,   292,     0,   546,   547,     0,     0,
+       0,   647,     0,   590,   589,     0,   587,     0,     0,   729,
+     477,   471,   475,   607,     0,     0,     0,   604,     0,     0,
+       0,     0,   411,   832,     0,     0,     0,   829,     0,     0,
+     833,     0,     0,     0,     0,     0,   808,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   790,     0,
+     803,   801,   565,   191,     0,   910,   909,   912,   913,   220,
+     584,     0,     0,   591,   585,   586,     0,   708,   709,     0,
+     366,     0,   908,   599,   581,   578,   582,   658,     0,     0,
+     859,   220,   220,   276,     0,   856,   278,   220,   860,   857,
+     861,   858,     0,     0,     0,   220,   220,     0,     0,     0,
+       0,     0,     0,     0,   888,     0,    54,    47,     0,     0,
+       0,    36,    79,    89,     0,   650,   648,   628,   646,     0,
+     513,   514,     0,   726,     0,     0,     0,     0,     0,   768,
+     767,     0,     0,     0,     0,   826,   825,     0,     0,   839,
+     835,     0,   834,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   804,     0,   805,
+     298,   195,   244,     0,   911,     0,     0,     0,     0,   717,
+       0,     0,    34,    33,   170,   171,    32,   127,    27,     0,
+       0,    21,   164,    10,     9,   129,     0,   169,     0,   166,
+     165,     0,   847,   277,   275,   274,     0,     0,     0,   851,
+     865,   863,   220,   220,   125,   300,   889,     0,     0,    52,
+       0,   418,     0,     0,     0,     0,   293,     0,     0,     0,
+       0,     0,   725,   724,   609,   608,   606,   605,     0,     0,
+     827,   831,   833,     0,   836,     0,   837,   833,   833,     0,
+     833,   783,   833,   810,     0,     0,   833,   833,     0,     0,
+     798,   799,   800,     0,     0,   220,   244,   186,     0,   631,
+     715,     0,   365,    31,     7,    20,   976,    26,    25,     0,
+       0,    32,   164,   168,     0,     0,     0,     0,   119,   114,
+      48,     0,    55,    51,    46,     0,     0,     0,     0,   651,
+     649,     0,   515,   812,   814,     0,     0,     0,   774,   838,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   220,   220,   565,   641,   714,    15,     0,
+       0,     0,     0,     0,     0,     0,    82,     0,    83,     0,
+       0,     0,     0,   881,   879,    80,   294,     0,   828,     0,
+     833,     0,     0,   833,     0,     0,   833,   833,     0,     0,
+       0,     0,     0,     0,   192,     0,   187,     0,     8,     0,
+       0,    29,    28,    24,    53,     0,     0,   220,     0,   220,
+     220,    49,     0,     0,   772,     0,   775,   778,     0,   780,
+     782,     0,     0,   777,   781,     0,     0,   794,   796,   565,
+     189,    14,    13,    78,     0,     0,     0,   220,   116,    81,
+     115,   109,    50,   622,     0,     0,     0,     0,   795,   797,
+     193,   565,     0,    30,     0,    44,    43,   110,     0,   773,
+     779,   771,   776,   190,    77,   465,   623,   220,   464,     0,
+       0,     0,    78,     0,    22,     0,   415,     0,   220,     0,
+      78,    23
+};
+
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int16 yypgoto[] =
+{
+   -2140, -2140, -2140, -2140, -2140, -2140, -2140, -2140, -2140, -2140,
+   -2140, -2140,   428,   420, -2140,   800, -2140,   256, -2140, -1400,
+   -2140, -2140, -1898,  -233,  -620,  2405, -2140, -2139, -2140, -1826,
+     -98, -2140, -2140, -2140, -2140, -2140,   361,  -870, -2140, -2140,
+   -1193, -2140, -2140,  -827,  1503,   416, -2140, -2140, -2140,  -417,
+   -2140, -2140, -2140, -2140, -2140,  1081, -2140,  2189, -2140, -2140,
+    -618, -2140,   438, -2140, -2140, -2140,  1616, -2140, -2140,   354,
+    1902, -2140, -2140,   586,   444, -2140, -2140, -2140, -2140, -2140,
+   -2140, -2140, -1508,   608,  -379,   735,    32,  1903,  -262,     0,
+   -2140,  2396,  2397,  -628, -2140, -1573,   114, -2140,    98,  1612,
+    1799, -2140, -2140,  1800,  -596,    16, -2140, -2140, -1003, -2140,
+    -965,  -779,  -660,   911, -1203,  -920,  2413, -2140, -2140, -2140,
+    2206, -2140, -2140, -2140,  2200, -2140, -2140, -2140, -2140,  1655,
+    -342,   843, -1085, -2140, -1025, -1020, -1211, -2140,   -59, -2140,
+     -33, -2140, -1142,   125,     7, -2140,   230,  -812,  1163,  -888,
+   -2140, -2140,   227,  -642, -2140, -2140, -2140,  1851,  1008,  -143,
+    -229,  -146,   -61,   812, -2140, -2140,  1731,   366, -2140, -2140,
+   -2140, -2140, -2140, -2140,  -787, -2140, -2140, -2140, -2140,  -952,
+   -2140, -2140, -2140, -2140, -2140, -2140, -2140,   662, -2140, -2140,
+   -2140,  -910, -1559,  -405,   899,    43, -2140,   607,   683,  -193,
+    1590,  1593,  -218,  1893, -2140, -2140,  1750,  -715, -2140, -2140,
+     600, -2140, -2140,  1879,   817,   986,  -363,  1727,    35,  -254,
+    -585, -2140, -2140,  1495,  -501,   902, -1294,  1383, -2140, -1057,
+   -2140, -2140, -1720, -1045, -2140, -1059,   980,   990,  1342, -2140,
+     959,   529, -2140,  -653, -2140,  -335, -2140, -2140, -1680, -1231,
+    -980, -2140,   634, -2140, -2140,   333,  1734, -2140, -2140,  1714,
+   -2140, -2140,  1718, -2140, -2140,   833,  -159,  1333,  2055, -2140,
+   -2140, -2140, -2140, -2140, -2140,  1554, -2140, -2140, -2140, -2140
+};
+
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int16 yydefgoto[] =
+{
+       0,    10,   105,   949,  1878,  2118,  1978,  1380,  2158,  1580,
+    1979,  1980,  1981,  1982,  1442,  1615,  1616,  1617,  1983,  1906,
+    2010,  1984,  1907,   811,   748,    11,    12,  2213,  1443,  2125,
+     950,   709,  1240,   641,  1787,   800,   106,   107,   108,   369,
+    1199,  1018,  1019,   839,   840,  1763,  1985,  1986,   370,   109,
+     429,    13,   121,   494,   951,  1110,  1111,   236,   237,   238,
+     952,   820,  1987,  1988,  1989,  1990,   348,   749,   888,   889,
+     424,   425,   183,   110,   953,  1705,  2115,  1704,  2211,  1962,
+    2189,  1852,   813,   821,  1449,   822,    14,   430,   349,   890,
+      16,    24,    25,  1245,  1246,  1247,   815,   371,   576,   725,
+     577,   372,   658,   659,  1743,  1744,  1103,  1104,  1056,  1057,
+    1020,  1269,  1270,  1698,  1699,  1215,    51,    17,   122,   244,
+     245,    18,   123,   251,   252,    19,   230,   447,   553,   866,
+     335,   703,  1053,  1054,  1266,  1267,  1021,  1417,  1418,  1357,
+    1411,   179,  1287,  1745,   112,  2227,   816,   817,  1069,  1070,
+    1148,  1149,   113,   539,  1653,   511,   512,   513,   682,   459,
+     493,   373,   114,  1468,  1469,   758,   759,   955,   124,   692,
+     852,  1377,    39,  1160,   585,   518,   391,   254,   505,   956,
+    1150,  2218,  1577,  1648,  1709,   957,  1800,  1801,  2019,  2018,
+     958,   959,  1155,  1156,  1361,  1362,   461,   683,  1064,   351,
+     468,   472,   469,   473,   714,   715,   716,   905,   717,  1351,
+    1716,  1717,   514,   515,  1482,  1483,   516,   598,   475,   476,
+    1560,   917,   462,   878,   879,  1363,  1364,  1095,  1096,  1097,
+    1323,  1098,  2053,  1099,  1100,  1312,  1300,  1301,  1302,  1499,
+    1528,  1506,  1824,  1941,  1942,  1024,  1587,  1595,  1025,   892,
+     893,  1358,  1857,  1858,  1859,   823,   633,   701,   787,   788,
+     789,   790,   791,   544,   545,   792,   793,   969,   443,   444,
+     118,   226,   439,   625,    21,   337,   487,   887,  1991,   960
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int16 yytable[] =
+{
+      15,   368,   136,   137,   891,  1154,  1157,  1400,   111,   912,
+     913,  1410,    15,   869,  1740,  1186,  1453,  1429,  1735,  1295,
+    1017,  1618,  1754,   235,  1200,  1067,  1067,  1445,  1313,  1314,
+    1315,  1296,   139,  1107,  1359,  1324,   131,   617,  1385,  1479,
+     353,   507,     1,  1284,  1880,    42,  1290,   125,  1285,  1939,
+    1072,  1291,  2050,  2051,   485,   128,  1275,   129,  1297,   131,
+       1,  1888,   131,  1367,  1298,   752,  1562,   754,   178,   184,
+      26,   131,   333,   144,   146,   147,  1544,  1554,   794,  1067,
+    1158,   814,  1423,  1067,    63,    64,   350,   350,   507,   794,
+     470,   812,   819,  2234,   139,   794,  1051,  1890,  -347,   139,
+    1243,  2241,  1177,   172,   174,   175,   176,   177,   184,  2080,
+     189,   191,   906,  2159,   689,   265,   266,   267,   268,   269,
+     270,   271,   272,   273,   274,   275,   276,   277,   278,   279,
+     280,   281,   282,   283,   284,   285,   286,   287,   288,   235,
+    1481,  2129,    27,   131,  1067,     1,   597,   639,   336,    59,
+     722,    61,  1533,   239,  -542,  -542,    63,    64,  1067,   870,
+     298,   299,   300,   301,   302,   303,   304,   305,   306,   307,
+     308,   309,   310,   311,   312,   131,   314,   315,   316,   317,
+     318,   319,   320,   321,   322,   323,   324,   139,   814,   328,
+     140,   460,  1311,   294,   295,   296,  1339,  1855,   812,  1550,
+     897,   470,  -543,  -543,  1210,   555,   202,  1211,   635,  1551,
+    1311,  1552,  1212,   470,  1213,  1609,  1618,   484,     1,    36,
+    1210,    37,   467,  1211,   131,   393,   490,   185,  1212,   396,
+    1213,  1159,  2119,  2171,   724,   240,   583,  1210,  2054,   116,
+    1211,   987,  1375,   988,   989,  1212,  1184,  1213,  1017,   541,
+     571,  2130,   257,   916,  1017,   578,   423,   259,   426,   139,
+    1368,  1371,  1644,  1428,  1525,    28,   263,   352,   352,   239,
+    1471,   802,   803,  1444,  2202,  1017,   819,     1,  1378,  1732,
+     431,   819,  1379,   763,  -128,  1050,     1,   805,  1574,  2066,
+     135,   135,   981,   145,   145,   145,   486,    70,  2166,    71,
+     637,  2235,  1108,   740,   638,   741,   832,    29,   554,  1052,
+     882,   591,  -905,   506,   466,   507,  -905,   662,   558,   202,
+    1268,  1248,  1249,   145,   145,   145,   145,   145,  2109,  2110,
+     145,   145,    70,   117,    71,  -128,     1,   572,   573,   574,
+     940,     1,  1660,   542,  1195,   326,     1,   644,  1466,   499,
+    1855,   240,  1210,    22,   706,  1211,   707,     1,   350,  -347,
+    1212,  -347,  1213,   797,  1389,   799,    20,    32,  1360,  1366,
+    1370,   975,   520,   661,   978,   663,   597,   463,    20,   521,
+      38,  1881,   522,   523,   524,    23,   470,   470,   470,  2055,
+     510,  1195,  2154,  -220,  -220,   529,  2128,  2128,  1881,   532,
+     261,   533,   534,   535,    70,   536,    71,   262,  1530,  -220,
+    1532,  1715,     1,   145,   145,   145,   724,   427,   833,   297,
+    1480,  2052,   733,    30,   133,   133,  1882,   142,   142,   142,
+     873,    43,  -679,    43,  1881,  1365,  1369,  1639,   834,  1643,
+    -905,  1638,  1516,  1641,  2128,   810,  1268,  1268,    31,   747,
+     618,   132,   747,  1447,   747,  1268,   739,   142,   142,   142,
+     142,   142,  1664,  1555,   142,   142,  1663,  1940,  1668,   735,
+    1768,  1666,  1347,   130,   347,   347,   836,   837,  1567,  1569,
+    1830,  1545,  1571,  2114,   334,  1835,   132,   395,   470,  1369,
+     795,   398,   614,  1068,   426,   846,  1196,  1197,   431,  1178,
+    2191,   864,   508,   509,  2192,  2009,  1179,   867,  1052,  1879,
+      22,   732,   338,  -347,  -740,  -740,   350,   841,   347,  -347,
+    -740,  -740,  1372,  1894,    33,  2160,  -521,  -521,   642,     1,
+     643,  1373,  -521,   645,  1382,  1610,   339,   340,  2164,   352,
+    1611,  2165,    54,  1196,  1197,   549,   723,   142,   142,   142,
+     880,   220,  -679,    34,  1071,   221,   341,   222,   132,   -87,
+     478,   640,   665,  1395,  1534,   131,  1535,     1,  1369,   355,
+     199,   200,   201,   227,   875,   872,   915,   202,   228,  1195,
+     657,   217,   218,   219,  1185,  1623,   694,   747,  1568,   712,
+    1578,   221,  1914,   222,  1454,   713,   342,  1662,  1455,   484,
+     246,   247,  1844,   221,  1667,   222,   510,   648,   649,   650,
+    2083,  1553,  1819,   874,  1214,   915,   881,  -905,  1452,   726,
+    1846,   440,   248,  1887,  1820,  1154,   343,  1456,  1965,  1216,
+    1465,  1457,   338,   863,  1217,    40,   441,  1845,  1847,   871,
+     479,  -537,  1696,   249,   262,    44,  1960,  1529,   442,   134,
+     134,  1697,   143,   143,   143,  1044,   339,   340,   657,  2226,
+     350,   550,   344,   350,   551,  1734,   480,   552,   345,   356,
+     357,   358,  1320,   250,  1311,  1539,   341,    41,   651,   824,
+    1728,   652,   143,   143,   143,   143,   143,   346,  1548,   143,
+     143,    46,   215,   216,   217,   218,   219,   352,  2013,  2014,
+     863,  1999,   863,   968,   842,   599,   600,  1198,   802,   803,
+     221,  1223,   222,  1573,   481,   964,   342,   750,   359,   360,
+     750,   601,   750,    45,   805,  1332,   730,  1333,  -723,   508,
+     509,  1196,  1197,  -723,  2032,  2033,  1176,  1162,  1163,  1164,
+    2037,  2038,  2039,  2040,   990,   718,   343,  2044,  2045,  2046,
+    2047,  1842,   482,   728,   343,    47,   241,   361,  1334,   343,
+    1843,  1321,  1531,  1916,   731,  1618,   343,   242,    48,  -905,
+    -905,  1322,   143,   143,   143,  1241,  1242,  1244,   704,   636,
+     705,   745,   344,  1352,   262,  1956,   479,  1958,   345,  1353,
+     344,   243,   564,   904,   904,   344,   345,   470,   565,  1862,
+     347,   345,   344,   914,   968,   491,   492,   346,   345,  1115,
+    1355,    49,   480,   883,  2088,   346,   293,   829,   830,   831,
+     346,   364,    50,   262,   365,   746,    70,   346,    71,  1023,
+      53,  1526,  1527,  1650,  1651,  1259,   376,   339,   340,   884,
+     119,   352,     1,   377,   352,  1224,  1516,  1225,   347,   221,
+    1335,   222,   954,   231,  1261,   750,  1263,   885,   656,   394,
+     481,  1348,   397,  1450,   526,  1451,   262,   528,   530,   262,
+    -904,   527,  -904,  1265,   262,   531,   232,  -904,  1039,   567,
+     338,  1043,   810,  2155,  1061,   568,  -976,  -545,  -545,  1047,
+     241,     1,  -904,   380,  2140,  2048,  2049,  1706,   482,  2143,
+     343,   242,  2146,  2147,   339,   340,  1712,  1713,    22,   176,
+     177,  1226,  1227,   223,   224,  1228,   120,   543,   747,   440,
+     126,  1279,  1280,  1281,   341,   243,  1925,  1926,  1927,   626,
+    1928,   229,   653,  1183,   441,   627,   344,  1640,  1190,   654,
+     233,  1193,   345,   954,   392,  1202,   442,  1170,  1642,   262,
+     215,   216,   217,   218,   219,   246,   247,   954,   954,  1396,
+     127,   346,   667,  1259,   342,  1059,  -976,  1258,   347,   668,
+    1297,  1254,   148,  1349,  1258,   483,  1298,   248,  1255,  1209,
+     132,   149,  1261,   220,  1263,   387,  1260,   221,  1262,   222,
+    -976,  -976,  -976,  1260,   343,  1262,  2230,   150,   249,   828,
+    1913,  1265,   835,   904,   904,  1264,   654,  2239,   907,   654,
+    -976,   908,  1264,   909,  -220,   654,   921,   151,   654,   433,
+     654,   470,  1271,   668,   262,  1475,  1476,  1477,   250,  1278,
+     344,   223,   224,   604,   605,  1286,   345,   470,  1286,   606,
+    -976,   336,  -209,  -209,  -904,  -904,     6,     7,  -209,   234,
+    -976,  -976,  -220,   192,  -220,   346,  1612,  1023,  1972,   128,
+     221,   129,   222,  1023,   826,  1961,  1154,  1154,   152,  1973,
+     827,  1974,  1975,   898,  1963,  2113,   898,  1856,  -976,   899,
+    -976,  2071,   899,   918,  1023,   973,   819,   812,   153,   919,
+    -220,   627,   982,   986,  2237,  1549,  -220,   915,   983,   983,
+     154,  1040,  1283,  1041,  1167,  1168,   954,   919,  1169,   919,
+     983,   565,  1299,  1172,   983,  -220,  -976,  1022,   592,   568,
+    1173,   483,  -976,   593,  -544,  -544,   627,   193,   194,   145,
+     145,  1397,  1174,  1175,  1253,   199,   200,   201,   627,   627,
+     627,  -976,   202,  1272,  1383,  -976,  1384,  1286,  1886,  1273,
+     155,  1886,   954,  1886,  1390,  1391,  1392,  1058,  1282,  -976,
+    1484,  1288,   347,  1292,   347,   980,   347,  1289,  1402,  1289,
+    1404,  1405,  1407,  1341,  1299,  1343,  1515,  1517,   876,   627,
+     877,  1344,  1516,  1516,  1419,   221,   750,   222,   156,   347,
+    1274,  1286,  1559,  1424,  1425,  1430,  1431,  1432,  1433,  1434,
+    1435,  1436,  1437,  1438,  1439,  1446,  2126,  2126,  1518,  1467,
+     602,  1256,  1257,  1519,  1516,   603,   347,  1458,  1547,  1516,
+    1182,   135,  1460,   225,   627,  1563,   135,  1191,  1565,   135,
+    1856,  1564,   157,   135,  1566,   158,    -3,  1258,  1259,  1570,
+     812,  1472,  1218,  2122,  1572,  1289,  1582,  1027,   696,  1286,
+    1289,  1016,   627,   697,  2126,  1485,  1260,  1261,  1262,  1263,
+    1486,  1494,  1628,   142,   142,  1646,  1154,  1719,  1629,  1488,
+       1,  1647,   159,  1289,  1489,  1264,  1265,  1723,  1727,  1226,
+    1227,   223,   224,  1566,  1289,   253,  1058,  1229,  1230,  1231,
+    1232,  1233,  1234,  1235,  1236,  1237,  1336,  1729,  1337,   915,
+    1730,  1803,  -976,  1289,  1492,   160,  1289,   627,   161,  1493,
+    1505,  1505,  1505,  1505,  1505,  1505,  1505,  1505,  1386,  1238,
+     221,  1804,   222,  1505,  1505,  1505,  1505,   627,  2156,  1806,
+     162,  1180,  1286,  1181,  1813,  1807,  1286,     2,   193,   194,
+    1289,   195,   196,   197,   198,  1022,   199,   200,   201,   163,
+    1817,  1022,  1860,   202,  1586,   133,  1289,  1194,   627,  1017,
+     133,  1585,  1864,   133,  1865,  1594,  1489,   133,   627,   255,
+     627,  1873,  1022,  1621,  1221,  1222,   164,  1289,  1489,  2096,
+    1874,  1606,  1607,   165,  2100,  2101,  1564,  2103,  1619,  2104,
+     260,     3,  1875,  2107,  2108,  1624,  1625,  1876,  1566,  2024,
+    2025,   291,  2210,  1564,  1656,  1289,  1289,  1939,  2026,  1489,
+       4,  1632,  1633,  1657,  1289,  1635,   891,   166,  1658,   135,
+     454,   455,   193,   194,  2223,   195,   196,   197,   198,  2027,
+     199,   200,   201,  2163,  1394,  1289,   221,   202,   222,   919,
+    1649,   203,   204,   205,   206,   207,  1420,  1794,  1811,  1812,
+    1848,  1286,  1795,  1489,  1658,  1849,  1665,  1851,  1867,   491,
+     492,  1868,  1849,  1489,  1670,  1672,  1869,  1870,  1901,  1911,
+    1676,  1678,  1871,  1489,   262,   264,   134,  1947,  1957,  1016,
+       5,  1959,  1948,  1516,   167,  1016,  1516,  2175,   143,   143,
+    2178,  2016,   168,  2181,  2182,   131,  2017,   135,  2238,  1711,
+    1058,   538,  1028,  1489,     6,     7,  1016,  1032,   556,   557,
+    1677,  1679,   169,   213,   214,   215,   216,   217,   218,   219,
+    1286,  1689,    59,   722,    61,  1721,  1722,  1761,   170,  1762,
+     145,   145,   145,   145,   145,   145,   145,   145,   171,  2121,
+    1027,   838,   819,   145,   145,   145,   145,   796,   290,   798,
+    1766,   258,  1767,   133,  1027,   139,   139,   139,   313,  1116,
+    1752,  1151,   719,   347,   720,   347,   721,   347,   330,     8,
+    1412,  1764,   355,   756,   757,   954,  1419,   954,  1419,  1286,
+     134,  1898,  1899,  1619,   327,   134,  1467,   329,   134,  1778,
+    1419,   331,   134,   332,  1781,   139,  1784,   814,  1933,  1934,
+     814,   448,     9,  2132,  1899,  1747,  1749,   812,   685,   687,
+     812,   336,  1796,  2089,  2090,   139,  1731,  1733,  1065,  1066,
+     375,   378,   859,   861,   379,   449,   450,   451,   382,   383,
+     384,   133,   385,   386,   389,   390,   208,   202,  1822,   438,
+     445,   446,   347,   467,   471,   452,   474,  1827,   477,   488,
+     489,   500,   495,   496,  1218,  1229,  1230,  1231,  1232,  1233,
+    1234,  1235,  1236,  1237,   142,   142,   142,   142,   142,   142,
+     142,   142,   356,   357,   358,   453,   497,   142,   142,   142,
+     142,   498,   501,   502,   504,   454,   455,  2168,  1505,  1505,
+     503,  1505,  1505,  1505,  1505,   517,   537,   538,  1505,  1505,
+    1505,  1505,   540,   547,   134,   548,   559,   563,   560,   954,
+     134,   139,   566,   456,   139,   343,   139,   569,  1892,   570,
+     575,   359,   360,   579,   213,   214,   215,   216,   217,   218,
+     219,   134,   743,   744,   580,   584,  1902,   581,   582,   587,
+    1619,   145,   588,   589,   590,   595,   594,   596,   507,   607,
+     615,   344,   608,  1783,   624,  2070,   630,   345,   628,   629,
+     361,   631,   343,   632,   333,   634,   647,   139,    -2,  1919,
+     655,   666,  1920,  1799,   660,  1924,   346,   355,   134,   691,
+     457,   693,   695,   698,   745,   699,   700,   702,  1931,   708,
+     710,   736,  1935,  1936,   458,   729,   742,   751,   344,   753,
+     755,   761,     1,   209,   345,   210,   211,   212,   213,   214,
+     215,   216,   217,   218,   219,   762,   838,   844,   486,   845,
+     847,   848,   849,   346,   364,  1940,   850,   365,   746,   851,
+     855,   856,   857,  1507,  1508,  1509,  1510,  1511,  1512,  1513,
+     865,   877,   894,   900,  1949,  1520,  1521,  1522,  1523,   923,
+     911,   922,   924,   895,   925,   961,   134,   970,   971,   972,
+    1998,   974,   976,   979,   984,  1026,  1029,  2005,  1030,     2,
+    1031,  1033,  2011,  1036,   135,   142,  1037,   356,   357,   358,
+    1038,  1046,  1048,  1049,  1055,  1060,  1063,  1062,  2067,   143,
+     143,   143,   143,   143,   143,   143,   143,   896,  1102,  2029,
+    1105,  1109,   143,   143,   143,   143,  1112,  1113,   145,   145,
+    1161,   145,   145,   145,   145,  2042,  -955,  -956,   145,   145,
+     145,   145,  -957,     3,  1165,  1799,   359,   360,  1166,  1187,
+    1188,     1,  1189,  1192,  1201,  2061,  1203,   743,   744,  1219,
+    2030,  1204,     4,  1205,  1206,  1750,  1207,  1220,  1252,  1239,
+    1755,  1756,  1757,  1758,  1759,  1760,  1251,  1250,  1276,  1277,
+    1268,  1293,  1765,  2075,  1294,   361,  1094,   343,  1303,  1304,
+    1305,  1306,  1307,  1308,  1619,  1309,  1310,  1619,  1311,  1316,
+    2085,  2086,  2087,  1317,   347,  1318,  1327,  1319,  2092,   745,
+    1328,  1329,  1331,  1340,  1342,  2093,  1356,  1330,  1345,  1376,
+    1387,  1073,  1346,   344,  1350,  1388,  1393,  1399,   133,   345,
+    1403,  1398,     5,  1408,  1421,  2127,  2127,  1459,   954,   954,
+    2111,  2112,  1448,  1461,  1462,  1495,  1463,  1464,   346,   364,
+     185,  1473,   365,   746,  1487,  1491,     6,     7,  1496,  1497,
+    1501,  1498,   142,   142,  1542,   142,   142,   142,   142,  1500,
+    1514,  1541,   142,   142,   142,   142,  1543,  1558,  1524,  1536,
+    1537,  1561,  2138,  2127,   145,  1538,  1540,  1074,  1556,  1557,
+    1575,  1478,  1579,    56,    57,    58,  2150,  2151,  1075,  1076,
+      59,    60,    61,    62,  1576,  1581,    63,    64,  1592,  1591,
+    1593,  1596,  1600,  1602,  1603,    65,  1883,  1605,  1619,  1630,
+     143,     8,  1608,   354,  2173,  1620,  1479,   355,  1622,    66,
+      67,    68,  1631,  1627,  1636,  1645,  1652,  1654,  1655,  1680,
+    1077,  1690,  1702,  1675,  1708,  1710,  1681,  1682,  1683,  1684,
+    1685,  1686,  1619,  1687,     9,  2199,  1688,  1691,  1707,  1619,
+    1692,  1693,  1703,  1694,  1718,  1720,  1724,  1078,  1079,  1080,
+    1081,  1082,  1083,  1084,  1085,  1359,  1736,  1737,  1738,  1751,
+     145,  1769,  1770,  1086,  1087,  1088,  1089,  2034,  1023,  1090,
+    1091,  1092,  1093,   193,   194,  1776,   195,   196,   197,   198,
+    1772,   199,   200,   201,  1777,  1805,  1808,  1825,   202,   347,
+    1788,  1789,  1790,   204,   205,   206,   207,  1791,   142,  1792,
+    1793,  1810,  1814,  1286,  1815,  1823,  1816,   356,   357,   358,
+    1828,  1829,  1836,  1831,  1832,  1833,  1834,  1826,   954,  1818,
+    1838,  1839,  1840,  1841,  1837,  1850,  1853,  2229,  1861,  1863,
+    1866,  1877,  1559,   134,  1895,  1993,  1994,  1896,  1903,  1897,
+    1904,  1995,  1908,  1915,  1921,  1929,  1930,  1937,  1954,  2000,
+    2001,  1966,  1967,  1938,  1943,  1955,   359,   360,  1944,  1968,
+    1945,  1946,  1950,  2099,  1714,  1970,  1951,   143,   143,  1952,
+     143,   143,   143,   143,  1953,  1992,  1881,   143,   143,   143,
+     143,  2004,  2002,  2008,  2003,  2006,  2012,  1427,  2015,  2022,
+    2035,  2021,  2031,  2041,   142,   361,  2056,   343,  2036,   362,
+    2043,  2057,  2058,   135,   135,  2059,  1659,  2062,    56,    57,
+      58,  2063,  -981,    69,  2064,    59,    60,    61,    62,   363,
+    2076,    63,    64,  2074,  1762,  2084,  2091,  2097,  2095,  2098,
+      65,  2120,  2102,   344,    70,  2116,    71,  2105,  2106,   345,
+    2123,  1479,  2131,  2136,    66,    67,    68,  2137,  2139,  2141,
+    2142,   135,  2144,  2145,  2157,  2161,  2078,  2079,   346,   364,
+    2148,  2149,   365,   366,  2162,  2190,  2167,  2193,  2169,  2170,
+    2224,  2174,   367,  2172,  2176,  2177,  2179,    72,  2180,  2183,
+    2184,    73,    74,  2187,  2188,  2197,  2204,    75,    76,    77,
+      78,    79,  2205,    80,  2206,  2207,  2208,  2209,    81,    82,
+    2214,  2212,  2215,  2232,  2216,  2240,  2219,  2220,  2065,  2072,
+    2221,  2222,    83,  1094,  2225,    84,  1771,    35,  2236,    85,
+    2233,  2196,  1045,   143,  2081,  1546,   374,  2073,   886,   616,
+    2068,    86,    87,    88,   620,    89,    55,   133,   133,  1854,
+     115,    90,  1701,    91,    92,   910,    52,    93,    94,    95,
+     381,   388,  1490,   727,   868,  2228,  1022,   690,   734,  1797,
+    1420,   646,  1918,  1725,   977,   825,   843,  1027,  1726,  1969,
+    1661,    96,    97,    98,   985,  1809,    99,   100,  1171,  1326,
+    1674,  1354,   688,   101,  1695,   133,  -415,  1480,   102,  1673,
+     853,  -415,  1964,  2194,  1101,   854,   103,   104,  1381,   546,
+       0,     0,  1413,   858,    56,    57,    58,     0,   860,     0,
+       0,    59,    60,    61,    62,     0,     0,    63,    64,   143,
+       0,  2198,     0,  2200,  2201,     0,    65,     0,     0,     0,
+       0,     0,     0,     0,   991,     0,   131,   992,     0,     0,
+      66,    67,    68,     0,     0,     0,     0,     0,    69,    63,
+      64,  2217,     0,     0,     0,     0,   210,   211,   212,   213,
+     214,   215,   216,   217,   218,   219,     0,     0,     0,    70,
+       0,    71,     0,     0,     0,   993,     0,     0,     0,     0,
+     994,   995,     0,     0,     0,   996,   997,   998,     0,   999,
+    2231,  1414,  1000,     0,     0,     0,     0,     0,     0,     0,
+       0,  1415,     0,     0,  1001,  1002,  1003,  1004,     0,     0,
+       0,  1005,    72,     0,     0,     0,    73,    74,     0,     0,
+       0,     0,    75,    76,    77,    78,    79,     0,    80,     0,
+       0,     0,     0,    81,    82,     0,     0,     0,     0,     0,
+       0,     0,     0,  1006,  1007,     0,     0,    83,     0,     0,
+      84,     0,     0,     0,    85,     0,     0,     0,     0,     0,
+       0,     0,   134,   134,     0,     0,    86,    87,    88,     0,
+      89,  1008,     0,     0,     0,  1009,    90,     0,    91,    92,
+       0,     0,    93,    94,    95,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    96,    97,    98,     0,
+     134,    99,   100,     0,     0,     0,     0,     0,   101,     0,
+       0,  -415,  1480,   102,     0,     0,  -415,     0,     0,  1010,
+       0,   103,   104,     0,     0,     0,     0,  2195,     0,    56,
+      57,    58,     0,     0,    69,     0,    59,    60,    61,    62,
+       0,     0,    63,    64,     0,     0,     0,     0,     0,  1011,
+       0,    65,     0,     0,     0,    70,     0,    71,     0,     0,
+       0,     0,   669,   670,     0,    66,    67,    68,     0,     0,
+     671,   672,   673,   674,   675,     0,     0,     0,   676,  1012,
+       0,     0,   677,   678,     0,     0,     0,    70,     0,    71,
+       0,     0,     0,     0,     0,     0,     0,     0,    72,     0,
+       0,     0,    73,    74,  1613,   134,   454,   455,    75,    76,
+      77,    78,    79,     0,    80,     0,     0,     0,     0,    81,
+      82,     0,   679,   680,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    83,     0,     0,    84,     0,     0,     0,
+      85,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    86,    87,    88,     0,    89,     0,     0,     0,
+       0,     0,    90,     0,    91,    92,     0,     0,    93,    94,
+      95,     0,  1422,     0,    56,    57,    58,     0,     0,     0,
+       0,    59,    60,    61,    62,     0,     0,    63,    64,     0,
+       0,     0,    96,    97,    98,     0,    65,    99,   100,  1416,
+       0,     0,     0,     0,   101,     0,     0,     0,     0,   102,
+      66,    67,    68,   669,   670,     0,     0,   103,   104,     0,
+       0,   671,   672,   673,   674,   675,     0,     0,     0,   676,
+       0,     0,     0,   677,   678,     0,     0,     0,  1013,     0,
+       0,   132,     0,     0,     0,     0,     0,  1014,  1015,     0,
+       0,     0,  1614,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   193,   194,     0,   195,   196,   197,   198,    69,
+     199,   200,   201,   679,   680,     0,     0,   202,     0,     0,
+       0,   203,   204,   205,   206,   207,     0,     0,     0,     0,
+      70,     0,    71,     0,     0,     0,  1413,     0,    56,    57,
+      58,     0,     0,     0,     0,    59,    60,    61,    62,     0,
+       0,    63,    64,     0,     0,     0,     0,     0,     0,     0,
+      65,     0,     0,  1114,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    72,    66,    67,    68,    73,    74,     0,
+       0,     0,     0,    75,    76,    77,    78,    79,     0,    80,
+       0,     0,     0,     0,    81,    82,     0,   193,   194,     0,
+     195,   196,   197,   198,     0,   199,   200,   201,    83,     0,
+       0,    84,   202,     0,     0,    85,   203,   204,   205,   206,
+     207,     0,     0,     0,     0,  1414,     0,    86,    87,    88,
+       0,    89,     0,     0,     0,  1415,     0,    90,     0,    91,
+      92,     0,     0,    93,    94,    95,     0,     0,     0,     0,
+       0,     0,     0,     0,    69,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    96,    97,    98,
+       0,     0,    99,   100,     0,    70,     0,    71,     0,   101,
+     -41,     0,     0,     0,   102,     0,  1884,     0,    56,    57,
+      58,     0,   103,   104,     0,    59,    60,    61,    62,     0,
+       0,    63,    64,     0,     0,     0,     0,     0,     0,     0,
+      65,     0,     0,     0,   681,     0,   208,     0,    72,     0,
+       0,     0,    73,    74,    66,    67,    68,     0,    75,    76,
+      77,    78,    79,     0,    80,     0,     0,     0,     0,    81,
+      82,     0,  1742,     0,     0,     0,     0,     0,  1885,     0,
+       0,     0,     0,    83,     0,     0,    84,     0,     0,     0,
+      85,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    86,    87,    88,     0,    89,     0,    69,     0,
+       0,     0,    90,     0,    91,    92,     0,     0,    93,    94,
+      95,     0,     0,     0,     0,     0,     0,     0,     0,    70,
+       0,    71,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   208,    96,    97,    98,     0,     0,    99,   100,   355,
+       0,     0,     0,     0,   101,     0,     0,  -415,     0,   102,
+       0,     0,  -415,     0,     0,     0,     0,   103,   104,     0,
+       0,     0,    72,     0,     0,     0,    73,    74,     0,     0,
+       0,     0,    75,    76,    77,    78,    79,     0,    80,     0,
+       0,     0,     0,    81,    82,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    83,     0,     0,
+      84,     0,   801,   209,    85,   210,   211,   212,   213,   214,
+     215,   216,   217,   218,   219,   804,    86,    87,    88,     0,
+      89,     0,     0,     0,     0,   405,    90,     0,    91,    92,
+     806,     0,    93,    94,    95,     0,     0,     0,     0,   356,
+     357,   807,     0,     0,     0,     0,     0,     0,    69,     0,
+       0,     0,     0,     0,     0,     0,    96,    97,    98,   808,
+       0,    99,   100,     0,     0,     0,     0,     0,   101,    70,
+       0,    71,     0,   102,     0,  1884,     0,    56,    57,    58,
+       0,   103,   104,     0,    59,    60,    61,    62,   359,   360,
+      63,    64,     0,     0,   809,     0,     0,     0,   209,    65,
+     210,   211,   212,   213,   214,   215,   216,   217,   218,   219,
+       0,     0,    72,    66,    67,    68,    73,    74,     0,     0,
+     412,     0,    75,    76,    77,    78,    79,   361,    80,   343,
+       0,  1742,     0,    81,    82,     0,     0,  1889,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    83,     0,     0,
+      84,   745,     0,     0,    85,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   344,    86,    87,    88,     0,
+      89,   345,     0,     0,     0,     0,    90,     0,    91,    92,
+       0,     0,    93,    94,    95,     0,     0,     0,     0,     0,
+     346,   364,     0,     0,   365,   746,     0,     0,     0,     0,
+       0,     0,     0,   234,     0,     0,    96,    97,    98,     0,
+       0,    99,   100,     0,     0,     0,     0,     0,   101,     0,
+       0,     0,     0,   102,     0,  1884,     0,    56,    57,    58,
+       0,   103,   104,     0,    59,    60,    61,    62,     0,     0,
+      63,    64,     0,     0,     0,     0,     0,     0,     0,    65,
+     669,   670,     0,     0,     0,     0,     0,     0,   671,   672,
+     673,   674,   675,    66,    67,    68,   676,     0,   669,   670,
+     677,   678,     0,     0,     0,     0,   671,   672,   673,   674,
+     675,  1742,     0,     0,   676,     0,     0,  1891,   677,   678,
+       0,     0,     0,     0,     0,     0,     0,   193,   194,     0,
+     195,   196,   197,   198,     0,   199,   200,   201,     0,     0,
+     679,   680,   202,     0,     0,     0,     0,    69,   205,   206,
+     207,     0,     0,     0,     0,     0,     0,     0,   679,   680,
+       0,     0,     0,     0,     0,     0,     0,     0,    70,     0,
+      71,     0,     0,     0,     0,     0,     0,     0,     0,  1741,
+       0,    56,    57,    58,     0,     0,     0,     0,    59,    60,
+      61,    62,     0,     0,    63,    64,     0,     0,     0,     0,
+       0,     0,     0,    65,     0,     0,     0,     0,     0,     0,
+       0,    72,     0,     0,     0,    73,    74,    66,    67,    68,
+       0,    75,    76,    77,    78,    79,     0,    80,     0,     0,
+       0,     0,    81,    82,     0,  1742,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    83,     0,     0,    84,
+       0,     0,     0,    85,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    86,    87,    88,     0,    89,
+       0,     0,     0,     0,     0,    90,     0,    91,    92,     0,
+       0,    93,    94,    95,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    69,     0,     0,
+       0,     0,     0,     0,     0,    96,    97,    98,     0,     0,
+      99,   100,     0,     0,     0,     0,     0,   101,    70,     0,
+      71,     0,   102,     0,  1746,     0,    56,    57,    58,     0,
+     103,   104,     0,    59,    60,    61,    62,     0,     0,    63,
+      64,   684,     0,     0,     0,     0,     0,     0,    65,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   686,
+       0,    72,    66,    67,    68,    73,    74,     0,     0,     0,
+       0,    75,    76,    77,    78,    79,     0,    80,     0,     0,
+    1742,     0,    81,    82,     0,   193,   194,     0,   195,   196,
+     197,   198,     0,   199,   200,   201,    83,     0,     0,    84,
+     202,     0,     0,    85,   203,   204,   205,   206,   207,     0,
+       0,     0,     0,     0,     0,    86,    87,    88,     0,    89,
+       0,    69,     0,     0,     0,    90,     0,    91,    92,     0,
+       0,    93,    94,    95,     0,     0,     0,     0,     0,     0,
+       0,     0,    70,     0,    71,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    96,    97,    98,     0,     0,
+      99,   100,     0,     0,     0,     0,     0,   101,     0,     0,
+       0,     0,   102,     0,     0,     0,     0,     0,     0,     0,
+     103,   104,     0,     0,     0,    72,     0,     0,     0,    73,
+      74,     0,     0,     0,     0,    75,    76,    77,    78,    79,
+       0,    80,     0,     0,     0,     0,    81,    82,     0,     0,
+     210,   211,   212,   213,   214,   215,   216,   217,   218,   219,
+      83,     0,  1748,    84,    56,    57,    58,    85,     0,     0,
+       0,    59,    60,    61,    62,     0,     0,    63,    64,    86,
+      87,    88,     0,    89,     0,     0,    65,     0,     0,    90,
+       0,    91,    92,     0,     0,    93,    94,    95,     0,     0,
+      66,    67,    68,     0,     0,     0,    69,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,  1742,    96,
+      97,    98,     0,     0,    99,   100,     0,    70,     0,    71,
+       0,   101,     0,     0,     0,     0,   102,     0,     0,   208,
+       0,     0,     0,     0,   103,   104,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      72,     0,     0,     0,    73,    74,     0,     0,     0,     0,
+      75,    76,    77,    78,    79,     0,    80,     0,     0,     0,
+       0,    81,    82,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    83,     0,  1922,    84,    56,
+      57,    58,    85,     0,     0,     0,    59,    60,    61,    62,
+       0,     0,    63,    64,    86,    87,    88,     0,    89,     0,
+       0,    65,     0,     0,    90,     0,    91,    92,     0,     0,
+      93,    94,    95,     0,     0,    66,    67,    68,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    96,    97,    98,     0,     0,    99,
+     100,     0,     0,     0,     0,     0,   101,     0,     0,     0,
+       0,   102,     0,     0,     0,     0,     0,     0,     0,   103,
+     104,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    69,     0,   209,   289,   210,   211,
+     212,   213,   214,   215,   216,   217,   218,   219,     0,     0,
+       0,     0,     0,     0,     0,    70,     0,    71,  1932,     0,
+       0,   664,     0,    56,    57,    58,     0,     0,     0,     0,
+      59,    60,    61,    62,     0,     0,    63,    64,     0,     0,
+       0,     0,     0,     0,     0,    65,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    72,    66,
+      67,    68,    73,    74,     0,     0,     0,     0,    75,    76,
+      77,    78,    79,     0,    80,     0,     0,     0,     0,    81,
+      82,     0,   193,   194,     0,   195,   196,   197,   198,     0,
+     199,   200,   201,    83,     0,     0,    84,   202,     0,     0,
+      85,   203,   204,   205,   206,   207,     0,     0,     0,     0,
+       0,     0,    86,    87,    88,     0,    89,     0,     0,     0,
+       0,     0,    90,     0,    91,    92,     0,     0,    93,    94,
+      95,     0,     0,     0,     0,     0,     0,     0,     0,    69,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    96,    97,    98,     0,     0,    99,   100,     0,
+      70,     0,    71,     0,   101,     0,     0,     0,     0,   102,
+       0,  1401,     0,    56,    57,    58,     0,   103,   104,     0,
+      59,    60,    61,    62,     0,     0,    63,    64,     0,     0,
+       0,     0,     0,     0,     0,    65,     0,     0,     0,     0,
+       0,     0,     0,    72,     0,     0,     0,    73,    74,    66,
+      67,    68,     0,    75,    76,    77,    78,    79,     0,    80,
+       0,     0,     0,     0,    81,    82,     0,   193,   194,     0,
+     195,   196,   197,   198,     0,   199,   200,   201,    83,     0,
+       0,    84,   202,     0,     0,    85,   203,   204,   205,   206,
+     207,     0,     0,     0,     0,     0,     0,    86,    87,    88,
+       0,    89,     0,    69,     0,     0,     0,    90,     0,    91,
+      92,     0,     0,    93,    94,    95,     0,     0,     0,     0,
+       0,     0,     0,     0,    70,     0,    71,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   208,    96,    97,    98,
+       0,     0,    99,   100,     0,     0,     0,     0,     0,   101,
+       0,     0,  1923,     0,   102,     0,     0,     0,     0,     0,
+       0,     0,   103,   104,     0,     0,     0,    72,     0,     0,
+       0,    73,    74,     0,     0,     0,     0,    75,    76,    77,
+      78,    79,     0,    80,     0,     0,     0,     0,    81,    82,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    83,     0,  1406,    84,    56,    57,    58,    85,
+       0,     0,     0,    59,    60,    61,    62,     0,     0,    63,
+      64,    86,    87,    88,     0,    89,     0,     0,    65,     0,
+       0,    90,     0,    91,    92,     0,     0,    93,    94,    95,
+       0,     0,    66,    67,    68,     0,     0,     0,     0,     0,
+       0,     0,     0,    69,     0,     0,     0,     0,     0,     0,
+       0,    96,    97,    98,     0,     0,    99,   100,     0,     0,
+       0,     0,     0,   101,    70,     0,    71,     0,   102,     0,
+       0,   208,     0,     0,     0,     0,   103,   104,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   209,     0,   210,   211,   212,   213,   214,
+     215,   216,   217,   218,   219,     0,     0,    72,     0,     0,
+       0,    73,    74,     0,     0,   415,     0,    75,    76,    77,
+      78,    79,     0,    80,     0,     0,     0,     0,    81,    82,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    83,     0,  1700,    84,    56,    57,    58,    85,
+       0,     0,     0,    59,    60,    61,    62,     0,     0,    63,
+      64,    86,    87,    88,     0,    89,     0,     0,    65,     0,
+       0,    90,     0,    91,    92,     0,     0,    93,    94,    95,
+       0,     0,    66,    67,    68,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    96,    97,    98,     0,     0,    99,   100,     0,     0,
+       0,     0,     0,   101,     0,     0,     0,     0,   102,     0,
+       0,     0,     0,     0,     0,     0,   103,   104,     0,     0,
+       0,     0,     0,     0,     0,     0,    69,     0,   209,     0,
+     210,   211,   212,   213,   214,   215,   216,   217,   218,   219,
+       0,     0,     0,     0,     0,     0,     0,    70,     0,    71,
+     416,     0,     0,     0,     0,     0,     0,     0,  1997,     0,
+      56,    57,    58,     0,     0,     0,     0,    59,    60,    61,
+      62,     0,     0,    63,    64,     0,     0,     0,     0,     0,
+       0,     0,    65,     0,     0,     0,     0,     0,     0,  2069,
+      72,     0,     0,   355,    73,    74,    66,    67,    68,     0,
+      75,    76,    77,    78,    79,     0,    80,     0,     0,     0,
+       0,    81,    82,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    83,     0,     0,    84,     0,
+       0,     0,    85,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    86,    87,    88,     0,    89,     0,
+       0,     0,     0,     0,    90,     0,    91,    92,     0,     0,
+      93,    94,    95,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    69,     0,     0,     0,
+       0,     0,     0,     0,    96,    97,    98,     0,     0,    99,
+     100,     0,     0,   356,   357,   358,   101,    70,     0,    71,
+       0,   102,     0,     0,     0,     0,     0,     0,     0,   103,
+     104,     0,   193,   194,     0,   195,   196,   197,   198,     0,
+     199,   200,   201,     0,     0,     0,     0,   202,     0,     0,
+       0,   203,   204,   205,   206,   207,     0,     0,     0,     0,
+      72,     0,   359,   360,    73,    74,     0,     0,     0,     0,
+      75,    76,    77,    78,    79,     0,    80,     0,     0,     0,
+       0,    81,    82,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    83,     0,     0,    84,     0,
+       0,   361,    85,   343,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    86,    87,    88,     0,    89,     0,
+      69,     0,     0,     0,    90,   745,    91,    92,     0,     0,
+      93,    94,    95,     0,     0,     0,     0,     0,     0,   344,
+       0,    70,     0,    71,     0,   345,     0,     0,     0,     0,
+       0,     0,     0,     0,    96,    97,    98,     0,     0,    99,
+     100,     0,     0,     0,   346,   364,   101,     0,   365,   746,
+       0,   102,     0,     0,     0,     0,     0,     0,     0,   103,
+     104,     0,     0,     0,    72,     0,     0,     0,    73,    74,
+       0,     0,     0,     0,    75,    76,    77,    78,    79,     0,
+      80,     0,     0,     0,     0,    81,    82,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    83,
+       0,     0,    84,    56,    57,    58,    85,     0,     0,     0,
+      59,    60,    61,    62,     0,     0,    63,    64,    86,    87,
+      88,     0,    89,     0,     0,    65,   208,     0,    90,     0,
+      91,    92,     0,     0,    93,    94,    95,     0,     0,    66,
+      67,    68,     0,     0,     0,     0,   193,   194,     0,   195,
+     196,   197,   198,     0,   199,   200,   201,     0,    96,    97,
+      98,   202,     0,    99,   100,     0,     0,   205,   206,   207,
+     101,     0,     0,     0,     0,   102,  1256,  1257,  1325,     0,
+       0,     0,     0,   103,   104,     0,     0,     0,     0,  1075,
+    1076,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,  1258,  1259,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,  1260,  1261,  1262,  1263,     0,     0,     0,     0,     0,
+       0,  1077,     0,     0,     0,    56,    57,    58,     0,     0,
+    1264,  1265,    59,    60,    61,    62,     0,     0,    63,    64,
+       0,     0,     0,     0,     0,     0,     0,    65,  1078,  1079,
+    1080,  1081,  1082,  1083,  1084,  1085,     0,     0,     0,     0,
+       0,    66,    67,    68,  1086,  1087,  1088,  1089,     0,     0,
+    1090,  1091,  1092,  1093,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   209,     0,   210,   211,   212,   213,   214,
+     215,   216,   217,   218,   219,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   417,     0,     0,     0,     0,
+       0,     0,     0,   193,   194,     0,   195,   196,   197,   198,
+       0,   199,   200,   201,  1258,  1259,     0,     0,   202,     0,
+       0,     0,     0,    69,   205,     0,     0,     0,     0,     0,
+       0,     0,     0,  1260,  1261,  1262,  1263,     0,     0,     0,
+       0,    56,    57,    58,    70,     0,    71,     0,    59,    60,
+      61,    62,  1264,  1265,    63,    64,     0,     0,     0,     0,
+       0,     0,     0,    65,   180,   181,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    66,    67,    68,
+       0,     0,     0,     0,     0,     0,     0,    72,     0,     0,
+       0,    73,    74,     0,     0,     0,     0,    75,    76,    77,
+      78,    79,     0,    80,     0,     0,     0,     0,    81,    82,
+       0,     0,     0,     0,     0,     0,  1613,     0,     0,     0,
+       0,     0,    83,     0,     0,    84,     0,     0,     0,    85,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    86,    87,    88,     0,    89,     0,     0,     0,     0,
+       0,    90,     0,    91,    92,    69,     0,    93,    94,    95,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    70,     0,    71,     0,
+       0,    96,    97,    98,     0,     0,    99,   100,     0,     0,
+       0,     0,     0,   101,     0,     0,     0,     0,   102,     0,
+       0,     0,     0,     0,  1094,     0,   103,   104,     0,     0,
+     211,   212,   213,   214,   215,   216,   217,   218,   219,    72,
+       0,     0,     0,    73,    74,     0,     0,     0,     0,    75,
+      76,    77,    78,    79,     0,    80,     0,     0,     0,     0,
+      81,    82,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    83,     0,     0,    84,     0,     0,
+       0,    85,     0,     0,  1614,     0,     0,     0,     0,     0,
+       0,     0,     0,    86,    87,    88,     0,    89,     0,     0,
+       0,    69,     0,    90,     0,    91,    92,     0,     0,    93,
+      94,    95,     0,     0,     0,     0,     0,     0,    56,    57,
+      58,     0,    70,     0,    71,    59,    60,    61,    62,     0,
+       0,    63,    64,    96,    97,    98,     0,     0,    99,   100,
+      65,     0,     0,     0,     0,   101,     0,     0,     0,     0,
+     102,     0,     0,     0,    66,    67,    68,     0,   103,   104,
+       0,     0,     0,     0,     0,    72,     0,     0,     0,    73,
+      74,     0,     0,     0,     0,    75,    76,    77,    78,    79,
+       0,    80,     0,     0,     0,     0,    81,    82,     0,     0,
+       0,     0,     0,   818,     0,  -163,     0,     0,     0,  -163,
+      83,     0,     0,    84,     0,     0,     0,    85,   212,   213,
+     214,   215,   216,   217,   218,   219,   355,     0,     0,    86,
+      87,    88,     0,    89,     0,     0,  1440,     0,     0,    90,
+       0,    91,    92,     0,     0,    93,    94,    95,     0,     0,
+       0,     0,     0,     0,    56,    57,    58,     0,     0,     0,
+       0,    59,    60,    61,    62,     0,     0,    63,    64,    96,
+      97,    98,     0,     0,    99,   100,    65,   180,   181,     0,
+       0,   101,   182,   802,   803,  -163,   102,     0,     0,     0,
+      66,    67,    68,     0,   103,   104,     0,     0,     0,   805,
+       0,     0,     0,     0,     0,   764,   862,     0,     0,  -163,
+    -163,  -163,   765,     0,   766,     0,   767,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   356,   357,   358,  -163,
+       0,     0,     0,     0,     0,   768,   769,   770,   771,   772,
+     773,   774,   775,   776,   777,   778,   779,   780,   781,   782,
+     783,   784,   785,   786,     0,     0,     0,     0,  -163,  -163,
+       0,     0,     0,     0,     0,     0,     0,  1441,    69,  -163,
+    -163,    56,    57,    58,     0,   359,   360,     0,    59,    60,
+      61,    62,     0,     0,    63,    64,     0,     0,     0,    70,
+       0,    71,     0,    65,     0,     0,     0,  -163,     0,  -163,
+       0,     0,     0,     0,     0,     0,     0,    66,    67,    68,
+       0,     0,     0,     0,   361,     0,   343,     0,     0,     0,
+       0,  -163,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    72,     0,     0,  -163,    73,    74,   745,     0,
+       0,  -163,    75,    76,    77,    78,    79,     0,    80,     0,
+       0,     0,   344,    81,    82,     0,     0,   810,   345,     0,
+    -163,  -163,     0,     0,  -163,  -163,     0,    83,     0,     0,
+      84,     0,     0,     0,    85,     0,     0,   346,   364,  1426,
+       0,   365,   746,     0,     0,     0,    86,    87,    88,     0,
+      89,     0,     0,     0,    69,     0,    90,     0,    91,    92,
+       0,     0,    93,    94,    95,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    70,     0,    71,     0,     0,
+       0,     0,     0,     0,     0,     0,    96,    97,    98,     0,
+       0,    99,   100,     0,     0,     0,     0,     0,   101,     0,
+       0,     0,     0,   102,     0,     0,     0,     0,     0,  1014,
+    1427,   103,   104,     0,     0,     0,     0,     0,    72,     0,
+       0,     0,    73,    74,     0,     0,     0,     0,    75,    76,
+      77,    78,    79,     0,    80,     0,     0,     0,     0,    81,
+      82,    56,    57,    58,     0,     0,     0,     0,    59,    60,
+      61,    62,     0,    83,    63,    64,    84,     0,     0,     0,
+      85,     0,     0,    65,     0,     0,     0,     0,     0,     0,
+       0,    69,    86,    87,    88,     0,    89,    66,    67,    68,
+       0,  -163,    90,     0,    91,    92,     0,     0,    93,    94,
+      95,     0,    70,     0,    71,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    96,    97,    98,     0,  1613,    99,   100,     0,
+       0,     0,     0,     0,   101,   182,     0,     0,     0,   102,
+       0,     0,     0,     0,     0,    72,     0,   103,   104,    73,
+      74,     0,     0,     0,     0,    75,    76,    77,    78,    79,
+       0,    80,     0,     0,     0,     0,    81,    82,    56,    57,
+      58,     0,     0,     0,     0,    59,    60,    61,    62,     0,
+      83,    63,    64,    84,     0,     0,     0,    85,     0,     0,
+      65,   180,   181,     0,     0,     0,     0,     0,     0,    86,
+      87,    88,     0,    89,    66,    67,    68,     0,     0,    90,
+       0,    91,    92,     0,     0,    93,    94,    95,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    96,
+      97,    98,     0,     0,    99,   100,     0,     0,     0,     0,
+       0,   101,     0,     0,     0,     0,   102,     0,     0,     0,
+       0,     0,  1014,  1427,   103,   104,     0,     0,     0,     0,
+       0,     0,     0,     0,  1614,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    56,    57,    58,     0,     0,
+       0,    69,    59,    60,    61,    62,     0,     0,    63,    64,
+       0,     0,   764,   962,     0,     0,     0,    65,     0,   765,
+       0,   766,    70,   767,    71,     0,     0,     0,     0,     0,
+       0,    66,    67,    68,     0,     0,     0,     0,     0,     0,
+       0,     0,   768,   769,   770,   771,   772,   773,   774,   775,
+     776,   777,   778,   779,   780,   781,   782,   783,   784,   785,
+     786,     0,     0,     0,     0,    72,     0,     0,     0,    73,
+      74,     0,     0,     0,     0,    75,    76,    77,    78,    79,
+       0,    80,     0,     0,     0,     0,    81,    82,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      83,     0,     0,    84,     0,     0,     0,    85,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    69,    86,
+      87,    88,     0,    89,     0,     0,     0,     0,     0,    90,
+       0,    91,    92,     0,     0,    93,    94,    95,     0,    70,
+       0,    71,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    96,
+      97,    98,     0,     0,    99,   100,     0,     0,     0,     0,
+       0,   101,  2082,     0,     0,     0,   102,     0,     0,     0,
+       0,     0,    72,     0,   103,   104,    73,    74,     0,     0,
+       0,     0,    75,    76,    77,    78,    79,     0,    80,     0,
+       0,     0,     0,    81,    82,    56,    57,    58,     0,     0,
+       0,     0,    59,    60,    61,    62,     0,    83,    63,    64,
+      84,     0,     0,     0,    85,     0,     0,    65,     0,     0,
+       0,     0,     0,     0,     0,    69,    86,    87,    88,     0,
+      89,    66,    67,    68,     0,     0,    90,     0,    91,    92,
+       0,     0,    93,    94,    95,     0,    70,     0,    71,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    96,    97,    98,     0,
+    1613,    99,   100,     0,     0,     0,     0,     0,   101,     0,
+       0,     0,     0,   102,     0,     0,     0,     0,     0,    72,
+       0,   103,   104,    73,    74,     0,     0,     0,     0,    75,
+      76,    77,    78,    79,     0,    80,     0,     0,     0,     0,
+      81,    82,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    83,     0,     0,    84,    56,    57,
+      58,    85,     0,     0,     0,    59,    60,    61,    62,     0,
+       0,    63,    64,    86,    87,    88,     0,    89,     0,     0,
+      65,     0,     0,    90,     0,    91,    92,     0,     0,    93,
+      94,    95,     0,     0,    66,    67,    68,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    96,    97,    98,     0,     0,    99,   100,
+       0,     0,     0,     0,     0,   101,     0,     0,     0,     0,
+     102,     0,   464,     0,     0,   465,     0,     0,   103,   104,
+       0,     0,     0,     0,     0,  1414,     0,     0,  1614,     0,
+       0,     0,     0,     0,     0,  1415,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    69,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    56,    57,    58,     0,    70,     0,    71,    59,
+      60,    61,    62,     0,     0,    63,    64,     0,     0,     0,
+       0,     0,     0,     0,    65,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    66,    67,
+      68,     0,     0,     0,     0,     0,     0,     0,     0,    72,
+       0,     0,     0,    73,    74,     0,     0,     0,     0,    75,
+      76,    77,    78,    79,     0,    80,     0,     0,     0,     0,
+      81,    82,     0,     0,     0,     0,     0,  1613,     0,     0,
+       0,     0,     0,     0,    83,     0,     0,    84,     0,     0,
+       0,    85,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    86,    87,    88,     0,    89,     0,     0,
+       0,     0,     0,    90,     0,    91,    92,     0,    69,    93,
+      94,    95,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    70,
+       0,    71,     0,    96,    97,    98,     0,     0,    99,   100,
+       0,     0,     0,     0,     0,   101,     0,     0,     0,     0,
+     102,     0,     0,     0,     0,     0,     0,     0,   103,   104,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    72,     0,     0,     0,    73,    74,     0,     0,
+       0,     0,    75,    76,    77,    78,    79,     0,    80,     0,
+       0,     0,     0,    81,    82,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    83,     0,     0,
+      84,     0,     0,     0,    85,  1614,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    86,    87,    88,     0,
+      89,     0,    69,     0,     0,     0,    90,     0,    91,    92,
+       0,     0,    93,    94,    95,     0,     0,     0,     0,     0,
+       0,     0,     0,    70,     0,    71,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    96,    97,    98,     0,
+       0,    99,   100,     0,  1971,     0,  -167,     0,   101,     0,
+    -167,     0,     0,   102,     0,     0,     0,     0,     0,     0,
+       0,   103,   104,     0,     0,     0,    72,     0,     0,     0,
+      73,    74,     0,     0,     0,     0,    75,    76,    77,    78,
+      79,     0,    80,     0,     0,     0,     0,    81,    82,    56,
+      57,    58,     0,     0,     0,     0,    59,    60,    61,    62,
+       0,    83,    63,    64,    84,     0,     0,     0,    85,     0,
+       0,    65,     0,     0,     0,     0,     0,     0,  -130,     0,
+      86,    87,    88,     0,    89,    66,    67,    68,     0,     0,
+      90,     0,    91,    92,     0,     0,    93,    94,    95,     0,
+       0,     0,     0,  1798,     0,     0,     0,     0,     0,  1917,
+    -167,  -167,  -167,     0,     0,     0,     0,     0,     0,     0,
+      96,    97,    98,     0,     0,    99,   100,     0,     0,  -130,
+       0,     0,   101,     0,     0,     0,     0,  1905,     0,     0,
+       0,     0,     0,     0,     0,   103,   104,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,  -167,
+    -167,     0,     0,     0,     0,     0,    56,    57,    58,     0,
+       0,     0,     0,    59,    60,    61,    62,     0,     0,    63,
+      64,     0,     0,     0,     0,     0,     0,     0,    65,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,  -167,     0,
+    -167,     0,    66,    67,    68,  -982,     0,     0,     0,     0,
+       0,     0,     0,     0,   -19,     0,     0,     0,     0,     0,
+       0,     0,  -167,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,  -167,     0,     0,     0,
+       0,  1972,  -167,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,  1973,     0,  1974,  1975,     0,     0,     0,     0,
+       0,  -167,  -167,     0,  1976,  -167,  -167,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,  1977,     0,
+       0,     0,     0,    56,    57,    58,     0,     0,     0,    69,
+      59,    60,    61,    62,     0,     0,    63,    64,     0,     0,
+       0,     0,     0,     0,     0,    65,     0,     0,     0,     0,
+      70,     0,    71,     0,     0,     0,     0,     0,     0,    66,
+      67,    68,     0,     0,     0,     0,     0,     0,     0,   193,
+     194,     0,   195,   196,   197,   198,     0,   199,   200,   201,
+       0,     0,   434,   435,   202,     0,     0,     0,   203,   204,
+     205,   206,   207,    72,     0,     0,     0,    73,    74,     0,
+       0,     0,     0,    75,    76,    77,    78,    79,     0,    80,
+       0,     0,     0,     0,    81,    82,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    83,     0,
+       0,    84,     0,     0,     0,    85,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    69,    86,    87,    88,
+       0,    89,     0,     0,     0,     0,     0,    90,     0,    91,
+      92,     0,     0,    93,    94,    95,     0,    70,     0,    71,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    96,    97,    98,
+       0,     0,    99,   100,     0,     0,     0,     0,     0,   101,
+       0,     0,     0,     0,   102,     0,     0,     0,     0,     0,
+      72,     0,   103,   104,    73,    74,     0,     0,     0,     0,
+      75,    76,    77,    78,    79,     0,    80,     0,     0,     0,
+       0,    81,    82,    56,    57,    58,     0,     0,     0,     0,
+      59,    60,    61,    62,     0,    83,    63,    64,    84,     0,
+       0,     0,    85,     0,     0,    65,     0,     0,     0,     0,
+       0,     0,     0,    69,    86,    87,    88,     0,    89,    66,
+      67,    68,     0,     0,    90,     0,    91,    92,     0,     0,
+      93,    94,    95,   208,    70,     0,    71,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    96,    97,    98,     0,     0,    99,
+     100,     0,     0,     0,     0,     0,   101,   138,     0,     0,
+       0,   102,     0,     0,     0,     0,     0,    72,     0,   103,
+     104,    73,    74,     0,     0,     0,     0,    75,    76,    77,
+      78,    79,     0,    80,     0,     0,     0,     0,    81,    82,
+      56,    57,    58,     0,     0,     0,     0,    59,    60,    61,
+      62,     0,    83,    63,    64,    84,     0,     0,     0,    85,
+       0,     0,    65,     0,     0,     0,     0,     0,     0,     0,
+       0,    86,    87,    88,     0,    89,    66,    67,    68,     0,
+       0,    90,     0,    91,    92,     0,     0,    93,    94,    95,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    96,    97,    98,     0,     0,    99,   100,     0,     0,
+       0,     0,     0,   101,     0,     0,   256,     0,   102,     0,
+       0,     0,     0,     0,     0,     0,   103,   104,     0,     0,
+     209,   436,   210,   211,   212,   213,   214,   215,   216,   217,
+     218,   219,     0,     0,     0,     0,     0,    56,    57,    58,
+       0,   437,     0,    69,    59,    60,    61,    62,     0,     0,
+      63,    64,     0,     0,     0,     0,     0,     0,     0,    65,
+       0,     0,     0,     0,    70,     0,    71,     0,     0,     0,
+       0,     0,     0,    66,    67,    68,     0,     0,     0,     0,
+       0,     0,     0,   193,   194,     0,   195,   196,   197,   198,
+       0,   199,   200,   201,     0,     0,     0,     0,   202,     0,
+       0,     0,   203,   204,   205,   206,   207,    72,     0,     0,
+       0,    73,    74,     0,     0,     0,     0,    75,    76,    77,
+      78,    79,     0,    80,     0,     0,     0,     0,    81,    82,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    83,     0,     0,    84,     0,     0,     0,    85,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      69,    86,    87,    88,     0,    89,     0,     0,     0,     0,
+       0,    90,     0,    91,    92,     0,     0,    93,    94,    95,
+       0,    70,     0,    71,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    96,    97,    98,     0,     0,    99,   100,     0,     0,
+       0,     0,     0,   101,     0,     0,   325,     0,   102,     0,
+       0,     0,     0,     0,    72,     0,   103,   104,    73,    74,
+       0,     0,     0,     0,    75,    76,    77,    78,    79,     0,
+      80,     0,     0,     0,     0,    81,    82,    56,    57,    58,
+       0,     0,     0,     0,    59,    60,    61,    62,     0,    83,
+      63,    64,    84,     0,     0,     0,    85,     0,     0,    65,
+       0,     0,     0,     0,     0,     0,     0,    69,    86,    87,
+      88,     0,    89,    66,    67,    68,     0,     0,    90,     0,
+      91,    92,     0,     0,    93,    94,    95,   208,    70,     0,
+      71,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    96,    97,
+      98,     0,     0,    99,   100,     0,     0,     0,     0,     0,
+     101,     0,     0,     0,     0,   102,   428,     0,     0,     0,
+       0,    72,     0,   103,   104,    73,    74,     0,     0,     0,
+       0,    75,    76,    77,    78,    79,     0,    80,     0,     0,
+       0,     0,    81,    82,    56,    57,    58,     0,     0,     0,
+       0,    59,    60,    61,    62,     0,    83,    63,    64,    84,
+       0,     0,     0,    85,     0,     0,    65,   901,     0,     0,
+       0,     0,     0,     0,     0,    86,    87,    88,     0,    89,
+      66,    67,    68,     0,     0,    90,     0,    91,    92,     0,
+       0,    93,    94,    95,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    96,    97,    98,     0,     0,
+     902,   903,     0,     0,     0,     0,     0,   101,     0,     0,
+       0,     0,   102,     0,     0,     0,     0,     0,     0,     0,
+     103,   104,     0,     0,   209,   561,   210,   211,   212,   213,
+     214,   215,   216,   217,   218,   219,     0,     0,     0,     0,
+       0,    56,    57,    58,     0,   562,  1042,    69,    59,    60,
+      61,    62,     0,     0,    63,    64,     0,     0,     0,     0,
+       0,     0,     0,    65,     0,     0,     0,     0,    70,     0,
+      71,     0,     0,     0,     0,     0,     0,    66,    67,    68,
+       0,     0,     0,     0,     0,     0,     0,   193,   194,     0,
+     195,   196,   197,   198,     0,   199,   200,   201,     0,     0,
+       0,     0,   202,     0,     0,     0,   203,   204,   205,   206,
+     207,    72,     0,     0,     0,    73,    74,     0,     0,     0,
+       0,    75,    76,    77,    78,    79,     0,    80,     0,     0,
+       0,     0,    81,    82,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    83,     0,     0,    84,
+       0,     0,     0,    85,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    69,    86,    87,    88,     0,    89,
+       0,     0,     0,     0,     0,    90,     0,    91,    92,     0,
+       0,    93,    94,    95,     0,    70,     0,    71,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    96,    97,    98,     0,     0,
+      99,   100,     0,     0,     0,     0,     0,   101,     0,     0,
+       0,     0,   102,     0,     0,     0,     0,     0,    72,     0,
+     103,   104,    73,    74,     0,     0,     0,     0,    75,    76,
+      77,    78,    79,     0,    80,     0,     0,     0,     0,    81,
+      82,    56,    57,    58,     0,     0,     0,     0,    59,    60,
+      61,    62,     0,    83,    63,    64,    84,     0,     0,     0,
+      85,     0,     0,    65,     0,     0,     0,     0,     0,     0,
+       0,    69,    86,    87,    88,     0,    89,    66,    67,    68,
+       0,     0,    90,     0,    91,    92,     0,     0,    93,    94,
+      95,   208,    70,     0,    71,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    96,    97,    98,     0,     0,    99,   100,     0,
+       0,     0,     0,     0,   101,     0,  1208,     0,     0,   102,
+       0,     0,     0,     0,     0,    72,     0,   103,   104,    73,
+      74,     0,     0,     0,     0,    75,    76,    77,    78,    79,
+       0,    80,     0,     0,     0,     0,    81,    82,    56,    57,
+      58,     0,     0,     0,     0,    59,    60,    61,    62,     0,
+      83,    63,    64,    84,     0,     0,     0,    85,     0,     0,
+      65,     0,     0,     0,     0,     0,     0,     0,     0,    86,
+      87,    88,     0,    89,    66,    67,    68,     0,     0,    90,
+       0,    91,    92,     0,     0,    93,    94,    95,     0,     0,
+       0,     0,  1798,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    96,
+      97,    98,     0,     0,    99,   100,     0,     0,     0,     0,
+       0,   101,     0,     0,     0,  1714,   102,     0,     0,     0,
+       0,     0,     0,     0,   103,   104,     0,     0,   209,   737,
+     210,   211,   212,   213,   214,   215,   216,   217,   218,   219,
+       0,     0,     0,     0,     0,    56,    57,    58,     0,   738,
+       0,    69,    59,    60,    61,    62,     0,     0,    63,    64,
+       0,     0,     0,     0,     0,     0,     0,    65,     0,     0,
+       0,     0,    70,     0,    71,     0,     0,     0,     0,     0,
+       0,    66,    67,    68,     0,     0,     0,     0,     0,     0,
+       0,   193,   194,     0,   195,   196,   197,   198,     0,   199,
+     200,   201,     0,     0,     0,     0,   202,     0,     0,     0,
+     203,   204,   205,   206,   207,    72,     0,     0,     0,    73,
+      74,     0,     0,     0,     0,    75,    76,    77,    78,    79,
+       0,    80,     0,     0,     0,     0,    81,    82,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      83,     0,     0,    84,     0,     0,     0,    85,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    69,    86,
+      87,    88,     0,    89,     0,     0,     0,     0,     0,    90,
+       0,    91,    92,     0,     0,    93,    94,    95,     0,    70,
+       0,    71,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    96,
+      97,    98,     0,     0,    99,   100,     0,     0,     0,     0,
+       0,   101,     0,     0,  1782,     0,   102,     0,     0,     0,
+       0,     0,    72,     0,   103,   104,    73,    74,     0,     0,
+       0,     0,    75,    76,    77,    78,    79,     0,    80,     0,
+       0,     0,     0,    81,    82,    56,    57,    58,     0,     0,
+       0,     0,    59,    60,    61,    62,     0,    83,    63,    64,
+      84,     0,     0,     0,    85,     0,     0,    65,     0,     0,
+       0,     0,     0,     0,     0,    69,    86,    87,    88,     0,
+      89,    66,    67,    68,     0,     0,    90,     0,    91,    92,
+       0,     0,    93,    94,    95,   208,    70,     0,    71,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    96,    97,    98,     0,
+       0,    99,   100,     0,     0,     0,     0,     0,   101,     0,
+       0,     0,     0,   102,     0,     0,     0,     0,     0,    72,
+       0,   103,   104,    73,    74,     0,     0,     0,     0,    75,
+      76,    77,    78,    79,     0,    80,     0,     0,     0,     0,
+      81,    82,    56,    57,    58,     0,     0,     0,     0,    59,
+      60,    61,    62,     0,    83,    63,    64,    84,     0,     0,
+       0,    85,     0,     0,    65,     0,     0,     0,     0,     0,
+       0,     0,     0,    86,    87,    88,     0,    89,    66,    67,
+      68,     0,     0,    90,     0,    91,    92,     0,     0,    93,
+      94,    95,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    96,    97,    98,     0,     0,    99,   100,
+       0,     0,     0,     0,     0,   101,     0,     0,  2060,     0,
+     102,     0,     0,     0,     0,     0,     0,     0,   103,   104,
+       0,     0,   209,     0,   210,   211,   212,   213,   214,   215,
+     216,   217,   218,   219,     0,     0,     0,     0,     0,    56,
+      57,    58,     0,   621,     0,    69,    59,    60,    61,    62,
+       0,     0,    63,    64,     0,     0,   764,   963,     0,     0,
+       0,    65,     0,   765,     0,   766,    70,   767,    71,     0,
+       0,     0,     0,     0,     0,    66,    67,    68,     0,     0,
+       0,     0,     0,     0,     0,     0,   768,   769,   770,   771,
+     772,   773,   774,   775,   776,   777,   778,   779,   780,   781,
+     782,   783,   784,   785,   786,     0,     0,     0,     0,    72,
+       0,     0,     0,    73,    74,     0,     0,     0,     0,    75,
+      76,    77,    78,    79,     0,    80,     0,     0,     0,     0,
+      81,    82,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    83,     0,     0,    84,     0,     0,
+       0,    85,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    69,    86,    87,    88,     0,    89,     0,     0,
+       0,     0,     0,    90,     0,    91,    92,     0,     0,    93,
+      94,    95,     0,    70,     0,    71,     0,     0,     0,     0,
+       0,   193,   194,     0,   195,   196,   197,   198,     0,   199,
+     200,   201,     0,    96,    97,    98,   202,     0,    99,   100,
+     203,   204,   205,   206,   207,   101,     0,     0,     0,     0,
+     102,     0,     0,     0,     0,     0,    72,     0,   103,   104,
+      73,    74,     0,     0,     0,     0,    75,    76,    77,    78,
+      79,     0,    80,     0,     0,     0,     0,    81,    82,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    83,     0,     0,    84,     0,     0,     0,    85,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    69,
+      86,    87,    88,     0,    89,     0,     0,     0,     0,     0,
+      90,     0,    91,    92,     0,     0,    93,    94,    95,     0,
+      70,     0,    71,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      96,    97,    98,     0,     0,    99,   100,     0,     0,     0,
+       0,     0,  1671,     0,     0,     0,     0,   102,     0,     0,
+       0,     0,     0,    72,     0,   103,   104,    73,    74,     0,
+       0,     0,     0,    75,    76,    77,    78,    79,     0,    80,
+       0,     0,     0,     0,    81,    82,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    83,     0,
+       0,    84,     0,     0,     0,    85,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    86,    87,    88,
+       0,    89,     0,     0,     0,   208,     0,    90,     0,    91,
+      92,     0,     0,    93,    94,    95,     0,     0,   991,     0,
+     131,   992,     0,     0,     0,     0,     0,     0,     0,     0,
+     818,     0,  -163,    63,    64,     0,  -163,    96,    97,    98,
+       0,     0,    99,   100,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   102,     0,     0,     0,     0,   993,
+       0,     0,   103,   104,   994,   995,     0,     0,     0,   996,
+     997,   998,     0,   999,     0,     0,  1000,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,  1001,  1002,
+    1003,  1004,     0,     0,     0,  1005,   173,     0,    56,    57,
+      58,     0,     0,     0,     0,    59,    60,    61,    62,     0,
+     802,   803,  -163,     0,     0,     0,     0,     0,     0,     0,
+      65,     0,     0,     0,     0,     0,   805,  1006,  1007,     0,
+       0,     0,     0,     0,     0,     0,  -163,  -163,  -163,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,  1008,  -163,     0,     0,  1009,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   209,     0,   210,   211,   212,   213,   214,   215,
+     216,   217,   218,   219,     0,  -163,  -163,     0,     0,     0,
+       0,     0,     0,   622,     0,     0,  -163,  -163,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,  1010,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,  -163,   190,  -163,    56,    57,    58,
+       0,     0,     0,     0,    59,    60,    61,    62,     0,     0,
+       0,     0,     0,  1011,     0,     0,     0,     0,  -163,    65,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,  -163,     0,     0,     0,     0,     0,  -163,     0,
+       0,     0,     0,  1012,     0,     0,     0,     0,     0,     0,
+       0,    70,     0,    71,   810,     0,     0,  -163,  -163,     0,
+       0,  -163,  -163,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    56,
+      57,    58,     0,     0,     0,     0,    59,    60,    61,    62,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    65,     0,     0,     0,     0,     0,     0,    69,     0,
+       0,     0,     0,     0,     0,   193,   194,     0,   195,   196,
+     197,   198,     0,   199,   200,   201,     0,     0,     0,    70,
+     202,    71,     0,     0,   203,   204,   205,   206,   207,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    72,     0,     0,     0,    73,    74,     0,     0,
+       0,     0,    75,    76,    77,    78,    79,     0,    80,     0,
+       0,     0,     0,    81,    82,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   132,     0,    83,     0,     0,
+      84,  1014,  1015,     0,    85,  -916,     0,     0,  -163,     0,
+       0,     0,     0,     0,     0,     0,    86,    87,    88,     0,
+      89,     0,     0,     0,     0,     0,    90,    69,    91,    92,
+       0,     0,    93,    94,    95,     0,     0,    56,    57,    58,
+       0,     0,     0,     0,    59,    60,    61,    62,    70,     0,
+      71,     0,     0,     0,     0,     0,     0,     0,     0,    65,
+       0,     0,     0,     0,     0,     0,     0,     0,   101,     0,
+       0,     0,     0,   141,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    72,     0,     0,  1502,    73,    74,     0,     0,     0,
+       0,    75,    76,    77,    78,    79,     0,    80,     0,    69,
+       0,     0,    81,    82,     0,     0,     0,     0,     0,   208,
+       0,     0,     0,     0,  1503,     0,    83,     0,     0,    84,
+      70,     0,    71,    85,  1504,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    86,    87,    88,     0,    89,
+       0,     0,     0,     0,     0,    90,     0,    91,    92,     0,
+       0,    93,    94,    95,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    72,     0,     0,     0,    73,    74,     0,
+       0,     0,     0,    75,    76,    77,    78,    79,     0,    80,
+       0,     0,     0,     0,    81,    82,     0,   101,     0,     0,
+       0,     0,   141,     0,     0,     0,     0,     0,    83,     0,
+       0,    84,     0,     0,     0,    85,    56,    57,    58,     0,
+       0,     0,     0,    59,    60,    61,    62,    86,    87,    88,
+       0,    89,     0,     0,     0,     0,     0,    90,    65,    91,
+      92,     0,     0,    93,    94,    95,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   186,   187,   188,
+       0,     0,     0,     0,     0,     0,     0,    69,     0,   101,
+       0,     0,     0,     0,   141,     0,   209,     0,   210,   211,
+     212,   213,   214,   215,   216,   217,   218,   219,    70,     0,
+      71,     0,     0,     0,    56,    57,    58,   623,     0,     0,
+       0,    59,    60,    61,    62,   193,   194,     0,   195,   196,
+     197,   198,     0,   199,   200,   201,    65,     0,     0,     0,
+     202,     0,     0,     0,   203,   204,   205,   206,   207,     0,
+       0,    72,     0,     0,     0,    73,    74,     0,     0,     0,
+       0,    75,    76,    77,    78,    79,     0,    80,     0,     0,
+       0,     0,    81,    82,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    83,     0,     0,    84,
+       0,     0,     0,    85,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    86,    87,    88,     0,    89,
+       0,     0,     0,     0,     0,    90,     0,    91,    92,     0,
+       0,    93,    94,    95,     0,     0,     0,     0,     0,     0,
+      56,    57,    58,     0,     0,     0,     0,    59,    60,    61,
+      62,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,    65,     0,     0,     0,     0,   101,     0,     0,
+     764,     0,   141,     0,     0,     0,    69,   765,   964,   766,
+       0,   767,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    70,     0,    71,
+     965,   966,   967,   771,   772,   773,   774,   775,   776,   777,
+     778,   779,   780,   781,   782,   783,   784,   785,   786,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      72,     0,     0,     0,    73,    74,     0,     0,     0,   208,
+      75,    76,    77,    78,    79,     0,    80,     0,     0,     0,
+       0,    81,    82,     0,    69,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    83,     0,     0,    84,     0,
+       0,     0,    85,     0,     0,    70,  1034,    71,     0,     0,
+       0,     0,     0,     0,    86,    87,    88,     0,    89,     0,
+       0,     0,     0,     0,    90,     0,    91,    92,     0,     0,
+      93,    94,    95,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    72,     0,
+       0,     0,    73,    74,     0,     0,     0,     0,    75,    76,
+      77,    78,    79,     0,    80,     0,   101,     0,     0,    81,
+      82,   141,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,    83,     0,     0,    84,     0,     0,     0,
+      85,     0,     0,     0,  1035,     0,     0,     0,     0,     0,
+      69,     0,    86,    87,    88,     0,    89,     0,     0,     0,
+       0,     0,    90,     0,    91,    92,     0,     0,    93,    94,
+      95,    70,     0,    71,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   209,     0,   210,   211,
+     212,   213,   214,   215,   216,   217,   218,   219,     0,     0,
+       0,     0,     0,     0,   101,     0,     0,   711,     0,   141,
+       0,     0,     0,     0,    72,     0,     0,     0,    73,    74,
+       0,     0,     0,     0,    75,    76,    77,    78,    79,     0,
+      80,     0,     0,     0,     0,    81,    82,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    83,
+       0,     0,    84,     0,     0,     0,    85,   926,     0,  -220,
+       0,     0,     0,  -220,   927,     0,     0,     0,    86,    87,
+      88,     0,    89,     0,     0,     0,     0,     0,    90,     0,
+      91,    92,     0,     0,    93,    94,    95,     0,     0,     0,
+       1,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,  -220,  -220,   928,  1152,  -220,  -220,  -220,   929,     0,
+       0,  -220,     0,     0,   930,     0,     0,     0,     0,     0,
+     101,     0,     0,     0,     0,   141,  -220,   931,     0,     0,
+       0,   932,     0,     0,   933,     0,  -220,   934,   935,  -220,
+       0,     0,  -220,     0,  -220,  -220,     0,  -220,  -220,  -220,
+    -220,  -220,  -220,   936,  -220,  -220,     0,     0,     0,     0,
+     937,   938,  -220,  -220,  -220,  -220,     0,     0,  -220,  -220,
+    -220,  -220,  -220,     0,     0,   939,  -220,     0,     0,  -220,
+    -220,     0,   940,  -220,  -220,  -220,  -220,  -220,  -220,  -220,
+    -220,  -220,   941,     0,     0,  -220,     0,     0,     0,  -220,
+    -220,  -220,  -220,     0,     0,     0,     0,     0,     0,     0,
+       0,   942,  -220,  -220,     0,     0,   943,   944,  -220,     0,
+       0,     0,   193,   194,     0,   195,   196,   197,   198,     0,
+     199,   200,   201,     0,     0,     0,     0,   202,     0,  -220,
+    -220,   203,   204,   205,   206,   207,     0,     0,     0,     0,
+       0,  -220,     0,  -220,     0,  -984,     0,     0,     0,     0,
+       0,     0,   193,   194,     0,   195,   196,   197,   198,     0,
+     199,   200,   201,     0,     0,  -220,     0,   202,     0,     0,
+    -220,   203,   204,   205,   206,   207,     0,   945,     0,  -220,
+       0,     0,     0,     0,     0,  -220,     0,     0,     0,     0,
+       0,     0,     0,  -220,     0,     0,     0,     0,     0,     0,
+       0,   810,     0,     0,  -220,  -220,     0,     0,  -220,  -220,
+     193,   194,     0,   195,   196,   197,   198,  -220,   199,   200,
+     201,   946,     0,     0,     0,   202,     0,   947,   948,   203,
+     204,   205,   206,   207,   193,   194,     0,   195,   196,   197,
+     198,     0,   199,   200,   201,     0,     0,     0,     0,   202,
+       0,     0,     0,   203,   204,   205,   206,   207,  1773,   193,
+     194,  -220,   195,   196,   197,   198,   764,   199,   200,   201,
+       0,     0,     0,   765,   202,   766,     0,   767,   203,   204,
+     205,   206,   207,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   768,   769,   770,   771,
+     772,   773,   774,   775,   776,   777,   778,   779,   780,   781,
+     782,   783,   784,   785,   786,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   208,     0,     0,     0,
+    -220,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,  1153,     0,     0,     0,     0,   208,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   193,   194,     0,   195,   196,   197,   198,
+       0,   199,   200,   201,   208,  1774,     0,     0,   202,     0,
+       0,     0,   203,   204,   205,   206,   207,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   193,   194,   208,   195,
+     196,   197,   198,     0,   199,   200,   201,     0,     0,     0,
+       0,   202,     0,     0,     0,   203,   204,   205,   206,   207,
+       0,     0,     0,   208,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   209,     0,   210,   211,   212,   213,   214,
+     215,   216,   217,   218,   219,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   760,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   209,     0,   210,   211,   212,   213,   214,
+     215,   216,   217,   218,   219,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   920,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   209,     0,   210,   211,   212,   213,   214,   215,   216,
+     217,   218,   219,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,  1912,     0,     0,   209,     0,   210,   211,   212,
+     213,   214,   215,   216,   217,   218,   219,   208,     0,     0,
+     926,  1775,  -220,     0,   292,     0,  -220,   927,     0,     0,
+     209,     0,   210,   211,   212,   213,   214,   215,   216,   217,
+     218,   219,     0,     0,     0,     0,     0,     0,     0,   292,
+     208,     0,     0,     1,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,  -220,  -220,   928,     0,  -220,  -220,
+    -220,   929,     0,     0,  -220,     0,     0,   930,     0,     0,
+       0,  -655,     0,     0,     0,     0,     0,     0,     0,  -220,
+     931,     0,     0,     0,   932,     0,     0,   933,     0,  -220,
+     934,   935,  -220,     0,     0,  -220,     0,  -220,  -220,     0,
+    -220,  -220,  -220,  -220,  -220,  -220,   936,  -220,  -220,     0,
+       0,     0,     0,   937,   938,  -220,  -220,  -220,  -220,     0,
+       0,  -220,  -220,  -220,  -220,  -220,     0,     0,   939,  -220,
+       0,     0,  -220,  -220,     0,   940,  -220,  -220,  -220,  -220,
+    -220,  -220,  -220,  -220,  -220,   941,     0,     0,  -220,     0,
+       0,     0,  -220,  -220,  -220,  -220,     0,     0,     0,     0,
+       0,     0,     0,     0,   942,  -220,  -220,     0,     0,   943,
+     944,  -220,     0,     0,   209,     0,   210,   211,   212,   213,
+     214,   215,   216,   217,   218,   219,     0,     0,     0,     0,
+       0,   399,  -220,  -220,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,  -220,     0,  -220,   209,  -984,   210,
+     211,   212,   213,   214,   215,   216,   217,   218,   219,     0,
+       0,     0,     0,     0,   400,     0,     0,     0,  -220,     0,
+       0,     0,     0,  -220,     0,     0,     0,     0,     0,     0,
+     945,     0,  -220,     0,     0,     0,     0,     0,  -220,     0,
+       0,     0,   926,     0,  -220,     0,  -220,     0,  -220,   927,
+       0,     0,     0,     0,   810,     0,     0,  -220,  -220,     0,
+       0,  -220,  -220,     0,     0,     0,     0,     0,     0,     0,
+    -220,     0,     0,     0,   946,     1,     0,     0,     0,     0,
+     947,   948,     0,     0,     0,     0,  -220,  -220,   928,     0,
+    -220,  -220,  -220,   929,     0,     0,  -220,     0,     0,   930,
+       0,     0,     0,  -655,     0,     0,     0,     0,     0,     0,
+       0,  -220,   931,     0,  -220,     0,   932,     0,     0,   933,
+       0,  -220,   934,   935,  -220,     0,     0,  -220,     0,  -220,
+    -220,     0,  -220,  -220,  -220,  -220,  -220,  -220,   936,  -220,
+    -220,     0,     0,     0,     0,   937,   938,  -220,  -220,  -220,
+    -220,     0,     0,  -220,  -220,  -220,  -220,  -220,     0,     0,
+     939,  -220,     0,     0,  -220,  -220,     0,   940,  -220,  -220,
+    -220,  -220,  -220,  -220,  -220,  -220,  -220,   941,     0,     0,
+    -220,     0,     0,  -220,  -220,  -220,  -220,  -220,     0,     0,
+       0,     0,     0,     0,     0,     0,   942,  -220,  -220,  1338,
+       0,   943,   944,  -220,     0,     0,     0,   193,   194,     0,
+     195,   196,   197,   198,     0,   199,   200,   201,     0,     0,
+       0,     0,   202,     0,  -220,  -220,   203,   204,   205,   206,
+     207,     0,     0,     0,     0,     0,  -220,     0,  -220,     0,
+    -984,     0,     0,     0,     0,     0,     0,   193,   194,     0,
+     195,   196,   197,   198,     0,   199,   200,   201,     0,     0,
+    -220,     0,   202,     0,     0,  -220,   203,   204,   205,   206,
+     207,     0,   945,     0,  -220,     0,     0,     0,     0,     0,
+    -220,     0,     0,     0,     0,     0,     0,     0,  -220,     0,
+       0,     0,     0,     0,     0,     0,   810,     0,     0,  -220,
+    -220,     0,     0,  -220,  -220,   193,   194,     0,   195,   196,
+     197,   198,  -220,   199,   200,   201,   946,     0,     0,     0,
+     202,     0,   947,   948,   203,   204,   205,   206,   207,   193,
+     194,     0,   195,   196,   197,   198,     0,   199,   200,   201,
+       0,     0,     0,     0,   202,     0,     0,     0,   203,   204,
+     205,   206,   207,     0,   193,   194,  -220,   195,   196,   197,
+     198,     0,   199,   200,   201,     0,     0,     0,     0,   202,
+       0,     0,     0,   203,   204,   205,   206,   207,     0,     0,
+       0,     0,     0,     0,     0,     0,   193,   194,     0,   195,
+     196,   197,   198,     0,   199,   200,   201,     0,     0,     0,
+       0,   202,     0,     0,     0,   203,   204,   205,   206,   207,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   208,     0,     0,     0,  -220,     0,   193,   194,     0,
+     195,   196,   197,   198,     0,   199,   200,   201,     0,     0,
+       0,  1374,   202,     0,     0,     0,   203,   204,   205,   206,
+     207,     0,     0,     0,   193,   194,     0,   195,   196,   197,
+     198,   208,   199,   200,   201,     0,     0,     0,     0,   202,
+       0,     0,     0,   203,   204,   205,   206,   207,     0,     0,
+       0,     0,     0,     0,   193,   194,     0,   195,   196,   197,
+     198,     0,   199,   200,   201,     0,     0,     0,     0,   202,
+       0,     0,     0,   203,   204,   205,   206,   207,   193,   194,
+       0,   195,   196,   197,   198,     0,   199,   200,   201,   208,
+       0,     0,     0,   202,     0,     0,     0,   203,   204,   205,
+     206,   207,     0,     0,     0,     0,   193,   194,     0,   195,
+     196,   197,   198,   208,   199,   200,   201,     0,     0,     0,
+       0,   202,     0,     0,     0,   203,   204,   205,   206,   207,
+       0,     0,     0,     0,     0,     0,     0,     0,   208,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   209,     0,
+     210,   211,   212,   213,   214,   215,   216,   217,   218,   219,
+     208,     0,     0,     0,     0,   401,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   209,     0,
+     210,   211,   212,   213,   214,   215,   216,   217,   218,   219,
+       0,   208,     0,   193,   194,   402,   195,   196,   197,   198,
+       0,   199,   200,   201,     0,     0,     0,     0,   202,     0,
+       0,     0,   203,   204,   205,   206,   207,     0,   208,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   209,     0,   210,   211,
+     212,   213,   214,   215,   216,   217,   218,   219,   208,     0,
+       0,     0,     0,   403,     0,     0,     0,     0,     0,     0,
+     209,     0,   210,   211,   212,   213,   214,   215,   216,   217,
+     218,   219,   208,     0,     0,     0,     0,   404,     0,     0,
+       0,     0,     0,     0,     0,   209,     0,   210,   211,   212,
+     213,   214,   215,   216,   217,   218,   219,     0,     0,     0,
+     208,     0,   406,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   209,     0,   210,
+     211,   212,   213,   214,   215,   216,   217,   218,   219,     0,
+       0,     0,   193,   194,   407,   195,   196,   197,   198,     0,
+     199,   200,   201,     0,     0,     0,     0,   202,     0,     0,
+       0,   203,   204,   205,   206,   207,     0,     0,   209,     0,
+     210,   211,   212,   213,   214,   215,   216,   217,   218,   219,
+       0,     0,     0,     0,     0,   408,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   209,     0,   210,   211,   212,
+     213,   214,   215,   216,   217,   218,   219,     0,     0,     0,
+       0,     0,   409,     0,     0,     0,     0,   208,     0,     0,
+       0,     0,     0,     0,     0,   209,     0,   210,   211,   212,
+     213,   214,   215,   216,   217,   218,   219,     0,     0,     0,
+       0,     0,   410,     0,     0,     0,     0,     0,     0,   209,
+       0,   210,   211,   212,   213,   214,   215,   216,   217,   218,
+     219,     0,     0,     0,     0,     0,   411,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   209,     0,   210,
+     211,   212,   213,   214,   215,   216,   217,   218,   219,     0,
+       0,     0,   193,   194,   413,   195,   196,   197,   198,     0,
+     199,   200,   201,     0,     0,     0,     0,   202,     0,     0,
+       0,   203,   204,   205,   206,   207,     0,     0,     0,     0,
+       0,   193,   194,     0,   195,   196,   197,   198,     0,   199,
+     200,   201,     0,     0,     0,     0,   202,     0,     0,     0,
+     203,   204,   205,   206,   207,   193,   194,     0,   195,   196,
+     197,   198,     0,   199,   200,   201,   208,     0,     0,     0,
+     202,     0,     0,     0,   203,   204,   205,   206,   207,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   209,     0,   210,   211,   212,   213,
+     214,   215,   216,   217,   218,   219,     0,     0,     0,   193,
+     194,   414,   195,   196,   197,   198,     0,   199,   200,   201,
+       0,     0,     0,     0,   202,     0,     0,     0,   203,   204,
+     205,   206,   207,   193,   194,     0,   195,   196,   197,   198,
+       0,   199,   200,   201,     0,     0,     0,     0,   202,     0,
+       0,     0,   203,   204,   205,   206,   207,   193,   194,     0,
+     195,   196,   197,   198,     0,   199,   200,   201,     0,     0,
+       0,     0,   202,     0,     0,     0,   203,   204,   205,   206,
+     207,   193,   194,     0,   195,   196,   197,   198,     0,   199,
+     200,   201,     0,     0,     0,     0,   202,     0,     0,     0,
+     203,   204,   205,   206,   207,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   208,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   209,     0,   210,   211,   212,   213,   214,
+     215,   216,   217,   218,   219,   208,     0,     0,     0,     0,
+     418,   193,   194,     0,   195,   196,   197,   198,     0,   199,
+     200,   201,     0,     0,     0,     0,   202,     0,     0,   208,
+     203,   204,   205,   206,   207,   193,   194,     0,   195,   196,
+     197,   198,     0,   199,   200,   201,     0,     0,     0,     0,
+     202,     0,     0,     0,   203,   204,   205,   206,   207,   193,
+     194,     0,   195,   196,   197,   198,     0,   199,   200,   201,
+       0,     0,     0,     0,   202,     0,     0,     0,   203,   204,
+     205,   206,   207,   208,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   193,   194,     0,   195,
+     196,   197,   198,     0,   199,   200,   201,   208,     0,     0,
+       0,   202,     0,     0,     0,   203,   204,   205,   206,   207,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   208,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   209,     0,   210,   211,   212,   213,   214,
+     215,   216,   217,   218,   219,   208,     0,     0,     0,     0,
+     419,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   209,     0,   210,   211,   212,   213,   214,   215,
+     216,   217,   218,   219,     0,     0,     0,     0,     0,   420,
+       0,     0,     0,     0,     0,     0,   209,     0,   210,   211,
+     212,   213,   214,   215,   216,   217,   218,   219,     0,     0,
+       0,     0,     0,   421,   193,   194,     0,   195,   196,   197,
+     198,     0,   199,   200,   201,   208,     0,     0,     0,   202,
+       0,     0,     0,   203,   204,   205,   206,   207,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   208,
+     209,     0,   210,   211,   212,   213,   214,   215,   216,   217,
+     218,   219,     0,     0,     0,     0,     0,   422,     0,     0,
+       0,     0,     0,   208,   209,     0,   210,   211,   212,   213,
+     214,   215,   216,   217,   218,   219,     0,     0,     0,     0,
+       0,   519,     0,     0,     0,     0,     0,     0,   209,     0,
+     210,   211,   212,   213,   214,   215,   216,   217,   218,   219,
+     208,     0,     0,     0,     0,   609,     0,     0,     0,     0,
+       0,     0,   209,     0,   210,   211,   212,   213,   214,   215,
+     216,   217,   218,   219,     0,     0,     0,   193,   194,   610,
+     195,   196,   197,   198,     0,   199,   200,   201,     0,     0,
+       0,     0,   202,     0,     0,     0,   203,   204,   205,   206,
+     207,   193,   194,     0,   195,   196,   197,   198,     0,   199,
+     200,   201,     0,     0,     0,     0,   202,     0,     0,     0,
+     203,   204,   205,   206,   207,     0,     0,     0,     0,     0,
+       0,     0,   209,     0,   210,   211,   212,   213,   214,   215,
+     216,   217,   218,   219,     0,     0,     0,     0,     0,   611,
+       0,     0,     0,     0,     0,     0,   209,     0,   210,   211,
+     212,   213,   214,   215,   216,   217,   218,   219,   208,     0,
+       0,     0,     0,   612,     0,     0,     0,     0,     0,     0,
+     209,     0,   210,   211,   212,   213,   214,   215,   216,   217,
+     218,   219,     0,     0,     0,     0,     0,   613,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   209,     0,   210,
+     211,   212,   213,   214,   215,   216,   217,   218,   219,     0,
+       0,     0,   193,   194,  1470,   195,   196,   197,   198,     0,
+     199,   200,   201,     0,     0,     0,     0,   202,     0,     0,
+       0,   203,   204,   205,   206,   207,   193,   194,     0,   195,
+     196,   197,   198,     0,   199,   200,   201,     0,     0,     0,
+       0,   202,     0,     0,     0,   203,   204,   205,   206,   207,
+     193,   194,     0,   195,   196,   197,   198,     0,   199,   200,
+     201,   208,     0,     0,     0,   202,     0,     0,     0,   203,
+     204,   205,   206,   207,   193,   194,     0,   195,   196,   197,
+     198,     0,   199,   200,   201,   208,     0,     0,     0,   202,
+       0,     0,     0,   203,   204,   205,   206,   207,     0,     0,
+       0,     0,     0,     0,     0,   209,     0,   210,   211,   212,
+     213,   214,   215,   216,   217,   218,   219,     0,     0,     0,
+     193,   194,  1474,   195,   196,   197,   198,     0,   199,   200,
+     201,     0,     0,     0,     0,   202,     0,     0,     0,   203,
+     204,   205,   206,   207,   193,   194,     0,   195,   196,   197,
+     198,     0,   199,   200,   201,     0,     0,     0,     0,   202,
+       0,     0,     0,   203,   204,   205,   206,   207,   193,   194,
+       0,   195,   196,   197,   198,     0,   199,   200,   201,     0,
+       0,     0,     0,   202,     0,     0,     0,   203,   204,   205,
+     206,   207,   193,   194,     0,   195,   196,   197,   198,     0,
+     199,   200,   201,     0,     0,     0,     0,   202,     0,     0,
+       0,   203,   204,   205,   206,   207,   208,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   209,     0,
+     210,   211,   212,   213,   214,   215,   216,   217,   218,   219,
+     208,     0,     0,     0,     0,  1588,     0,     0,     0,     0,
+       0,     0,   209,     0,   210,   211,   212,   213,   214,   215,
+     216,   217,   218,   219,   208,     0,     0,     0,     0,  1589,
+     193,   194,     0,   195,   196,   197,   198,     0,   199,   200,
+     201,     0,     0,     0,     0,   202,     0,     0,   208,   203,
+     204,   205,   206,   207,     0,     0,     0,     0,     0,   193,
+     194,     0,   195,   196,   197,   198,     0,   199,   200,   201,
+       0,     0,     0,     0,   202,     0,     0,     0,   203,   204,
+     205,   206,   207,   193,   194,     0,   195,   196,   197,   198,
+       0,   199,   200,   201,   208,     0,     0,     0,   202,     0,
+       0,     0,   203,   204,   205,   206,   207,   193,   194,     0,
+     195,   196,   197,   198,     0,   199,   200,   201,   208,     0,
+       0,     0,   202,     0,     0,     0,   203,   204,   205,   206,
+     207,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   208,   209,     0,   210,   211,   212,   213,   214,
+     215,   216,   217,   218,   219,     0,     0,     0,     0,     0,
+    1590,     0,     0,     0,     0,     0,   208,   209,     0,   210,
+     211,   212,   213,   214,   215,   216,   217,   218,   219,     0,
+       0,     0,     0,     0,  1597,     0,     0,     0,     0,     0,
+       0,   209,     0,   210,   211,   212,   213,   214,   215,   216,
+     217,   218,   219,     0,     0,     0,     0,     0,  1598,     0,
+       0,     0,     0,     0,     0,   209,     0,   210,   211,   212,
+     213,   214,   215,   216,   217,   218,   219,     0,     0,     0,
+       0,     0,  1599,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   208,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   209,     0,   210,   211,   212,   213,   214,   215,   216,
+     217,   218,   219,   208,     0,     0,     0,     0,  1601,     0,
+       0,     0,     0,     0,     0,   209,     0,   210,   211,   212,
+     213,   214,   215,   216,   217,   218,   219,   208,     0,     0,
+       0,     0,  1669,     0,     0,     0,     0,     0,     0,   209,
+       0,   210,   211,   212,   213,   214,   215,   216,   217,   218,
+     219,   208,     0,     0,     0,     0,  1909,     0,     0,     0,
+       0,     0,     0,   209,     0,   210,   211,   212,   213,   214,
+     215,   216,   217,   218,   219,     0,     0,     0,   193,   194,
+    1910,   195,   196,   197,   198,     0,   199,   200,   201,     0,
+       0,     0,     0,   202,     0,     0,     0,   203,   204,   205,
+     206,   207,   193,   194,     0,   195,   196,   197,   198,     0,
+     199,   200,   201,     0,     0,     0,     0,   202,     0,     0,
+       0,   203,   204,   205,   206,   207,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   209,     0,   210,   211,   212,   213,   214,   215,   216,
+     217,   218,   219,     0,     0,     0,     0,     0,  2007,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     209,     0,   210,   211,   212,   213,   214,   215,   216,   217,
+     218,   219,     0,     0,     0,     0,     0,  2023,     0,     0,
+       0,     0,     0,     0,   209,     0,   210,   211,   212,   213,
+     214,   215,   216,   217,   218,   219,     0,     0,     0,     0,
+       0,  2094,     0,     0,     0,     0,     0,     0,   209,     0,
+     210,   211,   212,   213,   214,   215,   216,   217,   218,   219,
+       0,     0,     0,   193,   194,  2117,   195,   196,   197,   198,
+       0,   199,   200,   201,     0,     0,     0,     0,   202,     0,
+       0,     0,   203,   204,   205,   206,   207,   193,   194,     0,
+     195,   196,   197,   198,     0,   199,   200,   201,     0,     0,
+       0,     0,   202,     0,     0,     0,   203,   204,   205,   206,
+     207,   193,   194,     0,   195,   196,   197,   198,     0,   199,
+     200,   201,   208,     0,     0,     0,   202,     0,     0,     0,
+     203,   204,   205,   206,   207,   193,   194,     0,   195,   196,
+     197,   198,     0,   199,   200,   201,   208,     0,     0,     0,
+     202,     0,     0,     0,   203,   204,   205,   206,   207,   193,
+     194,     0,   195,   196,   197,   198,     0,   199,   200,   201,
+       0,     0,     0,     0,   202,     0,     0,     0,   203,   204,
+     205,   206,   207,  1773,   193,   194,     0,   195,   196,   197,
+     198,     0,   199,   200,   201,     0,     0,     0,     0,   202,
+       0,     0,     0,   203,   204,   205,   206,   207,   193,   194,
+       0,   195,   196,   197,   198,     0,   199,   200,   201,     0,
+       0,     0,     0,   202,     0,     0,     0,   203,   204,   205,
+     206,   207,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   193,   194,     0,   195,   196,   197,   198,     0,
+     199,   200,   201,     0,     0,     0,     0,   202,     0,     0,
+       0,   203,   204,   205,   206,   207,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   208,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   209,
+       0,   210,   211,   212,   213,   214,   215,   216,   217,   218,
+     219,   208,     0,     0,     0,     0,  2135,     0,     0,     0,
+       0,     0,     0,   209,     0,   210,   211,   212,   213,   214,
+     215,   216,   217,   218,   219,   208,     0,     0,     0,     0,
+    2152,     0,     0,     0,     0,     0,     0,     0,   193,   194,
+       0,   195,   196,   197,   198,     0,   199,   200,   201,   208,
+    1774,     0,     0,   202,     0,     0,     0,   203,   204,   205,
+     206,   207,     0,     0,     0,     0,   193,   194,     0,   195,
+     196,   197,   198,   208,   199,   200,   201,     0,     0,     0,
+       0,   202,     0,     0,     0,   203,   204,   205,   206,   207,
+       0,     0,     0,     0,     0,     0,   193,   194,   208,   195,
+     196,   197,   198,     0,   199,   200,   201,     0,     0,     0,
+       0,   202,     0,     0,     0,   203,   204,   205,   206,   207,
+       0,     0,   208,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   209,     0,   210,   211,   212,   213,
+     214,   215,   216,   217,   218,   219,   208,     0,     0,     0,
+       0,  2153,     0,     0,     0,     0,     0,     0,   209,     0,
+     210,   211,   212,   213,   214,   215,   216,   217,   218,   219,
+       0,     0,     0,     0,     0,  2185,     0,     0,     0,     0,
+       0,     0,   209,     0,   210,   211,   212,   213,   214,   215,
+     216,   217,   218,   219,     0,     0,     0,     0,     0,  2186,
+       0,     0,     0,     0,     0,     0,   209,     0,   210,   211,
+     212,   213,   214,   215,   216,   217,   218,   219,     0,     0,
+       0,     0,     0,  2203,     0,     0,     0,     0,     0,     0,
+     209,     0,   210,   211,   212,   213,   214,   215,   216,   217,
+     218,   219,   208,     0,     0,     0,  1775,     0,     0,     0,
+       0,     0,     0,     0,     0,   209,     0,   210,   211,   212,
+     213,   214,   215,   216,   217,   218,   219,     0,     0,     0,
+     208,   586,     0,     0,     0,     0,     0,     0,     0,   209,
+       0,   210,   211,   212,   213,   214,   215,   216,   217,   218,
+     219,     0,     0,     0,     0,  1409,     0,     0,     0,     0,
+     208,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   209,     0,   210,   211,   212,   213,   214,
+     215,   216,   217,   218,   219,     0,     0,   193,   194,  1583,
+     195,   196,   197,   198,     0,   199,   200,   201,     0,     0,
+       0,     0,   202,     0,     0,     0,   203,   204,   205,   206,
+     207,   193,   194,     0,   195,   196,   197,   198,     0,   199,
+     200,   201,     0,     0,     0,     0,   202,     0,     0,     0,
+     203,   204,   205,   206,   207,   193,   194,     0,   195,   196,
+     197,   198,     0,   199,   200,   201,     0,     0,     0,     0,
+     202,     0,     0,     0,   203,   204,   205,   206,   207,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   209,
+       0,   210,   211,   212,   213,   214,   215,   216,   217,   218,
+     219,     0,     0,     0,     0,  1584,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   209,     0,   210,
+     211,   212,   213,   214,   215,   216,   217,   218,   219,     0,
+       0,     0,     0,  1626,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   209,     0,   210,
+     211,   212,   213,   214,   215,   216,   217,   218,   219,     0,
+       0,   193,   194,  1634,   195,   196,   197,   198,     0,   199,
+     200,   201,     0,     0,     0,     0,   202,     0,     0,     0,
+     203,   204,   205,   206,   207,     0,   193,   194,     0,   195,
+     196,   197,   198,     0,   199,   200,   201,     0,     0,     0,
+       0,   202,     0,     0,     0,   203,   204,   205,   206,   207,
+     193,   194,     0,   195,   196,   197,   198,     0,   199,   200,
+     201,   208,     0,     0,     0,   202,     0,     0,     0,   203,
+     204,   205,   206,   207,   193,   194,     0,   195,   196,   197,
+     198,     0,   199,   200,   201,   208,     0,     0,     0,   202,
+       0,     0,     0,   203,   204,   205,   206,   207,   193,   194,
+       0,   195,   196,   197,   198,     0,   199,   200,   201,   208,
+       0,     0,     0,   202,     0,     0,     0,   203,   204,   205,
+     206,   207,   193,   194,     0,   195,   196,   197,   198,     0,
+     199,   200,   201,     0,     0,     0,     0,   202,     0,     0,
+       0,   203,   204,   205,   206,   207,   193,   194,     0,   195,
+     196,   197,   198,     0,   199,   200,   201,     0,     0,     0,
+       0,   202,     0,     0,     0,   203,   204,   205,   206,   207,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     193,   194,     0,   195,   196,   197,   198,     0,   199,   200,
+     201,     0,     0,     0,     0,   202,     0,     0,     0,   203,
+     204,   205,   206,   207,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   208,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   209,     0,
+     210,   211,   212,   213,   214,   215,   216,   217,   218,   219,
+     208,     0,     0,     0,  1637,     0,     0,     0,     0,     0,
+       0,     0,   209,     0,   210,   211,   212,   213,   214,   215,
+     216,   217,   218,   219,   208,     0,     0,     0,  1739,     0,
+       0,     0,     0,     0,     0,     0,   209,     0,   210,   211,
+     212,   213,   214,   215,   216,   217,   218,   219,   208,     0,
+       0,     0,  1753,     0,     0,     0,     0,     0,     0,     0,
+       0,   193,   194,     0,   195,   196,   197,   198,     0,   199,
+     200,   201,   208,     0,     0,     0,   202,     0,     0,     0,
+     203,   204,   205,   206,   207,   193,   194,     0,   195,   196,
+     197,   198,     0,   199,   200,   201,   208,     0,     0,     0,
+     202,     0,     0,     0,   203,   204,   205,   206,   207,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     208,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   209,     0,   210,   211,   212,   213,   214,   215,
+     216,   217,   218,   219,   208,     0,     0,     0,  1779,     0,
+       0,     0,     0,     0,     0,     0,     0,   209,     0,   210,
+     211,   212,   213,   214,   215,   216,   217,   218,   219,     0,
+       0,     0,     0,  1780,     0,     0,     0,     0,     0,     0,
+       0,   209,     0,   210,   211,   212,   213,   214,   215,   216,
+     217,   218,   219,     0,     0,     0,     0,  1785,     0,     0,
+       0,     0,     0,     0,     0,   209,     0,   210,   211,   212,
+     213,   214,   215,   216,   217,   218,   219,     0,     0,     0,
+       0,  1786,     0,     0,     0,     0,     0,     0,     0,   209,
+       0,   210,   211,   212,   213,   214,   215,   216,   217,   218,
+     219,     0,     0,     0,     0,  1802,     0,     0,     0,     0,
+       0,     0,     0,   209,     0,   210,   211,   212,   213,   214,
+     215,   216,   217,   218,   219,   208,     0,     0,     0,  1872,
+       0,     0,     0,     0,     0,     0,     0,   209,     0,   210,
+     211,   212,   213,   214,   215,   216,   217,   218,   219,   208,
+       0,     0,     0,  1893,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   209,     0,   210,   211,   212,   213,   214,   215,   216,
+     217,   218,   219,     0,     0,   193,   194,  1996,   195,   196,
+     197,   198,     0,   199,   200,   201,     0,     0,     0,     0,
+     202,     0,     0,     0,   203,   204,   205,   206,   207,   193,
+     194,     0,   195,   196,   197,   198,     0,   199,   200,   201,
+       0,     0,     0,     0,   202,     0,     0,     0,   203,   204,
+     205,   206,   207,   193,   194,     0,   195,   196,   197,   198,
+       0,   199,   200,   201,     0,     0,     0,     0,   202,     0,
+       0,     0,   203,   204,   205,   206,   207,   193,   194,     0,
+     195,   196,   197,   198,     0,   199,   200,   201,     0,     0,
+       0,     0,   202,     0,     0,     0,   203,   204,   205,   206,
+     207,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   209,     0,   210,   211,   212,   213,   214,   215,
+     216,   217,   218,   219,     0,     0,     0,     0,  2020,     0,
+       0,     0,     0,     0,     0,     0,   209,     0,   210,   211,
+     212,   213,   214,   215,   216,   217,   218,   219,     0,     0,
+     193,   194,  2077,   195,   196,   197,   198,     0,   199,   200,
+     201,     0,     0,     0,     0,   202,     0,     0,     0,   203,
+     204,   205,   206,   207,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   193,   194,     0,   195,   196,   197,
+     198,     0,   199,   200,   201,     0,     0,     0,     0,   202,
+       0,     0,     0,   203,   204,   205,   206,   207,   193,   194,
+       0,   195,   196,   197,   198,     0,   199,   200,   201,   208,
+       0,     0,     0,   202,     0,     0,     0,   203,   204,   205,
+     206,   207,   193,   194,     0,   195,   196,   197,   198,     0,
+     199,   200,   201,   208,     0,     0,     0,   202,     0,     0,
+       0,   203,   204,   205,   206,   207,   193,   194,     0,   195,
+     196,   197,   198,     0,   199,   200,   201,   208,     0,     0,
+       0,   202,     0,     0,     0,   203,   204,   205,   206,   207,
+     193,   194,     0,   195,   196,   197,   198,     0,   199,   200,
+     201,   208,     0,     0,     0,   202,     0,     0,     0,   203,
+     204,   205,   206,   207,   193,   194,     0,   195,   196,   197,
+     198,     0,   199,   200,   201,     0,     0,     0,     0,   202,
+       0,     0,     0,   203,   204,   205,   206,   207,     0,   193,
+     194,     0,   195,   196,   197,   198,     0,   199,   200,   201,
+       0,     0,     0,     0,   202,     0,     0,     0,   203,   204,
+     205,   206,   207,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   208,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   209,     0,   210,   211,
+     212,   213,   214,   215,   216,   217,   218,   219,   208,     0,
+     712,     0,  2124,     0,     0,     0,   713,     0,     0,     0,
+     209,     0,   210,   211,   212,   213,   214,   215,   216,   217,
+     218,   219,   208,     0,     0,     0,  2133,     0,     0,     0,
+       0,     0,     0,     0,   209,     0,   210,   211,   212,   213,
+     214,   215,   216,   217,   218,   219,   208,     0,     0,     0,
+    2134,     0,     0,     0,     0,     0,     0,     0,   209,     0,
+     210,   211,   212,   213,   214,   215,   216,   217,   218,   219,
+     208,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   193,   194,     0,   195,   196,   197,   198,
+       0,   199,   200,   201,   208,     0,     0,     0,   202,     0,
+       0,     0,   203,   204,   205,   206,   207,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   208,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   209,   289,   210,   211,   212,   213,   214,   215,   216,
+     217,   218,   219,   208,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   209,   432,   210,   211,   212,
+     213,   214,   215,   216,   217,   218,   219,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   209,
+     525,   210,   211,   212,   213,   214,   215,   216,   217,   218,
+     219,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   209,   619,   210,   211,   212,   213,   214,
+     215,   216,   217,   218,   219,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   209,  1604,   210,
+     211,   212,   213,   214,   215,   216,   217,   218,   219,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   209,  1821,   210,   211,   212,   213,   214,   215,   216,
+     217,   218,   219,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   209,  1900,   210,   211,   212,
+     213,   214,   215,   216,   217,   218,   219,   208,   926,     0,
+    -220,     0,     0,     0,  -220,   927,     0,     0,     0,     0,
+     209,  2028,   210,   211,   212,   213,   214,   215,   216,   217,
+     218,   219,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     1,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,  -220,  -220,   928,     0,  -220,  -220,  -220,   929,
+       0,     0,  -220,     0,     0,   930,     0,     0,     0,  -654,
+       0,     0,  -654,     0,     0,     0,     0,  -220,   931,     0,
+       0,     0,   932,     0,     0,   933,     0,  -220,   934,   935,
+    -220,     0,     0,  -220,     0,  -220,  -220,     0,  -220,  -220,
+    -220,  -220,  -220,  -220,   936,  -220,  -220,     0,     0,     0,
+       0,   937,   938,  -220,  -220,  -220,  -220,     0,     0,  -220,
+    -220,  -220,  -220,  -220,     0,     0,   939,  -220,     0,     0,
+    -220,  -220,     0,   940,  -220,  -220,  -220,  -220,  -220,  -220,
+    -220,  -220,  -220,   941,     0,     0,  -220,     0,     0,     0,
+    -220,  -220,  -220,  -220,     0,     0,     0,     0,     0,     0,
+       0,     0,   942,  -220,  -220,     0,  -654,   943,   944,  -220,
+       0,     0,     0,     0,   209,     0,   210,   211,   212,   213,
+     214,   215,   216,   217,   218,   219,     0,     0,     0,     0,
+    -220,  -220,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,  -220,     0,  -220,     0,  -984,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,  -654,     0,     0,  -220,     0,     0,     0,
+       0,  -220,     0,     0,     0,     0,     0,     0,   945,     0,
+    -220,     0,     0,     0,     0,     0,  -220,     0,     0,     0,
+     926,     0,  -220,     0,  -220,     0,  -220,   927,     0,     0,
+       0,     0,   810,     0,     0,  -220,  -220,     0,     0,  -220,
+    -220,     0,     0,     0,     0,     0,     0,     0,  -220,     0,
+       0,     0,   946,     1,     0,     0,     0,     0,   947,   948,
+       0,     0,     0,     0,  -220,  -220,   928,     0,  -220,  -220,
+    -220,   929,     0,     0,  -220,     0,     0,   930,     0,     0,
+       0,     0,     0,     0,  -655,     0,     0,     0,     0,  -220,
+     931,     0,  -220,     0,   932,     0,     0,   933,     0,  -220,
+     934,   935,  -220,     0,     0,  -220,     0,  -220,  -220,     0,
+    -220,  -220,  -220,  -220,  -220,  -220,   936,  -220,  -220,     0,
+       0,     0,     0,   937,   938,  -220,  -220,  -220,  -220,     0,
+       0,  -220,  -220,  -220,  -220,  -220,     0,     0,   939,  -220,
+       0,     0,  -220,  -220,     0,   940,  -220,  -220,  -220,  -220,
+    -220,  -220,  -220,  -220,  -220,   941,     0,     0,  -220,     0,
+       0,  -220,  -220,  -220,  -220,  -220,     0,     0,     0,     0,
+       0,     0,     0,     0,   942,  -220,  -220,     0,     0,   943,
+     944,  -220,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,  -220,  -220,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,  -220,     0,  -220,     0,  -984,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,  -655,     0,     0,  -220,     0,
+       0,     0,     0,  -220,     0,     0,     0,     0,     0,     0,
+     945,     0,  -220,     0,     0,     0,     0,     0,  -220,     0,
+       0,     0,   926,     0,  -220,     0,  -220,     0,  -220,   927,
+       0,     0,     0,     0,   810,     0,     0,  -220,  -220,     0,
+       0,  -220,  -220,     0,     0,     0,     0,     0,     0,     0,
+    -220,     0,     0,     0,   946,     1,     0,     0,     0,     0,
+     947,   948,     0,     0,     0,     0,  -220,  -220,   928,  1106,
+    -220,  -220,  -220,   929,     0,     0,  -220,     0,     0,   930,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,  -220,   931,     0,  -220,     0,   932,     0,     0,   933,
+       0,  -220,   934,   935,  -220,     0,     0,  -220,     0,  -220,
+    -220,     0,  -220,  -220,  -220,  -220,  -220,  -220,   936,  -220,
+    -220,     0,     0,     0,     0,   937,   938,  -220,  -220,  -220,
+    -220,     0,     0,  -220,  -220,  -220,  -220,  -220,     0,     0,
+     939,  -220,     0,     0,  -220,  -220,     0,   940,  -220,  -220,
+    -220,  -220,  -220,  -220,  -220,  -220,  -220,   941,     0,     0,
+    -220,     0,     0,  -220,  -220,  -220,  -220,  -220,     0,     0,
+       0,     0,     0,     0,     0,     0,   942,  -220,  -220,     0,
+    -655,   943,   944,  -220,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,  -220,  -220,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,  -220,     0,  -220,     0,
+    -984,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+    -220,     0,     0,     0,     0,  -220,     0,     0,     0,     0,
+       0,     0,   945,     0,  -220,     0,     0,     0,     0,     0,
+    -220,     0,     0,     0,   926,     0,  -220,     0,  -220,     0,
+    -220,   927,     0,     0,     0,     0,   810,     0,     0,  -220,
+    -220,     0,     0,  -220,  -220,     0,     0,     0,     0,     0,
+       0,     0,  -220,     0,     0,     0,   946,     1,     0,     0,
+       0,     0,   947,   948,     0,     0,     0,     0,  -220,  -220,
+     928,     0,  -220,  -220,  -220,   929,     0,     0,  -220,     0,
+       0,   930,     0,     0,     0,  -655,     0,     0,     0,     0,
+       0,     0,     0,  -220,   931,     0,  -220,     0,   932,     0,
+       0,   933,     0,  -220,   934,   935,  -220,     0,     0,  -220,
+       0,  -220,  -220,     0,  -220,  -220,  -220,  -220,  -220,  -220,
+     936,  -220,  -220,     0,     0,     0,     0,   937,   938,  -220,
+    -220,  -220,  -220,     0,     0,  -220,  -220,  -220,  -220,  -220,
+       0,     0,   939,  -220,     0,     0,  -220,  -220,     0,   940,
+    -220,  -220,  -220,  -220,  -220,  -220,  -220,  -220,  -220,   941,
+       0,     0,  -220,     0,     0,  -220,  -220,  -220,  -220,  -220,
+       0,     0,     0,     0,     0,     0,     0,     0,   942,  -220,
+    -220,     0,     0,   943,   944,  -220,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,  -220,  -220,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,  -220,     0,
+    -220,     0,  -984,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,  -220,     0,     0,     0,     0,  -220,     0,     0,
+       0,     0,     0,     0,   945,     0,  -220,     0,     0,     0,
+       0,     0,  -220,     0,     0,     0,   926,     0,  -220,     0,
+    -220,     0,  -220,   927,     0,     0,     0,     0,   810,     0,
+       0,  -220,  -220,     0,     0,  -220,  -220,     0,     0,     0,
+       0,     0,     0,     0,  -220,     0,     0,     0,   946,     1,
+       0,     0,     0,     0,   947,   948,     0,     0,     0,     0,
+    -220,  -220,   928,  1152,  -220,  -220,  -220,   929,     0,     0,
+    -220,     0,     0,   930,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,  -220,   931,     0,  -220,     0,
+     932,     0,     0,   933,     0,  -220,   934,   935,  -220,     0,
+       0,  -220,     0,  -220,  -220,     0,  -220,  -220,  -220,  -220,
+    -220,  -220,   936,  -220,  -220,     0,     0,     0,     0,   937,
+     938,  -220,  -220,  -220,  -220,     0,     0,  -220,  -220,  -220,
+    -220,  -220,     0,     0,   939,  -220,     0,     0,  -220,  -220,
+       0,   940,  -220,  -220,  -220,  -220,  -220,  -220,  -220,  -220,
+    -220,   941,     0,     0,  -220,     0,     0,  -220,  -220,  -220,
+    -220,  -220,     0,     0,     0,     0,     0,     0,     0,     0,
+     942,  -220,  -220,     0,     0,   943,   944,  -220,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,  -220,  -220,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+    -220,     0,  -220,     0,  -984,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,  1117,  -220,     0,     0,     0,     0,  -220,
+       0,  1971,     0,  -167,     0,     0,   945,  -167,  -220,     0,
+       0,     0,     0,     0,  -220,     0,     0,     0,     0,     0,
+       0,     0,  -220,     0,     0,     0,     0,     0,     0,     0,
+     810,     0,     0,  -220,  -220,  1118,  1119,  -220,  -220,  1120,
+    1121,  1122,     0,     0,     0,  1123,  -220,     0,     0,     0,
+     946,     0,     0,     0,     0,     0,   947,   948,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+    1124,     0,     0,     0,     0,  -130,    36,     0,    37,  1125,
+       0,  1126,  1127,  1128,  1129,  1130,  1131,     0,     0,  1132,
+    -220,     0,     0,     0,     0,     0,  1133,     0,     0,     0,
+       0,     0,  1134,  1135,  1136,  1137,  1138,  -167,  -167,  -167,
+    1139,     0,     0,   669,   670,     0,     0,     0,  1140,  1141,
+    1142,   671,   672,   673,   674,   675,  -130,     0,     0,   676,
+       0,     0,     0,   677,   678,  1143,  1144,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   355,     0,     0,  -167,  -167,     0,  -220,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   679,   680,     0,     0,     0,     0,     0,
+       1,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,  -167,     0,  -167,     0,     0,
+       0,     0,  -982,     0,     0,     0,     0,     0,     0,   355,
+    -905,   -18,     0,     0,  1145,     0,   801,     0,     0,  -167,
+       0,     0,     0,     0,     0,     0,     0,   802,   803,   804,
+       0,     0,     0,  -167,     0,     0,     0,    38,  1972,  -167,
+       0,     0,     0,   805,   806,     0,     0,     0,     0,  1973,
+       0,  1974,  1975,   356,   357,   807,     0,     0,  -167,  -167,
+       0,  1976,  -167,  -167,     0,     0,     0,     0,     0,     0,
+       0,     0,   801,   808,     0,  1977,     0,     0,     0,     0,
+       0,     0,     0,   802,   803,   804,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   805,
+     806,     0,   359,   360,     0,  1146,     0,     0,   809,   356,
+     357,   807,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   808,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   361,     0,   343,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   359,   360,
+       0,     0,     0,     0,   809,   745,     0,     0,     0,     0,
+       0,     0,     0,     0,  1147,     0,     0,     0,     0,   344,
+       0,     0,     0,     0,     0,   345,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   361,     0,   343,
+       0,   810,     0,     0,   346,   364,     0,     0,   365,   746,
+       0,     0,     0,     0,     0,     0,     0,   234,     0,     0,
+       0,   745,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   344,     0,     0,     0,     0,
+       0,   345,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   810,     0,     0,
+     346,   364,     0,     0,   365,   746,     0,     0,     0,     0,
+       0,     0,     0,   234
+};
+
+static const yytype_int16 yycheck[] =
+{
+       0,   234,    63,    64,   816,   957,   958,  1200,    41,   836,
+     837,  1214,    12,   800,  1587,   995,  1247,  1228,  1577,  1076,
+     890,  1421,  1595,   121,  1004,     3,     3,  1238,  1087,  1088,
+    1089,  1076,    65,   943,     3,  1094,     3,     1,  1180,    36,
+     233,     3,    34,  1068,    63,    35,  1071,    35,  1068,     3,
+     938,  1071,    31,    32,     3,    10,  1059,    12,     3,     3,
+      34,    63,     3,  1148,     9,   685,  1360,   687,   101,   102,
+       3,     3,     3,    66,    67,    68,     3,     1,     3,     3,
+      65,   709,  1224,     3,    16,    17,   232,   233,     3,     3,
+     352,   709,   710,  2232,   127,     3,     1,    63,     3,   132,
+       1,  2240,    18,    96,    97,    98,    99,   100,   141,  2007,
+     103,   104,   827,     1,     3,   148,   149,   150,   151,   152,
+     153,   154,   155,   156,   157,   158,   159,   160,   161,   162,
+     163,   164,   165,   166,   167,   168,   169,   170,   171,   237,
+    1282,     1,   413,     3,     3,    34,   509,     1,   158,    10,
+      11,    12,     1,   121,    16,    17,    16,    17,     3,   801,
+     193,   194,   195,   196,   197,   198,   199,   200,   201,   202,
+     203,   204,   205,   206,   207,     3,   209,   210,   211,   212,
+     213,   214,   215,   216,   217,   218,   219,   220,   816,   222,
+      65,   337,     3,   186,   187,   188,  1106,  1705,   816,     1,
+     820,   463,    16,    17,     3,   459,    33,     6,   550,    11,
+       3,    13,    11,   475,    13,    96,  1616,   363,    34,    86,
+       3,    88,     3,     6,     3,   258,   369,   102,    11,   262,
+      13,   216,   242,  2131,   651,   121,   490,     3,  1958,     3,
+       6,   883,  1152,   885,   886,    11,    62,    13,  1118,     3,
+     479,  2077,   127,   838,  1124,   484,   289,   132,   291,   292,
+    1148,  1149,  1465,  1228,  1323,     3,   141,   232,   233,   237,
+    1273,    81,    82,  1238,  2172,  1145,   894,    34,     3,  1573,
+     313,   899,     7,   700,    75,   927,    34,    97,  1373,    75,
+      63,    64,   877,    66,    67,    68,   245,   264,  2124,   266,
+     554,   242,   944,   666,   558,   668,   723,     3,   451,   413,
+     811,   504,    69,     1,   347,     3,    64,    98,   461,    33,
+     424,  1036,  1037,    96,    97,    98,    99,   100,  2048,  2049,
+     103,   104,   264,    97,   266,   126,    34,   480,   481,   482,
+     126,    34,  1484,    97,    84,   220,    34,   565,  1268,   382,
+    1858,   237,     3,     3,   180,     6,   182,    34,   504,   264,
+      11,   266,    13,   705,    62,   707,     0,     3,  1147,  1148,
+    1149,   872,   405,   591,   875,   593,   739,   342,    12,   412,
+     247,   400,   415,   416,   417,    35,   648,   649,   650,  1962,
+     390,    84,    69,    81,    82,   428,  2076,  2077,   400,   432,
+     414,   434,   435,   436,   264,   438,   266,   421,  1328,    97,
+    1330,  1553,    34,   186,   187,   188,   833,   292,   400,   192,
+     417,   400,   414,     6,    63,    64,   400,    66,    67,    68,
+       1,   421,     3,   421,   400,   413,   413,  1462,   420,  1464,
+      62,  1461,   421,  1463,  2124,   255,   424,   424,     6,   682,
+     414,   418,   685,  1240,   687,   424,   418,    96,    97,    98,
+      99,   100,  1487,  1351,   103,   104,  1486,   421,  1493,   662,
+    1612,  1491,  1114,   428,   419,   419,   730,   731,  1366,  1367,
+    1683,   408,  1370,  2056,   415,  1688,   418,   260,   750,   413,
+     415,   264,   525,   413,   527,   749,   236,   237,   531,   415,
+       3,   415,   417,   418,     7,  1905,   422,   415,   413,  1740,
+       3,   657,    83,   418,   415,   416,   662,   735,   419,   424,
+     421,   422,  1150,  1754,     3,   413,   415,   416,   561,    34,
+     563,  1151,   421,   566,  1176,   416,   107,   108,   415,   504,
+     421,   418,    35,   236,   237,    57,   407,   186,   187,   188,
+       1,   413,     3,     0,   413,   417,   127,   419,   418,   413,
+       3,   415,   595,     1,   413,     3,   415,    34,   413,     7,
+      26,    27,    28,   416,   807,   804,   838,    33,   421,    84,
+     580,   408,   409,   410,   400,   413,   619,   820,  1367,   341,
+    1377,   417,  1795,   419,   416,   347,   167,  1485,   420,   745,
+     309,   310,   413,   417,  1492,   419,   606,   572,   573,   574,
+    2010,   413,  1669,   806,   413,   877,   809,    84,  1246,   652,
+     413,    82,   331,   400,  1669,  1577,   197,   416,  1859,   408,
+     413,   420,    83,   792,   413,    34,    97,  1696,  1697,     1,
+      83,     3,    20,   352,   421,   413,  1849,   413,   109,    63,
+      64,    29,    66,    67,    68,   917,   107,   108,   658,  2218,
+     806,   173,   233,   809,   176,  1575,   109,   179,   239,   107,
+     108,   109,     1,   382,     3,  1335,   127,   422,   419,   712,
+    1568,   422,    96,    97,    98,    99,   100,   258,  1348,   103,
+     104,   415,   406,   407,   408,   409,   410,   662,  1909,  1910,
+     859,  1894,   861,   862,   737,    81,    82,   400,    81,    82,
+     417,   279,   419,  1373,   157,   407,   167,   682,   156,   157,
+     685,    97,   687,     3,    97,    85,   157,    87,   416,   417,
+     418,   236,   237,   421,  1937,  1938,   990,   429,   430,   431,
+    1943,  1944,  1945,  1946,   887,   647,   197,  1950,  1951,  1952,
+    1953,    20,   195,   655,   197,   415,   335,   195,   118,   197,
+      29,    90,   413,   400,   195,  2165,   197,   346,   415,   236,
+     237,   100,   186,   187,   188,  1029,  1030,  1031,   180,   552,
+     182,   219,   233,  1118,   421,  1844,    83,  1846,   239,  1124,
+     233,   370,   415,   826,   827,   233,   239,  1059,   421,  1709,
+     419,   239,   233,   422,   963,   167,   168,   258,   239,   952,
+    1145,   415,   109,    83,  2017,   258,   414,   719,   720,   721,
+     258,   259,   415,   421,   262,   263,   264,   258,   266,   890,
+       3,   406,   407,  1475,  1476,   103,   327,   107,   108,   109,
+     421,   806,    34,   334,   809,   413,   421,   415,   419,   417,
+    1104,   419,   852,    75,   122,   820,   124,   127,     1,   414,
+     157,  1115,   414,  1242,   414,  1244,   421,   414,   414,   421,
+      62,   421,    64,   141,   421,   421,    98,    69,   911,   415,
+      83,   914,   255,  2114,     1,   421,     3,    16,    17,   922,
+     335,    34,    84,   338,  2097,  1954,  1955,  1539,   195,  2102,
+     197,   346,  2105,  2106,   107,   108,  1548,  1549,     3,   902,
+     903,    14,    15,    16,    17,    18,   175,    80,  1151,    82,
+      43,  1064,  1065,  1066,   127,   370,  1814,  1815,  1816,   415,
+    1818,     5,   414,   994,    97,   421,   233,    77,   999,   421,
+     162,  1002,   239,   943,   416,  1006,   109,   980,    76,   421,
+     406,   407,   408,   409,   410,   309,   310,   957,   958,  1192,
+     413,   258,   414,   103,   167,   930,    83,   102,   419,   421,
+       3,   415,   413,  1116,   102,   418,     9,   331,   422,  1012,
+     418,   413,   122,   413,   124,   339,   121,   417,   123,   419,
+     107,   108,   109,   121,   197,   123,  2227,   413,   352,   414,
+    1787,   141,   414,  1036,  1037,   140,   421,  2238,   414,   421,
+     127,   414,   140,   414,   157,   421,   414,   413,   421,   416,
+     421,  1283,  1055,   421,   421,  1279,  1280,  1281,   382,  1062,
+     233,    16,    17,   415,   416,  1068,   239,  1299,  1071,   421,
+     157,   158,   415,   416,   236,   237,   268,   269,   421,   271,
+     167,   168,   195,   417,   197,   258,   413,  1118,   238,    10,
+     417,    12,   419,  1124,   413,  1852,  2018,  2019,   413,   249,
+     419,   251,   252,   415,   416,  2055,   415,  1705,   195,   421,
+     197,   261,   421,   415,  1145,   415,  1704,  1705,   413,   421,
+     233,   421,   415,   415,  2236,  1349,   239,  1359,   421,   421,
+     413,   415,  1067,   415,   415,   415,  1106,   421,   415,   421,
+     421,   421,  1077,   415,   421,   258,   233,   890,   416,   421,
+     415,   418,   239,   421,    16,    17,   421,    18,    19,   902,
+     903,  1192,   415,   415,   415,    26,    27,    28,   421,   421,
+     421,   258,    33,   415,  1177,   262,  1179,  1180,  1744,   421,
+     413,  1747,  1152,  1749,  1187,  1188,  1189,   930,   413,   276,
+     413,   415,   419,   415,   419,   422,   419,   421,  1201,   421,
+    1203,  1204,  1205,   415,  1139,   415,   415,   415,     1,   421,
+       3,   421,   421,   421,  1217,   417,  1151,   419,   413,   419,
+     422,  1224,   422,  1226,  1227,  1228,  1229,  1230,  1231,  1232,
+    1233,  1234,  1235,  1236,  1237,  1238,  2076,  2077,   415,  1270,
+     416,    76,    77,   415,   421,   421,   419,  1250,   415,   421,
+     993,   994,  1255,   109,   421,   415,   999,  1000,   415,  1002,
+    1858,   421,   413,  1006,   421,   413,     0,   102,   103,   415,
+    1858,  1274,  1015,  2070,   415,   421,   415,   893,   416,  1282,
+     421,   890,   421,   421,  2124,   416,   121,   122,   123,   124,
+     421,  1294,   413,   902,   903,   415,  2218,   415,   419,   416,
+      34,   421,   413,   421,   421,   140,   141,   415,   415,    14,
+      15,    16,    17,   421,   421,   424,  1059,   390,   391,   392,
+     393,   394,   395,   396,   397,   398,     1,   415,     3,  1561,
+     415,   415,   419,   421,   416,   413,   421,   421,   413,   421,
+    1303,  1304,  1305,  1306,  1307,  1308,  1309,  1310,   415,   422,
+     417,   415,   419,  1316,  1317,  1318,  1319,   421,  2115,   415,
+     413,   413,  1365,   415,   415,   421,  1369,   101,    18,    19,
+     421,    21,    22,    23,    24,  1118,    26,    27,    28,   413,
+     415,  1124,   415,    33,  1387,   994,   421,  1003,   421,  2229,
+     999,   416,   415,  1002,   415,  1398,   421,  1006,   421,     3,
+     421,   415,  1145,   416,  1020,  1021,   413,   421,   421,  2032,
+     415,  1414,  1415,   413,  2037,  2038,   421,  2040,  1421,  2042,
+     417,   155,   415,  2046,  2047,  1428,  1429,   415,   421,   415,
+     415,   418,  2189,   421,   416,   421,   421,     3,   415,   421,
+     174,  1444,  1445,   416,   421,  1448,  2228,   413,   421,  1192,
+     167,   168,    18,    19,  2211,    21,    22,    23,    24,   415,
+      26,    27,    28,   415,   415,   421,   417,    33,   419,   421,
+    1473,    37,    38,    39,    40,    41,  1219,   416,   416,   416,
+     416,  1484,   421,   421,   421,   421,  1489,   416,   416,   167,
+     168,   416,   421,   421,  1497,  1498,   421,   416,   416,   416,
+    1503,  1504,   421,   421,   421,   417,   890,   416,   416,  1118,
+     244,   416,   421,   421,   413,  1124,   421,  2140,   902,   903,
+    2143,   416,   413,  2146,  2147,     3,   421,  1270,   416,     1,
+    1273,     3,   894,   421,   268,   269,  1145,   899,   167,   168,
+    1503,  1504,   413,   404,   405,   406,   407,   408,   409,   410,
+    1553,  1514,    10,    11,    12,  1558,  1559,     1,   413,     3,
+    1303,  1304,  1305,  1306,  1307,  1308,  1309,  1310,   413,     1,
+    1186,     3,  2160,  1316,  1317,  1318,  1319,   704,   416,   706,
+    1609,   413,  1611,  1192,  1200,  1588,  1589,  1590,   418,   952,
+    1593,   954,   418,   419,   418,   419,   418,   419,   415,   333,
+    1216,  1604,     7,   268,   269,  1575,  1609,  1577,  1611,  1612,
+     994,   420,   421,  1616,     3,   999,  1647,     3,  1002,  1622,
+    1623,     3,  1006,   421,  1627,  1628,  1629,  2225,   420,   421,
+    2228,    83,   366,   420,   421,  1589,  1590,  2225,   600,   601,
+    2228,   158,  1645,  2018,  2019,  1648,  1573,  1574,   935,   936,
+     215,     3,   789,   790,     3,   107,   108,   109,   422,   422,
+     422,  1270,   422,   422,   413,   413,   232,    33,  1671,   422,
+       5,   417,   419,     3,     3,   127,   415,  1680,     3,     3,
+       3,     3,   415,   415,  1427,   390,   391,   392,   393,   394,
+     395,   396,   397,   398,  1303,  1304,  1305,  1306,  1307,  1308,
+    1309,  1310,   107,   108,   109,   157,   415,  1316,  1317,  1318,
+    1319,   415,     3,     3,    98,   167,   168,   422,  1681,  1682,
+       5,  1684,  1685,  1686,  1687,    34,   421,     3,  1691,  1692,
+    1693,  1694,     3,   416,  1118,     3,     3,   422,   420,  1709,
+    1124,  1744,   422,   195,  1747,   197,  1749,   415,  1751,   415,
+       3,   156,   157,   415,   404,   405,   406,   407,   408,   409,
+     410,  1145,   167,   168,   418,   400,  1769,   415,   415,   415,
+    1773,  1514,   415,   415,   415,   419,   416,     3,     3,     3,
+     414,   233,   415,  1628,    82,  1988,     3,   239,   415,   415,
+     195,     3,   197,   125,     3,   180,   418,  1800,     0,  1802,
+     418,   413,  1805,  1648,     3,  1808,   258,     7,  1192,    83,
+     262,   414,     3,     3,   219,   415,   422,    66,  1821,    64,
+     413,   420,  1825,  1826,   276,   414,     3,     3,   233,     3,
+       3,   415,    34,   399,   239,   401,   402,   403,   404,   405,
+     406,   407,   408,   409,   410,    82,     3,   416,   245,     3,
+       3,     3,   422,   258,   259,   421,     6,   262,   263,     6,
+       3,   415,    68,  1304,  1305,  1306,  1307,  1308,  1309,  1310,
+     400,     3,   421,   416,  1837,  1316,  1317,  1318,  1319,     5,
+     422,   422,   415,    83,   415,    66,  1270,   174,   415,   415,
+    1893,   415,   415,   415,   415,    64,     3,  1900,     3,   101,
+       3,   415,  1905,   400,  1647,  1514,   400,   107,   108,   109,
+     420,   416,   415,   415,   413,   413,   109,   413,  1986,  1303,
+    1304,  1305,  1306,  1307,  1308,  1309,  1310,   127,   413,  1932,
+     413,     3,  1316,  1317,  1318,  1319,     6,     6,  1681,  1682,
+     199,  1684,  1685,  1686,  1687,  1948,   415,   415,  1691,  1692,
+    1693,  1694,   415,   155,   400,  1800,   156,   157,   415,   413,
+     413,    34,   413,   413,   413,  1968,   413,   167,   168,   417,
+    1933,   413,   174,   413,   415,  1591,   413,   415,    35,   415,
+    1596,  1597,  1598,  1599,  1600,  1601,   413,   422,     3,    64,
+     424,    67,  1608,  1996,   413,   195,   413,   197,   413,   413,
+     413,   413,   413,   413,  2007,   413,   413,  2010,     3,   413,
+    2013,  2014,  2015,   413,   419,   413,   415,   413,  2021,   219,
+     422,   415,     3,   159,    43,  2028,     3,   422,   415,    61,
+     422,     1,   415,   233,   424,     3,   415,     3,  1647,   239,
+     415,   422,   244,     3,   418,  2076,  2077,   416,  2018,  2019,
+    2053,  2054,   422,   421,   421,   415,   421,   421,   258,   259,
+    1905,   422,   262,   263,   421,   421,   268,   269,   415,   422,
+     415,   422,  1681,  1682,     3,  1684,  1685,  1686,  1687,   421,
+     419,   421,  1691,  1692,  1693,  1694,    62,    30,   416,   416,
+     416,     3,  2095,  2124,  1837,   416,   416,    67,   415,   413,
+       3,     1,   222,     3,     4,     5,  2109,  2110,    78,    79,
+      10,    11,    12,    13,    62,   415,    16,    17,     3,   416,
+     422,   416,   416,   419,   416,    25,  1742,   416,  2131,   415,
+    1514,   333,   416,     3,  2137,   416,    36,     7,   413,    39,
+      40,    41,   415,   413,    64,   422,     3,   416,     3,   389,
+     120,     3,    69,   419,     5,   159,   421,   421,   421,   421,
+     421,   421,  2165,   421,   366,  2168,   421,   421,   415,  2172,
+     421,   421,   416,   421,   415,     3,     3,   147,   148,   149,
+     150,   151,   152,   153,   154,     3,     7,   415,   415,   422,
+    1933,   413,   413,   163,   164,   165,   166,  1940,  2229,   169,
+     170,   171,   172,    18,    19,   415,    21,    22,    23,    24,
+     414,    26,    27,    28,   415,   422,   413,   389,    33,   419,
+     416,   416,   416,    38,    39,    40,    41,   416,  1837,   416,
+     416,   416,   416,  2236,   416,    44,   416,   107,   108,   109,
+    1681,  1682,   420,  1684,  1685,  1686,  1687,   389,  2218,   416,
+    1691,  1692,  1693,  1694,   419,   416,   415,  2227,   421,   415,
+       3,    62,   422,  1647,    61,  1881,  1882,    61,     3,   420,
+     415,  1887,   418,   400,     3,   415,   415,   421,   413,  1895,
+    1896,     5,    62,   421,   421,   413,   156,   157,   421,   413,
+     421,   421,   421,  2036,   417,     3,   421,  1681,  1682,   421,
+    1684,  1685,  1686,  1687,   421,    62,   400,  1691,  1692,  1693,
+    1694,     3,   416,   419,   416,   415,   414,   425,   413,   416,
+     416,   422,    44,   415,  1933,   195,   415,   197,   421,   199,
+     420,    69,   416,  2076,  2077,   159,     1,   416,     3,     4,
+       5,   415,   202,   243,   211,    10,    11,    12,    13,   219,
+     415,    16,    17,   202,     3,   415,     3,   421,   389,   415,
+      25,     1,   421,   233,   264,   415,   266,   421,   421,   239,
+       3,    36,    61,   416,    39,    40,    41,   422,   416,   416,
+     416,  2124,   416,   416,   400,   415,  2002,  2003,   258,   259,
+     416,   416,   262,   263,   415,    69,   416,    64,   416,   416,
+     242,   415,   272,   416,   415,   415,   415,   307,   415,   415,
+     415,   311,   312,   416,   416,   416,   416,   317,   318,   319,
+     320,   321,   416,   323,   416,   416,   416,   416,   328,   329,
+     416,   400,   414,    64,   414,    64,   415,   415,  1980,  1989,
+     415,   415,   342,   413,   415,   345,  1616,    12,   413,   349,
+     417,  2165,   919,  1837,  2008,  1344,   237,  1989,   812,   527,
+    1986,   361,   362,   363,   531,   365,    40,  2076,  2077,  1704,
+      43,   371,  1531,   373,   374,   833,    33,   377,   378,   379,
+     244,   251,  1289,   654,   799,  2225,  2229,   606,   658,  1647,
+    2233,   568,  1800,  1564,   874,   715,   739,  2113,  1566,  1869,
+    1484,   401,   402,   403,   881,  1658,   406,   407,   983,  1096,
+    1500,  1139,   603,   413,  1525,  2124,   416,   417,   418,  1499,
+     759,   421,  1858,  2160,   940,   761,   426,   427,  1165,   444,
+      -1,    -1,     1,   789,     3,     4,     5,    -1,   790,    -1,
+      -1,    10,    11,    12,    13,    -1,    -1,    16,    17,  1933,
+      -1,  2167,    -1,  2169,  2170,    -1,    25,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,     1,    -1,     3,     4,    -1,    -1,
+      39,    40,    41,    -1,    -1,    -1,    -1,    -1,   243,    16,
+      17,  2197,    -1,    -1,    -1,    -1,   401,   402,   403,   404,
+     405,   406,   407,   408,   409,   410,    -1,    -1,    -1,   264,
+      -1,   266,    -1,    -1,    -1,    42,    -1,    -1,    -1,    -1,
+      47,    48,    -1,    -1,    -1,    52,    53,    54,    -1,    56,
+    2229,    90,    59,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   100,    -1,    -1,    71,    72,    73,    74,    -1,    -1,
+      -1,    78,   307,    -1,    -1,    -1,   311,   312,    -1,    -1,
+      -1,    -1,   317,   318,   319,   320,   321,    -1,   323,    -1,
+      -1,    -1,    -1,   328,   329,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   110,   111,    -1,    -1,   342,    -1,    -1,
+     345,    -1,    -1,    -1,   349,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,  2076,  2077,    -1,    -1,   361,   362,   363,    -1,
+     365,   138,    -1,    -1,    -1,   142,   371,    -1,   373,   374,
+      -1,    -1,   377,   378,   379,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   401,   402,   403,    -1,
+    2124,   406,   407,    -1,    -1,    -1,    -1,    -1,   413,    -1,
+      -1,   416,   417,   418,    -1,    -1,   421,    -1,    -1,   196,
+      -1,   426,   427,    -1,    -1,    -1,    -1,     1,    -1,     3,
+       4,     5,    -1,    -1,   243,    -1,    10,    11,    12,    13,
+      -1,    -1,    16,    17,    -1,    -1,    -1,    -1,    -1,   226,
+      -1,    25,    -1,    -1,    -1,   264,    -1,   266,    -1,    -1,
+      -1,    -1,   123,   124,    -1,    39,    40,    41,    -1,    -1,
+     131,   132,   133,   134,   135,    -1,    -1,    -1,   139,   256,
+      -1,    -1,   143,   144,    -1,    -1,    -1,   264,    -1,   266,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   307,    -1,
+      -1,    -1,   311,   312,    78,  2229,   167,   168,   317,   318,
+     319,   320,   321,    -1,   323,    -1,    -1,    -1,    -1,   328,
+     329,    -1,   183,   184,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   342,    -1,    -1,   345,    -1,    -1,    -1,
+     349,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   361,   362,   363,    -1,   365,    -1,    -1,    -1,
+      -1,    -1,   371,    -1,   373,   374,    -1,    -1,   377,   378,
+     379,    -1,     1,    -1,     3,     4,     5,    -1,    -1,    -1,
+      -1,    10,    11,    12,    13,    -1,    -1,    16,    17,    -1,
+      -1,    -1,   401,   402,   403,    -1,    25,   406,   407,   408,
+      -1,    -1,    -1,    -1,   413,    -1,    -1,    -1,    -1,   418,
+      39,    40,    41,   123,   124,    -1,    -1,   426,   427,    -1,
+      -1,   131,   132,   133,   134,   135,    -1,    -1,    -1,   139,
+      -1,    -1,    -1,   143,   144,    -1,    -1,    -1,   415,    -1,
+      -1,   418,    -1,    -1,    -1,    -1,    -1,   424,   425,    -1,
+      -1,    -1,   226,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    18,    19,    -1,    21,    22,    23,    24,   243,
+      26,    27,    28,   183,   184,    -1,    -1,    33,    -1,    -1,
+      -1,    37,    38,    39,    40,    41,    -1,    -1,    -1,    -1,
+     264,    -1,   266,    -1,    -1,    -1,     1,    -1,     3,     4,
+       5,    -1,    -1,    -1,    -1,    10,    11,    12,    13,    -1,
+      -1,    16,    17,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      25,    -1,    -1,   384,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   307,    39,    40,    41,   311,   312,    -1,
+      -1,    -1,    -1,   317,   318,   319,   320,   321,    -1,   323,
+      -1,    -1,    -1,    -1,   328,   329,    -1,    18,    19,    -1,
+      21,    22,    23,    24,    -1,    26,    27,    28,   342,    -1,
+      -1,   345,    33,    -1,    -1,   349,    37,    38,    39,    40,
+      41,    -1,    -1,    -1,    -1,    90,    -1,   361,   362,   363,
+      -1,   365,    -1,    -1,    -1,   100,    -1,   371,    -1,   373,
+     374,    -1,    -1,   377,   378,   379,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   243,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   401,   402,   403,
+      -1,    -1,   406,   407,    -1,   264,    -1,   266,    -1,   413,
+     414,    -1,    -1,    -1,   418,    -1,     1,    -1,     3,     4,
+       5,    -1,   426,   427,    -1,    10,    11,    12,    13,    -1,
+      -1,    16,    17,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      25,    -1,    -1,    -1,   384,    -1,   232,    -1,   307,    -1,
+      -1,    -1,   311,   312,    39,    40,    41,    -1,   317,   318,
+     319,   320,   321,    -1,   323,    -1,    -1,    -1,    -1,   328,
+     329,    -1,    57,    -1,    -1,    -1,    -1,    -1,    63,    -1,
+      -1,    -1,    -1,   342,    -1,    -1,   345,    -1,    -1,    -1,
+     349,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   361,   362,   363,    -1,   365,    -1,   243,    -1,
+      -1,    -1,   371,    -1,   373,   374,    -1,    -1,   377,   378,
+     379,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   264,
+      -1,   266,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   232,   401,   402,   403,    -1,    -1,   406,   407,     7,
+      -1,    -1,    -1,    -1,   413,    -1,    -1,   416,    -1,   418,
+      -1,    -1,   421,    -1,    -1,    -1,    -1,   426,   427,    -1,
+      -1,    -1,   307,    -1,    -1,    -1,   311,   312,    -1,    -1,
+      -1,    -1,   317,   318,   319,   320,   321,    -1,   323,    -1,
+      -1,    -1,    -1,   328,   329,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   342,    -1,    -1,
+     345,    -1,    70,   399,   349,   401,   402,   403,   404,   405,
+     406,   407,   408,   409,   410,    83,   361,   362,   363,    -1,
+     365,    -1,    -1,    -1,    -1,   421,   371,    -1,   373,   374,
+      98,    -1,   377,   378,   379,    -1,    -1,    -1,    -1,   107,
+     108,   109,    -1,    -1,    -1,    -1,    -1,    -1,   243,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   401,   402,   403,   127,
+      -1,   406,   407,    -1,    -1,    -1,    -1,    -1,   413,   264,
+      -1,   266,    -1,   418,    -1,     1,    -1,     3,     4,     5,
+      -1,   426,   427,    -1,    10,    11,    12,    13,   156,   157,
+      16,    17,    -1,    -1,   162,    -1,    -1,    -1,   399,    25,
+     401,   402,   403,   404,   405,   406,   407,   408,   409,   410,
+      -1,    -1,   307,    39,    40,    41,   311,   312,    -1,    -1,
+     421,    -1,   317,   318,   319,   320,   321,   195,   323,   197,
+      -1,    57,    -1,   328,   329,    -1,    -1,    63,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   342,    -1,    -1,
+     345,   219,    -1,    -1,   349,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   233,   361,   362,   363,    -1,
+     365,   239,    -1,    -1,    -1,    -1,   371,    -1,   373,   374,
+      -1,    -1,   377,   378,   379,    -1,    -1,    -1,    -1,    -1,
+     258,   259,    -1,    -1,   262,   263,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   271,    -1,    -1,   401,   402,   403,    -1,
+      -1,   406,   407,    -1,    -1,    -1,    -1,    -1,   413,    -1,
+      -1,    -1,    -1,   418,    -1,     1,    -1,     3,     4,     5,
+      -1,   426,   427,    -1,    10,    11,    12,    13,    -1,    -1,
+      16,    17,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    25,
+     123,   124,    -1,    -1,    -1,    -1,    -1,    -1,   131,   132,
+     133,   134,   135,    39,    40,    41,   139,    -1,   123,   124,
+     143,   144,    -1,    -1,    -1,    -1,   131,   132,   133,   134,
+     135,    57,    -1,    -1,   139,    -1,    -1,    63,   143,   144,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    18,    19,    -1,
+      21,    22,    23,    24,    -1,    26,    27,    28,    -1,    -1,
+     183,   184,    33,    -1,    -1,    -1,    -1,   243,    39,    40,
+      41,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   183,   184,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   264,    -1,
+     266,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,     1,
+      -1,     3,     4,     5,    -1,    -1,    -1,    -1,    10,    11,
+      12,    13,    -1,    -1,    16,    17,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    25,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   307,    -1,    -1,    -1,   311,   312,    39,    40,    41,
+      -1,   317,   318,   319,   320,   321,    -1,   323,    -1,    -1,
+      -1,    -1,   328,   329,    -1,    57,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   342,    -1,    -1,   345,
+      -1,    -1,    -1,   349,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   361,   362,   363,    -1,   365,
+      -1,    -1,    -1,    -1,    -1,   371,    -1,   373,   374,    -1,
+      -1,   377,   378,   379,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   243,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   401,   402,   403,    -1,    -1,
+     406,   407,    -1,    -1,    -1,    -1,    -1,   413,   264,    -1,
+     266,    -1,   418,    -1,     1,    -1,     3,     4,     5,    -1,
+     426,   427,    -1,    10,    11,    12,    13,    -1,    -1,    16,
+      17,   384,    -1,    -1,    -1,    -1,    -1,    -1,    25,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   384,
+      -1,   307,    39,    40,    41,   311,   312,    -1,    -1,    -1,
+      -1,   317,   318,   319,   320,   321,    -1,   323,    -1,    -1,
+      57,    -1,   328,   329,    -1,    18,    19,    -1,    21,    22,
+      23,    24,    -1,    26,    27,    28,   342,    -1,    -1,   345,
+      33,    -1,    -1,   349,    37,    38,    39,    40,    41,    -1,
+      -1,    -1,    -1,    -1,    -1,   361,   362,   363,    -1,   365,
+      -1,   243,    -1,    -1,    -1,   371,    -1,   373,   374,    -1,
+      -1,   377,   378,   379,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   264,    -1,   266,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   401,   402,   403,    -1,    -1,
+     406,   407,    -1,    -1,    -1,    -1,    -1,   413,    -1,    -1,
+      -1,    -1,   418,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     426,   427,    -1,    -1,    -1,   307,    -1,    -1,    -1,   311,
+     312,    -1,    -1,    -1,    -1,   317,   318,   319,   320,   321,
+      -1,   323,    -1,    -1,    -1,    -1,   328,   329,    -1,    -1,
+     401,   402,   403,   404,   405,   406,   407,   408,   409,   410,
+     342,    -1,     1,   345,     3,     4,     5,   349,    -1,    -1,
+      -1,    10,    11,    12,    13,    -1,    -1,    16,    17,   361,
+     362,   363,    -1,   365,    -1,    -1,    25,    -1,    -1,   371,
+      -1,   373,   374,    -1,    -1,   377,   378,   379,    -1,    -1,
+      39,    40,    41,    -1,    -1,    -1,   243,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    57,   401,
+     402,   403,    -1,    -1,   406,   407,    -1,   264,    -1,   266,
+      -1,   413,    -1,    -1,    -1,    -1,   418,    -1,    -1,   232,
+      -1,    -1,    -1,    -1,   426,   427,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     307,    -1,    -1,    -1,   311,   312,    -1,    -1,    -1,    -1,
+     317,   318,   319,   320,   321,    -1,   323,    -1,    -1,    -1,
+      -1,   328,   329,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   342,    -1,     1,   345,     3,
+       4,     5,   349,    -1,    -1,    -1,    10,    11,    12,    13,
+      -1,    -1,    16,    17,   361,   362,   363,    -1,   365,    -1,
+      -1,    25,    -1,    -1,   371,    -1,   373,   374,    -1,    -1,
+     377,   378,   379,    -1,    -1,    39,    40,    41,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   401,   402,   403,    -1,    -1,   406,
+     407,    -1,    -1,    -1,    -1,    -1,   413,    -1,    -1,    -1,
+      -1,   418,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   426,
+     427,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   243,    -1,   399,   400,   401,   402,
+     403,   404,   405,   406,   407,   408,   409,   410,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   264,    -1,   266,   421,    -1,
+      -1,     1,    -1,     3,     4,     5,    -1,    -1,    -1,    -1,
+      10,    11,    12,    13,    -1,    -1,    16,    17,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    25,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   307,    39,
+      40,    41,   311,   312,    -1,    -1,    -1,    -1,   317,   318,
+     319,   320,   321,    -1,   323,    -1,    -1,    -1,    -1,   328,
+     329,    -1,    18,    19,    -1,    21,    22,    23,    24,    -1,
+      26,    27,    28,   342,    -1,    -1,   345,    33,    -1,    -1,
+     349,    37,    38,    39,    40,    41,    -1,    -1,    -1,    -1,
+      -1,    -1,   361,   362,   363,    -1,   365,    -1,    -1,    -1,
+      -1,    -1,   371,    -1,   373,   374,    -1,    -1,   377,   378,
+     379,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   243,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   401,   402,   403,    -1,    -1,   406,   407,    -1,
+     264,    -1,   266,    -1,   413,    -1,    -1,    -1,    -1,   418,
+      -1,     1,    -1,     3,     4,     5,    -1,   426,   427,    -1,
+      10,    11,    12,    13,    -1,    -1,    16,    17,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    25,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   307,    -1,    -1,    -1,   311,   312,    39,
+      40,    41,    -1,   317,   318,   319,   320,   321,    -1,   323,
+      -1,    -1,    -1,    -1,   328,   329,    -1,    18,    19,    -1,
+      21,    22,    23,    24,    -1,    26,    27,    28,   342,    -1,
+      -1,   345,    33,    -1,    -1,   349,    37,    38,    39,    40,
+      41,    -1,    -1,    -1,    -1,    -1,    -1,   361,   362,   363,
+      -1,   365,    -1,   243,    -1,    -1,    -1,   371,    -1,   373,
+     374,    -1,    -1,   377,   378,   379,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   264,    -1,   266,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   232,   401,   402,   403,
+      -1,    -1,   406,   407,    -1,    -1,    -1,    -1,    -1,   413,
+      -1,    -1,   416,    -1,   418,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   426,   427,    -1,    -1,    -1,   307,    -1,    -1,
+      -1,   311,   312,    -1,    -1,    -1,    -1,   317,   318,   319,
+     320,   321,    -1,   323,    -1,    -1,    -1,    -1,   328,   329,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   342,    -1,     1,   345,     3,     4,     5,   349,
+      -1,    -1,    -1,    10,    11,    12,    13,    -1,    -1,    16,
+      17,   361,   362,   363,    -1,   365,    -1,    -1,    25,    -1,
+      -1,   371,    -1,   373,   374,    -1,    -1,   377,   378,   379,
+      -1,    -1,    39,    40,    41,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   243,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   401,   402,   403,    -1,    -1,   406,   407,    -1,    -1,
+      -1,    -1,    -1,   413,   264,    -1,   266,    -1,   418,    -1,
+      -1,   232,    -1,    -1,    -1,    -1,   426,   427,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   399,    -1,   401,   402,   403,   404,   405,
+     406,   407,   408,   409,   410,    -1,    -1,   307,    -1,    -1,
+      -1,   311,   312,    -1,    -1,   421,    -1,   317,   318,   319,
+     320,   321,    -1,   323,    -1,    -1,    -1,    -1,   328,   329,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   342,    -1,     1,   345,     3,     4,     5,   349,
+      -1,    -1,    -1,    10,    11,    12,    13,    -1,    -1,    16,
+      17,   361,   362,   363,    -1,   365,    -1,    -1,    25,    -1,
+      -1,   371,    -1,   373,   374,    -1,    -1,   377,   378,   379,
+      -1,    -1,    39,    40,    41,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   401,   402,   403,    -1,    -1,   406,   407,    -1,    -1,
+      -1,    -1,    -1,   413,    -1,    -1,    -1,    -1,   418,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   426,   427,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   243,    -1,   399,    -1,
+     401,   402,   403,   404,   405,   406,   407,   408,   409,   410,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   264,    -1,   266,
+     421,    -1,    -1,    -1,    -1,    -1,    -1,    -1,     1,    -1,
+       3,     4,     5,    -1,    -1,    -1,    -1,    10,    11,    12,
+      13,    -1,    -1,    16,    17,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    25,    -1,    -1,    -1,    -1,    -1,    -1,     3,
+     307,    -1,    -1,     7,   311,   312,    39,    40,    41,    -1,
+     317,   318,   319,   320,   321,    -1,   323,    -1,    -1,    -1,
+      -1,   328,   329,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   342,    -1,    -1,   345,    -1,
+      -1,    -1,   349,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   361,   362,   363,    -1,   365,    -1,
+      -1,    -1,    -1,    -1,   371,    -1,   373,   374,    -1,    -1,
+     377,   378,   379,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   243,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   401,   402,   403,    -1,    -1,   406,
+     407,    -1,    -1,   107,   108,   109,   413,   264,    -1,   266,
+      -1,   418,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   426,
+     427,    -1,    18,    19,    -1,    21,    22,    23,    24,    -1,
+      26,    27,    28,    -1,    -1,    -1,    -1,    33,    -1,    -1,
+      -1,    37,    38,    39,    40,    41,    -1,    -1,    -1,    -1,
+     307,    -1,   156,   157,   311,   312,    -1,    -1,    -1,    -1,
+     317,   318,   319,   320,   321,    -1,   323,    -1,    -1,    -1,
+      -1,   328,   329,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   342,    -1,    -1,   345,    -1,
+      -1,   195,   349,   197,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   361,   362,   363,    -1,   365,    -1,
+     243,    -1,    -1,    -1,   371,   219,   373,   374,    -1,    -1,
+     377,   378,   379,    -1,    -1,    -1,    -1,    -1,    -1,   233,
+      -1,   264,    -1,   266,    -1,   239,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   401,   402,   403,    -1,    -1,   406,
+     407,    -1,    -1,    -1,   258,   259,   413,    -1,   262,   263,
+      -1,   418,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   426,
+     427,    -1,    -1,    -1,   307,    -1,    -1,    -1,   311,   312,
+      -1,    -1,    -1,    -1,   317,   318,   319,   320,   321,    -1,
+     323,    -1,    -1,    -1,    -1,   328,   329,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   342,
+      -1,    -1,   345,     3,     4,     5,   349,    -1,    -1,    -1,
+      10,    11,    12,    13,    -1,    -1,    16,    17,   361,   362,
+     363,    -1,   365,    -1,    -1,    25,   232,    -1,   371,    -1,
+     373,   374,    -1,    -1,   377,   378,   379,    -1,    -1,    39,
+      40,    41,    -1,    -1,    -1,    -1,    18,    19,    -1,    21,
+      22,    23,    24,    -1,    26,    27,    28,    -1,   401,   402,
+     403,    33,    -1,   406,   407,    -1,    -1,    39,    40,    41,
+     413,    -1,    -1,    -1,    -1,   418,    76,    77,    67,    -1,
+      -1,    -1,    -1,   426,   427,    -1,    -1,    -1,    -1,    78,
+      79,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   102,   103,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   121,   122,   123,   124,    -1,    -1,    -1,    -1,    -1,
+      -1,   120,    -1,    -1,    -1,     3,     4,     5,    -1,    -1,
+     140,   141,    10,    11,    12,    13,    -1,    -1,    16,    17,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    25,   147,   148,
+     149,   150,   151,   152,   153,   154,    -1,    -1,    -1,    -1,
+      -1,    39,    40,    41,   163,   164,   165,   166,    -1,    -1,
+     169,   170,   171,   172,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   399,    -1,   401,   402,   403,   404,   405,
+     406,   407,   408,   409,   410,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   421,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    18,    19,    -1,    21,    22,    23,    24,
+      -1,    26,    27,    28,   102,   103,    -1,    -1,    33,    -1,
+      -1,    -1,    -1,   243,    39,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   121,   122,   123,   124,    -1,    -1,    -1,
+      -1,     3,     4,     5,   264,    -1,   266,    -1,    10,    11,
+      12,    13,   140,   141,    16,    17,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    25,    26,    27,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    39,    40,    41,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   307,    -1,    -1,
+      -1,   311,   312,    -1,    -1,    -1,    -1,   317,   318,   319,
+     320,   321,    -1,   323,    -1,    -1,    -1,    -1,   328,   329,
+      -1,    -1,    -1,    -1,    -1,    -1,    78,    -1,    -1,    -1,
+      -1,    -1,   342,    -1,    -1,   345,    -1,    -1,    -1,   349,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   361,   362,   363,    -1,   365,    -1,    -1,    -1,    -1,
+      -1,   371,    -1,   373,   374,   243,    -1,   377,   378,   379,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   264,    -1,   266,    -1,
+      -1,   401,   402,   403,    -1,    -1,   406,   407,    -1,    -1,
+      -1,    -1,    -1,   413,    -1,    -1,    -1,    -1,   418,    -1,
+      -1,    -1,    -1,    -1,   413,    -1,   426,   427,    -1,    -1,
+     402,   403,   404,   405,   406,   407,   408,   409,   410,   307,
+      -1,    -1,    -1,   311,   312,    -1,    -1,    -1,    -1,   317,
+     318,   319,   320,   321,    -1,   323,    -1,    -1,    -1,    -1,
+     328,   329,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   342,    -1,    -1,   345,    -1,    -1,
+      -1,   349,    -1,    -1,   226,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   361,   362,   363,    -1,   365,    -1,    -1,
+      -1,   243,    -1,   371,    -1,   373,   374,    -1,    -1,   377,
+     378,   379,    -1,    -1,    -1,    -1,    -1,    -1,     3,     4,
+       5,    -1,   264,    -1,   266,    10,    11,    12,    13,    -1,
+      -1,    16,    17,   401,   402,   403,    -1,    -1,   406,   407,
+      25,    -1,    -1,    -1,    -1,   413,    -1,    -1,    -1,    -1,
+     418,    -1,    -1,    -1,    39,    40,    41,    -1,   426,   427,
+      -1,    -1,    -1,    -1,    -1,   307,    -1,    -1,    -1,   311,
+     312,    -1,    -1,    -1,    -1,   317,   318,   319,   320,   321,
+      -1,   323,    -1,    -1,    -1,    -1,   328,   329,    -1,    -1,
+      -1,    -1,    -1,     1,    -1,     3,    -1,    -1,    -1,     7,
+     342,    -1,    -1,   345,    -1,    -1,    -1,   349,   403,   404,
+     405,   406,   407,   408,   409,   410,     7,    -1,    -1,   361,
+     362,   363,    -1,   365,    -1,    -1,   111,    -1,    -1,   371,
+      -1,   373,   374,    -1,    -1,   377,   378,   379,    -1,    -1,
+      -1,    -1,    -1,    -1,     3,     4,     5,    -1,    -1,    -1,
+      -1,    10,    11,    12,    13,    -1,    -1,    16,    17,   401,
+     402,   403,    -1,    -1,   406,   407,    25,    26,    27,    -1,
+      -1,   413,   414,    81,    82,    83,   418,    -1,    -1,    -1,
+      39,    40,    41,    -1,   426,   427,    -1,    -1,    -1,    97,
+      -1,    -1,    -1,    -1,    -1,   399,   400,    -1,    -1,   107,
+     108,   109,   406,    -1,   408,    -1,   410,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   107,   108,   109,   127,
+      -1,    -1,    -1,    -1,    -1,   429,   430,   431,   432,   433,
+     434,   435,   436,   437,   438,   439,   440,   441,   442,   443,
+     444,   445,   446,   447,    -1,    -1,    -1,    -1,   156,   157,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   242,   243,   167,
+     168,     3,     4,     5,    -1,   156,   157,    -1,    10,    11,
+      12,    13,    -1,    -1,    16,    17,    -1,    -1,    -1,   264,
+      -1,   266,    -1,    25,    -1,    -1,    -1,   195,    -1,   197,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    39,    40,    41,
+      -1,    -1,    -1,    -1,   195,    -1,   197,    -1,    -1,    -1,
+      -1,   219,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   307,    -1,    -1,   233,   311,   312,   219,    -1,
+      -1,   239,   317,   318,   319,   320,   321,    -1,   323,    -1,
+      -1,    -1,   233,   328,   329,    -1,    -1,   255,   239,    -1,
+     258,   259,    -1,    -1,   262,   263,    -1,   342,    -1,    -1,
+     345,    -1,    -1,    -1,   349,    -1,    -1,   258,   259,   111,
+      -1,   262,   263,    -1,    -1,    -1,   361,   362,   363,    -1,
+     365,    -1,    -1,    -1,   243,    -1,   371,    -1,   373,   374,
+      -1,    -1,   377,   378,   379,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   264,    -1,   266,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   401,   402,   403,    -1,
+      -1,   406,   407,    -1,    -1,    -1,    -1,    -1,   413,    -1,
+      -1,    -1,    -1,   418,    -1,    -1,    -1,    -1,    -1,   424,
+     425,   426,   427,    -1,    -1,    -1,    -1,    -1,   307,    -1,
+      -1,    -1,   311,   312,    -1,    -1,    -1,    -1,   317,   318,
+     319,   320,   321,    -1,   323,    -1,    -1,    -1,    -1,   328,
+     329,     3,     4,     5,    -1,    -1,    -1,    -1,    10,    11,
+      12,    13,    -1,   342,    16,    17,   345,    -1,    -1,    -1,
+     349,    -1,    -1,    25,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   243,   361,   362,   363,    -1,   365,    39,    40,    41,
+      -1,   419,   371,    -1,   373,   374,    -1,    -1,   377,   378,
+     379,    -1,   264,    -1,   266,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   401,   402,   403,    -1,    78,   406,   407,    -1,
+      -1,    -1,    -1,    -1,   413,   414,    -1,    -1,    -1,   418,
+      -1,    -1,    -1,    -1,    -1,   307,    -1,   426,   427,   311,
+     312,    -1,    -1,    -1,    -1,   317,   318,   319,   320,   321,
+      -1,   323,    -1,    -1,    -1,    -1,   328,   329,     3,     4,
+       5,    -1,    -1,    -1,    -1,    10,    11,    12,    13,    -1,
+     342,    16,    17,   345,    -1,    -1,    -1,   349,    -1,    -1,
+      25,    26,    27,    -1,    -1,    -1,    -1,    -1,    -1,   361,
+     362,   363,    -1,   365,    39,    40,    41,    -1,    -1,   371,
+      -1,   373,   374,    -1,    -1,   377,   378,   379,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   401,
+     402,   403,    -1,    -1,   406,   407,    -1,    -1,    -1,    -1,
+      -1,   413,    -1,    -1,    -1,    -1,   418,    -1,    -1,    -1,
+      -1,    -1,   424,   425,   426,   427,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   226,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,     3,     4,     5,    -1,    -1,
+      -1,   243,    10,    11,    12,    13,    -1,    -1,    16,    17,
+      -1,    -1,   399,   400,    -1,    -1,    -1,    25,    -1,   406,
+      -1,   408,   264,   410,   266,    -1,    -1,    -1,    -1,    -1,
+      -1,    39,    40,    41,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   429,   430,   431,   432,   433,   434,   435,   436,
+     437,   438,   439,   440,   441,   442,   443,   444,   445,   446,
+     447,    -1,    -1,    -1,    -1,   307,    -1,    -1,    -1,   311,
+     312,    -1,    -1,    -1,    -1,   317,   318,   319,   320,   321,
+      -1,   323,    -1,    -1,    -1,    -1,   328,   329,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     342,    -1,    -1,   345,    -1,    -1,    -1,   349,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   243,   361,
+     362,   363,    -1,   365,    -1,    -1,    -1,    -1,    -1,   371,
+      -1,   373,   374,    -1,    -1,   377,   378,   379,    -1,   264,
+      -1,   266,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   401,
+     402,   403,    -1,    -1,   406,   407,    -1,    -1,    -1,    -1,
+      -1,   413,   414,    -1,    -1,    -1,   418,    -1,    -1,    -1,
+      -1,    -1,   307,    -1,   426,   427,   311,   312,    -1,    -1,
+      -1,    -1,   317,   318,   319,   320,   321,    -1,   323,    -1,
+      -1,    -1,    -1,   328,   329,     3,     4,     5,    -1,    -1,
+      -1,    -1,    10,    11,    12,    13,    -1,   342,    16,    17,
+     345,    -1,    -1,    -1,   349,    -1,    -1,    25,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   243,   361,   362,   363,    -1,
+     365,    39,    40,    41,    -1,    -1,   371,    -1,   373,   374,
+      -1,    -1,   377,   378,   379,    -1,   264,    -1,   266,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   401,   402,   403,    -1,
+      78,   406,   407,    -1,    -1,    -1,    -1,    -1,   413,    -1,
+      -1,    -1,    -1,   418,    -1,    -1,    -1,    -1,    -1,   307,
+      -1,   426,   427,   311,   312,    -1,    -1,    -1,    -1,   317,
+     318,   319,   320,   321,    -1,   323,    -1,    -1,    -1,    -1,
+     328,   329,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   342,    -1,    -1,   345,     3,     4,
+       5,   349,    -1,    -1,    -1,    10,    11,    12,    13,    -1,
+      -1,    16,    17,   361,   362,   363,    -1,   365,    -1,    -1,
+      25,    -1,    -1,   371,    -1,   373,   374,    -1,    -1,   377,
+     378,   379,    -1,    -1,    39,    40,    41,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   401,   402,   403,    -1,    -1,   406,   407,
+      -1,    -1,    -1,    -1,    -1,   413,    -1,    -1,    -1,    -1,
+     418,    -1,   420,    -1,    -1,   423,    -1,    -1,   426,   427,
+      -1,    -1,    -1,    -1,    -1,    90,    -1,    -1,   226,    -1,
+      -1,    -1,    -1,    -1,    -1,   100,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   243,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,     3,     4,     5,    -1,   264,    -1,   266,    10,
+      11,    12,    13,    -1,    -1,    16,    17,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    25,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    39,    40,
+      41,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   307,
+      -1,    -1,    -1,   311,   312,    -1,    -1,    -1,    -1,   317,
+     318,   319,   320,   321,    -1,   323,    -1,    -1,    -1,    -1,
+     328,   329,    -1,    -1,    -1,    -1,    -1,    78,    -1,    -1,
+      -1,    -1,    -1,    -1,   342,    -1,    -1,   345,    -1,    -1,
+      -1,   349,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   361,   362,   363,    -1,   365,    -1,    -1,
+      -1,    -1,    -1,   371,    -1,   373,   374,    -1,   243,   377,
+     378,   379,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   264,
+      -1,   266,    -1,   401,   402,   403,    -1,    -1,   406,   407,
+      -1,    -1,    -1,    -1,    -1,   413,    -1,    -1,    -1,    -1,
+     418,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   426,   427,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   307,    -1,    -1,    -1,   311,   312,    -1,    -1,
+      -1,    -1,   317,   318,   319,   320,   321,    -1,   323,    -1,
+      -1,    -1,    -1,   328,   329,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   342,    -1,    -1,
+     345,    -1,    -1,    -1,   349,   226,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   361,   362,   363,    -1,
+     365,    -1,   243,    -1,    -1,    -1,   371,    -1,   373,   374,
+      -1,    -1,   377,   378,   379,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   264,    -1,   266,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   401,   402,   403,    -1,
+      -1,   406,   407,    -1,     1,    -1,     3,    -1,   413,    -1,
+       7,    -1,    -1,   418,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   426,   427,    -1,    -1,    -1,   307,    -1,    -1,    -1,
+     311,   312,    -1,    -1,    -1,    -1,   317,   318,   319,   320,
+     321,    -1,   323,    -1,    -1,    -1,    -1,   328,   329,     3,
+       4,     5,    -1,    -1,    -1,    -1,    10,    11,    12,    13,
+      -1,   342,    16,    17,   345,    -1,    -1,    -1,   349,    -1,
+      -1,    25,    -1,    -1,    -1,    -1,    -1,    -1,    75,    -1,
+     361,   362,   363,    -1,   365,    39,    40,    41,    -1,    -1,
+     371,    -1,   373,   374,    -1,    -1,   377,   378,   379,    -1,
+      -1,    -1,    -1,    57,    -1,    -1,    -1,    -1,    -1,    63,
+     107,   108,   109,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     401,   402,   403,    -1,    -1,   406,   407,    -1,    -1,   126,
+      -1,    -1,   413,    -1,    -1,    -1,    -1,   418,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   426,   427,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   156,
+     157,    -1,    -1,    -1,    -1,    -1,     3,     4,     5,    -1,
+      -1,    -1,    -1,    10,    11,    12,    13,    -1,    -1,    16,
+      17,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    25,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   195,    -1,
+     197,    -1,    39,    40,    41,   202,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   211,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   219,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   233,    -1,    -1,    -1,
+      -1,   238,   239,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   249,    -1,   251,   252,    -1,    -1,    -1,    -1,
+      -1,   258,   259,    -1,   261,   262,   263,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   275,    -1,
+      -1,    -1,    -1,     3,     4,     5,    -1,    -1,    -1,   243,
+      10,    11,    12,    13,    -1,    -1,    16,    17,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    25,    -1,    -1,    -1,    -1,
+     264,    -1,   266,    -1,    -1,    -1,    -1,    -1,    -1,    39,
+      40,    41,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    18,
+      19,    -1,    21,    22,    23,    24,    -1,    26,    27,    28,
+      -1,    -1,    31,    32,    33,    -1,    -1,    -1,    37,    38,
+      39,    40,    41,   307,    -1,    -1,    -1,   311,   312,    -1,
+      -1,    -1,    -1,   317,   318,   319,   320,   321,    -1,   323,
+      -1,    -1,    -1,    -1,   328,   329,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   342,    -1,
+      -1,   345,    -1,    -1,    -1,   349,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   243,   361,   362,   363,
+      -1,   365,    -1,    -1,    -1,    -1,    -1,   371,    -1,   373,
+     374,    -1,    -1,   377,   378,   379,    -1,   264,    -1,   266,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   401,   402,   403,
+      -1,    -1,   406,   407,    -1,    -1,    -1,    -1,    -1,   413,
+      -1,    -1,    -1,    -1,   418,    -1,    -1,    -1,    -1,    -1,
+     307,    -1,   426,   427,   311,   312,    -1,    -1,    -1,    -1,
+     317,   318,   319,   320,   321,    -1,   323,    -1,    -1,    -1,
+      -1,   328,   329,     3,     4,     5,    -1,    -1,    -1,    -1,
+      10,    11,    12,    13,    -1,   342,    16,    17,   345,    -1,
+      -1,    -1,   349,    -1,    -1,    25,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   243,   361,   362,   363,    -1,   365,    39,
+      40,    41,    -1,    -1,   371,    -1,   373,   374,    -1,    -1,
+     377,   378,   379,   232,   264,    -1,   266,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   401,   402,   403,    -1,    -1,   406,
+     407,    -1,    -1,    -1,    -1,    -1,   413,   414,    -1,    -1,
+      -1,   418,    -1,    -1,    -1,    -1,    -1,   307,    -1,   426,
+     427,   311,   312,    -1,    -1,    -1,    -1,   317,   318,   319,
+     320,   321,    -1,   323,    -1,    -1,    -1,    -1,   328,   329,
+       3,     4,     5,    -1,    -1,    -1,    -1,    10,    11,    12,
+      13,    -1,   342,    16,    17,   345,    -1,    -1,    -1,   349,
+      -1,    -1,    25,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   361,   362,   363,    -1,   365,    39,    40,    41,    -1,
+      -1,   371,    -1,   373,   374,    -1,    -1,   377,   378,   379,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   401,   402,   403,    -1,    -1,   406,   407,    -1,    -1,
+      -1,    -1,    -1,   413,    -1,    -1,   416,    -1,   418,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   426,   427,    -1,    -1,
+     399,   400,   401,   402,   403,   404,   405,   406,   407,   408,
+     409,   410,    -1,    -1,    -1,    -1,    -1,     3,     4,     5,
+      -1,   420,    -1,   243,    10,    11,    12,    13,    -1,    -1,
+      16,    17,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    25,
+      -1,    -1,    -1,    -1,   264,    -1,   266,    -1,    -1,    -1,
+      -1,    -1,    -1,    39,    40,    41,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    18,    19,    -1,    21,    22,    23,    24,
+      -1,    26,    27,    28,    -1,    -1,    -1,    -1,    33,    -1,
+      -1,    -1,    37,    38,    39,    40,    41,   307,    -1,    -1,
+      -1,   311,   312,    -1,    -1,    -1,    -1,   317,   318,   319,
+     320,   321,    -1,   323,    -1,    -1,    -1,    -1,   328,   329,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   342,    -1,    -1,   345,    -1,    -1,    -1,   349,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     243,   361,   362,   363,    -1,   365,    -1,    -1,    -1,    -1,
+      -1,   371,    -1,   373,   374,    -1,    -1,   377,   378,   379,
+      -1,   264,    -1,   266,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   401,   402,   403,    -1,    -1,   406,   407,    -1,    -1,
+      -1,    -1,    -1,   413,    -1,    -1,   416,    -1,   418,    -1,
+      -1,    -1,    -1,    -1,   307,    -1,   426,   427,   311,   312,
+      -1,    -1,    -1,    -1,   317,   318,   319,   320,   321,    -1,
+     323,    -1,    -1,    -1,    -1,   328,   329,     3,     4,     5,
+      -1,    -1,    -1,    -1,    10,    11,    12,    13,    -1,   342,
+      16,    17,   345,    -1,    -1,    -1,   349,    -1,    -1,    25,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   243,   361,   362,
+     363,    -1,   365,    39,    40,    41,    -1,    -1,   371,    -1,
+     373,   374,    -1,    -1,   377,   378,   379,   232,   264,    -1,
+     266,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   401,   402,
+     403,    -1,    -1,   406,   407,    -1,    -1,    -1,    -1,    -1,
+     413,    -1,    -1,    -1,    -1,   418,   419,    -1,    -1,    -1,
+      -1,   307,    -1,   426,   427,   311,   312,    -1,    -1,    -1,
+      -1,   317,   318,   319,   320,   321,    -1,   323,    -1,    -1,
+      -1,    -1,   328,   329,     3,     4,     5,    -1,    -1,    -1,
+      -1,    10,    11,    12,    13,    -1,   342,    16,    17,   345,
+      -1,    -1,    -1,   349,    -1,    -1,    25,   353,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   361,   362,   363,    -1,   365,
+      39,    40,    41,    -1,    -1,   371,    -1,   373,   374,    -1,
+      -1,   377,   378,   379,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   401,   402,   403,    -1,    -1,
+     406,   407,    -1,    -1,    -1,    -1,    -1,   413,    -1,    -1,
+      -1,    -1,   418,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     426,   427,    -1,    -1,   399,   400,   401,   402,   403,   404,
+     405,   406,   407,   408,   409,   410,    -1,    -1,    -1,    -1,
+      -1,     3,     4,     5,    -1,   420,   242,   243,    10,    11,
+      12,    13,    -1,    -1,    16,    17,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    25,    -1,    -1,    -1,    -1,   264,    -1,
+     266,    -1,    -1,    -1,    -1,    -1,    -1,    39,    40,    41,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    18,    19,    -1,
+      21,    22,    23,    24,    -1,    26,    27,    28,    -1,    -1,
+      -1,    -1,    33,    -1,    -1,    -1,    37,    38,    39,    40,
+      41,   307,    -1,    -1,    -1,   311,   312,    -1,    -1,    -1,
+      -1,   317,   318,   319,   320,   321,    -1,   323,    -1,    -1,
+      -1,    -1,   328,   329,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   342,    -1,    -1,   345,
+      -1,    -1,    -1,   349,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   243,   361,   362,   363,    -1,   365,
+      -1,    -1,    -1,    -1,    -1,   371,    -1,   373,   374,    -1,
+      -1,   377,   378,   379,    -1,   264,    -1,   266,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   401,   402,   403,    -1,    -1,
+     406,   407,    -1,    -1,    -1,    -1,    -1,   413,    -1,    -1,
+      -1,    -1,   418,    -1,    -1,    -1,    -1,    -1,   307,    -1,
+     426,   427,   311,   312,    -1,    -1,    -1,    -1,   317,   318,
+     319,   320,   321,    -1,   323,    -1,    -1,    -1,    -1,   328,
+     329,     3,     4,     5,    -1,    -1,    -1,    -1,    10,    11,
+      12,    13,    -1,   342,    16,    17,   345,    -1,    -1,    -1,
+     349,    -1,    -1,    25,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   243,   361,   362,   363,    -1,   365,    39,    40,    41,
+      -1,    -1,   371,    -1,   373,   374,    -1,    -1,   377,   378,
+     379,   232,   264,    -1,   266,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   401,   402,   403,    -1,    -1,   406,   407,    -1,
+      -1,    -1,    -1,    -1,   413,    -1,   415,    -1,    -1,   418,
+      -1,    -1,    -1,    -1,    -1,   307,    -1,   426,   427,   311,
+     312,    -1,    -1,    -1,    -1,   317,   318,   319,   320,   321,
+      -1,   323,    -1,    -1,    -1,    -1,   328,   329,     3,     4,
+       5,    -1,    -1,    -1,    -1,    10,    11,    12,    13,    -1,
+     342,    16,    17,   345,    -1,    -1,    -1,   349,    -1,    -1,
+      25,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   361,
+     362,   363,    -1,   365,    39,    40,    41,    -1,    -1,   371,
+      -1,   373,   374,    -1,    -1,   377,   378,   379,    -1,    -1,
+      -1,    -1,    57,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   401,
+     402,   403,    -1,    -1,   406,   407,    -1,    -1,    -1,    -1,
+      -1,   413,    -1,    -1,    -1,   417,   418,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   426,   427,    -1,    -1,   399,   400,
+     401,   402,   403,   404,   405,   406,   407,   408,   409,   410,
+      -1,    -1,    -1,    -1,    -1,     3,     4,     5,    -1,   420,
+      -1,   243,    10,    11,    12,    13,    -1,    -1,    16,    17,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    25,    -1,    -1,
+      -1,    -1,   264,    -1,   266,    -1,    -1,    -1,    -1,    -1,
+      -1,    39,    40,    41,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    18,    19,    -1,    21,    22,    23,    24,    -1,    26,
+      27,    28,    -1,    -1,    -1,    -1,    33,    -1,    -1,    -1,
+      37,    38,    39,    40,    41,   307,    -1,    -1,    -1,   311,
+     312,    -1,    -1,    -1,    -1,   317,   318,   319,   320,   321,
+      -1,   323,    -1,    -1,    -1,    -1,   328,   329,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     342,    -1,    -1,   345,    -1,    -1,    -1,   349,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   243,   361,
+     362,   363,    -1,   365,    -1,    -1,    -1,    -1,    -1,   371,
+      -1,   373,   374,    -1,    -1,   377,   378,   379,    -1,   264,
+      -1,   266,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   401,
+     402,   403,    -1,    -1,   406,   407,    -1,    -1,    -1,    -1,
+      -1,   413,    -1,    -1,   416,    -1,   418,    -1,    -1,    -1,
+      -1,    -1,   307,    -1,   426,   427,   311,   312,    -1,    -1,
+      -1,    -1,   317,   318,   319,   320,   321,    -1,   323,    -1,
+      -1,    -1,    -1,   328,   329,     3,     4,     5,    -1,    -1,
+      -1,    -1,    10,    11,    12,    13,    -1,   342,    16,    17,
+     345,    -1,    -1,    -1,   349,    -1,    -1,    25,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   243,   361,   362,   363,    -1,
+     365,    39,    40,    41,    -1,    -1,   371,    -1,   373,   374,
+      -1,    -1,   377,   378,   379,   232,   264,    -1,   266,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   401,   402,   403,    -1,
+      -1,   406,   407,    -1,    -1,    -1,    -1,    -1,   413,    -1,
+      -1,    -1,    -1,   418,    -1,    -1,    -1,    -1,    -1,   307,
+      -1,   426,   427,   311,   312,    -1,    -1,    -1,    -1,   317,
+     318,   319,   320,   321,    -1,   323,    -1,    -1,    -1,    -1,
+     328,   329,     3,     4,     5,    -1,    -1,    -1,    -1,    10,
+      11,    12,    13,    -1,   342,    16,    17,   345,    -1,    -1,
+      -1,   349,    -1,    -1,    25,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   361,   362,   363,    -1,   365,    39,    40,
+      41,    -1,    -1,   371,    -1,   373,   374,    -1,    -1,   377,
+     378,   379,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   401,   402,   403,    -1,    -1,   406,   407,
+      -1,    -1,    -1,    -1,    -1,   413,    -1,    -1,   416,    -1,
+     418,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   426,   427,
+      -1,    -1,   399,    -1,   401,   402,   403,   404,   405,   406,
+     407,   408,   409,   410,    -1,    -1,    -1,    -1,    -1,     3,
+       4,     5,    -1,   420,    -1,   243,    10,    11,    12,    13,
+      -1,    -1,    16,    17,    -1,    -1,   399,   400,    -1,    -1,
+      -1,    25,    -1,   406,    -1,   408,   264,   410,   266,    -1,
+      -1,    -1,    -1,    -1,    -1,    39,    40,    41,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   429,   430,   431,   432,
+     433,   434,   435,   436,   437,   438,   439,   440,   441,   442,
+     443,   444,   445,   446,   447,    -1,    -1,    -1,    -1,   307,
+      -1,    -1,    -1,   311,   312,    -1,    -1,    -1,    -1,   317,
+     318,   319,   320,   321,    -1,   323,    -1,    -1,    -1,    -1,
+     328,   329,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   342,    -1,    -1,   345,    -1,    -1,
+      -1,   349,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   243,   361,   362,   363,    -1,   365,    -1,    -1,
+      -1,    -1,    -1,   371,    -1,   373,   374,    -1,    -1,   377,
+     378,   379,    -1,   264,    -1,   266,    -1,    -1,    -1,    -1,
+      -1,    18,    19,    -1,    21,    22,    23,    24,    -1,    26,
+      27,    28,    -1,   401,   402,   403,    33,    -1,   406,   407,
+      37,    38,    39,    40,    41,   413,    -1,    -1,    -1,    -1,
+     418,    -1,    -1,    -1,    -1,    -1,   307,    -1,   426,   427,
+     311,   312,    -1,    -1,    -1,    -1,   317,   318,   319,   320,
+     321,    -1,   323,    -1,    -1,    -1,    -1,   328,   329,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   342,    -1,    -1,   345,    -1,    -1,    -1,   349,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   243,
+     361,   362,   363,    -1,   365,    -1,    -1,    -1,    -1,    -1,
+     371,    -1,   373,   374,    -1,    -1,   377,   378,   379,    -1,
+     264,    -1,   266,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     401,   402,   403,    -1,    -1,   406,   407,    -1,    -1,    -1,
+      -1,    -1,   413,    -1,    -1,    -1,    -1,   418,    -1,    -1,
+      -1,    -1,    -1,   307,    -1,   426,   427,   311,   312,    -1,
+      -1,    -1,    -1,   317,   318,   319,   320,   321,    -1,   323,
+      -1,    -1,    -1,    -1,   328,   329,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   342,    -1,
+      -1,   345,    -1,    -1,    -1,   349,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   361,   362,   363,
+      -1,   365,    -1,    -1,    -1,   232,    -1,   371,    -1,   373,
+     374,    -1,    -1,   377,   378,   379,    -1,    -1,     1,    -1,
+       3,     4,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+       1,    -1,     3,    16,    17,    -1,     7,   401,   402,   403,
+      -1,    -1,   406,   407,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   418,    -1,    -1,    -1,    -1,    42,
+      -1,    -1,   426,   427,    47,    48,    -1,    -1,    -1,    52,
+      53,    54,    -1,    56,    -1,    -1,    59,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    71,    72,
+      73,    74,    -1,    -1,    -1,    78,     1,    -1,     3,     4,
+       5,    -1,    -1,    -1,    -1,    10,    11,    12,    13,    -1,
+      81,    82,    83,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      25,    -1,    -1,    -1,    -1,    -1,    97,   110,   111,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   107,   108,   109,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   138,   127,    -1,    -1,   142,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   399,    -1,   401,   402,   403,   404,   405,   406,
+     407,   408,   409,   410,    -1,   156,   157,    -1,    -1,    -1,
+      -1,    -1,    -1,   420,    -1,    -1,   167,   168,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   196,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   195,     1,   197,     3,     4,     5,
+      -1,    -1,    -1,    -1,    10,    11,    12,    13,    -1,    -1,
+      -1,    -1,    -1,   226,    -1,    -1,    -1,    -1,   219,    25,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   233,    -1,    -1,    -1,    -1,    -1,   239,    -1,
+      -1,    -1,    -1,   256,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   264,    -1,   266,   255,    -1,    -1,   258,   259,    -1,
+      -1,   262,   263,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,     3,
+       4,     5,    -1,    -1,    -1,    -1,    10,    11,    12,    13,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    25,    -1,    -1,    -1,    -1,    -1,    -1,   243,    -1,
+      -1,    -1,    -1,    -1,    -1,    18,    19,    -1,    21,    22,
+      23,    24,    -1,    26,    27,    28,    -1,    -1,    -1,   264,
+      33,   266,    -1,    -1,    37,    38,    39,    40,    41,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   307,    -1,    -1,    -1,   311,   312,    -1,    -1,
+      -1,    -1,   317,   318,   319,   320,   321,    -1,   323,    -1,
+      -1,    -1,    -1,   328,   329,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   418,    -1,   342,    -1,    -1,
+     345,   424,   425,    -1,   349,   416,    -1,    -1,   419,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   361,   362,   363,    -1,
+     365,    -1,    -1,    -1,    -1,    -1,   371,   243,   373,   374,
+      -1,    -1,   377,   378,   379,    -1,    -1,     3,     4,     5,
+      -1,    -1,    -1,    -1,    10,    11,    12,    13,   264,    -1,
+     266,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    25,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   413,    -1,
+      -1,    -1,    -1,   418,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   307,    -1,    -1,    60,   311,   312,    -1,    -1,    -1,
+      -1,   317,   318,   319,   320,   321,    -1,   323,    -1,   243,
+      -1,    -1,   328,   329,    -1,    -1,    -1,    -1,    -1,   232,
+      -1,    -1,    -1,    -1,    90,    -1,   342,    -1,    -1,   345,
+     264,    -1,   266,   349,   100,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   361,   362,   363,    -1,   365,
+      -1,    -1,    -1,    -1,    -1,   371,    -1,   373,   374,    -1,
+      -1,   377,   378,   379,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   307,    -1,    -1,    -1,   311,   312,    -1,
+      -1,    -1,    -1,   317,   318,   319,   320,   321,    -1,   323,
+      -1,    -1,    -1,    -1,   328,   329,    -1,   413,    -1,    -1,
+      -1,    -1,   418,    -1,    -1,    -1,    -1,    -1,   342,    -1,
+      -1,   345,    -1,    -1,    -1,   349,     3,     4,     5,    -1,
+      -1,    -1,    -1,    10,    11,    12,    13,   361,   362,   363,
+      -1,   365,    -1,    -1,    -1,    -1,    -1,   371,    25,   373,
+     374,    -1,    -1,   377,   378,   379,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   401,   402,   403,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   243,    -1,   413,
+      -1,    -1,    -1,    -1,   418,    -1,   399,    -1,   401,   402,
+     403,   404,   405,   406,   407,   408,   409,   410,   264,    -1,
+     266,    -1,    -1,    -1,     3,     4,     5,   420,    -1,    -1,
+      -1,    10,    11,    12,    13,    18,    19,    -1,    21,    22,
+      23,    24,    -1,    26,    27,    28,    25,    -1,    -1,    -1,
+      33,    -1,    -1,    -1,    37,    38,    39,    40,    41,    -1,
+      -1,   307,    -1,    -1,    -1,   311,   312,    -1,    -1,    -1,
+      -1,   317,   318,   319,   320,   321,    -1,   323,    -1,    -1,
+      -1,    -1,   328,   329,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   342,    -1,    -1,   345,
+      -1,    -1,    -1,   349,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   361,   362,   363,    -1,   365,
+      -1,    -1,    -1,    -1,    -1,   371,    -1,   373,   374,    -1,
+      -1,   377,   378,   379,    -1,    -1,    -1,    -1,    -1,    -1,
+       3,     4,     5,    -1,    -1,    -1,    -1,    10,    11,    12,
+      13,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    25,    -1,    -1,    -1,    -1,   413,    -1,    -1,
+     399,    -1,   418,    -1,    -1,    -1,   243,   406,   407,   408,
+      -1,   410,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   264,    -1,   266,
+     429,   430,   431,   432,   433,   434,   435,   436,   437,   438,
+     439,   440,   441,   442,   443,   444,   445,   446,   447,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     307,    -1,    -1,    -1,   311,   312,    -1,    -1,    -1,   232,
+     317,   318,   319,   320,   321,    -1,   323,    -1,    -1,    -1,
+      -1,   328,   329,    -1,   243,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   342,    -1,    -1,   345,    -1,
+      -1,    -1,   349,    -1,    -1,   264,   353,   266,    -1,    -1,
+      -1,    -1,    -1,    -1,   361,   362,   363,    -1,   365,    -1,
+      -1,    -1,    -1,    -1,   371,    -1,   373,   374,    -1,    -1,
+     377,   378,   379,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   307,    -1,
+      -1,    -1,   311,   312,    -1,    -1,    -1,    -1,   317,   318,
+     319,   320,   321,    -1,   323,    -1,   413,    -1,    -1,   328,
+     329,   418,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   342,    -1,    -1,   345,    -1,    -1,    -1,
+     349,    -1,    -1,    -1,   353,    -1,    -1,    -1,    -1,    -1,
+     243,    -1,   361,   362,   363,    -1,   365,    -1,    -1,    -1,
+      -1,    -1,   371,    -1,   373,   374,    -1,    -1,   377,   378,
+     379,   264,    -1,   266,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   399,    -1,   401,   402,
+     403,   404,   405,   406,   407,   408,   409,   410,    -1,    -1,
+      -1,    -1,    -1,    -1,   413,    -1,    -1,   420,    -1,   418,
+      -1,    -1,    -1,    -1,   307,    -1,    -1,    -1,   311,   312,
+      -1,    -1,    -1,    -1,   317,   318,   319,   320,   321,    -1,
+     323,    -1,    -1,    -1,    -1,   328,   329,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   342,
+      -1,    -1,   345,    -1,    -1,    -1,   349,     1,    -1,     3,
+      -1,    -1,    -1,     7,     8,    -1,    -1,    -1,   361,   362,
+     363,    -1,   365,    -1,    -1,    -1,    -1,    -1,   371,    -1,
+     373,   374,    -1,    -1,   377,   378,   379,    -1,    -1,    -1,
+      34,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    45,    46,    47,    48,    49,    50,    51,    52,    -1,
+      -1,    55,    -1,    -1,    58,    -1,    -1,    -1,    -1,    -1,
+     413,    -1,    -1,    -1,    -1,   418,    70,    71,    -1,    -1,
+      -1,    75,    -1,    -1,    78,    -1,    80,    81,    82,    83,
+      -1,    -1,    86,    -1,    88,    89,    -1,    91,    92,    93,
+      94,    95,    96,    97,    98,    99,    -1,    -1,    -1,    -1,
+     104,   105,   106,   107,   108,   109,    -1,    -1,   112,   113,
+     114,   115,   116,    -1,    -1,   119,   120,    -1,    -1,   123,
+     124,    -1,   126,   127,   128,   129,   130,   131,   132,   133,
+     134,   135,   136,    -1,    -1,   139,    -1,    -1,    -1,   143,
+     144,   145,   146,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   155,   156,   157,    -1,    -1,   160,   161,   162,    -1,
+      -1,    -1,    18,    19,    -1,    21,    22,    23,    24,    -1,
+      26,    27,    28,    -1,    -1,    -1,    -1,    33,    -1,   183,
+     184,    37,    38,    39,    40,    41,    -1,    -1,    -1,    -1,
+      -1,   195,    -1,   197,    -1,   199,    -1,    -1,    -1,    -1,
+      -1,    -1,    18,    19,    -1,    21,    22,    23,    24,    -1,
+      26,    27,    28,    -1,    -1,   219,    -1,    33,    -1,    -1,
+     224,    37,    38,    39,    40,    41,    -1,   231,    -1,   233,
+      -1,    -1,    -1,    -1,    -1,   239,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   247,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   255,    -1,    -1,   258,   259,    -1,    -1,   262,   263,
+      18,    19,    -1,    21,    22,    23,    24,   271,    26,    27,
+      28,   275,    -1,    -1,    -1,    33,    -1,   281,   282,    37,
+      38,    39,    40,    41,    18,    19,    -1,    21,    22,    23,
+      24,    -1,    26,    27,    28,    -1,    -1,    -1,    -1,    33,
+      -1,    -1,    -1,    37,    38,    39,    40,    41,    42,    18,
+      19,   315,    21,    22,    23,    24,   399,    26,    27,    28,
+      -1,    -1,    -1,   406,    33,   408,    -1,   410,    37,    38,
+      39,    40,    41,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   429,   430,   431,   432,
+     433,   434,   435,   436,   437,   438,   439,   440,   441,   442,
+     443,   444,   445,   446,   447,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   232,    -1,    -1,    -1,
+     384,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   415,    -1,    -1,    -1,    -1,   232,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    18,    19,    -1,    21,    22,    23,    24,
+      -1,    26,    27,    28,   232,   209,    -1,    -1,    33,    -1,
+      -1,    -1,    37,    38,    39,    40,    41,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    18,    19,   232,    21,
+      22,    23,    24,    -1,    26,    27,    28,    -1,    -1,    -1,
+      -1,    33,    -1,    -1,    -1,    37,    38,    39,    40,    41,
+      -1,    -1,    -1,   232,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   399,    -1,   401,   402,   403,   404,   405,
+     406,   407,   408,   409,   410,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   420,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   399,    -1,   401,   402,   403,   404,   405,
+     406,   407,   408,   409,   410,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   420,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   399,    -1,   401,   402,   403,   404,   405,   406,   407,
+     408,   409,   410,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   420,    -1,    -1,   399,    -1,   401,   402,   403,
+     404,   405,   406,   407,   408,   409,   410,   232,    -1,    -1,
+       1,   415,     3,    -1,   418,    -1,     7,     8,    -1,    -1,
+     399,    -1,   401,   402,   403,   404,   405,   406,   407,   408,
+     409,   410,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   418,
+     232,    -1,    -1,    34,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    45,    46,    47,    -1,    49,    50,
+      51,    52,    -1,    -1,    55,    -1,    -1,    58,    -1,    -1,
+      -1,    62,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    70,
+      71,    -1,    -1,    -1,    75,    -1,    -1,    78,    -1,    80,
+      81,    82,    83,    -1,    -1,    86,    -1,    88,    89,    -1,
+      91,    92,    93,    94,    95,    96,    97,    98,    99,    -1,
+      -1,    -1,    -1,   104,   105,   106,   107,   108,   109,    -1,
+      -1,   112,   113,   114,   115,   116,    -1,    -1,   119,   120,
+      -1,    -1,   123,   124,    -1,   126,   127,   128,   129,   130,
+     131,   132,   133,   134,   135,   136,    -1,    -1,   139,    -1,
+      -1,    -1,   143,   144,   145,   146,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   155,   156,   157,    -1,    -1,   160,
+     161,   162,    -1,    -1,   399,    -1,   401,   402,   403,   404,
+     405,   406,   407,   408,   409,   410,    -1,    -1,    -1,    -1,
+      -1,   416,   183,   184,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   195,    -1,   197,   399,   199,   401,
+     402,   403,   404,   405,   406,   407,   408,   409,   410,    -1,
+      -1,    -1,    -1,    -1,   416,    -1,    -1,    -1,   219,    -1,
+      -1,    -1,    -1,   224,    -1,    -1,    -1,    -1,    -1,    -1,
+     231,    -1,   233,    -1,    -1,    -1,    -1,    -1,   239,    -1,
+      -1,    -1,     1,    -1,     3,    -1,   247,    -1,     7,     8,
+      -1,    -1,    -1,    -1,   255,    -1,    -1,   258,   259,    -1,
+      -1,   262,   263,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     271,    -1,    -1,    -1,   275,    34,    -1,    -1,    -1,    -1,
+     281,   282,    -1,    -1,    -1,    -1,    45,    46,    47,    -1,
+      49,    50,    51,    52,    -1,    -1,    55,    -1,    -1,    58,
+      -1,    -1,    -1,    62,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    70,    71,    -1,   315,    -1,    75,    -1,    -1,    78,
+      -1,    80,    81,    82,    83,    -1,    -1,    86,    -1,    88,
+      89,    -1,    91,    92,    93,    94,    95,    96,    97,    98,
+      99,    -1,    -1,    -1,    -1,   104,   105,   106,   107,   108,
+     109,    -1,    -1,   112,   113,   114,   115,   116,    -1,    -1,
+     119,   120,    -1,    -1,   123,   124,    -1,   126,   127,   128,
+     129,   130,   131,   132,   133,   134,   135,   136,    -1,    -1,
+     139,    -1,    -1,   384,   143,   144,   145,   146,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   155,   156,   157,   400,
+      -1,   160,   161,   162,    -1,    -1,    -1,    18,    19,    -1,
+      21,    22,    23,    24,    -1,    26,    27,    28,    -1,    -1,
+      -1,    -1,    33,    -1,   183,   184,    37,    38,    39,    40,
+      41,    -1,    -1,    -1,    -1,    -1,   195,    -1,   197,    -1,
+     199,    -1,    -1,    -1,    -1,    -1,    -1,    18,    19,    -1,
+      21,    22,    23,    24,    -1,    26,    27,    28,    -1,    -1,
+     219,    -1,    33,    -1,    -1,   224,    37,    38,    39,    40,
+      41,    -1,   231,    -1,   233,    -1,    -1,    -1,    -1,    -1,
+     239,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   247,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   255,    -1,    -1,   258,
+     259,    -1,    -1,   262,   263,    18,    19,    -1,    21,    22,
+      23,    24,   271,    26,    27,    28,   275,    -1,    -1,    -1,
+      33,    -1,   281,   282,    37,    38,    39,    40,    41,    18,
+      19,    -1,    21,    22,    23,    24,    -1,    26,    27,    28,
+      -1,    -1,    -1,    -1,    33,    -1,    -1,    -1,    37,    38,
+      39,    40,    41,    -1,    18,    19,   315,    21,    22,    23,
+      24,    -1,    26,    27,    28,    -1,    -1,    -1,    -1,    33,
+      -1,    -1,    -1,    37,    38,    39,    40,    41,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    18,    19,    -1,    21,
+      22,    23,    24,    -1,    26,    27,    28,    -1,    -1,    -1,
+      -1,    33,    -1,    -1,    -1,    37,    38,    39,    40,    41,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   232,    -1,    -1,    -1,   384,    -1,    18,    19,    -1,
+      21,    22,    23,    24,    -1,    26,    27,    28,    -1,    -1,
+      -1,   400,    33,    -1,    -1,    -1,    37,    38,    39,    40,
+      41,    -1,    -1,    -1,    18,    19,    -1,    21,    22,    23,
+      24,   232,    26,    27,    28,    -1,    -1,    -1,    -1,    33,
+      -1,    -1,    -1,    37,    38,    39,    40,    41,    -1,    -1,
+      -1,    -1,    -1,    -1,    18,    19,    -1,    21,    22,    23,
+      24,    -1,    26,    27,    28,    -1,    -1,    -1,    -1,    33,
+      -1,    -1,    -1,    37,    38,    39,    40,    41,    18,    19,
+      -1,    21,    22,    23,    24,    -1,    26,    27,    28,   232,
+      -1,    -1,    -1,    33,    -1,    -1,    -1,    37,    38,    39,
+      40,    41,    -1,    -1,    -1,    -1,    18,    19,    -1,    21,
+      22,    23,    24,   232,    26,    27,    28,    -1,    -1,    -1,
+      -1,    33,    -1,    -1,    -1,    37,    38,    39,    40,    41,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   232,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   399,    -1,
+     401,   402,   403,   404,   405,   406,   407,   408,   409,   410,
+     232,    -1,    -1,    -1,    -1,   416,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   399,    -1,
+     401,   402,   403,   404,   405,   406,   407,   408,   409,   410,
+      -1,   232,    -1,    18,    19,   416,    21,    22,    23,    24,
+      -1,    26,    27,    28,    -1,    -1,    -1,    -1,    33,    -1,
+      -1,    -1,    37,    38,    39,    40,    41,    -1,   232,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   399,    -1,   401,   402,
+     403,   404,   405,   406,   407,   408,   409,   410,   232,    -1,
+      -1,    -1,    -1,   416,    -1,    -1,    -1,    -1,    -1,    -1,
+     399,    -1,   401,   402,   403,   404,   405,   406,   407,   408,
+     409,   410,   232,    -1,    -1,    -1,    -1,   416,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   399,    -1,   401,   402,   403,
+     404,   405,   406,   407,   408,   409,   410,    -1,    -1,    -1,
+     232,    -1,   416,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   399,    -1,   401,
+     402,   403,   404,   405,   406,   407,   408,   409,   410,    -1,
+      -1,    -1,    18,    19,   416,    21,    22,    23,    24,    -1,
+      26,    27,    28,    -1,    -1,    -1,    -1,    33,    -1,    -1,
+      -1,    37,    38,    39,    40,    41,    -1,    -1,   399,    -1,
+     401,   402,   403,   404,   405,   406,   407,   408,   409,   410,
+      -1,    -1,    -1,    -1,    -1,   416,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   399,    -1,   401,   402,   403,
+     404,   405,   406,   407,   408,   409,   410,    -1,    -1,    -1,
+      -1,    -1,   416,    -1,    -1,    -1,    -1,   232,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   399,    -1,   401,   402,   403,
+     404,   405,   406,   407,   408,   409,   410,    -1,    -1,    -1,
+      -1,    -1,   416,    -1,    -1,    -1,    -1,    -1,    -1,   399,
+      -1,   401,   402,   403,   404,   405,   406,   407,   408,   409,
+     410,    -1,    -1,    -1,    -1,    -1,   416,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   399,    -1,   401,
+     402,   403,   404,   405,   406,   407,   408,   409,   410,    -1,
+      -1,    -1,    18,    19,   416,    21,    22,    23,    24,    -1,
+      26,    27,    28,    -1,    -1,    -1,    -1,    33,    -1,    -1,
+      -1,    37,    38,    39,    40,    41,    -1,    -1,    -1,    -1,
+      -1,    18,    19,    -1,    21,    22,    23,    24,    -1,    26,
+      27,    28,    -1,    -1,    -1,    -1,    33,    -1,    -1,    -1,
+      37,    38,    39,    40,    41,    18,    19,    -1,    21,    22,
+      23,    24,    -1,    26,    27,    28,   232,    -1,    -1,    -1,
+      33,    -1,    -1,    -1,    37,    38,    39,    40,    41,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   399,    -1,   401,   402,   403,   404,
+     405,   406,   407,   408,   409,   410,    -1,    -1,    -1,    18,
+      19,   416,    21,    22,    23,    24,    -1,    26,    27,    28,
+      -1,    -1,    -1,    -1,    33,    -1,    -1,    -1,    37,    38,
+      39,    40,    41,    18,    19,    -1,    21,    22,    23,    24,
+      -1,    26,    27,    28,    -1,    -1,    -1,    -1,    33,    -1,
+      -1,    -1,    37,    38,    39,    40,    41,    18,    19,    -1,
+      21,    22,    23,    24,    -1,    26,    27,    28,    -1,    -1,
+      -1,    -1,    33,    -1,    -1,    -1,    37,    38,    39,    40,
+      41,    18,    19,    -1,    21,    22,    23,    24,    -1,    26,
+      27,    28,    -1,    -1,    -1,    -1,    33,    -1,    -1,    -1,
+      37,    38,    39,    40,    41,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   232,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   399,    -1,   401,   402,   403,   404,   405,
+     406,   407,   408,   409,   410,   232,    -1,    -1,    -1,    -1,
+     416,    18,    19,    -1,    21,    22,    23,    24,    -1,    26,
+      27,    28,    -1,    -1,    -1,    -1,    33,    -1,    -1,   232,
+      37,    38,    39,    40,    41,    18,    19,    -1,    21,    22,
+      23,    24,    -1,    26,    27,    28,    -1,    -1,    -1,    -1,
+      33,    -1,    -1,    -1,    37,    38,    39,    40,    41,    18,
+      19,    -1,    21,    22,    23,    24,    -1,    26,    27,    28,
+      -1,    -1,    -1,    -1,    33,    -1,    -1,    -1,    37,    38,
+      39,    40,    41,   232,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    18,    19,    -1,    21,
+      22,    23,    24,    -1,    26,    27,    28,   232,    -1,    -1,
+      -1,    33,    -1,    -1,    -1,    37,    38,    39,    40,    41,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   232,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   399,    -1,   401,   402,   403,   404,   405,
+     406,   407,   408,   409,   410,   232,    -1,    -1,    -1,    -1,
+     416,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   399,    -1,   401,   402,   403,   404,   405,   406,
+     407,   408,   409,   410,    -1,    -1,    -1,    -1,    -1,   416,
+      -1,    -1,    -1,    -1,    -1,    -1,   399,    -1,   401,   402,
+     403,   404,   405,   406,   407,   408,   409,   410,    -1,    -1,
+      -1,    -1,    -1,   416,    18,    19,    -1,    21,    22,    23,
+      24,    -1,    26,    27,    28,   232,    -1,    -1,    -1,    33,
+      -1,    -1,    -1,    37,    38,    39,    40,    41,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   232,
+     399,    -1,   401,   402,   403,   404,   405,   406,   407,   408,
+     409,   410,    -1,    -1,    -1,    -1,    -1,   416,    -1,    -1,
+      -1,    -1,    -1,   232,   399,    -1,   401,   402,   403,   404,
+     405,   406,   407,   408,   409,   410,    -1,    -1,    -1,    -1,
+      -1,   416,    -1,    -1,    -1,    -1,    -1,    -1,   399,    -1,
+     401,   402,   403,   404,   405,   406,   407,   408,   409,   410,
+     232,    -1,    -1,    -1,    -1,   416,    -1,    -1,    -1,    -1,
+      -1,    -1,   399,    -1,   401,   402,   403,   404,   405,   406,
+     407,   408,   409,   410,    -1,    -1,    -1,    18,    19,   416,
+      21,    22,    23,    24,    -1,    26,    27,    28,    -1,    -1,
+      -1,    -1,    33,    -1,    -1,    -1,    37,    38,    39,    40,
+      41,    18,    19,    -1,    21,    22,    23,    24,    -1,    26,
+      27,    28,    -1,    -1,    -1,    -1,    33,    -1,    -1,    -1,
+      37,    38,    39,    40,    41,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   399,    -1,   401,   402,   403,   404,   405,   406,
+     407,   408,   409,   410,    -1,    -1,    -1,    -1,    -1,   416,
+      -1,    -1,    -1,    -1,    -1,    -1,   399,    -1,   401,   402,
+     403,   404,   405,   406,   407,   408,   409,   410,   232,    -1,
+      -1,    -1,    -1,   416,    -1,    -1,    -1,    -1,    -1,    -1,
+     399,    -1,   401,   402,   403,   404,   405,   406,   407,   408,
+     409,   410,    -1,    -1,    -1,    -1,    -1,   416,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   399,    -1,   401,
+     402,   403,   404,   405,   406,   407,   408,   409,   410,    -1,
+      -1,    -1,    18,    19,   416,    21,    22,    23,    24,    -1,
+      26,    27,    28,    -1,    -1,    -1,    -1,    33,    -1,    -1,
+      -1,    37,    38,    39,    40,    41,    18,    19,    -1,    21,
+      22,    23,    24,    -1,    26,    27,    28,    -1,    -1,    -1,
+      -1,    33,    -1,    -1,    -1,    37,    38,    39,    40,    41,
+      18,    19,    -1,    21,    22,    23,    24,    -1,    26,    27,
+      28,   232,    -1,    -1,    -1,    33,    -1,    -1,    -1,    37,
+      38,    39,    40,    41,    18,    19,    -1,    21,    22,    23,
+      24,    -1,    26,    27,    28,   232,    -1,    -1,    -1,    33,
+      -1,    -1,    -1,    37,    38,    39,    40,    41,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   399,    -1,   401,   402,   403,
+     404,   405,   406,   407,   408,   409,   410,    -1,    -1,    -1,
+      18,    19,   416,    21,    22,    23,    24,    -1,    26,    27,
+      28,    -1,    -1,    -1,    -1,    33,    -1,    -1,    -1,    37,
+      38,    39,    40,    41,    18,    19,    -1,    21,    22,    23,
+      24,    -1,    26,    27,    28,    -1,    -1,    -1,    -1,    33,
+      -1,    -1,    -1,    37,    38,    39,    40,    41,    18,    19,
+      -1,    21,    22,    23,    24,    -1,    26,    27,    28,    -1,
+      -1,    -1,    -1,    33,    -1,    -1,    -1,    37,    38,    39,
+      40,    41,    18,    19,    -1,    21,    22,    23,    24,    -1,
+      26,    27,    28,    -1,    -1,    -1,    -1,    33,    -1,    -1,
+      -1,    37,    38,    39,    40,    41,   232,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   399,    -1,
+     401,   402,   403,   404,   405,   406,   407,   408,   409,   410,
+     232,    -1,    -1,    -1,    -1,   416,    -1,    -1,    -1,    -1,
+      -1,    -1,   399,    -1,   401,   402,   403,   404,   405,   406,
+     407,   408,   409,   410,   232,    -1,    -1,    -1,    -1,   416,
+      18,    19,    -1,    21,    22,    23,    24,    -1,    26,    27,
+      28,    -1,    -1,    -1,    -1,    33,    -1,    -1,   232,    37,
+      38,    39,    40,    41,    -1,    -1,    -1,    -1,    -1,    18,
+      19,    -1,    21,    22,    23,    24,    -1,    26,    27,    28,
+      -1,    -1,    -1,    -1,    33,    -1,    -1,    -1,    37,    38,
+      39,    40,    41,    18,    19,    -1,    21,    22,    23,    24,
+      -1,    26,    27,    28,   232,    -1,    -1,    -1,    33,    -1,
+      -1,    -1,    37,    38,    39,    40,    41,    18,    19,    -1,
+      21,    22,    23,    24,    -1,    26,    27,    28,   232,    -1,
+      -1,    -1,    33,    -1,    -1,    -1,    37,    38,    39,    40,
+      41,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   232,   399,    -1,   401,   402,   403,   404,   405,
+     406,   407,   408,   409,   410,    -1,    -1,    -1,    -1,    -1,
+     416,    -1,    -1,    -1,    -1,    -1,   232,   399,    -1,   401,
+     402,   403,   404,   405,   406,   407,   408,   409,   410,    -1,
+      -1,    -1,    -1,    -1,   416,    -1,    -1,    -1,    -1,    -1,
+      -1,   399,    -1,   401,   402,   403,   404,   405,   406,   407,
+     408,   409,   410,    -1,    -1,    -1,    -1,    -1,   416,    -1,
+      -1,    -1,    -1,    -1,    -1,   399,    -1,   401,   402,   403,
+     404,   405,   406,   407,   408,   409,   410,    -1,    -1,    -1,
+      -1,    -1,   416,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   232,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   399,    -1,   401,   402,   403,   404,   405,   406,   407,
+     408,   409,   410,   232,    -1,    -1,    -1,    -1,   416,    -1,
+      -1,    -1,    -1,    -1,    -1,   399,    -1,   401,   402,   403,
+     404,   405,   406,   407,   408,   409,   410,   232,    -1,    -1,
+      -1,    -1,   416,    -1,    -1,    -1,    -1,    -1,    -1,   399,
+      -1,   401,   402,   403,   404,   405,   406,   407,   408,   409,
+     410,   232,    -1,    -1,    -1,    -1,   416,    -1,    -1,    -1,
+      -1,    -1,    -1,   399,    -1,   401,   402,   403,   404,   405,
+     406,   407,   408,   409,   410,    -1,    -1,    -1,    18,    19,
+     416,    21,    22,    23,    24,    -1,    26,    27,    28,    -1,
+      -1,    -1,    -1,    33,    -1,    -1,    -1,    37,    38,    39,
+      40,    41,    18,    19,    -1,    21,    22,    23,    24,    -1,
+      26,    27,    28,    -1,    -1,    -1,    -1,    33,    -1,    -1,
+      -1,    37,    38,    39,    40,    41,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   399,    -1,   401,   402,   403,   404,   405,   406,   407,
+     408,   409,   410,    -1,    -1,    -1,    -1,    -1,   416,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     399,    -1,   401,   402,   403,   404,   405,   406,   407,   408,
+     409,   410,    -1,    -1,    -1,    -1,    -1,   416,    -1,    -1,
+      -1,    -1,    -1,    -1,   399,    -1,   401,   402,   403,   404,
+     405,   406,   407,   408,   409,   410,    -1,    -1,    -1,    -1,
+      -1,   416,    -1,    -1,    -1,    -1,    -1,    -1,   399,    -1,
+     401,   402,   403,   404,   405,   406,   407,   408,   409,   410,
+      -1,    -1,    -1,    18,    19,   416,    21,    22,    23,    24,
+      -1,    26,    27,    28,    -1,    -1,    -1,    -1,    33,    -1,
+      -1,    -1,    37,    38,    39,    40,    41,    18,    19,    -1,
+      21,    22,    23,    24,    -1,    26,    27,    28,    -1,    -1,
+      -1,    -1,    33,    -1,    -1,    -1,    37,    38,    39,    40,
+      41,    18,    19,    -1,    21,    22,    23,    24,    -1,    26,
+      27,    28,   232,    -1,    -1,    -1,    33,    -1,    -1,    -1,
+      37,    38,    39,    40,    41,    18,    19,    -1,    21,    22,
+      23,    24,    -1,    26,    27,    28,   232,    -1,    -1,    -1,
+      33,    -1,    -1,    -1,    37,    38,    39,    40,    41,    18,
+      19,    -1,    21,    22,    23,    24,    -1,    26,    27,    28,
+      -1,    -1,    -1,    -1,    33,    -1,    -1,    -1,    37,    38,
+      39,    40,    41,    42,    18,    19,    -1,    21,    22,    23,
+      24,    -1,    26,    27,    28,    -1,    -1,    -1,    -1,    33,
+      -1,    -1,    -1,    37,    38,    39,    40,    41,    18,    19,
+      -1,    21,    22,    23,    24,    -1,    26,    27,    28,    -1,
+      -1,    -1,    -1,    33,    -1,    -1,    -1,    37,    38,    39,
+      40,    41,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    18,    19,    -1,    21,    22,    23,    24,    -1,
+      26,    27,    28,    -1,    -1,    -1,    -1,    33,    -1,    -1,
+      -1,    37,    38,    39,    40,    41,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   232,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   399,
+      -1,   401,   402,   403,   404,   405,   406,   407,   408,   409,
+     410,   232,    -1,    -1,    -1,    -1,   416,    -1,    -1,    -1,
+      -1,    -1,    -1,   399,    -1,   401,   402,   403,   404,   405,
+     406,   407,   408,   409,   410,   232,    -1,    -1,    -1,    -1,
+     416,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    18,    19,
+      -1,    21,    22,    23,    24,    -1,    26,    27,    28,   232,
+     209,    -1,    -1,    33,    -1,    -1,    -1,    37,    38,    39,
+      40,    41,    -1,    -1,    -1,    -1,    18,    19,    -1,    21,
+      22,    23,    24,   232,    26,    27,    28,    -1,    -1,    -1,
+      -1,    33,    -1,    -1,    -1,    37,    38,    39,    40,    41,
+      -1,    -1,    -1,    -1,    -1,    -1,    18,    19,   232,    21,
+      22,    23,    24,    -1,    26,    27,    28,    -1,    -1,    -1,
+      -1,    33,    -1,    -1,    -1,    37,    38,    39,    40,    41,
+      -1,    -1,   232,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   399,    -1,   401,   402,   403,   404,
+     405,   406,   407,   408,   409,   410,   232,    -1,    -1,    -1,
+      -1,   416,    -1,    -1,    -1,    -1,    -1,    -1,   399,    -1,
+     401,   402,   403,   404,   405,   406,   407,   408,   409,   410,
+      -1,    -1,    -1,    -1,    -1,   416,    -1,    -1,    -1,    -1,
+      -1,    -1,   399,    -1,   401,   402,   403,   404,   405,   406,
+     407,   408,   409,   410,    -1,    -1,    -1,    -1,    -1,   416,
+      -1,    -1,    -1,    -1,    -1,    -1,   399,    -1,   401,   402,
+     403,   404,   405,   406,   407,   408,   409,   410,    -1,    -1,
+      -1,    -1,    -1,   416,    -1,    -1,    -1,    -1,    -1,    -1,
+     399,    -1,   401,   402,   403,   404,   405,   406,   407,   408,
+     409,   410,   232,    -1,    -1,    -1,   415,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   399,    -1,   401,   402,   403,
+     404,   405,   406,   407,   408,   409,   410,    -1,    -1,    -1,
+     232,   415,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   399,
+      -1,   401,   402,   403,   404,   405,   406,   407,   408,   409,
+     410,    -1,    -1,    -1,    -1,   415,    -1,    -1,    -1,    -1,
+     232,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   399,    -1,   401,   402,   403,   404,   405,
+     406,   407,   408,   409,   410,    -1,    -1,    18,    19,   415,
+      21,    22,    23,    24,    -1,    26,    27,    28,    -1,    -1,
+      -1,    -1,    33,    -1,    -1,    -1,    37,    38,    39,    40,
+      41,    18,    19,    -1,    21,    22,    23,    24,    -1,    26,
+      27,    28,    -1,    -1,    -1,    -1,    33,    -1,    -1,    -1,
+      37,    38,    39,    40,    41,    18,    19,    -1,    21,    22,
+      23,    24,    -1,    26,    27,    28,    -1,    -1,    -1,    -1,
+      33,    -1,    -1,    -1,    37,    38,    39,    40,    41,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   399,
+      -1,   401,   402,   403,   404,   405,   406,   407,   408,   409,
+     410,    -1,    -1,    -1,    -1,   415,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   399,    -1,   401,
+     402,   403,   404,   405,   406,   407,   408,   409,   410,    -1,
+      -1,    -1,    -1,   415,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   399,    -1,   401,
+     402,   403,   404,   405,   406,   407,   408,   409,   410,    -1,
+      -1,    18,    19,   415,    21,    22,    23,    24,    -1,    26,
+      27,    28,    -1,    -1,    -1,    -1,    33,    -1,    -1,    -1,
+      37,    38,    39,    40,    41,    -1,    18,    19,    -1,    21,
+      22,    23,    24,    -1,    26,    27,    28,    -1,    -1,    -1,
+      -1,    33,    -1,    -1,    -1,    37,    38,    39,    40,    41,
+      18,    19,    -1,    21,    22,    23,    24,    -1,    26,    27,
+      28,   232,    -1,    -1,    -1,    33,    -1,    -1,    -1,    37,
+      38,    39,    40,    41,    18,    19,    -1,    21,    22,    23,
+      24,    -1,    26,    27,    28,   232,    -1,    -1,    -1,    33,
+      -1,    -1,    -1,    37,    38,    39,    40,    41,    18,    19,
+      -1,    21,    22,    23,    24,    -1,    26,    27,    28,   232,
+      -1,    -1,    -1,    33,    -1,    -1,    -1,    37,    38,    39,
+      40,    41,    18,    19,    -1,    21,    22,    23,    24,    -1,
+      26,    27,    28,    -1,    -1,    -1,    -1,    33,    -1,    -1,
+      -1,    37,    38,    39,    40,    41,    18,    19,    -1,    21,
+      22,    23,    24,    -1,    26,    27,    28,    -1,    -1,    -1,
+      -1,    33,    -1,    -1,    -1,    37,    38,    39,    40,    41,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      18,    19,    -1,    21,    22,    23,    24,    -1,    26,    27,
+      28,    -1,    -1,    -1,    -1,    33,    -1,    -1,    -1,    37,
+      38,    39,    40,    41,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   232,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   399,    -1,
+     401,   402,   403,   404,   405,   406,   407,   408,   409,   410,
+     232,    -1,    -1,    -1,   415,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   399,    -1,   401,   402,   403,   404,   405,   406,
+     407,   408,   409,   410,   232,    -1,    -1,    -1,   415,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   399,    -1,   401,   402,
+     403,   404,   405,   406,   407,   408,   409,   410,   232,    -1,
+      -1,    -1,   415,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    18,    19,    -1,    21,    22,    23,    24,    -1,    26,
+      27,    28,   232,    -1,    -1,    -1,    33,    -1,    -1,    -1,
+      37,    38,    39,    40,    41,    18,    19,    -1,    21,    22,
+      23,    24,    -1,    26,    27,    28,   232,    -1,    -1,    -1,
+      33,    -1,    -1,    -1,    37,    38,    39,    40,    41,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     232,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   399,    -1,   401,   402,   403,   404,   405,   406,
+     407,   408,   409,   410,   232,    -1,    -1,    -1,   415,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   399,    -1,   401,
+     402,   403,   404,   405,   406,   407,   408,   409,   410,    -1,
+      -1,    -1,    -1,   415,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   399,    -1,   401,   402,   403,   404,   405,   406,   407,
+     408,   409,   410,    -1,    -1,    -1,    -1,   415,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   399,    -1,   401,   402,   403,
+     404,   405,   406,   407,   408,   409,   410,    -1,    -1,    -1,
+      -1,   415,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   399,
+      -1,   401,   402,   403,   404,   405,   406,   407,   408,   409,
+     410,    -1,    -1,    -1,    -1,   415,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   399,    -1,   401,   402,   403,   404,   405,
+     406,   407,   408,   409,   410,   232,    -1,    -1,    -1,   415,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   399,    -1,   401,
+     402,   403,   404,   405,   406,   407,   408,   409,   410,   232,
+      -1,    -1,    -1,   415,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   399,    -1,   401,   402,   403,   404,   405,   406,   407,
+     408,   409,   410,    -1,    -1,    18,    19,   415,    21,    22,
+      23,    24,    -1,    26,    27,    28,    -1,    -1,    -1,    -1,
+      33,    -1,    -1,    -1,    37,    38,    39,    40,    41,    18,
+      19,    -1,    21,    22,    23,    24,    -1,    26,    27,    28,
+      -1,    -1,    -1,    -1,    33,    -1,    -1,    -1,    37,    38,
+      39,    40,    41,    18,    19,    -1,    21,    22,    23,    24,
+      -1,    26,    27,    28,    -1,    -1,    -1,    -1,    33,    -1,
+      -1,    -1,    37,    38,    39,    40,    41,    18,    19,    -1,
+      21,    22,    23,    24,    -1,    26,    27,    28,    -1,    -1,
+      -1,    -1,    33,    -1,    -1,    -1,    37,    38,    39,    40,
+      41,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   399,    -1,   401,   402,   403,   404,   405,   406,
+     407,   408,   409,   410,    -1,    -1,    -1,    -1,   415,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   399,    -1,   401,   402,
+     403,   404,   405,   406,   407,   408,   409,   410,    -1,    -1,
+      18,    19,   415,    21,    22,    23,    24,    -1,    26,    27,
+      28,    -1,    -1,    -1,    -1,    33,    -1,    -1,    -1,    37,
+      38,    39,    40,    41,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    18,    19,    -1,    21,    22,    23,
+      24,    -1,    26,    27,    28,    -1,    -1,    -1,    -1,    33,
+      -1,    -1,    -1,    37,    38,    39,    40,    41,    18,    19,
+      -1,    21,    22,    23,    24,    -1,    26,    27,    28,   232,
+      -1,    -1,    -1,    33,    -1,    -1,    -1,    37,    38,    39,
+      40,    41,    18,    19,    -1,    21,    22,    23,    24,    -1,
+      26,    27,    28,   232,    -1,    -1,    -1,    33,    -1,    -1,
+      -1,    37,    38,    39,    40,    41,    18,    19,    -1,    21,
+      22,    23,    24,    -1,    26,    27,    28,   232,    -1,    -1,
+      -1,    33,    -1,    -1,    -1,    37,    38,    39,    40,    41,
+      18,    19,    -1,    21,    22,    23,    24,    -1,    26,    27,
+      28,   232,    -1,    -1,    -1,    33,    -1,    -1,    -1,    37,
+      38,    39,    40,    41,    18,    19,    -1,    21,    22,    23,
+      24,    -1,    26,    27,    28,    -1,    -1,    -1,    -1,    33,
+      -1,    -1,    -1,    37,    38,    39,    40,    41,    -1,    18,
+      19,    -1,    21,    22,    23,    24,    -1,    26,    27,    28,
+      -1,    -1,    -1,    -1,    33,    -1,    -1,    -1,    37,    38,
+      39,    40,    41,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   232,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   399,    -1,   401,   402,
+     403,   404,   405,   406,   407,   408,   409,   410,   232,    -1,
+     341,    -1,   415,    -1,    -1,    -1,   347,    -1,    -1,    -1,
+     399,    -1,   401,   402,   403,   404,   405,   406,   407,   408,
+     409,   410,   232,    -1,    -1,    -1,   415,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   399,    -1,   401,   402,   403,   404,
+     405,   406,   407,   408,   409,   410,   232,    -1,    -1,    -1,
+     415,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   399,    -1,
+     401,   402,   403,   404,   405,   406,   407,   408,   409,   410,
+     232,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    18,    19,    -1,    21,    22,    23,    24,
+      -1,    26,    27,    28,   232,    -1,    -1,    -1,    33,    -1,
+      -1,    -1,    37,    38,    39,    40,    41,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   232,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   399,   400,   401,   402,   403,   404,   405,   406,   407,
+     408,   409,   410,   232,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   399,   400,   401,   402,   403,
+     404,   405,   406,   407,   408,   409,   410,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   399,
+     400,   401,   402,   403,   404,   405,   406,   407,   408,   409,
+     410,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   399,   400,   401,   402,   403,   404,   405,
+     406,   407,   408,   409,   410,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   399,   400,   401,
+     402,   403,   404,   405,   406,   407,   408,   409,   410,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   399,   400,   401,   402,   403,   404,   405,   406,   407,
+     408,   409,   410,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   399,   400,   401,   402,   403,
+     404,   405,   406,   407,   408,   409,   410,   232,     1,    -1,
+       3,    -1,    -1,    -1,     7,     8,    -1,    -1,    -1,    -1,
+     399,   400,   401,   402,   403,   404,   405,   406,   407,   408,
+     409,   410,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    34,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    45,    46,    47,    -1,    49,    50,    51,    52,
+      -1,    -1,    55,    -1,    -1,    58,    -1,    -1,    -1,    62,
+      -1,    -1,    65,    -1,    -1,    -1,    -1,    70,    71,    -1,
+      -1,    -1,    75,    -1,    -1,    78,    -1,    80,    81,    82,
+      83,    -1,    -1,    86,    -1,    88,    89,    -1,    91,    92,
+      93,    94,    95,    96,    97,    98,    99,    -1,    -1,    -1,
+      -1,   104,   105,   106,   107,   108,   109,    -1,    -1,   112,
+     113,   114,   115,   116,    -1,    -1,   119,   120,    -1,    -1,
+     123,   124,    -1,   126,   127,   128,   129,   130,   131,   132,
+     133,   134,   135,   136,    -1,    -1,   139,    -1,    -1,    -1,
+     143,   144,   145,   146,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   155,   156,   157,    -1,   159,   160,   161,   162,
+      -1,    -1,    -1,    -1,   399,    -1,   401,   402,   403,   404,
+     405,   406,   407,   408,   409,   410,    -1,    -1,    -1,    -1,
+     183,   184,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   195,    -1,   197,    -1,   199,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   216,    -1,    -1,   219,    -1,    -1,    -1,
+      -1,   224,    -1,    -1,    -1,    -1,    -1,    -1,   231,    -1,
+     233,    -1,    -1,    -1,    -1,    -1,   239,    -1,    -1,    -1,
+       1,    -1,     3,    -1,   247,    -1,     7,     8,    -1,    -1,
+      -1,    -1,   255,    -1,    -1,   258,   259,    -1,    -1,   262,
+     263,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   271,    -1,
+      -1,    -1,   275,    34,    -1,    -1,    -1,    -1,   281,   282,
+      -1,    -1,    -1,    -1,    45,    46,    47,    -1,    49,    50,
+      51,    52,    -1,    -1,    55,    -1,    -1,    58,    -1,    -1,
+      -1,    -1,    -1,    -1,    65,    -1,    -1,    -1,    -1,    70,
+      71,    -1,   315,    -1,    75,    -1,    -1,    78,    -1,    80,
+      81,    82,    83,    -1,    -1,    86,    -1,    88,    89,    -1,
+      91,    92,    93,    94,    95,    96,    97,    98,    99,    -1,
+      -1,    -1,    -1,   104,   105,   106,   107,   108,   109,    -1,
+      -1,   112,   113,   114,   115,   116,    -1,    -1,   119,   120,
+      -1,    -1,   123,   124,    -1,   126,   127,   128,   129,   130,
+     131,   132,   133,   134,   135,   136,    -1,    -1,   139,    -1,
+      -1,   384,   143,   144,   145,   146,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   155,   156,   157,    -1,    -1,   160,
+     161,   162,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   183,   184,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   195,    -1,   197,    -1,   199,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   216,    -1,    -1,   219,    -1,
+      -1,    -1,    -1,   224,    -1,    -1,    -1,    -1,    -1,    -1,
+     231,    -1,   233,    -1,    -1,    -1,    -1,    -1,   239,    -1,
+      -1,    -1,     1,    -1,     3,    -1,   247,    -1,     7,     8,
+      -1,    -1,    -1,    -1,   255,    -1,    -1,   258,   259,    -1,
+      -1,   262,   263,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     271,    -1,    -1,    -1,   275,    34,    -1,    -1,    -1,    -1,
+     281,   282,    -1,    -1,    -1,    -1,    45,    46,    47,    48,
+      49,    50,    51,    52,    -1,    -1,    55,    -1,    -1,    58,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    70,    71,    -1,   315,    -1,    75,    -1,    -1,    78,
+      -1,    80,    81,    82,    83,    -1,    -1,    86,    -1,    88,
+      89,    -1,    91,    92,    93,    94,    95,    96,    97,    98,
+      99,    -1,    -1,    -1,    -1,   104,   105,   106,   107,   108,
+     109,    -1,    -1,   112,   113,   114,   115,   116,    -1,    -1,
+     119,   120,    -1,    -1,   123,   124,    -1,   126,   127,   128,
+     129,   130,   131,   132,   133,   134,   135,   136,    -1,    -1,
+     139,    -1,    -1,   384,   143,   144,   145,   146,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   155,   156,   157,    -1,
+     159,   160,   161,   162,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   183,   184,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   195,    -1,   197,    -1,
+     199,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     219,    -1,    -1,    -1,    -1,   224,    -1,    -1,    -1,    -1,
+      -1,    -1,   231,    -1,   233,    -1,    -1,    -1,    -1,    -1,
+     239,    -1,    -1,    -1,     1,    -1,     3,    -1,   247,    -1,
+       7,     8,    -1,    -1,    -1,    -1,   255,    -1,    -1,   258,
+     259,    -1,    -1,   262,   263,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   271,    -1,    -1,    -1,   275,    34,    -1,    -1,
+      -1,    -1,   281,   282,    -1,    -1,    -1,    -1,    45,    46,
+      47,    -1,    49,    50,    51,    52,    -1,    -1,    55,    -1,
+      -1,    58,    -1,    -1,    -1,    62,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    70,    71,    -1,   315,    -1,    75,    -1,
+      -1,    78,    -1,    80,    81,    82,    83,    -1,    -1,    86,
+      -1,    88,    89,    -1,    91,    92,    93,    94,    95,    96,
+      97,    98,    99,    -1,    -1,    -1,    -1,   104,   105,   106,
+     107,   108,   109,    -1,    -1,   112,   113,   114,   115,   116,
+      -1,    -1,   119,   120,    -1,    -1,   123,   124,    -1,   126,
+     127,   128,   129,   130,   131,   132,   133,   134,   135,   136,
+      -1,    -1,   139,    -1,    -1,   384,   143,   144,   145,   146,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   155,   156,
+     157,    -1,    -1,   160,   161,   162,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   183,   184,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   195,    -1,
+     197,    -1,   199,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   219,    -1,    -1,    -1,    -1,   224,    -1,    -1,
+      -1,    -1,    -1,    -1,   231,    -1,   233,    -1,    -1,    -1,
+      -1,    -1,   239,    -1,    -1,    -1,     1,    -1,     3,    -1,
+     247,    -1,     7,     8,    -1,    -1,    -1,    -1,   255,    -1,
+      -1,   258,   259,    -1,    -1,   262,   263,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   271,    -1,    -1,    -1,   275,    34,
+      -1,    -1,    -1,    -1,   281,   282,    -1,    -1,    -1,    -1,
+      45,    46,    47,    48,    49,    50,    51,    52,    -1,    -1,
+      55,    -1,    -1,    58,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    70,    71,    -1,   315,    -1,
+      75,    -1,    -1,    78,    -1,    80,    81,    82,    83,    -1,
+      -1,    86,    -1,    88,    89,    -1,    91,    92,    93,    94,
+      95,    96,    97,    98,    99,    -1,    -1,    -1,    -1,   104,
+     105,   106,   107,   108,   109,    -1,    -1,   112,   113,   114,
+     115,   116,    -1,    -1,   119,   120,    -1,    -1,   123,   124,
+      -1,   126,   127,   128,   129,   130,   131,   132,   133,   134,
+     135,   136,    -1,    -1,   139,    -1,    -1,   384,   143,   144,
+     145,   146,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     155,   156,   157,    -1,    -1,   160,   161,   162,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   183,   184,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     195,    -1,   197,    -1,   199,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,     3,   219,    -1,    -1,    -1,    -1,   224,
+      -1,     1,    -1,     3,    -1,    -1,   231,     7,   233,    -1,
+      -1,    -1,    -1,    -1,   239,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   247,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     255,    -1,    -1,   258,   259,    45,    46,   262,   263,    49,
+      50,    51,    -1,    -1,    -1,    55,   271,    -1,    -1,    -1,
+     275,    -1,    -1,    -1,    -1,    -1,   281,   282,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      80,    -1,    -1,    -1,    -1,    75,    86,    -1,    88,    89,
+      -1,    91,    92,    93,    94,    95,    96,    -1,    -1,    99,
+     315,    -1,    -1,    -1,    -1,    -1,   106,    -1,    -1,    -1,
+      -1,    -1,   112,   113,   114,   115,   116,   107,   108,   109,
+     120,    -1,    -1,   123,   124,    -1,    -1,    -1,   128,   129,
+     130,   131,   132,   133,   134,   135,   126,    -1,    -1,   139,
+      -1,    -1,    -1,   143,   144,   145,   146,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,     7,    -1,    -1,   156,   157,    -1,   384,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   183,   184,    -1,    -1,    -1,    -1,    -1,
+      34,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   195,    -1,   197,    -1,    -1,
+      -1,    -1,   202,    -1,    -1,    -1,    -1,    -1,    -1,     7,
+      64,   211,    -1,    -1,   224,    -1,    70,    -1,    -1,   219,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    81,    82,    83,
+      -1,    -1,    -1,   233,    -1,    -1,    -1,   247,   238,   239,
+      -1,    -1,    -1,    97,    98,    -1,    -1,    -1,    -1,   249,
+      -1,   251,   252,   107,   108,   109,    -1,    -1,   258,   259,
+      -1,   261,   262,   263,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    70,   127,    -1,   275,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    81,    82,    83,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    97,
+      98,    -1,   156,   157,    -1,   315,    -1,    -1,   162,   107,
+     108,   109,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   127,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   195,    -1,   197,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   156,   157,
+      -1,    -1,    -1,    -1,   162,   219,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   384,    -1,    -1,    -1,    -1,   233,
+      -1,    -1,    -1,    -1,    -1,   239,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   195,    -1,   197,
+      -1,   255,    -1,    -1,   258,   259,    -1,    -1,   262,   263,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   271,    -1,    -1,
+      -1,   219,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   233,    -1,    -1,    -1,    -1,
+      -1,   239,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   255,    -1,    -1,
+     258,   259,    -1,    -1,   262,   263,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   271
+};
+
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int16 yystos[] =
+{
+       0,    34,   101,   155,   174,   244,   268,   269,   333,   366,
+     449,   473,   474,   499,   534,   537,   538,   565,   569,   573,
+     615,   722,     3,    35,   539,   540,     3,   413,     3,     3,
+       6,     6,     3,     3,     0,   473,    86,    88,   247,   620,
+      34,   422,    35,   421,   413,     3,   415,   415,   415,   415,
+     415,   564,   564,     3,    35,   539,     3,     4,     5,    10,
+      11,    12,    13,    16,    17,    25,    39,    40,    41,   243,
+     264,   266,   307,   311,   312,   317,   318,   319,   320,   321,
+     323,   328,   329,   342,   345,   349,   361,   362,   363,   365,
+     371,   373,   374,   377,   378,   379,   401,   402,   403,   406,
+     407,   413,   418,   426,   427,   450,   484,   485,   486,   497,
+     521,   588,   592,   600,   610,   540,     3,    97,   718,   421,
+     175,   500,   566,   570,   616,    35,    43,   413,    10,    12,
+     428,     3,   418,   484,   521,   600,   610,   610,   414,   588,
+     591,   418,   484,   521,   592,   600,   592,   592,   413,   413,
+     413,   413,   413,   413,   413,   413,   413,   413,   413,   413,
+     413,   413,   413,   413,   413,   413,   413,   413,   413,   413,
+     413,   413,   592,     1,   592,   592,   592,   592,   588,   589,
+      26,    27,   414,   520,   588,   591,   401,   402,   403,   592,
+       1,   592,   417,    18,    19,    21,    22,    23,    24,    26,
+      27,    28,    33,    37,    38,    39,    40,    41,   232,   399,
+     401,   402,   403,   404,   405,   406,   407,   408,   409,   410,
+     413,   417,   419,    16,    17,   109,   719,   416,   421,     5,
+     574,    75,    98,   162,   271,   478,   505,   506,   507,   534,
+     544,   335,   346,   370,   567,   568,   309,   310,   331,   352,
+     382,   571,   572,   424,   625,     3,   416,   591,   413,   591,
+     417,   414,   421,   591,   417,   588,   588,   588,   588,   588,
+     588,   588,   588,   588,   588,   588,   588,   588,   588,   588,
+     588,   588,   588,   588,   588,   588,   588,   588,   588,   400,
+     416,   418,   418,   414,   592,   592,   592,   600,   588,   588,
+     588,   588,   588,   588,   588,   588,   588,   588,   588,   588,
+     588,   588,   588,   418,   588,   588,   588,   588,   588,   588,
+     588,   588,   588,   588,   588,   416,   591,     3,   588,     3,
+     415,     3,   421,     3,   415,   578,   158,   723,    83,   107,
+     108,   127,   167,   197,   233,   239,   258,   419,   514,   536,
+     609,   647,   666,   647,     3,     7,   107,   108,   109,   156,
+     157,   195,   199,   219,   259,   262,   263,   272,   471,   487,
+     496,   545,   549,   609,   505,   215,   327,   334,     3,     3,
+     338,   568,   422,   422,   422,   422,   422,   339,   572,   413,
+     413,   624,   416,   588,   414,   600,   588,   414,   600,   416,
+     416,   416,   416,   416,   416,   421,   416,   416,   416,   416,
+     416,   416,   421,   416,   416,   421,   421,   421,   416,   416,
+     416,   416,   416,   588,   518,   519,   588,   591,   419,   498,
+     535,   588,   400,   416,    31,    32,   400,   420,   422,   720,
+      82,    97,   109,   716,   717,     5,   417,   575,    83,   107,
+     108,   109,   127,   157,   167,   168,   195,   262,   276,   607,
+     609,   644,   670,   666,   420,   423,   588,     3,   648,   650,
+     536,     3,   649,   651,   415,   666,   667,     3,     3,    83,
+     109,   157,   195,   418,   609,     3,   245,   724,     3,     3,
+     607,   167,   168,   608,   501,   415,   415,   415,   415,   588,
+       3,     3,     3,     5,    98,   626,     1,     3,   417,   418,
+     537,   603,   604,   605,   660,   661,   664,    34,   623,   416,
+     588,   588,   588,   588,   588,   400,   414,   421,   414,   588,
+     414,   421,   588,   588,   588,   588,   588,   421,     3,   601,
+       3,     3,    97,    80,   711,   712,   716,   416,     3,    57,
+     173,   176,   179,   576,   607,   667,   167,   168,   607,     3,
+     420,   400,   420,   422,   415,   421,   422,   415,   421,   415,
+     415,   608,   607,   607,   607,     3,   546,   548,   608,   415,
+     418,   415,   415,   667,   400,   622,   415,   415,   415,   415,
+     415,   647,   416,   421,   416,   419,     3,   664,   665,    81,
+      82,    97,   416,   421,   415,   416,   421,     3,   415,   416,
+     416,   416,   416,   416,   588,   414,   518,     1,   414,   400,
+     535,   420,   420,   420,    82,   721,   415,   421,   415,   415,
+       3,     3,   125,   704,   180,   578,   600,   667,   667,     1,
+     415,   481,   588,   588,   650,   588,   651,   418,   666,   666,
+     666,   419,   422,   414,   421,   418,     1,   537,   550,   551,
+       3,   650,    98,   650,     1,   588,   413,   414,   421,   123,
+     124,   131,   132,   133,   134,   135,   139,   143,   144,   183,
+     184,   384,   606,   645,   384,   606,   384,   606,   661,     3,
+     605,    83,   617,   414,   588,     3,   416,   421,     3,   415,
+     422,   705,    66,   579,   180,   182,   180,   182,    64,   479,
+     413,   420,   341,   347,   652,   653,   654,   656,   546,   418,
+     418,   418,    11,   407,   497,   547,   588,   548,   546,   414,
+     157,   195,   609,   414,   551,   647,   420,   400,   420,   418,
+     664,   664,     3,   167,   168,   219,   263,   471,   472,   515,
+     666,     3,   472,     3,   472,     3,   268,   269,   613,   614,
+     420,   415,    82,   497,   399,   406,   408,   410,   429,   430,
+     431,   432,   433,   434,   435,   436,   437,   438,   439,   440,
+     441,   442,   443,   444,   445,   446,   447,   706,   707,   708,
+     709,   710,   713,   714,     3,   415,   579,   578,   579,   578,
+     483,    70,    81,    82,    83,    97,    98,   109,   127,   162,
+     255,   471,   508,   530,   541,   544,   594,   595,     1,   508,
+     509,   531,   533,   703,   588,   654,   413,   419,   414,   546,
+     546,   546,   497,   400,   420,   414,   667,   667,     3,   491,
+     492,   650,   588,   665,   416,     3,   667,     3,     3,   422,
+       6,     6,   618,   614,   704,     3,   415,    68,   707,   713,
+     710,   713,   400,   714,   415,   400,   577,   415,   577,   622,
+     601,     1,   608,     1,   647,   471,     1,     3,   671,   672,
+       1,   647,   672,    83,   109,   127,   514,   725,   516,   517,
+     537,   595,   697,   698,   421,    83,   127,   472,   415,   421,
+     416,   353,   406,   407,   588,   655,   655,   414,   414,   414,
+     547,   422,   491,   491,   422,   536,   668,   669,   415,   421,
+     420,   414,   422,     5,   415,   415,     1,     8,    47,    52,
+      58,    71,    75,    78,    81,    82,    97,   104,   105,   119,
+     126,   136,   155,   160,   161,   231,   275,   281,   282,   451,
+     478,   502,   508,   522,   537,   615,   627,   633,   638,   639,
+     727,    66,   400,   400,   407,   429,   430,   431,   714,   715,
+     174,   415,   415,   415,   415,   672,   415,   648,   672,   415,
+     422,   668,   415,   421,   415,   649,   415,   601,   601,   601,
+     607,     1,     4,    42,    47,    48,    52,    53,    54,    56,
+      59,    71,    72,    73,    74,    78,   110,   111,   138,   142,
+     196,   226,   256,   415,   424,   425,   484,   485,   489,   490,
+     558,   584,   600,   610,   693,   696,    64,   517,   531,     3,
+       3,     3,   531,   415,   353,   353,   400,   400,   420,   588,
+     415,   415,   242,   588,   536,   492,   416,   588,   415,   415,
+     601,     1,   413,   580,   581,   413,   556,   557,   600,   666,
+     413,     1,   413,   109,   646,   646,   646,     3,   413,   596,
+     597,   413,   597,     1,    67,    78,    79,   120,   147,   148,
+     149,   150,   151,   152,   153,   154,   163,   164,   165,   166,
+     169,   170,   171,   172,   413,   675,   676,   677,   679,   681,
+     682,   723,   413,   554,   555,   413,    48,   639,   601,     3,
+     503,   504,     6,     6,   384,   607,   645,     3,    45,    46,
+      49,    50,    51,    55,    80,    89,    91,    92,    93,    94,
+      95,    96,    99,   106,   112,   113,   114,   115,   116,   120,
+     128,   129,   130,   145,   146,   224,   315,   384,   598,   599,
+     628,   645,    48,   415,   627,   640,   641,   627,    65,   216,
+     621,   199,   429,   430,   431,   400,   415,   415,   415,   415,
+     588,   671,   415,   415,   415,   415,   667,    18,   415,   422,
+     413,   415,   600,   610,    62,   400,   698,   413,   413,   413,
+     610,   600,   413,   610,   517,    84,   236,   237,   400,   488,
+     698,   413,   610,   413,   413,   413,   415,   413,   415,   588,
+       3,     6,    11,    13,   413,   563,   408,   413,   600,   417,
+     415,   517,   517,   279,   413,   415,    14,    15,    18,   390,
+     391,   392,   393,   394,   395,   396,   397,   398,   422,   415,
+     480,   667,   667,     1,   667,   541,   542,   543,   655,   655,
+     422,   413,    35,   415,   415,   422,    76,    77,   102,   103,
+     121,   122,   123,   124,   140,   141,   582,   583,   424,   559,
+     560,   588,   415,   421,   422,   556,     3,    64,   588,   607,
+     607,   607,   413,   666,   582,   583,   588,   590,   415,   421,
+     582,   583,   415,    67,   413,   677,   681,     3,     9,   666,
+     684,   685,   686,   413,   413,   413,   413,   413,   413,   413,
+     413,     3,   683,   683,   683,   683,   413,   413,   413,   413,
+       1,    90,   100,   678,   683,    67,   675,   415,   422,   415,
+     422,     3,    85,    87,   118,   667,     1,     3,   400,   639,
+     159,   415,    43,   415,   421,   415,   415,   601,   667,   607,
+     424,   657,   693,   693,   686,   693,     3,   587,   699,     3,
+     559,   642,   643,   673,   674,   413,   559,   580,   597,   413,
+     559,   597,   541,   472,   400,   639,    61,   619,     3,     7,
+     455,   715,   601,   588,   588,   590,   415,   422,     3,    62,
+     588,   588,   588,   415,   415,     1,   471,   610,   422,     3,
+     488,     1,   588,   415,   588,   588,     1,   588,     3,   415,
+     562,   588,   517,     1,    90,   100,   408,   585,   586,   588,
+     600,   418,     1,   590,   588,   588,   111,   425,   558,   584,
+     588,   588,   588,   588,   588,   588,   588,   588,   588,   588,
+     111,   242,   462,   476,   558,   584,   588,   622,   422,   532,
+     532,   532,   541,   697,   416,   420,   416,   420,   588,   416,
+     588,   421,   421,   421,   421,   413,   563,   610,   611,   612,
+     416,   556,   588,   422,   416,   667,   667,   667,     1,    36,
+     417,   590,   662,   663,   413,   416,   421,   421,   416,   421,
+     596,   421,   416,   421,   588,   415,   415,   422,   422,   687,
+     421,   415,    60,    90,   100,   592,   689,   689,   689,   689,
+     689,   689,   689,   689,   419,   415,   421,   415,   415,   415,
+     689,   689,   689,   689,   416,   683,   406,   407,   688,   413,
+     563,   413,   563,     1,   413,   415,   416,   416,   416,   560,
+     416,   421,     3,    62,     3,   408,   503,   415,   560,   667,
+       1,    11,    13,   413,     1,   597,   415,   413,    30,   422,
+     668,     3,   674,   415,   421,   415,   421,   597,   559,   597,
+     415,   597,   415,   560,   580,     3,    62,   630,   622,   222,
+     457,   415,   415,   415,   415,   416,   588,   694,   416,   416,
+     416,   416,     3,   422,   588,   695,   416,   416,   416,   416,
+     416,   416,   419,   416,   400,   416,   588,   588,   416,    96,
+     416,   421,   413,    78,   226,   463,   464,   465,   467,   588,
+     416,   416,   413,   413,   588,   588,   415,   413,   413,   419,
+     415,   415,   588,   588,   415,   588,    64,   415,   583,   582,
+      77,   583,    76,   582,   562,   422,   415,   421,   631,   588,
+     601,   601,     3,   602,   416,     3,   416,   416,   421,     1,
+     590,   663,   597,   583,   582,   588,   583,   597,   582,   416,
+     588,   413,   588,   685,   684,   419,   588,   592,   588,   592,
+     389,   421,   421,   421,   421,   421,   421,   421,   421,   592,
+       3,   421,   421,   421,   421,   688,    20,    29,   561,   562,
+       1,   561,    69,   416,   525,   523,   601,   415,     5,   632,
+     159,     1,   601,   601,   417,   590,   658,   659,   415,   415,
+       3,   588,   588,   415,     3,   642,   673,   415,   597,   415,
+     415,   643,   674,   643,   639,   640,     7,   415,   415,   415,
+     543,     1,    57,   552,   553,   591,     1,   553,     1,   553,
+     517,   422,   588,   415,   543,   517,   517,   517,   517,   517,
+     517,     1,     3,   493,   588,   517,   586,   586,   590,   413,
+     413,   463,   414,    42,   209,   415,   415,   415,   588,   415,
+     415,   588,   416,   591,   588,   415,   415,   482,   416,   416,
+     416,   416,   416,   416,   416,   421,   588,   611,    57,   591,
+     634,   635,   415,   415,   415,   422,   415,   421,   413,   662,
+     416,   416,   416,   415,   416,   416,   416,   415,   416,   677,
+     681,   400,   588,    44,   690,   389,   389,   588,   689,   689,
+     562,   689,   689,   689,   689,   562,   420,   419,   689,   689,
+     689,   689,    20,    29,   413,   683,   413,   683,   416,   421,
+     416,   416,   529,   415,   533,   530,   541,   700,   701,   702,
+     415,   421,   639,   415,   415,   415,     3,   416,   416,   421,
+     416,   421,   415,   415,   415,   415,   415,    62,   452,   697,
+      63,   400,   400,   517,     1,    63,   552,   400,    63,    63,
+      63,    63,   588,   415,   697,    61,    61,   420,   420,   421,
+     400,   416,   588,     3,   415,   418,   467,   470,   418,   416,
+     416,   416,   420,   622,   562,   400,   400,    63,   635,   588,
+     588,     3,     1,   416,   588,   597,   597,   597,   597,   415,
+     415,   588,   421,   420,   421,   588,   588,   421,   421,     3,
+     421,   691,   692,   421,   421,   421,   421,   416,   421,   592,
+     421,   421,   421,   421,   413,   413,   683,   416,   683,   416,
+     562,   622,   527,   416,   700,   697,     5,    62,   413,   658,
+       3,     1,   238,   249,   251,   252,   261,   275,   454,   458,
+     459,   460,   461,   466,   469,   494,   495,   510,   511,   512,
+     513,   726,    62,   517,   517,   517,   415,     1,   588,   488,
+     517,   517,   416,   416,     3,   588,   415,   416,   419,   467,
+     468,   588,   414,   584,   584,   413,   416,   421,   637,   636,
+     415,   422,   416,   416,   415,   415,   415,   415,   400,   588,
+     592,    44,   562,   562,   600,   416,   421,   562,   562,   562,
+     562,   415,   588,   420,   562,   562,   562,   562,   683,   683,
+      31,    32,   400,   680,   680,   543,   415,    69,   416,   159,
+     416,   588,   416,   415,   211,   460,    75,   478,   522,     3,
+     471,   261,   461,   510,   202,   588,   415,   415,   517,   517,
+     470,   493,   414,   467,   415,   588,   588,   588,   562,   641,
+     641,     3,   588,   588,   416,   389,   691,   421,   415,   600,
+     691,   691,   421,   691,   691,   421,   421,   691,   691,   680,
+     680,   588,   588,   698,   543,   524,   415,   416,   453,   242,
+       1,     1,   491,     3,   415,   477,   485,   610,   696,     1,
+     477,    61,   420,   415,   415,   416,   416,   422,   588,   416,
+     562,   416,   416,   562,   416,   416,   562,   562,   416,   416,
+     588,   588,   416,   416,    69,   697,   622,   400,   456,     1,
+     413,   415,   415,   415,   415,   418,   477,   416,   422,   416,
+     416,   470,   416,   588,   415,   691,   415,   415,   691,   415,
+     415,   691,   691,   415,   415,   416,   416,   416,   416,   528,
+      69,     3,     7,    64,   703,     1,   465,   416,   517,   588,
+     517,   517,   470,   416,   416,   416,   416,   416,   416,   416,
+     622,   526,   400,   475,   416,   414,   414,   517,   629,   415,
+     415,   415,   415,   622,   242,   415,   640,   593,   594,   537,
+     697,   484,    64,   417,   475,   242,   413,   590,   416,   697,
+      64,   475
+};
+
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int16 yyr1[] =
+{
+       0,   448,   449,   449,   450,   450,   452,   453,   451,   454,
+     454,   455,   455,   456,   456,   456,   457,   457,   458,   458,
+     459,   459,   460,   460,   460,   460,   460,   460,   460,   460,
+     460,   460,   461,   461,   461,   462,   462,   462,   463,   464,
+     464,   465,   465,   466,   466,   467,   467,   467,   467,   467,
+     467,   468,   468,   469,   470,   470,   471,   471,   471,   471,
+     471,   471,   471,   472,   472,   472,   472,   473,   473,   473,
+     473,   473,   473,   473,   473,   474,   474,   475,   475,   476,
+     476,   477,   477,   477,   479,   480,   478,   481,   482,   478,
+     483,   478,   484,   484,   485,   485,   485,   485,   486,   487,
+     487,   487,   487,   488,   488,   488,   489,   489,   489,   490,
+     490,   490,   490,   490,   490,   490,   490,   490,   490,   490,
+     491,   491,   492,   492,   492,   493,   493,   494,   494,   495,
+     495,   496,   496,   496,   497,   497,   497,   497,   497,   498,
+     498,   500,   501,   499,   502,   503,   503,   504,   504,   505,
+     505,   505,   505,   505,   506,   506,   507,   507,   508,   508,
+     508,   508,   509,   509,   510,   510,   511,   511,   512,   512,
+     513,   513,   514,   514,   515,   515,   516,   517,   517,   518,
+     519,   519,   520,   520,   521,   523,   524,   522,   525,   526,
+     522,   527,   528,   522,   529,   522,   530,   530,   530,   530,
+     531,   531,   531,   531,   532,   532,   533,   533,   533,   533,
+     533,   534,   534,   535,   535,   536,   536,   536,   536,   537,
+     537,   538,   538,   538,   538,   539,   539,   540,   540,   541,
+     541,   541,   541,   541,   541,   541,   541,   541,   541,   541,
+     541,   542,   542,   543,   543,   544,   544,   544,   544,   544,
+     544,   545,   545,   545,   545,   545,   545,   546,   546,   547,
+     547,   548,   548,   548,   548,   548,   548,   549,   549,   550,
+     550,   551,   551,   551,   552,   552,   552,   552,   553,   553,
+     554,   554,   554,   555,   555,   556,   557,   557,   557,   558,
+     558,   559,   559,   559,   559,   560,   560,   561,   561,   562,
+     562,   563,   563,   563,   563,   564,   564,   566,   565,   567,
+     567,   568,   568,   568,   568,   570,   569,   571,   571,   572,
+     572,   572,   572,   572,   573,   574,   574,   575,   575,   576,
+     576,   576,   576,   576,   577,   577,   578,   578,   579,   579,
+     580,   580,   580,   580,   580,   580,   581,   581,   582,   582,
+     582,   582,   583,   583,   583,   583,   584,   584,   584,   585,
+     585,   585,   586,   586,   586,   587,   587,   588,   588,   588,
+     588,   588,   588,   588,   588,   588,   588,   588,   588,   588,
+     588,   588,   588,   588,   588,   588,   588,   588,   588,   588,
+     588,   588,   588,   588,   588,   588,   588,   588,   588,   588,
+     588,   588,   588,   588,   588,   588,   588,   588,   588,   588,
+     588,   589,   589,   590,   590,   590,   590,   591,   591,   592,
+     592,   592,   592,   592,   592,   592,   592,   592,   592,   592,
+     592,   592,   592,   592,   592,   592,   592,   592,   592,   592,
+     592,   592,   592,   592,   592,   592,   592,   592,   592,   592,
+     592,   592,   592,   592,   592,   592,   592,   592,   592,   592,
+     592,   592,   592,   592,   593,   593,   594,   594,   595,   595,
+     596,   596,   596,   596,   596,   596,   596,   596,   597,   597,
+     598,   598,   598,   598,   598,   598,   598,   598,   598,   598,
+     598,   598,   599,   599,   599,   599,   599,   599,   599,   599,
+     599,   599,   599,   599,   600,   600,   600,   600,   600,   600,
+     601,   601,   602,   602,   602,   602,   603,   603,   604,   604,
+     604,   604,   604,   605,   605,   605,   605,   605,   605,   605,
+     606,   606,   607,   607,   607,   608,   608,   608,   609,   609,
+     609,   609,   610,   610,   610,   610,   611,   612,   612,   613,
+     613,   613,   614,   614,   616,   617,   618,   619,   615,   620,
+     620,   620,   621,   621,   622,   622,   623,   623,   624,   624,
+     624,   624,   625,   625,   626,   626,   626,   627,   627,   627,
+     627,   627,   627,   627,   627,   627,   627,   627,   627,   627,
+     627,   627,   627,   628,   627,   627,   627,   627,   627,   627,
+     627,   627,   627,   627,   627,   627,   627,   627,   627,   627,
+     627,   627,   627,   627,   627,   627,   627,   627,   627,   627,
+     627,   627,   629,   627,   630,   627,   627,   631,   627,   627,
+     632,   627,   627,   627,   627,   627,   627,   627,   627,   627,
+     627,   627,   627,   627,   627,   633,   634,   634,   636,   635,
+     637,   635,   638,   638,   639,   639,   640,   640,   640,   641,
+     641,   642,   643,   643,   644,   644,   645,   645,   645,   645,
+     645,   645,   645,   645,   645,   645,   645,   645,   646,   647,
+     647,   647,   647,   647,   647,   647,   647,   648,   648,   649,
+     649,   650,   651,   652,   652,   653,   653,   654,   654,   654,
+     654,   654,   655,   655,   655,   655,   656,   656,   657,   657,
+     657,   657,   657,   657,   658,   658,   659,   659,   660,   660,
+     660,   660,   661,   661,   662,   662,   662,   662,   662,   663,
+     663,   664,   664,   664,   664,   665,   665,   666,   666,   667,
+     667,   668,   668,   669,   669,   670,   670,   670,   670,   670,
+     670,   670,   670,   670,   670,   670,   670,   671,   671,   672,
+     672,   673,   674,   674,   675,   675,   675,   675,   675,   675,
+     675,   675,   675,   675,   675,   675,   675,   675,   675,   675,
+     675,   675,   675,   675,   675,   675,   675,   675,   676,   676,
+     677,   677,   678,   678,   679,   679,   679,   679,   680,   680,
+     680,   681,   681,   681,   682,   682,   682,   683,   683,   683,
+     683,   684,   684,   684,   684,   685,   685,   686,   687,   686,
+     688,   688,   688,   689,   689,   689,   689,   689,   689,   689,
+     689,   690,   690,   691,   691,   692,   692,   692,   692,   692,
+     693,   693,   693,   693,   693,   693,   694,   693,   693,   693,
+     695,   693,   693,   693,   693,   693,   693,   693,   693,   693,
+     693,   693,   693,   693,   693,   693,   693,   693,   693,   693,
+     693,   693,   693,   693,   693,   693,   693,   693,   693,   693,
+     693,   693,   693,   693,   693,   693,   693,   693,   693,   693,
+     693,   693,   693,   696,   696,   696,   696,   696,   696,   696,
+     696,   696,   696,   696,   697,   697,   698,   698,   699,   700,
+     700,   701,   701,   702,   702,   703,   703,   705,   704,   706,
+     706,   707,   708,   708,   709,   709,   710,   711,   712,   712,
+     713,   713,   714,   714,   714,   714,   714,   714,   714,   714,
+     714,   714,   714,   714,   714,   714,   714,   714,   714,   714,
+     714,   714,   714,   714,   714,   715,   715,   715,   715,   716,
+     716,   716,   716,   717,   717,   718,   718,   719,   719,   720,
+     720,   721,   721,   722,   722,   723,   723,   724,   724,   725,
+     725,   726,   726,   727,   727
+};
+
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     1,     0,     3,     2,     0,     0,    10,     1,
+       1,     1,     1,     2,     2,     0,     2,     0,     1,     0,
+       2,     1,    11,    18,     4,     2,     2,     1,     4,     4,
+       6,     2,     1,     1,     1,     3,     4,     1,     1,     2,
+       1,     0,     1,     6,     6,     2,     5,     3,     5,     7,
+       8,     2,     1,     4,     1,     3,     3,     1,     1,     1,
+       2,     2,     1,     1,     2,     1,     0,     1,     1,     1,
+       1,     1,     1,     1,     8,     1,     2,     2,     0,     4,
+       7,     3,     1,     1,     0,     0,    11,     0,     0,    14,
+       0,     8,     1,     1,     2,     2,     2,     2,     5,     1,
+       1,     1,     1,     1,     1,     1,     2,     2,     3,    11,
+      12,     2,     5,     5,     8,    11,    11,     5,     5,     8,
+       1,     3,     2,     3,     5,     3,     1,     1,     1,     1,
+       0,     1,     1,     1,     1,     1,     2,     1,     2,     3,
+       1,     0,     0,     8,     3,     3,     3,     3,     1,     1,
+       4,     4,     1,     1,     2,     1,     1,     0,     1,     1,
+       1,     1,     1,     0,     1,     1,     1,     0,     2,     1,
+       1,     1,     1,     1,     1,     1,     2,     1,     2,     1,
+       3,     1,     1,     1,     6,     0,     0,    10,     0,     0,
+      13,     0,     0,    12,     0,     7,     6,     4,     4,     4,
+       5,     5,     5,     4,     2,     0,     3,     1,     3,     2,
+       2,     3,     3,     1,     5,     5,     3,     2,     3,     1,
+       0,     2,     3,     3,     4,     3,     1,     1,     3,     4,
+       3,     3,     4,     3,     4,     4,     1,     3,     3,     3,
+       3,     1,     2,     1,     0,     4,     4,     4,     4,     4,
+       3,     4,     6,     6,     7,     7,     7,     1,     3,     1,
+       2,     1,     4,     6,     3,     6,     8,     5,     5,     2,
+       1,     5,     5,     4,     3,     3,     2,     3,     2,     1,
+       3,     3,     3,     1,     0,     3,     1,     2,     3,     2,
+       4,     2,     4,     6,     8,     1,     0,     1,     3,     1,
+       5,     1,     1,     1,     1,     1,     0,     0,     6,     2,
+       1,     3,     3,     3,     3,     0,     6,     2,     1,     4,
+       4,     4,     4,     4,     8,     0,     2,     0,     2,     4,
+       5,     6,     5,     6,     0,     2,     1,     3,     0,     2,
+       5,     5,     5,     5,     5,     5,     1,     0,     1,     1,
+       1,     1,     1,     1,     1,     1,     2,     4,     4,     1,
+       3,     3,     2,     2,     1,     6,     4,     1,     1,     1,
+       2,     2,     2,     2,     2,     2,     2,     3,     3,     3,
+       2,     2,     2,     2,     2,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       5,     1,     5,     3,     1,     0,     2,     3,     1,     1,
+       1,     1,     1,     1,     3,     4,     4,     3,     3,     1,
+       3,     4,     4,     4,     4,     4,     4,     6,     4,     4,
+       4,     4,     4,     6,     4,     4,     6,     4,     4,     4,
+       4,     4,     4,     6,     6,     3,     3,     6,     7,     2,
+       5,     1,     1,     1,     1,     0,     1,     2,     1,     1,
+       4,     5,     3,     2,     4,     5,     4,     5,     3,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     3,     4,     6,     6,     6,
+       1,     3,     1,     3,     3,     5,     1,     3,     1,     3,
+       3,     2,     2,     5,     4,     5,     4,     5,     4,     7,
+       1,     0,     1,     1,     0,     1,     1,     0,     1,     1,
+       1,     1,     1,     3,     3,     1,     3,     3,     1,     0,
+       1,     2,     3,     3,     0,     0,     0,     0,    15,     1,
+       1,     1,     1,     1,     2,     0,     8,     0,     3,     3,
+       0,     3,     0,     4,     3,     3,     5,     1,     6,     5,
+       4,     6,     6,     4,     6,     6,     6,     6,     4,     6,
+       6,     6,     3,     0,     3,     3,     4,     5,     5,     6,
+       4,     5,     3,     3,     6,     8,     8,     6,     8,     8,
+       5,     5,     5,     3,     3,     3,     3,     1,     1,     1,
+       3,     3,     0,    14,     0,     5,     2,     0,     7,     5,
+       0,     8,     1,     4,     2,     3,     3,     2,     5,     3,
+       3,     9,     5,     3,     3,     4,     2,     1,     0,     4,
+       0,     4,     2,     1,     1,     0,     1,     3,     5,     1,
+       1,     3,     3,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     0,
+       1,     1,     2,     1,     1,     1,     1,     1,     3,     1,
+       3,     4,     3,     1,     0,     2,     1,     6,     6,     6,
+       6,     2,     1,     1,     2,     2,     1,     1,     4,     4,
+       2,     2,     2,     0,     5,     4,     1,     3,     1,     5,
+       3,     7,     1,     0,     5,     5,     4,     2,     1,     3,
+       1,     1,     6,     4,     4,     1,     3,     1,     2,     1,
+       0,     0,     1,     1,     2,     2,     3,     3,     1,     1,
+       1,     1,     1,     1,     1,     2,     2,     2,     3,     1,
+       3,     2,     1,     3,     3,     2,     2,     6,     6,     3,
+       3,    12,    10,    12,     8,    10,    12,    10,    10,    12,
+      10,    10,    10,     7,     3,     3,     3,     3,     1,     2,
+       5,     3,     1,     1,    10,    11,    10,    11,     1,     1,
+       1,     5,     3,     5,     6,     6,     3,     1,     4,     3,
+       6,     3,     7,     3,     7,     1,     3,     1,     0,     3,
+       1,     1,     0,     2,     2,     4,     4,     5,     7,     3,
+       1,     3,     1,     0,     1,     1,     2,     2,     3,     1,
+       5,     3,     5,     3,     2,     3,     0,     7,     2,     3,
+       0,     7,     3,     3,     1,     1,     6,     6,     6,     6,
+       6,     6,     5,     7,     5,     7,     2,     2,     2,     2,
+       3,     5,     4,     4,     4,     4,     5,     5,     5,     9,
+       5,     9,     4,     4,     5,     5,     2,     5,     6,     7,
+       2,     5,     2,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     1,     0,     2,     1,     4,     1,
+       1,     2,     1,     1,     0,     1,     0,     0,     4,     1,
+       1,     4,     1,     2,     1,     2,     6,     5,     1,     0,
+       1,     2,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     3,
+       3,     3,     4,     1,     2,     1,     3,     1,     0,     2,
+       0,     2,     4,    10,    13,     1,     0,     1,     0,     1,
+       0,     1,     0,     1,     0
+};
+
+
+enum { YYENOMEM = -2 };
+
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
+
+
+#define YYRECOVERING()  (!!yyerrstatus)
+
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
+
+/* YYLLOC_DEFAULT -- Set CURRENT to span from RHS[1] to RHS[N].
+   If N is 0, then set CURRENT to the empty location which ends
+   the previous symbol: RHS[0] (always defined).  */
+
+#ifndef YYLLOC_DEFAULT
+# define YYLLOC_DEFAULT(Current, Rhs, N)                                \
+    do                                                                  \
+      if (N)                                                            \
+        {                                                               \
+          (Current).first_line   = YYRHSLOC (Rhs, 1).first_line;        \
+          (Current).first_column = YYRHSLOC (Rhs, 1).first_column;      \
+          (Current).last_line    = YYRHSLOC (Rhs, N).last_line;         \
+          (Current).last_column  = YYRHSLOC (Rhs, N).last_column;       \
+        }                                                               \
+      else                                                              \
+        {                                                               \
+          (Current).first_line   = (Current).last_line   =              \
+            YYRHSLOC (Rhs, 0).last_line;                                \
+          (Current).first_column = (Current).last_column =              \
+            YYRHSLOC (Rhs, 0).last_column;                              \
+        }                                                               \
+    while (0)
+#endif
+
+#define YYRHSLOC(Rhs, K) ((Rhs)[K])
+
+
+/* Enable debugging if requested.  */
+#if YYDEBUG
+
+# ifndef YYFPRINTF
+#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYFPRINTF fprintf
+# endif
+
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+/* YYLOCATION_PRINT -- Print the location on the stream.
+   This macro was not mandated originally: define only if we know
+   we won't break user code: when these are the locations we know.  */
+
+# ifndef YYLOCATION_PRINT
+
+#  if defined YY_LOCATION_PRINT
+
+   /* Temporary convenience wrapper in case some people defined the
+      undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YYLOCATION_PRINT(File, Loc)  YY_LOCATION_PRINT(File, *(Loc))
+
+#  elif defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL
+
+/* Print *YYLOCP on YYO.  Private, do not rely on its existence. */
+
+YY_ATTRIBUTE_UNUSED
+static int
+yy_location_print_ (FILE *yyo, YYLTYPE const * const yylocp)
+{
+  int res = 0;
+  int end_col = 0 != yylocp->last_column ? yylocp->last_column - 1 : 0;
+  if (0 <= yylocp->first_line)
+    {
+      res += YYFPRINTF (yyo, "%d", yylocp->first_line);
+      if (0 <= yylocp->first_column)
+        res += YYFPRINTF (yyo, ".%d", yylocp->first_column);
+    }
+  if (0 <= yylocp->last_line)
+    {
+      if (yylocp->first_line < yylocp->last_line)
+        {
+          res += YYFPRINTF (yyo, "-%d", yylocp->last_line);
+          if (0 <= end_col)
+            res += YYFPRINTF (yyo, ".%d", end_col);
+        }
+      else if (0 <= end_col && yylocp->first_column < end_col)
+        res += YYFPRINTF (yyo, "-%d", end_col);
+    }
+  return res;
+}
+
+#   define YYLOCATION_PRINT  yy_location_print_
+
+    /* Temporary convenience wrapper in case some people defined the
+       undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YY_LOCATION_PRINT(File, Loc)  YYLOCATION_PRINT(File, &(Loc))
+
+#  else
+
+#   define YYLOCATION_PRINT(File, Loc) ((void) 0)
+    /* Temporary convenience wrapper in case some people defined the
+       undocumented and private YY_LOCATION_PRINT macros.  */
+#   define YY_LOCATION_PRINT  YYLOCATION_PRINT
+
+#  endif
+# endif /* !defined YYLOCATION_PRINT */
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value, Location); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
+static void
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp)
+{
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  YY_USE (yylocationp);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
+
+static void
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, YYLTYPE const * const yylocationp)
+{
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
+
+  YYLOCATION_PRINT (yyo, yylocationp);
+  YYFPRINTF (yyo, ": ");
+  yy_symbol_value_print (yyo, yykind, yyvaluep, yylocationp);
+  YYFPRINTF (yyo, ")");
+}
+
+/*------------------------------------------------------------------.
+| yy_stack_print -- Print the state stack from its BOTTOM up to its |
+| TOP (included).                                                   |
+`------------------------------------------------------------------*/
+
+static void
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
+{
+  YYFPRINTF (stderr, "Stack now");
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
+  YYFPRINTF (stderr, "\n");
+}
+
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
+
+
+/*------------------------------------------------.
+| Report that the YYRULE is going to be reduced.  |
+`------------------------------------------------*/
+
+static void
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp, YYLTYPE *yylsp,
+                 int yyrule)
+{
+  int yylno = yyrline[yyrule];
+  int yynrhs = yyr2[yyrule];
+  int yyi;
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
+  /* The symbols being reduced.  */
+  for (yyi = 0; yyi < yynrhs; yyi++)
+    {
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)],
+                       &(yylsp[(yyi + 1) - (yynrhs)]));
+      YYFPRINTF (stderr, "\n");
+    }
+}
+
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, yylsp, Rule); \
+} while (0)
+
+/* Nonzero means print parse trace.  It is left uninitialized so that
+   multiple parsers can coexist.  */
+int yydebug;
+#else /* !YYDEBUG */
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
+# define YY_STACK_PRINT(Bottom, Top)
+# define YY_REDUCE_PRINT(Rule)
+#endif /* !YYDEBUG */
+
+
+/* YYINITDEPTH -- initial size of the parser's stacks.  */
+#ifndef YYINITDEPTH
+# define YYINITDEPTH 200
+#endif
+
+/* YYMAXDEPTH -- maximum size the stacks can grow to (effective only
+   if the built-in stack extension method is used).
+
+   Do not make this value too large; the results are undefined if
+   YYSTACK_ALLOC_MAXIMUM < YYSTACK_BYTES (YYMAXDEPTH)
+   evaluated with infinite-precision integer arithmetic.  */
+
+#ifndef YYMAXDEPTH
+# define YYMAXDEPTH 10000
+#endif
+
+
+
+
+
+
+/*-----------------------------------------------.
+| Release the memory associated to this symbol.  |
+`-----------------------------------------------*/
+
+static void
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep, YYLTYPE *yylocationp)
+{
+  YY_USE (yyvaluep);
+  YY_USE (yylocationp);
+  if (!yymsg)
+    yymsg = "Deleting";
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/* Lookahead token kind.  */
+int yychar;
+
+/* The semantic value of the lookahead symbol.  */
+YYSTYPE yylval;
+/* Location data for the lookahead symbol.  */
+YYLTYPE yylloc
+# if defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL
+  = { 1, 1, 1, 1 }
+# endif
+;
+/* Number of syntax errors so far.  */
+int yynerrs;
+
+
+
+
+/*----------.
+| yyparse.  |
+`----------*/
+
+int
+yyparse (void)
+{
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
+
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
+
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
+
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
+
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
+
+    /* The location stack: array, bottom, top.  */
+    YYLTYPE yylsa[YYINITDEPTH];
+    YYLTYPE *yyls = yylsa;
+    YYLTYPE *yylsp = yyls;
+
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
+  /* The variables used to return semantic value and location from the
+     action routines.  */
+  YYSTYPE yyval;
+  YYLTYPE yyloc;
+
+  /* The locations where the error started and ended.  */
+  YYLTYPE yyerror_range[3];
+
+
+
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N), yylsp -= (N))
+
+  /* The number of symbols on the RHS of the reduced rule.
+     Keep to zero when no symbol should be popped.  */
+  int yylen = 0;
+
+  YYDPRINTF ((stderr, "Starting parse\n"));
+
+  yychar = YYEMPTY; /* Cause a token to be read.  */
+
+  yylsp[0] = yylloc;
+  goto yysetstate;
+
+
+/*------------------------------------------------------------.
+| yynewstate -- push a new state, which is found in yystate.  |
+`------------------------------------------------------------*/
+yynewstate:
+  /* In all cases, when you get here, the value and location stacks
+     have just been pushed.  So pushing a state here evens the stacks.  */
+  yyssp++;
+
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
+
+  if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
+    {
+      /* Get the current used size of the three stacks, in elements.  */
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
+
+# if defined yyoverflow
+      {
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+        YYLTYPE *yyls1 = yyls;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yyls1, yysize * YYSIZEOF (*yylsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
+        yyls = yyls1;
+      }
+# else /* defined YYSTACK_RELOCATE */
+      /* Extend the stack our own way.  */
+      if (YYMAXDEPTH <= yystacksize)
+        YYNOMEM;
+      yystacksize *= 2;
+      if (YYMAXDEPTH < yystacksize)
+        yystacksize = YYMAXDEPTH;
+
+      {
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+        YYSTACK_RELOCATE (yyls_alloc, yyls);
+#  undef YYSTACK_RELOCATE
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
+      }
+# endif
+
+      yyssp = yyss + yysize - 1;
+      yyvsp = yyvs + yysize - 1;
+      yylsp = yyls + yysize - 1;
+
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
+
+      if (yyss + yystacksize - 1 <= yyssp)
+        YYABORT;
+    }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
+
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
+
+  goto yybackup;
+
+
+/*-----------.
+| yybackup.  |
+`-----------*/
+yybackup:
+  /* Do appropriate processing given the current state.  Read a
+     lookahead token if we need one and don't already have one.  */
+
+  /* First try to decide what to do without reference to lookahead token.  */
+  yyn = yypact[yystate];
+  if (yypact_value_is_default (yyn))
+    goto yydefault;
+
+  /* Not known => get a lookahead token if don't already have one.  */
+
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == YYEMPTY)
+    {
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex ();
+    }
+
+  if (yychar <= YYEOF)
+    {
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
+      YYDPRINTF ((stderr, "Now at end of input.\n"));
+    }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      yyerror_range[1] = yylloc;
+      goto yyerrlab1;
+    }
+  else
+    {
+      yytoken = YYTRANSLATE (yychar);
+      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
+    }
+
+  /* If the proper action on seeing token YYTOKEN is to reduce or to
+     detect an error, take that action.  */
+  yyn += yytoken;
+  if (yyn < 0 || YYLAST < yyn || yycheck[yyn] != yytoken)
+    goto yydefault;
+  yyn = yytable[yyn];
+  if (yyn <= 0)
+    {
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
+      yyn = -yyn;
+      goto yyreduce;
+    }
+
+  /* Count tokens shifted since error; after three, turn off error
+     status.  */
+  if (yyerrstatus)
+    yyerrstatus--;
+
+  /* Shift the lookahead token.  */
+  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
+  yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+  *++yylsp = yylloc;
+
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
+  goto yynewstate;
+
+
+/*-----------------------------------------------------------.
+| yydefault -- do the default action for the current state.  |
+`-----------------------------------------------------------*/
+yydefault:
+  yyn = yydefact[yystate];
+  if (yyn == 0)
+    goto yyerrlab;
+  goto yyreduce;
+
+
+/*-----------------------------.
+| yyreduce -- do a reduction.  |
+`-----------------------------*/
+yyreduce:
+  /* yyn is the number of a rule to reduce with.  */
+  yylen = yyr2[yyn];
+
+  /* If YYLEN is nonzero, implement the default value of the action:
+     '$$ = $1'.
+
+     Otherwise, the following line sets YYVAL to garbage.
+     This behavior is undocumented and Bison
+     users should not rely upon it.  Assigning to YYVAL
+     unconditionally makes the parser a bit smaller, and it avoids a
+     GCC warning that YYVAL may be used uninitialized.  */
+  yyval = yyvsp[1-yylen];
+
+  /* Default location. */
+  YYLLOC_DEFAULT (yyloc, (yylsp - yylen), yylen);
+  yyerror_range[1] = yyloc;
+  YY_REDUCE_PRINT (yyn);
+  switch (yyn)
+    {
+  case 4: /* assignment_pattern: K_LP expression_list_proper '}'  */
+#line 638 "parse.y"
+      { PEVoid*tmp = new PEVoid;
+	FILE_NAME(tmp, (yylsp[-2]));
+	yyerror((yylsp[-2]), "sorry: Assignment patterns (array literals) not supported.");
+	(yyval.expr) = tmp;
+      }
+#line 6993 "parse.cc"
+    break;
+
+  case 5: /* assignment_pattern: K_LP '}'  */
+#line 644 "parse.y"
+      { PEVoid*tmp = new PEVoid;
+	FILE_NAME(tmp, (yylsp[-1]));
+	yyerror((yylsp[-1]), "sorry: Assignment patterns (array literals) not supported.");
+	(yyval.expr) = tmp;
+      }
+#line 7003 "parse.cc"
+    break;
+
+  case 6: /* $@1: %empty  */
+#line 653 "parse.y"
+      { pform_start_class_declaration((yylsp[-3]), (yyvsp[-2].class_type));
+	if ((yyvsp[-1].data_type)) {
+	      yyerror((yylsp[-1]), "sorry: Class extends not supported yet.");
+	}
+      }
+#line 7013 "parse.cc"
+    break;
+
+  case 7: /* $@2: %empty  */
+#line 659 "parse.y"
+      { // Process a class.
+	pform_end_class_declaration();
+      }
+#line 7021 "parse.cc"
+    break;
+
+  case 8: /* class_declaration: K_virtual_opt K_class class_identifier class_declaration_extends_opt ';' $@1 class_items_opt K_endclass $@2 class_declaration_endname_opt  */
+#line 663 "parse.y"
+      { // Wrap up the class.
+	if ((yyvsp[0].text) && (yyvsp[-7].class_type) && (yyvsp[-7].class_type)->name != (yyvsp[0].text)) {
+	      yyerror((yylsp[0]), "error: Class end name doesn't match class name.");
+	      delete[](yyvsp[0].text);
+	}
+      }
+#line 7032 "parse.cc"
+    break;
+
+  case 11: /* class_identifier: IDENTIFIER  */
+#line 678 "parse.y"
+      { // Create a synthetic typedef for the class name so that the
+	// lexor detects the name as a type.
+	perm_string name = lex_strings.make((yyvsp[0].text));
+	class_type_t*tmp = new class_type_t(name);
+	pform_set_typedef(name, tmp);
+	delete[](yyvsp[0].text);
+	(yyval.class_type) = tmp;
+      }
+#line 7045 "parse.cc"
+    break;
+
+  case 12: /* class_identifier: TYPE_IDENTIFIER  */
+#line 687 "parse.y"
+      { class_type_t*tmp = dynamic_cast<class_type_t*>((yyvsp[0].data_type));
+	if (tmp == 0) {
+	      yyerror((yylsp[0]), "Type name is not a predeclared class name.");
+	}
+	(yyval.class_type) = tmp;
+      }
+#line 7056 "parse.cc"
+    break;
+
+  case 13: /* class_declaration_endname_opt: ':' TYPE_IDENTIFIER  */
+#line 700 "parse.y"
+      { class_type_t*tmp = dynamic_cast<class_type_t*> ((yyvsp[0].data_type));
+	if (tmp == 0) {
+	      yyerror((yylsp[0]), "error: class declaration endname is not a class name\n");
+	      (yyval.text) = 0;
+	} else {
+	      (yyval.text) = strdupnew(tmp->name.str());
+	}
+      }
+#line 7069 "parse.cc"
+    break;
+
+  case 14: /* class_declaration_endname_opt: ':' IDENTIFIER  */
+#line 709 "parse.y"
+      { (yyval.text) = (yyvsp[0].text); }
+#line 7075 "parse.cc"
+    break;
+
+  case 15: /* class_declaration_endname_opt: %empty  */
+#line 711 "parse.y"
+      { (yyval.text) = 0; }
+#line 7081 "parse.cc"
+    break;
+
+  case 16: /* class_declaration_extends_opt: K_extends TYPE_IDENTIFIER  */
+#line 724 "parse.y"
+      { (yyval.data_type) = (yyvsp[0].data_type); }
+#line 7087 "parse.cc"
+    break;
+
+  case 17: /* class_declaration_extends_opt: %empty  */
+#line 726 "parse.y"
+      { (yyval.data_type) = 0; }
+#line 7093 "parse.cc"
+    break;
+
+  case 22: /* class_item: method_qualifier_opt K_function K_new '(' tf_port_list_opt ')' ';' function_item_list_opt statement_or_null_list_opt K_endfunction endnew_opt  */
+#line 749 "parse.y"
+      { yyerror((yylsp[-8]), "sorry: Class constructors not supported yet.");
+	yyerrok;
+      }
+#line 7101 "parse.cc"
+    break;
+
+  case 23: /* class_item: method_qualifier_opt K_function K_new '(' tf_port_list_opt ')' ';' function_item_list_opt attribute_list_opt implicit_class_handle '.' K_new '(' expression_list_with_nuls ')' statement_or_null_list_opt K_endfunction endnew_opt  */
+#line 762 "parse.y"
+      { yyerror((yylsp[-15]), "sorry: Class constructors not supported yet.");
+	yyerrok;
+      }
+#line 7109 "parse.cc"
+    break;
+
+  case 24: /* class_item: property_qualifier_opt data_type list_of_variable_decl_assignments ';'  */
+#line 769 "parse.y"
+      { pform_class_property((yylsp[-2]), (yyvsp[-3].property_qualifier), (yyvsp[-2].data_type), (yyvsp[-1].decl_assignments)); }
+#line 7115 "parse.cc"
+    break;
+
+  case 25: /* class_item: method_qualifier_opt task_declaration  */
+#line 774 "parse.y"
+      { yyerror((yylsp[0]), "sorry: Class methods (tasks) not supported yet.");
+	yyerrok;
+      }
+#line 7123 "parse.cc"
+    break;
+
+  case 26: /* class_item: method_qualifier_opt function_declaration  */
+#line 779 "parse.y"
+      { yyerror((yylsp[0]), "sorry: Class methods (functions) not supported yet.");
+	yyerrok;
+      }
+#line 7131 "parse.cc"
+    break;
+
+  case 28: /* class_item: property_qualifier_opt data_type error ';'  */
+#line 792 "parse.y"
+      { yyerror((yylsp[-1]), "error: Errors in variable names after data type.");
+	yyerrok;
+      }
+#line 7139 "parse.cc"
+    break;
+
+  case 29: /* class_item: property_qualifier_opt IDENTIFIER error ';'  */
+#line 797 "parse.y"
+      { yyerror((yylsp[-1]), "error: %s doesn't name a type.", (yyvsp[-2].text));
+	yyerrok;
+      }
+#line 7147 "parse.cc"
+    break;
+
+  case 30: /* class_item: method_qualifier_opt K_function K_new error K_endfunction endnew_opt  */
+#line 802 "parse.y"
+      { yyerror((yylsp[-5]), "error: I give up on this class constructor declaration.");
+	yyerrok;
+      }
+#line 7155 "parse.cc"
+    break;
+
+  case 31: /* class_item: error ';'  */
+#line 807 "parse.y"
+      { yyerror((yylsp[0]), "error: invalid class item.");
+	yyerrok;
+      }
+#line 7163 "parse.cc"
+    break;
+
+  case 32: /* class_item_qualifier: K_static  */
+#line 814 "parse.y"
+                 { (yyval.property_qualifier) = property_qualifier_t::set_static(); }
+#line 7169 "parse.cc"
+    break;
+
+  case 33: /* class_item_qualifier: K_protected  */
+#line 815 "parse.y"
+                 { (yyval.property_qualifier) = property_qualifier_t::set_protected(); }
+#line 7175 "parse.cc"
+    break;
+
+  case 34: /* class_item_qualifier: K_local  */
+#line 816 "parse.y"
+                 { (yyval.property_qualifier) = property_qualifier_t::set_local(); }
+#line 7181 "parse.cc"
+    break;
+
+  case 35: /* class_new: K_new '(' ')'  */
+#line 821 "parse.y"
+      { PENewClass*tmp = new PENewClass;
+	FILE_NAME(tmp, (yylsp[-2]));
+	(yyval.expr) = tmp;
+      }
+#line 7190 "parse.cc"
+    break;
+
+  case 36: /* class_new: K_new '(' expression_list_proper ')'  */
+#line 826 "parse.y"
+      { yyerror((yylsp[-3]), "sorry: class_new not implemented yet.");
+	(yyval.expr) = 0;
+      }
+#line 7198 "parse.cc"
+    break;
+
+  case 37: /* class_new: K_new  */
+#line 830 "parse.y"
+      { PENewClass*tmp = new PENewClass;
+	FILE_NAME(tmp, (yylsp[0]));
+	(yyval.expr) = tmp;
+      }
+#line 7207 "parse.cc"
+    break;
+
+  case 43: /* constraint_declaration: K_static_opt K_constraint IDENTIFIER '{' constraint_block_item_list_opt '}'  */
+#line 852 "parse.y"
+      { yyerror((yylsp[-4]), "sorry: Constraint declarations not supported."); }
+#line 7213 "parse.cc"
+    break;
+
+  case 44: /* constraint_declaration: K_static_opt K_constraint IDENTIFIER '{' error '}'  */
+#line 857 "parse.y"
+      { yyerror((yylsp[-2]), "error: Errors in the constraint block item list."); }
+#line 7219 "parse.cc"
+    break;
+
+  case 53: /* constraint_prototype: K_static_opt K_constraint IDENTIFIER ';'  */
+#line 876 "parse.y"
+      { yyerror((yylsp[-2]), "sorry: Constraint prototypes not supported."); }
+#line 7225 "parse.cc"
+    break;
+
+  case 56: /* data_type: integer_vector_type unsigned_signed_opt range_opt  */
+#line 886 "parse.y"
+      { ivl_variable_type_t use_vtype = (yyvsp[-2].vartype);
+	bool reg_flag = false;
+	if (use_vtype == IVL_VT_NO_TYPE) {
+	      use_vtype = IVL_VT_LOGIC;
+	      reg_flag = true;
+	}
+	vector_type_t*tmp = new vector_type_t(use_vtype, (yyvsp[-1].flag), (yyvsp[0].ranges));
+	tmp->reg_flag = reg_flag;
+	FILE_NAME(tmp, (yylsp[-2]));
+	(yyval.data_type) = tmp;
+      }
+#line 7241 "parse.cc"
+    break;
+
+  case 57: /* data_type: non_integer_type  */
+#line 898 "parse.y"
+      { real_type_t*tmp = new real_type_t((yyvsp[0].real_type));
+	FILE_NAME(tmp, (yylsp[0]));
+	(yyval.data_type) = tmp;
+      }
+#line 7250 "parse.cc"
+    break;
+
+  case 58: /* data_type: struct_data_type  */
+#line 903 "parse.y"
+      { (yyval.data_type) = (yyvsp[0].struct_type); }
+#line 7256 "parse.cc"
+    break;
+
+  case 59: /* data_type: enum_data_type  */
+#line 905 "parse.y"
+      { (yyval.data_type) = (yyvsp[0].enum_type); }
+#line 7262 "parse.cc"
+    break;
+
+  case 60: /* data_type: atom2_type signed_unsigned_opt  */
+#line 907 "parse.y"
+      { atom2_type_t*tmp = new atom2_type_t((yyvsp[-1].int_val), (yyvsp[0].flag));
+	FILE_NAME(tmp, (yylsp[-1]));
+	(yyval.data_type) = tmp;
+      }
+#line 7271 "parse.cc"
+    break;
+
+  case 61: /* data_type: TYPE_IDENTIFIER range_opt  */
+#line 912 "parse.y"
+      { if ((yyvsp[0].ranges)) (yyval.data_type) = new parray_type_t((yyvsp[-1].data_type), (yyvsp[0].ranges));
+	else (yyval.data_type) = (yyvsp[-1].data_type);
+      }
+#line 7279 "parse.cc"
+    break;
+
+  case 62: /* data_type: K_string  */
+#line 916 "parse.y"
+      { string_type_t*tmp = new string_type_t;
+	FILE_NAME(tmp, (yylsp[0]));
+	(yyval.data_type) = tmp;
+      }
+#line 7288 "parse.cc"
+    break;
+
+  case 63: /* data_type_or_implicit: data_type  */
+#line 930 "parse.y"
+      { (yyval.data_type) = (yyvsp[0].data_type); }
+#line 7294 "parse.cc"
+    break;
+
+  case 64: /* data_type_or_implicit: signing range_opt  */
+#line 932 "parse.y"
+      { vector_type_t*tmp = new vector_type_t(IVL_VT_LOGIC, (yyvsp[-1].flag), (yyvsp[0].ranges));
+	tmp->implicit_flag = true;
+	FILE_NAME(tmp, (yylsp[-1]));
+	(yyval.data_type) = tmp;
+      }
+#line 7304 "parse.cc"
+    break;
+
+  case 65: /* data_type_or_implicit: range  */
+#line 938 "parse.y"
+      { vector_type_t*tmp = new vector_type_t(IVL_VT_LOGIC, false, (yyvsp[0].ranges));
+	tmp->implicit_flag = true;
+	FILE_NAME(tmp, (yylsp[0]));
+	(yyval.data_type) = tmp;
+      }
+#line 7314 "parse.cc"
+    break;
+
+  case 66: /* data_type_or_implicit: %empty  */
+#line 944 "parse.y"
+      { (yyval.data_type) = 0; }
+#line 7320 "parse.cc"
+    break;
+
+  case 74: /* description: KK_attribute '(' IDENTIFIER ',' STRING ',' STRING ')'  */
+#line 965 "parse.y"
+      { perm_string tmp3 = lex_strings.make((yyvsp[-5].text));
+	pform_set_type_attrib(tmp3, (yyvsp[-3].text), (yyvsp[-1].text));
+	delete[] (yyvsp[-5].text);
+	delete[] (yyvsp[-3].text);
+      }
+#line 7330 "parse.cc"
+    break;
+
+  case 79: /* dynamic_array_new: K_new '[' expression ']'  */
+#line 987 "parse.y"
+      { (yyval.expr) = new PENew((yyvsp[-1].expr));
+	FILE_NAME((yyval.expr), (yylsp[-3]));
+      }
+#line 7338 "parse.cc"
+    break;
+
+  case 80: /* dynamic_array_new: K_new '[' expression ']' '(' expression ')'  */
+#line 991 "parse.y"
+      { yyerror((yylsp[-6]), "sorry: Dynamic array new expression with initializer not supported.");
+	delete (yyvsp[-1].expr);
+	(yyval.expr) = new PENew((yyvsp[-4].expr));
+	FILE_NAME((yyval.expr), (yylsp[-6]));
+      }
+#line 7348 "parse.cc"
+    break;
+
+  case 81: /* for_step: lpvalue '=' expression  */
+#line 1000 "parse.y"
+      { PAssign*tmp = new PAssign((yyvsp[-2].expr),(yyvsp[0].expr));
+	FILE_NAME(tmp, (yylsp[-2]));
+	(yyval.statement) = tmp;
+      }
+#line 7357 "parse.cc"
+    break;
+
+  case 82: /* for_step: inc_or_dec_expression  */
+#line 1005 "parse.y"
+      { (yyval.statement) = pform_compressed_assign_from_inc_dec((yylsp[0]), (yyvsp[0].expr)); }
+#line 7363 "parse.cc"
+    break;
+
+  case 83: /* for_step: compressed_statement  */
+#line 1007 "parse.y"
+      { (yyval.statement) = (yyvsp[0].statement); }
+#line 7369 "parse.cc"
+    break;
+
+  case 84: /* $@3: %empty  */
+#line 1017 "parse.y"
+      { assert(current_function == 0);
+	current_function = pform_push_function_scope((yylsp[-4]), (yyvsp[-1].text), (yyvsp[-3].flag));
+      }
+#line 7377 "parse.cc"
+    break;
+
+  case 85: /* $@4: %empty  */
+#line 1022 "parse.y"
+      { current_function->set_ports((yyvsp[-2].wires));
+	current_function->set_return((yyvsp[-6].function_type));
+	current_function_set_statement((yyvsp[-1].statement_list)? (yylsp[-1]) : (yylsp[-5]), (yyvsp[-1].statement_list));
+	pform_pop_scope();
+	current_function = 0;
+      }
+#line 7388 "parse.cc"
+    break;
+
+  case 86: /* function_declaration: K_function K_automatic_opt function_range_or_type_opt IDENTIFIER ';' $@3 function_item_list statement_or_null_list_opt K_endfunction $@4 endname_opt  */
+#line 1029 "parse.y"
+      { // Last step: check any closing name.
+	if ((yyvsp[0].text) && (strcmp((yyvsp[-7].text),(yyvsp[0].text)) != 0)) {
+	      yyerror((yylsp[0]), "error: End name doesn't match function name");
+	}
+	if ((yyvsp[0].text) && !gn_system_verilog()) {
+	      yyerror((yylsp[0]), "error: Function end names require System Verilog.");
+	}
+	delete[](yyvsp[-7].text);
+	if ((yyvsp[0].text)) delete[](yyvsp[0].text);
+      }
+#line 7403 "parse.cc"
+    break;
+
+  case 87: /* $@5: %empty  */
+#line 1041 "parse.y"
+      { assert(current_function == 0);
+	current_function = pform_push_function_scope((yylsp[-3]), (yyvsp[0].text), (yyvsp[-2].flag));
+      }
+#line 7411 "parse.cc"
+    break;
+
+  case 88: /* $@6: %empty  */
+#line 1048 "parse.y"
+      { current_function->set_ports((yyvsp[-5].wires));
+	current_function->set_return((yyvsp[-9].function_type));
+	current_function_set_statement((yyvsp[-1].statement_list)? (yylsp[-1]) : (yylsp[-8]), (yyvsp[-1].statement_list));
+	pform_pop_scope();
+	current_function = 0;
+	if ((yyvsp[-5].wires)==0 && !gn_system_verilog()) {
+	      yyerror((yylsp[-8]), "error: Empty parenthesis syntax requires SystemVerilog.");
+	}
+      }
+#line 7425 "parse.cc"
+    break;
+
+  case 89: /* function_declaration: K_function K_automatic_opt function_range_or_type_opt IDENTIFIER $@5 '(' tf_port_list_opt ')' ';' block_item_decls_opt statement_or_null_list_opt K_endfunction $@6 endname_opt  */
+#line 1058 "parse.y"
+      { // Last step: check any closing name.
+	if ((yyvsp[0].text) && (strcmp((yyvsp[-10].text),(yyvsp[0].text)) != 0)) {
+	      yyerror((yylsp[0]), "error: End name doesn't match function name");
+	}
+	if ((yyvsp[0].text) && !gn_system_verilog()) {
+	      yyerror((yylsp[0]), "error: Function end names require System Verilog.");
+	}
+	delete[](yyvsp[-10].text);
+	if ((yyvsp[0].text)) delete[](yyvsp[0].text);
+      }
+#line 7440 "parse.cc"
+    break;
+
+  case 90: /* $@7: %empty  */
+#line 1072 "parse.y"
+      { /* */
+	if (current_function) {
+	      pform_pop_scope();
+	      current_function = 0;
+	}
+	assert(current_function == 0);
+	yyerror((yylsp[-5]), "error: Syntax error defining function.");
+	yyerrok;
+      }
+#line 7454 "parse.cc"
+    break;
+
+  case 91: /* function_declaration: K_function K_automatic_opt function_range_or_type_opt IDENTIFIER error K_endfunction $@7 endname_opt  */
+#line 1082 "parse.y"
+      { // Last step: check any closing name.
+	if ((yyvsp[0].text) && (strcmp((yyvsp[-4].text),(yyvsp[0].text)) != 0)) {
+	      yyerror((yylsp[-4]), "error: End name doesn't match function name");
+	}
+	if ((yyvsp[0].text) && !gn_system_verilog()) {
+	      yyerror((yylsp[0]), "error: Function end names require System Verilog.");
+	}
+	delete[](yyvsp[-4].text);
+	if ((yyvsp[0].text)) delete[](yyvsp[0].text);
+      }
+#line 7469 "parse.cc"
+    break;
+
+  case 94: /* inc_or_dec_expression: K_INCR lpvalue  */
+#line 1108 "parse.y"
+      { PEUnary*tmp = new PEUnary('I', (yyvsp[0].expr));
+	FILE_NAME(tmp, (yylsp[0]));
+	(yyval.expr) = tmp;
+      }
+#line 7478 "parse.cc"
+    break;
+
+  case 95: /* inc_or_dec_expression: lpvalue K_INCR  */
+#line 1113 "parse.y"
+      { PEUnary*tmp = new PEUnary('i', (yyvsp[-1].expr));
+	FILE_NAME(tmp, (yylsp[-1]));
+	(yyval.expr) = tmp;
+      }
+#line 7487 "parse.cc"
+    break;
+
+  case 96: /* inc_or_dec_expression: K_DECR lpvalue  */
+#line 1118 "parse.y"
+      { PEUnary*tmp = new PEUnary('D', (yyvsp[0].expr));
+	FILE_NAME(tmp, (yylsp[0]));
+	(yyval.expr) = tmp;
+      }
+#line 7496 "parse.cc"
+    break;
+
+  case 97: /* inc_or_dec_expression: lpvalue K_DECR  */
+#line 1123 "parse.y"
+      { PEUnary*tmp = new PEUnary('d', (yyvsp[-1].expr));
+	FILE_NAME(tmp, (yylsp[-1]));
+	(yyval.expr) = tmp;
+      }
+#line 7505 "parse.cc"
+    break;
+
+  case 98: /* inside_expression: expression K_inside '{' open_range_list '}'  */
+#line 1131 "parse.y"
+      { yyerror((yylsp[-3]), "sorry: \"inside\" expressions not supported yet.");
+	(yyval.expr) = 0;
+      }
+#line 7513 "parse.cc"
+    break;
+
+  case 99: /* integer_vector_type: K_reg  */
+#line 1137 "parse.y"
+            { (yyval.vartype) = IVL_VT_NO_TYPE; }
+#line 7519 "parse.cc"
+    break;
+
+  case 100: /* integer_vector_type: K_bit  */
+#line 1138 "parse.y"
+            { (yyval.vartype) = IVL_VT_BOOL; }
+#line 7525 "parse.cc"
+    break;
+
+  case 101: /* integer_vector_type: K_logic  */
+#line 1139 "parse.y"
+            { (yyval.vartype) = IVL_VT_LOGIC; }
+#line 7531 "parse.cc"
+    break;
+
+  case 102: /* integer_vector_type: K_bool  */
+#line 1140 "parse.y"
+            { (yyval.vartype) = IVL_VT_BOOL; }
+#line 7537 "parse.cc"
+    break;
+
+  case 103: /* join_keyword: K_join  */
+#line 1145 "parse.y"
+      { (yyval.join_keyword) = PBlock::BL_PAR; }
+#line 7543 "parse.cc"
+    break;
+
+  case 104: /* join_keyword: K_join_none  */
+#line 1147 "parse.y"
+      { (yyval.join_keyword) = PBlock::BL_JOIN_NONE; }
+#line 7549 "parse.cc"
+    break;
+
+  case 105: /* join_keyword: K_join_any  */
+#line 1149 "parse.y"
+      { (yyval.join_keyword) = PBlock::BL_JOIN_ANY; }
+#line 7555 "parse.cc"
+    break;
+
+  case 106: /* jump_statement: K_break ';'  */
+#line 1154 "parse.y"
+      { yyerror((yylsp[-1]), "sorry: break statements not supported.");
+	(yyval.statement) = 0;
+      }
+#line 7563 "parse.cc"
+    break;
+
+  case 107: /* jump_statement: K_return ';'  */
+#line 1158 "parse.y"
+      { yyerror((yylsp[-1]), "sorry: return statements not supported.");
+	(yyval.statement) = 0;
+      }
+#line 7571 "parse.cc"
+    break;
+
+  case 108: /* jump_statement: K_return expression ';'  */
+#line 1162 "parse.y"
+      { yyerror((yylsp[-2]), "sorry: return statements not supported.");
+	(yyval.statement) = 0;
+      }
+#line 7579 "parse.cc"
+    break;
+
+  case 109: /* loop_statement: K_for '(' lpvalue '=' expression ';' expression ';' for_step ')' statement_or_null  */
+#line 1172 "parse.y"
+      { PForStatement*tmp = new PForStatement((yyvsp[-8].expr), (yyvsp[-6].expr), (yyvsp[-4].expr), (yyvsp[-2].statement), (yyvsp[0].statement));
+	FILE_NAME(tmp, (yylsp[-10]));
+	(yyval.statement) = tmp;
+      }
+#line 7588 "parse.cc"
+    break;
+
+  case 110: /* loop_statement: K_for '(' data_type IDENTIFIER '=' expression ';' expression ';' for_step ')' statement_or_null  */
+#line 1179 "parse.y"
+      { (yyval.statement) = 0;
+	yyerror((yylsp[-9]), "sorry: for_variable_declaration not supported");
+      }
+#line 7596 "parse.cc"
+    break;
+
+  case 111: /* loop_statement: K_forever statement_or_null  */
+#line 1184 "parse.y"
+      { PForever*tmp = new PForever((yyvsp[0].statement));
+	FILE_NAME(tmp, (yylsp[-1]));
+	(yyval.statement) = tmp;
+      }
+#line 7605 "parse.cc"
+    break;
+
+  case 112: /* loop_statement: K_repeat '(' expression ')' statement_or_null  */
+#line 1190 "parse.y"
+      { PRepeat*tmp = new PRepeat((yyvsp[-2].expr), (yyvsp[0].statement));
+	FILE_NAME(tmp, (yylsp[-4]));
+	(yyval.statement) = tmp;
+      }
+#line 7614 "parse.cc"
+    break;
+
+  case 113: /* loop_statement: K_while '(' expression ')' statement_or_null  */
+#line 1196 "parse.y"
+      { PWhile*tmp = new PWhile((yyvsp[-2].expr), (yyvsp[0].statement));
+	FILE_NAME(tmp, (yylsp[-4]));
+	(yyval.statement) = tmp;
+      }
+#line 7623 "parse.cc"
+    break;
+
+  case 114: /* loop_statement: K_foreach '(' IDENTIFIER '[' loop_variables ']' ')' statement_or_null  */
+#line 1202 "parse.y"
+      { yyerror((yylsp[-7]), "sorry: foreach loops not supported");
+	delete[](yyvsp[-5].text);
+	delete (yyvsp[-3].perm_strings);
+	delete (yyvsp[0].statement);
+	(yyval.statement) = 0;
+      }
+#line 7634 "parse.cc"
+    break;
+
+  case 115: /* loop_statement: K_for '(' lpvalue '=' expression ';' expression ';' error ')' statement_or_null  */
+#line 1213 "parse.y"
+      { (yyval.statement) = 0;
+	yyerror((yylsp[-10]), "error: Error in for loop step assignment.");
+      }
+#line 7642 "parse.cc"
+    break;
+
+  case 116: /* loop_statement: K_for '(' lpvalue '=' expression ';' error ';' for_step ')' statement_or_null  */
+#line 1219 "parse.y"
+      { (yyval.statement) = 0;
+	yyerror((yylsp[-10]), "error: Error in for loop condition expression.");
+      }
+#line 7650 "parse.cc"
+    break;
+
+  case 117: /* loop_statement: K_for '(' error ')' statement_or_null  */
+#line 1224 "parse.y"
+      { (yyval.statement) = 0;
+	yyerror((yylsp[-4]), "error: Incomprehensible for loop.");
+      }
+#line 7658 "parse.cc"
+    break;
+
+  case 118: /* loop_statement: K_while '(' error ')' statement_or_null  */
+#line 1229 "parse.y"
+      { (yyval.statement) = 0;
+	yyerror((yylsp[-4]), "error: Error in while loop condition.");
+      }
+#line 7666 "parse.cc"
+    break;
+
+  case 119: /* loop_statement: K_foreach '(' IDENTIFIER '[' error ']' ')' statement_or_null  */
+#line 1234 "parse.y"
+      { (yyval.statement) = 0;
+        yyerror((yylsp[-4]), "error: Errors in foreach loop variables list.");
+      }
+#line 7674 "parse.cc"
+    break;
+
+  case 120: /* list_of_variable_decl_assignments: variable_decl_assignment  */
+#line 1243 "parse.y"
+      { list<decl_assignment_t*>*tmp = new list<decl_assignment_t*>;
+	tmp->push_back((yyvsp[0].decl_assignment));
+	(yyval.decl_assignments) = tmp;
+      }
+#line 7683 "parse.cc"
+    break;
+
+  case 121: /* list_of_variable_decl_assignments: list_of_variable_decl_assignments ',' variable_decl_assignment  */
+#line 1248 "parse.y"
+      { list<decl_assignment_t*>*tmp = (yyvsp[-2].decl_assignments);
+	tmp->push_back((yyvsp[0].decl_assignment));
+	(yyval.decl_assignments) = tmp;
+      }
+#line 7692 "parse.cc"
+    break;
+
+  case 122: /* variable_decl_assignment: IDENTIFIER dimensions_opt  */
+#line 1256 "parse.y"
+      { decl_assignment_t*tmp = new decl_assignment_t;
+	tmp->name = lex_strings.make((yyvsp[-1].text));
+	if ((yyvsp[0].ranges)) {
+	      tmp->index = *(yyvsp[0].ranges);
+	      delete (yyvsp[0].ranges);
+	}
+	delete[](yyvsp[-1].text);
+	(yyval.decl_assignment) = tmp;
+      }
+#line 7706 "parse.cc"
+    break;
+
+  case 123: /* variable_decl_assignment: IDENTIFIER '=' expression  */
+#line 1266 "parse.y"
+      { decl_assignment_t*tmp = new decl_assignment_t;
+	tmp->name = lex_strings.make((yyvsp[-2].text));
+	tmp->expr .reset((yyvsp[0].expr));
+	delete[](yyvsp[-2].text);
+	(yyval.decl_assignment) = tmp;
+      }
+#line 7717 "parse.cc"
+    break;
+
+  case 124: /* variable_decl_assignment: IDENTIFIER '=' K_new '(' ')'  */
+#line 1273 "parse.y"
+      { decl_assignment_t*tmp = new decl_assignment_t;
+	tmp->name = lex_strings.make((yyvsp[-4].text));
+	yyerror("sorry: Class initialization assignment not supported here.");
+	delete[](yyvsp[-4].text);
+	(yyval.decl_assignment) = tmp;
+      }
+#line 7728 "parse.cc"
+    break;
+
+  case 125: /* loop_variables: loop_variables ',' IDENTIFIER  */
+#line 1284 "parse.y"
+      { list<perm_string>*tmp = (yyvsp[-2].perm_strings);
+	tmp->push_back(lex_strings.make((yyvsp[0].text)));
+	delete[](yyvsp[0].text);
+	(yyval.perm_strings) = tmp;
+      }
+#line 7738 "parse.cc"
+    break;
+
+  case 126: /* loop_variables: IDENTIFIER  */
+#line 1290 "parse.y"
+      { list<perm_string>*tmp = new list<perm_string>;
+	tmp->push_back(lex_strings.make((yyvsp[0].text)));
+	delete[](yyvsp[0].text);
+	(yyval.perm_strings) = tmp;
+      }
+#line 7748 "parse.cc"
+    break;
+
+  case 131: /* non_integer_type: K_real  */
+#line 1309 "parse.y"
+           { (yyval.real_type) = real_type_t::REAL; }
+#line 7754 "parse.cc"
+    break;
+
+  case 132: /* non_integer_type: K_realtime  */
+#line 1310 "parse.y"
+               { (yyval.real_type) = real_type_t::REAL; }
+#line 7760 "parse.cc"
+    break;
+
+  case 133: /* non_integer_type: K_shortreal  */
+#line 1311 "parse.y"
+                { (yyval.real_type) = real_type_t::SHORTREAL; }
+#line 7766 "parse.cc"
+    break;
+
+  case 134: /* number: BASED_NUMBER  */
+#line 1315 "parse.y"
+             { (yyval.number) = (yyvsp[0].number); based_size = 0;}
+#line 7772 "parse.cc"
+    break;
+
+  case 135: /* number: DEC_NUMBER  */
+#line 1317 "parse.y"
+             { (yyval.number) = (yyvsp[0].number); based_size = 0;}
+#line 7778 "parse.cc"
+    break;
+
+  case 136: /* number: DEC_NUMBER BASED_NUMBER  */
+#line 1319 "parse.y"
+             { (yyval.number) = pform_verinum_with_size((yyvsp[-1].number),(yyvsp[0].number), (yylsp[0]).text, (yylsp[0]).first_line);
+	       based_size = 0; }
+#line 7785 "parse.cc"
+    break;
+
+  case 137: /* number: UNBASED_NUMBER  */
+#line 1322 "parse.y"
+             { (yyval.number) = (yyvsp[0].number); based_size = 0;}
+#line 7791 "parse.cc"
+    break;
+
+  case 138: /* number: DEC_NUMBER UNBASED_NUMBER  */
+#line 1324 "parse.y"
+             { yyerror((yylsp[-1]), "error: Unbased SystemVerilog literal cannot have "
+	                   "a size.");
+	       (yyval.number) = (yyvsp[-1].number); based_size = 0;}
+#line 7799 "parse.cc"
+    break;
+
+  case 141: /* $@8: %empty  */
+#line 1336 "parse.y"
+      { pform_start_package_declaration((yylsp[-2]), (yyvsp[-1].text));
+      }
+#line 7806 "parse.cc"
+    break;
+
+  case 142: /* $@9: %empty  */
+#line 1340 "parse.y"
+      { pform_end_package_declaration((yylsp[-5])); }
+#line 7812 "parse.cc"
+    break;
+
+  case 143: /* package_declaration: K_package IDENTIFIER ';' $@8 package_item_list_opt K_endpackage $@9 endname_opt  */
+#line 1342 "parse.y"
+      { // Last step: check any closing name. This is done late so
+	// that the parser can look ahead to detect the present
+	// endname_opt but still have the pform_endmodule() called
+	// early enough that the lexor can know we are outside the
+	// module.
+	if ((yyvsp[0].text) && (strcmp((yyvsp[-6].text),(yyvsp[0].text)) != 0)) {
+	      yyerror((yylsp[0]), "error: End name doesn't match package name");
+	}
+	delete[](yyvsp[-6].text);
+	if ((yyvsp[0].text)) delete[](yyvsp[0].text);
+      }
+#line 7828 "parse.cc"
+    break;
+
+  case 144: /* package_import_declaration: K_import package_import_item_list ';'  */
+#line 1357 "parse.y"
+      { }
+#line 7834 "parse.cc"
+    break;
+
+  case 145: /* package_import_item: IDENTIFIER K_SCOPE_RES IDENTIFIER  */
+#line 1362 "parse.y"
+      { pform_package_import((yylsp[-1]), (yyvsp[-2].text), (yyvsp[0].text));
+	delete[](yyvsp[-2].text);
+	delete[](yyvsp[0].text);
+      }
+#line 7843 "parse.cc"
+    break;
+
+  case 146: /* package_import_item: IDENTIFIER K_SCOPE_RES '*'  */
+#line 1367 "parse.y"
+      { pform_package_import((yylsp[-1]), (yyvsp[-2].text), 0);
+	delete[](yyvsp[-2].text);
+      }
+#line 7851 "parse.cc"
+    break;
+
+  case 158: /* port_direction: K_input  */
+#line 1393 "parse.y"
+             { (yyval.porttype) = NetNet::PINPUT; }
+#line 7857 "parse.cc"
+    break;
+
+  case 159: /* port_direction: K_output  */
+#line 1394 "parse.y"
+             { (yyval.porttype) = NetNet::POUTPUT; }
+#line 7863 "parse.cc"
+    break;
+
+  case 160: /* port_direction: K_inout  */
+#line 1395 "parse.y"
+             { (yyval.porttype) = NetNet::PINOUT; }
+#line 7869 "parse.cc"
+    break;
+
+  case 161: /* port_direction: K_ref  */
+#line 1397 "parse.y"
+      { (yyval.porttype) = NetNet::PREF;
+        if (!gn_system_verilog()) {
+	      yyerror((yylsp[0]), "error: Reference ports (ref) require SystemVerilog.");
+	      (yyval.porttype) = NetNet::PINPUT;
+	}
+      }
+#line 7880 "parse.cc"
+    break;
+
+  case 162: /* port_direction_opt: port_direction  */
+#line 1410 "parse.y"
+                   { (yyval.porttype) = (yyvsp[0].porttype); }
+#line 7886 "parse.cc"
+    break;
+
+  case 163: /* port_direction_opt: %empty  */
+#line 1411 "parse.y"
+                   { (yyval.porttype) = NetNet::PIMPLICIT; }
+#line 7892 "parse.cc"
+    break;
+
+  case 166: /* property_qualifier_opt: property_qualifier_list  */
+#line 1424 "parse.y"
+                            { (yyval.property_qualifier) = (yyvsp[0].property_qualifier); }
+#line 7898 "parse.cc"
+    break;
+
+  case 167: /* property_qualifier_opt: %empty  */
+#line 1425 "parse.y"
+    { (yyval.property_qualifier) = property_qualifier_t::set_none(); }
+#line 7904 "parse.cc"
+    break;
+
+  case 168: /* property_qualifier_list: property_qualifier_list property_qualifier  */
+#line 1429 "parse.y"
+                                               { (yyval.property_qualifier) = (yyvsp[-1].property_qualifier) | (yyvsp[0].property_qualifier); }
+#line 7910 "parse.cc"
+    break;
+
+  case 169: /* property_qualifier_list: property_qualifier  */
+#line 1430 "parse.y"
+                       { (yyval.property_qualifier) = (yyvsp[0].property_qualifier); }
+#line 7916 "parse.cc"
+    break;
+
+  case 170: /* random_qualifier: K_rand  */
+#line 1434 "parse.y"
+           { (yyval.property_qualifier) = property_qualifier_t::set_rand(); }
+#line 7922 "parse.cc"
+    break;
+
+  case 171: /* random_qualifier: K_randc  */
+#line 1435 "parse.y"
+            { (yyval.property_qualifier) = property_qualifier_t::set_randc(); }
+#line 7928 "parse.cc"
+    break;
+
+  case 174: /* signing: K_signed  */
+#line 1446 "parse.y"
+               { (yyval.flag) = true; }
+#line 7934 "parse.cc"
+    break;
+
+  case 175: /* signing: K_unsigned  */
+#line 1447 "parse.y"
+               { (yyval.flag) = false; }
+#line 7940 "parse.cc"
+    break;
+
+  case 176: /* statement: attribute_list_opt statement_item  */
+#line 1452 "parse.y"
+      { pform_bind_attributes((yyvsp[0].statement)->attributes, (yyvsp[-1].named_pexprs));
+	(yyval.statement) = (yyvsp[0].statement);
+      }
+#line 7948 "parse.cc"
+    break;
+
+  case 177: /* statement_or_null: statement  */
+#line 1462 "parse.y"
+      { (yyval.statement) = (yyvsp[0].statement); }
+#line 7954 "parse.cc"
+    break;
+
+  case 178: /* statement_or_null: attribute_list_opt ';'  */
+#line 1464 "parse.y"
+      { (yyval.statement) = 0; }
+#line 7960 "parse.cc"
+    break;
+
+  case 184: /* streaming_concatenation: '{' stream_operator '{' stream_expression_list '}' '}'  */
+#line 1483 "parse.y"
+      { /* streaming concatenation is a SystemVerilog thing. */
+	if (gn_system_verilog()) {
+	      yyerror((yylsp[-4]), "sorry: Streaming concatenation not supported.");
+	      (yyval.expr) = 0;
+	} else {
+	      yyerror((yylsp[-4]), "error: Streaming concatenation requires SystemVerilog");
+	      (yyval.expr) = 0;
+	}
+      }
+#line 7974 "parse.cc"
+    break;
+
+  case 185: /* $@10: %empty  */
+#line 1502 "parse.y"
+      { assert(current_task == 0);
+	current_task = pform_push_task_scope((yylsp[-3]), (yyvsp[-1].text), (yyvsp[-2].flag));
+      }
+#line 7982 "parse.cc"
+    break;
+
+  case 186: /* $@11: %empty  */
+#line 1508 "parse.y"
+      { current_task->set_ports((yyvsp[-2].wires));
+	current_task_set_statement((yylsp[-5]), (yyvsp[-1].statement_list));
+	pform_pop_scope();
+	current_task = 0;
+	if ((yyvsp[-1].statement_list) && (yyvsp[-1].statement_list)->size() > 1 && !gn_system_verilog()) {
+	      yyerror((yylsp[-1]), "error: Task body with multiple statements requres SystemVerilog.");
+	}
+	delete (yyvsp[-1].statement_list);
+      }
+#line 7996 "parse.cc"
+    break;
+
+  case 187: /* task_declaration: K_task K_automatic_opt IDENTIFIER ';' $@10 task_item_list_opt statement_or_null_list_opt K_endtask $@11 endname_opt  */
+#line 1518 "parse.y"
+      { // Last step: check any closing name. This is done late so
+	// that the parser can look ahead to detect the present
+	// endname_opt but still have the pform_endmodule() called
+	// early enough that the lexor can know we are outside the
+	// module.
+	if ((yyvsp[0].text) && (strcmp((yyvsp[-7].text),(yyvsp[0].text)) != 0)) {
+	      yyerror((yylsp[0]), "error: End name doesn't match module/program name");
+	}
+	if ((yyvsp[0].text) && !gn_system_verilog()) {
+	      yyerror((yylsp[0]), "error: Task end names require System Verilog.");
+	}
+	delete[](yyvsp[-7].text);
+	if ((yyvsp[0].text)) delete[](yyvsp[0].text);
+      }
+#line 8015 "parse.cc"
+    break;
+
+  case 188: /* $@12: %empty  */
+#line 1534 "parse.y"
+      { assert(current_task == 0);
+	current_task = pform_push_task_scope((yylsp[-3]), (yyvsp[-1].text), (yyvsp[-2].flag));
+      }
+#line 8023 "parse.cc"
+    break;
+
+  case 189: /* $@13: %empty  */
+#line 1541 "parse.y"
+      { current_task->set_ports((yyvsp[-5].wires));
+	current_task_set_statement((yylsp[-8]), (yyvsp[-1].statement_list));
+	pform_pop_scope();
+	current_task = 0;
+	if ((yyvsp[-1].statement_list)) delete (yyvsp[-1].statement_list);
+      }
+#line 8034 "parse.cc"
+    break;
+
+  case 190: /* task_declaration: K_task K_automatic_opt IDENTIFIER '(' $@12 tf_port_list ')' ';' block_item_decls_opt statement_or_null_list_opt K_endtask $@13 endname_opt  */
+#line 1548 "parse.y"
+      { // Last step: check any closing name. This is done late so
+	// that the parser can look ahead to detect the present
+	// endname_opt but still have the pform_endmodule() called
+	// early enough that the lexor can know we are outside the
+	// module.
+	if ((yyvsp[0].text) && (strcmp((yyvsp[-10].text),(yyvsp[0].text)) != 0)) {
+	      yyerror((yylsp[0]), "error: End name doesn't match module/program name");
+	}
+	if ((yyvsp[0].text) && !gn_system_verilog()) {
+	      yyerror((yylsp[0]), "error: Task end names require System Verilog.");
+	}
+	delete[](yyvsp[-10].text);
+	if ((yyvsp[0].text)) delete[](yyvsp[0].text);
+      }
+#line 8053 "parse.cc"
+    break;
+
+  case 191: /* $@14: %empty  */
+#line 1564 "parse.y"
+      { assert(current_task == 0);
+	current_task = pform_push_task_scope((yylsp[-5]), (yyvsp[-3].text), (yyvsp[-4].flag));
+      }
+#line 8061 "parse.cc"
+    break;
+
+  case 192: /* $@15: %empty  */
+#line 1570 "parse.y"
+      { current_task->set_ports(0);
+	current_task_set_statement((yylsp[-7]), (yyvsp[-1].statement_list));
+	pform_pop_scope();
+	current_task = 0;
+	cerr << (yylsp[-7]) << ": warning: task definition for \"" << (yyvsp[-7].text)
+	     << "\" has an empty port declaration list!" << endl;
+	if ((yyvsp[-1].statement_list)->size() > 1 && !gn_system_verilog()) {
+	      yyerror((yylsp[-1]), "error: Task body with multiple statements requres SystemVerilog.");
+	}
+	delete (yyvsp[-1].statement_list);
+      }
+#line 8077 "parse.cc"
+    break;
+
+  case 193: /* task_declaration: K_task K_automatic_opt IDENTIFIER '(' ')' ';' $@14 block_item_decls_opt statement_or_null_list K_endtask $@15 endname_opt  */
+#line 1582 "parse.y"
+      { // Last step: check any closing name. This is done late so
+	// that the parser can look ahead to detect the present
+	// endname_opt but still have the pform_endmodule() called
+	// early enough that the lexor can know we are outside the
+	// module.
+	if ((yyvsp[0].text) && (strcmp((yyvsp[-9].text),(yyvsp[0].text)) != 0)) {
+	      yyerror((yylsp[0]), "error: End name doesn't match module/program name");
+	}
+	if ((yyvsp[0].text) && !gn_system_verilog()) {
+	      yyerror((yylsp[0]), "error: Task end names require System Verilog.");
+	}
+	delete[](yyvsp[-9].text);
+	if ((yyvsp[0].text)) delete[](yyvsp[0].text);
+      }
+#line 8096 "parse.cc"
+    break;
+
+  case 194: /* $@16: %empty  */
+#line 1598 "parse.y"
+      {
+	assert(current_task == 0);
+      }
+#line 8104 "parse.cc"
+    break;
+
+  case 195: /* task_declaration: K_task K_automatic_opt IDENTIFIER error K_endtask $@16 endname_opt  */
+#line 1602 "parse.y"
+      { // Last step: check any closing name. This is done late so
+	// that the parser can look ahead to detect the present
+	// endname_opt but still have the pform_endmodule() called
+	// early enough that the lexor can know we are outside the
+	// module.
+	if ((yyvsp[0].text) && (strcmp((yyvsp[-4].text),(yyvsp[0].text)) != 0)) {
+	      yyerror((yylsp[0]), "error: End name doesn't match module/program name");
+	}
+	if ((yyvsp[0].text) && !gn_system_verilog()) {
+	      yyerror((yylsp[0]), "error: Task end names require System Verilog.");
+	}
+	delete[](yyvsp[-4].text);
+	if ((yyvsp[0].text)) delete[](yyvsp[0].text);
+      }
+#line 8123 "parse.cc"
+    break;
+
+  case 196: /* tf_port_declaration: port_direction K_reg_opt unsigned_signed_opt range_opt list_of_identifiers ';'  */
+#line 1622 "parse.y"
+      { svector<PWire*>*tmp = pform_make_task_ports((yylsp[-5]), (yyvsp[-5].porttype),
+						(yyvsp[-4].flag) ? IVL_VT_LOGIC :
+						     IVL_VT_NO_TYPE,
+						(yyvsp[-3].flag), (yyvsp[-2].ranges), (yyvsp[-1].perm_strings));
+	(yyval.wires) = tmp;
+      }
+#line 8134 "parse.cc"
+    break;
+
+  case 197: /* tf_port_declaration: port_direction K_integer list_of_identifiers ';'  */
+#line 1633 "parse.y"
+      { list<pform_range_t>*range_stub = make_range_from_width(integer_width);
+	svector<PWire*>*tmp = pform_make_task_ports((yylsp[-3]), (yyvsp[-3].porttype), IVL_VT_LOGIC, true,
+						    range_stub, (yyvsp[-1].perm_strings), true);
+	(yyval.wires) = tmp;
+      }
+#line 8144 "parse.cc"
+    break;
+
+  case 198: /* tf_port_declaration: port_direction K_time list_of_identifiers ';'  */
+#line 1642 "parse.y"
+      { list<pform_range_t>*range_stub = make_range_from_width(64);
+	svector<PWire*>*tmp = pform_make_task_ports((yylsp[-3]), (yyvsp[-3].porttype), IVL_VT_LOGIC, false,
+						    range_stub, (yyvsp[-1].perm_strings));
+	(yyval.wires) = tmp;
+      }
+#line 8154 "parse.cc"
+    break;
+
+  case 199: /* tf_port_declaration: port_direction real_or_realtime list_of_identifiers ';'  */
+#line 1651 "parse.y"
+      { svector<PWire*>*tmp = pform_make_task_ports((yylsp[-3]), (yyvsp[-3].porttype), IVL_VT_REAL, false,
+						    0, (yyvsp[-1].perm_strings));
+	(yyval.wires) = tmp;
+      }
+#line 8163 "parse.cc"
+    break;
+
+  case 200: /* tf_port_item: port_direction_opt K_integer IDENTIFIER range_opt tf_port_item_expr_opt  */
+#line 1672 "parse.y"
+      { list<pform_range_t>*range_stub = make_range_from_width(integer_width);
+	NetNet::PortType use_port_type = (yyvsp[-4].porttype)==NetNet::PIMPLICIT? NetNet::PINPUT : (yyvsp[-4].porttype);
+
+	port_declaration_context.port_type = use_port_type;
+	port_declaration_context.var_type = IVL_VT_LOGIC;
+	port_declaration_context.sign_flag = true;
+	delete port_declaration_context.range;
+	port_declaration_context.range = copy_range(range_stub);
+	svector<PWire*>*tmp = pform_make_task_ports((yylsp[-2]), use_port_type,
+						    IVL_VT_LOGIC, true,
+						    range_stub,
+						    list_from_identifier((yyvsp[-2].text)), true);
+	(yyval.wires) = tmp;
+	if ((yyvsp[-1].ranges)) {
+	      yyerror((yylsp[-1]), "sorry: Port variable dimensions not supported yet.");
+	      delete (yyvsp[-1].ranges);
+	}
+	if ((yyvsp[0].expr)) {
+	      yyerror((yylsp[0]), "sorry: Port default expressions not supported yet.");
+	      delete (yyvsp[0].expr);
+	}
+      }
+#line 8190 "parse.cc"
+    break;
+
+  case 201: /* tf_port_item: port_direction_opt K_time IDENTIFIER range_opt tf_port_item_expr_opt  */
+#line 1698 "parse.y"
+      { list<pform_range_t>*range_stub = make_range_from_width(64);
+	NetNet::PortType use_port_type = (yyvsp[-4].porttype)==NetNet::PIMPLICIT? NetNet::PINPUT : (yyvsp[-4].porttype);
+
+	port_declaration_context.port_type = use_port_type;
+	port_declaration_context.var_type = IVL_VT_LOGIC;
+	port_declaration_context.sign_flag = false;
+	delete port_declaration_context.range;
+	port_declaration_context.range = copy_range(range_stub);
+	svector<PWire*>*tmp = pform_make_task_ports((yylsp[-2]), use_port_type, IVL_VT_LOGIC,
+						    false, range_stub,
+						    list_from_identifier((yyvsp[-2].text)));
+	(yyval.wires) = tmp;
+	if ((yyvsp[-1].ranges)) {
+	      yyerror((yylsp[-1]), "sorry: Port variable dimensions not supported yet.");
+	      delete (yyvsp[-1].ranges);
+	}
+	if ((yyvsp[0].expr)) {
+	      yyerror((yylsp[0]), "sorry: Port default expressions not supported yet.");
+	      delete (yyvsp[0].expr);
+	}
+      }
+#line 8216 "parse.cc"
+    break;
+
+  case 202: /* tf_port_item: port_direction_opt data_type_or_implicit IDENTIFIER range_opt tf_port_item_expr_opt  */
+#line 1721 "parse.y"
+      { svector<PWire*>*tmp;
+	NetNet::PortType use_port_type = (yyvsp[-4].porttype)==NetNet::PIMPLICIT? NetNet::PINPUT : (yyvsp[-4].porttype);
+	list<perm_string>* ilist = list_from_identifier((yyvsp[-2].text));
+
+	if (((yyvsp[-3].data_type) == 0) && ((yyvsp[-4].porttype)==NetNet::PIMPLICIT)) {
+		// Detect special case this is an undecorated
+		// identifier and we need to get the declaration from
+		// left context.
+	      if (port_declaration_context.var_type == IVL_VT_NO_TYPE) {
+		    tmp = pform_make_task_ports((yylsp[-2]), use_port_type,
+					 port_declaration_context.data_type,
+					 ilist);
+	      } else {
+		    tmp = pform_make_task_ports((yylsp[-2]), use_port_type,
+					 port_declaration_context.var_type,
+					 port_declaration_context.sign_flag,
+					 copy_range(port_declaration_context.range),
+					 ilist);
+	      }
+
+	} else {
+		// Otherwise, the decorations for this identifier
+		// indicate the type. Save the type for any right
+		// context thta may come later.
+	      port_declaration_context.port_type = use_port_type;
+	      port_declaration_context.var_type = IVL_VT_NO_TYPE;
+	      port_declaration_context.sign_flag = false;
+	      delete port_declaration_context.range;
+	      port_declaration_context.range = 0;
+	      if ((yyvsp[-3].data_type) == 0) {
+		    (yyvsp[-3].data_type) = new vector_type_t(IVL_VT_LOGIC, false, 0);
+		    FILE_NAME((yyvsp[-3].data_type), (yylsp[-2]));
+	      }
+	      port_declaration_context.data_type = (yyvsp[-3].data_type);
+	      tmp = pform_make_task_ports((yylsp[-2]), use_port_type, (yyvsp[-3].data_type), ilist);
+	}
+	(yyval.wires) = tmp;
+	if ((yyvsp[-1].ranges)) {
+	      yyerror((yylsp[-1]), "sorry: Port variable dimensions not supported yet.");
+	      delete (yyvsp[-1].ranges);
+	}
+	if ((yyvsp[0].expr)) {
+	      yyerror((yylsp[0]), "sorry: Port default expressions not supported yet.");
+	      delete (yyvsp[0].expr);
+	}
+     }
+#line 8267 "parse.cc"
+    break;
+
+  case 203: /* tf_port_item: port_direction_opt data_type_or_implicit IDENTIFIER error  */
+#line 1771 "parse.y"
+      { yyerror((yylsp[-1]), "error: Error in task/function port item after port name %s.", (yyvsp[-1].text));
+	yyerrok;
+	(yyval.wires) = 0;
+      }
+#line 8276 "parse.cc"
+    break;
+
+  case 204: /* tf_port_item_expr_opt: '=' expression  */
+#line 1780 "parse.y"
+                   { (yyval.expr) = (yyvsp[0].expr); }
+#line 8282 "parse.cc"
+    break;
+
+  case 205: /* tf_port_item_expr_opt: %empty  */
+#line 1781 "parse.y"
+                   { (yyval.expr) = 0; }
+#line 8288 "parse.cc"
+    break;
+
+  case 206: /* tf_port_list: tf_port_list ',' tf_port_item  */
+#line 1787 "parse.y"
+      { svector<PWire*>*tmp;
+	if ((yyvsp[-2].wires) && (yyvsp[0].wires)) {
+	      tmp = new svector<PWire*>(*(yyvsp[-2].wires), *(yyvsp[0].wires));
+	      delete (yyvsp[-2].wires);
+	      delete (yyvsp[0].wires);
+	} else if ((yyvsp[-2].wires)) {
+	      tmp = (yyvsp[-2].wires);
+	} else {
+	      tmp = (yyvsp[0].wires);
+	}
+	(yyval.wires) = tmp;
+      }
+#line 8305 "parse.cc"
+    break;
+
+  case 207: /* tf_port_list: tf_port_item  */
+#line 1801 "parse.y"
+      { (yyval.wires) = (yyvsp[0].wires); }
+#line 8311 "parse.cc"
+    break;
+
+  case 208: /* tf_port_list: error ',' tf_port_item  */
+#line 1806 "parse.y"
+      { yyerror((yylsp[-1]), "error: Syntax error in task/function port declaration.");
+	(yyval.wires) = (yyvsp[0].wires);
+      }
+#line 8319 "parse.cc"
+    break;
+
+  case 209: /* tf_port_list: tf_port_list ','  */
+#line 1810 "parse.y"
+      { yyerror((yylsp[0]), "error: NULL port declarations are not allowed.");
+	(yyval.wires) = (yyvsp[-1].wires);
+      }
+#line 8327 "parse.cc"
+    break;
+
+  case 210: /* tf_port_list: tf_port_list ';'  */
+#line 1814 "parse.y"
+      { yyerror((yylsp[0]), "error: ';' is an invalid port declaration separator.");
+	(yyval.wires) = (yyvsp[-1].wires);
+      }
+#line 8335 "parse.cc"
+    break;
+
+  case 211: /* timeunits_declaration: K_timeunit TIME_LITERAL ';'  */
+#line 1826 "parse.y"
+      { pform_set_timeunit((yyvsp[-1].text), false, false); }
+#line 8341 "parse.cc"
+    break;
+
+  case 212: /* timeunits_declaration: K_timeprecision TIME_LITERAL ';'  */
+#line 1828 "parse.y"
+      { pform_set_timeprecision((yyvsp[-1].text), false, false); }
+#line 8347 "parse.cc"
+    break;
+
+  case 213: /* value_range: expression  */
+#line 1833 "parse.y"
+      { }
+#line 8353 "parse.cc"
+    break;
+
+  case 214: /* value_range: '[' expression ':' expression ']'  */
+#line 1835 "parse.y"
+      { }
+#line 8359 "parse.cc"
+    break;
+
+  case 215: /* variable_dimension: '[' expression ':' expression ']'  */
+#line 1840 "parse.y"
+      { list<pform_range_t> *tmp = new list<pform_range_t>;
+	pform_range_t index ((yyvsp[-3].expr),(yyvsp[-1].expr));
+	tmp->push_back(index);
+	(yyval.ranges) = tmp;
+      }
+#line 8369 "parse.cc"
+    break;
+
+  case 216: /* variable_dimension: '[' expression ']'  */
+#line 1846 "parse.y"
+      { // SystemVerilog canonical range
+	if (generation_flag < GN_VER2005_SV) {
+	      warn_count += 1;
+	      cerr << (yylsp[-1]) << ": warning: Use of SystemVerilog [size] dimension. "
+		   << "Use at least -g2005-sv to remove this warning." << endl;
+	}
+	list<pform_range_t> *tmp = new list<pform_range_t>;
+	pform_range_t index;
+	index.first = new PENumber(new verinum((uint64_t)0, integer_width));
+	index.second = new PEBinary('-', (yyvsp[-1].expr), new PENumber(new verinum((uint64_t)1, integer_width)));
+	tmp->push_back(index);
+	(yyval.ranges) = tmp;
+      }
+#line 8387 "parse.cc"
+    break;
+
+  case 217: /* variable_dimension: '[' ']'  */
+#line 1860 "parse.y"
+      { list<pform_range_t> *tmp = new list<pform_range_t>;
+	pform_range_t index (0,0);
+	tmp->push_back(index);
+	(yyval.ranges) = tmp;
+      }
+#line 8397 "parse.cc"
+    break;
+
+  case 218: /* variable_dimension: '[' '$' ']'  */
+#line 1866 "parse.y"
+      { // SystemVerilog queue
+	list<pform_range_t> *tmp = new list<pform_range_t>;
+	pform_range_t index (0,0);
+	if (gn_system_verilog()) {
+	      yyerror("sorry: Dynamic array ranges not supported.");
+	} else {
+	      yyerror("error: Queue declarations require System Verilog.");
+	}
+	tmp->push_back(index);
+	(yyval.ranges) = tmp;
+      }
+#line 8413 "parse.cc"
+    break;
+
+  case 220: /* attribute_list_opt: %empty  */
+#line 1884 "parse.y"
+          { (yyval.named_pexprs) = 0; }
+#line 8419 "parse.cc"
+    break;
+
+  case 221: /* attribute_instance_list: K_PSTAR K_STARP  */
+#line 1888 "parse.y"
+                    { (yyval.named_pexprs) = 0; }
+#line 8425 "parse.cc"
+    break;
+
+  case 222: /* attribute_instance_list: K_PSTAR attribute_list K_STARP  */
+#line 1889 "parse.y"
+                                   { (yyval.named_pexprs) = (yyvsp[-1].named_pexprs); }
+#line 8431 "parse.cc"
+    break;
+
+  case 223: /* attribute_instance_list: attribute_instance_list K_PSTAR K_STARP  */
+#line 1890 "parse.y"
+                                            { (yyval.named_pexprs) = (yyvsp[-2].named_pexprs); }
+#line 8437 "parse.cc"
+    break;
+
+  case 224: /* attribute_instance_list: attribute_instance_list K_PSTAR attribute_list K_STARP  */
+#line 1892 "parse.y"
+      { list<named_pexpr_t>*tmp = (yyvsp[-3].named_pexprs);
+	if (tmp) {
+	    tmp->splice(tmp->end(), *(yyvsp[-1].named_pexprs));
+	    delete (yyvsp[-1].named_pexprs);
+	    (yyval.named_pexprs) = tmp;
+	} else (yyval.named_pexprs) = (yyvsp[-1].named_pexprs);
+      }
+#line 8449 "parse.cc"
+    break;
+
+  case 225: /* attribute_list: attribute_list ',' attribute  */
+#line 1903 "parse.y"
+      { list<named_pexpr_t>*tmp = (yyvsp[-2].named_pexprs);
+        tmp->push_back(*(yyvsp[0].named_pexpr));
+	delete (yyvsp[0].named_pexpr);
+	(yyval.named_pexprs) = tmp;
+      }
+#line 8459 "parse.cc"
+    break;
+
+  case 226: /* attribute_list: attribute  */
+#line 1909 "parse.y"
+      { list<named_pexpr_t>*tmp = new list<named_pexpr_t>;
+        tmp->push_back(*(yyvsp[0].named_pexpr));
+	delete (yyvsp[0].named_pexpr);
+	(yyval.named_pexprs) = tmp;
+      }
+#line 8469 "parse.cc"
+    break;
+
+  case 227: /* attribute: IDENTIFIER  */
+#line 1919 "parse.y"
+                { named_pexpr_t*tmp = new named_pexpr_t;
+		  tmp->name = lex_strings.make((yyvsp[0].text));
+		  tmp->parm = 0;
+		  delete[](yyvsp[0].text);
+		  (yyval.named_pexpr) = tmp;
+		}
+#line 8480 "parse.cc"
+    break;
+
+  case 228: /* attribute: IDENTIFIER '=' expression  */
+#line 1926 "parse.y"
+                { PExpr*tmp = (yyvsp[0].expr);
+		  named_pexpr_t*tmp2 = new named_pexpr_t;
+		  tmp2->name = lex_strings.make((yyvsp[-2].text));
+		  tmp2->parm = tmp;
+		  delete[](yyvsp[-2].text);
+		  (yyval.named_pexpr) = tmp2;
+		}
+#line 8492 "parse.cc"
+    break;
+
+  case 229: /* block_item_decl: K_integer signed_unsigned_opt register_variable_list ';'  */
+#line 1949 "parse.y"
+      { pform_set_reg_integer((yyvsp[-1].perm_strings), attributes_in_context);
+      }
+#line 8499 "parse.cc"
+    break;
+
+  case 230: /* block_item_decl: K_time register_variable_list ';'  */
+#line 1953 "parse.y"
+      { pform_set_reg_time((yyvsp[-1].perm_strings), attributes_in_context);
+      }
+#line 8506 "parse.cc"
+    break;
+
+  case 231: /* block_item_decl: data_type register_variable_list ';'  */
+#line 1960 "parse.y"
+      { if ((yyvsp[-2].data_type)) pform_set_data_type((yylsp[-2]), (yyvsp[-2].data_type), (yyvsp[-1].perm_strings), NetNet::REG, attributes_in_context);
+      }
+#line 8513 "parse.cc"
+    break;
+
+  case 232: /* block_item_decl: K_reg data_type register_variable_list ';'  */
+#line 1964 "parse.y"
+      { if ((yyvsp[-2].data_type)) pform_set_data_type((yylsp[-2]), (yyvsp[-2].data_type), (yyvsp[-1].perm_strings), NetNet::REG, attributes_in_context);
+      }
+#line 8520 "parse.cc"
+    break;
+
+  case 233: /* block_item_decl: K_event list_of_identifiers ';'  */
+#line 1968 "parse.y"
+      { pform_make_events((yyvsp[-1].perm_strings), (yylsp[-2]).text, (yylsp[-2]).first_line);
+      }
+#line 8527 "parse.cc"
+    break;
+
+  case 237: /* block_item_decl: K_integer error ';'  */
+#line 1982 "parse.y"
+      { yyerror((yylsp[-2]), "error: syntax error in integer variable list.");
+	yyerrok;
+      }
+#line 8535 "parse.cc"
+    break;
+
+  case 238: /* block_item_decl: K_time error ';'  */
+#line 1987 "parse.y"
+      { yyerror((yylsp[-2]), "error: syntax error in time variable list.");
+	yyerrok;
+      }
+#line 8543 "parse.cc"
+    break;
+
+  case 239: /* block_item_decl: K_parameter error ';'  */
+#line 1992 "parse.y"
+      { yyerror((yylsp[-2]), "error: syntax error in parameter list.");
+	yyerrok;
+      }
+#line 8551 "parse.cc"
+    break;
+
+  case 240: /* block_item_decl: K_localparam error ';'  */
+#line 1996 "parse.y"
+      { yyerror((yylsp[-2]), "error: syntax error localparam list.");
+	yyerrok;
+      }
+#line 8559 "parse.cc"
+    break;
+
+  case 245: /* type_declaration: K_typedef data_type IDENTIFIER ';'  */
+#line 2015 "parse.y"
+      { perm_string name = lex_strings.make((yyvsp[-1].text));
+	pform_set_typedef(name, (yyvsp[-2].data_type));
+	delete[](yyvsp[-1].text);
+      }
+#line 8568 "parse.cc"
+    break;
+
+  case 246: /* type_declaration: K_typedef K_class IDENTIFIER ';'  */
+#line 2023 "parse.y"
+      { // Create a synthetic typedef for the class name so that the
+	// lexor detects the name as a type.
+	perm_string name = lex_strings.make((yyvsp[-1].text));
+	class_type_t*tmp = new class_type_t(name);
+	pform_set_typedef(name, tmp);
+	delete[](yyvsp[-1].text);
+      }
+#line 8580 "parse.cc"
+    break;
+
+  case 247: /* type_declaration: K_typedef K_enum IDENTIFIER ';'  */
+#line 2031 "parse.y"
+      { yyerror((yylsp[-3]), "sorry: Enum forward declarations not supported yet."); }
+#line 8586 "parse.cc"
+    break;
+
+  case 248: /* type_declaration: K_typedef K_struct IDENTIFIER ';'  */
+#line 2033 "parse.y"
+      { yyerror((yylsp[-3]), "sorry: Struct forward declarations not supported yet."); }
+#line 8592 "parse.cc"
+    break;
+
+  case 249: /* type_declaration: K_typedef K_union IDENTIFIER ';'  */
+#line 2035 "parse.y"
+      { yyerror((yylsp[-3]), "sorry: Union forward declarations not supported yet."); }
+#line 8598 "parse.cc"
+    break;
+
+  case 250: /* type_declaration: K_typedef IDENTIFIER ';'  */
+#line 2037 "parse.y"
+      { // Create a synthetic typedef for the class name so that the
+	// lexor detects the name as a type.
+	perm_string name = lex_strings.make((yyvsp[-1].text));
+	class_type_t*tmp = new class_type_t(name);
+	pform_set_typedef(name, tmp);
+	delete[](yyvsp[-1].text);
+      }
+#line 8610 "parse.cc"
+    break;
+
+  case 251: /* enum_data_type: K_enum '{' enum_name_list '}'  */
+#line 2053 "parse.y"
+      { enum_type_t*enum_type = new enum_type_t;
+	FILE_NAME(enum_type, (yylsp[-3]));
+	enum_type->names .reset((yyvsp[-1].named_pexprs));
+	enum_type->base_type = IVL_VT_BOOL;
+	enum_type->signed_flag = true;
+	enum_type->range.reset(make_range_from_width(32));
+	(yyval.enum_type) = enum_type;
+      }
+#line 8623 "parse.cc"
+    break;
+
+  case 252: /* enum_data_type: K_enum atom2_type signed_unsigned_opt '{' enum_name_list '}'  */
+#line 2062 "parse.y"
+      { enum_type_t*enum_type = new enum_type_t;
+	FILE_NAME(enum_type, (yylsp[-5]));
+	enum_type->names .reset((yyvsp[-1].named_pexprs));
+	enum_type->base_type = IVL_VT_BOOL;
+	enum_type->signed_flag = (yyvsp[-3].flag);
+	enum_type->range.reset(make_range_from_width((yyvsp[-4].int_val)));
+	(yyval.enum_type) = enum_type;
+      }
+#line 8636 "parse.cc"
+    break;
+
+  case 253: /* enum_data_type: K_enum K_integer signed_unsigned_opt '{' enum_name_list '}'  */
+#line 2071 "parse.y"
+      { enum_type_t*enum_type = new enum_type_t;
+	FILE_NAME(enum_type, (yylsp[-5]));
+	enum_type->names .reset((yyvsp[-1].named_pexprs));
+	enum_type->base_type = IVL_VT_LOGIC;
+	enum_type->signed_flag = (yyvsp[-3].flag);
+	enum_type->range.reset(make_range_from_width(integer_width));
+	(yyval.enum_type) = enum_type;
+      }
+#line 8649 "parse.cc"
+    break;
+
+  case 254: /* enum_data_type: K_enum K_logic unsigned_signed_opt range '{' enum_name_list '}'  */
+#line 2080 "parse.y"
+      { enum_type_t*enum_type = new enum_type_t;
+	FILE_NAME(enum_type, (yylsp[-6]));
+	enum_type->names .reset((yyvsp[-1].named_pexprs));
+	enum_type->base_type = IVL_VT_LOGIC;
+	enum_type->signed_flag = (yyvsp[-4].flag);
+	enum_type->range.reset((yyvsp[-3].ranges));
+	(yyval.enum_type) = enum_type;
+      }
+#line 8662 "parse.cc"
+    break;
+
+  case 255: /* enum_data_type: K_enum K_reg unsigned_signed_opt range '{' enum_name_list '}'  */
+#line 2089 "parse.y"
+      { enum_type_t*enum_type = new enum_type_t;
+	FILE_NAME(enum_type, (yylsp[-6]));
+	enum_type->names .reset((yyvsp[-1].named_pexprs));
+	enum_type->base_type = IVL_VT_LOGIC;
+	enum_type->signed_flag = (yyvsp[-4].flag);
+	enum_type->range.reset((yyvsp[-3].ranges));
+	(yyval.enum_type) = enum_type;
+      }
+#line 8675 "parse.cc"
+    break;
+
+  case 256: /* enum_data_type: K_enum K_bit unsigned_signed_opt range '{' enum_name_list '}'  */
+#line 2098 "parse.y"
+      { enum_type_t*enum_type = new enum_type_t;
+	FILE_NAME(enum_type, (yylsp[-6]));
+	enum_type->names .reset((yyvsp[-1].named_pexprs));
+	enum_type->base_type = IVL_VT_BOOL;
+	enum_type->signed_flag = (yyvsp[-4].flag);
+	enum_type->range.reset((yyvsp[-3].ranges));
+	(yyval.enum_type) = enum_type;
+      }
+#line 8688 "parse.cc"
+    break;
+
+  case 257: /* enum_name_list: enum_name  */
+#line 2110 "parse.y"
+      { (yyval.named_pexprs) = (yyvsp[0].named_pexprs);
+      }
+#line 8695 "parse.cc"
+    break;
+
+  case 258: /* enum_name_list: enum_name_list ',' enum_name  */
+#line 2113 "parse.y"
+      { list<named_pexpr_t>*lst = (yyvsp[-2].named_pexprs);
+	lst->splice(lst->end(), *(yyvsp[0].named_pexprs));
+	delete (yyvsp[0].named_pexprs);
+	(yyval.named_pexprs) = lst;
+      }
+#line 8705 "parse.cc"
+    break;
+
+  case 259: /* pos_neg_number: number  */
+#line 2122 "parse.y"
+      { (yyval.number) = (yyvsp[0].number);
+      }
+#line 8712 "parse.cc"
+    break;
+
+  case 260: /* pos_neg_number: '-' number  */
+#line 2125 "parse.y"
+      { verinum tmp = v_not(*((yyvsp[0].number))) + verinum(1);
+	*((yyvsp[0].number)) = tmp;
+	(yyval.number) = (yyvsp[0].number);
+      }
+#line 8721 "parse.cc"
+    break;
+
+  case 261: /* enum_name: IDENTIFIER  */
+#line 2133 "parse.y"
+      { perm_string name = lex_strings.make((yyvsp[0].text));
+	delete[](yyvsp[0].text);
+	(yyval.named_pexprs) = make_named_number(name);
+      }
+#line 8730 "parse.cc"
+    break;
+
+  case 262: /* enum_name: IDENTIFIER '[' pos_neg_number ']'  */
+#line 2138 "parse.y"
+      { perm_string name = lex_strings.make((yyvsp[-3].text));
+	long count = check_enum_seq_value((yylsp[-3]), (yyvsp[-1].number), false);
+	delete[](yyvsp[-3].text);
+	(yyval.named_pexprs) = make_named_numbers(name, 0, count-1);
+	delete (yyvsp[-1].number);
+      }
+#line 8741 "parse.cc"
+    break;
+
+  case 263: /* enum_name: IDENTIFIER '[' pos_neg_number ':' pos_neg_number ']'  */
+#line 2145 "parse.y"
+      { perm_string name = lex_strings.make((yyvsp[-5].text));
+	(yyval.named_pexprs) = make_named_numbers(name, check_enum_seq_value((yylsp[-5]), (yyvsp[-3].number), true),
+	                              check_enum_seq_value((yylsp[-5]), (yyvsp[-1].number), true));
+	delete[](yyvsp[-5].text);
+	delete (yyvsp[-3].number);
+	delete (yyvsp[-1].number);
+      }
+#line 8753 "parse.cc"
+    break;
+
+  case 264: /* enum_name: IDENTIFIER '=' expression  */
+#line 2153 "parse.y"
+      { perm_string name = lex_strings.make((yyvsp[-2].text));
+	delete[](yyvsp[-2].text);
+	(yyval.named_pexprs) = make_named_number(name, (yyvsp[0].expr));
+      }
+#line 8762 "parse.cc"
+    break;
+
+  case 265: /* enum_name: IDENTIFIER '[' pos_neg_number ']' '=' expression  */
+#line 2158 "parse.y"
+      { perm_string name = lex_strings.make((yyvsp[-5].text));
+	long count = check_enum_seq_value((yylsp[-5]), (yyvsp[-3].number), false);
+	(yyval.named_pexprs) = make_named_numbers(name, 0, count-1, (yyvsp[0].expr));
+	delete[](yyvsp[-5].text);
+	delete (yyvsp[-3].number);
+      }
+#line 8773 "parse.cc"
+    break;
+
+  case 266: /* enum_name: IDENTIFIER '[' pos_neg_number ':' pos_neg_number ']' '=' expression  */
+#line 2165 "parse.y"
+      { perm_string name = lex_strings.make((yyvsp[-7].text));
+	(yyval.named_pexprs) = make_named_numbers(name, check_enum_seq_value((yylsp[-7]), (yyvsp[-5].number), true),
+	                              check_enum_seq_value((yylsp[-7]), (yyvsp[-3].number), true), (yyvsp[0].expr));
+	delete[](yyvsp[-7].text);
+	delete (yyvsp[-5].number);
+	delete (yyvsp[-3].number);
+      }
+#line 8785 "parse.cc"
+    break;
+
+  case 267: /* struct_data_type: K_struct K_packed_opt '{' struct_union_member_list '}'  */
+#line 2176 "parse.y"
+      { struct_type_t*tmp = new struct_type_t;
+	FILE_NAME(tmp, (yylsp[-4]));
+	tmp->packed_flag = (yyvsp[-3].flag);
+	tmp->members .reset((yyvsp[-1].struct_members));
+	(yyval.struct_type) = tmp;
+      }
+#line 8796 "parse.cc"
+    break;
+
+  case 268: /* struct_data_type: K_struct K_packed_opt '{' error '}'  */
+#line 2183 "parse.y"
+      { yyerror((yylsp[-1]), "error: Errors in struct/union member list.");
+	yyerrok;
+	struct_type_t*tmp = new struct_type_t;
+	FILE_NAME(tmp, (yylsp[-4]));
+	tmp->packed_flag = (yyvsp[-3].flag);
+	(yyval.struct_type) = tmp;
+      }
+#line 8808 "parse.cc"
+    break;
+
+  case 269: /* struct_union_member_list: struct_union_member_list struct_union_member  */
+#line 2194 "parse.y"
+      { list<struct_member_t*>*tmp = (yyvsp[-1].struct_members);
+	tmp->push_back((yyvsp[0].struct_member));
+	(yyval.struct_members) = tmp;
+      }
+#line 8817 "parse.cc"
+    break;
+
+  case 270: /* struct_union_member_list: struct_union_member  */
+#line 2199 "parse.y"
+      { list<struct_member_t*>*tmp = new list<struct_member_t*>;
+	tmp->push_back((yyvsp[0].struct_member));
+	(yyval.struct_members) = tmp;
+      }
+#line 8826 "parse.cc"
+    break;
+
+  case 271: /* struct_union_member: attribute_list_opt K_bit range_opt list_of_variable_decl_assignments ';'  */
+#line 2207 "parse.y"
+      { struct_member_t*tmp = new struct_member_t;
+	FILE_NAME(tmp, (yylsp[-3]));
+	tmp->type = IVL_VT_BOOL;
+	tmp->range .reset((yyvsp[-2].ranges));
+	tmp->names .reset((yyvsp[-1].decl_assignments));
+	(yyval.struct_member) = tmp;
+      }
+#line 8838 "parse.cc"
+    break;
+
+  case 272: /* struct_union_member: attribute_list_opt K_logic range_opt list_of_variable_decl_assignments ';'  */
+#line 2215 "parse.y"
+      { struct_member_t*tmp = new struct_member_t;
+	FILE_NAME(tmp, (yylsp[-3]));
+	tmp->type = IVL_VT_LOGIC;
+	tmp->range .reset((yyvsp[-2].ranges));
+	tmp->names .reset((yyvsp[-1].decl_assignments));
+	(yyval.struct_member) = tmp;
+      }
+#line 8850 "parse.cc"
+    break;
+
+  case 273: /* struct_union_member: attribute_list_opt atom2_type list_of_variable_decl_assignments ';'  */
+#line 2223 "parse.y"
+      { struct_member_t*tmp = new struct_member_t;
+	FILE_NAME(tmp, (yylsp[-2]));
+	tmp->type = IVL_VT_BOOL;
+	tmp->range .reset(make_range_from_width((yyvsp[-2].int_val)));
+	tmp->names .reset((yyvsp[-1].decl_assignments));
+	(yyval.struct_member) = tmp;
+      }
+#line 8862 "parse.cc"
+    break;
+
+  case 274: /* case_item: expression_list_proper ':' statement_or_null  */
+#line 2234 "parse.y"
+                { PCase::Item*tmp = new PCase::Item;
+		  tmp->expr = *(yyvsp[-2].exprs);
+		  tmp->stat = (yyvsp[0].statement);
+		  delete (yyvsp[-2].exprs);
+		  (yyval.citem) = tmp;
+		}
+#line 8873 "parse.cc"
+    break;
+
+  case 275: /* case_item: K_default ':' statement_or_null  */
+#line 2241 "parse.y"
+                { PCase::Item*tmp = new PCase::Item;
+		  tmp->stat = (yyvsp[0].statement);
+		  (yyval.citem) = tmp;
+		}
+#line 8882 "parse.cc"
+    break;
+
+  case 276: /* case_item: K_default statement_or_null  */
+#line 2246 "parse.y"
+                { PCase::Item*tmp = new PCase::Item;
+		  tmp->stat = (yyvsp[0].statement);
+		  (yyval.citem) = tmp;
+		}
+#line 8891 "parse.cc"
+    break;
+
+  case 277: /* case_item: error ':' statement_or_null  */
+#line 2251 "parse.y"
+                { yyerror((yylsp[-1]), "error: Incomprehensible case expression.");
+		  yyerrok;
+		}
+#line 8899 "parse.cc"
+    break;
+
+  case 278: /* case_items: case_items case_item  */
+#line 2258 "parse.y"
+                { svector<PCase::Item*>*tmp;
+		  tmp = new svector<PCase::Item*>(*(yyvsp[-1].citems), (yyvsp[0].citem));
+		  delete (yyvsp[-1].citems);
+		  (yyval.citems) = tmp;
+		}
+#line 8909 "parse.cc"
+    break;
+
+  case 279: /* case_items: case_item  */
+#line 2264 "parse.y"
+                { svector<PCase::Item*>*tmp = new svector<PCase::Item*>(1);
+		  (*tmp)[0] = (yyvsp[0].citem);
+		  (yyval.citems) = tmp;
+		}
+#line 8918 "parse.cc"
+    break;
+
+  case 285: /* defparam_assign: hierarchy_identifier '=' expression  */
+#line 2283 "parse.y"
+                { pform_set_defparam(*(yyvsp[-2].pform_name), (yyvsp[0].expr));
+		  delete (yyvsp[-2].pform_name);
+		}
+#line 8926 "parse.cc"
+    break;
+
+  case 287: /* defparam_assign_list: range defparam_assign  */
+#line 2291 "parse.y"
+                { yyerror((yylsp[-1]), "error: defparam may not include a range.");
+		  delete (yyvsp[-1].ranges);
+		}
+#line 8934 "parse.cc"
+    break;
+
+  case 289: /* delay1: '#' delay_value_simple  */
+#line 2299 "parse.y"
+                { list<PExpr*>*tmp = new list<PExpr*>;
+		  tmp->push_back((yyvsp[0].expr));
+		  (yyval.exprs) = tmp;
+		}
+#line 8943 "parse.cc"
+    break;
+
+  case 290: /* delay1: '#' '(' delay_value ')'  */
+#line 2304 "parse.y"
+                { list<PExpr*>*tmp = new list<PExpr*>;
+		  tmp->push_back((yyvsp[-1].expr));
+		  (yyval.exprs) = tmp;
+		}
+#line 8952 "parse.cc"
+    break;
+
+  case 291: /* delay3: '#' delay_value_simple  */
+#line 2312 "parse.y"
+                { list<PExpr*>*tmp = new list<PExpr*>;
+		  tmp->push_back((yyvsp[0].expr));
+		  (yyval.exprs) = tmp;
+		}
+#line 8961 "parse.cc"
+    break;
+
+  case 292: /* delay3: '#' '(' delay_value ')'  */
+#line 2317 "parse.y"
+                { list<PExpr*>*tmp = new list<PExpr*>;
+		  tmp->push_back((yyvsp[-1].expr));
+		  (yyval.exprs) = tmp;
+		}
+#line 8970 "parse.cc"
+    break;
+
+  case 293: /* delay3: '#' '(' delay_value ',' delay_value ')'  */
+#line 2322 "parse.y"
+                { list<PExpr*>*tmp = new list<PExpr*>;
+		  tmp->push_back((yyvsp[-3].expr));
+		  tmp->push_back((yyvsp[-1].expr));
+		  (yyval.exprs) = tmp;
+		}
+#line 8980 "parse.cc"
+    break;
+
+  case 294: /* delay3: '#' '(' delay_value ',' delay_value ',' delay_value ')'  */
+#line 2328 "parse.y"
+                { list<PExpr*>*tmp = new list<PExpr*>;
+		  tmp->push_back((yyvsp[-5].expr));
+		  tmp->push_back((yyvsp[-3].expr));
+		  tmp->push_back((yyvsp[-1].expr));
+		  (yyval.exprs) = tmp;
+		}
+#line 8991 "parse.cc"
+    break;
+
+  case 295: /* delay3_opt: delay3  */
+#line 2337 "parse.y"
+                 { (yyval.exprs) = (yyvsp[0].exprs); }
+#line 8997 "parse.cc"
+    break;
+
+  case 296: /* delay3_opt: %empty  */
+#line 2338 "parse.y"
+                 { (yyval.exprs) = 0; }
+#line 9003 "parse.cc"
+    break;
+
+  case 297: /* delay_value_list: delay_value  */
+#line 2343 "parse.y"
+      { list<PExpr*>*tmp = new list<PExpr*>;
+	tmp->push_back((yyvsp[0].expr));
+	(yyval.exprs) = tmp;
+      }
+#line 9012 "parse.cc"
+    break;
+
+  case 298: /* delay_value_list: delay_value_list ',' delay_value  */
+#line 2348 "parse.y"
+      { list<PExpr*>*tmp = (yyvsp[-2].exprs);
+	tmp->push_back((yyvsp[0].expr));
+	(yyval.exprs) = tmp;
+      }
+#line 9021 "parse.cc"
+    break;
+
+  case 299: /* delay_value: expression  */
+#line 2356 "parse.y"
+                { PExpr*tmp = (yyvsp[0].expr);
+		  (yyval.expr) = tmp;
+		}
+#line 9029 "parse.cc"
+    break;
+
+  case 300: /* delay_value: expression ':' expression ':' expression  */
+#line 2360 "parse.y"
+                { (yyval.expr) = pform_select_mtm_expr((yyvsp[-4].expr), (yyvsp[-2].expr), (yyvsp[0].expr)); }
+#line 9035 "parse.cc"
+    break;
+
+  case 301: /* delay_value_simple: DEC_NUMBER  */
+#line 2366 "parse.y"
+                { verinum*tmp = (yyvsp[0].number);
+		  if (tmp == 0) {
+			yyerror((yylsp[0]), "internal error: delay.");
+			(yyval.expr) = 0;
+		  } else {
+			(yyval.expr) = new PENumber(tmp);
+			FILE_NAME((yyval.expr), (yylsp[0]));
+		  }
+		  based_size = 0;
+		}
+#line 9050 "parse.cc"
+    break;
+
+  case 302: /* delay_value_simple: REALTIME  */
+#line 2377 "parse.y"
+                { verireal*tmp = (yyvsp[0].realtime);
+		  if (tmp == 0) {
+			yyerror((yylsp[0]), "internal error: delay.");
+			(yyval.expr) = 0;
+		  } else {
+			(yyval.expr) = new PEFNumber(tmp);
+			FILE_NAME((yyval.expr), (yylsp[0]));
+		  }
+		}
+#line 9064 "parse.cc"
+    break;
+
+  case 303: /* delay_value_simple: IDENTIFIER  */
+#line 2387 "parse.y"
+                { PEIdent*tmp = new PEIdent(lex_strings.make((yyvsp[0].text)));
+		  FILE_NAME(tmp, (yylsp[0]));
+		  (yyval.expr) = tmp;
+		  delete[](yyvsp[0].text);
+		}
+#line 9074 "parse.cc"
+    break;
+
+  case 304: /* delay_value_simple: TIME_LITERAL  */
+#line 2393 "parse.y"
+                { int unit;
+
+		  based_size = 0;
+		  (yyval.expr)         = 0;
+		  if ((yyvsp[0].text) == 0 || !get_time_unit((yyvsp[0].text), unit))
+			yyerror((yylsp[0]), "internal error: delay.");
+		  else {
+			double p = pow(10.0,
+			               (double)(unit - pform_get_timeunit()));
+			double time = atof((yyvsp[0].text)) * p;
+
+			verireal *v = new verireal(time);
+			(yyval.expr) = new PEFNumber(v);
+			FILE_NAME((yyval.expr), (yylsp[0]));
+		  }
+		}
+#line 9095 "parse.cc"
+    break;
+
+  case 307: /* $@17: %empty  */
+#line 2419 "parse.y"
+      { pform_start_discipline((yyvsp[-1].text)); }
+#line 9101 "parse.cc"
+    break;
+
+  case 308: /* discipline_declaration: K_discipline IDENTIFIER optional_semicolon $@17 discipline_items K_enddiscipline  */
+#line 2421 "parse.y"
+      { pform_end_discipline((yylsp[-5])); delete[] (yyvsp[-4].text); }
+#line 9107 "parse.cc"
+    break;
+
+  case 311: /* discipline_item: K_domain K_discrete ';'  */
+#line 2431 "parse.y"
+      { pform_discipline_domain((yylsp[-2]), IVL_DIS_DISCRETE); }
+#line 9113 "parse.cc"
+    break;
+
+  case 312: /* discipline_item: K_domain K_continuous ';'  */
+#line 2433 "parse.y"
+      { pform_discipline_domain((yylsp[-2]), IVL_DIS_CONTINUOUS); }
+#line 9119 "parse.cc"
+    break;
+
+  case 313: /* discipline_item: K_potential IDENTIFIER ';'  */
+#line 2435 "parse.y"
+      { pform_discipline_potential((yylsp[-2]), (yyvsp[-1].text)); delete[] (yyvsp[-1].text); }
+#line 9125 "parse.cc"
+    break;
+
+  case 314: /* discipline_item: K_flow IDENTIFIER ';'  */
+#line 2437 "parse.y"
+      { pform_discipline_flow((yylsp[-2]), (yyvsp[-1].text)); delete[] (yyvsp[-1].text); }
+#line 9131 "parse.cc"
+    break;
+
+  case 315: /* $@18: %empty  */
+#line 2442 "parse.y"
+      { pform_start_nature((yyvsp[-1].text)); }
+#line 9137 "parse.cc"
+    break;
+
+  case 316: /* nature_declaration: K_nature IDENTIFIER optional_semicolon $@18 nature_items K_endnature  */
+#line 2445 "parse.y"
+      { pform_end_nature((yylsp[-5])); delete[] (yyvsp[-4].text); }
+#line 9143 "parse.cc"
+    break;
+
+  case 319: /* nature_item: K_units '=' STRING ';'  */
+#line 2455 "parse.y"
+      { delete[] (yyvsp[-1].text); }
+#line 9149 "parse.cc"
+    break;
+
+  case 321: /* nature_item: K_access '=' IDENTIFIER ';'  */
+#line 2458 "parse.y"
+      { pform_nature_access((yylsp[-3]), (yyvsp[-1].text)); delete[] (yyvsp[-1].text); }
+#line 9155 "parse.cc"
+    break;
+
+  case 322: /* nature_item: K_idt_nature '=' IDENTIFIER ';'  */
+#line 2460 "parse.y"
+      { delete[] (yyvsp[-1].text); }
+#line 9161 "parse.cc"
+    break;
+
+  case 323: /* nature_item: K_ddt_nature '=' IDENTIFIER ';'  */
+#line 2462 "parse.y"
+      { delete[] (yyvsp[-1].text); }
+#line 9167 "parse.cc"
+    break;
+
+  case 324: /* config_declaration: K_config IDENTIFIER ';' K_design lib_cell_identifiers ';' list_of_config_rule_statements K_endconfig  */
+#line 2470 "parse.y"
+      { cerr << (yylsp[-7]) << ": sorry: config declarations are not supported and "
+                "will be skipped." << endl;
+	delete[] (yyvsp[-6].text);
+      }
+#line 9176 "parse.cc"
+    break;
+
+  case 330: /* config_rule_statement: K_instance hierarchy_identifier K_liblist list_of_libraries ';'  */
+#line 2490 "parse.y"
+      { delete (yyvsp[-3].pform_name); }
+#line 9182 "parse.cc"
+    break;
+
+  case 331: /* config_rule_statement: K_instance hierarchy_identifier K_use lib_cell_id opt_config ';'  */
+#line 2492 "parse.y"
+      { delete (yyvsp[-4].pform_name); }
+#line 9188 "parse.cc"
+    break;
+
+  case 336: /* lib_cell_id: IDENTIFIER  */
+#line 2504 "parse.y"
+      { delete[] (yyvsp[0].text); }
+#line 9194 "parse.cc"
+    break;
+
+  case 337: /* lib_cell_id: IDENTIFIER '.' IDENTIFIER  */
+#line 2506 "parse.y"
+      { delete[] (yyvsp[-2].text); delete[] (yyvsp[0].text); }
+#line 9200 "parse.cc"
+    break;
+
+  case 339: /* list_of_libraries: list_of_libraries IDENTIFIER  */
+#line 2512 "parse.y"
+      { delete[] (yyvsp[0].text); }
+#line 9206 "parse.cc"
+    break;
+
+  case 340: /* drive_strength: '(' dr_strength0 ',' dr_strength1 ')'  */
+#line 2517 "parse.y"
+                { (yyval.drive).str0 = (yyvsp[-3].drive).str0;
+		  (yyval.drive).str1 = (yyvsp[-1].drive).str1;
+		}
+#line 9214 "parse.cc"
+    break;
+
+  case 341: /* drive_strength: '(' dr_strength1 ',' dr_strength0 ')'  */
+#line 2521 "parse.y"
+                { (yyval.drive).str0 = (yyvsp[-1].drive).str0;
+		  (yyval.drive).str1 = (yyvsp[-3].drive).str1;
+		}
+#line 9222 "parse.cc"
+    break;
+
+  case 342: /* drive_strength: '(' dr_strength0 ',' K_highz1 ')'  */
+#line 2525 "parse.y"
+                { (yyval.drive).str0 = (yyvsp[-3].drive).str0;
+		  (yyval.drive).str1 = IVL_DR_HiZ;
+		}
+#line 9230 "parse.cc"
+    break;
+
+  case 343: /* drive_strength: '(' dr_strength1 ',' K_highz0 ')'  */
+#line 2529 "parse.y"
+                { (yyval.drive).str0 = IVL_DR_HiZ;
+		  (yyval.drive).str1 = (yyvsp[-3].drive).str1;
+		}
+#line 9238 "parse.cc"
+    break;
+
+  case 344: /* drive_strength: '(' K_highz1 ',' dr_strength0 ')'  */
+#line 2533 "parse.y"
+                { (yyval.drive).str0 = (yyvsp[-1].drive).str0;
+		  (yyval.drive).str1 = IVL_DR_HiZ;
+		}
+#line 9246 "parse.cc"
+    break;
+
+  case 345: /* drive_strength: '(' K_highz0 ',' dr_strength1 ')'  */
+#line 2537 "parse.y"
+                { (yyval.drive).str0 = IVL_DR_HiZ;
+		  (yyval.drive).str1 = (yyvsp[-1].drive).str1;
+		}
+#line 9254 "parse.cc"
+    break;
+
+  case 346: /* drive_strength_opt: drive_strength  */
+#line 2543 "parse.y"
+                         { (yyval.drive) = (yyvsp[0].drive); }
+#line 9260 "parse.cc"
+    break;
+
+  case 347: /* drive_strength_opt: %empty  */
+#line 2544 "parse.y"
+                         { (yyval.drive).str0 = IVL_DR_STRONG; (yyval.drive).str1 = IVL_DR_STRONG; }
+#line 9266 "parse.cc"
+    break;
+
+  case 348: /* dr_strength0: K_supply0  */
+#line 2548 "parse.y"
+                    { (yyval.drive).str0 = IVL_DR_SUPPLY; }
+#line 9272 "parse.cc"
+    break;
+
+  case 349: /* dr_strength0: K_strong0  */
+#line 2549 "parse.y"
+                    { (yyval.drive).str0 = IVL_DR_STRONG; }
+#line 9278 "parse.cc"
+    break;
+
+  case 350: /* dr_strength0: K_pull0  */
+#line 2550 "parse.y"
+                    { (yyval.drive).str0 = IVL_DR_PULL; }
+#line 9284 "parse.cc"
+    break;
+
+  case 351: /* dr_strength0: K_weak0  */
+#line 2551 "parse.y"
+                    { (yyval.drive).str0 = IVL_DR_WEAK; }
+#line 9290 "parse.cc"
+    break;
+
+  case 352: /* dr_strength1: K_supply1  */
+#line 2555 "parse.y"
+                    { (yyval.drive).str1 = IVL_DR_SUPPLY; }
+#line 9296 "parse.cc"
+    break;
+
+  case 353: /* dr_strength1: K_strong1  */
+#line 2556 "parse.y"
+                    { (yyval.drive).str1 = IVL_DR_STRONG; }
+#line 9302 "parse.cc"
+    break;
+
+  case 354: /* dr_strength1: K_pull1  */
+#line 2557 "parse.y"
+                    { (yyval.drive).str1 = IVL_DR_PULL; }
+#line 9308 "parse.cc"
+    break;
+
+  case 355: /* dr_strength1: K_weak1  */
+#line 2558 "parse.y"
+                    { (yyval.drive).str1 = IVL_DR_WEAK; }
+#line 9314 "parse.cc"
+    break;
+
+  case 356: /* event_control: '@' hierarchy_identifier  */
+#line 2563 "parse.y"
+                { PEIdent*tmpi = new PEIdent(*(yyvsp[0].pform_name));
+		  PEEvent*tmpe = new PEEvent(PEEvent::ANYEDGE, tmpi);
+		  PEventStatement*tmps = new PEventStatement(tmpe);
+		  FILE_NAME(tmps, (yylsp[-1]));
+		  (yyval.event_statement) = tmps;
+		  delete (yyvsp[0].pform_name);
+		}
+#line 9326 "parse.cc"
+    break;
+
+  case 357: /* event_control: '@' '(' event_expression_list ')'  */
+#line 2571 "parse.y"
+                { PEventStatement*tmp = new PEventStatement(*(yyvsp[-1].event_expr));
+		  FILE_NAME(tmp, (yylsp[-3]));
+		  delete (yyvsp[-1].event_expr);
+		  (yyval.event_statement) = tmp;
+		}
+#line 9336 "parse.cc"
+    break;
+
+  case 358: /* event_control: '@' '(' error ')'  */
+#line 2577 "parse.y"
+                { yyerror((yylsp[-3]), "error: Malformed event control expression.");
+		  (yyval.event_statement) = 0;
+		}
+#line 9344 "parse.cc"
+    break;
+
+  case 359: /* event_expression_list: event_expression  */
+#line 2584 "parse.y"
+                { (yyval.event_expr) = (yyvsp[0].event_expr); }
+#line 9350 "parse.cc"
+    break;
+
+  case 360: /* event_expression_list: event_expression_list K_or event_expression  */
+#line 2586 "parse.y"
+                { svector<PEEvent*>*tmp = new svector<PEEvent*>(*(yyvsp[-2].event_expr), *(yyvsp[0].event_expr));
+		  delete (yyvsp[-2].event_expr);
+		  delete (yyvsp[0].event_expr);
+		  (yyval.event_expr) = tmp;
+		}
+#line 9360 "parse.cc"
+    break;
+
+  case 361: /* event_expression_list: event_expression_list ',' event_expression  */
+#line 2592 "parse.y"
+                { svector<PEEvent*>*tmp = new svector<PEEvent*>(*(yyvsp[-2].event_expr), *(yyvsp[0].event_expr));
+		  delete (yyvsp[-2].event_expr);
+		  delete (yyvsp[0].event_expr);
+		  (yyval.event_expr) = tmp;
+		}
+#line 9370 "parse.cc"
+    break;
+
+  case 362: /* event_expression: K_posedge expression  */
+#line 2601 "parse.y"
+                { PEEvent*tmp = new PEEvent(PEEvent::POSEDGE, (yyvsp[0].expr));
+		  FILE_NAME(tmp, (yylsp[-1]));
+		  svector<PEEvent*>*tl = new svector<PEEvent*>(1);
+		  (*tl)[0] = tmp;
+		  (yyval.event_expr) = tl;
+		}
+#line 9381 "parse.cc"
+    break;
+
+  case 363: /* event_expression: K_negedge expression  */
+#line 2608 "parse.y"
+                { PEEvent*tmp = new PEEvent(PEEvent::NEGEDGE, (yyvsp[0].expr));
+		  FILE_NAME(tmp, (yylsp[-1]));
+		  svector<PEEvent*>*tl = new svector<PEEvent*>(1);
+		  (*tl)[0] = tmp;
+		  (yyval.event_expr) = tl;
+		}
+#line 9392 "parse.cc"
+    break;
+
+  case 364: /* event_expression: expression  */
+#line 2615 "parse.y"
+                { PEEvent*tmp = new PEEvent(PEEvent::ANYEDGE, (yyvsp[0].expr));
+		  FILE_NAME(tmp, (yylsp[0]));
+		  svector<PEEvent*>*tl = new svector<PEEvent*>(1);
+		  (*tl)[0] = tmp;
+		  (yyval.event_expr) = tl;
+		}
+#line 9403 "parse.cc"
+    break;
+
+  case 365: /* branch_probe_expression: IDENTIFIER '(' IDENTIFIER ',' IDENTIFIER ')'  */
+#line 2629 "parse.y"
+      { (yyval.expr) = pform_make_branch_probe_expression((yylsp[-5]), (yyvsp[-5].text), (yyvsp[-3].text), (yyvsp[-1].text)); }
+#line 9409 "parse.cc"
+    break;
+
+  case 366: /* branch_probe_expression: IDENTIFIER '(' IDENTIFIER ')'  */
+#line 2631 "parse.y"
+      { (yyval.expr) = pform_make_branch_probe_expression((yylsp[-3]), (yyvsp[-3].text), (yyvsp[-1].text)); }
+#line 9415 "parse.cc"
+    break;
+
+  case 367: /* expression: expr_primary  */
+#line 2636 "parse.y"
+      { (yyval.expr) = (yyvsp[0].expr); }
+#line 9421 "parse.cc"
+    break;
+
+  case 368: /* expression: inc_or_dec_expression  */
+#line 2638 "parse.y"
+      { (yyval.expr) = (yyvsp[0].expr); }
+#line 9427 "parse.cc"
+    break;
+
+  case 369: /* expression: inside_expression  */
+#line 2640 "parse.y"
+      { (yyval.expr) = (yyvsp[0].expr); }
+#line 9433 "parse.cc"
+    break;
+
+  case 370: /* expression: '+' expr_primary  */
+#line 2642 "parse.y"
+                { (yyval.expr) = (yyvsp[0].expr); }
+#line 9439 "parse.cc"
+    break;
+
+  case 371: /* expression: '-' expr_primary  */
+#line 2644 "parse.y"
+                { PEUnary*tmp = new PEUnary('-', (yyvsp[0].expr));
+		  FILE_NAME(tmp, (yylsp[0]));
+		  (yyval.expr) = tmp;
+		}
+#line 9448 "parse.cc"
+    break;
+
+  case 372: /* expression: '~' expr_primary  */
+#line 2649 "parse.y"
+                { PEUnary*tmp = new PEUnary('~', (yyvsp[0].expr));
+		  FILE_NAME(tmp, (yylsp[0]));
+		  (yyval.expr) = tmp;
+		}
+#line 9457 "parse.cc"
+    break;
+
+  case 373: /* expression: '&' expr_primary  */
+#line 2654 "parse.y"
+                { PEUnary*tmp = new PEUnary('&', (yyvsp[0].expr));
+		  FILE_NAME(tmp, (yylsp[0]));
+		  (yyval.expr) = tmp;
+		}
+#line 9466 "parse.cc"
+    break;
+
+  case 374: /* expression: '!' expr_primary  */
+#line 2659 "parse.y"
+                { PEUnary*tmp = new PEUnary('!', (yyvsp[0].expr));
+		  FILE_NAME(tmp, (yylsp[0]));
+		  (yyval.expr) = tmp;
+		}
+#line 9475 "parse.cc"
+    break;
+
+  case 375: /* expression: '|' expr_primary  */
+#line 2664 "parse.y"
+                { PEUnary*tmp = new PEUnary('|', (yyvsp[0].expr));
+		  FILE_NAME(tmp, (yylsp[0]));
+		  (yyval.expr) = tmp;
+		}
+#line 9484 "parse.cc"
+    break;
+
+  case 376: /* expression: '^' expr_primary  */
+#line 2669 "parse.y"
+                { PEUnary*tmp = new PEUnary('^', (yyvsp[0].expr));
+		  FILE_NAME(tmp, (yylsp[0]));
+		  (yyval.expr) = tmp;
+		}
+#line 9493 "parse.cc"
+    break;
+
+  case 377: /* expression: '~' '&' expr_primary  */
+#line 2674 "parse.y"
+                { yyerror((yylsp[-2]), "error: '~' '&'  is not a valid expression. "
+			  "Please use operator '~&' instead.");
+		  (yyval.expr) = 0;
+		}
+#line 9502 "parse.cc"
+    break;
+
+  case 378: /* expression: '~' '|' expr_primary  */
+#line 2679 "parse.y"
+                { yyerror((yylsp[-2]), "error: '~' '|'  is not a valid expression. "
+			  "Please use operator '~|' instead.");
+		  (yyval.expr) = 0;
+		}
+#line 9511 "parse.cc"
+    break;
+
+  case 379: /* expression: '~' '^' expr_primary  */
+#line 2684 "parse.y"
+                { yyerror((yylsp[-2]), "error: '~' '^'  is not a valid expression. "
+			  "Please use operator '~^' instead.");
+		  (yyval.expr) = 0;
+		}
+#line 9520 "parse.cc"
+    break;
+
+  case 380: /* expression: K_NAND expr_primary  */
+#line 2689 "parse.y"
+                { PEUnary*tmp = new PEUnary('A', (yyvsp[0].expr));
+		  FILE_NAME(tmp, (yylsp[0]));
+		  (yyval.expr) = tmp;
+		}
+#line 9529 "parse.cc"
+    break;
+
+  case 381: /* expression: K_NOR expr_primary  */
+#line 2694 "parse.y"
+                { PEUnary*tmp = new PEUnary('N', (yyvsp[0].expr));
+		  FILE_NAME(tmp, (yylsp[0]));
+		  (yyval.expr) = tmp;
+		}
+#line 9538 "parse.cc"
+    break;
+
+  case 382: /* expression: K_NXOR expr_primary  */
+#line 2699 "parse.y"
+                { PEUnary*tmp = new PEUnary('X', (yyvsp[0].expr));
+		  FILE_NAME(tmp, (yylsp[0]));
+		  (yyval.expr) = tmp;
+		}
+#line 9547 "parse.cc"
+    break;
+
+  case 383: /* expression: '!' error  */
+#line 2704 "parse.y"
+                { yyerror((yylsp[-1]), "error: Operand of unary ! "
+			  "is not a primary expression.");
+		  (yyval.expr) = 0;
+		}
+#line 9556 "parse.cc"
+    break;
+
+  case 384: /* expression: '^' error  */
+#line 2709 "parse.y"
+                { yyerror((yylsp[-1]), "error: Operand of reduction ^ "
+			  "is not a primary expression.");
+		  (yyval.expr) = 0;
+		}
+#line 9565 "parse.cc"
+    break;
+
+  case 385: /* expression: expression '^' expression  */
+#line 2714 "parse.y"
+                { PEBinary*tmp = new PEBinary('^', (yyvsp[-2].expr), (yyvsp[0].expr));
+		  FILE_NAME(tmp, (yylsp[-1]));
+		  (yyval.expr) = tmp;
+		}
+#line 9574 "parse.cc"
+    break;
+
+  case 386: /* expression: expression K_POW expression  */
+#line 2719 "parse.y"
+                { PEBinary*tmp = new PEBPower('p', (yyvsp[-2].expr), (yyvsp[0].expr));
+		  FILE_NAME(tmp, (yylsp[-1]));
+		  (yyval.expr) = tmp;
+		}
+#line 9583 "parse.cc"
+    break;
+
+  case 387: /* expression: expression '*' expression  */
+#line 2724 "parse.y"
+                { PEBinary*tmp = new PEBinary('*', (yyvsp[-2].expr), (yyvsp[0].expr));
+		  FILE_NAME(tmp, (yylsp[-1]));
+		  (yyval.expr) = tmp;
+		}
+#line 9592 "parse.cc"
+    break;
+
+  case 388: /* expression: expression '/' expression  */
+#line 2729 "parse.y"
+                { PEBinary*tmp = new PEBinary('/', (yyvsp[-2].expr), (yyvsp[0].expr));
+		  FILE_NAME(tmp, (yylsp[-1]));
+		  (yyval.expr) = tmp;
+		}
+#line 9601 "parse.cc"
+    break;
+
+  case 389: /* expression: expression '%' expression  */
+#line 2734 "parse.y"
+                { PEBinary*tmp = new PEBinary('%', (yyvsp[-2].expr), (yyvsp[0].expr));
+		  FILE_NAME(tmp, (yylsp[-1]));
+		  (yyval.expr) = tmp;
+		}
+#line 9610 "parse.cc"
+    break;
+
+  case 390: /* expression: expression '+' expression  */
+#line 2739 "parse.y"
+                { PEBinary*tmp = new PEBinary('+', (yyvsp[-2].expr), (yyvsp[0].expr));
+		  FILE_NAME(tmp, (yylsp[-1]));
+		  (yyval.expr) = tmp;
+		}
+#line 9619 "parse.cc"
+    break;
+
+  case 391: /* expression: expression '-' expression  */
+#line 2744 "parse.y"
+                { PEBinary*tmp = new PEBinary('-', (yyvsp[-2].expr), (yyvsp[0].expr));
+		  FILE_NAME(tmp, (yylsp[-1]));
+		  (yyval.expr) = tmp;
+		}
+#line 9628 "parse.cc"
+    break;
+
+  case 392: /* expression: expression '&' expression  */
+#line 2749 "parse.y"
+                { PEBinary*tmp = new PEBinary('&', (yyvsp[-2].expr), (yyvsp[0].expr));
+		  FILE_NAME(tmp, (yylsp[-1]));
+		  (yyval.expr) = tmp;
+		}
+#line 9637 "parse.cc"
+    break;
+
+  case 393: /* expression: expression '|' expression  */
+#line 2754 "parse.y"
+                { PEBinary*tmp = new PEBinary('|', (yyvsp[-2].expr), (yyvsp[0].expr));
+		  FILE_NAME(tmp, (yylsp[-1]));
+		  (yyval.expr) = tmp;
+		}
+#line 9646 "parse.cc"
+    break;
+
+  case 394: /* expression: expression K_NAND expression  */
+#line 2759 "parse.y"
+                { PEBinary*tmp = new PEBinary('A', (yyvsp[-2].expr), (yyvsp[0].expr));
+		  FILE_NAME(tmp, (yylsp[-1]));
+		  (yyval.expr) = tmp;
+		}
+#line 9655 "parse.cc"
+    break;
+
+  case 395: /* expression: expression K_NOR expression  */
+#line 2764 "parse.y"
+                { PEBinary*tmp = new PEBinary('O', (yyvsp[-2].expr), (yyvsp[0].expr));
+		  FILE_NAME(tmp, (yylsp[-1]));
+		  (yyval.expr) = tmp;
+		}
+#line 9664 "parse.cc"
+    break;
+
+  case 396: /* expression: expression K_NXOR expression  */
+#line 2769 "parse.y"
+                { PEBinary*tmp = new PEBinary('X', (yyvsp[-2].expr), (yyvsp[0].expr));
+		  FILE_NAME(tmp, (yylsp[-1]));
+		  (yyval.expr) = tmp;
+		}
+#line 9673 "parse.cc"
+    break;
+
+  case 397: /* expression: expression '<' expression  */
+#line 2774 "parse.y"
+                { PEBinary*tmp = new PEBComp('<', (yyvsp[-2].expr), (yyvsp[0].expr));
+		  FILE_NAME(tmp, (yylsp[-1]));
+		  (yyval.expr) = tmp;
+		}
+#line 9682 "parse.cc"
+    break;
+
+  case 398: /* expression: expression '>' expression  */
+#line 2779 "parse.y"
+                { PEBinary*tmp = new PEBComp('>', (yyvsp[-2].expr), (yyvsp[0].expr));
+		  FILE_NAME(tmp, (yylsp[-1]));
+		  (yyval.expr) = tmp;
+		}
+#line 9691 "parse.cc"
+    break;
+
+  case 399: /* expression: expression K_LS expression  */
+#line 2784 "parse.y"
+                { PEBinary*tmp = new PEBShift('l', (yyvsp[-2].expr), (yyvsp[0].expr));
+		  FILE_NAME(tmp, (yylsp[-1]));
+		  (yyval.expr) = tmp;
+		}
+#line 9700 "parse.cc"
+    break;
+
+  case 400: /* expression: expression K_RS expression  */
+#line 2789 "parse.y"
+                { PEBinary*tmp = new PEBShift('r', (yyvsp[-2].expr), (yyvsp[0].expr));
+		  FILE_NAME(tmp, (yylsp[-1]));
+		  (yyval.expr) = tmp;
+		}
+#line 9709 "parse.cc"
+    break;
+
+  case 401: /* expression: expression K_RSS expression  */
+#line 2794 "parse.y"
+                { PEBinary*tmp = new PEBShift('R', (yyvsp[-2].expr), (yyvsp[0].expr));
+		  FILE_NAME(tmp, (yylsp[-1]));
+		  (yyval.expr) = tmp;
+		}
+#line 9718 "parse.cc"
+    break;
+
+  case 402: /* expression: expression K_EQ expression  */
+#line 2799 "parse.y"
+                { PEBinary*tmp = new PEBComp('e', (yyvsp[-2].expr), (yyvsp[0].expr));
+		  FILE_NAME(tmp, (yylsp[-1]));
+		  (yyval.expr) = tmp;
+		}
+#line 9727 "parse.cc"
+    break;
+
+  case 403: /* expression: expression K_CEQ expression  */
+#line 2804 "parse.y"
+                { PEBinary*tmp = new PEBComp('E', (yyvsp[-2].expr), (yyvsp[0].expr));
+		  FILE_NAME(tmp, (yylsp[-1]));
+		  (yyval.expr) = tmp;
+		}
+#line 9736 "parse.cc"
+    break;
+
+  case 404: /* expression: expression K_LE expression  */
+#line 2809 "parse.y"
+                { PEBinary*tmp = new PEBComp('L', (yyvsp[-2].expr), (yyvsp[0].expr));
+		  FILE_NAME(tmp, (yylsp[-1]));
+		  (yyval.expr) = tmp;
+		}
+#line 9745 "parse.cc"
+    break;
+
+  case 405: /* expression: expression K_GE expression  */
+#line 2814 "parse.y"
+                { PEBinary*tmp = new PEBComp('G', (yyvsp[-2].expr), (yyvsp[0].expr));
+		  FILE_NAME(tmp, (yylsp[-1]));
+		  (yyval.expr) = tmp;
+		}
+#line 9754 "parse.cc"
+    break;
+
+  case 406: /* expression: expression K_NE expression  */
+#line 2819 "parse.y"
+                { PEBinary*tmp = new PEBComp('n', (yyvsp[-2].expr), (yyvsp[0].expr));
+		  FILE_NAME(tmp, (yylsp[-1]));
+		  (yyval.expr) = tmp;
+		}
+#line 9763 "parse.cc"
+    break;
+
+  case 407: /* expression: expression K_CNE expression  */
+#line 2824 "parse.y"
+                { PEBinary*tmp = new PEBComp('N', (yyvsp[-2].expr), (yyvsp[0].expr));
+		  FILE_NAME(tmp, (yylsp[-1]));
+		  (yyval.expr) = tmp;
+		}
+#line 9772 "parse.cc"
+    break;
+
+  case 408: /* expression: expression K_LOR expression  */
+#line 2829 "parse.y"
+                { PEBinary*tmp = new PEBLogic('o', (yyvsp[-2].expr), (yyvsp[0].expr));
+		  FILE_NAME(tmp, (yylsp[-1]));
+		  (yyval.expr) = tmp;
+		}
+#line 9781 "parse.cc"
+    break;
+
+  case 409: /* expression: expression K_LAND expression  */
+#line 2834 "parse.y"
+                { PEBinary*tmp = new PEBLogic('a', (yyvsp[-2].expr), (yyvsp[0].expr));
+		  FILE_NAME(tmp, (yylsp[-1]));
+		  (yyval.expr) = tmp;
+		}
+#line 9790 "parse.cc"
+    break;
+
+  case 410: /* expression: expression '?' expression ':' expression  */
+#line 2839 "parse.y"
+                { PETernary*tmp = new PETernary((yyvsp[-4].expr), (yyvsp[-2].expr), (yyvsp[0].expr));
+		  FILE_NAME(tmp, (yylsp[-3]));
+		  (yyval.expr) = tmp;
+		}
+#line 9799 "parse.cc"
+    break;
+
+  case 411: /* expr_mintypmax: expression  */
+#line 2847 "parse.y"
+                { (yyval.expr) = (yyvsp[0].expr); }
+#line 9805 "parse.cc"
+    break;
+
+  case 412: /* expr_mintypmax: expression ':' expression ':' expression  */
+#line 2849 "parse.y"
+                { switch (min_typ_max_flag) {
+		      case MIN:
+			(yyval.expr) = (yyvsp[-4].expr);
+			delete (yyvsp[-2].expr);
+			delete (yyvsp[0].expr);
+			break;
+		      case TYP:
+			delete (yyvsp[-4].expr);
+			(yyval.expr) = (yyvsp[-2].expr);
+			delete (yyvsp[0].expr);
+			break;
+		      case MAX:
+			delete (yyvsp[-4].expr);
+			delete (yyvsp[-2].expr);
+			(yyval.expr) = (yyvsp[0].expr);
+			break;
+		  }
+		  if (min_typ_max_warn > 0) {
+		        cerr << (yyval.expr)->get_fileline() << ": warning: choosing ";
+		        switch (min_typ_max_flag) {
+		            case MIN:
+		              cerr << "min";
+		              break;
+		            case TYP:
+		              cerr << "typ";
+		              break;
+		            case MAX:
+		              cerr << "max";
+		              break;
+		        }
+		        cerr << " expression." << endl;
+		        min_typ_max_warn -= 1;
+		  }
+		}
+#line 9844 "parse.cc"
+    break;
+
+  case 413: /* expression_list_with_nuls: expression_list_with_nuls ',' expression  */
+#line 2896 "parse.y"
+      { list<PExpr*>*tmp = (yyvsp[-2].exprs);
+	tmp->push_back((yyvsp[0].expr));
+	(yyval.exprs) = tmp;
+      }
+#line 9853 "parse.cc"
+    break;
+
+  case 414: /* expression_list_with_nuls: expression  */
+#line 2901 "parse.y"
+      { list<PExpr*>*tmp = new list<PExpr*>;
+	tmp->push_back((yyvsp[0].expr));
+	(yyval.exprs) = tmp;
+      }
+#line 9862 "parse.cc"
+    break;
+
+  case 415: /* expression_list_with_nuls: %empty  */
+#line 2906 "parse.y"
+      { list<PExpr*>*tmp = new list<PExpr*>;
+        tmp->push_back(0);
+	(yyval.exprs) = tmp;
+      }
+#line 9871 "parse.cc"
+    break;
+
+  case 416: /* expression_list_with_nuls: expression_list_with_nuls ','  */
+#line 2911 "parse.y"
+      { list<PExpr*>*tmp = (yyvsp[-1].exprs);
+	tmp->push_back(0);
+	(yyval.exprs) = tmp;
+      }
+#line 9880 "parse.cc"
+    break;
+
+  case 417: /* expression_list_proper: expression_list_proper ',' expression  */
+#line 2919 "parse.y"
+      { list<PExpr*>*tmp = (yyvsp[-2].exprs);
+        tmp->push_back((yyvsp[0].expr));
+        (yyval.exprs) = tmp;
+      }
+#line 9889 "parse.cc"
+    break;
+
+  case 418: /* expression_list_proper: expression  */
+#line 2924 "parse.y"
+      { list<PExpr*>*tmp = new list<PExpr*>;
+	tmp->push_back((yyvsp[0].expr));
+	(yyval.exprs) = tmp;
+      }
+#line 9898 "parse.cc"
+    break;
+
+  case 419: /* expr_primary: number  */
+#line 2932 "parse.y"
+      { assert((yyvsp[0].number));
+	PENumber*tmp = new PENumber((yyvsp[0].number));
+	FILE_NAME(tmp, (yylsp[0]));
+	(yyval.expr) = tmp;
+      }
+#line 9908 "parse.cc"
+    break;
+
+  case 420: /* expr_primary: REALTIME  */
+#line 2938 "parse.y"
+      { PEFNumber*tmp = new PEFNumber((yyvsp[0].realtime));
+	FILE_NAME(tmp, (yylsp[0]));
+	(yyval.expr) = tmp;
+      }
+#line 9917 "parse.cc"
+    break;
+
+  case 421: /* expr_primary: STRING  */
+#line 2943 "parse.y"
+      { PEString*tmp = new PEString((yyvsp[0].text));
+	FILE_NAME(tmp, (yylsp[0]));
+	(yyval.expr) = tmp;
+      }
+#line 9926 "parse.cc"
+    break;
+
+  case 422: /* expr_primary: SYSTEM_IDENTIFIER  */
+#line 2948 "parse.y"
+      { perm_string tn = lex_strings.make((yyvsp[0].text));
+	PECallFunction*tmp = new PECallFunction(tn);
+	FILE_NAME(tmp, (yylsp[0]));
+	(yyval.expr) = tmp;
+	delete[](yyvsp[0].text);
+      }
+#line 9937 "parse.cc"
+    break;
+
+  case 423: /* expr_primary: hierarchy_identifier  */
+#line 2959 "parse.y"
+      { PEIdent*tmp = pform_new_ident(*(yyvsp[0].pform_name));
+	FILE_NAME(tmp, (yylsp[0]));
+	(yyval.expr) = tmp;
+	delete (yyvsp[0].pform_name);
+      }
+#line 9947 "parse.cc"
+    break;
+
+  case 424: /* expr_primary: IDENTIFIER K_SCOPE_RES IDENTIFIER  */
+#line 2966 "parse.y"
+      { (yyval.expr) = pform_package_ident((yylsp[0]), (yyvsp[-2].text), (yyvsp[0].text)); }
+#line 9953 "parse.cc"
+    break;
+
+  case 425: /* expr_primary: hierarchy_identifier '(' expression_list_proper ')'  */
+#line 2973 "parse.y"
+      { PECallFunction*tmp = new PECallFunction(*(yyvsp[-3].pform_name), *(yyvsp[-1].exprs));
+	FILE_NAME(tmp, (yylsp[-3]));
+	delete (yyvsp[-3].pform_name);
+	(yyval.expr) = tmp;
+      }
+#line 9963 "parse.cc"
+    break;
+
+  case 426: /* expr_primary: SYSTEM_IDENTIFIER '(' expression_list_proper ')'  */
+#line 2979 "parse.y"
+      { perm_string tn = lex_strings.make((yyvsp[-3].text));
+	PECallFunction*tmp = new PECallFunction(tn, *(yyvsp[-1].exprs));
+	FILE_NAME(tmp, (yylsp[-3]));
+	delete[](yyvsp[-3].text);
+	(yyval.expr) = tmp;
+      }
+#line 9974 "parse.cc"
+    break;
+
+  case 427: /* expr_primary: hierarchy_identifier '(' ')'  */
+#line 2986 "parse.y"
+      { const vector<PExpr*> empty;
+	PECallFunction*tmp = new PECallFunction(*(yyvsp[-2].pform_name), empty);
+	FILE_NAME(tmp, (yylsp[-2]));
+	delete (yyvsp[-2].pform_name);
+	(yyval.expr) = tmp;
+	if (!gn_system_verilog()) {
+	      yyerror((yylsp[-2]), "error: Empty function argument list requires SystemVerilog.");
+	}
+      }
+#line 9988 "parse.cc"
+    break;
+
+  case 428: /* expr_primary: SYSTEM_IDENTIFIER '(' ')'  */
+#line 2996 "parse.y"
+      { perm_string tn = lex_strings.make((yyvsp[-2].text));
+	const vector<PExpr*>empty;
+	PECallFunction*tmp = new PECallFunction(tn, empty);
+	FILE_NAME(tmp, (yylsp[-2]));
+	delete[](yyvsp[-2].text);
+	(yyval.expr) = tmp;
+	if (!gn_system_verilog()) {
+	      yyerror((yylsp[-2]), "error: Empty function argument list requires SystemVerilog.");
+	}
+      }
+#line 10003 "parse.cc"
+    break;
+
+  case 429: /* expr_primary: implicit_class_handle  */
+#line 3008 "parse.y"
+      { yyerror((yylsp[0]), "sorry: Implicit class handles (this/super) are not supported.");
+	(yyval.expr) = 0;
+      }
+#line 10011 "parse.cc"
+    break;
+
+  case 430: /* expr_primary: implicit_class_handle '.' hierarchy_identifier  */
+#line 3013 "parse.y"
+      { yyerror((yylsp[-2]), "sorry: Implicit class handles (this/super) are not supported.");
+	(yyval.expr) = 0;
+      }
+#line 10019 "parse.cc"
+    break;
+
+  case 431: /* expr_primary: K_acos '(' expression ')'  */
+#line 3021 "parse.y"
+      { perm_string tn = perm_string::literal("$acos");
+	PECallFunction*tmp = make_call_function(tn, (yyvsp[-1].expr));
+	FILE_NAME(tmp,(yylsp[-3]));
+	(yyval.expr) = tmp;
+      }
+#line 10029 "parse.cc"
+    break;
+
+  case 432: /* expr_primary: K_acosh '(' expression ')'  */
+#line 3028 "parse.y"
+      { perm_string tn = perm_string::literal("$acosh");
+	PECallFunction*tmp = make_call_function(tn, (yyvsp[-1].expr));
+	FILE_NAME(tmp,(yylsp[-3]));
+	(yyval.expr) = tmp;
+      }
+#line 10039 "parse.cc"
+    break;
+
+  case 433: /* expr_primary: K_asin '(' expression ')'  */
+#line 3035 "parse.y"
+      { perm_string tn = perm_string::literal("$asin");
+	PECallFunction*tmp = make_call_function(tn, (yyvsp[-1].expr));
+	FILE_NAME(tmp,(yylsp[-3]));
+	(yyval.expr) = tmp;
+      }
+#line 10049 "parse.cc"
+    break;
+
+  case 434: /* expr_primary: K_asinh '(' expression ')'  */
+#line 3042 "parse.y"
+      { perm_string tn = perm_string::literal("$asinh");
+	PECallFunction*tmp = make_call_function(tn, (yyvsp[-1].expr));
+	FILE_NAME(tmp,(yylsp[-3]));
+	(yyval.expr) = tmp;
+      }
+#line 10059 "parse.cc"
+    break;
+
+  case 435: /* expr_primary: K_atan '(' expression ')'  */
+#line 3049 "parse.y"
+      { perm_string tn = perm_string::literal("$atan");
+	PECallFunction*tmp = make_call_function(tn, (yyvsp[-1].expr));
+	FILE_NAME(tmp,(yylsp[-3]));
+	(yyval.expr) = tmp;
+      }
+#line 10069 "parse.cc"
+    break;
+
+  case 436: /* expr_primary: K_atanh '(' expression ')'  */
+#line 3056 "parse.y"
+      { perm_string tn = perm_string::literal("$atanh");
+	PECallFunction*tmp = make_call_function(tn, (yyvsp[-1].expr));
+	FILE_NAME(tmp,(yylsp[-3]));
+	(yyval.expr) = tmp;
+      }
+#line 10079 "parse.cc"
+    break;
+
+  case 437: /* expr_primary: K_atan2 '(' expression ',' expression ')'  */
+#line 3063 "parse.y"
+      { perm_string tn = perm_string::literal("$atan2");
+	PECallFunction*tmp = make_call_function(tn, (yyvsp[-3].expr), (yyvsp[-1].expr));
+	FILE_NAME(tmp,(yylsp[-5]));
+	(yyval.expr) = tmp;
+      }
+#line 10089 "parse.cc"
+    break;
+
+  case 438: /* expr_primary: K_ceil '(' expression ')'  */
+#line 3070 "parse.y"
+      { perm_string tn = perm_string::literal("$ceil");
+	PECallFunction*tmp = make_call_function(tn, (yyvsp[-1].expr));
+	FILE_NAME(tmp,(yylsp[-3]));
+	(yyval.expr) = tmp;
+      }
+#line 10099 "parse.cc"
+    break;
+
+  case 439: /* expr_primary: K_cos '(' expression ')'  */
+#line 3077 "parse.y"
+      { perm_string tn = perm_string::literal("$cos");
+	PECallFunction*tmp = make_call_function(tn, (yyvsp[-1].expr));
+	FILE_NAME(tmp,(yylsp[-3]));
+	(yyval.expr) = tmp;
+      }
+#line 10109 "parse.cc"
+    break;
+
+  case 440: /* expr_primary: K_cosh '(' expression ')'  */
+#line 3084 "parse.y"
+      { perm_string tn = perm_string::literal("$cosh");
+	PECallFunction*tmp = make_call_function(tn, (yyvsp[-1].expr));
+	FILE_NAME(tmp,(yylsp[-3]));
+	(yyval.expr) = tmp;
+      }
+#line 10119 "parse.cc"
+    break;
+
+  case 441: /* expr_primary: K_exp '(' expression ')'  */
+#line 3091 "parse.y"
+      { perm_string tn = perm_string::literal("$exp");
+	PECallFunction*tmp = make_call_function(tn, (yyvsp[-1].expr));
+	FILE_NAME(tmp,(yylsp[-3]));
+	(yyval.expr) = tmp;
+      }
+#line 10129 "parse.cc"
+    break;
+
+  case 442: /* expr_primary: K_floor '(' expression ')'  */
+#line 3098 "parse.y"
+      { perm_string tn = perm_string::literal("$floor");
+	PECallFunction*tmp = make_call_function(tn, (yyvsp[-1].expr));
+	FILE_NAME(tmp,(yylsp[-3]));
+	(yyval.expr) = tmp;
+      }
+#line 10139 "parse.cc"
+    break;
+
+  case 443: /* expr_primary: K_hypot '(' expression ',' expression ')'  */
+#line 3105 "parse.y"
+      { perm_string tn = perm_string::literal("$hypot");
+	PECallFunction*tmp = make_call_function(tn, (yyvsp[-3].expr), (yyvsp[-1].expr));
+	FILE_NAME(tmp,(yylsp[-5]));
+	(yyval.expr) = tmp;
+      }
+#line 10149 "parse.cc"
+    break;
+
+  case 444: /* expr_primary: K_ln '(' expression ')'  */
+#line 3112 "parse.y"
+      { perm_string tn = perm_string::literal("$ln");
+	PECallFunction*tmp = make_call_function(tn, (yyvsp[-1].expr));
+	FILE_NAME(tmp,(yylsp[-3]));
+	(yyval.expr) = tmp;
+      }
+#line 10159 "parse.cc"
+    break;
+
+  case 445: /* expr_primary: K_log '(' expression ')'  */
+#line 3119 "parse.y"
+      { perm_string tn = perm_string::literal("$log10");
+	PECallFunction*tmp = make_call_function(tn, (yyvsp[-1].expr));
+	FILE_NAME(tmp,(yylsp[-3]));
+	(yyval.expr) = tmp;
+      }
+#line 10169 "parse.cc"
+    break;
+
+  case 446: /* expr_primary: K_pow '(' expression ',' expression ')'  */
+#line 3126 "parse.y"
+      { perm_string tn = perm_string::literal("$pow");
+        PECallFunction*tmp = make_call_function(tn, (yyvsp[-3].expr), (yyvsp[-1].expr));
+	FILE_NAME(tmp,(yylsp[-5]));
+	(yyval.expr) = tmp;
+      }
+#line 10179 "parse.cc"
+    break;
+
+  case 447: /* expr_primary: K_sin '(' expression ')'  */
+#line 3133 "parse.y"
+      { perm_string tn = perm_string::literal("$sin");
+	PECallFunction*tmp = make_call_function(tn, (yyvsp[-1].expr));
+	FILE_NAME(tmp,(yylsp[-3]));
+	(yyval.expr) = tmp;
+      }
+#line 10189 "parse.cc"
+    break;
+
+  case 448: /* expr_primary: K_sinh '(' expression ')'  */
+#line 3140 "parse.y"
+      { perm_string tn = perm_string::literal("$sinh");
+	PECallFunction*tmp = make_call_function(tn, (yyvsp[-1].expr));
+	FILE_NAME(tmp,(yylsp[-3]));
+	(yyval.expr) = tmp;
+      }
+#line 10199 "parse.cc"
+    break;
+
+  case 449: /* expr_primary: K_sqrt '(' expression ')'  */
+#line 3147 "parse.y"
+      { perm_string tn = perm_string::literal("$sqrt");
+	PECallFunction*tmp = make_call_function(tn, (yyvsp[-1].expr));
+	FILE_NAME(tmp,(yylsp[-3]));
+	(yyval.expr) = tmp;
+      }
+#line 10209 "parse.cc"
+    break;
+
+  case 450: /* expr_primary: K_tan '(' expression ')'  */
+#line 3154 "parse.y"
+      { perm_string tn = perm_string::literal("$tan");
+	PECallFunction*tmp = make_call_function(tn, (yyvsp[-1].expr));
+	FILE_NAME(tmp,(yylsp[-3]));
+	(yyval.expr) = tmp;
+      }
+#line 10219 "parse.cc"
+    break;
+
+  case 451: /* expr_primary: K_tanh '(' expression ')'  */
+#line 3161 "parse.y"
+      { perm_string tn = perm_string::literal("$tanh");
+	PECallFunction*tmp = make_call_function(tn, (yyvsp[-1].expr));
+	FILE_NAME(tmp,(yylsp[-3]));
+	(yyval.expr) = tmp;
+      }
+#line 10229 "parse.cc"
+    break;
+
+  case 452: /* expr_primary: K_abs '(' expression ')'  */
+#line 3172 "parse.y"
+      { PEUnary*tmp = new PEUnary('m', (yyvsp[-1].expr));
+        FILE_NAME(tmp,(yylsp[-3]));
+	(yyval.expr) = tmp;
+      }
+#line 10238 "parse.cc"
+    break;
+
+  case 453: /* expr_primary: K_max '(' expression ',' expression ')'  */
+#line 3178 "parse.y"
+      { PEBinary*tmp = new PEBinary('M', (yyvsp[-3].expr), (yyvsp[-1].expr));
+	FILE_NAME(tmp,(yylsp[-5]));
+	(yyval.expr) = tmp;
+      }
+#line 10247 "parse.cc"
+    break;
+
+  case 454: /* expr_primary: K_min '(' expression ',' expression ')'  */
+#line 3184 "parse.y"
+      { PEBinary*tmp = new PEBinary('m', (yyvsp[-3].expr), (yyvsp[-1].expr));
+	FILE_NAME(tmp,(yylsp[-5]));
+	(yyval.expr) = tmp;
+      }
+#line 10256 "parse.cc"
+    break;
+
+  case 455: /* expr_primary: '(' expr_mintypmax ')'  */
+#line 3192 "parse.y"
+      { (yyval.expr) = (yyvsp[-1].expr); }
+#line 10262 "parse.cc"
+    break;
+
+  case 456: /* expr_primary: '{' expression_list_proper '}'  */
+#line 3197 "parse.y"
+      { PEConcat*tmp = new PEConcat(*(yyvsp[-1].exprs));
+	FILE_NAME(tmp, (yylsp[-2]));
+	delete (yyvsp[-1].exprs);
+	(yyval.expr) = tmp;
+      }
+#line 10272 "parse.cc"
+    break;
+
+  case 457: /* expr_primary: '{' expression '{' expression_list_proper '}' '}'  */
+#line 3203 "parse.y"
+      { PExpr*rep = (yyvsp[-4].expr);
+	PEConcat*tmp = new PEConcat(*(yyvsp[-2].exprs), rep);
+	FILE_NAME(tmp, (yylsp[-5]));
+	delete (yyvsp[-2].exprs);
+	(yyval.expr) = tmp;
+      }
+#line 10283 "parse.cc"
+    break;
+
+  case 458: /* expr_primary: '{' expression '{' expression_list_proper '}' error '}'  */
+#line 3210 "parse.y"
+      { PExpr*rep = (yyvsp[-5].expr);
+	PEConcat*tmp = new PEConcat(*(yyvsp[-3].exprs), rep);
+	FILE_NAME(tmp, (yylsp[-6]));
+	delete (yyvsp[-3].exprs);
+	(yyval.expr) = tmp;
+	yyerror((yylsp[-2]), "error: Syntax error between internal '}' "
+		"and closing '}' of repeat concatenation.");
+	yyerrok;
+      }
+#line 10297 "parse.cc"
+    break;
+
+  case 459: /* expr_primary: '{' '}'  */
+#line 3221 "parse.y"
+      { // This is the empty queue syntax.
+	if (gn_system_verilog()) {
+	      yyerror((yylsp[-1]), "sorry: Expty queue expressions not supported.");
+	} else {
+	      yyerror((yylsp[-1]), "error: Concatenations are not allowed to be empty.");
+	}
+	(yyval.expr) = 0;
+      }
+#line 10310 "parse.cc"
+    break;
+
+  case 460: /* expr_primary: DEC_NUMBER '\'' '(' expression ')'  */
+#line 3233 "parse.y"
+      { PExpr*base = (yyvsp[-1].expr);
+	if (gn_system_verilog()) {
+	      PECastSize*tmp = new PECastSize((yyvsp[-4].number)->as_ulong(), base);
+	      FILE_NAME(tmp, (yylsp[-4]));
+	      delete (yyvsp[-4].number);
+	      (yyval.expr) = tmp;
+	} else {
+	      yyerror((yylsp[-4]), "error: Size cast requires SystemVerilog.");
+	      (yyval.expr) = base;
+	}
+      }
+#line 10326 "parse.cc"
+    break;
+
+  case 461: /* expr_primary: assignment_pattern  */
+#line 3248 "parse.y"
+      { (yyval.expr) = (yyvsp[0].expr); }
+#line 10332 "parse.cc"
+    break;
+
+  case 462: /* expr_primary: streaming_concatenation  */
+#line 3252 "parse.y"
+      { (yyval.expr) = (yyvsp[0].expr); }
+#line 10338 "parse.cc"
+    break;
+
+  case 463: /* expr_primary: K_null  */
+#line 3255 "parse.y"
+      { PENull*tmp = new PENull;
+	    FILE_NAME(tmp, (yylsp[0]));
+	(yyval.expr) = tmp;
+      }
+#line 10347 "parse.cc"
+    break;
+
+  case 464: /* function_item_list_opt: function_item_list  */
+#line 3267 "parse.y"
+                       { (yyval.wires) = (yyvsp[0].wires); }
+#line 10353 "parse.cc"
+    break;
+
+  case 465: /* function_item_list_opt: %empty  */
+#line 3268 "parse.y"
+                       { (yyval.wires) = 0; }
+#line 10359 "parse.cc"
+    break;
+
+  case 466: /* function_item_list: function_item  */
+#line 3273 "parse.y"
+      { (yyval.wires) = (yyvsp[0].wires); }
+#line 10365 "parse.cc"
+    break;
+
+  case 467: /* function_item_list: function_item_list function_item  */
+#line 3275 "parse.y"
+      { /* */
+	if ((yyvsp[-1].wires) && (yyvsp[0].wires)) {
+	      svector<PWire*>*tmp = new svector<PWire*>(*(yyvsp[-1].wires), *(yyvsp[0].wires));
+	      delete (yyvsp[-1].wires);
+	      delete (yyvsp[0].wires);
+	      (yyval.wires) = tmp;
+	} else if ((yyvsp[-1].wires)) {
+	      (yyval.wires) = (yyvsp[-1].wires);
+	} else {
+	      (yyval.wires) = (yyvsp[0].wires);
+	}
+      }
+#line 10382 "parse.cc"
+    break;
+
+  case 468: /* function_item: tf_port_declaration  */
+#line 3291 "parse.y"
+      { (yyval.wires) = (yyvsp[0].wires); }
+#line 10388 "parse.cc"
+    break;
+
+  case 469: /* function_item: block_item_decl  */
+#line 3293 "parse.y"
+      { (yyval.wires) = 0; }
+#line 10394 "parse.cc"
+    break;
+
+  case 470: /* gate_instance: IDENTIFIER '(' expression_list_with_nuls ')'  */
+#line 3300 "parse.y"
+                { lgate*tmp = new lgate;
+		  tmp->name = (yyvsp[-3].text);
+		  tmp->parms = (yyvsp[-1].exprs);
+		  tmp->file  = (yylsp[-3]).text;
+		  tmp->lineno = (yylsp[-3]).first_line;
+		  delete[](yyvsp[-3].text);
+		  (yyval.gate) = tmp;
+		}
+#line 10407 "parse.cc"
+    break;
+
+  case 471: /* gate_instance: IDENTIFIER range '(' expression_list_with_nuls ')'  */
+#line 3310 "parse.y"
+      { lgate*tmp = new lgate;
+	list<pform_range_t>*rng = (yyvsp[-3].ranges);
+	tmp->name = (yyvsp[-4].text);
+	tmp->parms = (yyvsp[-1].exprs);
+	tmp->range = rng->front();
+	rng->pop_front();
+	assert(rng->empty());
+	tmp->file  = (yylsp[-4]).text;
+	tmp->lineno = (yylsp[-4]).first_line;
+	delete[](yyvsp[-4].text);
+	delete rng;
+	(yyval.gate) = tmp;
+      }
+#line 10425 "parse.cc"
+    break;
+
+  case 472: /* gate_instance: '(' expression_list_with_nuls ')'  */
+#line 3325 "parse.y"
+                { lgate*tmp = new lgate;
+		  tmp->name = "";
+		  tmp->parms = (yyvsp[-1].exprs);
+		  tmp->file  = (yylsp[-2]).text;
+		  tmp->lineno = (yylsp[-2]).first_line;
+		  (yyval.gate) = tmp;
+		}
+#line 10437 "parse.cc"
+    break;
+
+  case 473: /* gate_instance: IDENTIFIER range  */
+#line 3336 "parse.y"
+      { lgate*tmp = new lgate;
+	list<pform_range_t>*rng = (yyvsp[0].ranges);
+	tmp->name = (yyvsp[-1].text);
+	tmp->parms = 0;
+	tmp->parms_by_name = 0;
+	tmp->range = rng->front();
+	rng->pop_front();
+	assert(rng->empty());
+	tmp->file  = (yylsp[-1]).text;
+	tmp->lineno = (yylsp[-1]).first_line;
+	delete[](yyvsp[-1].text);
+	delete rng;
+	(yyval.gate) = tmp;
+      }
+#line 10456 "parse.cc"
+    break;
+
+  case 474: /* gate_instance: IDENTIFIER '(' port_name_list ')'  */
+#line 3354 "parse.y"
+      { lgate*tmp = new lgate;
+	tmp->name = (yyvsp[-3].text);
+	tmp->parms = 0;
+	tmp->parms_by_name = (yyvsp[-1].named_pexprs);
+	tmp->file  = (yylsp[-3]).text;
+	tmp->lineno = (yylsp[-3]).first_line;
+	delete[](yyvsp[-3].text);
+	(yyval.gate) = tmp;
+      }
+#line 10470 "parse.cc"
+    break;
+
+  case 475: /* gate_instance: IDENTIFIER range '(' port_name_list ')'  */
+#line 3365 "parse.y"
+      { lgate*tmp = new lgate;
+	list<pform_range_t>*rng = (yyvsp[-3].ranges);
+	tmp->name = (yyvsp[-4].text);
+	tmp->parms = 0;
+	tmp->parms_by_name = (yyvsp[-1].named_pexprs);
+	tmp->range = rng->front();
+	rng->pop_front();
+	assert(rng->empty());
+	tmp->file  = (yylsp[-4]).text;
+	tmp->lineno = (yylsp[-4]).first_line;
+	delete[](yyvsp[-4].text);
+	delete rng;
+	(yyval.gate) = tmp;
+      }
+#line 10489 "parse.cc"
+    break;
+
+  case 476: /* gate_instance: IDENTIFIER '(' error ')'  */
+#line 3381 "parse.y"
+                { lgate*tmp = new lgate;
+		  tmp->name = (yyvsp[-3].text);
+		  tmp->parms = 0;
+		  tmp->parms_by_name = 0;
+		  tmp->file  = (yylsp[-3]).text;
+		  tmp->lineno = (yylsp[-3]).first_line;
+		  yyerror((yylsp[-2]), "error: Syntax error in instance port "
+			  "expression(s).");
+		  delete[](yyvsp[-3].text);
+		  (yyval.gate) = tmp;
+		}
+#line 10505 "parse.cc"
+    break;
+
+  case 477: /* gate_instance: IDENTIFIER range '(' error ')'  */
+#line 3394 "parse.y"
+                { lgate*tmp = new lgate;
+		  tmp->name = (yyvsp[-4].text);
+		  tmp->parms = 0;
+		  tmp->parms_by_name = 0;
+		  tmp->file  = (yylsp[-4]).text;
+		  tmp->lineno = (yylsp[-4]).first_line;
+		  yyerror((yylsp[-2]), "error: Syntax error in instance port "
+			  "expression(s).");
+		  delete[](yyvsp[-4].text);
+		  (yyval.gate) = tmp;
+		}
+#line 10521 "parse.cc"
+    break;
+
+  case 478: /* gate_instance_list: gate_instance_list ',' gate_instance  */
+#line 3409 "parse.y"
+                { svector<lgate>*tmp1 = (yyvsp[-2].gates);
+		  lgate*tmp2 = (yyvsp[0].gate);
+		  svector<lgate>*out = new svector<lgate> (*tmp1, *tmp2);
+		  delete tmp1;
+		  delete tmp2;
+		  (yyval.gates) = out;
+		}
+#line 10533 "parse.cc"
+    break;
+
+  case 479: /* gate_instance_list: gate_instance  */
+#line 3417 "parse.y"
+                { svector<lgate>*tmp = new svector<lgate>(1);
+		  (*tmp)[0] = *(yyvsp[0].gate);
+		  delete (yyvsp[0].gate);
+		  (yyval.gates) = tmp;
+		}
+#line 10543 "parse.cc"
+    break;
+
+  case 480: /* gatetype: K_and  */
+#line 3425 "parse.y"
+                 { (yyval.gatetype) = PGBuiltin::AND; }
+#line 10549 "parse.cc"
+    break;
+
+  case 481: /* gatetype: K_nand  */
+#line 3426 "parse.y"
+                 { (yyval.gatetype) = PGBuiltin::NAND; }
+#line 10555 "parse.cc"
+    break;
+
+  case 482: /* gatetype: K_or  */
+#line 3427 "parse.y"
+                 { (yyval.gatetype) = PGBuiltin::OR; }
+#line 10561 "parse.cc"
+    break;
+
+  case 483: /* gatetype: K_nor  */
+#line 3428 "parse.y"
+                 { (yyval.gatetype) = PGBuiltin::NOR; }
+#line 10567 "parse.cc"
+    break;
+
+  case 484: /* gatetype: K_xor  */
+#line 3429 "parse.y"
+                 { (yyval.gatetype) = PGBuiltin::XOR; }
+#line 10573 "parse.cc"
+    break;
+
+  case 485: /* gatetype: K_xnor  */
+#line 3430 "parse.y"
+                 { (yyval.gatetype) = PGBuiltin::XNOR; }
+#line 10579 "parse.cc"
+    break;
+
+  case 486: /* gatetype: K_buf  */
+#line 3431 "parse.y"
+                 { (yyval.gatetype) = PGBuiltin::BUF; }
+#line 10585 "parse.cc"
+    break;
+
+  case 487: /* gatetype: K_bufif0  */
+#line 3432 "parse.y"
+                   { (yyval.gatetype) = PGBuiltin::BUFIF0; }
+#line 10591 "parse.cc"
+    break;
+
+  case 488: /* gatetype: K_bufif1  */
+#line 3433 "parse.y"
+                   { (yyval.gatetype) = PGBuiltin::BUFIF1; }
+#line 10597 "parse.cc"
+    break;
+
+  case 489: /* gatetype: K_not  */
+#line 3434 "parse.y"
+                   { (yyval.gatetype) = PGBuiltin::NOT; }
+#line 10603 "parse.cc"
+    break;
+
+  case 490: /* gatetype: K_notif0  */
+#line 3435 "parse.y"
+                   { (yyval.gatetype) = PGBuiltin::NOTIF0; }
+#line 10609 "parse.cc"
+    break;
+
+  case 491: /* gatetype: K_notif1  */
+#line 3436 "parse.y"
+                   { (yyval.gatetype) = PGBuiltin::NOTIF1; }
+#line 10615 "parse.cc"
+    break;
+
+  case 492: /* switchtype: K_nmos  */
+#line 3440 "parse.y"
+                  { (yyval.gatetype) = PGBuiltin::NMOS; }
+#line 10621 "parse.cc"
+    break;
+
+  case 493: /* switchtype: K_rnmos  */
+#line 3441 "parse.y"
+                  { (yyval.gatetype) = PGBuiltin::RNMOS; }
+#line 10627 "parse.cc"
+    break;
+
+  case 494: /* switchtype: K_pmos  */
+#line 3442 "parse.y"
+                  { (yyval.gatetype) = PGBuiltin::PMOS; }
+#line 10633 "parse.cc"
+    break;
+
+  case 495: /* switchtype: K_rpmos  */
+#line 3443 "parse.y"
+                  { (yyval.gatetype) = PGBuiltin::RPMOS; }
+#line 10639 "parse.cc"
+    break;
+
+  case 496: /* switchtype: K_cmos  */
+#line 3444 "parse.y"
+                  { (yyval.gatetype) = PGBuiltin::CMOS; }
+#line 10645 "parse.cc"
+    break;
+
+  case 497: /* switchtype: K_rcmos  */
+#line 3445 "parse.y"
+                  { (yyval.gatetype) = PGBuiltin::RCMOS; }
+#line 10651 "parse.cc"
+    break;
+
+  case 498: /* switchtype: K_tran  */
+#line 3446 "parse.y"
+                  { (yyval.gatetype) = PGBuiltin::TRAN; }
+#line 10657 "parse.cc"
+    break;
+
+  case 499: /* switchtype: K_rtran  */
+#line 3447 "parse.y"
+                  { (yyval.gatetype) = PGBuiltin::RTRAN; }
+#line 10663 "parse.cc"
+    break;
+
+  case 500: /* switchtype: K_tranif0  */
+#line 3448 "parse.y"
+                    { (yyval.gatetype) = PGBuiltin::TRANIF0; }
+#line 10669 "parse.cc"
+    break;
+
+  case 501: /* switchtype: K_tranif1  */
+#line 3449 "parse.y"
+                    { (yyval.gatetype) = PGBuiltin::TRANIF1; }
+#line 10675 "parse.cc"
+    break;
+
+  case 502: /* switchtype: K_rtranif0  */
+#line 3450 "parse.y"
+                     { (yyval.gatetype) = PGBuiltin::RTRANIF0; }
+#line 10681 "parse.cc"
+    break;
+
+  case 503: /* switchtype: K_rtranif1  */
+#line 3451 "parse.y"
+                     { (yyval.gatetype) = PGBuiltin::RTRANIF1; }
+#line 10687 "parse.cc"
+    break;
+
+  case 504: /* hierarchy_identifier: IDENTIFIER  */
+#line 3462 "parse.y"
+        { (yyval.pform_name) = new pform_name_t;
+	  (yyval.pform_name)->push_back(name_component_t(lex_strings.make((yyvsp[0].text))));
+	  delete[](yyvsp[0].text);
+	}
+#line 10696 "parse.cc"
+    break;
+
+  case 505: /* hierarchy_identifier: hierarchy_identifier '.' IDENTIFIER  */
+#line 3467 "parse.y"
+        { pform_name_t * tmp = (yyvsp[-2].pform_name);
+	  tmp->push_back(name_component_t(lex_strings.make((yyvsp[0].text))));
+	  delete[](yyvsp[0].text);
+	  (yyval.pform_name) = tmp;
+	}
+#line 10706 "parse.cc"
+    break;
+
+  case 506: /* hierarchy_identifier: hierarchy_identifier '[' expression ']'  */
+#line 3473 "parse.y"
+        { pform_name_t * tmp = (yyvsp[-3].pform_name);
+	  name_component_t&tail = tmp->back();
+	  index_component_t itmp;
+	  itmp.sel = index_component_t::SEL_BIT;
+	  itmp.msb = (yyvsp[-1].expr);
+	  tail.index.push_back(itmp);
+	  (yyval.pform_name) = tmp;
+	}
+#line 10719 "parse.cc"
+    break;
+
+  case 507: /* hierarchy_identifier: hierarchy_identifier '[' expression ':' expression ']'  */
+#line 3482 "parse.y"
+        { pform_name_t * tmp = (yyvsp[-5].pform_name);
+	  name_component_t&tail = tmp->back();
+	  index_component_t itmp;
+	  itmp.sel = index_component_t::SEL_PART;
+	  itmp.msb = (yyvsp[-3].expr);
+	  itmp.lsb = (yyvsp[-1].expr);
+	  tail.index.push_back(itmp);
+	  (yyval.pform_name) = tmp;
+	}
+#line 10733 "parse.cc"
+    break;
+
+  case 508: /* hierarchy_identifier: hierarchy_identifier '[' expression K_PO_POS expression ']'  */
+#line 3492 "parse.y"
+        { pform_name_t * tmp = (yyvsp[-5].pform_name);
+	  name_component_t&tail = tmp->back();
+	  index_component_t itmp;
+	  itmp.sel = index_component_t::SEL_IDX_UP;
+	  itmp.msb = (yyvsp[-3].expr);
+	  itmp.lsb = (yyvsp[-1].expr);
+	  tail.index.push_back(itmp);
+	  (yyval.pform_name) = tmp;
+	}
+#line 10747 "parse.cc"
+    break;
+
+  case 509: /* hierarchy_identifier: hierarchy_identifier '[' expression K_PO_NEG expression ']'  */
+#line 3502 "parse.y"
+        { pform_name_t * tmp = (yyvsp[-5].pform_name);
+	  name_component_t&tail = tmp->back();
+	  index_component_t itmp;
+	  itmp.sel = index_component_t::SEL_IDX_DO;
+	  itmp.msb = (yyvsp[-3].expr);
+	  itmp.lsb = (yyvsp[-1].expr);
+	  tail.index.push_back(itmp);
+	  (yyval.pform_name) = tmp;
+	}
+#line 10761 "parse.cc"
+    break;
+
+  case 510: /* list_of_identifiers: IDENTIFIER  */
+#line 3518 "parse.y"
+                { (yyval.perm_strings) = list_from_identifier((yyvsp[0].text)); }
+#line 10767 "parse.cc"
+    break;
+
+  case 511: /* list_of_identifiers: list_of_identifiers ',' IDENTIFIER  */
+#line 3520 "parse.y"
+                { (yyval.perm_strings) = list_from_identifier((yyvsp[-2].perm_strings), (yyvsp[0].text)); }
+#line 10773 "parse.cc"
+    break;
+
+  case 512: /* list_of_port_identifiers: IDENTIFIER  */
+#line 3525 "parse.y"
+                { (yyval.port_list) = make_port_list((yyvsp[0].text), 0); }
+#line 10779 "parse.cc"
+    break;
+
+  case 513: /* list_of_port_identifiers: IDENTIFIER '=' expression  */
+#line 3527 "parse.y"
+                { (yyval.port_list) = make_port_list((yyvsp[-2].text), (yyvsp[0].expr)); }
+#line 10785 "parse.cc"
+    break;
+
+  case 514: /* list_of_port_identifiers: list_of_port_identifiers ',' IDENTIFIER  */
+#line 3529 "parse.y"
+                { (yyval.port_list) = make_port_list((yyvsp[-2].port_list), (yyvsp[0].text), 0); }
+#line 10791 "parse.cc"
+    break;
+
+  case 515: /* list_of_port_identifiers: list_of_port_identifiers ',' IDENTIFIER '=' expression  */
+#line 3531 "parse.y"
+                { (yyval.port_list) = make_port_list((yyvsp[-4].port_list), (yyvsp[-2].text), (yyvsp[0].expr)); }
+#line 10797 "parse.cc"
+    break;
+
+  case 516: /* list_of_ports: port_opt  */
+#line 3553 "parse.y"
+                { vector<Module::port_t*>*tmp
+			  = new vector<Module::port_t*>(1);
+		  (*tmp)[0] = (yyvsp[0].mport);
+		  (yyval.mports) = tmp;
+		}
+#line 10807 "parse.cc"
+    break;
+
+  case 517: /* list_of_ports: list_of_ports ',' port_opt  */
+#line 3559 "parse.y"
+                { vector<Module::port_t*>*tmp = (yyvsp[-2].mports);
+		  tmp->push_back((yyvsp[0].mport));
+		  (yyval.mports) = tmp;
+		}
+#line 10816 "parse.cc"
+    break;
+
+  case 518: /* list_of_port_declarations: port_declaration  */
+#line 3567 "parse.y"
+                { vector<Module::port_t*>*tmp
+			  = new vector<Module::port_t*>(1);
+		  (*tmp)[0] = (yyvsp[0].mport);
+		  (yyval.mports) = tmp;
+		}
+#line 10826 "parse.cc"
+    break;
+
+  case 519: /* list_of_port_declarations: list_of_port_declarations ',' port_declaration  */
+#line 3573 "parse.y"
+                { vector<Module::port_t*>*tmp = (yyvsp[-2].mports);
+		  tmp->push_back((yyvsp[0].mport));
+		  (yyval.mports) = tmp;
+		}
+#line 10835 "parse.cc"
+    break;
+
+  case 520: /* list_of_port_declarations: list_of_port_declarations ',' IDENTIFIER  */
+#line 3578 "parse.y"
+                { Module::port_t*ptmp;
+		  perm_string name = lex_strings.make((yyvsp[0].text));
+		  ptmp = pform_module_port_reference(name, (yylsp[0]).text,
+						     (yylsp[0]).first_line);
+		  vector<Module::port_t*>*tmp = (yyvsp[-2].mports);
+		  tmp->push_back(ptmp);
+
+		    /* Get the port declaration details, the port type
+		       and what not, from context data stored by the
+		       last port_declaration rule. */
+		  pform_module_define_port((yylsp[0]), name,
+					port_declaration_context.port_type,
+					port_declaration_context.port_net_type,
+					port_declaration_context.var_type,
+					port_declaration_context.sign_flag,
+					port_declaration_context.data_type,
+					port_declaration_context.range, 0);
+		  delete[](yyvsp[0].text);
+		  (yyval.mports) = tmp;
+		}
+#line 10860 "parse.cc"
+    break;
+
+  case 521: /* list_of_port_declarations: list_of_port_declarations ','  */
+#line 3599 "parse.y"
+                {
+		  yyerror((yylsp[0]), "error: NULL port declarations are not "
+		              "allowed.");
+		}
+#line 10869 "parse.cc"
+    break;
+
+  case 522: /* list_of_port_declarations: list_of_port_declarations ';'  */
+#line 3604 "parse.y"
+                {
+		  yyerror((yylsp[0]), "error: ';' is an invalid port declaration "
+		              "separator.");
+		}
+#line 10878 "parse.cc"
+    break;
+
+  case 523: /* port_declaration: attribute_list_opt K_input net_type_opt data_type_or_implicit IDENTIFIER  */
+#line 3612 "parse.y"
+      { Module::port_t*ptmp;
+	perm_string name = lex_strings.make((yyvsp[0].text));
+	ptmp = pform_module_port_reference(name, (yylsp[-3]).text, (yylsp[-3]).first_line);
+	pform_module_define_port((yylsp[-3]), name, NetNet::PINPUT, (yyvsp[-2].nettype), IVL_VT_NO_TYPE,
+				false, (yyvsp[-1].data_type), 0, (yyvsp[-4].named_pexprs));
+	port_declaration_context.port_type = NetNet::PINPUT;
+	port_declaration_context.port_net_type = (yyvsp[-2].nettype);
+	port_declaration_context.var_type = IVL_VT_NO_TYPE;
+	port_declaration_context.sign_flag = false;
+	delete port_declaration_context.range;
+	port_declaration_context.range = 0;
+	port_declaration_context.data_type = (yyvsp[-1].data_type);
+	delete[](yyvsp[0].text);
+	(yyval.mport) = ptmp;
+      }
+#line 10898 "parse.cc"
+    break;
+
+  case 524: /* port_declaration: attribute_list_opt K_input K_wreal IDENTIFIER  */
+#line 3629 "parse.y"
+      { Module::port_t*ptmp;
+	perm_string name = lex_strings.make((yyvsp[0].text));
+	ptmp = pform_module_port_reference(name, (yylsp[-2]).text,
+					   (yylsp[-2]).first_line);
+	pform_module_define_port((yylsp[-2]), name, NetNet::PINPUT,
+				 NetNet::WIRE, IVL_VT_REAL, true, 0, 0, (yyvsp[-3].named_pexprs));
+	port_declaration_context.port_type = NetNet::PINPUT;
+	port_declaration_context.port_net_type = NetNet::WIRE;
+	port_declaration_context.var_type = IVL_VT_REAL;
+	port_declaration_context.sign_flag = true;
+	delete port_declaration_context.range;
+	port_declaration_context.range = 0;
+	port_declaration_context.data_type = 0;
+	delete[](yyvsp[0].text);
+	(yyval.mport) = ptmp;
+      }
+#line 10919 "parse.cc"
+    break;
+
+  case 525: /* port_declaration: attribute_list_opt K_inout net_type_opt data_type_or_implicit IDENTIFIER  */
+#line 3646 "parse.y"
+      { Module::port_t*ptmp;
+	perm_string name = lex_strings.make((yyvsp[0].text));
+	ptmp = pform_module_port_reference(name, (yylsp[-3]).text, (yylsp[-3]).first_line);
+	pform_module_define_port((yylsp[-3]), name, NetNet::PINOUT, (yyvsp[-2].nettype), IVL_VT_NO_TYPE,
+				false, (yyvsp[-1].data_type), 0, (yyvsp[-4].named_pexprs));
+	port_declaration_context.port_type = NetNet::PINOUT;
+	port_declaration_context.port_net_type = (yyvsp[-2].nettype);
+	port_declaration_context.var_type = IVL_VT_NO_TYPE;
+	port_declaration_context.sign_flag = false;
+	delete port_declaration_context.range;
+	port_declaration_context.range = 0;
+	port_declaration_context.data_type = (yyvsp[-1].data_type);
+	delete[](yyvsp[0].text);
+	(yyval.mport) = ptmp;
+      }
+#line 10939 "parse.cc"
+    break;
+
+  case 526: /* port_declaration: attribute_list_opt K_inout K_wreal IDENTIFIER  */
+#line 3663 "parse.y"
+      { Module::port_t*ptmp;
+	perm_string name = lex_strings.make((yyvsp[0].text));
+	ptmp = pform_module_port_reference(name, (yylsp[-2]).text,
+					   (yylsp[-2]).first_line);
+	pform_module_define_port((yylsp[-2]), name, NetNet::PINOUT,
+				 NetNet::WIRE, IVL_VT_REAL, true, 0, 0, (yyvsp[-3].named_pexprs));
+	port_declaration_context.port_type = NetNet::PINOUT;
+	port_declaration_context.port_net_type = NetNet::WIRE;
+	port_declaration_context.var_type = IVL_VT_REAL;
+	port_declaration_context.sign_flag = true;
+	delete port_declaration_context.range;
+	port_declaration_context.range = 0;
+	port_declaration_context.data_type = 0;
+	delete[](yyvsp[0].text);
+	(yyval.mport) = ptmp;
+      }
+#line 10960 "parse.cc"
+    break;
+
+  case 527: /* port_declaration: attribute_list_opt K_output net_type_opt data_type_or_implicit IDENTIFIER  */
+#line 3680 "parse.y"
+      { Module::port_t*ptmp;
+	perm_string name = lex_strings.make((yyvsp[0].text));
+	NetNet::Type use_type = (yyvsp[-2].nettype);
+	if (use_type == NetNet::IMPLICIT) {
+	      if (vector_type_t*dtype = dynamic_cast<vector_type_t*> ((yyvsp[-1].data_type))) {
+		    if (dtype->reg_flag)
+			  use_type = NetNet::REG;
+		    else if (dtype->implicit_flag)
+			  use_type = NetNet::IMPLICIT;
+		    else
+			  use_type = NetNet::IMPLICIT_REG;
+	      } else if (dynamic_cast<atom2_type_t*> ((yyvsp[-1].data_type))) {
+		    use_type = NetNet::IMPLICIT_REG;
+	      }
+	}
+	ptmp = pform_module_port_reference(name, (yylsp[-3]).text, (yylsp[-3]).first_line);
+	pform_module_define_port((yylsp[-3]), name, NetNet::POUTPUT, use_type, IVL_VT_NO_TYPE,
+				false, (yyvsp[-1].data_type), 0, (yyvsp[-4].named_pexprs));
+	port_declaration_context.port_type = NetNet::POUTPUT;
+	port_declaration_context.port_net_type = use_type;
+	port_declaration_context.var_type = IVL_VT_NO_TYPE;
+	port_declaration_context.sign_flag = false;
+	delete port_declaration_context.range;
+	port_declaration_context.range = 0;
+	port_declaration_context.data_type = (yyvsp[-1].data_type);
+	delete[](yyvsp[0].text);
+	(yyval.mport) = ptmp;
+      }
+#line 10993 "parse.cc"
+    break;
+
+  case 528: /* port_declaration: attribute_list_opt K_output K_wreal IDENTIFIER  */
+#line 3710 "parse.y"
+      { Module::port_t*ptmp;
+	perm_string name = lex_strings.make((yyvsp[0].text));
+	ptmp = pform_module_port_reference(name, (yylsp[-2]).text,
+					   (yylsp[-2]).first_line);
+	pform_module_define_port((yylsp[-2]), name, NetNet::POUTPUT,
+				 NetNet::WIRE, IVL_VT_REAL, true, 0, 0, (yyvsp[-3].named_pexprs));
+	port_declaration_context.port_type = NetNet::POUTPUT;
+	port_declaration_context.port_net_type = NetNet::WIRE;
+	port_declaration_context.var_type = IVL_VT_REAL;
+	port_declaration_context.sign_flag = true;
+	delete port_declaration_context.range;
+	port_declaration_context.range = 0;
+	port_declaration_context.data_type = 0;
+	delete[](yyvsp[0].text);
+	(yyval.mport) = ptmp;
+      }
+#line 11014 "parse.cc"
+    break;
+
+  case 529: /* port_declaration: attribute_list_opt K_output net_type_opt data_type_or_implicit IDENTIFIER '=' expression  */
+#line 3727 "parse.y"
+      { Module::port_t*ptmp;
+	perm_string name = lex_strings.make((yyvsp[-2].text));
+	NetNet::Type use_type = (yyvsp[-4].nettype);
+	if (use_type == NetNet::IMPLICIT) {
+	      if (vector_type_t*dtype = dynamic_cast<vector_type_t*> ((yyvsp[-3].data_type))) {
+		    if (dtype->reg_flag)
+			  use_type = NetNet::REG;
+		    else
+			  use_type = NetNet::IMPLICIT_REG;
+	      } else {
+		    use_type = NetNet::IMPLICIT_REG;
+	      }
+	}
+	ptmp = pform_module_port_reference(name, (yylsp[-5]).text, (yylsp[-5]).first_line);
+	pform_module_define_port((yylsp[-5]), name, NetNet::POUTPUT, use_type, IVL_VT_NO_TYPE,
+				false, (yyvsp[-3].data_type), 0, (yyvsp[-6].named_pexprs));
+	port_declaration_context.port_type = NetNet::PINOUT;
+	port_declaration_context.port_net_type = use_type;
+	port_declaration_context.var_type = IVL_VT_NO_TYPE;
+	port_declaration_context.sign_flag = false;
+	delete port_declaration_context.range;
+	port_declaration_context.range = 0;
+	port_declaration_context.data_type = (yyvsp[-3].data_type);
+
+	pform_make_reginit((yylsp[-2]), name, (yyvsp[0].expr));
+
+	delete[](yyvsp[-2].text);
+	(yyval.mport) = ptmp;
+      }
+#line 11048 "parse.cc"
+    break;
+
+  case 530: /* net_type_opt: net_type  */
+#line 3761 "parse.y"
+                   { (yyval.nettype) = (yyvsp[0].nettype); }
+#line 11054 "parse.cc"
+    break;
+
+  case 531: /* net_type_opt: %empty  */
+#line 3762 "parse.y"
+          { (yyval.nettype) = NetNet::IMPLICIT; }
+#line 11060 "parse.cc"
+    break;
+
+  case 532: /* unsigned_signed_opt: K_signed  */
+#line 3776 "parse.y"
+               { (yyval.flag) = true; }
+#line 11066 "parse.cc"
+    break;
+
+  case 533: /* unsigned_signed_opt: K_unsigned  */
+#line 3777 "parse.y"
+               { (yyval.flag) = false; }
+#line 11072 "parse.cc"
+    break;
+
+  case 534: /* unsigned_signed_opt: %empty  */
+#line 3778 "parse.y"
+               { (yyval.flag) = false; }
+#line 11078 "parse.cc"
+    break;
+
+  case 535: /* signed_unsigned_opt: K_signed  */
+#line 3782 "parse.y"
+               { (yyval.flag) = true; }
+#line 11084 "parse.cc"
+    break;
+
+  case 536: /* signed_unsigned_opt: K_unsigned  */
+#line 3783 "parse.y"
+               { (yyval.flag) = false; }
+#line 11090 "parse.cc"
+    break;
+
+  case 537: /* signed_unsigned_opt: %empty  */
+#line 3784 "parse.y"
+               { (yyval.flag) = true; }
+#line 11096 "parse.cc"
+    break;
+
+  case 538: /* atom2_type: K_byte  */
+#line 3792 "parse.y"
+               { (yyval.int_val) = 8; }
+#line 11102 "parse.cc"
+    break;
+
+  case 539: /* atom2_type: K_shortint  */
+#line 3793 "parse.y"
+               { (yyval.int_val) = 16; }
+#line 11108 "parse.cc"
+    break;
+
+  case 540: /* atom2_type: K_int  */
+#line 3794 "parse.y"
+               { (yyval.int_val) = 32; }
+#line 11114 "parse.cc"
+    break;
+
+  case 541: /* atom2_type: K_longint  */
+#line 3795 "parse.y"
+               { (yyval.int_val) = 64; }
+#line 11120 "parse.cc"
+    break;
+
+  case 542: /* lpvalue: hierarchy_identifier  */
+#line 3804 "parse.y"
+      { PEIdent*tmp = new PEIdent(*(yyvsp[0].pform_name));
+	FILE_NAME(tmp, (yylsp[0]));
+	(yyval.expr) = tmp;
+	delete (yyvsp[0].pform_name);
+      }
+#line 11130 "parse.cc"
+    break;
+
+  case 543: /* lpvalue: implicit_class_handle '.' hierarchy_identifier  */
+#line 3811 "parse.y"
+      { yyerror((yylsp[-2]), "sorry: implicit class handles (this/super) not supported.");
+	PEIdent*tmp = new PEIdent(*(yyvsp[0].pform_name));
+	FILE_NAME(tmp, (yylsp[-2]));
+	(yyval.expr) = tmp;
+	delete (yyvsp[0].pform_name);
+      }
+#line 11141 "parse.cc"
+    break;
+
+  case 544: /* lpvalue: '{' expression_list_proper '}'  */
+#line 3819 "parse.y"
+      { PEConcat*tmp = new PEConcat(*(yyvsp[-1].exprs));
+	FILE_NAME(tmp, (yylsp[-2]));
+	delete (yyvsp[-1].exprs);
+	(yyval.expr) = tmp;
+      }
+#line 11151 "parse.cc"
+    break;
+
+  case 545: /* lpvalue: streaming_concatenation  */
+#line 3826 "parse.y"
+      { yyerror((yylsp[0]), "sorry: streaming concatenation not supported in l-values.");
+	(yyval.expr) = 0;
+      }
+#line 11159 "parse.cc"
+    break;
+
+  case 546: /* cont_assign: lpvalue '=' expression  */
+#line 3836 "parse.y"
+      { list<PExpr*>*tmp = new list<PExpr*>;
+	tmp->push_back((yyvsp[-2].expr));
+	tmp->push_back((yyvsp[0].expr));
+	(yyval.exprs) = tmp;
+      }
+#line 11169 "parse.cc"
+    break;
+
+  case 547: /* cont_assign_list: cont_assign_list ',' cont_assign  */
+#line 3845 "parse.y"
+      { list<PExpr*>*tmp = (yyvsp[-2].exprs);
+	tmp->splice(tmp->end(), *(yyvsp[0].exprs));
+	delete (yyvsp[0].exprs);
+	(yyval.exprs) = tmp;
+      }
+#line 11179 "parse.cc"
+    break;
+
+  case 548: /* cont_assign_list: cont_assign  */
+#line 3851 "parse.y"
+      { (yyval.exprs) = (yyvsp[0].exprs); }
+#line 11185 "parse.cc"
+    break;
+
+  case 552: /* local_timeunit_prec_decl: K_timeunit TIME_LITERAL ';'  */
+#line 3865 "parse.y"
+                { pform_set_timeunit((yyvsp[-1].text), true, false);
+		  have_timeunit_decl = true;
+		}
+#line 11193 "parse.cc"
+    break;
+
+  case 553: /* local_timeunit_prec_decl: K_timeprecision TIME_LITERAL ';'  */
+#line 3869 "parse.y"
+                { pform_set_timeprecision((yyvsp[-1].text), true, false);
+		  have_timeprec_decl = true;
+		}
+#line 11201 "parse.cc"
+    break;
+
+  case 554: /* $@19: %empty  */
+#line 3880 "parse.y"
+      { pform_startmodule((yylsp[-1]), (yyvsp[0].text), (yyvsp[-1].int_val)==K_program, (yyvsp[-2].named_pexprs)); }
+#line 11207 "parse.cc"
+    break;
+
+  case 555: /* $@20: %empty  */
+#line 3884 "parse.y"
+      { pform_module_set_ports((yyvsp[-2].mports)); }
+#line 11213 "parse.cc"
+    break;
+
+  case 556: /* $@21: %empty  */
+#line 3886 "parse.y"
+      { have_timeunit_decl = true; // Every thing past here is
+	have_timeprec_decl = true; // a check!
+	pform_check_timeunit_prec();
+      }
+#line 11222 "parse.cc"
+    break;
+
+  case 557: /* $@22: %empty  */
+#line 3892 "parse.y"
+      { Module::UCDriveType ucd;
+	  // The lexor detected `unconnected_drive directives and
+	  // marked what it found in the uc_drive variable. Use that
+	  // to generate a UCD flag for the module.
+	switch (uc_drive) {
+	    case UCD_NONE:
+	    default:
+	      ucd = Module::UCD_NONE;
+	      break;
+	    case UCD_PULL0:
+	      ucd = Module::UCD_PULL0;
+	      break;
+	    case UCD_PULL1:
+	      ucd = Module::UCD_PULL1;
+	      break;
+	}
+	  // Check that program/endprogram and module/endmodule
+	  // keywords match.
+	if ((yyvsp[-11].int_val) != (yyvsp[0].int_val)) {
+	      switch ((yyvsp[-11].int_val)) {
+		  case K_module:
+		    yyerror((yylsp[0]), "error: module not closed by endmodule.");
+		    break;
+		  case K_program:
+		    yyerror((yylsp[0]), "error: program not closed by endprogram.");
+		    break;
+		  default:
+		    break;
+	      }
+	}
+	pform_endmodule((yyvsp[-10].text), in_celldefine, ucd);
+	have_timeunit_decl = false; // We will allow decls again.
+	have_timeprec_decl = false;
+      }
+#line 11261 "parse.cc"
+    break;
+
+  case 558: /* module: attribute_list_opt module_start IDENTIFIER $@19 module_parameter_port_list_opt module_port_list_opt module_attribute_foreign ';' $@20 local_timeunit_prec_decl_opt $@21 module_item_list_opt module_end $@22 endname_opt  */
+#line 3927 "parse.y"
+      { // Last step: check any closing name. This is done late so
+	// that the parser can look ahead to detect the present
+	// endname_opt but still have the pform_endmodule() called
+	// early enough that the lexor can know we are outside the
+	// module.
+	if ((yyvsp[0].text) && (strcmp((yyvsp[-12].text),(yyvsp[0].text)) != 0)) {
+	      yyerror((yylsp[0]), "error: End name doesn't match module/program name");
+	}
+	delete[](yyvsp[-12].text);
+	if ((yyvsp[0].text)) delete[](yyvsp[0].text);
+      }
+#line 11277 "parse.cc"
+    break;
+
+  case 559: /* module_start: K_module  */
+#line 3945 "parse.y"
+                  { (yyval.int_val) = K_module; }
+#line 11283 "parse.cc"
+    break;
+
+  case 560: /* module_start: K_macromodule  */
+#line 3946 "parse.y"
+                  { (yyval.int_val) = K_module; }
+#line 11289 "parse.cc"
+    break;
+
+  case 561: /* module_start: K_program  */
+#line 3947 "parse.y"
+                  { (yyval.int_val) = K_program; }
+#line 11295 "parse.cc"
+    break;
+
+  case 562: /* module_end: K_endmodule  */
+#line 3951 "parse.y"
+                  { (yyval.int_val) = K_module; }
+#line 11301 "parse.cc"
+    break;
+
+  case 563: /* module_end: K_endprogram  */
+#line 3952 "parse.y"
+                  { (yyval.int_val) = K_program; }
+#line 11307 "parse.cc"
+    break;
+
+  case 564: /* endname_opt: ':' IDENTIFIER  */
+#line 3956 "parse.y"
+                   { (yyval.text) = (yyvsp[0].text); }
+#line 11313 "parse.cc"
+    break;
+
+  case 565: /* endname_opt: %empty  */
+#line 3957 "parse.y"
+                   { (yyval.text) = 0; }
+#line 11319 "parse.cc"
+    break;
+
+  case 566: /* module_attribute_foreign: K_PSTAR IDENTIFIER K_integer IDENTIFIER '=' STRING ';' K_STARP  */
+#line 3961 "parse.y"
+                                                                         { (yyval.mports) = 0; }
+#line 11325 "parse.cc"
+    break;
+
+  case 567: /* module_attribute_foreign: %empty  */
+#line 3962 "parse.y"
+          { (yyval.mports) = 0; }
+#line 11331 "parse.cc"
+    break;
+
+  case 568: /* module_port_list_opt: '(' list_of_ports ')'  */
+#line 3966 "parse.y"
+                          { (yyval.mports) = (yyvsp[-1].mports); }
+#line 11337 "parse.cc"
+    break;
+
+  case 569: /* module_port_list_opt: '(' list_of_port_declarations ')'  */
+#line 3967 "parse.y"
+                                      { (yyval.mports) = (yyvsp[-1].mports); }
+#line 11343 "parse.cc"
+    break;
+
+  case 570: /* module_port_list_opt: %empty  */
+#line 3968 "parse.y"
+                          { (yyval.mports) = 0; }
+#line 11349 "parse.cc"
+    break;
+
+  case 571: /* module_port_list_opt: '(' error ')'  */
+#line 3970 "parse.y"
+      { yyerror((yylsp[-1]), "Errors in port declarations.");
+	yyerrok;
+	(yyval.mports) = 0;
+      }
+#line 11358 "parse.cc"
+    break;
+
+  case 578: /* module_item: attribute_list_opt net_type data_type_or_implicit delay3_opt net_variable_list ';'  */
+#line 3997 "parse.y"
+      { data_type_t*data_type = (yyvsp[-3].data_type);
+	if (data_type == 0) {
+	      data_type = new vector_type_t(IVL_VT_LOGIC, false, 0);
+	      FILE_NAME(data_type, (yylsp[-4]));
+	}
+	pform_set_data_type((yylsp[-4]), data_type, (yyvsp[-1].perm_strings), (yyvsp[-4].nettype), (yyvsp[-5].named_pexprs));
+	if ((yyvsp[-2].exprs) != 0) {
+	      yyerror((yylsp[-4]), "sorry: net delays not supported.");
+	      delete (yyvsp[-2].exprs);
+	}
+	delete (yyvsp[-5].named_pexprs);
+      }
+#line 11375 "parse.cc"
+    break;
+
+  case 579: /* module_item: attribute_list_opt K_wreal delay3 net_variable_list ';'  */
+#line 4011 "parse.y"
+      { real_type_t*tmpt = new real_type_t(real_type_t::REAL);
+	pform_set_data_type((yylsp[-3]), tmpt, (yyvsp[-1].perm_strings), NetNet::WIRE, (yyvsp[-4].named_pexprs));
+	if ((yyvsp[-2].exprs) != 0) {
+	      yyerror((yylsp[-2]), "sorry: net delays not supported.");
+	      delete (yyvsp[-2].exprs);
+	}
+	delete (yyvsp[-4].named_pexprs);
+      }
+#line 11388 "parse.cc"
+    break;
+
+  case 580: /* module_item: attribute_list_opt K_wreal net_variable_list ';'  */
+#line 4021 "parse.y"
+      { real_type_t*tmpt = new real_type_t(real_type_t::REAL);
+	pform_set_data_type((yylsp[-2]), tmpt, (yyvsp[-1].perm_strings), NetNet::WIRE, (yyvsp[-3].named_pexprs));
+	delete (yyvsp[-3].named_pexprs);
+      }
+#line 11397 "parse.cc"
+    break;
+
+  case 581: /* module_item: attribute_list_opt net_type data_type_or_implicit delay3_opt net_decl_assigns ';'  */
+#line 4031 "parse.y"
+      { data_type_t*data_type = (yyvsp[-3].data_type);
+	if (data_type == 0) {
+	      data_type = new vector_type_t(IVL_VT_LOGIC, false, 0);
+	      FILE_NAME(data_type, (yylsp[-4]));
+	}
+	pform_makewire((yylsp[-4]), (yyvsp[-2].exprs), str_strength, (yyvsp[-1].net_decl_assign), (yyvsp[-4].nettype), data_type);
+	if ((yyvsp[-5].named_pexprs)) {
+	      yyerror((yylsp[-4]), "sorry: Attributes not supported "
+		      "on net declaration assignments.");
+	      delete (yyvsp[-5].named_pexprs);
+	}
+      }
+#line 11414 "parse.cc"
+    break;
+
+  case 582: /* module_item: attribute_list_opt net_type data_type_or_implicit drive_strength net_decl_assigns ';'  */
+#line 4048 "parse.y"
+      { data_type_t*data_type = (yyvsp[-3].data_type);
+	if (data_type == 0) {
+	      data_type = new vector_type_t(IVL_VT_LOGIC, false, 0);
+	      FILE_NAME(data_type, (yylsp[-4]));
+	}
+	pform_makewire((yylsp[-4]), 0, (yyvsp[-2].drive), (yyvsp[-1].net_decl_assign), (yyvsp[-4].nettype), data_type);
+	if ((yyvsp[-5].named_pexprs)) {
+	      yyerror((yylsp[-4]), "sorry: Attributes not supported "
+		      "on net declaration assignments.");
+	      delete (yyvsp[-5].named_pexprs);
+	}
+      }
+#line 11431 "parse.cc"
+    break;
+
+  case 583: /* module_item: attribute_list_opt K_wreal net_decl_assigns ';'  */
+#line 4062 "parse.y"
+      { real_type_t*data_type = new real_type_t(real_type_t::REAL);
+        pform_makewire((yylsp[-2]), 0, str_strength, (yyvsp[-1].net_decl_assign), NetNet::WIRE, data_type);
+	if ((yyvsp[-3].named_pexprs)) {
+	      yyerror((yylsp[-2]), "sorry: Attributes not supported "
+		      "on net declaration assignments.");
+	      delete (yyvsp[-3].named_pexprs);
+	}
+      }
+#line 11444 "parse.cc"
+    break;
+
+  case 584: /* module_item: K_trireg charge_strength_opt range_opt delay3_opt list_of_identifiers ';'  */
+#line 4072 "parse.y"
+                { yyerror((yylsp[-5]), "sorry: trireg nets not supported.");
+		  delete (yyvsp[-3].ranges);
+		  delete (yyvsp[-2].exprs);
+		}
+#line 11453 "parse.cc"
+    break;
+
+  case 585: /* module_item: port_direction unsigned_signed_opt range_opt delay3_opt list_of_identifiers ';'  */
+#line 4078 "parse.y"
+                { pform_set_port_type((yylsp[-5]), (yyvsp[-1].perm_strings), (yyvsp[-3].ranges), (yyvsp[-4].flag), (yyvsp[-5].porttype));
+		}
+#line 11460 "parse.cc"
+    break;
+
+  case 586: /* module_item: port_direction net_type unsigned_signed_opt range_opt list_of_identifiers ';'  */
+#line 4086 "parse.y"
+                { pform_makewire((yylsp[-5]), (yyvsp[-2].ranges), (yyvsp[-3].flag), (yyvsp[-1].perm_strings), (yyvsp[-4].nettype), (yyvsp[-5].porttype), IVL_VT_NO_TYPE, 0,
+		                 SR_BOTH);
+		}
+#line 11468 "parse.cc"
+    break;
+
+  case 587: /* module_item: K_output var_type unsigned_signed_opt range_opt list_of_port_identifiers ';'  */
+#line 4091 "parse.y"
+                { list<pair<perm_string,PExpr*> >::const_iterator pp;
+		  list<perm_string>*tmp = new list<perm_string>;
+		  for (pp = (yyvsp[-1].port_list)->begin(); pp != (yyvsp[-1].port_list)->end(); ++ pp ) {
+			tmp->push_back((*pp).first);
+		  }
+		  pform_makewire((yylsp[-5]), (yyvsp[-2].ranges), (yyvsp[-3].flag), tmp, (yyvsp[-4].nettype), NetNet::POUTPUT,
+		                 IVL_VT_NO_TYPE, 0, SR_BOTH);
+		  for (pp = (yyvsp[-1].port_list)->begin(); pp != (yyvsp[-1].port_list)->end(); ++ pp ) {
+			if ((*pp).second) {
+			      pform_make_reginit((yylsp[-5]), (*pp).first, (*pp).second);
+			}
+		  }
+		  delete (yyvsp[-1].port_list);
+		}
+#line 11487 "parse.cc"
+    break;
+
+  case 588: /* module_item: port_direction K_wreal list_of_identifiers ';'  */
+#line 4107 "parse.y"
+                { pform_makewire((yylsp[-3]), 0, true, (yyvsp[-1].perm_strings), NetNet::WIRE, (yyvsp[-3].porttype),
+		                 IVL_VT_REAL, 0, SR_BOTH);
+		}
+#line 11495 "parse.cc"
+    break;
+
+  case 589: /* module_item: K_input var_type unsigned_signed_opt range_opt list_of_identifiers ';'  */
+#line 4116 "parse.y"
+                { pform_makewire((yylsp[-5]), (yyvsp[-2].ranges), (yyvsp[-3].flag), (yyvsp[-1].perm_strings), (yyvsp[-4].nettype), NetNet::PINPUT,
+				 IVL_VT_NO_TYPE, 0);
+		  yyerror((yylsp[-4]), "error: reg variables cannot be inputs.");
+		}
+#line 11504 "parse.cc"
+    break;
+
+  case 590: /* module_item: K_inout var_type unsigned_signed_opt range_opt list_of_identifiers ';'  */
+#line 4122 "parse.y"
+                { pform_makewire((yylsp[-5]), (yyvsp[-2].ranges), (yyvsp[-3].flag), (yyvsp[-1].perm_strings), (yyvsp[-4].nettype), NetNet::PINOUT,
+				 IVL_VT_NO_TYPE, 0);
+		  yyerror((yylsp[-4]), "error: reg variables cannot be inouts.");
+		}
+#line 11513 "parse.cc"
+    break;
+
+  case 591: /* module_item: port_direction unsigned_signed_opt range_opt delay3_opt error ';'  */
+#line 4128 "parse.y"
+                { yyerror((yylsp[-5]), "error: Invalid variable list"
+			  " in port declaration.");
+		  if ((yyvsp[-3].ranges)) delete (yyvsp[-3].ranges);
+		  if ((yyvsp[-2].exprs)) delete (yyvsp[-2].exprs);
+		  yyerrok;
+		}
+#line 11524 "parse.cc"
+    break;
+
+  case 592: /* module_item: DISCIPLINE_IDENTIFIER list_of_identifiers ';'  */
+#line 4139 "parse.y"
+      { pform_attach_discipline((yylsp[-2]), (yyvsp[-2].discipline), (yyvsp[-1].perm_strings)); }
+#line 11530 "parse.cc"
+    break;
+
+  case 593: /* $@23: %empty  */
+#line 4144 "parse.y"
+                       { attributes_in_context = (yyvsp[0].named_pexprs); }
+#line 11536 "parse.cc"
+    break;
+
+  case 594: /* module_item: attribute_list_opt $@23 block_item_decl  */
+#line 4145 "parse.y"
+      { delete attributes_in_context;
+	attributes_in_context = 0;
+      }
+#line 11544 "parse.cc"
+    break;
+
+  case 596: /* module_item: attribute_list_opt gatetype gate_instance_list ';'  */
+#line 4158 "parse.y"
+      { pform_makegates((yylsp[-2]), (yyvsp[-2].gatetype), str_strength, 0, (yyvsp[-1].gates), (yyvsp[-3].named_pexprs)); }
+#line 11550 "parse.cc"
+    break;
+
+  case 597: /* module_item: attribute_list_opt gatetype delay3 gate_instance_list ';'  */
+#line 4161 "parse.y"
+      { pform_makegates((yylsp[-3]), (yyvsp[-3].gatetype), str_strength, (yyvsp[-2].exprs), (yyvsp[-1].gates), (yyvsp[-4].named_pexprs)); }
+#line 11556 "parse.cc"
+    break;
+
+  case 598: /* module_item: attribute_list_opt gatetype drive_strength gate_instance_list ';'  */
+#line 4164 "parse.y"
+      { pform_makegates((yylsp[-3]), (yyvsp[-3].gatetype), (yyvsp[-2].drive), 0, (yyvsp[-1].gates), (yyvsp[-4].named_pexprs)); }
+#line 11562 "parse.cc"
+    break;
+
+  case 599: /* module_item: attribute_list_opt gatetype drive_strength delay3 gate_instance_list ';'  */
+#line 4167 "parse.y"
+      { pform_makegates((yylsp[-4]), (yyvsp[-4].gatetype), (yyvsp[-3].drive), (yyvsp[-2].exprs), (yyvsp[-1].gates), (yyvsp[-5].named_pexprs)); }
+#line 11568 "parse.cc"
+    break;
+
+  case 600: /* module_item: attribute_list_opt switchtype gate_instance_list ';'  */
+#line 4171 "parse.y"
+      { pform_makegates((yylsp[-2]), (yyvsp[-2].gatetype), str_strength, 0, (yyvsp[-1].gates), (yyvsp[-3].named_pexprs)); }
+#line 11574 "parse.cc"
+    break;
+
+  case 601: /* module_item: attribute_list_opt switchtype delay3 gate_instance_list ';'  */
+#line 4174 "parse.y"
+      { pform_makegates((yylsp[-3]), (yyvsp[-3].gatetype), str_strength, (yyvsp[-2].exprs), (yyvsp[-1].gates), (yyvsp[-4].named_pexprs)); }
+#line 11580 "parse.cc"
+    break;
+
+  case 602: /* module_item: K_pullup gate_instance_list ';'  */
+#line 4180 "parse.y"
+      { pform_makegates((yylsp[-2]), PGBuiltin::PULLUP, pull_strength, 0, (yyvsp[-1].gates), 0); }
+#line 11586 "parse.cc"
+    break;
+
+  case 603: /* module_item: K_pulldown gate_instance_list ';'  */
+#line 4182 "parse.y"
+      { pform_makegates((yylsp[-2]), PGBuiltin::PULLDOWN, pull_strength, 0, (yyvsp[-1].gates), 0); }
+#line 11592 "parse.cc"
+    break;
+
+  case 604: /* module_item: K_pullup '(' dr_strength1 ')' gate_instance_list ';'  */
+#line 4185 "parse.y"
+      { pform_makegates((yylsp[-5]), PGBuiltin::PULLUP, (yyvsp[-3].drive), 0, (yyvsp[-1].gates), 0); }
+#line 11598 "parse.cc"
+    break;
+
+  case 605: /* module_item: K_pullup '(' dr_strength1 ',' dr_strength0 ')' gate_instance_list ';'  */
+#line 4188 "parse.y"
+      { pform_makegates((yylsp[-7]), PGBuiltin::PULLUP, (yyvsp[-5].drive), 0, (yyvsp[-1].gates), 0); }
+#line 11604 "parse.cc"
+    break;
+
+  case 606: /* module_item: K_pullup '(' dr_strength0 ',' dr_strength1 ')' gate_instance_list ';'  */
+#line 4191 "parse.y"
+      { pform_makegates((yylsp[-7]), PGBuiltin::PULLUP, (yyvsp[-3].drive), 0, (yyvsp[-1].gates), 0); }
+#line 11610 "parse.cc"
+    break;
+
+  case 607: /* module_item: K_pulldown '(' dr_strength0 ')' gate_instance_list ';'  */
+#line 4194 "parse.y"
+      { pform_makegates((yylsp[-5]), PGBuiltin::PULLDOWN, (yyvsp[-3].drive), 0, (yyvsp[-1].gates), 0); }
+#line 11616 "parse.cc"
+    break;
+
+  case 608: /* module_item: K_pulldown '(' dr_strength1 ',' dr_strength0 ')' gate_instance_list ';'  */
+#line 4197 "parse.y"
+      { pform_makegates((yylsp[-7]), PGBuiltin::PULLDOWN, (yyvsp[-3].drive), 0, (yyvsp[-1].gates), 0); }
+#line 11622 "parse.cc"
+    break;
+
+  case 609: /* module_item: K_pulldown '(' dr_strength0 ',' dr_strength1 ')' gate_instance_list ';'  */
+#line 4200 "parse.y"
+      { pform_makegates((yylsp[-7]), PGBuiltin::PULLDOWN, (yyvsp[-5].drive), 0, (yyvsp[-1].gates), 0); }
+#line 11628 "parse.cc"
+    break;
+
+  case 610: /* module_item: attribute_list_opt IDENTIFIER parameter_value_opt gate_instance_list ';'  */
+#line 4208 "parse.y"
+                { perm_string tmp1 = lex_strings.make((yyvsp[-3].text));
+		  pform_make_modgates((yylsp[-3]), tmp1, (yyvsp[-2].parmvalue), (yyvsp[-1].gates));
+		  delete[](yyvsp[-3].text);
+		  if ((yyvsp[-4].named_pexprs)) delete (yyvsp[-4].named_pexprs);
+		}
+#line 11638 "parse.cc"
+    break;
+
+  case 611: /* module_item: attribute_list_opt IDENTIFIER parameter_value_opt error ';'  */
+#line 4216 "parse.y"
+                { yyerror((yylsp[-3]), "error: Invalid module instantiation");
+		  delete[](yyvsp[-3].text);
+		  if ((yyvsp[-4].named_pexprs)) delete (yyvsp[-4].named_pexprs);
+		}
+#line 11647 "parse.cc"
+    break;
+
+  case 612: /* module_item: K_assign drive_strength_opt delay3_opt cont_assign_list ';'  */
+#line 4226 "parse.y"
+                { pform_make_pgassign_list((yyvsp[-1].exprs), (yyvsp[-2].exprs), (yyvsp[-3].drive), (yylsp[-4]).text, (yylsp[-4]).first_line); }
+#line 11653 "parse.cc"
+    break;
+
+  case 613: /* module_item: attribute_list_opt K_always statement_item  */
+#line 4231 "parse.y"
+      { PProcess*tmp = pform_make_behavior(IVL_PR_ALWAYS, (yyvsp[0].statement), (yyvsp[-2].named_pexprs));
+	FILE_NAME(tmp, (yylsp[-1]));
+      }
+#line 11661 "parse.cc"
+    break;
+
+  case 614: /* module_item: attribute_list_opt K_initial statement_item  */
+#line 4235 "parse.y"
+      { PProcess*tmp = pform_make_behavior(IVL_PR_INITIAL, (yyvsp[0].statement), (yyvsp[-2].named_pexprs));
+	FILE_NAME(tmp, (yylsp[-1]));
+      }
+#line 11669 "parse.cc"
+    break;
+
+  case 615: /* module_item: attribute_list_opt K_final statement_item  */
+#line 4239 "parse.y"
+      { PProcess*tmp = pform_make_behavior(IVL_PR_FINAL, (yyvsp[0].statement), (yyvsp[-2].named_pexprs));
+	FILE_NAME(tmp, (yylsp[-1]));
+      }
+#line 11677 "parse.cc"
+    break;
+
+  case 616: /* module_item: attribute_list_opt K_analog analog_statement  */
+#line 4244 "parse.y"
+      { pform_make_analog_behavior((yylsp[-1]), IVL_PR_ALWAYS, (yyvsp[0].statement)); }
+#line 11683 "parse.cc"
+    break;
+
+  case 620: /* module_item: K_generate module_item_list_opt K_endgenerate  */
+#line 4259 "parse.y"
+     { // Test for bad nesting. I understand it, but it is illegal.
+       if (pform_parent_generate()) {
+	     cerr << (yylsp[-2]) << ": error: Generate/endgenerate regions cannot nest." << endl;
+	     cerr << (yylsp[-2]) << ":      : Try removing optional generate/endgenerate keywords," << endl;
+	     cerr << (yylsp[-2]) << ":      : or move them to surround the parent generate scheme." << endl;
+	     error_count += 1;
+	}
+      }
+#line 11696 "parse.cc"
+    break;
+
+  case 621: /* module_item: K_genvar list_of_identifiers ';'  */
+#line 4269 "parse.y"
+      { pform_genvars((yylsp[-2]), (yyvsp[-1].perm_strings)); }
+#line 11702 "parse.cc"
+    break;
+
+  case 622: /* $@24: %empty  */
+#line 4274 "parse.y"
+      { pform_start_generate_for((yylsp[-11]), (yyvsp[-9].text), (yyvsp[-7].expr), (yyvsp[-5].expr), (yyvsp[-3].text), (yyvsp[-1].expr)); }
+#line 11708 "parse.cc"
+    break;
+
+  case 623: /* module_item: K_for '(' IDENTIFIER '=' expression ';' expression ';' IDENTIFIER '=' expression ')' $@24 generate_block  */
+#line 4276 "parse.y"
+      { pform_endgenerate(); }
+#line 11714 "parse.cc"
+    break;
+
+  case 624: /* $@25: %empty  */
+#line 4281 "parse.y"
+      { pform_start_generate_else((yylsp[-2])); }
+#line 11720 "parse.cc"
+    break;
+
+  case 625: /* module_item: generate_if generate_block_opt K_else $@25 generate_block  */
+#line 4283 "parse.y"
+      { pform_endgenerate(); }
+#line 11726 "parse.cc"
+    break;
+
+  case 626: /* module_item: generate_if generate_block_opt  */
+#line 4287 "parse.y"
+      { pform_endgenerate(); }
+#line 11732 "parse.cc"
+    break;
+
+  case 627: /* $@26: %empty  */
+#line 4290 "parse.y"
+      { pform_start_generate_case((yylsp[-3]), (yyvsp[-1].expr)); }
+#line 11738 "parse.cc"
+    break;
+
+  case 628: /* module_item: K_case '(' expression ')' $@26 generate_case_items K_endcase  */
+#line 4293 "parse.y"
+      { pform_endgenerate(); }
+#line 11744 "parse.cc"
+    break;
+
+  case 629: /* module_item: K_generate K_begin module_item_list_opt K_end K_endgenerate  */
+#line 4297 "parse.y"
+      { /* Detect and warn about anachronistic begin/end use */
+	if (generation_flag > GN_VER2001 && warn_anachronisms) {
+	      warn_count += 1;
+	      cerr << (yylsp[-3]) << ": warning: Anachronistic use of begin/end to surround generate schemes." << endl;
+	}
+      }
+#line 11755 "parse.cc"
+    break;
+
+  case 630: /* $@27: %empty  */
+#line 4303 "parse.y"
+                                      {
+	pform_start_generate_nblock((yylsp[-2]), (yyvsp[0].text));
+      }
+#line 11763 "parse.cc"
+    break;
+
+  case 631: /* module_item: K_generate K_begin ':' IDENTIFIER $@27 module_item_list_opt K_end K_endgenerate  */
+#line 4306 "parse.y"
+      { /* Detect and warn about anachronistic named begin/end use */
+	if (generation_flag > GN_VER2001 && warn_anachronisms) {
+	      warn_count += 1;
+	      cerr << (yylsp[-6]) << ": warning: Anachronistic use of named begin/end to surround generate schemes." << endl;
+	}
+	pform_endgenerate();
+      }
+#line 11775 "parse.cc"
+    break;
+
+  case 634: /* module_item: K_specify K_endspecify  */
+#line 4323 "parse.y"
+                { /* empty lists are legal syntax. */ }
+#line 11781 "parse.cc"
+    break;
+
+  case 635: /* module_item: K_specify specify_item_list K_endspecify  */
+#line 4326 "parse.y"
+                {
+		}
+#line 11788 "parse.cc"
+    break;
+
+  case 636: /* module_item: K_specify error K_endspecify  */
+#line 4330 "parse.y"
+                { yyerror((yylsp[-2]), "error: syntax error in specify block");
+		  yyerrok;
+		}
+#line 11796 "parse.cc"
+    break;
+
+  case 637: /* module_item: error ';'  */
+#line 4339 "parse.y"
+                { yyerror((yylsp[0]), "error: invalid module item.");
+		  yyerrok;
+		}
+#line 11804 "parse.cc"
+    break;
+
+  case 638: /* module_item: K_assign error '=' expression ';'  */
+#line 4344 "parse.y"
+                { yyerror((yylsp[-4]), "error: syntax error in left side "
+			  "of continuous assignment.");
+		  yyerrok;
+		}
+#line 11813 "parse.cc"
+    break;
+
+  case 639: /* module_item: K_assign error ';'  */
+#line 4350 "parse.y"
+                { yyerror((yylsp[-2]), "error: syntax error in "
+			  "continuous assignment");
+		  yyerrok;
+		}
+#line 11822 "parse.cc"
+    break;
+
+  case 640: /* module_item: K_function error K_endfunction  */
+#line 4356 "parse.y"
+                { yyerror((yylsp[-2]), "error: I give up on this "
+			  "function definition.");
+		  yyerrok;
+		}
+#line 11831 "parse.cc"
+    break;
+
+  case 641: /* module_item: KK_attribute '(' IDENTIFIER ',' STRING ',' STRING ')' ';'  */
+#line 4365 "parse.y"
+                { perm_string tmp3 = lex_strings.make((yyvsp[-6].text));
+		  perm_string tmp5 = lex_strings.make((yyvsp[-4].text));
+		  pform_set_attrib(tmp3, tmp5, (yyvsp[-2].text));
+		  delete[] (yyvsp[-6].text);
+		  delete[] (yyvsp[-4].text);
+		}
+#line 11842 "parse.cc"
+    break;
+
+  case 642: /* module_item: KK_attribute '(' error ')' ';'  */
+#line 4372 "parse.y"
+                { yyerror((yylsp[-4]), "error: Malformed $attribute parameter list."); }
+#line 11848 "parse.cc"
+    break;
+
+  case 643: /* module_item: K_timeunit_check TIME_LITERAL ';'  */
+#line 4375 "parse.y"
+                { pform_set_timeunit((yyvsp[-1].text), true, true); }
+#line 11854 "parse.cc"
+    break;
+
+  case 644: /* module_item: K_timeprecision_check TIME_LITERAL ';'  */
+#line 4377 "parse.y"
+                { pform_set_timeprecision((yyvsp[-1].text), true, true); }
+#line 11860 "parse.cc"
+    break;
+
+  case 645: /* generate_if: K_if '(' expression ')'  */
+#line 4380 "parse.y"
+                                      { pform_start_generate_if((yylsp[-3]), (yyvsp[-1].expr)); }
+#line 11866 "parse.cc"
+    break;
+
+  case 648: /* $@28: %empty  */
+#line 4388 "parse.y"
+                               { pform_generate_case_item((yylsp[-1]), (yyvsp[-1].exprs)); }
+#line 11872 "parse.cc"
+    break;
+
+  case 649: /* generate_case_item: expression_list_proper ':' $@28 generate_block_opt  */
+#line 4389 "parse.y"
+      { pform_endgenerate(); }
+#line 11878 "parse.cc"
+    break;
+
+  case 650: /* $@29: %empty  */
+#line 4390 "parse.y"
+                  { pform_generate_case_item((yylsp[-1]), 0); }
+#line 11884 "parse.cc"
+    break;
+
+  case 651: /* generate_case_item: K_default ':' $@29 generate_block_opt  */
+#line 4391 "parse.y"
+      { pform_endgenerate(); }
+#line 11890 "parse.cc"
+    break;
+
+  case 658: /* generate_block: K_begin ':' IDENTIFIER module_item_list_opt K_end  */
+#line 4414 "parse.y"
+             { pform_generate_block_name((yyvsp[-2].text)); }
+#line 11896 "parse.cc"
+    break;
+
+  case 661: /* net_decl_assign: IDENTIFIER '=' expression  */
+#line 4429 "parse.y"
+      { net_decl_assign_t*tmp = new net_decl_assign_t;
+	tmp->next = tmp;
+	tmp->name = lex_strings.make((yyvsp[-2].text));
+	tmp->expr = (yyvsp[0].expr);
+	delete[](yyvsp[-2].text);
+	(yyval.net_decl_assign) = tmp;
+      }
+#line 11908 "parse.cc"
+    break;
+
+  case 662: /* net_decl_assigns: net_decl_assigns ',' net_decl_assign  */
+#line 4440 "parse.y"
+                { net_decl_assign_t*tmp = (yyvsp[-2].net_decl_assign);
+		  (yyvsp[0].net_decl_assign)->next = tmp->next;
+		  tmp->next = (yyvsp[0].net_decl_assign);
+		  (yyval.net_decl_assign) = tmp;
+		}
+#line 11918 "parse.cc"
+    break;
+
+  case 663: /* net_decl_assigns: net_decl_assign  */
+#line 4446 "parse.y"
+                { (yyval.net_decl_assign) = (yyvsp[0].net_decl_assign);
+		}
+#line 11925 "parse.cc"
+    break;
+
+  case 664: /* bit_logic: K_logic  */
+#line 4451 "parse.y"
+            { (yyval.vartype) = IVL_VT_LOGIC; }
+#line 11931 "parse.cc"
+    break;
+
+  case 665: /* bit_logic: K_bit  */
+#line 4452 "parse.y"
+            { (yyval.vartype) = IVL_VT_BOOL; /* IEEE1800 / IEEE1364-2009 */}
+#line 11937 "parse.cc"
+    break;
+
+  case 666: /* net_type: K_wire  */
+#line 4456 "parse.y"
+                    { (yyval.nettype) = NetNet::WIRE; }
+#line 11943 "parse.cc"
+    break;
+
+  case 667: /* net_type: K_tri  */
+#line 4457 "parse.y"
+                    { (yyval.nettype) = NetNet::TRI; }
+#line 11949 "parse.cc"
+    break;
+
+  case 668: /* net_type: K_tri1  */
+#line 4458 "parse.y"
+                    { (yyval.nettype) = NetNet::TRI1; }
+#line 11955 "parse.cc"
+    break;
+
+  case 669: /* net_type: K_supply0  */
+#line 4459 "parse.y"
+                    { (yyval.nettype) = NetNet::SUPPLY0; }
+#line 11961 "parse.cc"
+    break;
+
+  case 670: /* net_type: K_wand  */
+#line 4460 "parse.y"
+                    { (yyval.nettype) = NetNet::WAND; }
+#line 11967 "parse.cc"
+    break;
+
+  case 671: /* net_type: K_triand  */
+#line 4461 "parse.y"
+                    { (yyval.nettype) = NetNet::TRIAND; }
+#line 11973 "parse.cc"
+    break;
+
+  case 672: /* net_type: K_tri0  */
+#line 4462 "parse.y"
+                    { (yyval.nettype) = NetNet::TRI0; }
+#line 11979 "parse.cc"
+    break;
+
+  case 673: /* net_type: K_supply1  */
+#line 4463 "parse.y"
+                    { (yyval.nettype) = NetNet::SUPPLY1; }
+#line 11985 "parse.cc"
+    break;
+
+  case 674: /* net_type: K_wor  */
+#line 4464 "parse.y"
+                    { (yyval.nettype) = NetNet::WOR; }
+#line 11991 "parse.cc"
+    break;
+
+  case 675: /* net_type: K_trior  */
+#line 4465 "parse.y"
+                    { (yyval.nettype) = NetNet::TRIOR; }
+#line 11997 "parse.cc"
+    break;
+
+  case 676: /* net_type: K_wone  */
+#line 4466 "parse.y"
+                    { (yyval.nettype) = NetNet::UNRESOLVED_WIRE;
+		      cerr << (yylsp[0]).text << ":" << (yylsp[0]).first_line << ": warning: "
+		              "'wone' is deprecated, please use 'uwire' "
+		              "instead." << endl;
+		    }
+#line 12007 "parse.cc"
+    break;
+
+  case 677: /* net_type: K_uwire  */
+#line 4471 "parse.y"
+                    { (yyval.nettype) = NetNet::UNRESOLVED_WIRE; }
+#line 12013 "parse.cc"
+    break;
+
+  case 678: /* var_type: K_reg  */
+#line 4475 "parse.y"
+                { (yyval.nettype) = NetNet::REG; }
+#line 12019 "parse.cc"
+    break;
+
+  case 679: /* param_type: %empty  */
+#line 4480 "parse.y"
+      { param_active_range = 0;
+        param_active_signed = false;
+	param_active_type = IVL_VT_LOGIC;
+      }
+#line 12028 "parse.cc"
+    break;
+
+  case 680: /* param_type: range  */
+#line 4485 "parse.y"
+      { param_active_range = (yyvsp[0].ranges);
+        param_active_signed = false;
+	param_active_type = IVL_VT_LOGIC;
+      }
+#line 12037 "parse.cc"
+    break;
+
+  case 681: /* param_type: K_signed  */
+#line 4490 "parse.y"
+      { param_active_range = 0;
+	param_active_signed = true;
+	param_active_type = IVL_VT_LOGIC;
+      }
+#line 12046 "parse.cc"
+    break;
+
+  case 682: /* param_type: K_signed range  */
+#line 4495 "parse.y"
+      { param_active_range = (yyvsp[0].ranges);
+	param_active_signed = true;
+	param_active_type = IVL_VT_LOGIC;
+      }
+#line 12055 "parse.cc"
+    break;
+
+  case 683: /* param_type: K_integer  */
+#line 4500 "parse.y"
+      { param_active_range = make_range_from_width(integer_width);
+	param_active_signed = true;
+	param_active_type = IVL_VT_LOGIC;
+      }
+#line 12064 "parse.cc"
+    break;
+
+  case 684: /* param_type: K_time  */
+#line 4505 "parse.y"
+      { param_active_range = make_range_from_width(64);
+	param_active_signed = false;
+	param_active_type = IVL_VT_LOGIC;
+      }
+#line 12073 "parse.cc"
+    break;
+
+  case 685: /* param_type: real_or_realtime  */
+#line 4510 "parse.y"
+      { param_active_range = 0;
+	param_active_signed = true;
+	param_active_type = IVL_VT_REAL;
+      }
+#line 12082 "parse.cc"
+    break;
+
+  case 686: /* param_type: atom2_type  */
+#line 4515 "parse.y"
+      { param_active_range = make_range_from_width((yyvsp[0].int_val));
+	param_active_signed = true;
+	param_active_type = IVL_VT_BOOL;
+      }
+#line 12091 "parse.cc"
+    break;
+
+  case 691: /* parameter_assign: IDENTIFIER '=' expression parameter_value_ranges_opt  */
+#line 4538 "parse.y"
+      { PExpr*tmp = (yyvsp[-1].expr);
+	pform_set_parameter((yylsp[-3]), lex_strings.make((yyvsp[-3].text)), param_active_type,
+			    param_active_signed, param_active_range, tmp, (yyvsp[0].value_range));
+	delete[](yyvsp[-3].text);
+      }
+#line 12101 "parse.cc"
+    break;
+
+  case 692: /* localparam_assign: IDENTIFIER '=' expression  */
+#line 4547 "parse.y"
+      { PExpr*tmp = (yyvsp[0].expr);
+	pform_set_localparam((yylsp[-2]), lex_strings.make((yyvsp[-2].text)), param_active_type,
+			     param_active_signed, param_active_range, tmp);
+	delete[](yyvsp[-2].text);
+      }
+#line 12111 "parse.cc"
+    break;
+
+  case 693: /* parameter_value_ranges_opt: parameter_value_ranges  */
+#line 4554 "parse.y"
+                                                    { (yyval.value_range) = (yyvsp[0].value_range); }
+#line 12117 "parse.cc"
+    break;
+
+  case 694: /* parameter_value_ranges_opt: %empty  */
+#line 4554 "parse.y"
+                                                                   { (yyval.value_range) = 0; }
+#line 12123 "parse.cc"
+    break;
+
+  case 695: /* parameter_value_ranges: parameter_value_ranges parameter_value_range  */
+#line 4558 "parse.y"
+      { (yyval.value_range) = (yyvsp[0].value_range); (yyval.value_range)->next = (yyvsp[-1].value_range); }
+#line 12129 "parse.cc"
+    break;
+
+  case 696: /* parameter_value_ranges: parameter_value_range  */
+#line 4560 "parse.y"
+      { (yyval.value_range) = (yyvsp[0].value_range); (yyval.value_range)->next = 0; }
+#line 12135 "parse.cc"
+    break;
+
+  case 697: /* parameter_value_range: from_exclude '[' value_range_expression ':' value_range_expression ']'  */
+#line 4565 "parse.y"
+      { (yyval.value_range) = pform_parameter_value_range((yyvsp[-5].flag), false, (yyvsp[-3].expr), false, (yyvsp[-1].expr)); }
+#line 12141 "parse.cc"
+    break;
+
+  case 698: /* parameter_value_range: from_exclude '[' value_range_expression ':' value_range_expression ')'  */
+#line 4567 "parse.y"
+      { (yyval.value_range) = pform_parameter_value_range((yyvsp[-5].flag), false, (yyvsp[-3].expr), true, (yyvsp[-1].expr)); }
+#line 12147 "parse.cc"
+    break;
+
+  case 699: /* parameter_value_range: from_exclude '(' value_range_expression ':' value_range_expression ']'  */
+#line 4569 "parse.y"
+      { (yyval.value_range) = pform_parameter_value_range((yyvsp[-5].flag), true, (yyvsp[-3].expr), false, (yyvsp[-1].expr)); }
+#line 12153 "parse.cc"
+    break;
+
+  case 700: /* parameter_value_range: from_exclude '(' value_range_expression ':' value_range_expression ')'  */
+#line 4571 "parse.y"
+      { (yyval.value_range) = pform_parameter_value_range((yyvsp[-5].flag), true, (yyvsp[-3].expr), true, (yyvsp[-1].expr)); }
+#line 12159 "parse.cc"
+    break;
+
+  case 701: /* parameter_value_range: K_exclude expression  */
+#line 4573 "parse.y"
+      { (yyval.value_range) = pform_parameter_value_range(true, false, (yyvsp[0].expr), false, (yyvsp[0].expr)); }
+#line 12165 "parse.cc"
+    break;
+
+  case 702: /* value_range_expression: expression  */
+#line 4577 "parse.y"
+               { (yyval.expr) = (yyvsp[0].expr); }
+#line 12171 "parse.cc"
+    break;
+
+  case 703: /* value_range_expression: K_inf  */
+#line 4578 "parse.y"
+          { (yyval.expr) = 0; }
+#line 12177 "parse.cc"
+    break;
+
+  case 704: /* value_range_expression: '+' K_inf  */
+#line 4579 "parse.y"
+              { (yyval.expr) = 0; }
+#line 12183 "parse.cc"
+    break;
+
+  case 705: /* value_range_expression: '-' K_inf  */
+#line 4580 "parse.y"
+              { (yyval.expr) = 0; }
+#line 12189 "parse.cc"
+    break;
+
+  case 706: /* from_exclude: K_from  */
+#line 4583 "parse.y"
+                      { (yyval.flag) = false; }
+#line 12195 "parse.cc"
+    break;
+
+  case 707: /* from_exclude: K_exclude  */
+#line 4583 "parse.y"
+                                                  { (yyval.flag) = true; }
+#line 12201 "parse.cc"
+    break;
+
+  case 708: /* parameter_value_opt: '#' '(' expression_list_with_nuls ')'  */
+#line 4603 "parse.y"
+                { struct parmvalue_t*tmp = new struct parmvalue_t;
+		  tmp->by_order = (yyvsp[-1].exprs);
+		  tmp->by_name = 0;
+		  (yyval.parmvalue) = tmp;
+		}
+#line 12211 "parse.cc"
+    break;
+
+  case 709: /* parameter_value_opt: '#' '(' parameter_value_byname_list ')'  */
+#line 4609 "parse.y"
+                { struct parmvalue_t*tmp = new struct parmvalue_t;
+		  tmp->by_order = 0;
+		  tmp->by_name = (yyvsp[-1].named_pexprs);
+		  (yyval.parmvalue) = tmp;
+		}
+#line 12221 "parse.cc"
+    break;
+
+  case 710: /* parameter_value_opt: '#' DEC_NUMBER  */
+#line 4615 "parse.y"
+                { assert((yyvsp[0].number));
+		  PENumber*tmp = new PENumber((yyvsp[0].number));
+		  FILE_NAME(tmp, (yylsp[-1]));
+
+		  struct parmvalue_t*lst = new struct parmvalue_t;
+		  lst->by_order = new list<PExpr*>;
+		  lst->by_order->push_back(tmp);
+		  lst->by_name = 0;
+		  (yyval.parmvalue) = lst;
+		  based_size = 0;
+		}
+#line 12237 "parse.cc"
+    break;
+
+  case 711: /* parameter_value_opt: '#' REALTIME  */
+#line 4627 "parse.y"
+                { assert((yyvsp[0].realtime));
+		  PEFNumber*tmp = new PEFNumber((yyvsp[0].realtime));
+		  FILE_NAME(tmp, (yylsp[-1]));
+
+		  struct parmvalue_t*lst = new struct parmvalue_t;
+		  lst->by_order = new list<PExpr*>;
+		  lst->by_order->push_back(tmp);
+		  lst->by_name = 0;
+		  (yyval.parmvalue) = lst;
+		}
+#line 12252 "parse.cc"
+    break;
+
+  case 712: /* parameter_value_opt: '#' error  */
+#line 4638 "parse.y"
+                { yyerror((yylsp[-1]), "error: syntax error in parameter value "
+			  "assignment list.");
+		  (yyval.parmvalue) = 0;
+		}
+#line 12261 "parse.cc"
+    break;
+
+  case 713: /* parameter_value_opt: %empty  */
+#line 4643 "parse.y"
+                { (yyval.parmvalue) = 0; }
+#line 12267 "parse.cc"
+    break;
+
+  case 714: /* parameter_value_byname: '.' IDENTIFIER '(' expression ')'  */
+#line 4648 "parse.y"
+                { named_pexpr_t*tmp = new named_pexpr_t;
+		  tmp->name = lex_strings.make((yyvsp[-3].text));
+		  tmp->parm = (yyvsp[-1].expr);
+		  delete[](yyvsp[-3].text);
+		  (yyval.named_pexpr) = tmp;
+		}
+#line 12278 "parse.cc"
+    break;
+
+  case 715: /* parameter_value_byname: '.' IDENTIFIER '(' ')'  */
+#line 4655 "parse.y"
+                { named_pexpr_t*tmp = new named_pexpr_t;
+		  tmp->name = lex_strings.make((yyvsp[-2].text));
+		  tmp->parm = 0;
+		  delete[](yyvsp[-2].text);
+		  (yyval.named_pexpr) = tmp;
+		}
+#line 12289 "parse.cc"
+    break;
+
+  case 716: /* parameter_value_byname_list: parameter_value_byname  */
+#line 4665 "parse.y"
+      { list<named_pexpr_t>*tmp = new list<named_pexpr_t>;
+	tmp->push_back(*(yyvsp[0].named_pexpr));
+	delete (yyvsp[0].named_pexpr);
+	(yyval.named_pexprs) = tmp;
+      }
+#line 12299 "parse.cc"
+    break;
+
+  case 717: /* parameter_value_byname_list: parameter_value_byname_list ',' parameter_value_byname  */
+#line 4671 "parse.y"
+      { list<named_pexpr_t>*tmp = (yyvsp[-2].named_pexprs);
+	tmp->push_back(*(yyvsp[0].named_pexpr));
+	delete (yyvsp[0].named_pexpr);
+	(yyval.named_pexprs) = tmp;
+      }
+#line 12309 "parse.cc"
+    break;
+
+  case 718: /* port: port_reference  */
+#line 4694 "parse.y"
+                { (yyval.mport) = (yyvsp[0].mport); }
+#line 12315 "parse.cc"
+    break;
+
+  case 719: /* port: '.' IDENTIFIER '(' port_reference ')'  */
+#line 4702 "parse.y"
+                { Module::port_t*tmp = (yyvsp[-1].mport);
+		  tmp->name = lex_strings.make((yyvsp[-3].text));
+		  delete[](yyvsp[-3].text);
+		  (yyval.mport) = tmp;
+		}
+#line 12325 "parse.cc"
+    break;
+
+  case 720: /* port: '{' port_reference_list '}'  */
+#line 4713 "parse.y"
+                { Module::port_t*tmp = (yyvsp[-1].mport);
+		  tmp->name = perm_string();
+		  (yyval.mport) = tmp;
+		}
+#line 12334 "parse.cc"
+    break;
+
+  case 721: /* port: '.' IDENTIFIER '(' '{' port_reference_list '}' ')'  */
+#line 4722 "parse.y"
+                { Module::port_t*tmp = (yyvsp[-2].mport);
+		  tmp->name = lex_strings.make((yyvsp[-5].text));
+		  delete[](yyvsp[-5].text);
+		  (yyval.mport) = tmp;
+		}
+#line 12344 "parse.cc"
+    break;
+
+  case 722: /* port_opt: port  */
+#line 4730 "parse.y"
+               { (yyval.mport) = (yyvsp[0].mport); }
+#line 12350 "parse.cc"
+    break;
+
+  case 723: /* port_opt: %empty  */
+#line 4731 "parse.y"
+          { (yyval.mport) = 0; }
+#line 12356 "parse.cc"
+    break;
+
+  case 724: /* port_name: '.' IDENTIFIER '(' expression ')'  */
+#line 4740 "parse.y"
+                { named_pexpr_t*tmp = new named_pexpr_t;
+		  tmp->name = lex_strings.make((yyvsp[-3].text));
+		  tmp->parm = (yyvsp[-1].expr);
+		  delete[](yyvsp[-3].text);
+		  (yyval.named_pexpr) = tmp;
+		}
+#line 12367 "parse.cc"
+    break;
+
+  case 725: /* port_name: '.' IDENTIFIER '(' error ')'  */
+#line 4747 "parse.y"
+                { yyerror((yylsp[-2]), "error: invalid port connection expression.");
+		  named_pexpr_t*tmp = new named_pexpr_t;
+		  tmp->name = lex_strings.make((yyvsp[-3].text));
+		  tmp->parm = 0;
+		  delete[](yyvsp[-3].text);
+		  (yyval.named_pexpr) = tmp;
+		}
+#line 12379 "parse.cc"
+    break;
+
+  case 726: /* port_name: '.' IDENTIFIER '(' ')'  */
+#line 4755 "parse.y"
+                { named_pexpr_t*tmp = new named_pexpr_t;
+		  tmp->name = lex_strings.make((yyvsp[-2].text));
+		  tmp->parm = 0;
+		  delete[](yyvsp[-2].text);
+		  (yyval.named_pexpr) = tmp;
+		}
+#line 12390 "parse.cc"
+    break;
+
+  case 727: /* port_name: '.' IDENTIFIER  */
+#line 4762 "parse.y"
+                { named_pexpr_t*tmp = new named_pexpr_t;
+		  tmp->name = lex_strings.make((yyvsp[0].text));
+		  tmp->parm = new PEIdent(lex_strings.make((yyvsp[0].text)), true);
+		  FILE_NAME(tmp->parm, (yylsp[-1]));
+		  delete[](yyvsp[0].text);
+		  (yyval.named_pexpr) = tmp;
+		}
+#line 12402 "parse.cc"
+    break;
+
+  case 728: /* port_name: K_DOTSTAR  */
+#line 4770 "parse.y"
+                { named_pexpr_t*tmp = new named_pexpr_t;
+		  tmp->name = lex_strings.make("*");
+		  tmp->parm = 0;
+		  (yyval.named_pexpr) = tmp;
+		}
+#line 12412 "parse.cc"
+    break;
+
+  case 729: /* port_name_list: port_name_list ',' port_name  */
+#line 4779 "parse.y"
+      { list<named_pexpr_t>*tmp = (yyvsp[-2].named_pexprs);
+        tmp->push_back(*(yyvsp[0].named_pexpr));
+	delete (yyvsp[0].named_pexpr);
+	(yyval.named_pexprs) = tmp;
+      }
+#line 12422 "parse.cc"
+    break;
+
+  case 730: /* port_name_list: port_name  */
+#line 4785 "parse.y"
+      { list<named_pexpr_t>*tmp = new list<named_pexpr_t>;
+        tmp->push_back(*(yyvsp[0].named_pexpr));
+	delete (yyvsp[0].named_pexpr);
+	(yyval.named_pexprs) = tmp;
+      }
+#line 12432 "parse.cc"
+    break;
+
+  case 731: /* port_reference: IDENTIFIER  */
+#line 4806 "parse.y"
+        { Module::port_t*ptmp;
+	  perm_string name = lex_strings.make((yyvsp[0].text));
+	  ptmp = pform_module_port_reference(name, (yylsp[0]).text, (yylsp[0]).first_line);
+	  delete[](yyvsp[0].text);
+	  (yyval.mport) = ptmp;
+	}
+#line 12443 "parse.cc"
+    break;
+
+  case 732: /* port_reference: IDENTIFIER '[' expression ':' expression ']'  */
+#line 4814 "parse.y"
+        { index_component_t itmp;
+	  itmp.sel = index_component_t::SEL_PART;
+	  itmp.msb = (yyvsp[-3].expr);
+	  itmp.lsb = (yyvsp[-1].expr);
+
+	  name_component_t ntmp (lex_strings.make((yyvsp[-5].text)));
+	  ntmp.index.push_back(itmp);
+
+	  pform_name_t pname;
+	  pname.push_back(ntmp);
+
+	  PEIdent*wtmp = new PEIdent(pname);
+	  FILE_NAME(wtmp, (yylsp[-5]));
+
+	  Module::port_t*ptmp = new Module::port_t;
+	  ptmp->name = perm_string();
+	  ptmp->expr.push_back(wtmp);
+
+	  delete[](yyvsp[-5].text);
+	  (yyval.mport) = ptmp;
+	}
+#line 12469 "parse.cc"
+    break;
+
+  case 733: /* port_reference: IDENTIFIER '[' expression ']'  */
+#line 4837 "parse.y"
+        { index_component_t itmp;
+	  itmp.sel = index_component_t::SEL_BIT;
+	  itmp.msb = (yyvsp[-1].expr);
+	  itmp.lsb = 0;
+
+	  name_component_t ntmp (lex_strings.make((yyvsp[-3].text)));
+	  ntmp.index.push_back(itmp);
+
+	  pform_name_t pname;
+	  pname.push_back(ntmp);
+
+	  PEIdent*tmp = new PEIdent(pname);
+	  FILE_NAME(tmp, (yylsp[-3]));
+
+	  Module::port_t*ptmp = new Module::port_t;
+	  ptmp->name = perm_string();
+	  ptmp->expr.push_back(tmp);
+	  delete[](yyvsp[-3].text);
+	  (yyval.mport) = ptmp;
+	}
+#line 12494 "parse.cc"
+    break;
+
+  case 734: /* port_reference: IDENTIFIER '[' error ']'  */
+#line 4859 "parse.y"
+        { yyerror((yylsp[-3]), "error: invalid port bit select");
+	  Module::port_t*ptmp = new Module::port_t;
+	  PEIdent*wtmp = new PEIdent(lex_strings.make((yyvsp[-3].text)));
+	  FILE_NAME(wtmp, (yylsp[-3]));
+	  ptmp->name = lex_strings.make((yyvsp[-3].text));
+	  ptmp->expr.push_back(wtmp);
+	  delete[](yyvsp[-3].text);
+	  (yyval.mport) = ptmp;
+	}
+#line 12508 "parse.cc"
+    break;
+
+  case 735: /* port_reference_list: port_reference  */
+#line 4873 "parse.y"
+                { (yyval.mport) = (yyvsp[0].mport); }
+#line 12514 "parse.cc"
+    break;
+
+  case 736: /* port_reference_list: port_reference_list ',' port_reference  */
+#line 4875 "parse.y"
+                { Module::port_t*tmp = (yyvsp[-2].mport);
+		  append(tmp->expr, (yyvsp[0].mport)->expr);
+		  delete (yyvsp[0].mport);
+		  (yyval.mport) = tmp;
+		}
+#line 12524 "parse.cc"
+    break;
+
+  case 737: /* range: variable_dimension  */
+#line 4885 "parse.y"
+      { (yyval.ranges) = (yyvsp[0].ranges); }
+#line 12530 "parse.cc"
+    break;
+
+  case 738: /* range: range variable_dimension  */
+#line 4887 "parse.y"
+      { list<pform_range_t>*tmp = (yyvsp[-1].ranges);
+	if ((yyvsp[0].ranges)) {
+	      tmp->splice(tmp->end(), *(yyvsp[0].ranges));
+	      delete (yyvsp[0].ranges);
+	}
+	(yyval.ranges) = tmp;
+      }
+#line 12542 "parse.cc"
+    break;
+
+  case 740: /* range_opt: %empty  */
+#line 4898 "parse.y"
+    { (yyval.ranges) = 0; }
+#line 12548 "parse.cc"
+    break;
+
+  case 741: /* dimensions_opt: %empty  */
+#line 4902 "parse.y"
+    { (yyval.ranges) = 0; }
+#line 12554 "parse.cc"
+    break;
+
+  case 742: /* dimensions_opt: dimensions  */
+#line 4903 "parse.y"
+               { (yyval.ranges) = (yyvsp[0].ranges); }
+#line 12560 "parse.cc"
+    break;
+
+  case 743: /* dimensions: variable_dimension  */
+#line 4908 "parse.y"
+      { (yyval.ranges) = (yyvsp[0].ranges); }
+#line 12566 "parse.cc"
+    break;
+
+  case 744: /* dimensions: dimensions variable_dimension  */
+#line 4910 "parse.y"
+      { list<pform_range_t> *tmp = (yyvsp[-1].ranges);
+	if ((yyvsp[0].ranges)) {
+	      tmp->splice(tmp->end(), *(yyvsp[0].ranges));
+	      delete (yyvsp[0].ranges);
+	}
+	(yyval.ranges) = tmp;
+      }
+#line 12578 "parse.cc"
+    break;
+
+  case 745: /* function_range_or_type_opt: unsigned_signed_opt range_opt  */
+#line 4924 "parse.y"
+      { /* the default type is reg unsigned and no range */
+	(yyval.function_type).type = PTF_REG;
+	(yyval.function_type).range = (yyvsp[0].ranges);
+	if ((yyvsp[-1].flag))
+	      (yyval.function_type).type = PTF_REG_S;
+      }
+#line 12589 "parse.cc"
+    break;
+
+  case 746: /* function_range_or_type_opt: K_reg unsigned_signed_opt range_opt  */
+#line 4931 "parse.y"
+      { /* the default type is reg unsigned and no range */
+	(yyval.function_type).type = PTF_REG;
+	(yyval.function_type).range = (yyvsp[0].ranges);
+	if ((yyvsp[-1].flag))
+	      (yyval.function_type).type = PTF_REG_S;
+      }
+#line 12600 "parse.cc"
+    break;
+
+  case 747: /* function_range_or_type_opt: bit_logic unsigned_signed_opt range_opt  */
+#line 4938 "parse.y"
+      { /* the default type is bit/logic unsigned and no range */
+	(yyval.function_type).type  = PTF_REG;
+	(yyval.function_type).range = (yyvsp[0].ranges);
+	if ((yyvsp[-1].flag))
+	      (yyval.function_type).type = PTF_REG_S;
+      }
+#line 12611 "parse.cc"
+    break;
+
+  case 748: /* function_range_or_type_opt: K_integer  */
+#line 4944 "parse.y"
+               { (yyval.function_type).range = 0;  (yyval.function_type).type = PTF_INTEGER; }
+#line 12617 "parse.cc"
+    break;
+
+  case 749: /* function_range_or_type_opt: K_real  */
+#line 4945 "parse.y"
+               { (yyval.function_type).range = 0;  (yyval.function_type).type = PTF_REAL; }
+#line 12623 "parse.cc"
+    break;
+
+  case 750: /* function_range_or_type_opt: K_realtime  */
+#line 4946 "parse.y"
+               { (yyval.function_type).range = 0;  (yyval.function_type).type = PTF_REALTIME; }
+#line 12629 "parse.cc"
+    break;
+
+  case 751: /* function_range_or_type_opt: K_string  */
+#line 4947 "parse.y"
+               { (yyval.function_type).range = 0;  (yyval.function_type).type = PTF_STRING; }
+#line 12635 "parse.cc"
+    break;
+
+  case 752: /* function_range_or_type_opt: K_time  */
+#line 4948 "parse.y"
+               { (yyval.function_type).range = 0;  (yyval.function_type).type = PTF_TIME; }
+#line 12641 "parse.cc"
+    break;
+
+  case 753: /* function_range_or_type_opt: K_void  */
+#line 4949 "parse.y"
+               { (yyval.function_type).range = 0;  (yyval.function_type).type = PTF_VOID; }
+#line 12647 "parse.cc"
+    break;
+
+  case 754: /* function_range_or_type_opt: atom2_type  */
+#line 4950 "parse.y"
+               { (yyval.function_type).range = make_range_from_width((yyvsp[0].int_val)); (yyval.function_type).type = PTF_ATOM2_S; }
+#line 12653 "parse.cc"
+    break;
+
+  case 755: /* function_range_or_type_opt: atom2_type K_signed  */
+#line 4951 "parse.y"
+                         { (yyval.function_type).range = make_range_from_width((yyvsp[-1].int_val)); (yyval.function_type).type = PTF_ATOM2_S; }
+#line 12659 "parse.cc"
+    break;
+
+  case 756: /* function_range_or_type_opt: atom2_type K_unsigned  */
+#line 4952 "parse.y"
+                          { (yyval.function_type).range = make_range_from_width((yyvsp[-1].int_val)); (yyval.function_type).type = PTF_ATOM2; }
+#line 12665 "parse.cc"
+    break;
+
+  case 757: /* register_variable: IDENTIFIER dimensions_opt  */
+#line 4962 "parse.y"
+      { perm_string name = lex_strings.make((yyvsp[-1].text));
+	pform_makewire((yylsp[-1]), name, NetNet::REG,
+		       NetNet::NOT_A_PORT, IVL_VT_NO_TYPE, 0);
+	pform_set_reg_idx(name, (yyvsp[0].ranges));
+	(yyval.text) = (yyvsp[-1].text);
+      }
+#line 12676 "parse.cc"
+    break;
+
+  case 758: /* register_variable: IDENTIFIER '=' expression  */
+#line 4969 "parse.y"
+      { perm_string ident_name = lex_strings.make((yyvsp[-2].text));
+	pform_makewire((yylsp[-2]), ident_name, NetNet::REG,
+		       NetNet::NOT_A_PORT, IVL_VT_NO_TYPE, 0);
+	pform_make_reginit((yylsp[-2]), ident_name, (yyvsp[0].expr));
+	(yyval.text) = (yyvsp[-2].text);
+      }
+#line 12687 "parse.cc"
+    break;
+
+  case 759: /* register_variable_list: register_variable  */
+#line 4979 "parse.y"
+                { list<perm_string>*tmp = new list<perm_string>;
+		  tmp->push_back(lex_strings.make((yyvsp[0].text)));
+		  (yyval.perm_strings) = tmp;
+		  delete[](yyvsp[0].text);
+		}
+#line 12697 "parse.cc"
+    break;
+
+  case 760: /* register_variable_list: register_variable_list ',' register_variable  */
+#line 4985 "parse.y"
+                { list<perm_string>*tmp = (yyvsp[-2].perm_strings);
+		  tmp->push_back(lex_strings.make((yyvsp[0].text)));
+		  (yyval.perm_strings) = tmp;
+		  delete[](yyvsp[0].text);
+		}
+#line 12707 "parse.cc"
+    break;
+
+  case 761: /* net_variable: IDENTIFIER dimensions_opt  */
+#line 4994 "parse.y"
+      { perm_string name = lex_strings.make((yyvsp[-1].text));
+	pform_makewire((yylsp[-1]), name, NetNet::IMPLICIT,
+		       NetNet::NOT_A_PORT, IVL_VT_NO_TYPE, 0);
+	pform_set_reg_idx(name, (yyvsp[0].ranges));
+	(yyval.text) = (yyvsp[-1].text);
+      }
+#line 12718 "parse.cc"
+    break;
+
+  case 762: /* net_variable_list: net_variable  */
+#line 5004 "parse.y"
+                { list<perm_string>*tmp = new list<perm_string>;
+		  tmp->push_back(lex_strings.make((yyvsp[0].text)));
+		  (yyval.perm_strings) = tmp;
+		  delete[](yyvsp[0].text);
+		}
+#line 12728 "parse.cc"
+    break;
+
+  case 763: /* net_variable_list: net_variable_list ',' net_variable  */
+#line 5010 "parse.y"
+                { list<perm_string>*tmp = (yyvsp[-2].perm_strings);
+		  tmp->push_back(lex_strings.make((yyvsp[0].text)));
+		  (yyval.perm_strings) = tmp;
+		  delete[](yyvsp[0].text);
+		}
+#line 12738 "parse.cc"
+    break;
+
+  case 765: /* specify_item: specify_simple_path_decl ';'  */
+#line 5020 "parse.y"
+                { pform_module_specify_path((yyvsp[-1].specpath));
+		}
+#line 12745 "parse.cc"
+    break;
+
+  case 766: /* specify_item: specify_edge_path_decl ';'  */
+#line 5023 "parse.y"
+                { pform_module_specify_path((yyvsp[-1].specpath));
+		}
+#line 12752 "parse.cc"
+    break;
+
+  case 767: /* specify_item: K_if '(' expression ')' specify_simple_path_decl ';'  */
+#line 5026 "parse.y"
+                { PSpecPath*tmp = (yyvsp[-1].specpath);
+		  if (tmp) {
+			tmp->conditional = true;
+			tmp->condition = (yyvsp[-3].expr);
+		  }
+		  pform_module_specify_path(tmp);
+		}
+#line 12764 "parse.cc"
+    break;
+
+  case 768: /* specify_item: K_if '(' expression ')' specify_edge_path_decl ';'  */
+#line 5034 "parse.y"
+                { PSpecPath*tmp = (yyvsp[-1].specpath);
+		  if (tmp) {
+			tmp->conditional = true;
+			tmp->condition = (yyvsp[-3].expr);
+		  }
+		  pform_module_specify_path(tmp);
+		}
+#line 12776 "parse.cc"
+    break;
+
+  case 769: /* specify_item: K_ifnone specify_simple_path_decl ';'  */
+#line 5042 "parse.y"
+                { PSpecPath*tmp = (yyvsp[-1].specpath);
+		  if (tmp) {
+			tmp->conditional = true;
+			tmp->condition = 0;
+		  }
+		  pform_module_specify_path(tmp);
+		}
+#line 12788 "parse.cc"
+    break;
+
+  case 770: /* specify_item: K_ifnone specify_edge_path_decl ';'  */
+#line 5050 "parse.y"
+                { yyerror((yylsp[-2]), "Sorry: ifnone with an edge-sensitive path is "
+		              "not supported.");
+		  yyerrok;
+		}
+#line 12797 "parse.cc"
+    break;
+
+  case 771: /* specify_item: K_Sfullskew '(' spec_reference_event ',' spec_reference_event ',' delay_value ',' delay_value spec_notifier_opt ')' ';'  */
+#line 5056 "parse.y"
+                { delete (yyvsp[-5].expr);
+		  delete (yyvsp[-3].expr);
+		}
+#line 12805 "parse.cc"
+    break;
+
+  case 772: /* specify_item: K_Shold '(' spec_reference_event ',' spec_reference_event ',' delay_value spec_notifier_opt ')' ';'  */
+#line 5061 "parse.y"
+                { delete (yyvsp[-3].expr);
+		}
+#line 12812 "parse.cc"
+    break;
+
+  case 773: /* specify_item: K_Snochange '(' spec_reference_event ',' spec_reference_event ',' delay_value ',' delay_value spec_notifier_opt ')' ';'  */
+#line 5065 "parse.y"
+                { delete (yyvsp[-5].expr);
+		  delete (yyvsp[-3].expr);
+		}
+#line 12820 "parse.cc"
+    break;
+
+  case 774: /* specify_item: K_Speriod '(' spec_reference_event ',' delay_value spec_notifier_opt ')' ';'  */
+#line 5070 "parse.y"
+                { delete (yyvsp[-3].expr);
+		}
+#line 12827 "parse.cc"
+    break;
+
+  case 775: /* specify_item: K_Srecovery '(' spec_reference_event ',' spec_reference_event ',' delay_value spec_notifier_opt ')' ';'  */
+#line 5074 "parse.y"
+                { delete (yyvsp[-3].expr);
+		}
+#line 12834 "parse.cc"
+    break;
+
+  case 776: /* specify_item: K_Srecrem '(' spec_reference_event ',' spec_reference_event ',' delay_value ',' delay_value spec_notifier_opt ')' ';'  */
+#line 5078 "parse.y"
+                { delete (yyvsp[-5].expr);
+		  delete (yyvsp[-3].expr);
+		}
+#line 12842 "parse.cc"
+    break;
+
+  case 777: /* specify_item: K_Sremoval '(' spec_reference_event ',' spec_reference_event ',' delay_value spec_notifier_opt ')' ';'  */
+#line 5083 "parse.y"
+                { delete (yyvsp[-3].expr);
+		}
+#line 12849 "parse.cc"
+    break;
+
+  case 778: /* specify_item: K_Ssetup '(' spec_reference_event ',' spec_reference_event ',' delay_value spec_notifier_opt ')' ';'  */
+#line 5087 "parse.y"
+                { delete (yyvsp[-3].expr);
+		}
+#line 12856 "parse.cc"
+    break;
+
+  case 779: /* specify_item: K_Ssetuphold '(' spec_reference_event ',' spec_reference_event ',' delay_value ',' delay_value spec_notifier_opt ')' ';'  */
+#line 5091 "parse.y"
+                { delete (yyvsp[-5].expr);
+		  delete (yyvsp[-3].expr);
+		}
+#line 12864 "parse.cc"
+    break;
+
+  case 780: /* specify_item: K_Sskew '(' spec_reference_event ',' spec_reference_event ',' delay_value spec_notifier_opt ')' ';'  */
+#line 5096 "parse.y"
+                { delete (yyvsp[-3].expr);
+		}
+#line 12871 "parse.cc"
+    break;
+
+  case 781: /* specify_item: K_Stimeskew '(' spec_reference_event ',' spec_reference_event ',' delay_value spec_notifier_opt ')' ';'  */
+#line 5100 "parse.y"
+                { delete (yyvsp[-3].expr);
+		}
+#line 12878 "parse.cc"
+    break;
+
+  case 782: /* specify_item: K_Swidth '(' spec_reference_event ',' delay_value ',' expression spec_notifier_opt ')' ';'  */
+#line 5104 "parse.y"
+                { delete (yyvsp[-5].expr);
+		  delete (yyvsp[-3].expr);
+		}
+#line 12886 "parse.cc"
+    break;
+
+  case 783: /* specify_item: K_Swidth '(' spec_reference_event ',' delay_value ')' ';'  */
+#line 5108 "parse.y"
+                { delete (yyvsp[-2].expr);
+		}
+#line 12893 "parse.cc"
+    break;
+
+  case 784: /* specify_item: K_pulsestyle_onevent specify_path_identifiers ';'  */
+#line 5111 "parse.y"
+                { delete (yyvsp[-1].perm_strings);
+		}
+#line 12900 "parse.cc"
+    break;
+
+  case 785: /* specify_item: K_pulsestyle_ondetect specify_path_identifiers ';'  */
+#line 5114 "parse.y"
+                { delete (yyvsp[-1].perm_strings);
+		}
+#line 12907 "parse.cc"
+    break;
+
+  case 786: /* specify_item: K_showcancelled specify_path_identifiers ';'  */
+#line 5117 "parse.y"
+                { delete (yyvsp[-1].perm_strings);
+		}
+#line 12914 "parse.cc"
+    break;
+
+  case 787: /* specify_item: K_noshowcancelled specify_path_identifiers ';'  */
+#line 5120 "parse.y"
+                { delete (yyvsp[-1].perm_strings);
+		}
+#line 12921 "parse.cc"
+    break;
+
+  case 790: /* specify_edge_path_decl: specify_edge_path '=' '(' delay_value_list ')'  */
+#line 5131 "parse.y"
+                { (yyval.specpath) = pform_assign_path_delay((yyvsp[-4].specpath), (yyvsp[-1].exprs)); }
+#line 12927 "parse.cc"
+    break;
+
+  case 791: /* specify_edge_path_decl: specify_edge_path '=' delay_value_simple  */
+#line 5133 "parse.y"
+                { list<PExpr*>*tmp = new list<PExpr*>;
+		  tmp->push_back((yyvsp[0].expr));
+		  (yyval.specpath) = pform_assign_path_delay((yyvsp[-2].specpath), tmp);
+		}
+#line 12936 "parse.cc"
+    break;
+
+  case 792: /* edge_operator: K_posedge  */
+#line 5139 "parse.y"
+                          { (yyval.flag) = true; }
+#line 12942 "parse.cc"
+    break;
+
+  case 793: /* edge_operator: K_negedge  */
+#line 5139 "parse.y"
+                                                     { (yyval.flag) = false; }
+#line 12948 "parse.cc"
+    break;
+
+  case 794: /* specify_edge_path: '(' specify_path_identifiers spec_polarity K_EG '(' specify_path_identifiers polarity_operator expression ')' ')'  */
+#line 5144 "parse.y"
+                    { int edge_flag = 0;
+		      (yyval.specpath) = pform_make_specify_edge_path((yylsp[-9]), edge_flag, (yyvsp[-8].perm_strings), (yyvsp[-7].letter), false, (yyvsp[-4].perm_strings), (yyvsp[-2].expr)); }
+#line 12955 "parse.cc"
+    break;
+
+  case 795: /* specify_edge_path: '(' edge_operator specify_path_identifiers spec_polarity K_EG '(' specify_path_identifiers polarity_operator expression ')' ')'  */
+#line 5148 "parse.y"
+                    { int edge_flag = (yyvsp[-9].flag)? 1 : -1;
+		      (yyval.specpath) = pform_make_specify_edge_path((yylsp[-10]), edge_flag, (yyvsp[-8].perm_strings), (yyvsp[-7].letter), false, (yyvsp[-4].perm_strings), (yyvsp[-2].expr));}
+#line 12962 "parse.cc"
+    break;
+
+  case 796: /* specify_edge_path: '(' specify_path_identifiers spec_polarity K_SG '(' specify_path_identifiers polarity_operator expression ')' ')'  */
+#line 5152 "parse.y"
+                    { int edge_flag = 0;
+		      (yyval.specpath) = pform_make_specify_edge_path((yylsp[-9]), edge_flag, (yyvsp[-8].perm_strings), (yyvsp[-7].letter), true, (yyvsp[-4].perm_strings), (yyvsp[-2].expr)); }
+#line 12969 "parse.cc"
+    break;
+
+  case 797: /* specify_edge_path: '(' edge_operator specify_path_identifiers spec_polarity K_SG '(' specify_path_identifiers polarity_operator expression ')' ')'  */
+#line 5156 "parse.y"
+                    { int edge_flag = (yyvsp[-9].flag)? 1 : -1;
+		      (yyval.specpath) = pform_make_specify_edge_path((yylsp[-10]), edge_flag, (yyvsp[-8].perm_strings), (yyvsp[-7].letter), true, (yyvsp[-4].perm_strings), (yyvsp[-2].expr)); }
+#line 12976 "parse.cc"
+    break;
+
+  case 801: /* specify_simple_path_decl: specify_simple_path '=' '(' delay_value_list ')'  */
+#line 5168 "parse.y"
+                { (yyval.specpath) = pform_assign_path_delay((yyvsp[-4].specpath), (yyvsp[-1].exprs)); }
+#line 12982 "parse.cc"
+    break;
+
+  case 802: /* specify_simple_path_decl: specify_simple_path '=' delay_value_simple  */
+#line 5170 "parse.y"
+                { list<PExpr*>*tmp = new list<PExpr*>;
+		  tmp->push_back((yyvsp[0].expr));
+		  (yyval.specpath) = pform_assign_path_delay((yyvsp[-2].specpath), tmp);
+		}
+#line 12991 "parse.cc"
+    break;
+
+  case 803: /* specify_simple_path_decl: specify_simple_path '=' '(' error ')'  */
+#line 5175 "parse.y"
+                { yyerror((yylsp[-2]), "Syntax error in delay value list.");
+		  yyerrok;
+		  (yyval.specpath) = 0;
+		}
+#line 13000 "parse.cc"
+    break;
+
+  case 804: /* specify_simple_path: '(' specify_path_identifiers spec_polarity K_EG specify_path_identifiers ')'  */
+#line 5184 "parse.y"
+                { (yyval.specpath) = pform_make_specify_path((yylsp[-5]), (yyvsp[-4].perm_strings), (yyvsp[-3].letter), false, (yyvsp[-1].perm_strings)); }
+#line 13006 "parse.cc"
+    break;
+
+  case 805: /* specify_simple_path: '(' specify_path_identifiers spec_polarity K_SG specify_path_identifiers ')'  */
+#line 5187 "parse.y"
+                { (yyval.specpath) = pform_make_specify_path((yylsp[-5]), (yyvsp[-4].perm_strings), (yyvsp[-3].letter), true, (yyvsp[-1].perm_strings)); }
+#line 13012 "parse.cc"
+    break;
+
+  case 806: /* specify_simple_path: '(' error ')'  */
+#line 5189 "parse.y"
+                { yyerror((yylsp[-2]), "Invalid simple path");
+		  yyerrok;
+		}
+#line 13020 "parse.cc"
+    break;
+
+  case 807: /* specify_path_identifiers: IDENTIFIER  */
+#line 5196 "parse.y"
+                { list<perm_string>*tmp = new list<perm_string>;
+		  tmp->push_back(lex_strings.make((yyvsp[0].text)));
+		  (yyval.perm_strings) = tmp;
+		  delete[](yyvsp[0].text);
+		}
+#line 13030 "parse.cc"
+    break;
+
+  case 808: /* specify_path_identifiers: IDENTIFIER '[' expr_primary ']'  */
+#line 5202 "parse.y"
+                { list<perm_string>*tmp = new list<perm_string>;
+		  tmp->push_back(lex_strings.make((yyvsp[-3].text)));
+		  (yyval.perm_strings) = tmp;
+		  delete[](yyvsp[-3].text);
+		}
+#line 13040 "parse.cc"
+    break;
+
+  case 809: /* specify_path_identifiers: specify_path_identifiers ',' IDENTIFIER  */
+#line 5208 "parse.y"
+                { list<perm_string>*tmp = (yyvsp[-2].perm_strings);
+		  tmp->push_back(lex_strings.make((yyvsp[0].text)));
+		  (yyval.perm_strings) = tmp;
+		  delete[](yyvsp[0].text);
+		}
+#line 13050 "parse.cc"
+    break;
+
+  case 810: /* specify_path_identifiers: specify_path_identifiers ',' IDENTIFIER '[' expr_primary ']'  */
+#line 5214 "parse.y"
+                { list<perm_string>*tmp = (yyvsp[-5].perm_strings);
+		  tmp->push_back(lex_strings.make((yyvsp[-3].text)));
+		  (yyval.perm_strings) = tmp;
+		  delete[](yyvsp[-3].text);
+		}
+#line 13060 "parse.cc"
+    break;
+
+  case 811: /* specparam: IDENTIFIER '=' expression  */
+#line 5223 "parse.y"
+                { PExpr*tmp = (yyvsp[0].expr);
+		  pform_set_specparam((yylsp[-2]), lex_strings.make((yyvsp[-2].text)),
+		                      param_active_range, tmp);
+		  delete[](yyvsp[-2].text);
+		}
+#line 13070 "parse.cc"
+    break;
+
+  case 812: /* specparam: IDENTIFIER '=' expression ':' expression ':' expression  */
+#line 5229 "parse.y"
+                { PExpr*tmp = 0;
+		  switch (min_typ_max_flag) {
+		      case MIN:
+			tmp = (yyvsp[-4].expr);
+			delete (yyvsp[-2].expr);
+			delete (yyvsp[0].expr);
+			break;
+		      case TYP:
+			delete (yyvsp[-4].expr);
+			tmp = (yyvsp[-2].expr);
+			delete (yyvsp[0].expr);
+			break;
+		      case MAX:
+			delete (yyvsp[-4].expr);
+			delete (yyvsp[-2].expr);
+			tmp = (yyvsp[0].expr);
+			break;
+		  }
+		  if (min_typ_max_warn > 0) {
+		        cerr << tmp->get_fileline() << ": warning: choosing ";
+		        switch (min_typ_max_flag) {
+		            case MIN:
+		              cerr << "min";
+		              break;
+		            case TYP:
+		              cerr << "typ";
+		              break;
+		            case MAX:
+		              cerr << "max";
+		              break;
+		        }
+		        cerr << " expression." << endl;
+		        min_typ_max_warn -= 1;
+		  }
+		  pform_set_specparam((yylsp[-6]), lex_strings.make((yyvsp[-6].text)),
+		                      param_active_range, tmp);
+		  delete[](yyvsp[-6].text);
+		}
+#line 13113 "parse.cc"
+    break;
+
+  case 813: /* specparam: PATHPULSE_IDENTIFIER '=' expression  */
+#line 5268 "parse.y"
+                { delete[](yyvsp[-2].text);
+		  delete (yyvsp[0].expr);
+		}
+#line 13121 "parse.cc"
+    break;
+
+  case 814: /* specparam: PATHPULSE_IDENTIFIER '=' '(' expression ',' expression ')'  */
+#line 5272 "parse.y"
+                { delete[](yyvsp[-6].text);
+		  delete (yyvsp[-3].expr);
+		  delete (yyvsp[-1].expr);
+		}
+#line 13130 "parse.cc"
+    break;
+
+  case 818: /* $@30: %empty  */
+#line 5286 "parse.y"
+      { param_active_range = (yyvsp[0].ranges); }
+#line 13136 "parse.cc"
+    break;
+
+  case 819: /* specparam_decl: range $@30 specparam_list  */
+#line 5288 "parse.y"
+      { param_active_range = 0; }
+#line 13142 "parse.cc"
+    break;
+
+  case 820: /* spec_polarity: '+'  */
+#line 5292 "parse.y"
+               { (yyval.letter) = '+'; }
+#line 13148 "parse.cc"
+    break;
+
+  case 821: /* spec_polarity: '-'  */
+#line 5293 "parse.y"
+               { (yyval.letter) = '-'; }
+#line 13154 "parse.cc"
+    break;
+
+  case 822: /* spec_polarity: %empty  */
+#line 5294 "parse.y"
+               { (yyval.letter) = 0;   }
+#line 13160 "parse.cc"
+    break;
+
+  case 823: /* spec_reference_event: K_posedge expression  */
+#line 5299 "parse.y"
+    { delete (yyvsp[0].expr); }
+#line 13166 "parse.cc"
+    break;
+
+  case 824: /* spec_reference_event: K_negedge expression  */
+#line 5301 "parse.y"
+    { delete (yyvsp[0].expr); }
+#line 13172 "parse.cc"
+    break;
+
+  case 825: /* spec_reference_event: K_posedge expr_primary K_TAND expression  */
+#line 5303 "parse.y"
+    { delete (yyvsp[-2].expr);
+      delete (yyvsp[0].expr);
+    }
+#line 13180 "parse.cc"
+    break;
+
+  case 826: /* spec_reference_event: K_negedge expr_primary K_TAND expression  */
+#line 5307 "parse.y"
+    { delete (yyvsp[-2].expr);
+      delete (yyvsp[0].expr);
+    }
+#line 13188 "parse.cc"
+    break;
+
+  case 827: /* spec_reference_event: K_edge '[' edge_descriptor_list ']' expr_primary  */
+#line 5311 "parse.y"
+    { delete (yyvsp[0].expr); }
+#line 13194 "parse.cc"
+    break;
+
+  case 828: /* spec_reference_event: K_edge '[' edge_descriptor_list ']' expr_primary K_TAND expression  */
+#line 5313 "parse.y"
+    { delete (yyvsp[-2].expr);
+      delete (yyvsp[0].expr);
+    }
+#line 13202 "parse.cc"
+    break;
+
+  case 829: /* spec_reference_event: expr_primary K_TAND expression  */
+#line 5317 "parse.y"
+    { delete (yyvsp[-2].expr);
+      delete (yyvsp[0].expr);
+    }
+#line 13210 "parse.cc"
+    break;
+
+  case 830: /* spec_reference_event: expr_primary  */
+#line 5321 "parse.y"
+    { delete (yyvsp[0].expr); }
+#line 13216 "parse.cc"
+    break;
+
+  case 833: /* spec_notifier_opt: %empty  */
+#line 5335 "parse.y"
+                {  }
+#line 13222 "parse.cc"
+    break;
+
+  case 834: /* spec_notifier_opt: spec_notifier  */
+#line 5337 "parse.y"
+                {  }
+#line 13228 "parse.cc"
+    break;
+
+  case 835: /* spec_notifier: ','  */
+#line 5341 "parse.y"
+                { args_after_notifier = 0; }
+#line 13234 "parse.cc"
+    break;
+
+  case 836: /* spec_notifier: ',' hierarchy_identifier  */
+#line 5343 "parse.y"
+                { args_after_notifier = 0; delete (yyvsp[0].pform_name); }
+#line 13240 "parse.cc"
+    break;
+
+  case 837: /* spec_notifier: spec_notifier ','  */
+#line 5345 "parse.y"
+                {  args_after_notifier += 1; }
+#line 13246 "parse.cc"
+    break;
+
+  case 838: /* spec_notifier: spec_notifier ',' hierarchy_identifier  */
+#line 5347 "parse.y"
+                { args_after_notifier += 1;
+		  if (args_after_notifier >= 3)  {
+                    cerr << (yylsp[0]) << ": warning: timing checks are not supported "
+		                  "and delayed signal \"" << *(yyvsp[0].pform_name)
+		         << "\" will not be driven." << endl;
+		  }
+                  delete (yyvsp[0].pform_name); }
+#line 13258 "parse.cc"
+    break;
+
+  case 839: /* spec_notifier: IDENTIFIER  */
+#line 5356 "parse.y"
+                { args_after_notifier = 0; delete[](yyvsp[0].text); }
+#line 13264 "parse.cc"
+    break;
+
+  case 840: /* statement_item: K_assign lpvalue '=' expression ';'  */
+#line 5368 "parse.y"
+                { PCAssign*tmp = new PCAssign((yyvsp[-3].expr), (yyvsp[-1].expr));
+		  FILE_NAME(tmp, (yylsp[-4]));
+		  (yyval.statement) = tmp;
+		}
+#line 13273 "parse.cc"
+    break;
+
+  case 841: /* statement_item: K_deassign lpvalue ';'  */
+#line 5374 "parse.y"
+                { PDeassign*tmp = new PDeassign((yyvsp[-1].expr));
+		  FILE_NAME(tmp, (yylsp[-2]));
+		  (yyval.statement) = tmp;
+		}
+#line 13282 "parse.cc"
+    break;
+
+  case 842: /* statement_item: K_force lpvalue '=' expression ';'  */
+#line 5384 "parse.y"
+                { PForce*tmp = new PForce((yyvsp[-3].expr), (yyvsp[-1].expr));
+		  FILE_NAME(tmp, (yylsp[-4]));
+		  (yyval.statement) = tmp;
+		}
+#line 13291 "parse.cc"
+    break;
+
+  case 843: /* statement_item: K_release lpvalue ';'  */
+#line 5389 "parse.y"
+                { PRelease*tmp = new PRelease((yyvsp[-1].expr));
+		  FILE_NAME(tmp, (yylsp[-2]));
+		  (yyval.statement) = tmp;
+		}
+#line 13300 "parse.cc"
+    break;
+
+  case 844: /* statement_item: K_begin K_end  */
+#line 5401 "parse.y"
+      { PBlock*tmp = new PBlock(PBlock::BL_SEQ);
+	FILE_NAME(tmp, (yylsp[-1]));
+	(yyval.statement) = tmp;
+      }
+#line 13309 "parse.cc"
+    break;
+
+  case 845: /* statement_item: K_begin statement_or_null_list K_end  */
+#line 5406 "parse.y"
+      { PBlock*tmp = new PBlock(PBlock::BL_SEQ);
+	FILE_NAME(tmp, (yylsp[-2]));
+	tmp->set_statement(*(yyvsp[-1].statement_list));
+	delete (yyvsp[-1].statement_list);
+	(yyval.statement) = tmp;
+      }
+#line 13320 "parse.cc"
+    break;
+
+  case 846: /* $@31: %empty  */
+#line 5413 "parse.y"
+      { PBlock*tmp = pform_push_block_scope((yyvsp[0].text), PBlock::BL_SEQ);
+	FILE_NAME(tmp, (yylsp[-2]));
+	current_block_stack.push(tmp);
+      }
+#line 13329 "parse.cc"
+    break;
+
+  case 847: /* statement_item: K_begin ':' IDENTIFIER $@31 block_item_decls_opt statement_or_null_list_opt K_end  */
+#line 5419 "parse.y"
+      { pform_pop_scope();
+	assert(! current_block_stack.empty());
+	PBlock*tmp = current_block_stack.top();
+	current_block_stack.pop();
+	if ((yyvsp[-1].statement_list)) tmp->set_statement(*(yyvsp[-1].statement_list));
+	delete[](yyvsp[-4].text);
+	delete (yyvsp[-1].statement_list);
+	(yyval.statement) = tmp;
+      }
+#line 13343 "parse.cc"
+    break;
+
+  case 848: /* statement_item: K_fork join_keyword  */
+#line 5435 "parse.y"
+      { PBlock*tmp = new PBlock((yyvsp[0].join_keyword));
+	FILE_NAME(tmp, (yylsp[-1]));
+	(yyval.statement) = tmp;
+      }
+#line 13352 "parse.cc"
+    break;
+
+  case 849: /* statement_item: K_fork statement_or_null_list join_keyword  */
+#line 5440 "parse.y"
+      { PBlock*tmp = new PBlock((yyvsp[0].join_keyword));
+	FILE_NAME(tmp, (yylsp[-2]));
+	tmp->set_statement(*(yyvsp[-1].statement_list));
+	delete (yyvsp[-1].statement_list);
+	(yyval.statement) = tmp;
+      }
+#line 13363 "parse.cc"
+    break;
+
+  case 850: /* $@32: %empty  */
+#line 5447 "parse.y"
+      { PBlock*tmp = pform_push_block_scope((yyvsp[0].text), PBlock::BL_PAR);
+	FILE_NAME(tmp, (yylsp[-2]));
+	current_block_stack.push(tmp);
+      }
+#line 13372 "parse.cc"
+    break;
+
+  case 851: /* statement_item: K_fork ':' IDENTIFIER $@32 block_item_decls_opt statement_or_null_list_opt join_keyword  */
+#line 5453 "parse.y"
+      { pform_pop_scope();
+        assert(! current_block_stack.empty());
+	PBlock*tmp = current_block_stack.top();
+	current_block_stack.pop();
+	tmp->set_join_type((yyvsp[0].join_keyword));
+	if ((yyvsp[-1].statement_list)) tmp->set_statement(*(yyvsp[-1].statement_list));
+	delete[](yyvsp[-4].text);
+	delete (yyvsp[-1].statement_list);
+	(yyval.statement) = tmp;
+      }
+#line 13387 "parse.cc"
+    break;
+
+  case 852: /* statement_item: K_disable hierarchy_identifier ';'  */
+#line 5465 "parse.y"
+                { PDisable*tmp = new PDisable(*(yyvsp[-1].pform_name));
+		  FILE_NAME(tmp, (yylsp[-2]));
+		  delete (yyvsp[-1].pform_name);
+		  (yyval.statement) = tmp;
+		}
+#line 13397 "parse.cc"
+    break;
+
+  case 853: /* statement_item: K_TRIGGER hierarchy_identifier ';'  */
+#line 5471 "parse.y"
+                { PTrigger*tmp = new PTrigger(*(yyvsp[-1].pform_name));
+		  FILE_NAME(tmp, (yylsp[-2]));
+		  delete (yyvsp[-1].pform_name);
+		  (yyval.statement) = tmp;
+		}
+#line 13407 "parse.cc"
+    break;
+
+  case 854: /* statement_item: loop_statement  */
+#line 5477 "parse.y"
+                   { (yyval.statement) = (yyvsp[0].statement); }
+#line 13413 "parse.cc"
+    break;
+
+  case 855: /* statement_item: jump_statement  */
+#line 5479 "parse.y"
+                   { (yyval.statement) = (yyvsp[0].statement); }
+#line 13419 "parse.cc"
+    break;
+
+  case 856: /* statement_item: K_case '(' expression ')' case_items K_endcase  */
+#line 5482 "parse.y"
+                { PCase*tmp = new PCase(NetCase::EQ, (yyvsp[-3].expr), (yyvsp[-1].citems));
+		  FILE_NAME(tmp, (yylsp[-5]));
+		  (yyval.statement) = tmp;
+		}
+#line 13428 "parse.cc"
+    break;
+
+  case 857: /* statement_item: K_casex '(' expression ')' case_items K_endcase  */
+#line 5487 "parse.y"
+                { PCase*tmp = new PCase(NetCase::EQX, (yyvsp[-3].expr), (yyvsp[-1].citems));
+		  FILE_NAME(tmp, (yylsp[-5]));
+		  (yyval.statement) = tmp;
+		}
+#line 13437 "parse.cc"
+    break;
+
+  case 858: /* statement_item: K_casez '(' expression ')' case_items K_endcase  */
+#line 5492 "parse.y"
+                { PCase*tmp = new PCase(NetCase::EQZ, (yyvsp[-3].expr), (yyvsp[-1].citems));
+		  FILE_NAME(tmp, (yylsp[-5]));
+		  (yyval.statement) = tmp;
+		}
+#line 13446 "parse.cc"
+    break;
+
+  case 859: /* statement_item: K_case '(' expression ')' error K_endcase  */
+#line 5497 "parse.y"
+                { yyerrok; }
+#line 13452 "parse.cc"
+    break;
+
+  case 860: /* statement_item: K_casex '(' expression ')' error K_endcase  */
+#line 5499 "parse.y"
+                { yyerrok; }
+#line 13458 "parse.cc"
+    break;
+
+  case 861: /* statement_item: K_casez '(' expression ')' error K_endcase  */
+#line 5501 "parse.y"
+                { yyerrok; }
+#line 13464 "parse.cc"
+    break;
+
+  case 862: /* statement_item: K_if '(' expression ')' statement_or_null  */
+#line 5503 "parse.y"
+                { PCondit*tmp = new PCondit((yyvsp[-2].expr), (yyvsp[0].statement), 0);
+		  FILE_NAME(tmp, (yylsp[-4]));
+		  (yyval.statement) = tmp;
+		}
+#line 13473 "parse.cc"
+    break;
+
+  case 863: /* statement_item: K_if '(' expression ')' statement_or_null K_else statement_or_null  */
+#line 5508 "parse.y"
+                { PCondit*tmp = new PCondit((yyvsp[-4].expr), (yyvsp[-2].statement), (yyvsp[0].statement));
+		  FILE_NAME(tmp, (yylsp[-6]));
+		  (yyval.statement) = tmp;
+		}
+#line 13482 "parse.cc"
+    break;
+
+  case 864: /* statement_item: K_if '(' error ')' statement_or_null  */
+#line 5513 "parse.y"
+                { yyerror((yylsp[-4]), "error: Malformed conditional expression.");
+		  (yyval.statement) = (yyvsp[0].statement);
+		}
+#line 13490 "parse.cc"
+    break;
+
+  case 865: /* statement_item: K_if '(' error ')' statement_or_null K_else statement_or_null  */
+#line 5517 "parse.y"
+                { yyerror((yylsp[-6]), "error: Malformed conditional expression.");
+		  (yyval.statement) = (yyvsp[-2].statement);
+		}
+#line 13498 "parse.cc"
+    break;
+
+  case 866: /* statement_item: compressed_statement ';'  */
+#line 5523 "parse.y"
+      { (yyval.statement) = (yyvsp[-1].statement); }
+#line 13504 "parse.cc"
+    break;
+
+  case 867: /* statement_item: inc_or_dec_expression ';'  */
+#line 5529 "parse.y"
+      { (yyval.statement) = pform_compressed_assign_from_inc_dec((yylsp[-1]), (yyvsp[-1].expr)); }
+#line 13510 "parse.cc"
+    break;
+
+  case 868: /* statement_item: delay1 statement_or_null  */
+#line 5534 "parse.y"
+      { PExpr*del = (yyvsp[-1].exprs)->front();
+	assert((yyvsp[-1].exprs)->size() == 1);
+	delete (yyvsp[-1].exprs);
+	PDelayStatement*tmp = new PDelayStatement(del, (yyvsp[0].statement));
+	FILE_NAME(tmp, (yylsp[-1]));
+	(yyval.statement) = tmp;
+      }
+#line 13522 "parse.cc"
+    break;
+
+  case 869: /* statement_item: event_control statement_or_null  */
+#line 5543 "parse.y"
+      { PEventStatement*tmp = (yyvsp[-1].event_statement);
+	if (tmp == 0) {
+	      yyerror((yylsp[-1]), "error: Invalid event control.");
+	      (yyval.statement) = 0;
+	} else {
+	      tmp->set_statement((yyvsp[0].statement));
+	      (yyval.statement) = tmp;
+	}
+      }
+#line 13536 "parse.cc"
+    break;
+
+  case 870: /* statement_item: '@' '*' statement_or_null  */
+#line 5553 "parse.y"
+      { PEventStatement*tmp = new PEventStatement;
+	FILE_NAME(tmp, (yylsp[-2]));
+	tmp->set_statement((yyvsp[0].statement));
+	(yyval.statement) = tmp;
+      }
+#line 13546 "parse.cc"
+    break;
+
+  case 871: /* statement_item: '@' '(' '*' ')' statement_or_null  */
+#line 5559 "parse.y"
+      { PEventStatement*tmp = new PEventStatement;
+	FILE_NAME(tmp, (yylsp[-4]));
+	tmp->set_statement((yyvsp[0].statement));
+	(yyval.statement) = tmp;
+      }
+#line 13556 "parse.cc"
+    break;
+
+  case 872: /* statement_item: lpvalue '=' expression ';'  */
+#line 5568 "parse.y"
+      { PAssign*tmp = new PAssign((yyvsp[-3].expr),(yyvsp[-1].expr));
+	FILE_NAME(tmp, (yylsp[-3]));
+	(yyval.statement) = tmp;
+      }
+#line 13565 "parse.cc"
+    break;
+
+  case 873: /* statement_item: error '=' expression ';'  */
+#line 5574 "parse.y"
+      { yyerror((yylsp[-2]), "Syntax in assignment statement l-value.");
+	yyerrok;
+	(yyval.statement) = new PNoop;
+      }
+#line 13574 "parse.cc"
+    break;
+
+  case 874: /* statement_item: lpvalue K_LE expression ';'  */
+#line 5579 "parse.y"
+      { PAssignNB*tmp = new PAssignNB((yyvsp[-3].expr),(yyvsp[-1].expr));
+	FILE_NAME(tmp, (yylsp[-3]));
+	(yyval.statement) = tmp;
+      }
+#line 13583 "parse.cc"
+    break;
+
+  case 875: /* statement_item: error K_LE expression ';'  */
+#line 5584 "parse.y"
+      { yyerror((yylsp[-2]), "Syntax in assignment statement l-value.");
+	yyerrok;
+	(yyval.statement) = new PNoop;
+      }
+#line 13592 "parse.cc"
+    break;
+
+  case 876: /* statement_item: lpvalue '=' delay1 expression ';'  */
+#line 5589 "parse.y"
+      { PExpr*del = (yyvsp[-2].exprs)->front(); (yyvsp[-2].exprs)->pop_front();
+	assert((yyvsp[-2].exprs)->empty());
+	PAssign*tmp = new PAssign((yyvsp[-4].expr),del,(yyvsp[-1].expr));
+	FILE_NAME(tmp, (yylsp[-4]));
+	(yyval.statement) = tmp;
+      }
+#line 13603 "parse.cc"
+    break;
+
+  case 877: /* statement_item: lpvalue K_LE delay1 expression ';'  */
+#line 5596 "parse.y"
+      { PExpr*del = (yyvsp[-2].exprs)->front(); (yyvsp[-2].exprs)->pop_front();
+	assert((yyvsp[-2].exprs)->empty());
+	PAssignNB*tmp = new PAssignNB((yyvsp[-4].expr),del,(yyvsp[-1].expr));
+	FILE_NAME(tmp, (yylsp[-4]));
+	(yyval.statement) = tmp;
+      }
+#line 13614 "parse.cc"
+    break;
+
+  case 878: /* statement_item: lpvalue '=' event_control expression ';'  */
+#line 5603 "parse.y"
+      { PAssign*tmp = new PAssign((yyvsp[-4].expr),0,(yyvsp[-2].event_statement),(yyvsp[-1].expr));
+	FILE_NAME(tmp, (yylsp[-4]));
+	(yyval.statement) = tmp;
+      }
+#line 13623 "parse.cc"
+    break;
+
+  case 879: /* statement_item: lpvalue '=' K_repeat '(' expression ')' event_control expression ';'  */
+#line 5608 "parse.y"
+      { PAssign*tmp = new PAssign((yyvsp[-8].expr),(yyvsp[-4].expr),(yyvsp[-2].event_statement),(yyvsp[-1].expr));
+	FILE_NAME(tmp,(yylsp[-8]));
+	tmp->set_lineno((yylsp[-8]).first_line);
+	(yyval.statement) = tmp;
+      }
+#line 13633 "parse.cc"
+    break;
+
+  case 880: /* statement_item: lpvalue K_LE event_control expression ';'  */
+#line 5614 "parse.y"
+      { PAssignNB*tmp = new PAssignNB((yyvsp[-4].expr),0,(yyvsp[-2].event_statement),(yyvsp[-1].expr));
+	FILE_NAME(tmp, (yylsp[-4]));
+	(yyval.statement) = tmp;
+      }
+#line 13642 "parse.cc"
+    break;
+
+  case 881: /* statement_item: lpvalue K_LE K_repeat '(' expression ')' event_control expression ';'  */
+#line 5619 "parse.y"
+      { PAssignNB*tmp = new PAssignNB((yyvsp[-8].expr),(yyvsp[-4].expr),(yyvsp[-2].event_statement),(yyvsp[-1].expr));
+	FILE_NAME(tmp, (yylsp[-8]));
+	(yyval.statement) = tmp;
+      }
+#line 13651 "parse.cc"
+    break;
+
+  case 882: /* statement_item: lpvalue '=' dynamic_array_new ';'  */
+#line 5630 "parse.y"
+      { PAssign*tmp = new PAssign((yyvsp[-3].expr),(yyvsp[-1].expr));
+	FILE_NAME(tmp, (yylsp[-3]));
+	(yyval.statement) = tmp;
+      }
+#line 13660 "parse.cc"
+    break;
+
+  case 883: /* statement_item: lpvalue '=' class_new ';'  */
+#line 5639 "parse.y"
+      { PAssign*tmp = new PAssign((yyvsp[-3].expr),(yyvsp[-1].expr));
+	FILE_NAME(tmp, (yylsp[-3]));
+	(yyval.statement) = tmp;
+      }
+#line 13669 "parse.cc"
+    break;
+
+  case 884: /* statement_item: K_wait '(' expression ')' statement_or_null  */
+#line 5645 "parse.y"
+                { PEventStatement*tmp;
+		  PEEvent*etmp = new PEEvent(PEEvent::POSITIVE, (yyvsp[-2].expr));
+		  tmp = new PEventStatement(etmp);
+		  FILE_NAME(tmp,(yylsp[-4]));
+		  tmp->set_statement((yyvsp[0].statement));
+		  (yyval.statement) = tmp;
+		}
+#line 13681 "parse.cc"
+    break;
+
+  case 885: /* statement_item: SYSTEM_IDENTIFIER '(' expression_list_with_nuls ')' ';'  */
+#line 5653 "parse.y"
+                { PCallTask*tmp = new PCallTask(lex_strings.make((yyvsp[-4].text)), *(yyvsp[-2].exprs));
+		  FILE_NAME(tmp,(yylsp[-4]));
+		  delete[](yyvsp[-4].text);
+		  delete (yyvsp[-2].exprs);
+		  (yyval.statement) = tmp;
+		}
+#line 13692 "parse.cc"
+    break;
+
+  case 886: /* statement_item: SYSTEM_IDENTIFIER ';'  */
+#line 5660 "parse.y"
+                { list<PExpr*>pt;
+		  PCallTask*tmp = new PCallTask(lex_strings.make((yyvsp[-1].text)), pt);
+		  FILE_NAME(tmp,(yylsp[-1]));
+		  delete[](yyvsp[-1].text);
+		  (yyval.statement) = tmp;
+		}
+#line 13703 "parse.cc"
+    break;
+
+  case 887: /* statement_item: hierarchy_identifier '(' expression_list_with_nuls ')' ';'  */
+#line 5668 "parse.y"
+      { PCallTask*tmp = new PCallTask(*(yyvsp[-4].pform_name), *(yyvsp[-2].exprs));
+	FILE_NAME(tmp, (yylsp[-4]));
+	delete (yyvsp[-4].pform_name);
+	delete (yyvsp[-2].exprs);
+	(yyval.statement) = tmp;
+      }
+#line 13714 "parse.cc"
+    break;
+
+  case 888: /* statement_item: hierarchy_identifier K_with '{' constraint_block_item_list_opt '}' ';'  */
+#line 5676 "parse.y"
+      { /* ....randomize with { <constraints> } */
+	if ((yyvsp[-5].pform_name) && peek_tail_name(*(yyvsp[-5].pform_name)) == "randomize") {
+	      if (!gn_system_verilog())
+		    yyerror((yylsp[-4]), "error: Randomize with constraint requires SystemVerilog.");
+	      else
+		    yyerror((yylsp[-4]), "sorry: Randomize with constraint not supported.");
+	} else {
+	      yyerror((yylsp[-4]), "error: Constraint block can only be applied to randomize method.");
+	}
+	list<PExpr*>pt;
+	PCallTask*tmp = new PCallTask(*(yyvsp[-5].pform_name), pt);
+	FILE_NAME(tmp, (yylsp[-5]));
+	delete (yyvsp[-5].pform_name);
+	(yyval.statement) = tmp;
+      }
+#line 13734 "parse.cc"
+    break;
+
+  case 889: /* statement_item: implicit_class_handle '.' hierarchy_identifier '(' expression_list_with_nuls ')' ';'  */
+#line 5693 "parse.y"
+      { PCallTask*tmp = new PCallTask(*(yyvsp[-4].pform_name), *(yyvsp[-2].exprs));
+	yyerror((yylsp[-6]), "sorry: Implicit class handle not supported in front of task names.");
+	FILE_NAME(tmp, (yylsp[-6]));
+	delete (yyvsp[-4].pform_name);
+	delete (yyvsp[-2].exprs);
+	(yyval.statement) = tmp;
+      }
+#line 13746 "parse.cc"
+    break;
+
+  case 890: /* statement_item: hierarchy_identifier ';'  */
+#line 5702 "parse.y"
+      { list<PExpr*>pt;
+	PCallTask*tmp = new PCallTask(*(yyvsp[-1].pform_name), pt);
+	FILE_NAME(tmp, (yylsp[-1]));
+	delete (yyvsp[-1].pform_name);
+	(yyval.statement) = tmp;
+      }
+#line 13757 "parse.cc"
+    break;
+
+  case 891: /* statement_item: hierarchy_identifier '(' error ')' ';'  */
+#line 5710 "parse.y"
+      { yyerror((yylsp[-2]), "error: Syntax error in task arguments.");
+	list<PExpr*>pt;
+	PCallTask*tmp = new PCallTask(*(yyvsp[-4].pform_name), pt);
+	FILE_NAME(tmp, (yylsp[-4]));
+	delete (yyvsp[-4].pform_name);
+	(yyval.statement) = tmp;
+      }
+#line 13769 "parse.cc"
+    break;
+
+  case 892: /* statement_item: error ';'  */
+#line 5719 "parse.y"
+      { yyerror((yylsp[0]), "error: malformed statement");
+	yyerrok;
+	(yyval.statement) = new PNoop;
+      }
+#line 13778 "parse.cc"
+    break;
+
+  case 893: /* compressed_statement: lpvalue K_PLUS_EQ expression  */
+#line 5728 "parse.y"
+      { PAssign*tmp = new PAssign((yyvsp[-2].expr), '+', (yyvsp[0].expr));
+	FILE_NAME(tmp, (yylsp[-2]));
+	(yyval.statement) = tmp;
+      }
+#line 13787 "parse.cc"
+    break;
+
+  case 894: /* compressed_statement: lpvalue K_MINUS_EQ expression  */
+#line 5733 "parse.y"
+      { PAssign*tmp = new PAssign((yyvsp[-2].expr), '-', (yyvsp[0].expr));
+	FILE_NAME(tmp, (yylsp[-2]));
+	(yyval.statement) = tmp;
+      }
+#line 13796 "parse.cc"
+    break;
+
+  case 895: /* compressed_statement: lpvalue K_MUL_EQ expression  */
+#line 5738 "parse.y"
+      { PAssign*tmp = new PAssign((yyvsp[-2].expr), '*', (yyvsp[0].expr));
+	FILE_NAME(tmp, (yylsp[-2]));
+	(yyval.statement) = tmp;
+      }
+#line 13805 "parse.cc"
+    break;
+
+  case 896: /* compressed_statement: lpvalue K_DIV_EQ expression  */
+#line 5743 "parse.y"
+      { PAssign*tmp = new PAssign((yyvsp[-2].expr), '/', (yyvsp[0].expr));
+	FILE_NAME(tmp, (yylsp[-2]));
+	(yyval.statement) = tmp;
+      }
+#line 13814 "parse.cc"
+    break;
+
+  case 897: /* compressed_statement: lpvalue K_MOD_EQ expression  */
+#line 5748 "parse.y"
+      { PAssign*tmp = new PAssign((yyvsp[-2].expr), '%', (yyvsp[0].expr));
+	FILE_NAME(tmp, (yylsp[-2]));
+	(yyval.statement) = tmp;
+      }
+#line 13823 "parse.cc"
+    break;
+
+  case 898: /* compressed_statement: lpvalue K_AND_EQ expression  */
+#line 5753 "parse.y"
+      { PAssign*tmp = new PAssign((yyvsp[-2].expr), '&', (yyvsp[0].expr));
+	FILE_NAME(tmp, (yylsp[-2]));
+	(yyval.statement) = tmp;
+      }
+#line 13832 "parse.cc"
+    break;
+
+  case 899: /* compressed_statement: lpvalue K_OR_EQ expression  */
+#line 5758 "parse.y"
+      { PAssign*tmp = new PAssign((yyvsp[-2].expr), '|', (yyvsp[0].expr));
+	FILE_NAME(tmp, (yylsp[-2]));
+	(yyval.statement) = tmp;
+      }
+#line 13841 "parse.cc"
+    break;
+
+  case 900: /* compressed_statement: lpvalue K_XOR_EQ expression  */
+#line 5763 "parse.y"
+      { PAssign*tmp = new PAssign((yyvsp[-2].expr), '^', (yyvsp[0].expr));
+	FILE_NAME(tmp, (yylsp[-2]));
+	(yyval.statement) = tmp;
+      }
+#line 13850 "parse.cc"
+    break;
+
+  case 901: /* compressed_statement: lpvalue K_LS_EQ expression  */
+#line 5768 "parse.y"
+      { PAssign  *tmp = new PAssign((yyvsp[-2].expr), 'l', (yyvsp[0].expr));
+	FILE_NAME(tmp, (yylsp[-2]));
+	(yyval.statement) = tmp;
+      }
+#line 13859 "parse.cc"
+    break;
+
+  case 902: /* compressed_statement: lpvalue K_RS_EQ expression  */
+#line 5773 "parse.y"
+      { PAssign*tmp = new PAssign((yyvsp[-2].expr), 'r', (yyvsp[0].expr));
+	FILE_NAME(tmp, (yylsp[-2]));
+	(yyval.statement) = tmp;
+      }
+#line 13868 "parse.cc"
+    break;
+
+  case 903: /* compressed_statement: lpvalue K_RSS_EQ expression  */
+#line 5778 "parse.y"
+      { PAssign  *tmp = new PAssign((yyvsp[-2].expr), 'R', (yyvsp[0].expr));
+	FILE_NAME(tmp, (yylsp[-2]));
+	(yyval.statement) = tmp;
+      }
+#line 13877 "parse.cc"
+    break;
+
+  case 904: /* statement_or_null_list_opt: statement_or_null_list  */
+#line 5787 "parse.y"
+      { (yyval.statement_list) = (yyvsp[0].statement_list); }
+#line 13883 "parse.cc"
+    break;
+
+  case 905: /* statement_or_null_list_opt: %empty  */
+#line 5789 "parse.y"
+      { (yyval.statement_list) = 0; }
+#line 13889 "parse.cc"
+    break;
+
+  case 906: /* statement_or_null_list: statement_or_null_list statement_or_null  */
+#line 5794 "parse.y"
+      { vector<Statement*>*tmp = (yyvsp[-1].statement_list);
+	if ((yyvsp[0].statement)) tmp->push_back((yyvsp[0].statement));
+	(yyval.statement_list) = tmp;
+      }
+#line 13898 "parse.cc"
+    break;
+
+  case 907: /* statement_or_null_list: statement_or_null  */
+#line 5799 "parse.y"
+      { vector<Statement*>*tmp = new vector<Statement*>(0);
+	if ((yyvsp[0].statement)) tmp->push_back((yyvsp[0].statement));
+	(yyval.statement_list) = tmp;
+      }
+#line 13907 "parse.cc"
+    break;
+
+  case 908: /* analog_statement: branch_probe_expression K_CONTRIBUTE expression ';'  */
+#line 5807 "parse.y"
+      { (yyval.statement) = pform_contribution_statement((yylsp[-2]), (yyvsp[-3].expr), (yyvsp[-1].expr)); }
+#line 13913 "parse.cc"
+    break;
+
+  case 909: /* task_item: block_item_decl  */
+#line 5813 "parse.y"
+                           { (yyval.wires) = new svector<PWire*>(0); }
+#line 13919 "parse.cc"
+    break;
+
+  case 910: /* task_item: tf_port_declaration  */
+#line 5814 "parse.y"
+                                { (yyval.wires) = (yyvsp[0].wires); }
+#line 13925 "parse.cc"
+    break;
+
+  case 911: /* task_item_list: task_item_list task_item  */
+#line 5819 "parse.y"
+                { svector<PWire*>*tmp = new svector<PWire*>(*(yyvsp[-1].wires), *(yyvsp[0].wires));
+		  delete (yyvsp[-1].wires);
+		  delete (yyvsp[0].wires);
+		  (yyval.wires) = tmp;
+		}
+#line 13935 "parse.cc"
+    break;
+
+  case 912: /* task_item_list: task_item  */
+#line 5825 "parse.y"
+                { (yyval.wires) = (yyvsp[0].wires); }
+#line 13941 "parse.cc"
+    break;
+
+  case 913: /* task_item_list_opt: task_item_list  */
+#line 5830 "parse.y"
+                { (yyval.wires) = (yyvsp[0].wires); }
+#line 13947 "parse.cc"
+    break;
+
+  case 914: /* task_item_list_opt: %empty  */
+#line 5832 "parse.y"
+                { (yyval.wires) = 0; }
+#line 13953 "parse.cc"
+    break;
+
+  case 915: /* tf_port_list_opt: tf_port_list  */
+#line 5836 "parse.y"
+                 { (yyval.wires) = (yyvsp[0].wires); }
+#line 13959 "parse.cc"
+    break;
+
+  case 916: /* tf_port_list_opt: %empty  */
+#line 5837 "parse.y"
+                        { (yyval.wires) = 0; }
+#line 13965 "parse.cc"
+    break;
+
+  case 917: /* $@33: %empty  */
+#line 5841 "parse.y"
+                  { lex_start_table(); }
+#line 13971 "parse.cc"
+    break;
+
+  case 918: /* udp_body: K_table $@33 udp_entry_list K_endtable  */
+#line 5843 "parse.y"
+                     { lex_end_table(); (yyval.strings) = (yyvsp[-1].strings); }
+#line 13977 "parse.cc"
+    break;
+
+  case 921: /* udp_comb_entry: udp_input_list ':' udp_output_sym ';'  */
+#line 5853 "parse.y"
+                { char*tmp = new char[strlen((yyvsp[-3].text))+3];
+		  strcpy(tmp, (yyvsp[-3].text));
+		  char*tp = tmp+strlen(tmp);
+		  *tp++ = ':';
+		  *tp++ = (yyvsp[-1].letter);
+		  *tp++ = 0;
+		  delete[](yyvsp[-3].text);
+		  (yyval.text) = tmp;
+		}
+#line 13991 "parse.cc"
+    break;
+
+  case 922: /* udp_comb_entry_list: udp_comb_entry  */
+#line 5866 "parse.y"
+                { list<string>*tmp = new list<string>;
+		  tmp->push_back((yyvsp[0].text));
+		  delete[](yyvsp[0].text);
+		  (yyval.strings) = tmp;
+		}
+#line 14001 "parse.cc"
+    break;
+
+  case 923: /* udp_comb_entry_list: udp_comb_entry_list udp_comb_entry  */
+#line 5872 "parse.y"
+                { list<string>*tmp = (yyvsp[-1].strings);
+		  tmp->push_back((yyvsp[0].text));
+		  delete[](yyvsp[0].text);
+		  (yyval.strings) = tmp;
+		}
+#line 14011 "parse.cc"
+    break;
+
+  case 924: /* udp_sequ_entry_list: udp_sequ_entry  */
+#line 5881 "parse.y"
+                { list<string>*tmp = new list<string>;
+		  tmp->push_back((yyvsp[0].text));
+		  delete[](yyvsp[0].text);
+		  (yyval.strings) = tmp;
+		}
+#line 14021 "parse.cc"
+    break;
+
+  case 925: /* udp_sequ_entry_list: udp_sequ_entry_list udp_sequ_entry  */
+#line 5887 "parse.y"
+                { list<string>*tmp = (yyvsp[-1].strings);
+		  tmp->push_back((yyvsp[0].text));
+		  delete[](yyvsp[0].text);
+		  (yyval.strings) = tmp;
+		}
+#line 14031 "parse.cc"
+    break;
+
+  case 926: /* udp_sequ_entry: udp_input_list ':' udp_input_sym ':' udp_output_sym ';'  */
+#line 5896 "parse.y"
+                { char*tmp = new char[strlen((yyvsp[-5].text))+5];
+		  strcpy(tmp, (yyvsp[-5].text));
+		  char*tp = tmp+strlen(tmp);
+		  *tp++ = ':';
+		  *tp++ = (yyvsp[-3].letter);
+		  *tp++ = ':';
+		  *tp++ = (yyvsp[-1].letter);
+		  *tp++ = 0;
+		  (yyval.text) = tmp;
+		}
+#line 14046 "parse.cc"
+    break;
+
+  case 927: /* udp_initial: K_initial IDENTIFIER '=' number ';'  */
+#line 5910 "parse.y"
+                { PExpr*etmp = new PENumber((yyvsp[-1].number));
+		  PEIdent*itmp = new PEIdent(lex_strings.make((yyvsp[-3].text)));
+		  PAssign*atmp = new PAssign(itmp, etmp);
+		  FILE_NAME(atmp, (yylsp[-3]));
+		  delete[](yyvsp[-3].text);
+		  (yyval.statement) = atmp;
+		}
+#line 14058 "parse.cc"
+    break;
+
+  case 928: /* udp_init_opt: udp_initial  */
+#line 5920 "parse.y"
+                       { (yyval.statement) = (yyvsp[0].statement); }
+#line 14064 "parse.cc"
+    break;
+
+  case 929: /* udp_init_opt: %empty  */
+#line 5921 "parse.y"
+                       { (yyval.statement) = 0; }
+#line 14070 "parse.cc"
+    break;
+
+  case 930: /* udp_input_list: udp_input_sym  */
+#line 5926 "parse.y"
+                { char*tmp = new char[2];
+		  tmp[0] = (yyvsp[0].letter);
+		  tmp[1] = 0;
+		  (yyval.text) = tmp;
+		}
+#line 14080 "parse.cc"
+    break;
+
+  case 931: /* udp_input_list: udp_input_list udp_input_sym  */
+#line 5932 "parse.y"
+                { char*tmp = new char[strlen((yyvsp[-1].text))+2];
+		  strcpy(tmp, (yyvsp[-1].text));
+		  char*tp = tmp+strlen(tmp);
+		  *tp++ = (yyvsp[0].letter);
+		  *tp++ = 0;
+		  delete[](yyvsp[-1].text);
+		  (yyval.text) = tmp;
+		}
+#line 14093 "parse.cc"
+    break;
+
+  case 932: /* udp_input_sym: '0'  */
+#line 5943 "parse.y"
+              { (yyval.letter) = '0'; }
+#line 14099 "parse.cc"
+    break;
+
+  case 933: /* udp_input_sym: '1'  */
+#line 5944 "parse.y"
+              { (yyval.letter) = '1'; }
+#line 14105 "parse.cc"
+    break;
+
+  case 934: /* udp_input_sym: 'x'  */
+#line 5945 "parse.y"
+              { (yyval.letter) = 'x'; }
+#line 14111 "parse.cc"
+    break;
+
+  case 935: /* udp_input_sym: '?'  */
+#line 5946 "parse.y"
+              { (yyval.letter) = '?'; }
+#line 14117 "parse.cc"
+    break;
+
+  case 936: /* udp_input_sym: 'b'  */
+#line 5947 "parse.y"
+              { (yyval.letter) = 'b'; }
+#line 14123 "parse.cc"
+    break;
+
+  case 937: /* udp_input_sym: '*'  */
+#line 5948 "parse.y"
+              { (yyval.letter) = '*'; }
+#line 14129 "parse.cc"
+    break;
+
+  case 938: /* udp_input_sym: '%'  */
+#line 5949 "parse.y"
+              { (yyval.letter) = '%'; }
+#line 14135 "parse.cc"
+    break;
+
+  case 939: /* udp_input_sym: 'f'  */
+#line 5950 "parse.y"
+              { (yyval.letter) = 'f'; }
+#line 14141 "parse.cc"
+    break;
+
+  case 940: /* udp_input_sym: 'F'  */
+#line 5951 "parse.y"
+              { (yyval.letter) = 'F'; }
+#line 14147 "parse.cc"
+    break;
+
+  case 941: /* udp_input_sym: 'l'  */
+#line 5952 "parse.y"
+              { (yyval.letter) = 'l'; }
+#line 14153 "parse.cc"
+    break;
+
+  case 942: /* udp_input_sym: 'h'  */
+#line 5953 "parse.y"
+              { (yyval.letter) = 'h'; }
+#line 14159 "parse.cc"
+    break;
+
+  case 943: /* udp_input_sym: 'B'  */
+#line 5954 "parse.y"
+              { (yyval.letter) = 'B'; }
+#line 14165 "parse.cc"
+    break;
+
+  case 944: /* udp_input_sym: 'r'  */
+#line 5955 "parse.y"
+              { (yyval.letter) = 'r'; }
+#line 14171 "parse.cc"
+    break;
+
+  case 945: /* udp_input_sym: 'R'  */
+#line 5956 "parse.y"
+              { (yyval.letter) = 'R'; }
+#line 14177 "parse.cc"
+    break;
+
+  case 946: /* udp_input_sym: 'M'  */
+#line 5957 "parse.y"
+              { (yyval.letter) = 'M'; }
+#line 14183 "parse.cc"
+    break;
+
+  case 947: /* udp_input_sym: 'n'  */
+#line 5958 "parse.y"
+              { (yyval.letter) = 'n'; }
+#line 14189 "parse.cc"
+    break;
+
+  case 948: /* udp_input_sym: 'N'  */
+#line 5959 "parse.y"
+              { (yyval.letter) = 'N'; }
+#line 14195 "parse.cc"
+    break;
+
+  case 949: /* udp_input_sym: 'p'  */
+#line 5960 "parse.y"
+              { (yyval.letter) = 'p'; }
+#line 14201 "parse.cc"
+    break;
+
+  case 950: /* udp_input_sym: 'P'  */
+#line 5961 "parse.y"
+              { (yyval.letter) = 'P'; }
+#line 14207 "parse.cc"
+    break;
+
+  case 951: /* udp_input_sym: 'Q'  */
+#line 5962 "parse.y"
+              { (yyval.letter) = 'Q'; }
+#line 14213 "parse.cc"
+    break;
+
+  case 952: /* udp_input_sym: 'q'  */
+#line 5963 "parse.y"
+              { (yyval.letter) = 'q'; }
+#line 14219 "parse.cc"
+    break;
+
+  case 953: /* udp_input_sym: '_'  */
+#line 5964 "parse.y"
+              { (yyval.letter) = '_'; }
+#line 14225 "parse.cc"
+    break;
+
+  case 954: /* udp_input_sym: '+'  */
+#line 5965 "parse.y"
+              { (yyval.letter) = '+'; }
+#line 14231 "parse.cc"
+    break;
+
+  case 955: /* udp_output_sym: '0'  */
+#line 5969 "parse.y"
+              { (yyval.letter) = '0'; }
+#line 14237 "parse.cc"
+    break;
+
+  case 956: /* udp_output_sym: '1'  */
+#line 5970 "parse.y"
+              { (yyval.letter) = '1'; }
+#line 14243 "parse.cc"
+    break;
+
+  case 957: /* udp_output_sym: 'x'  */
+#line 5971 "parse.y"
+              { (yyval.letter) = 'x'; }
+#line 14249 "parse.cc"
+    break;
+
+  case 958: /* udp_output_sym: '-'  */
+#line 5972 "parse.y"
+              { (yyval.letter) = '-'; }
+#line 14255 "parse.cc"
+    break;
+
+  case 959: /* udp_port_decl: K_input list_of_identifiers ';'  */
+#line 5980 "parse.y"
+      { (yyval.wires) = pform_make_udp_input_ports((yyvsp[-1].perm_strings)); }
+#line 14261 "parse.cc"
+    break;
+
+  case 960: /* udp_port_decl: K_output IDENTIFIER ';'  */
+#line 5982 "parse.y"
+      { perm_string pname = lex_strings.make((yyvsp[-1].text));
+	PWire*pp = new PWire(pname, NetNet::IMPLICIT, NetNet::POUTPUT, IVL_VT_LOGIC);
+	svector<PWire*>*tmp = new svector<PWire*>(1);
+	(*tmp)[0] = pp;
+	(yyval.wires) = tmp;
+	delete[](yyvsp[-1].text);
+      }
+#line 14273 "parse.cc"
+    break;
+
+  case 961: /* udp_port_decl: K_reg IDENTIFIER ';'  */
+#line 5990 "parse.y"
+      { perm_string pname = lex_strings.make((yyvsp[-1].text));
+	PWire*pp = new PWire(pname, NetNet::REG, NetNet::PIMPLICIT, IVL_VT_LOGIC);
+	svector<PWire*>*tmp = new svector<PWire*>(1);
+	(*tmp)[0] = pp;
+	(yyval.wires) = tmp;
+	delete[](yyvsp[-1].text);
+      }
+#line 14285 "parse.cc"
+    break;
+
+  case 962: /* udp_port_decl: K_reg K_output IDENTIFIER ';'  */
+#line 5998 "parse.y"
+      { perm_string pname = lex_strings.make((yyvsp[-1].text));
+	PWire*pp = new PWire(pname, NetNet::REG, NetNet::POUTPUT, IVL_VT_LOGIC);
+	svector<PWire*>*tmp = new svector<PWire*>(1);
+	(*tmp)[0] = pp;
+	(yyval.wires) = tmp;
+	delete[](yyvsp[-1].text);
+      }
+#line 14297 "parse.cc"
+    break;
+
+  case 963: /* udp_port_decls: udp_port_decl  */
+#line 6009 "parse.y"
+                { (yyval.wires) = (yyvsp[0].wires); }
+#line 14303 "parse.cc"
+    break;
+
+  case 964: /* udp_port_decls: udp_port_decls udp_port_decl  */
+#line 6011 "parse.y"
+                { svector<PWire*>*tmp = new svector<PWire*>(*(yyvsp[-1].wires), *(yyvsp[0].wires));
+		  delete (yyvsp[-1].wires);
+		  delete (yyvsp[0].wires);
+		  (yyval.wires) = tmp;
+		}
+#line 14313 "parse.cc"
+    break;
+
+  case 965: /* udp_port_list: IDENTIFIER  */
+#line 6020 "parse.y"
+      { list<perm_string>*tmp = new list<perm_string>;
+	tmp->push_back(lex_strings.make((yyvsp[0].text)));
+	delete[](yyvsp[0].text);
+	(yyval.perm_strings) = tmp;
+      }
+#line 14323 "parse.cc"
+    break;
+
+  case 966: /* udp_port_list: udp_port_list ',' IDENTIFIER  */
+#line 6026 "parse.y"
+      { list<perm_string>*tmp = (yyvsp[-2].perm_strings);
+	tmp->push_back(lex_strings.make((yyvsp[0].text)));
+	delete[](yyvsp[0].text);
+	(yyval.perm_strings) = tmp;
+      }
+#line 14333 "parse.cc"
+    break;
+
+  case 967: /* udp_reg_opt: K_reg  */
+#line 6033 "parse.y"
+                    { (yyval.flag) = true; }
+#line 14339 "parse.cc"
+    break;
+
+  case 968: /* udp_reg_opt: %empty  */
+#line 6033 "parse.y"
+                                     { (yyval.flag) = false; }
+#line 14345 "parse.cc"
+    break;
+
+  case 969: /* udp_initial_expr_opt: '=' expression  */
+#line 6036 "parse.y"
+                         { (yyval.expr) = (yyvsp[0].expr); }
+#line 14351 "parse.cc"
+    break;
+
+  case 970: /* udp_initial_expr_opt: %empty  */
+#line 6037 "parse.y"
+                         { (yyval.expr) = 0; }
+#line 14357 "parse.cc"
+    break;
+
+  case 971: /* udp_input_declaration_list: K_input IDENTIFIER  */
+#line 6042 "parse.y"
+                { list<perm_string>*tmp = new list<perm_string>;
+		  tmp->push_back(lex_strings.make((yyvsp[0].text)));
+		  (yyval.perm_strings) = tmp;
+		  delete[](yyvsp[0].text);
+		}
+#line 14367 "parse.cc"
+    break;
+
+  case 972: /* udp_input_declaration_list: udp_input_declaration_list ',' K_input IDENTIFIER  */
+#line 6048 "parse.y"
+                { list<perm_string>*tmp = (yyvsp[-3].perm_strings);
+		  tmp->push_back(lex_strings.make((yyvsp[0].text)));
+		  (yyval.perm_strings) = tmp;
+		  delete[](yyvsp[0].text);
+		}
+#line 14377 "parse.cc"
+    break;
+
+  case 973: /* udp_primitive: K_primitive IDENTIFIER '(' udp_port_list ')' ';' udp_port_decls udp_init_opt udp_body K_endprimitive  */
+#line 6066 "parse.y"
+                { perm_string tmp2 = lex_strings.make((yyvsp[-8].text));
+		  pform_make_udp(tmp2, (yyvsp[-6].perm_strings), (yyvsp[-3].wires), (yyvsp[-1].strings), (yyvsp[-2].statement),
+				 (yylsp[-8]).text, (yylsp[-8]).first_line);
+		  delete[](yyvsp[-8].text);
+		}
+#line 14387 "parse.cc"
+    break;
+
+  case 974: /* udp_primitive: K_primitive IDENTIFIER '(' K_output udp_reg_opt IDENTIFIER udp_initial_expr_opt ',' udp_input_declaration_list ')' ';' udp_body K_endprimitive  */
+#line 6081 "parse.y"
+                { perm_string tmp2 = lex_strings.make((yyvsp[-11].text));
+		  perm_string tmp6 = lex_strings.make((yyvsp[-7].text));
+		  pform_make_udp(tmp2, (yyvsp[-8].flag), tmp6, (yyvsp[-6].expr), (yyvsp[-4].perm_strings), (yyvsp[-1].strings),
+				 (yylsp[-11]).text, (yylsp[-11]).first_line);
+		  delete[](yyvsp[-11].text);
+		  delete[](yyvsp[-7].text);
+		}
+#line 14399 "parse.cc"
+    break;
+
+  case 975: /* K_automatic_opt: K_automatic  */
+#line 6094 "parse.y"
+                             { (yyval.flag) = true; }
+#line 14405 "parse.cc"
+    break;
+
+  case 976: /* K_automatic_opt: %empty  */
+#line 6094 "parse.y"
+                                              { (yyval.flag) = false;}
+#line 14411 "parse.cc"
+    break;
+
+  case 977: /* K_packed_opt: K_packed  */
+#line 6095 "parse.y"
+                             { (yyval.flag) = true; }
+#line 14417 "parse.cc"
+    break;
+
+  case 978: /* K_packed_opt: %empty  */
+#line 6095 "parse.y"
+                                              { (yyval.flag) = false; }
+#line 14423 "parse.cc"
+    break;
+
+  case 979: /* K_reg_opt: K_reg  */
+#line 6096 "parse.y"
+                             { (yyval.flag) = true; }
+#line 14429 "parse.cc"
+    break;
+
+  case 980: /* K_reg_opt: %empty  */
+#line 6096 "parse.y"
+                                              { (yyval.flag) = false; }
+#line 14435 "parse.cc"
+    break;
+
+  case 981: /* K_static_opt: K_static  */
+#line 6097 "parse.y"
+                             { (yyval.flag) = true; }
+#line 14441 "parse.cc"
+    break;
+
+  case 982: /* K_static_opt: %empty  */
+#line 6097 "parse.y"
+                                              { (yyval.flag) = false; }
+#line 14447 "parse.cc"
+    break;
+
+  case 983: /* K_virtual_opt: K_virtual  */
+#line 6098 "parse.y"
+                             { (yyval.flag) = true; }
+#line 14453 "parse.cc"
+    break;
+
+  case 984: /* K_virtual_opt: %empty  */
+#line 6098 "parse.y"
+                                              { (yyval.flag) = false; }
+#line 14459 "parse.cc"
+    break;
+
+
+#line 14463 "parse.cc"
+
+      default: break;
+    }
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
+
+  YYPOPSTACK (yylen);
+  yylen = 0;
+
+  *++yyvsp = yyval;
+  *++yylsp = yyloc;
+
+  /* Now 'shift' the result of the reduction.  Determine what state
+     that goes to, based on the state we popped back to and the rule
+     number reduced by.  */
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
+
+  goto yynewstate;
+
+
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
+yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
+  /* If not already recovering from an error, report this error.  */
+  if (!yyerrstatus)
+    {
+      ++yynerrs;
+      yyerror (YY_("syntax error"));
+    }
+
+  yyerror_range[1] = yylloc;
+  if (yyerrstatus == 3)
+    {
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
+
+      if (yychar <= YYEOF)
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
+      else
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval, &yylloc);
+          yychar = YYEMPTY;
+        }
+    }
+
+  /* Else will try to reuse lookahead token after shifting the error
+     token.  */
+  goto yyerrlab1;
+
+
+/*---------------------------------------------------.
+| yyerrorlab -- error raised explicitly by YYERROR.  |
+`---------------------------------------------------*/
+yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
+
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYERROR.  */
+  YYPOPSTACK (yylen);
+  yylen = 0;
+  YY_STACK_PRINT (yyss, yyssp);
+  yystate = *yyssp;
+  goto yyerrlab1;
+
+
+/*-------------------------------------------------------------.
+| yyerrlab1 -- common code for both syntax error and YYERROR.  |
+`-------------------------------------------------------------*/
+yyerrlab1:
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
+
+  /* Pop stack until we find a state that shifts the error token.  */
+  for (;;)
+    {
+      yyn = yypact[yystate];
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
+
+      /* Pop the current state because it cannot handle the error token.  */
+      if (yyssp == yyss)
+        YYABORT;
+
+      yyerror_range[1] = *yylsp;
+      yydestruct ("Error: popping",
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp, yylsp);
+      YYPOPSTACK (1);
+      yystate = *yyssp;
+      YY_STACK_PRINT (yyss, yyssp);
+    }
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+  yyerror_range[2] = yylloc;
+  ++yylsp;
+  YYLLOC_DEFAULT (*yylsp, yyerror_range, 2);
+
+  /* Shift the error token.  */
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
+
+  yystate = yyn;
+  goto yynewstate;
+
+
+/*-------------------------------------.
+| yyacceptlab -- YYACCEPT comes here.  |
+`-------------------------------------*/
+yyacceptlab:
+  yyresult = 0;
+  goto yyreturnlab;
+
+
+/*-----------------------------------.
+| yyabortlab -- YYABORT comes here.  |
+`-----------------------------------*/
+yyabortlab:
+  yyresult = 1;
+  goto yyreturnlab;
+
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
+yyexhaustedlab:
+  yyerror (YY_("memory exhausted"));
+  yyresult = 2;
+  goto yyreturnlab;
+
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != YYEMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval, &yylloc);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYABORT or YYACCEPT.  */
+  YYPOPSTACK (yylen);
+  YY_STACK_PRINT (yyss, yyssp);
+  while (yyssp != yyss)
+    {
+      yydestruct ("Cleanup: popping",
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp, yylsp);
+      YYPOPSTACK (1);
+    }
+#ifndef yyoverflow
+  if (yyss != yyssa)
+    YYSTACK_FREE (yyss);
+#endif
+
+  return yyresult;
+}
+
@@ -0,0 +1,576 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison interface for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+#ifndef YY_VL_PARSE_HH_INCLUDED
+# define YY_VL_PARSE_HH_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 1
+#endif
+#if YYDEBUG
+extern int VLdebug;
+#endif
+
+/* Token kinds.  */
+#ifndef YYTOKENTYPE
+# define YYTOKENTYPE
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    IDENTIFIER = 258,              /* IDENTIFIER  */
+    SYSTEM_IDENTIFIER = 259,       /* SYSTEM_IDENTIFIER  */
+    STRING = 260,                  /* STRING  */
+    TIME_LITERAL = 261,            /* TIME_LITERAL  */
+    TYPE_IDENTIFIER = 262,         /* TYPE_IDENTIFIER  */
+    DISCIPLINE_IDENTIFIER = 263,   /* DISCIPLINE_IDENTIFIER  */
+    PATHPULSE_IDENTIFIER = 264,    /* PATHPULSE_IDENTIFIER  */
+    BASED_NUMBER = 265,            /* BASED_NUMBER  */
+    DEC_NUMBER = 266,              /* DEC_NUMBER  */
+    UNBASED_NUMBER = 267,          /* UNBASED_NUMBER  */
+    REALTIME = 268,                /* REALTIME  */
+    K_PLUS_EQ = 269,               /* K_PLUS_EQ  */
+    K_MINUS_EQ = 270,              /* K_MINUS_EQ  */
+    K_INCR = 271,                  /* K_INCR  */
+    K_DECR = 272,                  /* K_DECR  */
+    K_LE = 273,                    /* K_LE  */
+    K_GE = 274,                    /* K_GE  */
+    K_EG = 275,                    /* K_EG  */
+    K_EQ = 276,                    /* K_EQ  */
+    K_NE = 277,                    /* K_NE  */
+    K_CEQ = 278,                   /* K_CEQ  */
+    K_CNE = 279,                   /* K_CNE  */
+    K_LP = 280,                    /* K_LP  */
+    K_LS = 281,                    /* K_LS  */
+    K_RS = 282,                    /* K_RS  */
+    K_RSS = 283,                   /* K_RSS  */
+    K_SG = 284,                    /* K_SG  */
+    K_CONTRIBUTE = 285,            /* K_CONTRIBUTE  */
+    K_PO_POS = 286,                /* K_PO_POS  */
+    K_PO_NEG = 287,                /* K_PO_NEG  */
+    K_POW = 288,                   /* K_POW  */
+    K_PSTAR = 289,                 /* K_PSTAR  */
+    K_STARP = 290,                 /* K_STARP  */
+    K_DOTSTAR = 291,               /* K_DOTSTAR  */
+    K_LOR = 292,                   /* K_LOR  */
+    K_LAND = 293,                  /* K_LAND  */
+    K_NAND = 294,                  /* K_NAND  */
+    K_NOR = 295,                   /* K_NOR  */
+    K_NXOR = 296,                  /* K_NXOR  */
+    K_TRIGGER = 297,               /* K_TRIGGER  */
+    K_SCOPE_RES = 298,             /* K_SCOPE_RES  */
+    K_edge_descriptor = 299,       /* K_edge_descriptor  */
+    K_always = 300,                /* K_always  */
+    K_and = 301,                   /* K_and  */
+    K_assign = 302,                /* K_assign  */
+    K_begin = 303,                 /* K_begin  */
+    K_buf = 304,                   /* K_buf  */
+    K_bufif0 = 305,                /* K_bufif0  */
+    K_bufif1 = 306,                /* K_bufif1  */
+    K_case = 307,                  /* K_case  */
+    K_casex = 308,                 /* K_casex  */
+    K_casez = 309,                 /* K_casez  */
+    K_cmos = 310,                  /* K_cmos  */
+    K_deassign = 311,              /* K_deassign  */
+    K_default = 312,               /* K_default  */
+    K_defparam = 313,              /* K_defparam  */
+    K_disable = 314,               /* K_disable  */
+    K_edge = 315,                  /* K_edge  */
+    K_else = 316,                  /* K_else  */
+    K_end = 317,                   /* K_end  */
+    K_endcase = 318,               /* K_endcase  */
+    K_endfunction = 319,           /* K_endfunction  */
+    K_endmodule = 320,             /* K_endmodule  */
+    K_endprimitive = 321,          /* K_endprimitive  */
+    K_endspecify = 322,            /* K_endspecify  */
+    K_endtable = 323,              /* K_endtable  */
+    K_endtask = 324,               /* K_endtask  */
+    K_event = 325,                 /* K_event  */
+    K_for = 326,                   /* K_for  */
+    K_force = 327,                 /* K_force  */
+    K_forever = 328,               /* K_forever  */
+    K_fork = 329,                  /* K_fork  */
+    K_function = 330,              /* K_function  */
+    K_highz0 = 331,                /* K_highz0  */
+    K_highz1 = 332,                /* K_highz1  */
+    K_if = 333,                    /* K_if  */
+    K_ifnone = 334,                /* K_ifnone  */
+    K_initial = 335,               /* K_initial  */
+    K_inout = 336,                 /* K_inout  */
+    K_input = 337,                 /* K_input  */
+    K_integer = 338,               /* K_integer  */
+    K_join = 339,                  /* K_join  */
+    K_large = 340,                 /* K_large  */
+    K_macromodule = 341,           /* K_macromodule  */
+    K_medium = 342,                /* K_medium  */
+    K_module = 343,                /* K_module  */
+    K_nand = 344,                  /* K_nand  */
+    K_negedge = 345,               /* K_negedge  */
+    K_nmos = 346,                  /* K_nmos  */
+    K_nor = 347,                   /* K_nor  */
+    K_not = 348,                   /* K_not  */
+    K_notif0 = 349,                /* K_notif0  */
+    K_notif1 = 350,                /* K_notif1  */
+    K_or = 351,                    /* K_or  */
+    K_output = 352,                /* K_output  */
+    K_parameter = 353,             /* K_parameter  */
+    K_pmos = 354,                  /* K_pmos  */
+    K_posedge = 355,               /* K_posedge  */
+    K_primitive = 356,             /* K_primitive  */
+    K_pull0 = 357,                 /* K_pull0  */
+    K_pull1 = 358,                 /* K_pull1  */
+    K_pulldown = 359,              /* K_pulldown  */
+    K_pullup = 360,                /* K_pullup  */
+    K_rcmos = 361,                 /* K_rcmos  */
+    K_real = 362,                  /* K_real  */
+    K_realtime = 363,              /* K_realtime  */
+    K_reg = 364,                   /* K_reg  */
+    K_release = 365,               /* K_release  */
+    K_repeat = 366,                /* K_repeat  */
+    K_rnmos = 367,                 /* K_rnmos  */
+    K_rpmos = 368,                 /* K_rpmos  */
+    K_rtran = 369,                 /* K_rtran  */
+    K_rtranif0 = 370,              /* K_rtranif0  */
+    K_rtranif1 = 371,              /* K_rtranif1  */
+    K_scalared = 372,              /* K_scalared  */
+    K_small = 373,                 /* K_small  */
+    K_specify = 374,               /* K_specify  */
+    K_specparam = 375,             /* K_specparam  */
+    K_strong0 = 376,               /* K_strong0  */
+    K_strong1 = 377,               /* K_strong1  */
+    K_supply0 = 378,               /* K_supply0  */
+    K_supply1 = 379,               /* K_supply1  */
+    K_table = 380,                 /* K_table  */
+    K_task = 381,                  /* K_task  */
+    K_time = 382,                  /* K_time  */
+    K_tran = 383,                  /* K_tran  */
+    K_tranif0 = 384,               /* K_tranif0  */
+    K_tranif1 = 385,               /* K_tranif1  */
+    K_tri = 386,                   /* K_tri  */
+    K_tri0 = 387,                  /* K_tri0  */
+    K_tri1 = 388,                  /* K_tri1  */
+    K_triand = 389,                /* K_triand  */
+    K_trior = 390,                 /* K_trior  */
+    K_trireg = 391,                /* K_trireg  */
+    K_vectored = 392,              /* K_vectored  */
+    K_wait = 393,                  /* K_wait  */
+    K_wand = 394,                  /* K_wand  */
+    K_weak0 = 395,                 /* K_weak0  */
+    K_weak1 = 396,                 /* K_weak1  */
+    K_while = 397,                 /* K_while  */
+    K_wire = 398,                  /* K_wire  */
+    K_wor = 399,                   /* K_wor  */
+    K_xnor = 400,                  /* K_xnor  */
+    K_xor = 401,                   /* K_xor  */
+    K_Shold = 402,                 /* K_Shold  */
+    K_Snochange = 403,             /* K_Snochange  */
+    K_Speriod = 404,               /* K_Speriod  */
+    K_Srecovery = 405,             /* K_Srecovery  */
+    K_Ssetup = 406,                /* K_Ssetup  */
+    K_Ssetuphold = 407,            /* K_Ssetuphold  */
+    K_Sskew = 408,                 /* K_Sskew  */
+    K_Swidth = 409,                /* K_Swidth  */
+    KK_attribute = 410,            /* KK_attribute  */
+    K_bool = 411,                  /* K_bool  */
+    K_logic = 412,                 /* K_logic  */
+    K_automatic = 413,             /* K_automatic  */
+    K_endgenerate = 414,           /* K_endgenerate  */
+    K_generate = 415,              /* K_generate  */
+    K_genvar = 416,                /* K_genvar  */
+    K_localparam = 417,            /* K_localparam  */
+    K_noshowcancelled = 418,       /* K_noshowcancelled  */
+    K_pulsestyle_onevent = 419,    /* K_pulsestyle_onevent  */
+    K_pulsestyle_ondetect = 420,   /* K_pulsestyle_ondetect  */
+    K_showcancelled = 421,         /* K_showcancelled  */
+    K_signed = 422,                /* K_signed  */
+    K_unsigned = 423,              /* K_unsigned  */
+    K_Sfullskew = 424,             /* K_Sfullskew  */
+    K_Srecrem = 425,               /* K_Srecrem  */
+    K_Sremoval = 426,              /* K_Sremoval  */
+    K_Stimeskew = 427,             /* K_Stimeskew  */
+    K_cell = 428,                  /* K_cell  */
+    K_config = 429,                /* K_config  */
+    K_design = 430,                /* K_design  */
+    K_endconfig = 431,             /* K_endconfig  */
+    K_incdir = 432,                /* K_incdir  */
+    K_include = 433,               /* K_include  */
+    K_instance = 434,              /* K_instance  */
+    K_liblist = 435,               /* K_liblist  */
+    K_library = 436,               /* K_library  */
+    K_use = 437,                   /* K_use  */
+    K_wone = 438,                  /* K_wone  */
+    K_uwire = 439,                 /* K_uwire  */
+    K_alias = 440,                 /* K_alias  */
+    K_always_comb = 441,           /* K_always_comb  */
+    K_always_ff = 442,             /* K_always_ff  */
+    K_always_latch = 443,          /* K_always_latch  */
+    K_assert = 444,                /* K_assert  */
+    K_assume = 445,                /* K_assume  */
+    K_before = 446,                /* K_before  */
+    K_bind = 447,                  /* K_bind  */
+    K_bins = 448,                  /* K_bins  */
+    K_binsof = 449,                /* K_binsof  */
+    K_bit = 450,                   /* K_bit  */
+    K_break = 451,                 /* K_break  */
+    K_byte = 452,                  /* K_byte  */
+    K_chandle = 453,               /* K_chandle  */
+    K_class = 454,                 /* K_class  */
+    K_clocking = 455,              /* K_clocking  */
+    K_const = 456,                 /* K_const  */
+    K_constraint = 457,            /* K_constraint  */
+    K_context = 458,               /* K_context  */
+    K_continue = 459,              /* K_continue  */
+    K_cover = 460,                 /* K_cover  */
+    K_covergroup = 461,            /* K_covergroup  */
+    K_coverpoint = 462,            /* K_coverpoint  */
+    K_cross = 463,                 /* K_cross  */
+    K_dist = 464,                  /* K_dist  */
+    K_do = 465,                    /* K_do  */
+    K_endclass = 466,              /* K_endclass  */
+    K_endclocking = 467,           /* K_endclocking  */
+    K_endgroup = 468,              /* K_endgroup  */
+    K_endinterface = 469,          /* K_endinterface  */
+    K_endpackage = 470,            /* K_endpackage  */
+    K_endprogram = 471,            /* K_endprogram  */
+    K_endproperty = 472,           /* K_endproperty  */
+    K_endsequence = 473,           /* K_endsequence  */
+    K_enum = 474,                  /* K_enum  */
+    K_expect = 475,                /* K_expect  */
+    K_export = 476,                /* K_export  */
+    K_extends = 477,               /* K_extends  */
+    K_extern = 478,                /* K_extern  */
+    K_final = 479,                 /* K_final  */
+    K_first_match = 480,           /* K_first_match  */
+    K_foreach = 481,               /* K_foreach  */
+    K_forkjoin = 482,              /* K_forkjoin  */
+    K_iff = 483,                   /* K_iff  */
+    K_ignore_bins = 484,           /* K_ignore_bins  */
+    K_illegal_bins = 485,          /* K_illegal_bins  */
+    K_import = 486,                /* K_import  */
+    K_inside = 487,                /* K_inside  */
+    K_int = 488,                   /* K_int  */
+    K_interface = 489,             /* K_interface  */
+    K_intersect = 490,             /* K_intersect  */
+    K_join_any = 491,              /* K_join_any  */
+    K_join_none = 492,             /* K_join_none  */
+    K_local = 493,                 /* K_local  */
+    K_longint = 494,               /* K_longint  */
+    K_matches = 495,               /* K_matches  */
+    K_modport = 496,               /* K_modport  */
+    K_new = 497,                   /* K_new  */
+    K_null = 498,                  /* K_null  */
+    K_package = 499,               /* K_package  */
+    K_packed = 500,                /* K_packed  */
+    K_priority = 501,              /* K_priority  */
+    K_program = 502,               /* K_program  */
+    K_property = 503,              /* K_property  */
+    K_protected = 504,             /* K_protected  */
+    K_pure = 505,                  /* K_pure  */
+    K_rand = 506,                  /* K_rand  */
+    K_randc = 507,                 /* K_randc  */
+    K_randcase = 508,              /* K_randcase  */
+    K_randsequence = 509,          /* K_randsequence  */
+    K_ref = 510,                   /* K_ref  */
+    K_return = 511,                /* K_return  */
+    K_sequence = 512,              /* K_sequence  */
+    K_shortint = 513,              /* K_shortint  */
+    K_shortreal = 514,             /* K_shortreal  */
+    K_solve = 515,                 /* K_solve  */
+    K_static = 516,                /* K_static  */
+    K_string = 517,                /* K_string  */
+    K_struct = 518,                /* K_struct  */
+    K_super = 519,                 /* K_super  */
+    K_tagged = 520,                /* K_tagged  */
+    K_this = 521,                  /* K_this  */
+    K_throughout = 522,            /* K_throughout  */
+    K_timeprecision = 523,         /* K_timeprecision  */
+    K_timeunit = 524,              /* K_timeunit  */
+    K_type = 525,                  /* K_type  */
+    K_typedef = 526,               /* K_typedef  */
+    K_union = 527,                 /* K_union  */
+    K_unique = 528,                /* K_unique  */
+    K_var = 529,                   /* K_var  */
+    K_virtual = 530,               /* K_virtual  */
+    K_void = 531,                  /* K_void  */
+    K_wait_order = 532,            /* K_wait_order  */
+    K_wildcard = 533,              /* K_wildcard  */
+    K_with = 534,                  /* K_with  */
+    K_within = 535,                /* K_within  */
+    K_timeprecision_check = 536,   /* K_timeprecision_check  */
+    K_timeunit_check = 537,        /* K_timeunit_check  */
+    K_accept_on = 538,             /* K_accept_on  */
+    K_checker = 539,               /* K_checker  */
+    K_endchecker = 540,            /* K_endchecker  */
+    K_eventually = 541,            /* K_eventually  */
+    K_global = 542,                /* K_global  */
+    K_implies = 543,               /* K_implies  */
+    K_let = 544,                   /* K_let  */
+    K_nexttime = 545,              /* K_nexttime  */
+    K_reject_on = 546,             /* K_reject_on  */
+    K_restrict = 547,              /* K_restrict  */
+    K_s_always = 548,              /* K_s_always  */
+    K_s_eventually = 549,          /* K_s_eventually  */
+    K_s_nexttime = 550,            /* K_s_nexttime  */
+    K_s_until = 551,               /* K_s_until  */
+    K_s_until_with = 552,          /* K_s_until_with  */
+    K_strong = 553,                /* K_strong  */
+    K_sync_accept_on = 554,        /* K_sync_accept_on  */
+    K_sync_reject_on = 555,        /* K_sync_reject_on  */
+    K_unique0 = 556,               /* K_unique0  */
+    K_until = 557,                 /* K_until  */
+    K_until_with = 558,            /* K_until_with  */
+    K_untyped = 559,               /* K_untyped  */
+    K_weak = 560,                  /* K_weak  */
+    K_above = 561,                 /* K_above  */
+    K_abs = 562,                   /* K_abs  */
+    K_absdelay = 563,              /* K_absdelay  */
+    K_abstol = 564,                /* K_abstol  */
+    K_access = 565,                /* K_access  */
+    K_acos = 566,                  /* K_acos  */
+    K_acosh = 567,                 /* K_acosh  */
+    K_ac_stim = 568,               /* K_ac_stim  */
+    K_aliasparam = 569,            /* K_aliasparam  */
+    K_analog = 570,                /* K_analog  */
+    K_analysis = 571,              /* K_analysis  */
+    K_asin = 572,                  /* K_asin  */
+    K_asinh = 573,                 /* K_asinh  */
+    K_atan = 574,                  /* K_atan  */
+    K_atan2 = 575,                 /* K_atan2  */
+    K_atanh = 576,                 /* K_atanh  */
+    K_branch = 577,                /* K_branch  */
+    K_ceil = 578,                  /* K_ceil  */
+    K_connect = 579,               /* K_connect  */
+    K_connectmodule = 580,         /* K_connectmodule  */
+    K_connectrules = 581,          /* K_connectrules  */
+    K_continuous = 582,            /* K_continuous  */
+    K_cos = 583,                   /* K_cos  */
+    K_cosh = 584,                  /* K_cosh  */
+    K_ddt = 585,                   /* K_ddt  */
+    K_ddt_nature = 586,            /* K_ddt_nature  */
+    K_ddx = 587,                   /* K_ddx  */
+    K_discipline = 588,            /* K_discipline  */
+    K_discrete = 589,              /* K_discrete  */
+    K_domain = 590,                /* K_domain  */
+    K_driver_update = 591,         /* K_driver_update  */
+    K_endconnectrules = 592,       /* K_endconnectrules  */
+    K_enddiscipline = 593,         /* K_enddiscipline  */
+    K_endnature = 594,             /* K_endnature  */
+    K_endparamset = 595,           /* K_endparamset  */
+    K_exclude = 596,               /* K_exclude  */
+    K_exp = 597,                   /* K_exp  */
+    K_final_step = 598,            /* K_final_step  */
+    K_flicker_noise = 599,         /* K_flicker_noise  */
+    K_floor = 600,                 /* K_floor  */
+    K_flow = 601,                  /* K_flow  */
+    K_from = 602,                  /* K_from  */
+    K_ground = 603,                /* K_ground  */
+    K_hypot = 604,                 /* K_hypot  */
+    K_idt = 605,                   /* K_idt  */
+    K_idtmod = 606,                /* K_idtmod  */
+    K_idt_nature = 607,            /* K_idt_nature  */
+    K_inf = 608,                   /* K_inf  */
+    K_initial_step = 609,          /* K_initial_step  */
+    K_laplace_nd = 610,            /* K_laplace_nd  */
+    K_laplace_np = 611,            /* K_laplace_np  */
+    K_laplace_zd = 612,            /* K_laplace_zd  */
+    K_laplace_zp = 613,            /* K_laplace_zp  */
+    K_last_crossing = 614,         /* K_last_crossing  */
+    K_limexp = 615,                /* K_limexp  */
+    K_ln = 616,                    /* K_ln  */
+    K_log = 617,                   /* K_log  */
+    K_max = 618,                   /* K_max  */
+    K_merged = 619,                /* K_merged  */
+    K_min = 620,                   /* K_min  */
+    K_nature = 621,                /* K_nature  */
+    K_net_resolution = 622,        /* K_net_resolution  */
+    K_noise_table = 623,           /* K_noise_table  */
+    K_paramset = 624,              /* K_paramset  */
+    K_potential = 625,             /* K_potential  */
+    K_pow = 626,                   /* K_pow  */
+    K_resolveto = 627,             /* K_resolveto  */
+    K_sin = 628,                   /* K_sin  */
+    K_sinh = 629,                  /* K_sinh  */
+    K_slew = 630,                  /* K_slew  */
+    K_split = 631,                 /* K_split  */
+    K_sqrt = 632,                  /* K_sqrt  */
+    K_tan = 633,                   /* K_tan  */
+    K_tanh = 634,                  /* K_tanh  */
+    K_timer = 635,                 /* K_timer  */
+    K_transition = 636,            /* K_transition  */
+    K_units = 637,                 /* K_units  */
+    K_white_noise = 638,           /* K_white_noise  */
+    K_wreal = 639,                 /* K_wreal  */
+    K_zi_nd = 640,                 /* K_zi_nd  */
+    K_zi_np = 641,                 /* K_zi_np  */
+    K_zi_zd = 642,                 /* K_zi_zd  */
+    K_zi_zp = 643,                 /* K_zi_zp  */
+    K_TAND = 644,                  /* K_TAND  */
+    K_MUL_EQ = 645,                /* K_MUL_EQ  */
+    K_DIV_EQ = 646,                /* K_DIV_EQ  */
+    K_MOD_EQ = 647,                /* K_MOD_EQ  */
+    K_AND_EQ = 648,                /* K_AND_EQ  */
+    K_OR_EQ = 649,                 /* K_OR_EQ  */
+    K_XOR_EQ = 650,                /* K_XOR_EQ  */
+    K_LS_EQ = 651,                 /* K_LS_EQ  */
+    K_RS_EQ = 652,                 /* K_RS_EQ  */
+    K_RSS_EQ = 653,                /* K_RSS_EQ  */
+    UNARY_PREC = 654,              /* UNARY_PREC  */
+    less_than_K_else = 655         /* less_than_K_else  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
+#endif
+
+/* Value type.  */
+#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
+union YYSTYPE
+{
+#line 316 "parse.y"
+
+      bool flag;
+
+      char letter;
+      int  int_val;
+
+	/* text items are C strings allocated by the lexor using
+	   strdup. They can be put into lists with the texts type. */
+      char*text;
+      list<perm_string>*perm_strings;
+
+      list<pair<perm_string,PExpr*> >*port_list;
+
+      pform_name_t*pform_name;
+
+      ivl_discipline_t discipline;
+
+      hname_t*hier;
+
+      list<string>*strings;
+
+      struct str_pair_t drive;
+
+      PCase::Item*citem;
+      svector<PCase::Item*>*citems;
+
+      lgate*gate;
+      svector<lgate>*gates;
+
+      Module::port_t *mport;
+      LexicalScope::range_t* value_range;
+      vector<Module::port_t*>*mports;
+
+      named_number_t* named_number;
+      list<named_number_t>* named_numbers;
+
+      named_pexpr_t*named_pexpr;
+      list<named_pexpr_t>*named_pexprs;
+      struct parmvalue_t*parmvalue;
+      list<pform_range_t>*ranges;
+
+      PExpr*expr;
+      list<PExpr*>*exprs;
+
+      svector<PEEvent*>*event_expr;
+
+      NetNet::Type nettype;
+      PGBuiltin::Type gatetype;
+      NetNet::PortType porttype;
+      ivl_variable_type_t vartype;
+      PBlock::BL_TYPE join_keyword;
+
+      PWire*wire;
+      svector<PWire*>*wires;
+
+      PEventStatement*event_statement;
+      Statement*statement;
+      vector<Statement*>*statement_list;
+
+      PTaskFuncArg function_type;
+
+      net_decl_assign_t*net_decl_assign;
+      enum_type_t*enum_type;
+
+      decl_assignment_t*decl_assignment;
+      list<decl_assignment_t*>*decl_assignments;
+
+      struct_member_t*struct_member;
+      list<struct_member_t*>*struct_members;
+      struct_type_t*struct_type;
+
+      data_type_t*data_type;
+      class_type_t*class_type;
+      real_type_t::type_t real_type;
+      property_qualifier_t property_qualifier;
+
+      verinum* number;
+
+      verireal* realtime;
+
+      PSpecPath* specpath;
+      list<index_component_t> *dimensions;
+
+#line 548 "parse.hh"
+
+};
+typedef union YYSTYPE YYSTYPE;
+# define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
+#endif
+
+/* Location type.  */
+#if ! defined YYLTYPE && ! defined YYLTYPE_IS_DECLARED
+typedef struct YYLTYPE YYLTYPE;
+struct YYLTYPE
+{
+  int first_line;
+  int first_column;
+  int last_line;
+  int last_column;
+};
+# define YYLTYPE_IS_DECLARED 1
+# define YYLTYPE_IS_TRIVIAL 1
+#endif
+
+
+extern YYSTYPE VLlval;
+extern YYLTYPE VLlloc;
+
+int VLparse (void);
+
+
+#endif /* !YY_VL_PARSE_HH_INCLUDED  */
@@ -49,6 +49,15 @@ extern void pform_dump(std::ostream&out, const PPackage*pac);
  */
 extern int  pform_parse(const char*path, FILE*file =0);
 
+/*
+ * These map the named source file into memory so the lexer can scan
+ * it in place, with no stdio copies. lexor_map_input() returns -1
+ * when mapping is not possible, in which case the caller should fall
+ * back to handing the lexer an open FILE through vl_input.
+ */
+extern int  lexor_map_input(const char*path);
+extern void lexor_unmap_input(void);
+
 extern string vl_file;
 
 extern void pform_set_timescale(int units, int prec, const char*file,
@@ -42,8 +42,20 @@ struct vlltype {
 class LineInfo;
 inline void FILE_NAME(LineInfo*tmp, const struct vlltype&where)
 {
+	// This runs for every AST node the parser creates, and the
+	// text pointer only changes when the lexical analyzer crosses
+	// a file boundary, so remember the last interned name instead
+	// of re-hashing it through filename_strings every time.
+      static const char*last_text = 0;
+      static perm_string last_path;
+
+      if (where.text != last_text) {
+	    last_path = filename_strings.make(where.text);
+	    last_text = where.text;
+      }
+
       tmp->set_lineno(where.first_line);
-      tmp->set_file(filename_strings.make(where.text));
+      tmp->set_file(last_path);
 }
 
   /* This for compatibility with new and older bison versions. */
@@ -38,6 +38,10 @@
 # include  <sstream>
 # include  <cstring>
 # include  <cstdlib>
+#if !defined(__MINGW32__)
+# include  <unistd.h>
+# include  <fcntl.h>
+#endif
 
 # include  "ivl_assert.h"
 # include  "ivl_alloc.h"
@@ -3031,16 +3035,33 @@ extern void reset_lexor();
 
 int pform_parse(const char*path, FILE*file)
 {
+      bool mapped = false;
+
       vl_file = path;
       if (file == 0) {
 
-	    if (strcmp(path, "-") == 0)
+	    if (strcmp(path, "-") == 0) {
 		  vl_input = stdin;
-	    else
+
+	    } else if (lexor_map_input(path) >= 0) {
+		    /* The lexer scans the mapped image in place, so
+		       there is no FILE to read through. */
+		  mapped = true;
+		  vl_input = 0;
+
+	    } else {
 		  vl_input = fopen(path, "r");
-	    if (vl_input == 0) {
-		  cerr << "Unable to open " <<vl_file << "." << endl;
-		  return 11;
+		  if (vl_input == 0) {
+			cerr << "Unable to open " <<vl_file << "." << endl;
+			return 11;
+		  }
+#if !defined(__MINGW32__) && defined(_POSIX_ADVISORY_INFO) && _POSIX_ADVISORY_INFO > 0
+		    /* The input is consumed front to back exactly
+		       once, so let the kernel read ahead of the
+		       parse. */
+		  posix_fadvise(fileno(vl_input), 0, 0,
+		                POSIX_FADV_SEQUENTIAL);
+#endif
 	    }
 
       } else {
@@ -3052,7 +3073,7 @@ int pform_parse(const char*path, FILE*file)
       warn_count = 0;
       int rc = VLparse();
 
-      if (file == 0)
+      if (file == 0 && !mapped)
 	    fclose(vl_input);
 
       if (rc) {
@@ -3061,5 +3082,22 @@ int pform_parse(const char*path, FILE*file)
       }
 
       destroy_lexor();
+      lexor_unmap_input();
       return error_count;
 }
+
+/*
+ * The pform AST nodes all come from pooled heaps, so once the
+ * elaboration phase is done with the pform the whole lot can be
+ * handed back chunk at a time instead of walking millions of nodes.
+ * Out-of-pool allocations owned by the nodes (container members and
+ * the like) are not reclaimed, which matches the old behavior of
+ * simply never deleting the nodes at all.
+ */
+void pform_release_nodes(void)
+{
+      PExpr::heap_release();
+      Statement::heap_release();
+      PWire::heap_release();
+      PGate::heap_release();
+}
@@ -492,6 +492,14 @@ extern PExpr* pform_make_branch_probe_expression(const struct vlltype&loc,
  */
 extern void parm_to_defparam_list(const string&param);
 
+/*
+ * Release the pooled pform AST nodes (expressions, statements, wires
+ * and gates) in bulk. Only call this after elaboration is complete
+ * and the pform modules have been deleted: no destructors are run,
+ * and every pform node pointer is dangling afterwards.
+ */
+extern void pform_release_nodes(void);
+
 /*
  * Tasks to set the timeunit or timeprecision for SystemVerilog.
  */
@@ -174,6 +174,23 @@ static syn_token_t*first_ = 0;
 static syn_token_t*last_ = 0;
 static syn_token_t*ptr_ = 0;
 
+/*
+ * Tokens are created for every statement of every process scanned,
+ * so recycle them through this free list instead of hitting the
+ * global heap once per token.
+ */
+static syn_token_t*free_tokens_ = 0;
+
+static syn_token_t* syn_token_new()
+{
+      syn_token_t*cur = free_tokens_;
+      if (cur)
+	    free_tokens_ = cur->next_;
+      else
+	    cur = new syn_token_t;
+      return cur;
+}
+
 /*
  * The match class is used to take a process and turn it into a stream
  * of tokens. This stream is used by the yylex function to feed tokens
@@ -186,7 +203,7 @@ struct tokenize : public proc_match_t {
       int assign(NetAssign*dev)
       {
 	    syn_token_t*cur;
-	    cur = new syn_token_t;
+	    cur = syn_token_new();
 	    // Bit Muxes can't be synthesized (yet), but it's too much
 	    // work to detect them now.
 	    // cur->token = dev->l_val(0)->bmux() ? S_ASSIGN_MUX : S_ASSIGN;
@@ -201,7 +218,7 @@ struct tokenize : public proc_match_t {
       int assign_nb(NetAssignNB*dev)
       {
 	    syn_token_t*cur;
-	    cur = new syn_token_t;
+	    cur = syn_token_new();
 	    // Bit Muxes can't be synthesized (yet), but it's too much
 	    // work to detect them now.
 	    // cur->token = dev->l_val(0)->bmux() ? S_ASSIGN_MUX : S_ASSIGN;
@@ -217,13 +234,13 @@ struct tokenize : public proc_match_t {
       {
 	    syn_token_t*cur;
 
-	    cur = new syn_token_t;
+	    cur = syn_token_new();
 	    cur->token = S_IF;
 	    cur->next_ = 0;
 	    last_->next_ = cur;
 	    last_ = cur;
 
-	    cur = new syn_token_t;
+	    cur = syn_token_new();
 	    cur->token = S_EXPR;
 	    cur->expr = dev->expr();
 	    cur->next_ = 0;
@@ -236,7 +253,7 @@ struct tokenize : public proc_match_t {
 	    dev -> if_clause() -> match_proc(this);
 
 	    if (dev->else_clause()) {
-		  cur = new syn_token_t;
+		  cur = syn_token_new();
 		  cur->token = S_ELSE;
 		  cur->next_ = 0;
 		  last_->next_ = cur;
@@ -245,7 +262,7 @@ struct tokenize : public proc_match_t {
 		  dev -> else_clause() -> match_proc(this);
 	    }
 
-	    cur = new syn_token_t;
+	    cur = syn_token_new();
 	    cur->token = ';';
 	    cur->next_ = 0;
 	    last_->next_ = cur;
@@ -257,21 +274,21 @@ struct tokenize : public proc_match_t {
       {
 	    syn_token_t*cur;
 
-	    cur = new syn_token_t;
+	    cur = syn_token_new();
 	    cur->token = '@';
 	    cur->evwait = dev;
 	    cur->next_ = 0;
 	    last_->next_ = cur;
 	    last_ = cur;
 
-	    cur = new syn_token_t;
+	    cur = syn_token_new();
 	    cur->token = '(';
 	    cur->next_ = 0;
 	    last_->next_ = cur;
 	    last_ = cur;
 
 	    for (unsigned idx = 0;  idx < dev->nevents(); idx += 1) {
-		  cur = new syn_token_t;
+		  cur = syn_token_new();
 		  cur->token = S_EVENT;
 		  cur->event = dev->event(idx);
 		  cur->next_ = 0;
@@ -279,7 +296,7 @@ struct tokenize : public proc_match_t {
 		  last_ = cur;
 	    }
 
-	    cur = new syn_token_t;
+	    cur = syn_token_new();
 	    cur->token = ')';
 	    cur->next_ = 0;
 	    last_->next_ = cur;
@@ -287,7 +304,7 @@ struct tokenize : public proc_match_t {
 
 	    dev -> statement() -> match_proc(this);
 
-	    cur = new syn_token_t;
+	    cur = syn_token_new();
 	    cur->token = ';';
 	    cur->next_ = 0;
 	    last_->next_ = cur;
@@ -298,7 +315,7 @@ struct tokenize : public proc_match_t {
 
 static void syn_start_process(NetProcTop*t)
 {
-      first_ = new syn_token_t;
+      first_ = syn_token_new();
       last_ = first_;
       ptr_ = first_;
 
@@ -315,7 +332,8 @@ static void syn_done_process()
       while (first_) {
 	    syn_token_t*cur = first_;
 	    first_ = cur->next_;
-	    delete cur;
+	    cur->next_ = free_tokens_;
+	    free_tokens_ = cur;
       }
 }
 
@@ -341,6 +359,21 @@ struct syn_rules_f  : public functor_t {
 	    if (top->scope()->attribute(perm_string::literal("ivl_synthesis_cell")).len() > 0)
 		  return;
 
+	      /* Every rule in the grammar starts with
+		    S_ALWAYS '@' '(' S_EVENT ')'
+		 with exactly one event, so classify the process
+		 shape up front and skip tokenizing the (possibly
+		 large) statement tree of anything else rather than
+		 letting the parser fail on the full token stream. */
+	    if (top->type() != IVL_PR_ALWAYS)
+		  return;
+
+	    NetEvWait*evw = dynamic_cast<NetEvWait*> (top->statement());
+	    if (evw == 0)
+		  return;
+	    if (evw->nevents() != 1)
+		  return;
+
 	    syn_start_process(top);
 	    yyparse();
 	    syn_done_process();
@@ -114,6 +114,7 @@ class synth_f  : public functor_t {
 
     public:
       synth_f() { top_ = NULL; }
+      unsigned scan_mask() const { return SCAN_PROCESS; }
       void process(Design*, NetProcTop*);
 
     private:
@@ -901,15 +901,25 @@ bool NetProcTop::synth_sync(Design*des)
 class synth2_f  : public functor_t {
 
     public:
+      unsigned scan_mask() const { return SCAN_PROCESS; }
       void process(Design*, NetProcTop*);
 
+	// Processes to synthesize, classified by the scan. Each
+	// entry is an independent work item that the driver works
+	// through after the scan completes.
+      vector<NetProcTop*> sync_list;
+      vector<NetProcTop*> async_list;
+
     private:
 };
 
 
 /*
- * Look at a process. If it is asynchronous, then synthesize it as an
- * asynchronous process and delete the process itself for its gates.
+ * Look at a process and classify it. Processes that are synchronous
+ * or asynchronous are queued for synthesis; anything else is
+ * diagnosed here. The synthesis proper happens after the scan, in
+ * the synth2 driver below, so that the process list is not edited
+ * while the functor is walking it.
  */
 void synth2_f::process(Design*des, NetProcTop*top)
 {
@@ -921,17 +931,10 @@ void synth2_f::process(Design*des, NetProcTop*top)
       if (top->scope()->attribute(perm_string::literal("ivl_synthesis_cell")).len() > 0)
 	    return;
 
-      if (top->is_synchronous()) do {
-	    bool flag = top->synth_sync(des);
-	    if (! flag) {
-		  cerr << top->get_fileline() << ": error: "
-		       << "Unable to synthesize synchronous process." << endl;
-		  des->errors += 1;
-		  return;
-	    }
-	    des->delete_process(top);
+      if (top->is_synchronous()) {
+	    sync_list.push_back(top);
 	    return;
-      } while (0);
+      }
 
       if (! top->is_asynchronous()) {
 	    bool synth_error_flag = false;
@@ -958,19 +961,44 @@ void synth2_f::process(Design*des, NetProcTop*top)
 	    return;
       }
 
-      if (! top->synth_async(des)) {
-	    cerr << top->get_fileline() << ": internal error: "
-		 << "is_asynchronous does not match "
-		 << "sync_async results." << endl;
-	    des->errors += 1;
-	    return;
-      }
-
-      des->delete_process(top);
+      async_list.push_back(top);
 }
 
 void synth2(Design*des)
 {
       synth2_f synth_obj;
       des->functor(&synth_obj);
+
+	/* Synthesize each classified process. The work items are
+	   independent of each other, so the order they are worked
+	   does not matter beyond reproducibility. Collect the
+	   processes that synthesize successfully and commit all the
+	   deletions in one batch at the end, so the process list is
+	   edited (and searched) only once. */
+      set<NetProcTop*> dead_list;
+
+      for (size_t idx = 0 ; idx < synth_obj.sync_list.size() ; idx += 1) {
+	    NetProcTop*top = synth_obj.sync_list[idx];
+	    if (! top->synth_sync(des)) {
+		  cerr << top->get_fileline() << ": error: "
+		       << "Unable to synthesize synchronous process." << endl;
+		  des->errors += 1;
+		  continue;
+	    }
+	    dead_list.insert(top);
+      }
+
+      for (size_t idx = 0 ; idx < synth_obj.async_list.size() ; idx += 1) {
+	    NetProcTop*top = synth_obj.async_list[idx];
+	    if (! top->synth_async(des)) {
+		  cerr << top->get_fileline() << ": internal error: "
+		       << "is_asynchronous does not match "
+		       << "sync_async results." << endl;
+		  des->errors += 1;
+		  continue;
+	    }
+	    dead_list.insert(top);
+      }
+
+      des->delete_processes(dead_list);
 }
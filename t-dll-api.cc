@@ -905,6 +905,12 @@ extern "C" ivl_nexus_t ivl_logic_pin(ivl_net_logic_t net, unsigned pin)
       return net->pins_[pin];
 }
 
+extern "C" ivl_nexus_t const* ivl_logic_pin_array(ivl_net_logic_t net)
+{
+      assert(net);
+      return net->pins_;
+}
+
 extern "C" ivl_udp_t ivl_logic_udp(ivl_net_logic_t net)
 {
       assert(net->type_ == IVL_LO_UDP);
@@ -1651,6 +1657,13 @@ extern "C" ivl_nexus_ptr_t ivl_nexus_ptr(ivl_nexus_t net, unsigned idx)
       return & net->ptrs_[idx];
 }
 
+extern "C" void ivl_nexus_ptr_array(ivl_nexus_t net, ivl_nexus_ptr_t*ptrs)
+{
+      assert(net);
+      for (size_t idx = 0 ; idx < net->ptrs_.size() ; idx += 1)
+	    ptrs[idx] = & net->ptrs_[idx];
+}
+
 extern "C" ivl_drive_t ivl_nexus_ptr_drive0(ivl_nexus_ptr_t net)
 {
       assert(net);
@@ -1984,6 +1997,45 @@ extern "C" ivl_lpm_t ivl_scope_lpm(ivl_scope_t net, unsigned idx)
       return net->lpm_[idx];
 }
 
+extern "C" int ivl_scope_scan_logs(ivl_scope_t net,
+				   ivl_net_logic_f func, void*cd)
+{
+      assert(net);
+      for (unsigned idx = 0 ;  idx < net->nlog_ ;  idx += 1) {
+	    int rc = func(net->log_[idx], cd);
+	    if (rc != 0)
+		  return rc;
+      }
+
+      return 0;
+}
+
+extern "C" int ivl_scope_scan_lpms(ivl_scope_t net,
+				   ivl_lpm_f func, void*cd)
+{
+      assert(net);
+      for (unsigned idx = 0 ;  idx < net->nlpm_ ;  idx += 1) {
+	    int rc = func(net->lpm_[idx], cd);
+	    if (rc != 0)
+		  return rc;
+      }
+
+      return 0;
+}
+
+extern "C" int ivl_scope_scan_sigs(ivl_scope_t net,
+				   ivl_signal_f func, void*cd)
+{
+      assert(net);
+      for (unsigned idx = 0 ;  idx < net->sigs_.size() ;  idx += 1) {
+	    int rc = func(net->sigs_[idx], cd);
+	    if (rc != 0)
+		  return rc;
+      }
+
+      return 0;
+}
+
 static unsigned scope_name_len(ivl_scope_t net)
 {
       unsigned len = 0;
@@ -2423,6 +2475,23 @@ extern "C" ivl_statement_t ivl_stmt_block_stmt(ivl_statement_t net,
       }
 }
 
+extern "C" void ivl_stmt_block_stmt_array(ivl_statement_t net,
+					  ivl_statement_t*stmts)
+{
+      switch (net->type_) {
+	  case IVL_ST_BLOCK:
+	  case IVL_ST_FORK:
+	  case IVL_ST_FORK_JOIN_ANY:
+	  case IVL_ST_FORK_JOIN_NONE:
+	    for (unsigned idx = 0 ; idx < net->u_.block_.nstmt_ ; idx += 1)
+		  stmts[idx] = net->u_.block_.stmt_ + idx;
+	    break;
+	  default:
+	    assert(0);
+	    break;
+      }
+}
+
 extern "C" ivl_scope_t ivl_stmt_call(ivl_statement_t net)
 {
       switch (net->type_) {
@@ -104,10 +104,11 @@ inline const char*dlerror(void)
 #endif
 
 /*
- * The custom new operator for the ivl_nexus_s type allows us to
- * allocate nexus objects in blocks. There are generally lots of them
+ * The custom new operators for the shadow record types allow us to
+ * allocate the objects in blocks. There are generally lots of them
  * permanently allocated, and allocating them in blocks reduces the
- * allocation overhead.
+ * allocation overhead and keeps records of the same type contiguous
+ * in memory, so backend traversals walk sequential addresses.
  */
 
 template <class TYPE> void* pool_permalloc(size_t s)
@@ -149,6 +150,56 @@ void ivl_net_const_s::operator delete(void*, size_t)
       assert(0);
 }
 
+void* ivl_event_s::operator new(size_t s)
+{
+      return pool_permalloc<struct ivl_event_s>(s);
+}
+
+void ivl_event_s::operator delete(void*, size_t)
+{
+      assert(0);
+}
+
+void* ivl_lpm_s::operator new(size_t s)
+{
+      return pool_permalloc<struct ivl_lpm_s>(s);
+}
+
+void ivl_lpm_s::operator delete(void*, size_t)
+{
+      assert(0);
+}
+
+void* ivl_net_logic_s::operator new(size_t s)
+{
+      return pool_permalloc<struct ivl_net_logic_s>(s);
+}
+
+void ivl_net_logic_s::operator delete(void*, size_t)
+{
+      assert(0);
+}
+
+void* ivl_scope_s::operator new(size_t s)
+{
+      return pool_permalloc<struct ivl_scope_s>(s);
+}
+
+void ivl_scope_s::operator delete(void*, size_t)
+{
+      assert(0);
+}
+
+void* ivl_signal_s::operator new(size_t s)
+{
+      return pool_permalloc<struct ivl_signal_s>(s);
+}
+
+void ivl_signal_s::operator delete(void*, size_t)
+{
+      assert(0);
+}
+
 static StringHeapLex net_const_strings;
 
 inline static const char *basename(ivl_scope_t scope, const char *inst)
@@ -211,6 +211,9 @@ struct ivl_event_s {
       unsigned lineno;
       unsigned nany, nneg, npos;
       ivl_nexus_t*pins;
+
+      void* operator new (size_t s);
+      void  operator delete(void*obj, size_t s); // Not implemented
 };
 
 /*
@@ -429,6 +432,9 @@ struct ivl_lpm_s {
 		  ivl_event_t trigger;
 	    } ufunc;
       } u_;
+
+      void* operator new (size_t s);
+      void  operator delete(void*obj, size_t s); // Not implemented
 };
 
 /*
@@ -505,6 +511,9 @@ struct ivl_net_logic_s {
       unsigned nattr;
 
       ivl_expr_t delay[3];
+
+      void* operator new (size_t s);
+      void  operator delete(void*obj, size_t s); // Not implemented
 };
 
 struct ivl_switch_s {
@@ -680,6 +689,9 @@ struct ivl_scope_s {
 
       struct ivl_attribute_s*attr;
       unsigned nattr;
+
+      void* operator new (size_t s);
+      void  operator delete(void*obj, size_t s); // Not implemented
 };
 
 /*
@@ -725,6 +737,9 @@ struct ivl_signal_s {
 
       struct ivl_attribute_s*attr;
       unsigned nattr;
+
+      void* operator new (size_t s);
+      void  operator delete(void*obj, size_t s); // Not implemented
 };
 
 
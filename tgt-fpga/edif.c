@@ -54,11 +54,20 @@ struct edif_s {
       struct edif_joint_s*nexa;
 };
 
+/* Cells are looked up by name once per device instance, so in
+   addition to the plain list they are kept in this hash table. The
+   cell name encodes the structural shape of the macro (type, width,
+   flags) so repeated shapes are derived once and the instances that
+   follow find the memoized cell here. */
+# define EDIF_CELL_HASH 256
+
 struct edif_xlibrary_s {
 	/* Name of this library. */
       const char*name;
 	/* The cells that are contained in this library. */
       struct edif_cell_s*cells;
+	/* Same cells, hashed by name for the findcell lookup. */
+      struct edif_cell_s*cell_hash[EDIF_CELL_HASH];
 	/* point to the optional celltable. */
       const struct edif_xlib_celltable*celltable;
 	/* used to list libraries in an edif_t. */
@@ -82,6 +91,7 @@ struct edif_cell_s {
 
       struct cellref_property_*property;
       struct edif_cell_s*next;
+      struct edif_cell_s*hash_next;
 };
 
 struct edif_cellref_s {
@@ -165,12 +175,23 @@ void edif_pstring(edif_t edf, const char*name, const char*value)
       edf->property = prp;
 }
 
+static unsigned edif_cell_name_hash(const char*name)
+{
+      unsigned hash = 0;
+      while (*name)
+	    hash = hash*13 + (unsigned char)*name++;
+      return hash % EDIF_CELL_HASH;
+}
+
 edif_xlibrary_t edif_xlibrary_create(edif_t edf, const char*name)
 {
+      unsigned idx;
       edif_xlibrary_t xlib = malloc(sizeof(struct edif_xlibrary_s));
 
       xlib->name  = name;
       xlib->cells = 0;
+      for (idx = 0 ;  idx < EDIF_CELL_HASH ;  idx += 1)
+	    xlib->cell_hash[idx] = 0;
       xlib->celltable = 0;
       xlib->next = edf->xlibs;
       edf->xlibs = xlib;
@@ -190,8 +211,9 @@ edif_cell_t edif_xlibrary_findcell(edif_xlibrary_t xlib,
 {
       const struct edif_xlib_celltable*tcur;
       edif_cell_t cur;
+      unsigned hash = edif_cell_name_hash(cell_name);
 
-      for (cur = xlib->cells ;  cur ;  cur = cur->next) {
+      for (cur = xlib->cell_hash[hash] ;  cur ;  cur = cur->hash_next) {
 	    if (strcmp(cell_name, cur->name) == 0)
 		  return cur;
       }
@@ -267,6 +289,10 @@ edif_cell_t edif_xcell_create(edif_xlibrary_t xlib, const char*name,
       cell->next = xlib->cells;
       xlib->cells = cell;
 
+      idx = edif_cell_name_hash(name);
+      cell->hash_next = xlib->cell_hash[idx];
+      xlib->cell_hash[idx] = cell;
+
       return cell;
 }
 
@@ -20,10 +20,20 @@
 # include "version_base.h"
 # include "version_tag.h"
 # include "config.h"
+# include  <stdio.h>
 # include  <string.h>
 
 /*
- * This is a null target module. It does nothing.
+ * This is a null target module. By default it does nothing, so it can
+ * be used to check that a design elaborates without paying for code
+ * generation. It can optionally also collect design statistics and
+ * run cheap lint checks while it is at it:
+ *
+ *   -pstats=1   Write a statistics report (scope/process counts,
+ *               signal width and fanout histograms) to the -o file.
+ *
+ *   -plint=1    Print warnings for signals that are not connected
+ *               to anything else.
  */
 
 # include  "ivl_target.h"
@@ -47,8 +57,165 @@ static const char*version_string =
 ;
 
 
+static unsigned enable_stats = 0;
+static unsigned enable_lint = 0;
+static unsigned lint_warnings = 0;
+
+/* Histograms are kept in power-of-two buckets: bucket N counts the
+   values in the range [2**N, 2**(N+1)). Widths and fanouts beyond
+   2**15 all land in the last bucket. */
+# define HIST_BUCKETS 16
+
+static unsigned long count_scopes = 0;
+static unsigned long count_modules = 0;
+static unsigned long count_signals = 0;
+static unsigned long count_logs = 0;
+static unsigned long count_lpms = 0;
+static unsigned long count_pr_initial = 0;
+static unsigned long count_pr_always = 0;
+static unsigned long count_pr_final = 0;
+static unsigned long hist_width[HIST_BUCKETS];
+static unsigned long hist_fanout[HIST_BUCKETS];
+
+static unsigned hist_bucket(unsigned long value)
+{
+      unsigned idx = 0;
+      while (value > 1 && idx < HIST_BUCKETS-1) {
+	    value >>= 1;
+	    idx += 1;
+      }
+      return idx;
+}
+
+static void scan_signal(ivl_signal_t sig)
+{
+      unsigned word, words = ivl_signal_array_count(sig);
+
+      count_signals += 1;
+      hist_width[hist_bucket(ivl_signal_width(sig))] += 1;
+
+      for (word = 0; word < words; word += 1) {
+	    ivl_nexus_t nex = ivl_signal_nex(sig, word);
+	    unsigned ptrs = nex ? ivl_nexus_ptrs(nex) : 0;
+
+	    hist_fanout[hist_bucket(ptrs)] += 1;
+
+	      /* A nexus with a single pointer connects the signal to
+	       * nothing at all. Local (compiler generated) signals
+	       * are left alone, and ports are expected to dangle in
+	       * the root scope. */
+	    if (enable_lint && ptrs <= 1 && !ivl_signal_local(sig)
+	        && ivl_signal_port(sig) == IVL_SIP_NONE) {
+		  fprintf(stderr, "%s:%u: null warning: signal %s is "
+		                  "not connected to anything.\n",
+		                  ivl_signal_file(sig),
+		                  ivl_signal_lineno(sig),
+		                  ivl_signal_name(sig));
+		  lint_warnings += 1;
+	    }
+      }
+}
+
+static int scan_scope(ivl_scope_t scope, void*cd)
+{
+      unsigned idx;
+
+      count_scopes += 1;
+      if (ivl_scope_type(scope) == IVL_SCT_MODULE) count_modules += 1;
+      count_logs += ivl_scope_logs(scope);
+      count_lpms += ivl_scope_lpms(scope);
+
+      for (idx = 0; idx < ivl_scope_sigs(scope); idx += 1)
+	    scan_signal(ivl_scope_sig(scope, idx));
+
+      return ivl_scope_children(scope, scan_scope, cd);
+}
+
+static int scan_process(ivl_process_t net, void*cd)
+{
+      (void)cd; /* Parameter is not used. */
+      switch (ivl_process_type(net)) {
+	  case IVL_PR_INITIAL:
+	    count_pr_initial += 1;
+	    break;
+	  case IVL_PR_ALWAYS:
+	    count_pr_always += 1;
+	    break;
+	  case IVL_PR_FINAL:
+	    count_pr_final += 1;
+	    break;
+      }
+      return 0;
+}
+
+static void emit_histogram(FILE*out, const char*title,
+                           const unsigned long*hist)
+{
+      unsigned idx, top;
+
+      for (top = HIST_BUCKETS; top > 0; top -= 1)
+	    if (hist[top-1]) break;
+
+      fprintf(out, "%s\n", title);
+      for (idx = 0; idx < top; idx += 1) {
+	    fprintf(out, "  %6lu .. %6lu : %lu\n",
+	            idx ? (1UL << idx) : 0UL,
+	            (idx < HIST_BUCKETS-1) ? (1UL << (idx+1)) - 1 : ~0UL,
+	            hist[idx]);
+      }
+}
+
+static void emit_stats(FILE*out)
+{
+      fprintf(out, "Scopes:             %lu (%lu module instances)\n",
+              count_scopes, count_modules);
+      fprintf(out, "Signals:            %lu\n", count_signals);
+      fprintf(out, "Logic gates:        %lu\n", count_logs);
+      fprintf(out, "LPM devices:        %lu\n", count_lpms);
+      fprintf(out, "Initial processes:  %lu\n", count_pr_initial);
+      fprintf(out, "Always processes:   %lu\n", count_pr_always);
+      fprintf(out, "Final processes:    %lu\n", count_pr_final);
+      emit_histogram(out, "Signal width histogram:", hist_width);
+      emit_histogram(out, "Signal fanout histogram:", hist_fanout);
+}
+
 int target_design(ivl_design_t des)
 {
+      ivl_scope_t *roots;
+      unsigned nroots, idx;
+
+      enable_stats = strcmp(ivl_design_flag(des, "stats"), "") != 0;
+      enable_lint = strcmp(ivl_design_flag(des, "lint"), "") != 0;
+
+	/* The default behavior is to do nothing at all. */
+      if (!enable_stats && !enable_lint)
+	    return 0;
+
+      ivl_design_roots(des, &roots, &nroots);
+      for (idx = 0; idx < nroots; idx += 1)
+	    scan_scope(roots[idx], 0);
+
+      ivl_design_process(des, scan_process, 0);
+
+      if (enable_stats) {
+	    const char*path = ivl_design_flag(des, "-o");
+	    FILE*out = stdout;
+	    if (path && strcmp(path, "") != 0) {
+		  out = fopen(path, "w");
+		  if (out == 0) {
+			perror(path);
+			return -1;
+		  }
+	    }
+	    emit_stats(out);
+	    if (out != stdout) fclose(out);
+      }
+
+      if (lint_warnings) {
+	    fprintf(stderr, "null: %u lint warning%s.\n", lint_warnings,
+	            lint_warnings == 1 ? "" : "s");
+      }
+
       return 0;
 }
 
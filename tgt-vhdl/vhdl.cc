@@ -25,6 +25,7 @@
 
 #include <iostream>
 #include <fstream>
+#include <vector>
 #include <cstdarg>
 #include <cstdio>
 #include <cassert>
@@ -113,7 +114,13 @@ extern "C" int target_design(ivl_design_t des)
    // only if there were no errors generating entities or processes
    if (0 == g_errors) {
       const char *ofname = ivl_design_flag(des, "-o");
-      ofstream outfile(ofname);
+      ofstream outfile;
+      // The emitter makes many small insertions, so give the output
+      // stream a large buffer (set before open, as required for
+      // pubsetbuf to take effect) to batch the writes.
+      std::vector<char> outbuf(1 << 20);
+      outfile.rdbuf()->pubsetbuf(&outbuf[0], outbuf.size());
+      outfile.open(ofname);
       outfile << "-- This VHDL was converted from Verilog using the" << endl
               << "-- Icarus Verilog VHDL Code Generator " VERSION
                  " (" VERSION_TAG ")" << endl << endl;
@@ -25,7 +25,6 @@
 #include <cstring>
 #include <typeinfo>
 #include <iostream>
-#include <sstream>
 
 using namespace std;
 
@@ -36,11 +35,27 @@ int indent(int level)
    return level + VHDL_INDENT;
 }
 
+// Cache of newline-plus-indent strings, one per indent level seen so
+// far. Emitting is dominated by newline/indent output on big designs,
+// so build each string once rather than pushing the spaces through the
+// stream one character at a time (and avoid std::endl, which would
+// flush the output file on every line).
+static const std::string& nl_indent_string(int level)
+{
+   static std::vector<std::string> cache;
+
+   if (level < 0)
+      level = 0;
+   if (static_cast<size_t>(level) >= cache.size()) {
+      for (size_t l = cache.size(); l <= static_cast<size_t>(level); l++)
+         cache.push_back('\n' + std::string(l, ' '));
+   }
+   return cache[level];
+}
+
 std::string nl_string(int level)
 {
-   std::ostringstream ss;
-   newline(ss, level);
-   return ss.str();
+   return nl_indent_string(level);
 }
 
 /*
@@ -48,14 +63,12 @@ std::string nl_string(int level)
  */
 void newline(std::ostream &of, int level)
 {
-   of << std::endl;
-   while (level--)
-      of << ' ';
+   of << nl_indent_string(level);
 }
 
 void blank_line(std::ostream &of, int level)
 {
-   of << std::endl;
+   of << '\n';
    newline(of, level);
 }
 
@@ -865,9 +865,36 @@ static unsigned is_escaped(const char *id)
       return 1;
 }
 
+/*
+ * Identifier strings handed out by the ivl_ API are interned, so the
+ * same name nearly always arrives as the same pointer. Cache the
+ * is_escaped() answer per pointer so identifiers that are emitted
+ * over and over (bus names in a flattened netlist) are not rescanned
+ * character by character on every use. A collision or an un-interned
+ * string just rescans, so the cache cannot give a wrong answer.
+ */
+#define ID_CACHE_SIZE 1024
+
+static struct {
+      const char *id;
+      unsigned escaped;
+} id_cache[ID_CACHE_SIZE];
+
+static unsigned is_escaped_cached(const char *id)
+{
+      size_t slot = ((size_t)id >> 4) % ID_CACHE_SIZE;
+
+      if (id_cache[slot].id != id) {
+	    id_cache[slot].escaped = is_escaped(id);
+	    id_cache[slot].id = id;
+      }
+
+      return id_cache[slot].escaped;
+}
+
 void emit_id(const char *id)
 {
-      if (is_escaped(id)) fprintf(vlog_out, "\\%s ", id);
+      if (is_escaped_cached(id)) fprintf(vlog_out, "\\%s ", id);
       else fprintf(vlog_out, "%s", id);
 }
 
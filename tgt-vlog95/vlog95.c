@@ -171,6 +171,11 @@ int target_design(ivl_design_t des)
 	    return -1;
       }
 
+	/* The emitter works in many small fprintf() calls, so give
+	 * the output stream a large buffer to keep a multi-million
+	 * line netlist from being written a token at a time. */
+      setvbuf(vlog_out, NULL, _IOFBF, 1U << 20);
+
       fprintf(vlog_out, "/*\n");
       fprintf(vlog_out, " * 1364-1995 Verilog generated by Icarus Verilog "
                         "VLOG95 Code Generator,\n");
@@ -225,6 +225,78 @@ static void str_repeat(char*buf, const char*str, unsigned rpt)
       }
 }
 
+/*
+ * Constant drivers all compile down to a handful of little functor
+ * shapes, and big designs contain huge numbers of structurally
+ * identical ones (tied-off inputs, pull devices, undriven nets).
+ * Keep a table of the functor definitions already emitted, so that
+ * each distinct shape is written to the output file once and every
+ * later occurrence just references the shared label.
+ */
+struct shared_functor_cell {
+      char*defn;
+      char*label;
+      struct shared_functor_cell*next;
+};
+
+static struct shared_functor_cell*shared_functor_table[256];
+
+static unsigned shared_functor_hash(const char*text)
+{
+      unsigned hash = 5381;
+      while (*text)
+	    hash = (hash * 33) ^ (unsigned char) *text++;
+      return hash % 256;
+}
+
+/*
+ * Emit a functor definition, unless an identical definition has
+ * already been emitted, in which case nothing is written and the
+ * label of the earlier copy is reused. The defn is the definition
+ * text that follows the label, and the label is the name to use if
+ * the definition turns out to be new. Either way, return a malloced
+ * copy of the label that carries the definition.
+ */
+static char* draw_shared_functor(const char*defn, const char*label)
+{
+      unsigned hash = shared_functor_hash(defn);
+      struct shared_functor_cell*cur;
+
+      for (cur = shared_functor_table[hash] ;  cur ;  cur = cur->next) {
+	    if (strcmp(cur->defn, defn) == 0)
+		  return strdup(cur->label);
+      }
+
+      fprintf(vvp_out, "%s %s\n", label, defn);
+
+      cur = malloc(sizeof(struct shared_functor_cell));
+      cur->defn = strdup(defn);
+      cur->label = strdup(label);
+      cur->next = shared_functor_table[hash];
+      shared_functor_table[hash] = cur;
+
+      return strdup(cur->label);
+}
+
+/*
+ * Draw (or share) the BUFT functor that drives a constant value. The
+ * value string is consumed.
+ */
+static char* draw_const_functor(char*value, const void*key)
+{
+      char label[64];
+      char*defn = malloc(strlen(value) + 64);
+      char*result;
+
+      sprintf(defn, ".functor BUFT 1, %s, C4<0>, C4<0>, C4<0>;", value);
+      snprintf(label, sizeof label, "L_%p", key);
+
+      result = draw_shared_functor(defn, label);
+      free(defn);
+      free(value);
+      return result;
+}
+
 /*
  * This function takes a nexus and looks for an input functor. It then
  * draws to the output a string that represents that functor. What we
@@ -295,7 +367,6 @@ static char* draw_net_input_drive(ivl_nexus_t nex, ivl_nexus_ptr_t nptr)
 
       if (lptr && (ivl_logic_type(lptr) == IVL_LO_PULLUP)) {
 	    char*result;
-	    char tmp[32];
 	    if (ivl_nexus_ptr_drive1(nptr) == IVL_DR_STRONG) {
 		  size_t result_len = 5 + ivl_logic_width(lptr);
 		  result = malloc(result_len);
@@ -332,12 +403,9 @@ static char* draw_net_input_drive(ivl_nexus_t nex, ivl_nexus_ptr_t nptr)
 	    }
 
 	      /* Make the constant an argument to a BUFZ, which is
-		 what we use to drive the PULLed value. */
-	    fprintf(vvp_out, "L_%p .functor BUFT 1, %s, C4<0>, C4<0>, C4<0>;\n",
-		    lptr, result);
-	    snprintf(tmp, sizeof tmp, "L_%p", lptr);
-	    result = realloc(result, strlen(tmp)+1);
-	    strcpy(result, tmp);
+		 what we use to drive the PULLed value. Identical pull
+		 drivers share a single functor. */
+	    result = draw_const_functor(result, lptr);
 	    return result;
       }
 
@@ -454,13 +522,9 @@ static char* draw_net_input_drive(ivl_nexus_t nex, ivl_nexus_ptr_t nptr)
 		  result = strdup(tmp);
 
 	    } else {
-		  char tmp[64];
-		  fprintf(vvp_out, "L_%p .functor BUFT 1, %s, "
-			  "C4<0>, C4<0>, C4<0>;\n", cptr, result);
-		  free(result);
-
-		  snprintf(tmp, sizeof tmp, "L_%p", cptr);
-		  result = strdup(tmp);
+		    /* An undelayed constant driver. Identical
+		       constants share a single functor. */
+		  result = draw_const_functor(result, cptr);
 	    }
 
 	    return result;
@@ -625,6 +689,18 @@ static unsigned adrivers = 0;
 
 void EOC_cleanup_drivers()
 {
+      unsigned idx;
+
+      for (idx = 0 ;  idx < 256 ;  idx += 1) {
+	    while (shared_functor_table[idx]) {
+		  struct shared_functor_cell*cur = shared_functor_table[idx];
+		  shared_functor_table[idx] = cur->next;
+		  free(cur->defn);
+		  free(cur->label);
+		  free(cur);
+	    }
+      }
+
       free(drivers);
       drivers = NULL;
       adrivers = 0;
@@ -761,13 +837,16 @@ static void draw_net_input_x(ivl_nexus_t nex,
 
 		    /* Create an "open" driver to hold the HiZ. We
 		       need to do this so that .nets have something to
-		       hang onto. */
+		       hang onto. Undriven nets of the same width and
+		       type all share one driver. */
 		  char buf[64];
+		  char*defn = malloc(strlen(nex_private) + 64);
 		  snprintf(buf, sizeof buf, "o%p", nex);
-		  fprintf(vvp_out, "%s .functor BUFZ %u, %s; HiZ drive\n",
-			  buf, wid, nex_private);
-		  nex_private = realloc(nex_private, strlen(buf)+1);
-		  strcpy(nex_private, buf);
+		  sprintf(defn, ".functor BUFZ %u, %s; HiZ drive",
+			  wid, nex_private);
+		  free(nex_private);
+		  nex_private = draw_shared_functor(defn, buf);
+		  free(defn);
 	    }
 
 	    if (island) {
@@ -820,23 +899,42 @@ static void draw_net_input_x(ivl_nexus_t nex,
       }
 
       driver_labels = malloc(ndrivers * sizeof(char*));
-      for (idx = 0; idx < ndrivers; idx += 1) {
-            driver_labels[idx] = draw_net_input_drive(nex, drivers[idx]);
-      }
-      fprintf(vvp_out, "RS_%p .resolv %s", nex, resolv_type);
-      for (idx = 0; idx < ndrivers; idx += 1) {
-            fprintf(vvp_out, ", %s", driver_labels[idx]);
-	    free(driver_labels[idx]);
-      }
-      fprintf(vvp_out, ";\n");
-      free(driver_labels);
+      {
+	    size_t defn_len = strlen(resolv_type) + 16;
+	    char*defn;
+	    char*dp;
+	    char*resolv_label;
+
+	    for (idx = 0; idx < ndrivers; idx += 1) {
+		  driver_labels[idx] = draw_net_input_drive(nex, drivers[idx]);
+		  defn_len += strlen(driver_labels[idx]) + 2;
+	    }
 
-      snprintf(result, sizeof result, "RS_%p", nex);
+	      /* A resolver is a pure function of its input labels, so
+		 nexa that resolve the same set of drivers can share a
+		 single resolver functor. Render the definition to a
+		 string and run it through the shared functor table. */
+	    defn = malloc(defn_len);
+	    dp = defn;
+	    dp += sprintf(dp, ".resolv %s", resolv_type);
+	    for (idx = 0; idx < ndrivers; idx += 1) {
+		  dp += sprintf(dp, ", %s", driver_labels[idx]);
+		  free(driver_labels[idx]);
+	    }
+	    strcpy(dp, ";");
+	    free(driver_labels);
 
-      if (island)
-	    nex_private = draw_island_port(island, island_input_flag, nex, nex_data, result);
-      else
-	    nex_private = strdup(result);
+	    snprintf(result, sizeof result, "RS_%p", nex);
+	    resolv_label = draw_shared_functor(defn, result);
+	    free(defn);
+
+	    if (island) {
+		  nex_private = draw_island_port(island, island_input_flag, nex, nex_data, resolv_label);
+		  free(resolv_label);
+	    } else {
+		  nex_private = resolv_label;
+	    }
+      }
 
       assert(nex_data->net_input == 0);
       nex_data->net_input = nex_private;
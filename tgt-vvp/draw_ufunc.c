@@ -79,6 +79,143 @@ static void draw_function_argument(ivl_signal_t port, ivl_expr_t expr)
       }
 }
 
+/*
+ * Inline expansion of small functions. A function body that is just a
+ * handful of assignments and branches, all writing function-local
+ * signals, behaves the same whether it runs in a forked function
+ * thread or directly in the caller, so for those we emit the body
+ * into the caller's opcode stream and skip the %fork/%join thread
+ * round trip. Anything with side effects outside the function scope
+ * (non-local assignments, system or user task calls), an automatic
+ * function, or a body larger than the threshold falls back to the
+ * normal call sequence.
+ */
+
+#define UFUNC_INLINE_MAX_STMTS 8
+#define UFUNC_INLINE_HOT_MAX_STMTS 32
+#define UFUNC_INLINE_MAX_DEPTH 8
+
+	/* The statement budget for the function being considered
+	   right now. This is the plain limit by default; with an
+	   execution profile loaded, hot functions get the larger
+	   budget and cold ones are not expanded at all. */
+static unsigned inline_max_stmts = UFUNC_INLINE_MAX_STMTS;
+
+	/* Functions whose bodies are being expanded right now. A
+	   function that (possibly indirectly) calls itself cannot be
+	   expanded into its own body, so calls to these fall back to
+	   the thread call sequence. */
+static ivl_scope_t inline_active[UFUNC_INLINE_MAX_DEPTH];
+static unsigned inline_depth = 0;
+
+static int inline_ok_statement(ivl_statement_t net, ivl_scope_t def,
+			       unsigned*count)
+{
+      unsigned idx;
+
+      if (net == 0) return 1;
+
+      switch (ivl_statement_type(net)) {
+
+	  case IVL_ST_NOOP:
+	    return 1;
+
+	  case IVL_ST_BLOCK:
+	      /* Named blocks bring their own scope, skip those. */
+	    if (ivl_stmt_block_scope(net)) return 0;
+	    for (idx = 0 ; idx < ivl_stmt_block_count(net) ; idx += 1) {
+		  if (! inline_ok_statement(ivl_stmt_block_stmt(net, idx),
+					    def, count))
+			return 0;
+	    }
+	    return 1;
+
+	  case IVL_ST_ASSIGN:
+	    *count += 1;
+	    if (*count > inline_max_stmts) return 0;
+	    if (ivl_stmt_delay_expr(net)) return 0;
+	      /* Only assignments to function-local signals are free
+		 of side effects. */
+	    for (idx = 0 ; idx < ivl_stmt_lvals(net) ; idx += 1) {
+		  ivl_signal_t sig = ivl_lval_sig(ivl_stmt_lval(net, idx));
+		  if (sig == 0) return 0;
+		  if (ivl_signal_scope(sig) != def) return 0;
+	    }
+	    return 1;
+
+	  case IVL_ST_CONDIT:
+	    *count += 1;
+	    if (*count > inline_max_stmts) return 0;
+	    if (! inline_ok_statement(ivl_stmt_cond_true(net), def, count))
+		  return 0;
+	    if (! inline_ok_statement(ivl_stmt_cond_false(net), def, count))
+		  return 0;
+	    return 1;
+
+	  case IVL_ST_CASE:
+	  case IVL_ST_CASEX:
+	  case IVL_ST_CASEZ:
+	  case IVL_ST_CASER:
+	    *count += 1;
+	    if (*count > inline_max_stmts) return 0;
+	    for (idx = 0 ; idx < ivl_stmt_case_count(net) ; idx += 1) {
+		  if (! inline_ok_statement(ivl_stmt_case_stmt(net, idx),
+					    def, count))
+			return 0;
+	    }
+	    return 1;
+
+	  default:
+	    return 0;
+      }
+}
+
+/*
+ * Emit the call to the function, after the arguments are already in
+ * place. If the body qualifies, expand it inline, otherwise fork the
+ * function thread and wait for it.
+ */
+static void draw_ufunc_call(ivl_scope_t def)
+{
+      unsigned count = 0;
+      unsigned idx;
+
+      int try_inline = ! ivl_scope_is_auto(def)
+	  && inline_depth < UFUNC_INLINE_MAX_DEPTH;
+
+	/* With an execution profile from a previous run, spend the
+	   inline expansion on the functions that actually ran hot,
+	   and keep the cold ones as compact thread calls. */
+      inline_max_stmts = UFUNC_INLINE_MAX_STMTS;
+      if (try_inline && vvp_profile_present()) {
+	    if (vvp_profile_scope_hot(def))
+		  inline_max_stmts = UFUNC_INLINE_HOT_MAX_STMTS;
+	    else if (vvp_profile_scope_count(def) == 0)
+		  try_inline = 0;
+      }
+
+      if (try_inline
+	  && inline_ok_statement(ivl_scope_def(def), def, &count)) {
+
+	    int active = 0;
+	    for (idx = 0 ; idx < inline_depth ; idx += 1) {
+		  if (inline_active[idx] == def) active = 1;
+	    }
+
+	    if (! active) {
+		  inline_active[inline_depth] = def;
+		  inline_depth += 1;
+		  show_statement(ivl_scope_def(def), def);
+		  inline_depth -= 1;
+		  return;
+	    }
+      }
+
+      fprintf(vvp_out, "    %%fork TD_%p", def);
+      fprintf(vvp_out, ", S_%p;\n", def);
+      fprintf(vvp_out, "    %%join;\n");
+}
+
 /*
  * A call to a user defined function generates a result that is the
  * result of this expression.
@@ -115,11 +252,9 @@ struct vector_info draw_ufunc_expr(ivl_expr_t expr, unsigned wid)
 
 
 	/* Call the function */
-      fprintf(vvp_out, "    %%fork TD_%s", vvp_mangle_id(ivl_scope_name(def)));
-      fprintf(vvp_out, ", S_%p;\n", def);
-      fprintf(vvp_out, "    %%join;\n");
+      draw_ufunc_call(def);
 
-	/* Fresh basic block starts after the join. */
+	/* Fresh basic block starts after the call. */
       clear_expression_lookaside();
 
 	/* The return value is in a signal that has the name of the
@@ -177,9 +312,7 @@ void draw_ufunc_real(ivl_expr_t expr)
 
 
 	/* Call the function */
-      fprintf(vvp_out, "    %%fork TD_%s", vvp_mangle_id(ivl_scope_name(def)));
-      fprintf(vvp_out, ", S_%p;\n", def);
-      fprintf(vvp_out, "    %%join;\n");
+      draw_ufunc_call(def);
 
 	/* Return value signal cannot be an array. */
       assert(ivl_signal_dimensions(retval) == 0);
@@ -396,19 +396,25 @@ static struct vector_info draw_eq_immediate(ivl_expr_t expr, unsigned ewid,
 		  fprintf(vvp_out, "    %%pad %u, 0, %u;\n", base+1, ewid-1);
 
       } else if (lv.wid < ewid) {
-	    unsigned base = allocate_vector(ewid);
+	      /* Prefer widening the result in place, which needs only
+		 the %pad. Fall back to a fresh vector and a %mov. */
+	    unsigned base = allocate_vector_extend(lv.base, lv.wid, ewid);
 	    if (base == 0) {
-		  fprintf(stderr, "%s:%u: vvp.tgt error: "
-			  "Unable to allocate %u thread bits "
-			  "for result of equality compare.\n",
-			  ivl_expr_file(expr), ivl_expr_lineno(expr), wid);
-		  vvp_errors += 1;
-	    }
+		  base = allocate_vector(ewid);
+		  if (base == 0) {
+			fprintf(stderr, "%s:%u: vvp.tgt error: "
+				"Unable to allocate %u thread bits "
+				"for result of equality compare.\n",
+				ivl_expr_file(expr), ivl_expr_lineno(expr),
+				wid);
+			vvp_errors += 1;
+		  }
 
-	    if (lv.base >= 8)
-		  clr_vector(lv);
-	    fprintf(vvp_out, "    %%mov %u, %u, %u;\n", base,
-		    lv.base, lv.wid);
+		  if (lv.base >= 8)
+			clr_vector(lv);
+		  fprintf(vvp_out, "    %%mov %u, %u, %u;\n", base,
+			  lv.base, lv.wid);
+	    }
 	    fprintf(vvp_out, "    %%pad %u, 0, %u;\n",
 		    base+lv.wid, ewid-lv.wid);
 	    lv.base = base;
@@ -741,18 +747,22 @@ static struct vector_info draw_binary_expr_land(ivl_expr_t expr, unsigned wid)
       if (wid == 1)
 	    return lv;
 
-	/* Write the result into a zero-padded result. */
-      { unsigned base = allocate_vector(wid);
+	/* Write the result into a zero-padded result. Widening the
+	   single bit in place saves the copy. */
+      { unsigned base = allocate_vector_extend(lv.base, 1, wid);
 	if (base == 0) {
-	      fprintf(stderr, "%s:%u: vvp.tgt error: "
-		      "Unable to allocate %u thread bits "
-		      "for result of padded logical AND.\n",
-		      ivl_expr_file(expr), ivl_expr_lineno(expr), wid);
-	      vvp_errors += 1;
-	}
+	      base = allocate_vector(wid);
+	      if (base == 0) {
+		    fprintf(stderr, "%s:%u: vvp.tgt error: "
+			    "Unable to allocate %u thread bits "
+			    "for result of padded logical AND.\n",
+			    ivl_expr_file(expr), ivl_expr_lineno(expr), wid);
+		    vvp_errors += 1;
+	      }
 
-        fprintf(vvp_out, "    %%mov %u, %u, 1;\n", base, lv.base);
-	clr_vector(lv);
+	      fprintf(vvp_out, "    %%mov %u, %u, 1;\n", base, lv.base);
+	      clr_vector(lv);
+	}
 	lv.base = base;
 	lv.wid = wid;
 	fprintf(vvp_out, "    %%pad %u, 0, %u;\n", base+1, wid-1);
@@ -852,18 +862,22 @@ static struct vector_info draw_binary_expr_lor(ivl_expr_t expr, unsigned wid,
 	    return lv;
       }
 
-	/* Write the result into a zero-padded result. */
-      { unsigned base = allocate_vector(wid);
+	/* Write the result into a zero-padded result. Widening the
+	   single bit in place saves the copy. */
+      { unsigned base = allocate_vector_extend(lv.base, 1, wid);
 	if (base == 0) {
-	      fprintf(stderr, "%s:%u: vvp.tgt error: "
-		      "Unable to allocate %u thread bits "
-		      "for result of padded logical OR.\n",
-		      ivl_expr_file(expr), ivl_expr_lineno(expr), wid);
-	      vvp_errors += 1;
-	}
+	      base = allocate_vector(wid);
+	      if (base == 0) {
+		    fprintf(stderr, "%s:%u: vvp.tgt error: "
+			    "Unable to allocate %u thread bits "
+			    "for result of padded logical OR.\n",
+			    ivl_expr_file(expr), ivl_expr_lineno(expr), wid);
+		    vvp_errors += 1;
+	      }
 
-        fprintf(vvp_out, "    %%mov %u, %u, 1;\n", base, lv.base);
-	if (lv.base >= 8) clr_vector(lv);
+	      fprintf(vvp_out, "    %%mov %u, %u, 1;\n", base, lv.base);
+	      if (lv.base >= 8) clr_vector(lv);
+	}
 	lv.base = base;
 	lv.wid = wid;
 	fprintf(vvp_out, "    %%pad %u, 0, %u;\n", base+1, wid-1);
@@ -2853,6 +2867,124 @@ static void draw_select_string_dest(ivl_expr_t expr, struct vector_info res)
       fprintf(vvp_out, "    %%pop/str 1;\n");
 }
 
+/*
+ * Try to narrow the operand of a constant part select
+ * structurally. The select of a concatenation lands in a single
+ * operand, a select of a select merges into one offset, and a select
+ * of a constant shift folds the shift distance into the offset, so
+ * slicing {a,b}[15:8] evaluates only the covered operand instead of
+ * building the concatenation and shifting it at run time. Each fold
+ * only fires when the select range stays inside the subexpression it
+ * moves to, so the x-fill of out-of-range bits is never in play. The
+ * narrowed operand is returned with *base_p adjusted, or 0 if no
+ * fold applies.
+ */
+static ivl_expr_t narrow_select_operand(ivl_expr_t sube, unsigned long*base_p,
+					unsigned wid)
+{
+      unsigned long base = *base_p;
+      int changed = 0;
+
+      for (;;) {
+	    if (ivl_expr_type(sube) == IVL_EX_CONCAT) {
+		  unsigned num_sube = ivl_expr_parms(sube);
+		  unsigned rep = ivl_expr_repeat(sube);
+		  unsigned expr_wid = 0;
+		  unsigned off, idx;
+		  ivl_expr_t arg = 0;
+
+		  for (idx = 0 ; idx < num_sube ; idx += 1)
+			expr_wid += ivl_expr_width(ivl_expr_parm(sube, idx));
+
+		    /* The range must fall inside one repetition... */
+		  if (rep == 0 || base + wid > (unsigned long)rep*expr_wid)
+			break;
+		  if (base%expr_wid + wid > expr_wid)
+			break;
+		  base %= expr_wid;
+
+		    /* ...and inside one operand. The last parm is the
+		       least significant. */
+		  off = 0;
+		  for (idx = num_sube ; idx > 0 ; idx -= 1) {
+			arg = ivl_expr_parm(sube, idx-1);
+			if (base >= off
+			    && base + wid <= off + ivl_expr_width(arg))
+			      break;
+			off += ivl_expr_width(arg);
+			arg = 0;
+		  }
+		  if (arg == 0)
+			break;
+
+		  sube = arg;
+		  base -= off;
+		  changed = 1;
+		  continue;
+	    }
+
+	    if (ivl_expr_type(sube) == IVL_EX_SELECT) {
+		  ivl_expr_t inner = ivl_expr_oper1(sube);
+		  ivl_expr_t inner_base = ivl_expr_oper2(sube);
+
+		  if (! number_is_immediate(inner_base, IMM_WID, 0))
+			break;
+		  if (base + wid > ivl_expr_width(sube))
+			break;
+		  base += get_number_immediate(inner_base);
+		  if (base + wid > ivl_expr_width(inner))
+			break;
+
+		  sube = inner;
+		  changed = 1;
+		  continue;
+	    }
+
+	    if (ivl_expr_type(sube) == IVL_EX_BINARY
+		&& (ivl_expr_opcode(sube) == 'l'
+		    || ivl_expr_opcode(sube) == 'r')) {
+		  ivl_expr_t inner = ivl_expr_oper1(sube);
+		  ivl_expr_t dist = ivl_expr_oper2(sube);
+		  unsigned long amount;
+
+		  if (! number_is_immediate(dist, IMM_WID, 0))
+			break;
+		  if (ivl_expr_width(inner) != ivl_expr_width(sube))
+			break;
+		  amount = get_number_immediate(dist);
+
+		  if (ivl_expr_opcode(sube) == 'l') {
+			  /* Low bits of a left shift are zeros, and
+			     bits from the operand must stay in its
+			     range. */
+			if (base < amount)
+			      break;
+			if (base + wid > ivl_expr_width(sube))
+			      break;
+			base -= amount;
+		  } else {
+			  /* Logical right shift: stay below the
+			     zero-fill at the top. */
+			if (base + wid + amount > ivl_expr_width(inner))
+			      break;
+			base += amount;
+		  }
+
+		  sube = inner;
+		  changed = 1;
+		  continue;
+	    }
+
+	    break;
+      }
+
+      if (! changed)
+	    return 0;
+
+      *base_p = base;
+      return sube;
+}
+
 static struct vector_info draw_select_expr(ivl_expr_t expr, unsigned wid,
 					   int stuff_ok_flag)
 {
@@ -2911,6 +3043,47 @@ static struct vector_info draw_select_expr(ivl_expr_t expr, unsigned wid,
 	    return res;
       }
 
+	/* A constant select over concat/select/shift structure
+	   narrows to a register slice of a smaller subexpression,
+	   skipping the concat assembly and the run-time shift. */
+      if (number_is_immediate(shift, IMM_WID, 0)) {
+	    unsigned long sel_base = get_number_immediate(shift);
+	    ivl_expr_t narrow = narrow_select_operand(sube, &sel_base, wid);
+	    if (narrow != 0) {
+		  fprintf(vvp_out, "; Select narrowed to bits [%lu +: %u] "
+			  "of the subexpression.\n", sel_base, wid);
+		  subv = draw_eval_expr(narrow, 0);
+		  assert(subv.wid >= sel_base + wid);
+
+		  if (subv.base < 4) {
+			  /* Any slice of a magic constant is itself. */
+			res.base = subv.base;
+			return res;
+		  }
+
+		  res.base = subv.base + sel_base;
+		  if (sel_base > 0) {
+			struct vector_info tmp;
+			tmp.base = subv.base;
+			tmp.wid = sel_base;
+			clr_vector(tmp);
+		  }
+		  if (subv.wid > sel_base + wid) {
+			struct vector_info tmp;
+			tmp.base = subv.base + sel_base + wid;
+			tmp.wid = subv.wid - sel_base - wid;
+			clr_vector(tmp);
+		  }
+
+		  if (res.base >= 8) {
+			fprintf(vvp_out, "; Save expression base=%u wid=%u "
+				"in lookaside\n", res.base, wid);
+			save_expression_lookaside(res.base, expr, wid);
+		  }
+		  return res;
+	    }
+      }
+
       subv = draw_eval_expr(sube, 0);
 
 	/* Evaluate the bit select base expression. */
@@ -3610,9 +3783,12 @@ static void draw_eval_expr_dest(ivl_expr_t expr, struct vector_info dest,
       tmp = draw_eval_expr_wid(expr, dest.wid, stuff_ok_flag);
       assert(tmp.wid == dest.wid);
 
-	/* If the replication is 0 we can have a zero width, so skip it. */
-      if (dest.wid) fprintf(vvp_out, "    %%mov %u, %u, %u;\n",
-                                     dest.base, tmp.base, dest.wid);
+	/* If the replication is 0 we can have a zero width, so skip
+	   it. The move is also redundant if the lookaside caused the
+	   expression to be evaluated in place. */
+      if (dest.wid && (tmp.base != dest.base))
+	    fprintf(vvp_out, "    %%mov %u, %u, %u;\n",
+		    dest.base, tmp.base, dest.wid);
 
       if (tmp.base >= 8)
 	    save_expression_lookaside(tmp.base, expr, tmp.wid);
@@ -52,6 +52,32 @@ void clr_word(int res)
       word_alloc_mask &= ~ (1U << res);
 }
 
+/*
+ * If one operand of the add is a real multiply, return it and pass
+ * the other operand back through <other>, so the add can be fused
+ * into a %muladd/wr.
+ */
+static ivl_expr_t real_mul_operand(ivl_expr_t expr, ivl_expr_t*other)
+{
+      ivl_expr_t oper = ivl_expr_oper2(expr);
+      if (ivl_expr_type(oper) == IVL_EX_BINARY
+	  && ivl_expr_opcode(oper) == '*'
+	  && ivl_expr_value(oper) == IVL_VT_REAL) {
+	    *other = ivl_expr_oper1(expr);
+	    return oper;
+      }
+
+      oper = ivl_expr_oper1(expr);
+      if (ivl_expr_type(oper) == IVL_EX_BINARY
+	  && ivl_expr_opcode(oper) == '*'
+	  && ivl_expr_value(oper) == IVL_VT_REAL) {
+	    *other = ivl_expr_oper2(expr);
+	    return oper;
+      }
+
+      return 0;
+}
+
 static void draw_binary_real(ivl_expr_t expr)
 {
       switch (ivl_expr_opcode(expr)) {
@@ -70,6 +96,22 @@ static void draw_binary_real(ivl_expr_t expr)
 	    assert(0);
       }
 
+	/* A real add with a multiply operand fuses to a single
+	   %muladd/wr. A sum of products recurses through the addend,
+	   so the whole chain evaluates with one fused opcode per
+	   product. */
+      if (ivl_expr_opcode(expr) == '+') {
+	    ivl_expr_t addend = 0;
+	    ivl_expr_t mul = real_mul_operand(expr, &addend);
+	    if (mul) {
+		  draw_eval_real(addend);
+		  draw_eval_real(ivl_expr_oper1(mul));
+		  draw_eval_real(ivl_expr_oper2(mul));
+		  fprintf(vvp_out, "    %%muladd/wr;\n");
+		  return;
+	    }
+      }
+
       draw_eval_real(ivl_expr_oper1(expr));
       draw_eval_real(ivl_expr_oper2(expr));
 
@@ -0,0 +1,256 @@
+/*
+ * Copyright (c) 2013 Stephen Williams (steve@icarus.com)
+ *
+ *    This source code is free software; you can redistribute it
+ *    and/or modify it in source code form under the terms of the GNU
+ *    General Public License as published by the Free Software
+ *    Foundation; either version 2 of the License, or (at your option)
+ *    any later version.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this program; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+# include  "vvp_priv.h"
+# include  <string.h>
+# include  <stdlib.h>
+# include  <stdio.h>
+# include  <assert.h>
+
+/*
+ * Boundary-signal manifest for hand-partitioned simulation.
+ *
+ * A partition spec file (given with -ppart=<path>) assigns design
+ * scopes to named partitions, one assignment per line:
+ *
+ *      <partition-name> <scope full name>
+ *
+ * The named scope and everything below it belong to the partition,
+ * unless a deeper assignment overrides; scopes that no assignment
+ * covers belong to the implicit partition "-". After the design is
+ * drawn, every nexus that connects devices or signals from more than
+ * one partition is written to the manifest (<output>.bsm), one line
+ * per boundary nexus:
+ *
+ *      <signal full name> <width> <partition>[:D] ...
+ *
+ * The :D tag marks partitions that structurally drive the nexus (a
+ * logic gate output, an LPM output, or a driven signal pointer).
+ * Behavioral drivers cannot be attributed to a nexus pointer here,
+ * so a partition whose threads assign the signal is not tagged; the
+ * manifest is a connectivity report for whoever does the sharding,
+ * not a proof of direction.
+ */
+
+struct part_rule_s {
+      char*name;
+      char*scope;
+      size_t scope_len;
+};
+
+static struct part_rule_s*part_rules = 0;
+static unsigned part_rules_cnt = 0;
+
+static FILE*manifest_out = 0;
+static unsigned long boundary_count = 0;
+
+int vvp_partition_active(void)
+{
+      return part_rules_cnt != 0;
+}
+
+int vvp_partition_load(const char*spec_path, const char*out_path)
+{
+      FILE*fd = fopen(spec_path, "r");
+      char name_buf[256], scope_buf[4096];
+      char*manifest_path;
+      unsigned cap = 0;
+
+      if (fd == 0) {
+	    perror(spec_path);
+	    return -1;
+      }
+
+      while (fscanf(fd, "%255s %4095s", name_buf, scope_buf) == 2) {
+	    if (part_rules_cnt == cap) {
+		  cap = cap ? 2*cap : 16;
+		  part_rules = (struct part_rule_s*)
+			realloc(part_rules, cap*sizeof(*part_rules));
+		  assert(part_rules);
+	    }
+	    part_rules[part_rules_cnt].name = strdup(name_buf);
+	    part_rules[part_rules_cnt].scope = strdup(scope_buf);
+	    part_rules[part_rules_cnt].scope_len = strlen(scope_buf);
+	    part_rules_cnt += 1;
+      }
+      fclose(fd);
+
+      if (part_rules_cnt == 0) {
+	    fprintf(stderr, "vvp error: no partition assignments in %s\n",
+		    spec_path);
+	    return -1;
+      }
+
+      manifest_path = (char*) malloc(strlen(out_path) + 5);
+      assert(manifest_path);
+      strcpy(manifest_path, out_path);
+      strcat(manifest_path, ".bsm");
+
+      manifest_out = fopen(manifest_path, "w");
+      if (manifest_out == 0) {
+	    perror(manifest_path);
+	    free(manifest_path);
+	    return -1;
+      }
+
+      fprintf(manifest_out, "# Boundary-signal manifest for %s\n", out_path);
+      fprintf(manifest_out, "# <signal full name> <width> <partition>[:D] ...\n");
+      fprintf(manifest_out, "# :D marks a partition with a structural driver"
+	      " on the nexus.\n");
+      free(manifest_path);
+      return 0;
+}
+
+/*
+ * Find the partition of a scope: the matching rule with the longest
+ * scope prefix wins, and a prefix only matches on a '.' boundary.
+ */
+static const char* partition_of_scope(ivl_scope_t scope)
+{
+      const char*path = ivl_scope_name(scope);
+      const char*best = "-";
+      size_t best_len = 0;
+      unsigned idx;
+
+      for (idx = 0 ; idx < part_rules_cnt ; idx += 1) {
+	    struct part_rule_s*cur = part_rules + idx;
+	    if (strncmp(cur->scope, path, cur->scope_len) != 0)
+		  continue;
+	    if (path[cur->scope_len] != 0 && path[cur->scope_len] != '.')
+		  continue;
+	    if (cur->scope_len < best_len)
+		  continue;
+	    best = cur->name;
+	    best_len = cur->scope_len;
+      }
+
+      return best;
+}
+
+/*
+ * Each nexus is reported once, from its first signal pointer, so the
+ * scope walk below can test cheaply whether the signal at hand is
+ * the reporting representative.
+ */
+static ivl_signal_t nexus_rep_signal(ivl_nexus_t nex)
+{
+      unsigned idx;
+      for (idx = 0 ; idx < ivl_nexus_ptrs(nex) ; idx += 1) {
+	    ivl_signal_t sig = ivl_nexus_ptr_sig(ivl_nexus_ptr(nex, idx));
+	    if (sig) return sig;
+      }
+      return 0;
+}
+
+/* Attached partitions per nexus. More than this only loses :D detail. */
+#define PART_NEX_MAX 64
+
+static void scan_nexus(ivl_nexus_t nex, ivl_signal_t rep)
+{
+      const char*parts[PART_NEX_MAX];
+      int drives[PART_NEX_MAX];
+      unsigned nparts = 0;
+      unsigned idx, pdx;
+
+      for (idx = 0 ; idx < ivl_nexus_ptrs(nex) ; idx += 1) {
+	    ivl_nexus_ptr_t ptr = ivl_nexus_ptr(nex, idx);
+	    ivl_scope_t scope = 0;
+	    const char*part;
+	    int drive = 0;
+
+	    ivl_signal_t sig = ivl_nexus_ptr_sig(ptr);
+	    ivl_net_logic_t log = ivl_nexus_ptr_log(ptr);
+	    ivl_lpm_t lpm = ivl_nexus_ptr_lpm(ptr);
+
+	    if (sig) {
+		  scope = ivl_signal_scope(sig);
+		  drive = ivl_nexus_ptr_drive0(ptr) != IVL_DR_HiZ
+		       || ivl_nexus_ptr_drive1(ptr) != IVL_DR_HiZ;
+	    } else if (log) {
+		  scope = ivl_logic_scope(log);
+		  drive = ivl_logic_pin(log, 0) == nex;
+	    } else if (lpm) {
+		  scope = ivl_lpm_scope(lpm);
+		  drive = ivl_lpm_q(lpm) == nex;
+	    }
+	    if (scope == 0)
+		  continue;
+
+	    part = partition_of_scope(scope);
+	    for (pdx = 0 ; pdx < nparts ; pdx += 1) {
+		  if (strcmp(parts[pdx], part) == 0)
+			break;
+	    }
+	    if (pdx < nparts) {
+		  drives[pdx] |= drive;
+	    } else if (nparts < PART_NEX_MAX) {
+		  parts[nparts] = part;
+		  drives[nparts] = drive;
+		  nparts += 1;
+	    }
+      }
+
+      if (nparts < 2)
+	    return;
+
+      fprintf(manifest_out, "%s.%s %u",
+	      ivl_scope_name(ivl_signal_scope(rep)),
+	      ivl_signal_basename(rep), ivl_signal_width(rep));
+      for (pdx = 0 ; pdx < nparts ; pdx += 1)
+	    fprintf(manifest_out, " %s%s", parts[pdx],
+		    drives[pdx] ? ":D" : "");
+      fprintf(manifest_out, "\n");
+      boundary_count += 1;
+}
+
+static int scan_scope(ivl_scope_t scope, void*cd)
+{
+      unsigned idx, wdx;
+      (void)cd;
+
+      for (idx = 0 ; idx < ivl_scope_sigs(scope) ; idx += 1) {
+	    ivl_signal_t sig = ivl_scope_sig(scope, idx);
+	    for (wdx = 0 ; wdx < ivl_signal_array_count(sig) ; wdx += 1) {
+		  ivl_nexus_t nex = ivl_signal_nex(sig, wdx);
+		  if (nex == 0)
+			continue;
+		  if (nexus_rep_signal(nex) != sig)
+			continue;
+		  scan_nexus(nex, sig);
+	    }
+      }
+
+      ivl_scope_children(scope, scan_scope, 0);
+      return 0;
+}
+
+int vvp_partition_emit_manifest(ivl_design_t des)
+{
+      ivl_scope_t*roots;
+      unsigned nroots, idx;
+
+      ivl_design_roots(des, &roots, &nroots);
+      for (idx = 0 ; idx < nroots ; idx += 1)
+	    scan_scope(roots[idx], 0);
+
+      fprintf(manifest_out, "# %lu boundary nexuses\n", boundary_count);
+      fclose(manifest_out);
+      manifest_out = 0;
+      return 0;
+}
@@ -914,6 +914,153 @@ static int show_stmt_assign_sig_cobject(ivl_statement_t net)
       return errors;
 }
 
+/*
+ * Machine generated initialization code often assigns every word of
+ * an array one statement at a time. Executing one %set/av per word
+ * is slow for big memories, so the block code generator calls
+ * show_stmt_assign_fill_run to detect a run of such statements and
+ * collapse it into a single %arr/fill instruction.
+ *
+ * A statement can join a run if it is a plain blocking assignment of
+ * a constant number to a whole, constant addressed word of an
+ * array. Consecutive statements continue a run if they write the
+ * same value to the next word of the same array.
+ */
+static int match_array_fill_stmt(ivl_statement_t net, ivl_signal_t*sig_out,
+				 unsigned long*word_out, ivl_expr_t*rval_out)
+{
+      ivl_lval_t lval;
+      ivl_signal_t sig;
+      ivl_expr_t rval, word_ix;
+
+      if (ivl_statement_type(net) != IVL_ST_ASSIGN)
+	    return 0;
+      if (ivl_stmt_lvals(net) != 1)
+	    return 0;
+      if (ivl_stmt_opcode(net) != 0)
+	    return 0;
+      if (ivl_stmt_delay_expr(net) != 0)
+	    return 0;
+
+      lval = ivl_stmt_lval(net, 0);
+      sig = ivl_lval_sig(lval);
+      if (sig == 0)
+	    return 0;
+      if (ivl_signal_dimensions(sig) == 0)
+	    return 0;
+
+	/* Only vector arrays. Real, string and object arrays take
+	   different assignment paths. */
+      switch (ivl_signal_data_type(sig)) {
+	  case IVL_VT_BOOL:
+	  case IVL_VT_LOGIC:
+	    break;
+	  default:
+	    return 0;
+      }
+
+	/* The whole word must be written. */
+      if (ivl_lval_part_off(lval) != 0)
+	    return 0;
+      if (ivl_lval_mux(lval))
+	    return 0;
+      if (ivl_lval_width(lval) != ivl_signal_width(sig))
+	    return 0;
+
+	/* The word address must be constant and in bounds. */
+      word_ix = ivl_lval_idx(lval);
+      if (word_ix == 0)
+	    return 0;
+      if (! number_is_immediate(word_ix, IMM_WID, 0))
+	    return 0;
+      if (number_is_unknown(word_ix))
+	    return 0;
+      if ((unsigned long)get_number_immediate(word_ix)
+	  >= ivl_signal_array_count(sig))
+	    return 0;
+
+	/* The r-value must be a literal number. */
+      rval = ivl_stmt_rval(net);
+      if (ivl_expr_type(rval) != IVL_EX_NUMBER)
+	    return 0;
+      if (ivl_expr_width(rval) != ivl_lval_width(lval))
+	    return 0;
+
+      *sig_out = sig;
+      *word_out = get_number_immediate(word_ix);
+      *rval_out = rval;
+      return 1;
+}
+
+static int match_same_number(ivl_expr_t l, ivl_expr_t r)
+{
+      unsigned idx;
+      const char*bitl = ivl_expr_bits(l);
+      const char*bitr = ivl_expr_bits(r);
+
+      if (ivl_expr_width(l) != ivl_expr_width(r))
+	    return 0;
+
+      for (idx = 0 ;  idx < ivl_expr_width(l) ;  idx += 1) {
+	    if (bitl[idx] != bitr[idx])
+		  return 0;
+      }
+
+      return 1;
+}
+
+unsigned show_stmt_assign_fill_run(ivl_statement_t block, unsigned idx)
+{
+      unsigned cnt = ivl_stmt_block_count(block);
+      ivl_statement_t first = ivl_stmt_block_stmt(block, idx);
+      ivl_signal_t sig;
+      unsigned long use_word;
+      ivl_expr_t rval;
+      unsigned run;
+      struct vector_info res;
+
+      if (! match_array_fill_stmt(first, &sig, &use_word, &rval))
+	    return 0;
+
+      run = 1;
+      while ((idx+run) < cnt) {
+	    ivl_signal_t sig2;
+	    unsigned long word2;
+	    ivl_expr_t rval2;
+
+	    if (! match_array_fill_stmt(ivl_stmt_block_stmt(block, idx+run),
+					&sig2, &word2, &rval2))
+		  break;
+	    if (sig2 != sig)
+		  break;
+	    if (word2 != (use_word + run))
+		  break;
+	    if (! match_same_number(rval, rval2))
+		  break;
+
+	    run += 1;
+      }
+
+	/* A short run is not worth the value setup, leave it to the
+	   ordinary per-word stores. */
+      if (run < 4)
+	    return 0;
+
+      show_stmt_file_line(first, "Array initialization run.");
+
+      res = draw_eval_expr(rval, 0);
+      fprintf(vvp_out, "    %%ix/load 0, %u, 0;\n", run);
+      fprintf(vvp_out, "    %%ix/load 3, %lu, 0;\n", use_word);
+      fprintf(vvp_out, "    %%arr/fill v%p, %u, %u;\n",
+	      sig, res.base, res.wid);
+      clr_vector(res);
+
+	/* A width of 0 CLEARS the signal from the lookaside. */
+      save_signal_lookaside(res.base, sig, use_word, 0);
+
+      return run;
+}
+
 int show_stmt_assign(ivl_statement_t net)
 {
       ivl_lval_t lval;
@@ -135,6 +135,51 @@ unsigned allocate_vector(unsigned wid)
       return base;
 }
 
+/*
+ * Try to widen a vector in place by claiming the bits just above
+ * it. This saves the %mov that the caller would otherwise emit to
+ * copy the value into a fresh, wider allocation. The extension is
+ * only done if the existing bits are exclusively owned and carry no
+ * lookaside bindings, so that the widened vector is indistinguishable
+ * from a freshly allocated one and the caller remains free to
+ * overwrite it. If that doesn't hold, or any of the new bits are
+ * already allocated, give up and return 0 so that the caller can
+ * fall back to allocate_vector. Lookaside results cached in the
+ * claimed bits are sacrificed, exactly as the allocate_vector
+ * fallback would sacrifice them.
+ */
+unsigned allocate_vector_extend(unsigned base, unsigned wid, unsigned ewid)
+{
+      unsigned idx;
+
+      if (base < 8)
+	    return 0;
+      if (ewid <= wid)
+	    return base;
+      if ((base + ewid) > MAX_VEC)
+	    return 0;
+
+      for (idx = 0 ;  idx < wid ;  idx += 1) {
+	    if (allocation_map[base+idx].alloc != 1)
+		  return 0;
+	    if (allocation_map[base+idx].exp || allocation_map[base+idx].sig)
+		  return 0;
+      }
+
+      for (idx = wid ;  idx < ewid ;  idx += 1) {
+	    if (allocation_map[base+idx].alloc > 0)
+		  return 0;
+      }
+
+      for (idx = wid ;  idx < ewid ;  idx += 1) {
+	    allocation_map[base+idx].alloc += 1;
+	    set_exp(base+idx, 0, 0);
+	    set_sig(base+idx, 0, 0, 0);
+      }
+
+      return base;
+}
+
 /*
  * This clears the expression cache of the allocation map. It is
  * called to prevent reuse of existing expressions, normally at the
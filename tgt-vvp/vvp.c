@@ -48,6 +48,110 @@ FILE*vvp_out = 0;
 int vvp_errors = 0;
 unsigned show_file_line = 0;
 
+/* Size of the user-space output buffer handed to stdio for the
+   vvp_out stream. */
+# define OUT_BUFFER_SIZE (1024*1024)
+static char*out_buffer = 0;
+
+/*
+ * Optional execution profile from a previous run of the design. The
+ * vvp runtime writes it when VVP_PROFILE_BLOCKS is set to a path: one
+ * line per code block, "<address> <count> <scope full name>". The
+ * addresses mean nothing across compiles, so the counts are
+ * aggregated here by scope name, which is stable for as long as the
+ * design hierarchy is. Pass the file back in with -pprofile=<path>
+ * and emission choices (currently the function inlining budget in
+ * draw_ufunc.c) are biased by how hot each scope actually ran.
+ */
+struct profile_scope_s {
+      char*name;
+      unsigned long count;
+};
+static struct profile_scope_s*profile_table = 0;
+static unsigned profile_entries = 0;
+static unsigned long profile_total = 0;
+
+static int profile_compare(const void*l, const void*r)
+{
+      const struct profile_scope_s*lp = (const struct profile_scope_s*)l;
+      const struct profile_scope_s*rp = (const struct profile_scope_s*)r;
+      return strcmp(lp->name, rp->name);
+}
+
+static int vvp_profile_load(const char*path)
+{
+      FILE*fd = fopen(path, "r");
+      char name_buf[4096];
+      unsigned long count;
+      unsigned cap = 0;
+      unsigned idx, fill;
+
+      if (fd == 0) {
+	    perror(path);
+	    return -1;
+      }
+
+      while (fscanf(fd, "%*s %lu %4095s", &count, name_buf) == 2) {
+	    if (profile_entries == cap) {
+		  cap = cap ? 2*cap : 256;
+		  profile_table = (struct profile_scope_s*)
+			realloc(profile_table, cap*sizeof(*profile_table));
+		  assert(profile_table);
+	    }
+	    profile_table[profile_entries].name = strdup(name_buf);
+	    profile_table[profile_entries].count = count;
+	    profile_entries += 1;
+	    profile_total += count;
+      }
+      fclose(fd);
+
+      if (profile_entries == 0) return 0;
+
+	/* Sort the blocks by scope name and merge each scope's
+	   blocks into one aggregated entry. */
+      qsort(profile_table, profile_entries, sizeof(*profile_table),
+	    profile_compare);
+      fill = 0;
+      for (idx = 1 ; idx < profile_entries ; idx += 1) {
+	    if (strcmp(profile_table[fill].name,
+		       profile_table[idx].name) == 0) {
+		  profile_table[fill].count += profile_table[idx].count;
+		  free(profile_table[idx].name);
+	    } else {
+		  fill += 1;
+		  profile_table[fill] = profile_table[idx];
+	    }
+      }
+      profile_entries = fill + 1;
+      return 0;
+}
+
+int vvp_profile_present(void)
+{
+      return profile_entries != 0;
+}
+
+unsigned long vvp_profile_scope_count(ivl_scope_t scope)
+{
+      struct profile_scope_s key, *cell;
+
+      if (profile_entries == 0) return 0;
+
+      key.name = (char*) ivl_scope_name(scope);
+      cell = (struct profile_scope_s*)
+	    bsearch(&key, profile_table, profile_entries,
+		    sizeof(*profile_table), profile_compare);
+
+      return cell ? cell->count : 0;
+}
+
+int vvp_profile_scope_hot(ivl_scope_t scope)
+{
+	/* Call a scope hot if it accounts for at least roughly 0.1%
+	   of all the counted thread resumes. */
+      return vvp_profile_scope_count(scope) >= profile_total/1024 + 1;
+}
+
 __inline__ static void draw_execute_header(ivl_design_t des)
 {
       const char*cp = ivl_design_flag(des, "VVP_EXECUTABLE");
@@ -99,6 +203,14 @@ int target_design(ivl_design_t des)
 	 * printed for procedural statements. (e.g. -pfileline=1).
 	 * The default is no file/line information will be included. */
       const char*fileline = ivl_design_flag(des, "fileline");
+	/* Use -pprofile to name an execution profile written by a
+	 * previous vvp run (VVP_PROFILE_BLOCKS). Code emission is
+	 * then biased by the recorded per-scope execution counts. */
+      const char*profile = ivl_design_flag(des, "profile");
+	/* Use -ppart to name a partition spec file. A boundary-signal
+	 * manifest (<output>.bsm) is then written alongside the
+	 * generated code. See partition.c for the formats. */
+      const char*part = ivl_design_flag(des, "part");
 
       assert(path);
 
@@ -128,6 +240,18 @@ int target_design(ivl_design_t des)
             show_file_line = fl_value > 0;
       }
 
+        /* Load the execution profile, if one was given. */
+      if (strcmp(profile, "") != 0) {
+            if (vvp_profile_load(profile) != 0)
+                  return 1;
+      }
+
+        /* Load the partition spec, if one was given. */
+      if (strcmp(part, "") != 0) {
+            if (vvp_partition_load(part, path) != 0)
+                  return 1;
+      }
+
 #ifdef HAVE_FOPEN64
       vvp_out = fopen64(path, "w");
 #else
@@ -138,6 +262,15 @@ int target_design(ivl_design_t des)
 	    return -1;
       }
 
+	/* The code generator writes the design as a very large
+	   number of small formatted chunks. Give stdio a big output
+	   buffer so that the writes batch into few system calls
+	   instead of flushing every few kilobytes. If the allocation
+	   fails, stdio just keeps its default buffer. */
+      out_buffer = malloc(OUT_BUFFER_SIZE);
+      if (out_buffer)
+	    setvbuf(vvp_out, out_buffer, _IOFBF, OUT_BUFFER_SIZE);
+
       vvp_errors = 0;
 
       draw_execute_header(des);
@@ -164,6 +297,11 @@ int target_design(ivl_design_t des)
         /* Finish up any modpaths that are not yet emitted. */
       cleanup_modpath();
 
+        /* With the structure drawn, report the partition boundary
+           signals if a partition spec was loaded. */
+      if (vvp_partition_active())
+	    vvp_partition_emit_manifest(des);
+
       rc = ivl_design_process(des, draw_process, 0);
 
         /* Dump the file name table. */
@@ -175,6 +313,8 @@ int target_design(ivl_design_t des)
       }
 
       fclose(vvp_out);
+      free(out_buffer);
+      out_buffer = 0;
       EOC_cleanup_drivers();
 
       return rc + vvp_errors;
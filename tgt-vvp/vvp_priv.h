@@ -30,7 +30,10 @@
 
 /*
  * The target_design entry opens the output file that receives the
- * compiled design, and sets the vvp_out to the descriptor.
+ * compiled design, and sets the vvp_out to the descriptor. The
+ * stream is fully buffered with a large user-space buffer, so the
+ * draw_* modules are free to emit with many small fprintf calls
+ * without a system call per statement.
  */
 extern FILE* vvp_out;
 
@@ -102,6 +105,13 @@ extern void draw_lpm_mux(ivl_lpm_t net);
 extern struct vector_info draw_ufunc_expr(ivl_expr_t expr, unsigned wid);
 extern void draw_ufunc_real(ivl_expr_t expr);
 
+/*
+ * Draw a statement as vvp assembly. This is the main statement
+ * dispatch in vvp_process.c, and is also used by draw_ufunc.c to
+ * expand small function bodies inline into the caller.
+ */
+extern int show_statement(ivl_statement_t net, ivl_scope_t sscope);
+
 extern void pad_expr_in_place(ivl_expr_t expr, struct vector_info res,
                               unsigned swid);
 
@@ -242,6 +252,13 @@ extern void draw_eval_expr_into_integer(ivl_expr_t expr, unsigned ix);
  *    Return the base of an allocated vector in the thread. The bits
  *    are marked allocated in the process.
  *
+ *  allocate_vector_extend
+ *    Try to widen an already allocated vector in place by claiming
+ *    the free bits directly above it. Return the base on success, or
+ *    0 if any of those bits are in use. This lets the code generator
+ *    widen a result with just a %pad, instead of allocating a fresh
+ *    vector and copying the value over with a %mov.
+ *
  *  clr_vector
  *    Clear a vector previously allocated.
  *
@@ -281,6 +298,8 @@ extern void draw_eval_expr_into_integer(ivl_expr_t expr, unsigned ix);
  * expected to be overwritten.
  */
 extern unsigned allocate_vector(unsigned wid);
+extern unsigned allocate_vector_extend(unsigned base, unsigned wid,
+				       unsigned ewid);
 extern void clr_vector(struct vector_info vec);
 
 extern void clear_expression_lookaside(void);
@@ -327,6 +346,16 @@ extern void draw_eval_string(ivl_expr_t ex);
 extern int draw_eval_object(ivl_expr_t ex);
 
 extern int show_stmt_assign(ivl_statement_t net);
+
+/*
+ * This detects a run of blocking assignments, starting at position
+ * idx of the given block statement, that initialize consecutive
+ * words of an array with the same constant value. If a worthwhile
+ * run is found, draw a single %arr/fill for it and return the
+ * number of statements consumed. Otherwise, draw nothing and return
+ * 0 so that the statements are drawn one by one.
+ */
+extern unsigned show_stmt_assign_fill_run(ivl_statement_t block, unsigned idx);
 extern void show_stmt_file_line(ivl_statement_t net, const char*desc);
 
 /*
@@ -341,4 +370,23 @@ extern void clr_word(int idx);
 extern unsigned local_count;
 extern unsigned thread_count;
 
+/*
+ * Execution profile from a previous run, loaded in vvp.c when
+ * -pprofile=<path> is given. The count is the number of thread
+ * resumes recorded against the scope; a scope is hot if it took a
+ * meaningful share of the whole run.
+ */
+extern int vvp_profile_present(void);
+extern unsigned long vvp_profile_scope_count(ivl_scope_t scope);
+extern int vvp_profile_scope_hot(ivl_scope_t scope);
+
+/*
+ * Partition boundary reporting, in partition.c. The spec maps design
+ * scopes to named partitions; the manifest lists the nexuses that
+ * cross partitions, for coupling hand-sharded simulations.
+ */
+extern int vvp_partition_load(const char*spec_path, const char*out_path);
+extern int vvp_partition_active(void);
+extern int vvp_partition_emit_manifest(ivl_design_t des);
+
 #endif
@@ -26,8 +26,6 @@
 #define snprintf _snprintf
 #endif
 
-static int show_statement(ivl_statement_t net, ivl_scope_t sscope);
-
 unsigned local_count = 0;
 unsigned thread_count = 0;
 
@@ -575,6 +573,14 @@ static int show_stmt_block(ivl_statement_t net, ivl_scope_t sscope)
       unsigned cnt = ivl_stmt_block_count(net);
 
       for (idx = 0 ;  idx < cnt ;  idx += 1) {
+	      /* A run of assignments that fill consecutive words of
+		 an array with the same constant collapses into a
+		 single %arr/fill instruction. */
+	    unsigned run = show_stmt_assign_fill_run(net, idx);
+	    if (run > 0) {
+		  idx += run - 1;
+		  continue;
+	    }
 	    rc += show_statement(ivl_stmt_block_stmt(net, idx), sscope);
       }
 
@@ -1532,8 +1538,7 @@ static int show_stmt_utask(ivl_statement_t net)
 
       show_stmt_file_line(net, "User task call.");
 
-      fprintf(vvp_out, "    %%fork TD_%s",
-	      vvp_mangle_id(ivl_scope_name(task)));
+      fprintf(vvp_out, "    %%fork TD_%p", task);
       fprintf(vvp_out, ", S_%p;\n", task);
       fprintf(vvp_out, "    %%join;\n");
       clear_expression_lookaside();
@@ -2033,7 +2038,7 @@ static unsigned is_utask_call_with_args(ivl_scope_t scope,
  * switches on the statement type and draws code based on the type and
  * further specifics.
  */
-static int show_statement(ivl_statement_t net, ivl_scope_t sscope)
+int show_statement(ivl_statement_t net, ivl_scope_t sscope)
 {
       const ivl_statement_type_t code = ivl_statement_type(net);
       int rc = 0;
@@ -2252,7 +2257,7 @@ int draw_task_definition(ivl_scope_t scope)
       int rc = 0;
       ivl_statement_t def = ivl_scope_def(scope);
 
-      fprintf(vvp_out, "TD_%s ;\n", vvp_mangle_id(ivl_scope_name(scope)));
+      fprintf(vvp_out, "TD_%p ; %s\n", scope, ivl_scope_name(scope));
       clear_expression_lookaside();
 
       assert(def);
@@ -2269,7 +2274,7 @@ int draw_func_definition(ivl_scope_t scope)
       int rc = 0;
       ivl_statement_t def = ivl_scope_def(scope);
 
-      fprintf(vvp_out, "TD_%s ;\n", vvp_mangle_id(ivl_scope_name(scope)));
+      fprintf(vvp_out, "TD_%p ; %s\n", scope, ivl_scope_name(scope));
       clear_expression_lookaside();
 
       assert(def);
@@ -1888,13 +1888,11 @@ static void draw_lpm_ufunc(ivl_lpm_t net)
 	    input_strings[idx] = draw_net_input(ivl_lpm_data(net, idx));
 
       if (ivl_lpm_trigger(net))
-            fprintf(vvp_out, "L_%p%s .ufunc/e TD_%s, %u, E_%p", net, dly,
-                    vvp_mangle_id(ivl_scope_name(def)),
-                    ivl_lpm_width(net), ivl_lpm_trigger(net));
+            fprintf(vvp_out, "L_%p%s .ufunc/e TD_%p, %u, E_%p", net, dly,
+                    def, ivl_lpm_width(net), ivl_lpm_trigger(net));
       else
-            fprintf(vvp_out, "L_%p%s .ufunc TD_%s, %u", net, dly,
-                    vvp_mangle_id(ivl_scope_name(def)),
-                    ivl_lpm_width(net));
+            fprintf(vvp_out, "L_%p%s .ufunc TD_%p, %u", net, dly,
+                    def, ivl_lpm_width(net));
 
 	/* Print all the net signals that connect to the input of the
 	   function. */
@@ -2131,6 +2129,36 @@ static const char *vvp_port_info_type_str(ivl_signal_port_t ptype)
       }
 }
 
+/* Callback wrappers for the bulk scope scan methods. */
+
+static int draw_logic_in_scope_f(ivl_net_logic_t lptr, void*cd)
+{
+      (void)cd; /* Parameter is not used. */
+      draw_logic_in_scope(lptr);
+      return 0;
+}
+
+static int draw_lpm_in_scope_f(ivl_lpm_t lpm, void*cd)
+{
+      (void)cd; /* Parameter is not used. */
+      draw_lpm_in_scope(lpm);
+      return 0;
+}
+
+static int draw_signal_in_scope_f(ivl_signal_t sig, void*cd)
+{
+      (void)cd; /* Parameter is not used. */
+      switch (ivl_signal_type(sig)) {
+	  case IVL_SIT_REG:
+	    draw_reg_in_scope(sig);
+	    break;
+	  default:
+	    draw_net_in_scope(sig);
+	    break;
+      }
+      return 0;
+}
+
 int draw_scope(ivl_scope_t net, ivl_scope_t parent)
 {
       unsigned idx;
@@ -2242,37 +2270,20 @@ int draw_scope(ivl_scope_t net, ivl_scope_t parent)
 	   a functor that connects pin 0 to the output, and the
 	   remaining pins to inputs. */
 
-      for (idx = 0 ;  idx < ivl_scope_logs(net) ;  idx += 1) {
-	    ivl_net_logic_t lptr = ivl_scope_log(net, idx);
-	    draw_logic_in_scope(lptr);
-      }
+      ivl_scope_scan_logs(net, draw_logic_in_scope_f, 0);
 
 
 	/* Scan the signals (reg and net) and draw the appropriate
 	   statements to make the signal function. */
 
-      for (idx = 0 ;  idx < ivl_scope_sigs(net) ;  idx += 1) {
-	    ivl_signal_t sig = ivl_scope_sig(net, idx);
-
-	    switch (ivl_signal_type(sig)) {
-		case IVL_SIT_REG:
-		  draw_reg_in_scope(sig);
-		  break;
-		default:
-		  draw_net_in_scope(sig);
-		  break;
-	    }
-      }
+      ivl_scope_scan_sigs(net, draw_signal_in_scope_f, 0);
 
       for (idx = 0 ;  idx < ivl_scope_events(net) ;  idx += 1) {
 	    ivl_event_t event = ivl_scope_event(net, idx);
 	    draw_event_in_scope(event);
       }
 
-      for (idx = 0 ;  idx < ivl_scope_lpms(net) ;  idx += 1) {
-	    ivl_lpm_t lpm = ivl_scope_lpm(net, idx);
-	    draw_lpm_in_scope(lpm);
-      }
+      ivl_scope_scan_lpms(net, draw_lpm_in_scope_f, 0);
 
       for (idx = 0 ; idx < ivl_scope_switches(net) ; idx += 1) {
 	    ivl_switch_t sw = ivl_scope_switch(net, idx);
@@ -24,6 +24,7 @@
 # include  <cassert>
 # include  <cmath> // Needed to get pow for as_double().
 # include  <cstdio> // Needed to get snprintf for as_string().
+# include  <cstddef> // Needed to get offsetof for bits_hdr_().
 
 #if !defined(HAVE_LROUND)
 /*
@@ -42,6 +43,67 @@ extern "C" long int lround(double x)
 
 static verinum::V add_with_carry(verinum::V l, verinum::V r, verinum::V&c);
 
+/*
+ * Constant numbers are copied around freely -- parameter overrides
+ * per instance, dup_expr of constant expressions, and so on -- and
+ * for wide numbers the bit array is most of the weight. So the bit
+ * arrays are reference counted and shared by the copy constructor
+ * and assignment operator. The few mutators detach (take a private
+ * copy) before writing, so sharing is invisible to the callers.
+ */
+verinum::bits_buf_t* verinum::bits_hdr_(V*bits)
+{
+      return reinterpret_cast<bits_buf_t*>
+	    (reinterpret_cast<char*>(bits) - offsetof(bits_buf_t, bits));
+}
+
+verinum::V* verinum::bits_alloc_(unsigned nbits)
+{
+      size_t size = sizeof(bits_buf_t);
+      if (nbits > 1)
+	    size += (nbits-1) * sizeof(V);
+
+      bits_buf_t*buf = reinterpret_cast<bits_buf_t*> (new char[size]);
+      buf->refs = 1;
+      return buf->bits;
+}
+
+verinum::V* verinum::bits_share_(V*bits)
+{
+      if (bits == 0)
+	    return 0;
+
+      bits_hdr_(bits)->refs += 1;
+      return bits;
+}
+
+void verinum::bits_release_(V*bits)
+{
+      if (bits == 0)
+	    return;
+
+      bits_buf_t*buf = bits_hdr_(bits);
+      buf->refs -= 1;
+      if (buf->refs == 0)
+	    delete[] reinterpret_cast<char*>(buf);
+}
+
+void verinum::bits_detach_()
+{
+      if (bits_ == 0)
+	    return;
+
+      if (bits_hdr_(bits_)->refs == 1)
+	    return;
+
+      V*tmp = bits_alloc_(nbits_);
+      for (unsigned idx = 0 ;  idx < nbits_ ;  idx += 1)
+	    tmp[idx] = bits_[idx];
+
+      bits_release_(bits_);
+      bits_ = tmp;
+}
+
 verinum::verinum()
 : bits_(0), nbits_(0), has_len_(false), has_sign_(false), is_single_(false), string_flag_(false)
 {
@@ -51,7 +113,7 @@ verinum::verinum(const V*bits, unsigned nbits, bool has_len__)
 : has_len_(has_len__), has_sign_(false), is_single_(false), string_flag_(false)
 {
       nbits_ = nbits;
-      bits_ = new V [nbits];
+      bits_ = bits_alloc_(nbits);
       for (unsigned idx = 0 ;  idx < nbits ;  idx += 1) {
 	    bits_[idx] = bits[idx];
       }
@@ -119,7 +181,7 @@ verinum::verinum(const string&s)
 	// Special case: The string "" is 8 bits of 0.
       if (nbits_ == 0) {
 	    nbits_ = 8;
-	    bits_ = new V [nbits_];
+	    bits_ = bits_alloc_(nbits_);
 	    bits_[0] = V0;
 	    bits_[1] = V0;
 	    bits_[2] = V0;
@@ -131,7 +193,7 @@ verinum::verinum(const string&s)
 	    return;
       }
 
-      bits_ = new V [nbits_];
+      bits_ = bits_alloc_(nbits_);
 
       unsigned idx, cp;
       V*bp = bits_+nbits_;
@@ -152,7 +214,7 @@ verinum::verinum(verinum::V val, unsigned n, bool h)
 : has_len_(h), has_sign_(false), is_single_(false), string_flag_(false)
 {
       nbits_ = n;
-      bits_ = new V[nbits_];
+      bits_ = bits_alloc_(nbits_);
       for (unsigned idx = 0 ;  idx < nbits_ ;  idx += 1)
 	    bits_[idx] = val;
 }
@@ -161,7 +223,7 @@ verinum::verinum(uint64_t val, unsigned n)
 : has_len_(true), has_sign_(false), is_single_(false), string_flag_(false)
 {
       nbits_ = n;
-      bits_ = new V[nbits_];
+      bits_ = bits_alloc_(nbits_);
       for (unsigned idx = 0 ;  idx < nbits_ ;  idx += 1) {
 	    bits_[idx] = (val&1) ? V1 : V0;
 	    val >>= (uint64_t)1;
@@ -181,7 +243,7 @@ verinum::verinum(double val, bool)
 	/* We return `bx for a NaN or +/- infinity. */
       if (val != val || (val && (val == 0.5*val))) {
 	    nbits_ = 1;
-	    bits_ = new V[nbits_];
+	    bits_ = bits_alloc_(nbits_);
 	    bits_[0] = Vx;
 	    return;
       }
@@ -195,7 +257,7 @@ verinum::verinum(double val, bool)
 	/* Get the exponent and fractional part of the number. */
       fraction = frexp(val, &exponent);
       nbits_ = exponent+1;
-      bits_ = new V[nbits_];
+      bits_ = bits_alloc_(nbits_);
       const verinum const_one(1);
 
 	/* If the value is small enough just use lround(). */
@@ -265,10 +327,10 @@ void verinum::signed_trim()
 
 	/* Trim the bits if needed. */
       if (tlen < nbits_) {
-	    V* tbits = new V[tlen];
+	    V* tbits = bits_alloc_(tlen);
 	    for (unsigned idx = 0; idx < tlen; idx += 1)
 		  tbits[idx] = bits_[idx];
-	    delete[] bits_;
+	    bits_release_(bits_);
 	    bits_ = tbits;
 	    nbits_ = tlen;
       }
@@ -278,23 +340,28 @@ verinum::verinum(const verinum&that)
 {
       string_flag_ = that.string_flag_;
       nbits_ = that.nbits_;
-      bits_ = new V[nbits_];
+      bits_ = bits_share_(that.bits_);
       has_len_ = that.has_len_;
       has_sign_ = that.has_sign_;
       is_single_ = that.is_single_;
-      for (unsigned idx = 0 ;  idx < nbits_ ;  idx += 1)
-	    bits_[idx] = that.bits_[idx];
 }
 
 verinum::verinum(const verinum&that, unsigned nbits)
 {
       string_flag_ = that.string_flag_ && (that.nbits_ == nbits);
       nbits_ = nbits;
-      bits_ = new V[nbits_];
       has_len_ = true;
       has_sign_ = that.has_sign_;
       is_single_ = false;
 
+	// Already the right width, so the bits can be shared.
+      if (nbits == that.nbits_) {
+	    bits_ = bits_share_(that.bits_);
+	    return;
+      }
+
+      bits_ = bits_alloc_(nbits_);
+
       unsigned copy = nbits;
       if (copy > that.nbits_)
 	    copy = that.nbits_;
@@ -327,7 +394,7 @@ verinum::verinum(int64_t that)
 
       nbits_ += 1;
 
-      bits_ = new V[nbits_];
+      bits_ = bits_alloc_(nbits_);
       for (unsigned idx = 0 ;  idx < nbits_ ;  idx += 1) {
 	    bits_[idx] = (that & 1)? V1 : V0;
 	    that >>= 1;
@@ -336,17 +403,15 @@ verinum::verinum(int64_t that)
 
 verinum::~verinum()
 {
-      delete[]bits_;
+      bits_release_(bits_);
 }
 
 verinum& verinum::operator= (const verinum&that)
 {
       if (this == &that) return *this;
-      delete[]bits_;
+      bits_release_(bits_);
       nbits_ = that.nbits_;
-      bits_ = new V[that.nbits_];
-      for (unsigned idx = 0 ;  idx < nbits_ ;  idx += 1)
-	    bits_[idx] = that.bits_[idx];
+      bits_ = bits_share_(that.bits_);
 
       has_len_ = that.has_len_;
       has_sign_ = that.has_sign_;
@@ -364,12 +429,14 @@ verinum::V verinum::get(unsigned idx) const
 verinum::V verinum::set(unsigned idx, verinum::V val)
 {
       assert(idx < nbits_);
+      bits_detach_();
       return bits_[idx] = val;
 }
 
 void verinum::set(unsigned off, const verinum&val)
 {
       assert(off + val.len() <= nbits_);
+      bits_detach_();
       for (unsigned idx = 0 ; idx < val.len() ; idx += 1)
 	    bits_[off+idx] = val[idx];
 }
@@ -956,6 +1023,53 @@ static verinum::V add_with_carry(verinum::V l, verinum::V r, verinum::V&c)
 	    return verinum::V0;
 }
 
+/*
+ * The verinum stores one V per bit, which is what the X/Z-aware
+ * operations need, but it makes wide arithmetic on fully defined
+ * values (the common case when folding parameter expressions) pay a
+ * switch per bit. These helpers pack the value plane into 32-bit
+ * limbs so the arithmetic operators below can work a word at a time
+ * when both operands are defined, using 64-bit intermediates for the
+ * carries and products. The per-bit code remains as the fallback for
+ * values with x or z bits.
+ */
+static const unsigned LIMB_BITS = 32;
+
+static unsigned limb_count(unsigned bits)
+{
+      return (bits + LIMB_BITS - 1) / LIMB_BITS;
+}
+
+/*
+ * Pack the bits of the value into the limb array, extending with the
+ * pad bit (the sign bit or V0, at the caller's choice) up to the full
+ * limb count. The value must be fully defined.
+ */
+static void pack_limbs(const verinum&val, verinum::V pad,
+		       uint32_t*limbs, unsigned nlimbs)
+{
+      uint32_t pad_mask = (pad == verinum::V1)? 0xffffffffU : 0;
+      for (unsigned idx = 0 ;  idx < nlimbs ;  idx += 1)
+	    limbs[idx] = pad_mask;
+
+      for (unsigned idx = 0 ;  idx < val.len() ;  idx += 1) {
+	    if (idx >= nlimbs*LIMB_BITS)
+		  break;
+	    if (val[idx] == verinum::V1)
+		  limbs[idx/LIMB_BITS] |=  (uint32_t(1) << idx%LIMB_BITS);
+	    else
+		  limbs[idx/LIMB_BITS] &= ~(uint32_t(1) << idx%LIMB_BITS);
+      }
+}
+
+static void unpack_limbs(const uint32_t*limbs, verinum::V*bits,
+			 unsigned nbits)
+{
+      for (unsigned idx = 0 ;  idx < nbits ;  idx += 1)
+	    bits[idx] = (limbs[idx/LIMB_BITS] >> idx%LIMB_BITS) & 1
+		  ? verinum::V1 : verinum::V0;
+}
+
 verinum v_not(const verinum&left)
 {
       verinum val = left;
@@ -993,6 +1107,36 @@ verinum operator + (const verinum&left, const verinum&right)
       bool signed_flag = left.has_sign() && right.has_sign();
       verinum::V*val_bits = new verinum::V[max+1];
 
+	/* If both operands are fully defined, do the addition a limb
+	   at a time. Padding both operands out to the result width
+	   with the same pad bits the per-bit code uses makes the top
+	   bit come out identically. */
+      if (left.is_defined() && right.is_defined()) {
+	    unsigned nlimbs = limb_count(max+1);
+	    uint32_t*lv = new uint32_t[3*nlimbs];
+	    uint32_t*rv = lv + nlimbs;
+	    uint32_t*sum = rv + nlimbs;
+	    pack_limbs(left,  signed_flag? sign_bit(left)  : verinum::V0,
+		       lv, nlimbs);
+	    pack_limbs(right, signed_flag? sign_bit(right) : verinum::V0,
+		       rv, nlimbs);
+
+	    uint64_t carry = 0;
+	    for (unsigned idx = 0 ;  idx < nlimbs ;  idx += 1) {
+		  uint64_t tmp = (uint64_t)lv[idx] + rv[idx] + carry;
+		  sum[idx] = (uint32_t)tmp;
+		  carry = tmp >> LIMB_BITS;
+	    }
+
+	    unpack_limbs(sum, val_bits, max+1);
+	    delete[]lv;
+
+	    verinum val (val_bits, max+1, false);
+	    val.has_sign(signed_flag);
+	    delete[]val_bits;
+	    return val;
+      }
+
       verinum::V carry = verinum::V0;
       for (unsigned idx = 0 ;  idx < min ;  idx += 1)
 	    val_bits[idx] = add_with_carry(left[idx], right[idx], carry);
@@ -1037,6 +1181,40 @@ verinum operator - (const verinum&left, const verinum&right)
       bool signed_flag = left.has_sign() && right.has_sign();
       verinum::V*val_bits = new verinum::V[max+1];
 
+	/* Fully defined operands subtract a limb at a time, as twos
+	   complement addition. The extra top bit is only kept for
+	   signed results, and only when it carries information, just
+	   like the per-bit code below. */
+      if (left.is_defined() && right.is_defined()) {
+	    unsigned nlimbs = limb_count(max+1);
+	    uint32_t*lv = new uint32_t[3*nlimbs];
+	    uint32_t*rv = lv + nlimbs;
+	    uint32_t*sum = rv + nlimbs;
+	    pack_limbs(left,  signed_flag? sign_bit(left)  : verinum::V0,
+		       lv, nlimbs);
+	    pack_limbs(right, signed_flag? sign_bit(right) : verinum::V0,
+		       rv, nlimbs);
+
+	    uint64_t carry = 1;
+	    for (unsigned idx = 0 ;  idx < nlimbs ;  idx += 1) {
+		  uint64_t tmp = (uint64_t)lv[idx] + (uint32_t)~rv[idx] + carry;
+		  sum[idx] = (uint32_t)tmp;
+		  carry = tmp >> LIMB_BITS;
+	    }
+
+	    unpack_limbs(sum, val_bits, max+1);
+	    delete[]lv;
+
+	    unsigned use_len = max;
+	    if (signed_flag && val_bits[max] != val_bits[max-1])
+		  use_len = max + 1;
+
+	    verinum val (val_bits, use_len, false);
+	    val.has_sign(signed_flag);
+	    delete[]val_bits;
+	    return val;
+      }
+
       verinum::V carry = verinum::V1;
       for (unsigned idx = 0 ;  idx < min ;  idx += 1)
 	    val_bits[idx] = add_with_carry(left[idx], ~right[idx], carry);
@@ -1093,26 +1271,40 @@ verinum operator * (const verinum&left, const verinum&right)
 	    return result;
       }
 
-      verinum result(verinum::V0, left.len() + right.len(), has_len_flag);
-      result.has_sign(left.has_sign() || right.has_sign());
-
-      verinum::V r_sign = sign_bit(right);
-      for (unsigned rdx = 0 ;  rdx < result.len() ;  rdx += 1) {
-
-	    verinum::V r_bit = rdx < right.len()? right.get(rdx) : r_sign;
-	    if (r_bit == verinum::V0)
+	/* Both operands are known defined here, so sign extend each
+	   out to the result width and do a limb-wise multiply, taking
+	   the product modulo the result width. This replaces the old
+	   shift-and-add of individual bits. */
+      unsigned use_len = left.len() + right.len();
+      unsigned nlimbs = limb_count(use_len);
+      uint32_t*lv = new uint32_t[3*nlimbs];
+      uint32_t*rv = lv + nlimbs;
+      uint32_t*prod = rv + nlimbs;
+      pack_limbs(left,  sign_bit(left),  lv, nlimbs);
+      pack_limbs(right, sign_bit(right), rv, nlimbs);
+      for (unsigned idx = 0 ;  idx < nlimbs ;  idx += 1)
+	    prod[idx] = 0;
+
+      for (unsigned rdx = 0 ;  rdx < nlimbs ;  rdx += 1) {
+	    if (rv[rdx] == 0)
 		  continue;
-
-	    verinum::V l_sign = sign_bit(left);
-	    verinum::V carry = verinum::V0;
-	    for (unsigned ldx = 0 ;  ldx < result.len()-rdx ;  ldx += 1) {
-		  verinum::V l_bit = ldx < left.len()? left[ldx] : l_sign;
-		  result.set(ldx+rdx, add_with_carry(l_bit,
-						     result[rdx+ldx],
-						     carry));
+	    uint64_t carry = 0;
+	    for (unsigned ldx = 0 ;  ldx < nlimbs-rdx ;  ldx += 1) {
+		  uint64_t tmp = (uint64_t)lv[ldx] * rv[rdx]
+			+ prod[rdx+ldx] + carry;
+		  prod[rdx+ldx] = (uint32_t)tmp;
+		  carry = tmp >> LIMB_BITS;
 	    }
       }
 
+      verinum::V*val_bits = new verinum::V[use_len];
+      unpack_limbs(prod, val_bits, use_len);
+      delete[]lv;
+
+      verinum result (val_bits, use_len, has_len_flag);
+      result.has_sign(left.has_sign() || right.has_sign());
+      delete[]val_bits;
+
       return trim_vnum(result);
 }
 
@@ -1199,6 +1391,57 @@ verinum operator >> (const verinum&that, unsigned shift)
       return result;
 }
 
+/*
+ * These are the limb primitives for the restoring division
+ * below. The operands of unsigned_divide/unsigned_modulus are always
+ * fully defined and non-negative (the callers strip the signs), so
+ * the whole shift-and-subtract loop can run on packed limbs instead
+ * of allocating verinum temporaries every round.
+ */
+static bool limb_le(const uint32_t*left, const uint32_t*right,
+		    unsigned nlimbs)
+{
+      for (unsigned idx = nlimbs ;  idx > 0 ;  idx -= 1) {
+	    if (left[idx-1] != right[idx-1])
+		  return left[idx-1] < right[idx-1];
+      }
+      return true;
+}
+
+static void limb_sub(uint32_t*acc, const uint32_t*val, unsigned nlimbs)
+{
+      uint64_t borrow = 0;
+      for (unsigned idx = 0 ;  idx < nlimbs ;  idx += 1) {
+	    uint64_t tmp = (uint64_t)acc[idx] - val[idx] - borrow;
+	    acc[idx] = (uint32_t)tmp;
+	    borrow = (tmp >> LIMB_BITS) & 1;
+      }
+}
+
+static void limb_shift_left(uint32_t*limbs, unsigned nlimbs, unsigned shift)
+{
+      unsigned loff = shift / LIMB_BITS;
+      unsigned boff = shift % LIMB_BITS;
+      for (unsigned idx = nlimbs ;  idx > 0 ;  idx -= 1) {
+	    uint32_t tmp = 0;
+	    if (idx-1 >= loff) {
+		  tmp = limbs[idx-1-loff] << boff;
+		  if (boff > 0 && idx-1 > loff)
+			tmp |= limbs[idx-2-loff] >> (LIMB_BITS-boff);
+	    }
+	    limbs[idx-1] = tmp;
+      }
+}
+
+static void limb_shift_right1(uint32_t*limbs, unsigned nlimbs)
+{
+      for (unsigned idx = 0 ;  idx < nlimbs ;  idx += 1) {
+	    limbs[idx] >>= 1;
+	    if (idx+1 < nlimbs)
+		  limbs[idx] |= limbs[idx+1] << (LIMB_BITS-1);
+      }
+}
+
 static verinum unsigned_divide(verinum num, verinum den, bool signed_result)
 {
       unsigned nwid = num.len();
@@ -1212,7 +1455,12 @@ static verinum unsigned_divide(verinum num, verinum den, bool signed_result)
       if (dwid > nwid)
 	    return verinum(verinum::V0, 1);
 
-      den = den << (nwid-dwid);
+      unsigned nlimbs = limb_count(nwid);
+      uint32_t*rem = new uint32_t[2*nlimbs];
+      uint32_t*dval = rem + nlimbs;
+      pack_limbs(num, verinum::V0, rem,  nlimbs);
+      pack_limbs(den, verinum::V0, dval, nlimbs);
+      limb_shift_left(dval, nlimbs, nwid-dwid);
 
       unsigned idx = nwid - dwid + 1;
       verinum result (verinum::V0, signed_result ? idx + 1 : idx);
@@ -1221,15 +1469,15 @@ static verinum unsigned_divide(verinum num, verinum den, bool signed_result)
 	    result.has_sign(true);
       }
       while (idx > 0) {
-	    if (den <= num) {
-		  verinum dif = num - den;
-		  num = dif;
+	    if (limb_le(dval, rem, nlimbs)) {
+		  limb_sub(rem, dval, nlimbs);
 		  result.set(idx-1, verinum::V1);
 	    }
-	    den = den >> 1;
+	    limb_shift_right1(dval, nlimbs);
 	    idx -= 1;
       }
 
+      delete[]rem;
       return result;
 }
 
@@ -1246,19 +1494,40 @@ static verinum unsigned_modulus(verinum num, verinum den)
       if (dwid > nwid)
 	    return num;
 
-      den = den << (nwid-dwid);
+      unsigned nlimbs = limb_count(nwid);
+      uint32_t*rem = new uint32_t[2*nlimbs];
+      uint32_t*dval = rem + nlimbs;
+      pack_limbs(num, verinum::V0, rem,  nlimbs);
+      pack_limbs(den, verinum::V0, dval, nlimbs);
+      limb_shift_left(dval, nlimbs, nwid-dwid);
 
       unsigned idx = nwid - dwid + 1;
+      bool changed = false;
       while (idx > 0) {
-	    if (den <= num) {
-		  verinum dif = num - den;
-		  num = dif;
+	    if (limb_le(dval, rem, nlimbs)) {
+		  limb_sub(rem, dval, nlimbs);
+		  changed = true;
 	    }
-	    den = den >> 1;
+	    limb_shift_right1(dval, nlimbs);
 	    idx -= 1;
       }
 
-      return num;
+	/* If nothing was subtracted, the input is the result. A
+	   changed remainder is a fresh unsized value, the same as the
+	   verinum subtraction used to produce, so the trim_vnum in
+	   the callers shrinks it to fit. */
+      if (! changed) {
+	    delete[]rem;
+	    return num;
+      }
+
+      verinum::V*rem_bits = new verinum::V[nwid];
+      unpack_limbs(rem, rem_bits, nwid);
+      delete[]rem;
+
+      verinum res (rem_bits, nwid, false);
+      delete[]rem_bits;
+      return res;
 }
 
 /*
@@ -103,6 +103,23 @@ class verinum {
     private:
       void signed_trim();
 
+    private:
+	// The bit array lives in a reference counted buffer, with
+	// this header directly in front of the array that bits_
+	// points into. Copies of a verinum share the buffer, and the
+	// mutators call bits_detach_() to get a private copy before
+	// writing. The flag members below are per-object and may
+	// differ between copies that share bits.
+      struct bits_buf_t {
+	    unsigned refs;
+	    V bits[1];
+      };
+      static V* bits_alloc_(unsigned nbits);
+      static V* bits_share_(V*bits);
+      static void bits_release_(V*bits);
+      static bits_buf_t* bits_hdr_(V*bits);
+      void bits_detach_();
+
     private:
       V* bits_;
       unsigned nbits_;
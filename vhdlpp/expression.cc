@@ -28,7 +28,7 @@
 using namespace std;
 
 Expression::Expression()
-: type_(0)
+: type_(0), memo_scope_(0), memo_val_(0), memo_set_(false)
 {
 }
 
@@ -119,9 +119,23 @@ class Expression : public LineInfo {
 	// elaboration assigns to this expression.
       void set_type(const VType*);
 
+	// Expressions are immutable after parse, so derived evaluate
+	// implementations may memoize a successful result on the
+	// node. The memo is keyed by the scope, because the same
+	// expression node can be evaluated with different generic
+	// bindings. Return true and set val if the memo for this
+	// scope is present.
+      bool evaluate_memo_(ScopeBase*scope, int64_t&val) const;
+      void evaluate_memo_set_(ScopeBase*scope, int64_t val) const;
+
     private:
       const VType*type_;
 
+	// Memo of the last successful evaluate() result.
+      mutable ScopeBase*memo_scope_;
+      mutable int64_t memo_val_;
+      mutable bool memo_set_;
+
     private: // Not implemented
       Expression(const Expression&);
       Expression& operator = (const Expression&);
@@ -31,12 +31,39 @@ bool Expression::evaluate(Entity*, Architecture*arc, int64_t&val) const
       return evaluate(arc, val);
 }
 
+/*
+ * Expression nodes are immutable after parse, so a successful
+ * evaluation can be memoized on the node and replayed for repeated
+ * queries. The memo is keyed by the scope so that the same node
+ * evaluated with different generic bindings does not replay a stale
+ * value; a different scope simply re-evaluates and replaces the memo.
+ */
+bool Expression::evaluate_memo_(ScopeBase*scope, int64_t&val) const
+{
+      if (memo_set_ && memo_scope_ == scope) {
+	    val = memo_val_;
+	    return true;
+      }
+
+      return false;
+}
+
+void Expression::evaluate_memo_set_(ScopeBase*scope, int64_t val) const
+{
+      memo_scope_ = scope;
+      memo_val_ = val;
+      memo_set_ = true;
+}
+
 
 bool ExpArithmetic::evaluate(ScopeBase*scope, int64_t&val) const
 {
       int64_t val1, val2;
       bool rc;
 
+      if (evaluate_memo_(scope, val))
+	    return true;
+
       rc = eval_operand1(scope, val1);
       if (rc == false)
 	    return false;
@@ -73,6 +100,7 @@ bool ExpArithmetic::evaluate(ScopeBase*scope, int64_t&val) const
 	    return false;
       }
 
+      evaluate_memo_set_(scope, val);
       return true;
 }
 
@@ -134,11 +162,18 @@ bool ExpName::evaluate(ScopeBase*scope, int64_t&val) const
 	    return false;
       }
 
+      if (evaluate_memo_(scope, val))
+	    return true;
+
       bool rc = scope->find_constant(name_, type, exp);
       if (rc == false)
 	    return false;
 
-      return exp->evaluate(scope, val);
+      rc = exp->evaluate(scope, val);
+      if (rc)
+	    evaluate_memo_set_(scope, val);
+
+      return rc;
 }
 
 bool ExpName::evaluate(Entity*ent, Architecture*arc, int64_t&val) const
@@ -87,6 +87,17 @@ static string make_library_package_path(perm_string lib_name, perm_string name)
       return path;
 }
 
+/*
+ * Analyzed copies of external library packages are kept in the work
+ * directory under <library>.<package>.pkg, next to (but distinct
+ * from) the plain <package>.pkg files of the work library itself.
+ */
+static string make_library_cache_path(perm_string lib_name, perm_string name)
+{
+      return string(library_work_path).append("/").append(lib_name)
+	    .append(".").append(name).append(".pkg");
+}
+
 static void import_ieee(void);
 static void import_ieee_use(ActiveScope*res, perm_string package, perm_string name);
 
@@ -210,13 +221,34 @@ void library_use(const YYLTYPE&loc, ActiveScope*res,
 		  errormsg(loc, "Unable to find library %s\n", use_library.str());
 		  return;
 	    }
-	    int rc = parse_source_file(path.c_str(), use_library);
+
+	      // If there is an analyzed copy of this package in the
+	      // work directory that is no older than the library
+	      // source, then parse that instead. The analyzed form is
+	      // typically much smaller than a vendor package source,
+	      // so repeated compiles skip most of the analysis.
+	    string cache_path = make_library_cache_path(use_library, use_package);
+	    struct stat src_stat, cache_stat;
+	    bool use_cache = stat(path.c_str(), &src_stat) == 0
+		  && stat(cache_path.c_str(), &cache_stat) == 0
+		  && cache_stat.st_mtime >= src_stat.st_mtime;
+
+	    int rc = parse_source_file(use_cache? cache_path.c_str() : path.c_str(),
+				       use_library);
 	    if (rc < 0)
 		  errormsg(loc, "Unable to open library file %s\n", path.c_str());
 	    else if (rc > 0)
 		  errormsg(loc, "Errors in library file %s\n", path.c_str());
 	    else
 		  pack = lib.packages[use_package];
+
+	      // Freshly analyzed from the library source, so save the
+	      // analyzed form for the next run.
+	    if (pack && !use_cache) {
+		  ofstream file (cache_path.c_str(), ios_base::out);
+		  if (file.is_open())
+			pack->write_to_stream(file);
+	    }
       }
 
 	// If the package is still not found, then error.
@@ -252,10 +284,17 @@ static void import_ieee_use_std_logic_1164(ActiveScope*res, perm_string name)
 {
       bool all_flag = name=="all";
 
+	// These use clauses are repeated in nearly every design file,
+	// so the types they bind are built once and shared. The type
+	// objects are immutable, so sharing is safe.
       if (all_flag || name == "std_logic_vector") {
-	    vector<VTypeArray::range_t> dims (1);
+	    static const VTypeArray*type_STD_LOGIC_VECTOR = 0;
+	    if (type_STD_LOGIC_VECTOR == 0) {
+		  vector<VTypeArray::range_t> dims (1);
+		  type_STD_LOGIC_VECTOR = new VTypeArray(primitive_STDLOGIC, dims, false);
+	    }
 	    res->bind_name(perm_string::literal("std_logic_vector"),
-			   new VTypeArray(primitive_STDLOGIC, dims, false));
+			   type_STD_LOGIC_VECTOR);
       }
 }
 
@@ -268,14 +307,20 @@ static void import_ieee_use_numeric_bit(ActiveScope*res, perm_string name)
       bool all_flag = name=="all";
 
       if (all_flag || name == "signed") {
-	    vector<VTypeArray::range_t> dims (1);
-	    res->bind_name(perm_string::literal("signed"),
-			   new VTypeArray(primitive_STDLOGIC, dims, true));
+	    static const VTypeArray*type_SIGNED = 0;
+	    if (type_SIGNED == 0) {
+		  vector<VTypeArray::range_t> dims (1);
+		  type_SIGNED = new VTypeArray(primitive_STDLOGIC, dims, true);
+	    }
+	    res->bind_name(perm_string::literal("signed"), type_SIGNED);
       }
       if (all_flag || name == "unsigned") {
-	    vector<VTypeArray::range_t> dims (1);
-	    res->bind_name(perm_string::literal("unsigned"),
-			   new VTypeArray(primitive_BIT, dims, false));
+	    static const VTypeArray*type_UNSIGNED = 0;
+	    if (type_UNSIGNED == 0) {
+		  vector<VTypeArray::range_t> dims (1);
+		  type_UNSIGNED = new VTypeArray(primitive_BIT, dims, false);
+	    }
+	    res->bind_name(perm_string::literal("unsigned"), type_UNSIGNED);
       }
 }
 
@@ -284,14 +329,20 @@ static void import_ieee_use_numeric_std(ActiveScope*res, perm_string name)
       bool all_flag = name=="all";
 
       if (all_flag || name == "signed") {
-	    vector<VTypeArray::range_t> dims (1);
-	    res->bind_name(perm_string::literal("signed"),
-			   new VTypeArray(primitive_STDLOGIC, dims, true));
+	    static const VTypeArray*type_SIGNED = 0;
+	    if (type_SIGNED == 0) {
+		  vector<VTypeArray::range_t> dims (1);
+		  type_SIGNED = new VTypeArray(primitive_STDLOGIC, dims, true);
+	    }
+	    res->bind_name(perm_string::literal("signed"), type_SIGNED);
       }
       if (all_flag || name == "unsigned") {
-	    vector<VTypeArray::range_t> dims (1);
-	    res->bind_name(perm_string::literal("unsigned"),
-			   new VTypeArray(primitive_STDLOGIC, dims, false));
+	    static const VTypeArray*type_UNSIGNED = 0;
+	    if (type_UNSIGNED == 0) {
+		  vector<VTypeArray::range_t> dims (1);
+		  type_UNSIGNED = new VTypeArray(primitive_STDLOGIC, dims, false);
+	    }
+	    res->bind_name(perm_string::literal("unsigned"), type_UNSIGNED);
       }
 }
 
@@ -0,0 +1,41 @@
+/* vhdlpp/vhdlpp_config.h.  Generated from vhdlpp_config.h.in by configure.  */
+#ifndef __vhdlpp_config_H                                           /* -*- c++ -*- */
+#define __vhdlpp_config_H
+/*
+ * Copyright (c) 2011 Stephen Williams (steve@icarus.com)
+ *
+ *    This source code is free software; you can redistribute it
+ *    and/or modify it in source code form under the terms of the GNU
+ *    General Public License as published by the Free Software
+ *    Foundation; either version 2 of the License, or (at your option)
+ *    any later version.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this program; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#if defined(__cplusplus)
+#  if !defined(__GNUC__)
+     using namespace std;
+#  elif (__GNUC__ == 3)
+     using namespace std;
+#  endif
+#endif
+
+# define HAVE_GETOPT_H 1
+# define HAVE_INTTYPES_H 1
+/* # undef HAVE_LIBIBERTY_H */
+/* # undef HAVE_FCHMOD */
+# define HAVE_SYS_WAIT_H 1
+
+#ifdef HAVE_INTTYPES_H
+# include  <inttypes.h>
+#endif
+
+#endif /* __config_H */
@@ -25,7 +25,11 @@
 #include "fstapi.h"
 #include "fastlz.h"
 
-#ifndef HAVE_LIBPTHREAD
+/* The parallel writer thread is worth having whenever a pthread
+   library is available, so key it directly off the configure check. */
+#ifdef HAVE_LIBPTHREAD
+#define FST_WRITER_PARALLEL
+#else
 #undef FST_WRITER_PARALLEL
 #endif
 
@@ -1933,6 +1937,21 @@ if(xc)
 }
 
 
+void fstWriterSetBreakSize(void *ctx, uint64_t numbytes)
+{
+struct fstWriterContext *xc = (struct fstWriterContext *)ctx;
+if(xc && numbytes)
+	{
+	if(numbytes > FST_BREAK_SIZE_MAX)
+		{
+		numbytes = FST_BREAK_SIZE_MAX;
+		}
+
+	xc->fst_break_size = numbytes;
+	}
+}
+
+
 void fstWriterSetDumpSizeLimit(void *ctx, uint64_t numbytes)
 {
 struct fstWriterContext *xc = (struct fstWriterContext *)ctx;
@@ -27,6 +27,18 @@
 #include <config.h>
 #include "lxt2_write.h"
 
+/* Hand the zlib deflate work for each section off to a worker thread
+   when a pthread library is available; the simulation thread then only
+   stages uncompressed bytes.  Without pthreads the original inline
+   gzdopen()/gzwrite() path is used. */
+#ifdef HAVE_LIBPTHREAD
+#define LXT2_WR_PARALLEL
+#endif
+
+#ifdef LXT2_WR_PARALLEL
+#include <pthread.h>
+#endif
+
 
 static char *lxt2_wr_vcd_truncate_bitvec(char *s)
 {
@@ -335,18 +347,294 @@ return(rc);
 }
 
 
+#ifdef LXT2_WR_PARALLEL
+
+/*
+ * Parallel compression pipeline.  The simulation thread stages the
+ * uncompressed section bytes into blocks and hands them to a single
+ * worker thread over a bounded FIFO, so deflate runs off the
+ * simulation thread while the FIFO keeps the file append order
+ * identical to the inline path.  Section open/close markers travel
+ * through the same queue; a close is the only point where the
+ * producer waits, because the callers read back file offsets
+ * immediately afterwards.  The worker appends with pwrite() at its
+ * own offset so it never races the fseeko()/fwrite() table fixups
+ * done on lt->handle between sections.
+ */
+
+#define LXT2_WR_ZBLK_OPEN  0		/* begin a gzip stream at "start"   */
+#define LXT2_WR_ZBLK_DATA  1		/* deflate "len" bytes of payload   */
+#define LXT2_WR_ZBLK_SYNC  2		/* Z_SYNC_FLUSH the open stream     */
+#define LXT2_WR_ZBLK_CLOSE 3		/* finish the stream (gzip trailer) */
+
+#define LXT2_WR_ZQUEUE_MAX (8*1024*1024)
+
+struct lxt2_wr_zblk
+{
+struct lxt2_wr_zblk *next;
+int op;
+unsigned int len;			/* payload bytes (DATA only)  */
+int fd;					/* target file (OPEN only)    */
+off_t start;				/* append offset (OPEN only)  */
+int level;				/* compression level (OPEN)   */
+unsigned char data[1];			/* allocated to hold "len"    */
+};
+
+struct lxt2_wr_zpipe
+{
+pthread_t tid;
+pthread_mutex_t mutex;
+pthread_cond_t wake_worker;
+pthread_cond_t wake_producer;
+struct lxt2_wr_zblk *head, *tail;
+unsigned int queued_bytes;
+unsigned int inflight;			/* ops queued or in progress  */
+int shutdown;
+
+/* worker-side state */
+int fd;
+off_t wpos;
+z_stream strm;
+int strm_live;
+unsigned char outbuf[8 * LXT2_WR_GZWRITE_BUFFER];
+};
+
+
+static void lxt2_wr_zpipe_put(struct lxt2_wr_zpipe *zp, unsigned int len)
+{
+unsigned char *pnt = zp->outbuf;
+
+while(len)
+	{
+	ssize_t rc = pwrite(zp->fd, pnt, len, zp->wpos);
+	if(rc <= 0) break;	/* write error: the offset fixups will expose it */
+	pnt += rc;
+	zp->wpos += rc;
+	len -= rc;
+	}
+}
+
+
+static void lxt2_wr_zpipe_deflate(struct lxt2_wr_zpipe *zp, unsigned char *buf, unsigned int len, int mode)
+{
+int rc;
+
+zp->strm.next_in = buf;
+zp->strm.avail_in = len;
+
+do	{
+	zp->strm.next_out = zp->outbuf;
+	zp->strm.avail_out = sizeof(zp->outbuf);
+	rc = deflate(&zp->strm, mode);
+	lxt2_wr_zpipe_put(zp, sizeof(zp->outbuf) - zp->strm.avail_out);
+	} while((zp->strm.avail_in)||(!zp->strm.avail_out)||((mode==Z_FINISH)&&(rc!=Z_STREAM_END)));
+}
+
+
+static void *lxt2_wr_zpipe_run(void *arg)
+{
+struct lxt2_wr_zpipe *zp = (struct lxt2_wr_zpipe *)arg;
+struct lxt2_wr_zblk *b;
+
+pthread_mutex_lock(&zp->mutex);
+for(;;)
+	{
+	while((!zp->head)&&(!zp->shutdown))
+		{
+		pthread_cond_wait(&zp->wake_worker, &zp->mutex);
+		}
+
+	if(!zp->head) break;	/* shutdown and queue emptied */
+
+	b = zp->head;
+	zp->head = b->next;
+	if(!zp->head) zp->tail = NULL;
+	pthread_mutex_unlock(&zp->mutex);
+
+	switch(b->op)
+		{
+		case LXT2_WR_ZBLK_OPEN:
+			zp->fd = b->fd;
+			zp->wpos = b->start;
+			memset(&zp->strm, 0, sizeof(zp->strm));
+			/* windowBits 15+16 selects the gzip wrapper gzdopen() produced */
+			deflateInit2(&zp->strm, b->level, Z_DEFLATED, 15+16, 8, Z_DEFAULT_STRATEGY);
+			zp->strm_live = 1;
+			break;
+
+		case LXT2_WR_ZBLK_DATA:
+			lxt2_wr_zpipe_deflate(zp, b->data, b->len, Z_NO_FLUSH);
+			break;
+
+		case LXT2_WR_ZBLK_SYNC:
+			lxt2_wr_zpipe_deflate(zp, NULL, 0, Z_SYNC_FLUSH);
+			break;
+
+		case LXT2_WR_ZBLK_CLOSE:
+			if(zp->strm_live)
+				{
+				lxt2_wr_zpipe_deflate(zp, NULL, 0, Z_FINISH);
+				deflateEnd(&zp->strm);
+				zp->strm_live = 0;
+				}
+			break;
+		}
+
+	pthread_mutex_lock(&zp->mutex);
+	zp->queued_bytes -= b->len;
+	zp->inflight--;
+	pthread_cond_signal(&zp->wake_producer);
+	free(b);
+	}
+pthread_mutex_unlock(&zp->mutex);
+
+return(NULL);
+}
+
+
+static struct lxt2_wr_zblk *lxt2_wr_zblk_new(int op, unsigned int len)
+{
+struct lxt2_wr_zblk *b = (struct lxt2_wr_zblk *)malloc(sizeof(struct lxt2_wr_zblk) + len);
+
+b->next = NULL;
+b->op = op;
+b->len = len;
+b->fd = -1;
+b->start = 0;
+b->level = 0;
+
+return(b);
+}
+
+
+static void lxt2_wr_zpipe_send(struct lxt2_wr_zpipe *zp, struct lxt2_wr_zblk *b)
+{
+pthread_mutex_lock(&zp->mutex);
+while(zp->queued_bytes > LXT2_WR_ZQUEUE_MAX)	/* bounded handoff */
+	{
+	pthread_cond_wait(&zp->wake_producer, &zp->mutex);
+	}
+
+if(zp->tail) { zp->tail->next = b; } else { zp->head = b; }
+zp->tail = b;
+zp->queued_bytes += b->len;
+zp->inflight++;
+pthread_cond_signal(&zp->wake_worker);
+pthread_mutex_unlock(&zp->mutex);
+}
+
+
+static void lxt2_wr_zpipe_drain(struct lxt2_wr_zpipe *zp)
+{
+pthread_mutex_lock(&zp->mutex);
+while(zp->inflight)
+	{
+	pthread_cond_wait(&zp->wake_producer, &zp->mutex);
+	}
+pthread_mutex_unlock(&zp->mutex);
+}
+
+
+static struct lxt2_wr_zpipe *lxt2_wr_zpipe_get(struct lxt2_wr_trace *lt)
+{
+struct lxt2_wr_zpipe *zp = (struct lxt2_wr_zpipe *)lt->zpipe;
+
+if(!zp)
+	{
+	zp = (struct lxt2_wr_zpipe *)calloc(1, sizeof(struct lxt2_wr_zpipe));
+	pthread_mutex_init(&zp->mutex, NULL);
+	pthread_cond_init(&zp->wake_worker, NULL);
+	pthread_cond_init(&zp->wake_producer, NULL);
+
+	if(pthread_create(&zp->tid, NULL, lxt2_wr_zpipe_run, zp) != 0)
+		{
+		pthread_cond_destroy(&zp->wake_producer);
+		pthread_cond_destroy(&zp->wake_worker);
+		pthread_mutex_destroy(&zp->mutex);
+		free(zp);
+		return(NULL);	/* caller falls back to the inline path */
+		}
+
+	lt->zpipe = zp;
+	}
+
+return(zp);
+}
+
+
+static void lxt2_wr_zpipe_shutdown(struct lxt2_wr_trace *lt)
+{
+struct lxt2_wr_zpipe *zp = (struct lxt2_wr_zpipe *)lt->zpipe;
+
+if(zp)
+	{
+	pthread_mutex_lock(&zp->mutex);
+	zp->shutdown = 1;
+	pthread_cond_signal(&zp->wake_worker);
+	pthread_mutex_unlock(&zp->mutex);
+	pthread_join(zp->tid, NULL);
+
+	pthread_cond_destroy(&zp->wake_producer);
+	pthread_cond_destroy(&zp->wake_worker);
+	pthread_mutex_destroy(&zp->mutex);
+	free(zp);
+	lt->zpipe = NULL;
+	}
+}
+
+#endif
+
+
+/*
+ * open a compressed section starting at the current write position.
+ * With the worker pipeline this only posts an open marker; otherwise
+ * it is the historical gzdopen() on a dup of the file descriptor.
+ */
+static void lxt2_wr_zsection_open(struct lxt2_wr_trace *lt, const char *mode)
+{
+#ifdef LXT2_WR_PARALLEL
+struct lxt2_wr_zpipe *zp = lxt2_wr_zpipe_get(lt);
+
+if(zp)
+	{
+	struct lxt2_wr_zblk *b = lxt2_wr_zblk_new(LXT2_WR_ZBLK_OPEN, 0);
+
+	fflush(lt->handle);
+	b->fd = fileno(lt->handle);
+	b->start = ftello(lt->handle);
+	b->level = isdigit((unsigned char)mode[2])? (mode[2] - '0') : 9;
+	lxt2_wr_zpipe_send(zp, b);
+	lt->zhandle = NULL;
+	return;
+	}
+#endif
+
+lt->zhandle = gzdopen(dup(fileno(lt->handle)), mode);
+}
+
+
 /*
  * gzfunctions which emit various big endian
  * data to a file.  (lt->position needs to be
  * fixed up on gzclose so the tables don't
  * get out of sync!)
- */ 
+ */
 static int gzwrite_buffered(struct lxt2_wr_trace *lt)
 {
 int rc = 1;
 
 if(lt->gzbufpnt > LXT2_WR_GZWRITE_BUFFER)
 	{
+#ifdef LXT2_WR_PARALLEL
+	if(lt->zpipe)
+		{
+		struct lxt2_wr_zblk *b = lxt2_wr_zblk_new(LXT2_WR_ZBLK_DATA, lt->gzbufpnt);
+		memcpy(b->data, lt->gzdest, lt->gzbufpnt);
+		lxt2_wr_zpipe_send((struct lxt2_wr_zpipe *)lt->zpipe, b);
+		lt->gzbufpnt = 0;
+		return(rc);
+		}
+#endif
 	rc = gzwrite(lt->zhandle, lt->gzdest, lt->gzbufpnt);
 	rc = rc ? 1 : 0;
 	lt->gzbufpnt = 0;
@@ -357,6 +645,33 @@ return(rc);
 
 static void gzflush_buffered(struct lxt2_wr_trace *lt, int doclose)
 {
+#ifdef LXT2_WR_PARALLEL
+if(lt->zpipe)
+	{
+	struct lxt2_wr_zpipe *zp = (struct lxt2_wr_zpipe *)lt->zpipe;
+
+	if(lt->gzbufpnt)
+		{
+		struct lxt2_wr_zblk *b = lxt2_wr_zblk_new(LXT2_WR_ZBLK_DATA, lt->gzbufpnt);
+		memcpy(b->data, lt->gzdest, lt->gzbufpnt);
+		lxt2_wr_zpipe_send(zp, b);
+		lt->gzbufpnt = 0;
+		if(!doclose)
+			{
+			lxt2_wr_zpipe_send(zp, lxt2_wr_zblk_new(LXT2_WR_ZBLK_SYNC, 0));
+			}
+		}
+
+	if(doclose)
+		{
+		lxt2_wr_zpipe_send(zp, lxt2_wr_zblk_new(LXT2_WR_ZBLK_CLOSE, 0));
+		lxt2_wr_zpipe_drain(zp);	/* callers read file offsets next */
+		}
+
+	return;
+	}
+#endif
+
 if(lt->gzbufpnt)
 	{
 	gzwrite(lt->zhandle, lt->gzdest, lt->gzbufpnt);
@@ -688,7 +1003,7 @@ if((lt)&&(lt->numfacs))
 
 		fflush(lt->handle);
 		lt->zfacname_size = lt->position;
-		lt->zhandle = gzdopen(dup(fileno(lt->handle)), "wb9");
+		lxt2_wr_zsection_open(lt, "wb9");
 
 		lt->zpackcount = 0;
 		for(i=0;i<lt->numfacs;i++)
@@ -706,7 +1021,7 @@ if((lt)&&(lt->numfacs))
 		lt->position=ftello(lt->handle);
 		lt->zfacname_size = lt->position - lt->zfacname_size;
 
-		lt->zhandle = gzdopen(dup(fileno(lt->handle)), "wb9");
+		lxt2_wr_zsection_open(lt, "wb9");
 
 		lt->facgeometry_offset = lt->position;
 		for(i=0;i<lt->numfacs;i++)
@@ -1140,7 +1455,7 @@ if(!lt->timegranule)
 
 	if(!using_partial_zip)
 		{
-		lt->zhandle = gzdopen(dup(fileno(lt->handle)), lt->zmode);
+		lxt2_wr_zsection_open(lt, lt->zmode);
 		}
 		else
 		{
@@ -1222,7 +1537,7 @@ if(using_partial)
 		lxt2_wr_emit_u32(lt, iter);		/* begin iter of section               */
 		fflush(lt->handle);
 	
-		lt->zhandle = gzdopen(dup(fileno(lt->handle)), lt->zmode);
+		lxt2_wr_zsection_open(lt, lt->zmode);
 		lt->zpackcount = 0;
 		}
 
@@ -1332,7 +1647,7 @@ if((lt->timegranule>=lt->maxgranule)||(do_finalize)||(early_flush))
 		lxt2_wr_emit_u32(lt, ~0);		/* control section		       */
 		fflush(lt->handle);
 	
-		lt->zhandle = gzdopen(dup(fileno(lt->handle)), lt->zmode);
+		lxt2_wr_zsection_open(lt, lt->zmode);
 		lt->zpackcount = 0;
 		}
 
@@ -2171,6 +2486,10 @@ if(lt)
 		lt->symchain=NULL;
 		}
 	
+#ifdef LXT2_WR_PARALLEL
+	lxt2_wr_zpipe_shutdown(lt);
+#endif
+
 	free(lt->lxtname);
 	free(lt->sorted_facs);
 	fclose(lt->handle);
@@ -143,6 +143,7 @@ struct lxt2_wr_trace
 {
 FILE *handle;
 gzFile zhandle;
+void *zpipe;				/* opaque compression worker state, see lxt2_write.c */
 
 lxt2_wr_dslxt_Tree *dict;	/* dictionary manipulation */
 unsigned int num_dict_entries;
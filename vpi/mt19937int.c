@@ -80,44 +80,87 @@ sgenrand(struct context_s *context, unsigned long seed)
     context->mti = mti;
 }
 
-unsigned long
-genrand(struct context_s *context)
+/* regenerate the N words of state in place */
+static void
+mt_reload(struct context_s *context)
 {
     unsigned long y;
     static unsigned long mag01[2]={0x0, MATRIX_A};
     /* mag01[x] = x * MATRIX_A  for x=0,1 */
 
     unsigned long *mt = context->mt;
-    int mti = context->mti;
+    int kk;
 
-    if (mti >= N) { /* generate N words at one time */
-        int kk;
+    for (kk=0;kk<N-M;kk++) {
+        y = (mt[kk]&UPPER_MASK)|(mt[kk+1]&LOWER_MASK);
+        mt[kk] = mt[kk+M] ^ (y >> 1) ^ mag01[y & 0x1];
+    }
+    for (;kk<N-1;kk++) {
+        y = (mt[kk]&UPPER_MASK)|(mt[kk+1]&LOWER_MASK);
+        mt[kk] = mt[kk+(M-N)] ^ (y >> 1) ^ mag01[y & 0x1];
+    }
+    y = (mt[N-1]&UPPER_MASK)|(mt[0]&LOWER_MASK);
+    mt[N-1] = mt[M-1] ^ (y >> 1) ^ mag01[y & 0x1];
 
-        if (mti == N+1)   /* if sgenrand() has not been called, */
-            sgenrand(context, 4357); /* a default initial seed is used   */
+    context->mti = 0;
+}
 
-        for (kk=0;kk<N-M;kk++) {
-            y = (mt[kk]&UPPER_MASK)|(mt[kk+1]&LOWER_MASK);
-            mt[kk] = mt[kk+M] ^ (y >> 1) ^ mag01[y & 0x1];
-        }
-        for (;kk<N-1;kk++) {
-            y = (mt[kk]&UPPER_MASK)|(mt[kk+1]&LOWER_MASK);
-            mt[kk] = mt[kk+(M-N)] ^ (y >> 1) ^ mag01[y & 0x1];
-        }
-        y = (mt[N-1]&UPPER_MASK)|(mt[0]&LOWER_MASK);
-        mt[N-1] = mt[M-1] ^ (y >> 1) ^ mag01[y & 0x1];
+unsigned long
+genrand(struct context_s *context)
+{
+    unsigned long y;
+    unsigned long *mt = context->mt;
+
+    if (context->mti >= N) { /* generate N words at one time */
+        if (context->mti == N+1)   /* if sgenrand() has not been called, */
+            sgenrand(context, 4357); /* a default initial seed is used   */
 
-        mti = 0;
+        mt_reload(context);
     }
 
-    y = mt[mti++];
+    y = mt[context->mti++];
     y ^= TEMPERING_SHIFT_U(y);
     y ^= TEMPERING_SHIFT_S(y) & TEMPERING_MASK_B;
     y ^= TEMPERING_SHIFT_T(y) & TEMPERING_MASK_C;
     y ^= TEMPERING_SHIFT_L(y);
 
-    context->mti = mti;
-
     return y;
 }
 
+/* fill dst with cnt pseudorandom values. The values are tempered
+ * straight out of the state array a block at a time, so a large fill
+ * pays for the reload loop once per N words instead of checking the
+ * state on every value. The sequence is identical to calling
+ * genrand() cnt times. */
+void
+genrand_bulk(struct context_s *context, unsigned long *dst, int cnt)
+{
+    unsigned long *mt = context->mt;
+    int idx;
+
+    if (context->mti == N+1)
+        sgenrand(context, 4357);
+
+    while (cnt > 0) {
+        int chunk;
+
+        if (context->mti >= N)
+            mt_reload(context);
+
+        chunk = N - context->mti;
+        if (chunk > cnt)
+            chunk = cnt;
+
+        for (idx = 0; idx < chunk; idx++) {
+            unsigned long y = mt[context->mti + idx];
+            y ^= TEMPERING_SHIFT_U(y);
+            y ^= TEMPERING_SHIFT_S(y) & TEMPERING_MASK_B;
+            y ^= TEMPERING_SHIFT_T(y) & TEMPERING_MASK_C;
+            y ^= TEMPERING_SHIFT_L(y);
+            *dst++ = y;
+        }
+        context->mti += chunk;
+        cnt -= chunk;
+    }
+}
+
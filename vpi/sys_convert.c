@@ -18,6 +18,7 @@
  */
 
 # include  "sys_priv.h"
+# include  <assert.h>
 # include  <stdio.h>
 # include  <string.h>
 # include  <math.h>
@@ -224,6 +225,138 @@ static PLI_INT32 sys_rtoi_calltf(ICARUS_VPI_CONST PLI_BYTE8*user)
     return 0;
 }
 
+/*
+ * Check a $bitstoreal_array/$realtobits_array call. Both arguments
+ * must be arrays of the same length, and the bit-vector side must
+ * have 64-bit words.
+ */
+static PLI_INT32 sys_convert_array_compiletf(ICARUS_VPI_CONST PLI_BYTE8*name)
+{
+    vpiHandle callh = vpi_handle(vpiSysTfCall, 0);
+    vpiHandle argv = vpi_iterate(vpiArgument, callh);
+    vpiHandle dst, src, word_argv, word;
+
+    if (argv == 0) {
+	error_message(callh, "%s requires two array arguments.\n");
+	return 0;
+    }
+
+    dst = vpi_scan(argv);
+    src = vpi_scan(argv);
+    if (src == 0) {
+	error_message(callh, "%s requires two array arguments.\n");
+	return 0;
+    }
+
+    if (vpi_get(vpiType, dst) != vpiMemory ||
+        vpi_get(vpiType, src) != vpiMemory) {
+	error_message(callh, "%s requires two array arguments.\n");
+	return 0;
+    }
+
+    if (vpi_get(vpiSize, dst) != vpi_get(vpiSize, src)) {
+	error_message(callh, "%s requires arrays of equal length.\n");
+	return 0;
+    }
+
+    /* The bit-vector array is the source for $bitstoreal_array and
+       the destination for $realtobits_array. Its words must be the
+       size of a real. */
+    word_argv = vpi_iterate(vpiMemoryWord,
+                            strcmp("$bitstoreal_array", name) ? dst : src);
+    word = word_argv ? vpi_scan(word_argv) : 0;
+    if (word) {
+	if (vpi_get(vpiSize, word) != 64) {
+	    error_message(callh, "%s requires a 64-bit word array.\n");
+	    vpi_free_object(word_argv);
+	    return 0;
+	}
+	vpi_free_object(word_argv);
+    }
+
+    check_for_extra_args(argv, callh, name, "two arguments", 0);
+
+    return 0;
+}
+
+/*
+ * Batch version of $bitstoreal: convert every word of the source
+ * array in a single call. The value format and the result struct are
+ * set up once, outside the word loop, so the per-element work is just
+ * the two vpi value transfers and the byte shuffle.
+ */
+static PLI_INT32 sys_bitstoreal_array_calltf(ICARUS_VPI_CONST PLI_BYTE8*user)
+{
+    vpiHandle callh = vpi_handle(vpiSysTfCall, 0);
+    vpiHandle argv = vpi_iterate(vpiArgument, callh);
+    vpiHandle dst = vpi_scan(argv);
+    vpiHandle src = vpi_scan(argv);
+    vpiHandle dst_argv = vpi_iterate(vpiMemoryWord, dst);
+    vpiHandle src_argv = vpi_iterate(vpiMemoryWord, src);
+    vpiHandle dst_word, src_word;
+    s_vpi_value get_val, put_val;
+    PLI_UINT32 bits[2];
+
+    vpi_free_object(argv);
+
+    get_val.format = vpiVectorVal;
+    put_val.format = vpiRealVal;
+
+    while ((dst_word = vpi_scan(dst_argv)) != 0) {
+	src_word = vpi_scan(src_argv);
+	assert(src_word);
+
+	vpi_get_value(src_word, &get_val);
+	bits[0] = (get_val.value.vector[0]).aval;
+	bits[1] = (get_val.value.vector[1]).aval;
+	put_val.value.real = bits2double(bits);
+	vpi_put_value(dst_word, &put_val, 0, vpiNoDelay);
+    }
+    vpi_free_object(src_argv);
+
+    return 0;
+}
+
+/*
+ * Batch version of $realtobits: convert every word of the source
+ * array in a single call.
+ */
+static PLI_INT32 sys_realtobits_array_calltf(ICARUS_VPI_CONST PLI_BYTE8*user)
+{
+    vpiHandle callh = vpi_handle(vpiSysTfCall, 0);
+    vpiHandle argv = vpi_iterate(vpiArgument, callh);
+    vpiHandle dst = vpi_scan(argv);
+    vpiHandle src = vpi_scan(argv);
+    vpiHandle dst_argv = vpi_iterate(vpiMemoryWord, dst);
+    vpiHandle src_argv = vpi_iterate(vpiMemoryWord, src);
+    vpiHandle dst_word, src_word;
+    s_vpi_value get_val, put_val;
+    struct t_vpi_vecval res[2];
+    PLI_UINT32 bits[2];
+
+    vpi_free_object(argv);
+
+    get_val.format = vpiRealVal;
+    put_val.format = vpiVectorVal;
+    put_val.value.vector = res;
+    res[0].bval = 0;
+    res[1].bval = 0;
+
+    while ((dst_word = vpi_scan(dst_argv)) != 0) {
+	src_word = vpi_scan(src_argv);
+	assert(src_word);
+
+	vpi_get_value(src_word, &get_val);
+	double2bits(get_val.value.real, bits);
+	res[0].aval = bits[0];
+	res[1].aval = bits[1];
+	vpi_put_value(dst_word, &put_val, 0, vpiNoDelay);
+    }
+    vpi_free_object(src_argv);
+
+    return 0;
+}
+
 void sys_convert_register()
 {
       s_vpi_systf_data tf_data;
@@ -264,5 +397,23 @@ void sys_convert_register()
       tf_data.calltf    = sys_rtoi_calltf;
       res = vpi_register_systf(&tf_data);
       vpip_make_systf_system_defined(res);
+
+      tf_data.type      = vpiSysTask;
+      tf_data.user_data = "$bitstoreal_array";
+      tf_data.tfname    = tf_data.user_data;
+      tf_data.sizetf    = 0;
+      tf_data.compiletf = sys_convert_array_compiletf;
+      tf_data.calltf    = sys_bitstoreal_array_calltf;
+      res = vpi_register_systf(&tf_data);
+      vpip_make_systf_system_defined(res);
+
+      tf_data.type      = vpiSysTask;
+      tf_data.user_data = "$realtobits_array";
+      tf_data.tfname    = tf_data.user_data;
+      tf_data.sizetf    = 0;
+      tf_data.compiletf = sys_convert_array_compiletf;
+      tf_data.calltf    = sys_realtobits_array_calltf;
+      res = vpi_register_systf(&tf_data);
+      vpip_make_systf_system_defined(res);
 }
 
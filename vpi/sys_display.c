@@ -179,11 +179,35 @@ static char * format_as_string(int ljust, int plus, int ld_zero, int width,
   return strdup(buf);
 }
 
+/* One-entry cache for get_time(). A log-heavy run formats the same
+ * (time, timescale) pair over and over, so remember the last
+ * conversion. The cache is flushed whenever the timeformat changes. */
+static char time_cache_in[32];
+static char time_cache_out[256];
+static int time_cache_prec;
+static PLI_INT32 time_cache_units;
+static int time_cache_valid = 0;
+
 static void get_time(char *rtn, const char *value, int prec,
                      PLI_INT32 time_units)
 {
   int shift = time_units - timeformat_info.units;
 
+  if (time_cache_valid && prec == time_cache_prec &&
+      time_units == time_cache_units &&
+      strcmp(value, time_cache_in) == 0) {
+    strcpy(rtn, time_cache_out);
+    return;
+  }
+  if (strlen(value) < sizeof(time_cache_in)) {
+    strcpy(time_cache_in, value);
+    time_cache_prec = prec;
+    time_cache_units = time_units;
+    time_cache_valid = -1;  /* Filled below once rtn is complete. */
+  } else {
+    time_cache_valid = 0;
+  }
+
   /* Strip any leading zeros, but leave a single zero. */
   while (value[0] == '0' && value[1] != '\0') value += 1;
   /* We need to scale the number up. */
@@ -244,6 +268,16 @@ static void get_time(char *rtn, const char *value, int prec,
   }
 
   strcat(rtn, timeformat_info.suff);
+
+  /* Complete the cache entry started above. */
+  if (time_cache_valid) {
+    if (strlen(rtn) < sizeof(time_cache_out)) {
+      strcpy(time_cache_out, rtn);
+      time_cache_valid = 1;
+    } else {
+      time_cache_valid = 0;
+    }
+  }
 }
 
 static void get_time_real(char *rtn, double value, int prec,
@@ -505,7 +539,8 @@ static unsigned int get_format_char(char **rtn, int ljust, int plus,
           if (size < 320) size = 320;
           size += prec;
           if (size > ini_size) result = realloc(result, size*sizeof(char));
-          sprintf(result, fmtb+1, value.value.real);
+          if (sys_dtoa_sprintf(result, fmtb+1, value.value.real) < 0)
+                sprintf(result, fmtb+1, value.value.real);
           size = strlen(result) + 1;
         }
       }
@@ -810,19 +845,34 @@ static unsigned int get_format_char(char **rtn, int ljust, int plus,
 
 /* We can't use the normal str functions on the return value since
  * %u and %z can insert NULL characters into the stream. */
+/*
+ * The display engine assembles its output from many small segments,
+ * so growing the result one realloc per segment costs quadratic
+ * copying on long messages. Grow the buffer geometrically instead;
+ * the callers keep tracking the used size themselves because the
+ * output can contain embedded NUL characters (%u and %z).
+ */
+static char *grow_buffer(char *buf, unsigned int *cap, unsigned int need)
+{
+  if (need <= *cap) return buf;
+  while (*cap < need) *cap *= 2;
+  return realloc(buf, *cap * sizeof(char));
+}
+
 static unsigned int get_format(char **rtn, char *fmt,
                                const struct strobe_cb_info *info, unsigned int *idx)
 {
   char *cp = fmt;
-  unsigned int size;
+  unsigned int size, cap;
 
   *rtn = strdup("");
   size = 1;
+  cap = 1;
   while (*cp) {
     size_t cnt = strcspn(cp, "%");
 
     if (cnt > 0) {
-      *rtn = realloc(*rtn, (size+cnt)*sizeof(char));
+      *rtn = grow_buffer(*rtn, &cap, size+cnt);
       memcpy(*rtn+size-1, cp, cnt);
       size += cnt;
       cp += cnt;
@@ -847,7 +897,7 @@ static unsigned int get_format(char **rtn, char *fmt,
       }
       cnt = get_format_char(&result, ljust, plus, ld_zero, width, prec, *cp,
                             info, idx);
-      *rtn = realloc(*rtn, (size+cnt)*sizeof(char));
+      *rtn = grow_buffer(*rtn, &cap, size+cnt);
       memcpy(*rtn+size-1, result, cnt);
       free(result);
       size += cnt;
@@ -892,11 +942,12 @@ static char *get_display(unsigned int *rtnsz, const struct strobe_cb_info *info)
   char *result, *fmt, *rtn, *func_name;
   const char *cresult;
   s_vpi_value value;
-  unsigned int idx, size, width;
+  unsigned int idx, size, cap, width;
   char buf[256];
 
   rtn = strdup("");
   size = 1;
+  cap = 1;
   for  (idx = 0; idx < info->nitems; idx += 1) {
     vpiHandle item = info->items[idx];
 
@@ -913,13 +964,14 @@ static char *get_display(unsigned int *rtnsz, const struct strobe_cb_info *info)
         } else if (vpi_get(vpiConstType, item) == vpiRealConst) {
           value.format = vpiRealVal;
           vpi_get_value(item, &value);
-          sprintf(buf, "%#g", value.value.real);
+          if (sys_dtoa_fmt(buf, 'g', -1, 1, value.value.real) < 0)
+                sprintf(buf, "%#g", value.value.real);
           result = strdup(buf);
           width = strlen(result);
         } else {
           width = get_numeric(&result, info, item);
         }
-        rtn = realloc(rtn, (size+width)*sizeof(char));
+        rtn = grow_buffer(rtn, &cap, size+width);
         memcpy(rtn+size-1, result, width);
         free(result);
         break;
@@ -935,7 +987,7 @@ static char *get_display(unsigned int *rtnsz, const struct strobe_cb_info *info)
       case vpiMemoryWord:
       case vpiPartSelect:
         width = get_numeric(&result, info, item);
-        rtn = realloc(rtn, (size+width)*sizeof(char));
+        rtn = grow_buffer(rtn, &cap, size+width);
         memcpy(rtn+size-1, result, width);
         free(result);
         break;
@@ -950,7 +1002,7 @@ static char *get_display(unsigned int *rtnsz, const struct strobe_cb_info *info)
                  vpi_get(vpiTimeUnit, info->scope));
         width = strlen(buf);
         if (width  < timeformat_info.width) width = timeformat_info.width;
-        rtn = realloc(rtn, (size+width)*sizeof(char));
+        rtn = grow_buffer(rtn, &cap, size+width);
         sprintf(rtn+size-1, "%*s", width, buf);
         break;
 
@@ -958,9 +1010,10 @@ static char *get_display(unsigned int *rtnsz, const struct strobe_cb_info *info)
       case vpiRealVar:
         value.format = vpiRealVal;
         vpi_get_value(item, &value);
-        sprintf(buf, "%#g", value.value.real);
+        if (sys_dtoa_fmt(buf, 'g', -1, 1, value.value.real) < 0)
+              sprintf(buf, "%#g", value.value.real);
         width = strlen(buf);
-        rtn = realloc(rtn, (size+width)*sizeof(char));
+        rtn = grow_buffer(rtn, &cap, size+width);
         memcpy(rtn+size-1, buf, width);
         break;
 
@@ -972,7 +1025,7 @@ static char *get_display(unsigned int *rtnsz, const struct strobe_cb_info *info)
 	fmt = strdup(value.value.str);
 	width = get_format(&result, fmt, info, &idx);
 	free(fmt);
-        rtn = realloc(rtn, (size+width)*sizeof(char));
+        rtn = grow_buffer(rtn, &cap, size+width);
         memcpy(rtn+size-1, result, width);
         free(result);
 	break;
@@ -984,7 +1037,7 @@ static char *get_display(unsigned int *rtnsz, const struct strobe_cb_info *info)
           vpi_get_value(item, &value);
           width = strlen(value.value.str);
           if (width  < 20) width = 20;
-          rtn = realloc(rtn, (size+width)*sizeof(char));
+          rtn = grow_buffer(rtn, &cap, size+width);
           sprintf(rtn+size-1, "%*s", width, value.value.str);
 
         } else if (strcmp(func_name, "$stime") == 0) {
@@ -992,7 +1045,7 @@ static char *get_display(unsigned int *rtnsz, const struct strobe_cb_info *info)
           vpi_get_value(item, &value);
           width = strlen(value.value.str);
           if (width  < 10) width = 10;
-          rtn = realloc(rtn, (size+width)*sizeof(char));
+          rtn = grow_buffer(rtn, &cap, size+width);
           sprintf(rtn+size-1, "%*s", width, value.value.str);
 
         } else if (strcmp(func_name, "$simtime") == 0) {
@@ -1000,7 +1053,7 @@ static char *get_display(unsigned int *rtnsz, const struct strobe_cb_info *info)
           vpi_get_value(item, &value);
           width = strlen(value.value.str);
           if (width  < 20) width = 20;
-          rtn = realloc(rtn, (size+width)*sizeof(char));
+          rtn = grow_buffer(rtn, &cap, size+width);
           sprintf(rtn+size-1, "%*s", width, value.value.str);
 
         } else if (strcmp(func_name, "$realtime") == 0) {
@@ -1010,9 +1063,10 @@ static char *get_display(unsigned int *rtnsz, const struct strobe_cb_info *info)
           assert(use_prec >= 0);
           value.format = vpiRealVal;
           vpi_get_value(item, &value);
-          sprintf(buf, "%.*f", use_prec, value.value.real);
+          if (sys_dtoa_fmt(buf, 'f', use_prec, 0, value.value.real) < 0)
+                sprintf(buf, "%.*f", use_prec, value.value.real);
           width = strlen(buf);
-          rtn = realloc(rtn, (size+width)*sizeof(char));
+          rtn = grow_buffer(rtn, &cap, size+width);
           sprintf(rtn+size-1, "%*s", width, buf);
 
         } else {
@@ -1020,7 +1074,7 @@ static char *get_display(unsigned int *rtnsz, const struct strobe_cb_info *info)
                      info->filename, info->lineno, info->name, func_name);
           strcpy(buf, "<?>");
           width = strlen(buf);
-          rtn = realloc(rtn, (size+width)*sizeof(char));
+          rtn = grow_buffer(rtn, &cap, size+width);
           memcpy(rtn+size-1, buf, width);
         }
         break;
@@ -1031,7 +1085,7 @@ static char *get_display(unsigned int *rtnsz, const struct strobe_cb_info *info)
                    info->name);
         cresult = "<?>";
         width = strlen(cresult);
-        rtn = realloc(rtn, (size+width)*sizeof(char));
+        rtn = grow_buffer(rtn, &cap, size+width);
         memcpy(rtn+size-1, cresult, width);
         break;
     }
@@ -1377,14 +1431,166 @@ static vpiHandle *monitor_callbacks = 0;
 static int monitor_scheduled = 0;
 static int monitor_enabled = 1;
 
-static PLI_INT32 monitor_cb_2(p_cb_data cb)
+/*
+ * To avoid re-formatting the whole argument list every time any one
+ * operand changes, the argument list is split into segments: a format
+ * string plus the operands it consumes, or a single stand-alone
+ * operand. Each segment keeps its last rendered text, and only the
+ * segments holding a changed operand are re-rendered. Segments with
+ * an operand that has no value change callback (system function
+ * calls like $time) or that use %t (whose rendering can be changed
+ * by a later $timeformat) are re-rendered on every wakeup.
+ */
+static unsigned monitor_nsegs = 0;
+static unsigned *monitor_seg_start = 0;
+static unsigned *monitor_seg_len = 0;
+static char *monitor_seg_volatile = 0;
+static char *monitor_seg_dirty = 0;
+static char **monitor_seg_text = 0;
+static unsigned int *monitor_seg_size = 0;
+static unsigned *monitor_item_seg = 0;
+static int monitor_incremental = 0;
+
+/*
+ * Count the operands a format string will consume, mirroring the
+ * conversions that get_format_char() takes an argument for. Also
+ * note if the string uses %t, since that rendering depends on the
+ * current $timeformat settings.
+ */
+static unsigned monitor_format_consumes(const char*fmt, int*uses_t)
 {
-      char* result;
-      unsigned int size, location=0;
+      unsigned count = 0;
+      const char*cp = fmt;
+      *uses_t = 0;
+      while ((cp = strchr(cp, '%'))) {
+	    cp += 1;
+	    while ((*cp == '-') || (*cp == '+')) cp += 1;
+	    if (*cp == '0') cp += 1;
+	    while (isdigit((int)*cp)) cp += 1;
+	    if (*cp == '.') {
+		  cp += 1;
+		  while (isdigit((int)*cp)) cp += 1;
+	    }
+	    switch (*cp) {
+		case 'b': case 'B': case 'o': case 'O':
+		case 'h': case 'H': case 'x': case 'X':
+		case 'c': case 'C': case 'd': case 'D':
+		case 'e': case 'E': case 'f': case 'F':
+		case 'g': case 'G': case 's': case 'S':
+		case 'u': case 'U': case 'v': case 'V':
+		case 'z': case 'Z':
+		  count += 1;
+		  break;
+		case 't': case 'T':
+		  count += 1;
+		  *uses_t = 1;
+		  break;
+		default:
+		  break;
+	    }
+	    if (*cp) cp += 1;
+      }
+      return count;
+}
 
-	/* Because %u and %z may put embedded NULL characters into the
-	 * returned string strlen() may not match the real size! */
-      result = get_display(&size, &monitor_info);
+static void monitor_free_segments(void)
+{
+      unsigned idx;
+
+      if (monitor_seg_text) {
+	    for (idx = 0 ;  idx < monitor_nsegs ;  idx += 1)
+		  free(monitor_seg_text[idx]);
+      }
+      free(monitor_seg_start);
+      free(monitor_seg_len);
+      free(monitor_seg_volatile);
+      free(monitor_seg_dirty);
+      free(monitor_seg_text);
+      free(monitor_seg_size);
+      free(monitor_item_seg);
+      monitor_seg_start = 0;
+      monitor_seg_len = 0;
+      monitor_seg_volatile = 0;
+      monitor_seg_dirty = 0;
+      monitor_seg_text = 0;
+      monitor_seg_size = 0;
+      monitor_item_seg = 0;
+      monitor_nsegs = 0;
+      monitor_incremental = 0;
+}
+
+static void monitor_build_segments(void)
+{
+      unsigned idx, jdx, seg;
+      unsigned nitems = monitor_info.nitems;
+      s_vpi_value value;
+
+      monitor_incremental = (nitems > 0);
+      if (! monitor_incremental) return;
+
+      monitor_seg_start = calloc(nitems, sizeof(unsigned));
+      monitor_seg_len = calloc(nitems, sizeof(unsigned));
+      monitor_seg_volatile = calloc(nitems, sizeof(char));
+      monitor_item_seg = calloc(nitems, sizeof(unsigned));
+
+      seg = 0;
+      idx = 0;
+      while (idx < nitems) {
+	    unsigned len = 1;
+	    int vol = 0;
+	    PLI_INT32 item_type = vpi_get(vpiType, monitor_info.items[idx]);
+
+	    if ((item_type == vpiConstant || item_type == vpiParameter)
+		&& vpi_get(vpiConstType, monitor_info.items[idx])
+		   == vpiStringConst) {
+		  int uses_t = 0;
+		  value.format = vpiStringVal;
+		  vpi_get_value(monitor_info.items[idx], &value);
+		  len += monitor_format_consumes(value.value.str, &uses_t);
+		  if (len > nitems - idx) len = nitems - idx;
+		  if (uses_t) vol = 1;
+	    } else if (item_type == vpiStringVar) {
+		    /* A string variable is interpreted as a format
+		       string at display time and may change, so the
+		       segment boundaries are not stable. Fall back
+		       to full re-rendering. */
+		  monitor_free_segments();
+		  return;
+	    }
+
+	      /* Operands that did not get a value change callback
+	         (and are not constants) can change without marking
+	         their segment, so always re-render those. */
+	    for (jdx = idx ;  jdx < idx+len ;  jdx += 1) {
+		  PLI_INT32 jtype;
+		  if (monitor_callbacks[jdx]) continue;
+		  jtype = vpi_get(vpiType, monitor_info.items[jdx]);
+		  if (jtype == vpiConstant || jtype == vpiParameter)
+			continue;
+		  vol = 1;
+	    }
+
+	    monitor_seg_start[seg] = idx;
+	    monitor_seg_len[seg] = len;
+	    monitor_seg_volatile[seg] = vol;
+	    for (jdx = idx ;  jdx < idx+len ;  jdx += 1)
+		  monitor_item_seg[jdx] = seg;
+	    seg += 1;
+	    idx += len;
+      }
+      monitor_nsegs = seg;
+
+      monitor_seg_dirty = malloc(seg*sizeof(char));
+      memset(monitor_seg_dirty, 1, seg*sizeof(char));
+      monitor_seg_text = calloc(seg, sizeof(char*));
+      monitor_seg_size = calloc(seg, sizeof(unsigned int));
+}
+
+/* Emit rendered text, stepping over the embedded NULL characters
+ * that %u and %z may leave in the buffer. */
+static void monitor_emit(const char*result, unsigned int size)
+{
+      unsigned int location = 0;
       while (location < size) {
 	    if (result[location] == '\0') {
 		  my_mcd_printf(monitor_info.fd_mcd, "%c", '\0');
@@ -1394,6 +1600,42 @@ static PLI_INT32 monitor_cb_2(p_cb_data cb)
 		  location += strlen(&result[location]);
 	    }
       }
+}
+
+static PLI_INT32 monitor_cb_2(p_cb_data cb)
+{
+      char* result;
+      unsigned int size;
+
+      if (monitor_incremental) {
+	    unsigned seg;
+	      /* Re-render only the segments that changed, then emit
+	         the line from the cached pieces. */
+	    for (seg = 0 ;  seg < monitor_nsegs ;  seg += 1) {
+		  struct strobe_cb_info seg_info;
+		  if (monitor_seg_text[seg] && !monitor_seg_dirty[seg]
+		      && !monitor_seg_volatile[seg]) continue;
+		  seg_info = monitor_info;
+		  seg_info.items = monitor_info.items
+		                 + monitor_seg_start[seg];
+		  seg_info.nitems = monitor_seg_len[seg];
+		  free(monitor_seg_text[seg]);
+		  monitor_seg_text[seg] = get_display(&monitor_seg_size[seg],
+		                                      &seg_info);
+		  monitor_seg_dirty[seg] = 0;
+	    }
+	    for (seg = 0 ;  seg < monitor_nsegs ;  seg += 1)
+		  monitor_emit(monitor_seg_text[seg],
+		               monitor_seg_size[seg]);
+	    my_mcd_printf(monitor_info.fd_mcd, "\n");
+	    monitor_scheduled = 0;
+	    return 0;
+      }
+
+	/* Because %u and %z may put embedded NULL characters into the
+	 * returned string strlen() may not match the real size! */
+      result = get_display(&size, &monitor_info);
+      monitor_emit(result, size);
       my_mcd_printf(monitor_info.fd_mcd, "\n");
       monitor_scheduled = 0;
       free(result);
@@ -1411,6 +1653,18 @@ static PLI_INT32 monitor_cb_1(p_cb_data cause)
       struct t_cb_data cb;
       struct t_vpi_time timerec;
 
+	/* The callback user_data is the address of this callback's
+	   slot in monitor_callbacks, which identifies the argument
+	   that changed. Mark its segment for re-rendering. This must
+	   happen even when a strobe is already scheduled or the
+	   monitor is disabled. */
+      if (monitor_incremental && cause && cause->user_data) {
+	    unsigned item = (vpiHandle*)cause->user_data
+	                  - monitor_callbacks;
+	    if (item < monitor_info.nitems)
+		  monitor_seg_dirty[monitor_item_seg[item]] = 1;
+      }
+
       if (monitor_enabled == 0) return 0;
       if (monitor_scheduled) return 0;
 
@@ -1461,6 +1715,8 @@ static PLI_INT32 sys_monitor_calltf(ICARUS_VPI_CONST PLI_BYTE8*name)
 	    free(monitor_callbacks);
 	    monitor_callbacks = 0;
 
+	    monitor_free_segments();
+
 	    free(monitor_info.filename);
 	    free(monitor_info.items);
 	    monitor_info.items = 0;
@@ -1518,6 +1774,9 @@ static PLI_INT32 sys_monitor_calltf(ICARUS_VPI_CONST PLI_BYTE8*name)
 	    }
       }
 
+	/* Work out which arguments can be rendered incrementally. */
+      monitor_build_segments();
+
 	/* When the $monitor is called, it schedules a first display
 	   for the end of the current time, like a $strobe. */
       monitor_cb_1(0);
@@ -1528,6 +1787,10 @@ static PLI_INT32 sys_monitor_calltf(ICARUS_VPI_CONST PLI_BYTE8*name)
 static PLI_INT32 sys_monitoron_calltf(ICARUS_VPI_CONST PLI_BYTE8*name)
 {
       monitor_enabled = 1;
+	/* Changes may have been missed while the monitor was off,
+	   so refresh every cached segment. */
+      if (monitor_incremental)
+	    memset(monitor_seg_dirty, 1, monitor_nsegs*sizeof(char));
       monitor_cb_1(0);
       return 0;
 }
@@ -1712,6 +1975,7 @@ static PLI_INT32 sys_end_of_compile(p_cb_data cb_data)
       timeformat_info.units = vpi_get(vpiTimePrecision, 0);
       timeformat_info.prec  = 0;
       timeformat_info.width = 20;
+      time_cache_valid = 0;
       return 0;
 }
 
@@ -1821,6 +2085,9 @@ static PLI_INT32 sys_timeformat_calltf(ICARUS_VPI_CONST PLI_BYTE8*xx)
             value.format = vpiIntVal;
             vpi_get_value(wid, &value);
             timeformat_info.width = value.value.integer;
+
+            /* The cached %t conversion is stale now. */
+            time_cache_valid = 0;
       } else {
             /* If no arguments are given then use the default values. */
             sys_end_of_compile(NULL);
@@ -0,0 +1,584 @@
+/*
+ * Copyright (c) 2012 Stephen Williams (steve@icarus.com)
+ *
+ *    This source code is free software; you can redistribute it
+ *    and/or modify it in source code form under the terms of the GNU
+ *    General Public License as published by the Free Software
+ *    Foundation; either version 2 of the License, or (at your option)
+ *    any later version.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this program; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Fast formatting of real values for $display and friends. The libc
+ * sprintf("%g") path dominates the cost of logs that print large
+ * volumes of reals, so this implements the common %g/%e/%f cases
+ * directly, in the style of the Grisu fixed-precision algorithms:
+ * the value is multiplied by a 128-bit approximation of the right
+ * power of ten and the decimal digits are read out of the product.
+ *
+ * The approximation carries far more precision than the digits we
+ * emit, so the rounding of the last digit is almost always certain.
+ * When it is not certain (the true value is too close to a rounding
+ * boundary, which includes all exact decimal ties), the functions
+ * return -1 and the caller falls back to sprintf, so the output is
+ * always bit for bit what sprintf would have produced.
+ *
+ * The power of ten table is computed once, on first use, with plain
+ * 32-bit limb arithmetic. This avoids carrying a page of magic
+ * constants here, and the one-time cost is trivial.
+ */
+
+# include "sys_priv.h"
+# include <stdio.h>
+# include <string.h>
+# include <stdint.h>
+
+/*
+ * Powers of ten, normalized: 10^k = M * 2^e2 with M a 128-bit
+ * significand in [2^127, 2^128), correctly rounded to a few ulp.
+ * The range covers every exponent a double can need.
+ */
+#define POW10_MIN (-344)
+#define POW10_MAX 330
+
+struct pow10_entry {
+      uint64_t hi;
+      uint64_t lo;
+      int e2;
+};
+
+static struct pow10_entry pow10_table[POW10_MAX - POW10_MIN + 1];
+static int pow10_ready = 0;
+
+/*
+ * The table is built by stepping from 10^0 = 2^127 * 2^-127 up and
+ * down, one decade at a time, on a 128-bit significand held as four
+ * 32-bit limbs (least significant first). Each step rounds to
+ * nearest, so entry k is in error by at most |k| ulp, which is a
+ * relative error under 2^-119 -- far below what the digit generator
+ * needs.
+ */
+static void sig_mul10_(uint32_t*w, int*e2)
+{
+      uint64_t acc = 0;
+      uint32_t extra, drop;
+      int sh, idx;
+
+      for (idx = 0 ; idx < 4 ; idx += 1) {
+	    acc += (uint64_t)w[idx] * 10;
+	    w[idx] = (uint32_t)acc;
+	    acc >>= 32;
+      }
+      extra = (uint32_t)acc;
+
+	/* Shift the overflow back in, rounding to nearest. */
+      sh = 0;
+      while ((extra >> sh) != 0) sh += 1;
+
+      drop = w[0] & ((1u << sh) - 1);
+      for (idx = 0 ; idx < 3 ; idx += 1)
+	    w[idx] = (w[idx] >> sh) | (w[idx+1] << (32-sh));
+      w[3] = (w[3] >> sh) | (extra << (32-sh));
+      *e2 += sh;
+
+      if (drop >> (sh-1)) {
+	    for (idx = 0 ; idx < 4 ; idx += 1) {
+		  w[idx] += 1;
+		  if (w[idx] != 0) break;
+	    }
+	    if (idx == 4) {
+		    /* Carried all the way out: result is 2^128. */
+		  w[3] = 0x80000000u;
+		  *e2 += 1;
+	    }
+      }
+}
+
+static void sig_div10_(uint32_t*w, int*e2)
+{
+      uint32_t top;
+      uint64_t cur;
+      uint32_t rem = 0;
+      int idx;
+
+	/* Shift left 4 bits first so the quotient keeps 128 bits. */
+      top = w[3] >> 28;
+      for (idx = 3 ; idx > 0 ; idx -= 1)
+	    w[idx] = (w[idx] << 4) | (w[idx-1] >> 28);
+      w[0] <<= 4;
+      *e2 -= 4;
+
+	/* Long division of the 132-bit value by 10. */
+      cur = top;
+      rem = (uint32_t)(cur % 10);
+      top = (uint32_t)(cur / 10);
+      for (idx = 3 ; idx >= 0 ; idx -= 1) {
+	    cur = ((uint64_t)rem << 32) | w[idx];
+	    w[idx] = (uint32_t)(cur / 10);
+	    rem = (uint32_t)(cur % 10);
+      }
+
+	/* The quotient may have overflowed into bit 128. */
+      if (top) {
+	    uint32_t drop = w[0] & 1;
+	    for (idx = 0 ; idx < 3 ; idx += 1)
+		  w[idx] = (w[idx] >> 1) | (w[idx+1] << 31);
+	    w[3] = (w[3] >> 1) | (top << 31);
+	    *e2 += 1;
+	    rem = rem + (drop? 5 : 0); /* fold the dropped bit in */
+      }
+      if (rem >= 5) {
+	    for (idx = 0 ; idx < 4 ; idx += 1) {
+		  w[idx] += 1;
+		  if (w[idx] != 0) break;
+	    }
+	    if (idx == 4) {
+		  w[3] = 0x80000000u;
+		  *e2 += 1;
+	    }
+      }
+}
+
+static void pow10_init_(void)
+{
+      uint32_t w[4];
+      int e2, k;
+
+	/* 10^0 */
+      w[0] = 0; w[1] = 0; w[2] = 0; w[3] = 0x80000000u;
+      e2 = -127;
+      pow10_table[0 - POW10_MIN].hi = ((uint64_t)w[3] << 32) | w[2];
+      pow10_table[0 - POW10_MIN].lo = ((uint64_t)w[1] << 32) | w[0];
+      pow10_table[0 - POW10_MIN].e2 = e2;
+
+      for (k = 1 ; k <= POW10_MAX ; k += 1) {
+	    sig_mul10_(w, &e2);
+	    pow10_table[k - POW10_MIN].hi = ((uint64_t)w[3] << 32) | w[2];
+	    pow10_table[k - POW10_MIN].lo = ((uint64_t)w[1] << 32) | w[0];
+	    pow10_table[k - POW10_MIN].e2 = e2;
+      }
+
+      w[0] = 0; w[1] = 0; w[2] = 0; w[3] = 0x80000000u;
+      e2 = -127;
+      for (k = -1 ; k >= POW10_MIN ; k -= 1) {
+	    sig_div10_(w, &e2);
+	    pow10_table[k - POW10_MIN].hi = ((uint64_t)w[3] << 32) | w[2];
+	    pow10_table[k - POW10_MIN].lo = ((uint64_t)w[1] << 32) | w[0];
+	    pow10_table[k - POW10_MIN].e2 = e2;
+      }
+
+      pow10_ready = 1;
+}
+
+/*
+ * Emit the printf exponent suffix: e+06, E-308, ... with a sign and
+ * at least two digits. Returns the advanced output pointer.
+ */
+static char* put_exponent_(char*cp, char econv, int exp)
+{
+      *cp++ = econv;
+      if (exp < 0) {
+	    *cp++ = '-';
+	    exp = -exp;
+      } else {
+	    *cp++ = '+';
+      }
+      if (exp >= 100) {
+	    *cp++ = (char)('0' + exp/100);
+	    exp %= 100;
+      }
+      *cp++ = (char)('0' + exp/10);
+      *cp++ = (char)('0' + exp%10);
+      return cp;
+}
+
+static void mul_64x64_(uint64_t a, uint64_t b, uint64_t*hi, uint64_t*lo)
+{
+      uint64_t a0 = a & 0xffffffffu, a1 = a >> 32;
+      uint64_t b0 = b & 0xffffffffu, b1 = b >> 32;
+      uint64_t t, w0, w1, w2;
+
+      t = a0 * b0;
+      w0 = t & 0xffffffffu;
+      t = a1 * b0 + (t >> 32);
+      w1 = t & 0xffffffffu;
+      w2 = t >> 32;
+      t = a0 * b1 + w1;
+      *lo = (t << 32) | w0;
+      *hi = a1 * b1 + w2 + (t >> 32);
+}
+
+/*
+ * The digit generator proper. Write the first ndig correctly rounded
+ * significant decimal digits of the finite, positive val into the
+ * digits buffer (as characters, no terminator), and set dec_exp so
+ * that val ~ d.ddd * 10^(*dec_exp). Returns 0 on success, 1 if the
+ * rounding carried all the way up a decade (the digits are then
+ * 1000...), or -1 if the rounding of the last digit cannot be
+ * decided. ndig must be in [1,17].
+ */
+static int dtoa_digits_(double val, int ndig, char*digits, int*dec_exp)
+{
+      uint64_t bits, mant;
+      uint64_t f_hi, f_lo; /* fraction, as a 128-bit binary fraction */
+      uint64_t p2, p1, p0, t_hi, t_lo;
+      uint64_t half, eps;
+      int e, be, p, dexp, sh, tries, idx, digit;
+      int carried = 0;
+      const struct pow10_entry*pow;
+
+      memcpy(&bits, &val, sizeof bits);
+      be = (int)((bits >> 52) & 0x7ff);
+      mant = bits & (((uint64_t)1 << 52) - 1);
+
+      if (be == 0) {
+	    e = -1074;
+      } else {
+	    mant |= (uint64_t)1 << 52;
+	    e = be - 1075;
+      }
+
+	/* Normalize the mantissa to 64 bits. */
+      while ((mant >> 63) == 0) {
+	    mant <<= 1;
+	    e -= 1;
+      }
+
+	/* First estimate of the decimal exponent, from the binary
+	   magnitude. The digit loop below corrects an off-by-one. */
+      p = e + 63;
+      if (p >= 0) dexp = (int)(((int64_t)p * 30103) / 100000);
+      else dexp = -(int)((((int64_t)-p * 30103) + 99999) / 100000);
+
+      for (tries = 0 ; tries < 3 ; tries += 1) {
+	    int k = -dexp;
+	    int ipart;
+
+	    if (k < POW10_MIN || k > POW10_MAX)
+		  return -1;
+	    pow = pow10_table + (k - POW10_MIN);
+
+	      /* 192-bit product: mant * 10^-dexp, as p2:p1:p0
+		 scaled by 2^(e + pow->e2). */
+	    mul_64x64_(mant, pow->hi, &p2, &p1);
+	    mul_64x64_(mant, pow->lo, &t_hi, &t_lo);
+	    p0 = t_lo;
+	    p1 += t_hi;
+	    if (p1 < t_hi) p2 += 1;
+
+	      /* The value is (p2:p1:p0) * 2^(e + pow->e2). Shift so
+		 the integer part lands in ipart and the top 128
+		 fraction bits land in f_hi:f_lo. */
+	    sh = -(e + pow->e2) - 128;
+	    if (sh >= 64) {
+		    /* Integer part is zero; the estimate was high. */
+		  dexp -= 1;
+		  continue;
+	    }
+	    if (sh <= 0) {
+		  dexp += 1;
+		  continue;
+	    }
+
+	    ipart = (int)(p2 >> sh);
+	    f_hi = (p2 << (64-sh)) | (p1 >> sh);
+	    f_lo = (p1 << (64-sh)) | (p0 >> sh);
+	      /* Dropped low bits of p0 are covered by eps below. */
+
+	    if (ipart == 0) {
+		  dexp -= 1;
+		  continue;
+	    }
+	    if (ipart >= 10) {
+		  dexp += 1;
+		  continue;
+	    }
+
+	    digits[0] = (char)('0' + ipart);
+	    for (idx = 1 ; idx < ndig ; idx += 1) {
+		    /* fraction *= 10; the overflow is the digit. */
+		  uint64_t h8, l8, h2, l2, t, c;
+		  l8 = f_lo << 3;
+		  h8 = (f_hi << 3) | (f_lo >> 61);
+		  c = f_hi >> 61;
+		  l2 = f_lo << 1;
+		  h2 = (f_hi << 1) | (f_lo >> 63);
+		  c += f_hi >> 63;
+		  f_lo = l8 + l2;
+		    /* Sum the high halves with a real add-with-carry:
+		       either add can wrap, and a wrap that lands back
+		       exactly on h8 must still carry out. */
+		  t = h8 + h2;
+		  c += (t < h8);
+		  f_hi = t + (f_lo < l8);
+		  c += (f_hi < t);
+		  digit = (int)c;
+		  digits[idx] = (char)('0' + digit);
+	    }
+
+	      /* Round the last digit by the remaining fraction. The
+		 margin covers the table error, the dropped product
+		 bits, and their growth through the digit loop; if
+		 the fraction is within the margin of one half, the
+		 decision is not safe and the caller must fall back
+		 to sprintf. */
+	    half = (uint64_t)1 << 63;
+	    eps = (uint64_t)1 << 8; /* 2^72 / 2^64: margin in f_hi units */
+	    if (f_hi > half + eps || (f_hi == half + eps && f_lo != 0)) {
+		    /* Round up, with carry. */
+		  for (idx = ndig-1 ; idx >= 0 ; idx -= 1) {
+			if (digits[idx] != '9') {
+			      digits[idx] += 1;
+			      break;
+			}
+			digits[idx] = '0';
+		  }
+		  if (idx < 0) {
+			digits[0] = '1';
+			dexp += 1;
+			carried = 1;
+		  }
+	    } else if (f_hi >= half - eps) {
+		  return -1;
+	    }
+
+	    *dec_exp = dexp;
+	    return carried;
+      }
+
+      return -1;
+}
+
+/*
+ * Assemble the rounded digit string into buf following the printf
+ * conversion rules for conv ('e', 'f' or 'g' and their upper case
+ * forms), precision prec (-1 means unspecified) and the '#' flag.
+ * Returns the length written, or -1 if this case is not handled and
+ * the caller must use sprintf.
+ */
+int sys_dtoa_fmt(char*buf, char conv, int prec, int alt, double val)
+{
+      char digits[20];
+      char*cp = buf;
+      uint64_t bits;
+      int dexp = 0, ndig, idx, zero_flag;
+      char econv = (conv == 'E' || conv == 'F' || conv == 'G')? 'E' : 'e';
+
+      if (! pow10_ready)
+	    pow10_init_();
+
+      memcpy(&bits, &val, sizeof bits);
+      if (((bits >> 52) & 0x7ff) == 0x7ff)
+	    return -1; /* Inf and NaN: let sprintf spell them. */
+
+      zero_flag = (bits & ~((uint64_t)1 << 63)) == 0;
+
+      if (conv == 'g' || conv == 'G') {
+	    int P = (prec < 0)? 6 : (prec == 0)? 1 : prec;
+	    int X;
+
+	    if (P > 17)
+		  return -1;
+
+	    if (zero_flag) {
+		  memset(digits, '0', P);
+		  X = 0;
+	    } else {
+		  int rc = dtoa_digits_(val, P, digits, &dexp);
+		  if (rc < 0)
+			return -1;
+		    /* With '#', glibc pads a carried-up result
+		       oddly; leave those to sprintf. */
+		  if (rc == 1 && alt)
+			return -1;
+		  X = dexp;
+	    }
+
+	    if (bits >> 63)
+		  *cp++ = '-';
+
+	    if (X < -4 || X >= P) {
+		    /* e style, P-1 fraction digits. */
+		  ndig = P;
+		  if (! alt) {
+			while (ndig > 1 && digits[ndig-1] == '0')
+			      ndig -= 1;
+		  }
+		  *cp++ = digits[0];
+		  if (ndig > 1 || alt) {
+			*cp++ = '.';
+			for (idx = 1 ; idx < ndig ; idx += 1)
+			      *cp++ = digits[idx];
+		  }
+		  cp = put_exponent_(cp, econv, X);
+	    } else {
+		    /* f style, P-1-X fraction digits. */
+		  ndig = P;
+		  if (! alt) {
+			while (ndig > X+1 && ndig > 1 && digits[ndig-1] == '0')
+			      ndig -= 1;
+		  }
+		  if (X < 0) {
+			*cp++ = '0';
+			*cp++ = '.';
+			for (idx = -1 ; idx > X ; idx -= 1)
+			      *cp++ = '0';
+			for (idx = 0 ; idx < ndig ; idx += 1)
+			      *cp++ = digits[idx];
+		  } else {
+			for (idx = 0 ; idx <= X ; idx += 1)
+			      *cp++ = digits[idx];
+			if (ndig > X+1 || alt) {
+			      *cp++ = '.';
+			      for (idx = X+1 ; idx < ndig ; idx += 1)
+				    *cp++ = digits[idx];
+			}
+		  }
+	    }
+	    *cp = 0;
+	    return (int)(cp - buf);
+      }
+
+      if (conv == 'e' || conv == 'E') {
+	    int P = (prec < 0)? 6 : prec;
+
+	    if (P + 1 > 17)
+		  return -1;
+
+	    if (zero_flag) {
+		  memset(digits, '0', P + 1);
+	    } else {
+		  if (dtoa_digits_(val, P + 1, digits, &dexp) < 0)
+			return -1;
+	    }
+
+	    if (bits >> 63)
+		  *cp++ = '-';
+	    *cp++ = digits[0];
+	    if (P > 0 || alt) {
+		  *cp++ = '.';
+		  for (idx = 1 ; idx <= P ; idx += 1)
+			*cp++ = digits[idx];
+	    }
+	    cp = put_exponent_(cp, econv, zero_flag? 0 : dexp);
+	    *cp = 0;
+	    return (int)(cp - buf);
+      }
+
+      if (conv == 'f' || conv == 'F') {
+	    int P = (prec < 0)? 6 : prec;
+
+	    if (zero_flag) {
+		  if (bits >> 63)
+			*cp++ = '-';
+		  *cp++ = '0';
+		  if (P > 0 || alt) {
+			*cp++ = '.';
+			for (idx = 0 ; idx < P ; idx += 1)
+			      *cp++ = '0';
+		  }
+		  *cp = 0;
+		  return (int)(cp - buf);
+	    }
+
+	      /* The digit count needed depends on the magnitude, so
+		 probe with one digit first. Stay within what the
+		 generator can produce, and let values that round to
+		 or near zero fall back (their rounding is all
+		 boundary cases). */
+	    if (dtoa_digits_(val, 1, digits, &dexp) < 0)
+		  return -1;
+	    ndig = dexp + 1 + P;
+	    if (ndig < 1 || ndig > 17)
+		  return -1;
+	    if (dtoa_digits_(val, ndig, digits, &dexp) < 0)
+		  return -1;
+	    if (dexp + 1 + P < ndig) {
+		    /* The one digit probe had rounded the magnitude
+		       up a decade; regenerate at the right length. */
+		  ndig = dexp + 1 + P;
+		  if (ndig < 1)
+			return -1;
+		  if (dtoa_digits_(val, ndig, digits, &dexp) < 0)
+			return -1;
+	    }
+	      /* If rounding itself carried up a decade, the stored
+		 digits are 1000...; digits past ndig print as 0. */
+
+	    if (bits >> 63)
+		  *cp++ = '-';
+	    if (dexp < 0) {
+		  *cp++ = '0';
+	    } else {
+		  for (idx = 0 ; idx <= dexp ; idx += 1)
+			*cp++ = (idx < ndig)? digits[idx] : '0';
+	    }
+	    if (P > 0 || alt) {
+		  *cp++ = '.';
+		  for (idx = dexp + 1 ; idx < dexp + 1 + P ; idx += 1) {
+			if (idx < 0 || idx >= ndig)
+			      *cp++ = '0';
+			else
+			      *cp++ = digits[idx];
+		  }
+	    }
+	    *cp = 0;
+	    return (int)(cp - buf);
+      }
+
+      return -1;
+}
+
+/*
+ * Parse the simple format strings that $display uses for reals
+ * ("%g", "%#g", "%.12g", "%e", ...) and format through the fast
+ * path. Width, left adjust and the other flags are rare on reals,
+ * and those cases return -1 so the caller runs sprintf instead.
+ */
+int sys_dtoa_sprintf(char*buf, const char*fmt, double val)
+{
+      int prec = -1;
+      int alt = 0;
+
+      if (*fmt != '%')
+	    return -1;
+      fmt += 1;
+      if (*fmt == '#') {
+	    alt = 1;
+	    fmt += 1;
+      }
+      if (*fmt == '.') {
+	    fmt += 1;
+	    prec = 0;
+	    while (*fmt >= '0' && *fmt <= '9') {
+		  prec = prec*10 + (*fmt - '0');
+		  fmt += 1;
+		  if (prec > 1000)
+			return -1;
+	    }
+      }
+      switch (*fmt) {
+	  case 'e':
+	  case 'E':
+	  case 'f':
+	  case 'F':
+	  case 'g':
+	  case 'G':
+	    break;
+	  default:
+	    return -1;
+      }
+      if (fmt[1] != 0)
+	    return -1;
+
+      return sys_dtoa_fmt(buf, *fmt, prec, alt, val);
+}
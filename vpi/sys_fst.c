@@ -17,6 +17,7 @@
  *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
  */
 
+# include <config.h>
 # include "sys_priv.h"
 # include "vcd_priv.h"
 # include "fstapi.h"
@@ -55,12 +56,40 @@ static int dump_is_full = 0;
 static int finish_status = 0;
 
 
+/*
+ * The value-change packer defaults to the fast codec (fastlz). The
+ * compression ratio of the slower zlib packer can be recovered at
+ * close time with -fst-space or -fst-space-speed, which repack the
+ * finished file, so paying for zlib on every block during the run
+ * only makes sense when explicitly asked for.
+ */
 static enum lxm_optimum_mode_e {
       LXM_NONE  = 0,
       LXM_SPACE = 1,
       LXM_SPEED = 2,
       LXM_BOTH = 3
-} lxm_optimum_mode = LXM_NONE;
+} lxm_optimum_mode = LXM_SPEED;
+
+/*
+ * Ring buffer mode ("-fst-ring=N"). For triage runs only the last
+ * stretch of waves before a failure is interesting, so instead of
+ * feeding every value change to the FST packer as it happens, keep
+ * the newest N changes in a circular in-memory log and write them to
+ * the file only when $dumpflush is called or the simulation ends. A
+ * run that never fails pays a record append per change and a single
+ * bounded drain at the end, instead of packing and writing the whole
+ * history.
+ */
+struct ring_rec {
+      struct vcd_info*info;
+      PLI_UINT64 time;
+      char*value;      /* Binary value string, or NULL for a real. */
+      double rvalue;
+};
+static struct ring_rec*ring_log = NULL;
+static unsigned ring_cap = 0;   /* Ring mode is enabled when nonzero. */
+static unsigned ring_next = 0;  /* Next slot to fill. */
+static unsigned ring_fill = 0;  /* Number of live records. */
 
 static const char*units_names[] = {
       "s",
@@ -143,11 +172,90 @@ static void vcd_checkpoint_x()
 	    show_this_item_x(cur);
 }
 
+/*
+ * Sample the current value of a signal into the ring, overwriting the
+ * oldest record when the ring is full. This is called from the end of
+ * time step callback, so like show_this_item it sees the settled
+ * value.
+ */
+static void ring_append(struct vcd_info*info, PLI_UINT64 now)
+{
+      s_vpi_value value;
+      struct ring_rec*rec = ring_log + ring_next;
+
+      if (ring_fill == ring_cap)
+	    free(rec->value);
+      else
+	    ring_fill += 1;
+
+      rec->info = info;
+      rec->time = now;
+      rec->value = NULL;
+
+      if (vpi_get(vpiType, info->item) == vpiRealVar) {
+	    value.format = vpiRealVal;
+	    vpi_get_value(info->item, &value);
+	    rec->rvalue = value.value.real;
+      } else {
+	    value.format = vpiBinStrVal;
+	    vpi_get_value(info->item, &value);
+	    rec->value = strdup(value.value.str);
+      }
+
+      ring_next = (ring_next + 1) % ring_cap;
+}
+
+/*
+ * Write the buffered records to the FST file, oldest first. The
+ * records are in time order, so this replays the time changes as it
+ * goes. Every path that emits to the writer directly must drain the
+ * ring first, to keep the emitted times monotonic.
+ */
+static void ring_drain(void)
+{
+      unsigned idx, pos;
+
+      if (ring_fill == 0) return;
+
+      pos = (ring_next + ring_cap - ring_fill) % ring_cap;
+      for (idx = 0 ; idx < ring_fill ; idx += 1) {
+	    struct ring_rec*rec = ring_log + pos;
+
+	    if (rec->time != vcd_cur_time) {
+		  fstWriterEmitTimeChange(dump_file, rec->time);
+		  vcd_cur_time = rec->time;
+	    }
+	    if (rec->value) {
+		  fstWriterEmitValueChange(dump_file, rec->info->handle,
+		                           rec->value);
+		  free(rec->value);
+		  rec->value = NULL;
+	    } else {
+		  fstWriterEmitValueChange(dump_file, rec->info->handle,
+		                           &rec->rvalue);
+	    }
+	    pos = (pos + 1) % ring_cap;
+      }
+      ring_fill = 0;
+}
+
 static PLI_INT32 variable_cb_2(p_cb_data cause)
 {
       struct vcd_info* info = vcd_dmp_list;
       PLI_UINT64 now = timerec_to_time64(cause->time);
 
+      if (ring_cap) {
+	      /* Ring mode: buffer the changes instead of writing. */
+	    do {
+		 ring_append(info, now);
+		 info->scheduled = 0;
+	    } while ((info = info->dmp_next) != 0);
+
+	    vcd_dmp_list = 0;
+
+	    return 0;
+      }
+
       if (now != vcd_cur_time) {
 	    fstWriterEmitTimeChange(dump_file, now);
 	    vcd_cur_time = now;
@@ -225,6 +333,12 @@ static PLI_INT32 finish_cb(p_cb_data cause)
 
       dumpvars_time = timerec_to_time64(cause->time);
 
+	/* Write out whatever the ring still holds. For a passing run
+	   this is the only time the buffered changes reach the file. */
+      ring_drain();
+      free(ring_log);
+      ring_log = 0;
+
       if (!dump_is_off && !dump_is_full && dumpvars_time != vcd_cur_time) {
 	    fstWriterEmitTimeChange(dump_file, dumpvars_time);
       }
@@ -289,6 +403,8 @@ static PLI_INT32 sys_dumpoff_calltf(ICARUS_VPI_CONST PLI_BYTE8*name)
       if (dump_file == 0) return 0;
       if (dump_header_pending()) return 0;
 
+      ring_drain();
+
       now.type = vpiSimTime;
       vpi_get_time(0, &now);
       now64 = timerec_to_time64(&now);
@@ -316,6 +432,8 @@ static PLI_INT32 sys_dumpon_calltf(ICARUS_VPI_CONST PLI_BYTE8*name)
       if (dump_file == 0) return 0;
       if (dump_header_pending()) return 0;
 
+      ring_drain();
+
       now.type = vpiSimTime;
       vpi_get_time(0, &now);
       now64 = timerec_to_time64(&now);
@@ -340,6 +458,8 @@ static PLI_INT32 sys_dumpall_calltf(ICARUS_VPI_CONST PLI_BYTE8*name)
       if (dump_file == 0) return 0;
       if (dump_header_pending()) return 0;
 
+      ring_drain();
+
       now.type = vpiSimTime;
       vpi_get_time(0, &now);
       now64 = timerec_to_time64(&now);
@@ -393,6 +513,12 @@ static void open_dumpfile(vpiHandle callh)
 	    fstWriterSetVersion(dump_file, "Icarus Verilog");
 	    sprintf(scale_buf, "\t%u%s\n", scale, units_names[udx]);
 	    fstWriterSetTimescaleFromString(dump_file, scale_buf);
+#ifdef HAVE_LIBPTHREAD
+	      /* Compress and write value-change blocks on a writer
+	         thread, so the simulation does not stall behind the
+	         dump file. */
+	    fstWriterSetParallelMode(dump_file, 1);
+#endif
 	      /* Set the faster dump type when requested. */
 	    if ((lxm_optimum_mode == LXM_SPEED) ||
 	        (lxm_optimum_mode == LXM_BOTH)) {
@@ -403,6 +529,13 @@ static void open_dumpfile(vpiHandle callh)
 	        (lxm_optimum_mode == LXM_BOTH)) {
 		  fstWriterSetRepackOnClose(dump_file, 1);
 	    }
+
+	    if (ring_cap) {
+		  ring_log = calloc(ring_cap, sizeof(struct ring_rec));
+		  vpi_printf("FST info: buffering the last %u value "
+		             "changes, $dumpflush writes them out.\n",
+		             ring_cap);
+	    }
       }
 }
 
@@ -443,7 +576,10 @@ static PLI_INT32 sys_dumpfile_calltf(ICARUS_VPI_CONST PLI_BYTE8*name)
 
 static PLI_INT32 sys_dumpflush_calltf(ICARUS_VPI_CONST PLI_BYTE8*name)
 {
-      if (dump_file) fstWriterFlushContext(dump_file);
+      if (dump_file) {
+	    ring_drain();
+	    fstWriterFlushContext(dump_file);
+      }
 
       return 0;
 }
@@ -464,6 +600,118 @@ static PLI_INT32 sys_dumplimit_calltf(ICARUS_VPI_CONST PLI_BYTE8 *name)
       return 0;
 }
 
+/*
+ * $dumpctl("<knob>", <value>) adjusts the FST writer while the
+ * simulation runs, so a job scheduler can trade dump compression
+ * effort against simulation throughput per job class. The knobs:
+ *
+ *   "packtype"  - value-change codec, 0 = libz, 1 = fastlz.
+ *   "repack"    - recompress the whole file with libz on close.
+ *   "parallel"  - run the compressor on the writer thread (0/1).
+ *   "breaksize" - value-change block flush threshold, in bytes.
+ *
+ * Each setting takes effect at the next value-change block, so the
+ * knobs can be flipped repeatedly as box-level memory pressure
+ * changes.
+ */
+static PLI_INT32 sys_dumpctl_compiletf(ICARUS_VPI_CONST PLI_BYTE8 *name)
+{
+      vpiHandle callh = vpi_handle(vpiSysTfCall, 0);
+      vpiHandle argv = vpi_iterate(vpiArgument, callh);
+      vpiHandle arg;
+
+      if (argv == 0) {
+	    vpi_printf("ERROR: %s:%d: ", vpi_get_str(vpiFile, callh),
+	               (int)vpi_get(vpiLineNo, callh));
+	    vpi_printf("%s requires a string and a numeric argument.\n", name);
+	    vpi_control(vpiFinish, 1);
+	    return 0;
+      }
+
+      if (! is_string_obj(vpi_scan(argv))) {
+	    vpi_printf("ERROR: %s:%d: ", vpi_get_str(vpiFile, callh),
+	               (int)vpi_get(vpiLineNo, callh));
+	    vpi_printf("%s's first argument must be a string.\n", name);
+	    vpi_control(vpiFinish, 1);
+      }
+
+      arg = vpi_scan(argv);
+      if (! arg) {
+	    vpi_printf("ERROR: %s:%d: ", vpi_get_str(vpiFile, callh),
+	               (int)vpi_get(vpiLineNo, callh));
+	    vpi_printf("%s requires a second (numeric) argument.\n", name);
+	    vpi_control(vpiFinish, 1);
+	    return 0;
+      }
+
+      if (! is_numeric_obj(arg)) {
+	    vpi_printf("ERROR: %s:%d: ", vpi_get_str(vpiFile, callh),
+	               (int)vpi_get(vpiLineNo, callh));
+	    vpi_printf("%s's second argument must be numeric.\n", name);
+	    vpi_control(vpiFinish, 1);
+      }
+
+      check_for_extra_args(argv, callh, name,
+                           "a string and a numeric argument", 0);
+
+      return 0;
+}
+
+static PLI_INT32 sys_dumpctl_calltf(ICARUS_VPI_CONST PLI_BYTE8 *name)
+{
+      vpiHandle callh = vpi_handle(vpiSysTfCall, 0);
+      vpiHandle argv = vpi_iterate(vpiArgument, callh);
+      s_vpi_value val;
+      char knob[32];
+      PLI_INT32 value;
+
+      val.format = vpiStringVal;
+      vpi_get_value(vpi_scan(argv), &val);
+      strncpy(knob, val.value.str, sizeof(knob)-1);
+      knob[sizeof(knob)-1] = 0;
+
+      val.format = vpiIntVal;
+      vpi_get_value(vpi_scan(argv), &val);
+      value = val.value.integer;
+      vpi_free_object(argv);
+
+      if (dump_file == 0) {
+	    vpi_printf("FST warning: %s:%d: %s(\"%s\") called before the "
+	               "dump file is opened, ignored.\n",
+	               vpi_get_str(vpiFile, callh),
+	               (int)vpi_get(vpiLineNo, callh), name, knob);
+	    return 0;
+      }
+
+      if (strcmp(knob, "packtype") == 0) {
+	    fstWriterSetPackType(dump_file, value);
+
+      } else if (strcmp(knob, "repack") == 0) {
+	    fstWriterSetRepackOnClose(dump_file, value);
+
+      } else if (strcmp(knob, "parallel") == 0) {
+#ifdef HAVE_LIBPTHREAD
+	    fstWriterSetParallelMode(dump_file, value != 0);
+#else
+	    vpi_printf("FST warning: %s:%d: no writer thread support "
+	               "in this build, \"parallel\" ignored.\n",
+	               vpi_get_str(vpiFile, callh),
+	               (int)vpi_get(vpiLineNo, callh));
+#endif
+      } else if (strcmp(knob, "breaksize") == 0) {
+	    if (value > 0)
+		  fstWriterSetBreakSize(dump_file, (uint64_t)value);
+
+      } else {
+	    vpi_printf("FST warning: %s:%d: %s does not know the "
+	               "\"%s\" knob, ignored.\n",
+	               vpi_get_str(vpiFile, callh),
+	               (int)vpi_get(vpiLineNo, callh), name, knob);
+      }
+
+      return 0;
+}
+
 static void scan_item(unsigned depth, vpiHandle item, int skip)
 {
       struct t_cb_data cb;
@@ -837,8 +1085,6 @@ static PLI_INT32 sys_dumpvars_calltf(ICARUS_VPI_CONST PLI_BYTE8*name)
 	    dep = draw_scope(item, callh);
 
 	    scan_item(depth, item, 0);
-	      /* The scope list must be sorted after we scan an item.  */
-	    vcd_names_sort(&fst_tab);
 
 	    while (dep--) fstWriterSetUpscope(dump_file);
 
@@ -847,7 +1093,6 @@ static PLI_INT32 sys_dumpvars_calltf(ICARUS_VPI_CONST PLI_BYTE8*name)
 	       * been added */
 	    if (add_var) {
 		  vcd_names_add(&fst_var, vpi_get_str(vpiFullName, item));
-		  vcd_names_sort(&fst_var);
 	    }
       }
 
@@ -876,6 +1121,16 @@ void sys_fst_register()
 		  lxm_optimum_mode = LXM_BOTH;
 	    } else if (strcmp(vlog_info.argv[idx],"-fst-speed-space") == 0) {
 		  lxm_optimum_mode = LXM_BOTH;
+
+	    } else if (strncmp(vlog_info.argv[idx],"-fst-ring=",10) == 0) {
+		  long cap = strtol(vlog_info.argv[idx]+10, NULL, 10);
+		  if (cap > 0) {
+			ring_cap = (unsigned)cap;
+		  } else {
+			vpi_printf("FST warning: invalid ring size in "
+			           "\"%s\", ring mode disabled.\n",
+			           vlog_info.argv[idx]);
+		  }
 	    }
       }
 
@@ -917,6 +1172,15 @@ void sys_fst_register()
       res = vpi_register_systf(&tf_data);
       vpip_make_systf_system_defined(res);
 
+      tf_data.type      = vpiSysTask;
+      tf_data.tfname    = "$dumpctl";
+      tf_data.calltf    = sys_dumpctl_calltf;
+      tf_data.compiletf = sys_dumpctl_compiletf;
+      tf_data.sizetf    = 0;
+      tf_data.user_data = "$dumpctl";
+      res = vpi_register_systf(&tf_data);
+      vpip_make_systf_system_defined(res);
+
       tf_data.type      = vpiSysTask;
       tf_data.tfname    = "$dumpoff";
       tf_data.calltf    = sys_dumpoff_calltf;
@@ -760,8 +760,6 @@ static PLI_INT32 sys_dumpvars_calltf(ICARUS_VPI_CONST PLI_BYTE8*name)
 	    int dep = draw_scope(item);
 
 	    scan_item(depth, item, 0);
-	      /* The scope list must be sorted after we scan an item.  */
-	    vcd_names_sort(&lxt_tab);
 
 	    while (dep--) pop_scope();
       }
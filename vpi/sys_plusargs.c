@@ -22,6 +22,86 @@
 # include  <stdlib.h>
 # include  <assert.h>
 
+/*
+ * The +arguments are immutable once the simulator has started, and
+ * configuration driven test benches may query them tens of thousands
+ * of times, so build a sorted index over them on first use and do
+ * the prefix searches with a binary search instead of scanning the
+ * whole argument list for every call.
+ */
+struct plusarg_index_ent {
+	/* The +arg text, without the leading '+'. */
+      const char*text;
+	/* The original position in argv, to break ties the way the
+	   old linear scan did. */
+      int pos;
+};
+static struct plusarg_index_ent*plusarg_index = 0;
+static int plusarg_index_len = -1;
+
+static int plusarg_index_cmp(const void*aptr, const void*bptr)
+{
+      const struct plusarg_index_ent*a = aptr;
+      const struct plusarg_index_ent*b = bptr;
+      int rc = strcmp(a->text, b->text);
+      if (rc != 0) return rc;
+      return a->pos - b->pos;
+}
+
+static void plusarg_index_build(void)
+{
+      s_vpi_vlog_info info;
+      int idx;
+
+      vpi_get_vlog_info(&info);
+      plusarg_index_len = 0;
+      plusarg_index = malloc((info.argc > 0 ? info.argc : 1)
+                             * sizeof(struct plusarg_index_ent));
+      for (idx = 0 ;  idx < info.argc ;  idx += 1) {
+	    if (info.argv[idx][0] != '+')
+		  continue;
+	    plusarg_index[plusarg_index_len].text = info.argv[idx]+1;
+	    plusarg_index[plusarg_index_len].pos = idx;
+	    plusarg_index_len += 1;
+      }
+      qsort(plusarg_index, plusarg_index_len,
+            sizeof(struct plusarg_index_ent), plusarg_index_cmp);
+}
+
+/*
+ * Find the first +arg (in command line order) that starts with the
+ * given prefix. Return a pointer to the text just past the prefix,
+ * or NULL when there is no match. The entries sharing the prefix are
+ * contiguous in the sorted index, so locate the start of that range
+ * with a binary search and take the lowest argv position in it.
+ */
+static char*plusarg_find(const char*prefix, size_t slen)
+{
+      int lo = 0, hi, best = -1;
+      char*tail = 0;
+
+      if (plusarg_index_len < 0) plusarg_index_build();
+
+      hi = plusarg_index_len;
+      while (lo < hi) {
+	    int mid = (lo + hi) / 2;
+	    if (strncmp(plusarg_index[mid].text, prefix, slen) < 0)
+		  lo = mid + 1;
+	    else
+		  hi = mid;
+      }
+
+      for ( ;  lo < plusarg_index_len ;  lo += 1) {
+	    if (strncmp(plusarg_index[lo].text, prefix, slen) != 0)
+		  break;
+	    if (best < 0 || plusarg_index[lo].pos < best) {
+		  best = plusarg_index[lo].pos;
+		  tail = (char*)(plusarg_index[lo].text + slen);
+	    }
+      }
+      return tail;
+}
+
 /*
  * Compare the +arguments passed to the simulator with the argument
  * passed to the $test$plusargs. If there is a simulator argument that
@@ -30,10 +110,8 @@
 static PLI_INT32 sys_test_plusargs_calltf(ICARUS_VPI_CONST PLI_BYTE8*name)
 {
       s_vpi_value val;
-      s_vpi_vlog_info info;
-      int idx;
-      int flag = 0;
-      size_t slen, len;
+      int flag;
+      size_t slen;
 
       vpiHandle callh = vpi_handle(vpiSysTfCall, 0);
       vpiHandle argv = vpi_iterate(vpiArgument, callh);
@@ -42,25 +120,8 @@ static PLI_INT32 sys_test_plusargs_calltf(ICARUS_VPI_CONST PLI_BYTE8*name)
       vpi_get_value(vpi_scan(argv), &val);
       slen = strlen(val.value.str);
 
-      vpi_get_vlog_info(&info);
-
 	/* Look for a +arg that matches the prefix supplied. */
-      for (idx = 0 ;  idx < info.argc ;  idx += 1) {
-
-	      /* Skip arguments that are not +args. */
-	    if (info.argv[idx][0] != '+')
-		  continue;
-
-	    len = strlen(info.argv[idx]+1);
-	    if (len < slen)
-		  continue;
-
-	    if (strncmp(val.value.str, info.argv[idx]+1, slen) != 0)
-		  continue;
-
-	    flag = 1;
-	    break;
-      }
+      flag = plusarg_find(val.value.str, slen) != 0;
 
       val.format = vpiIntVal;
       val.value.integer = flag;
@@ -135,14 +196,13 @@ static PLI_INT32 sys_value_plusargs_compiletf(ICARUS_VPI_CONST PLI_BYTE8*name)
 
 static PLI_INT32 sys_value_plusargs_calltf(ICARUS_VPI_CONST PLI_BYTE8*name)
 {
-      s_vpi_vlog_info info;
       s_vpi_value fmt;
       s_vpi_value res;
       char msg[64];
       char*cp;
-      int idx;
+      char*sp;
       int flag = 0;
-      size_t slen, len;
+      size_t slen;
 
       vpiHandle callh  = vpi_handle(vpiSysTfCall, 0);
       vpiHandle argv = vpi_iterate(vpiArgument, callh);
@@ -217,25 +277,12 @@ static PLI_INT32 sys_value_plusargs_calltf(ICARUS_VPI_CONST PLI_BYTE8*name)
 	    *(cp+1) = '\0';
       }
 
-      vpi_get_vlog_info(&info);
-
 	/* Look for a +arg that matches the prefix supplied. */
-      for (idx = 0 ;  idx < info.argc ;  idx += 1) {
-	    char*sp, *tp, *end;
+      sp = plusarg_find(fmt.value.str, slen);
+      if (sp) {
+	    char*tp, *end;
             size_t sp_len;
 
-	      /* Skip arguments that are not +args. */
-	    if (info.argv[idx][0] != '+')
-		  continue;
-
-	    len = strlen(info.argv[idx]+1);
-	    if (len < slen)
-		  continue;
-
-	    if (strncmp(fmt.value.str, info.argv[idx]+1, slen) != 0)
-		  continue;
-
-	    sp = info.argv[idx]+1+slen;
             sp_len = strlen(sp);
 	    switch (*cp) {
 		case 'd':
@@ -370,7 +417,6 @@ static PLI_INT32 sys_value_plusargs_calltf(ICARUS_VPI_CONST PLI_BYTE8*name)
 
 	    vpi_put_value(vpi_scan(argv), &res, 0, vpiNoDelay);
 	    flag = 1;
-	    break;
       }
 
       res.format = vpiIntVal;
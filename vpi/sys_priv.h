@@ -32,12 +32,23 @@ struct context_s {
 
 extern void sgenrand(struct context_s *context, unsigned long seed);
 extern unsigned long genrand(struct context_s *context);
+/* Bulk fill, same sequence as repeated genrand() calls. */
+extern void genrand_bulk(struct context_s *context,
+                         unsigned long *dst, int cnt);
 
 extern PLI_UINT64 timerec_to_time64(const struct t_vpi_time*timerec);
 
 extern char *as_escaped(char *arg);
 extern char *get_filename(vpiHandle callh, const char *name, vpiHandle file);
 
+/*
+ * Fast formatting of real values (sys_dtoa.c). Both return the
+ * length written to buf, or -1 when the case is not handled and the
+ * caller must format with sprintf instead.
+ */
+extern int sys_dtoa_sprintf(char *buf, const char *fmt, double val);
+extern int sys_dtoa_fmt(char *buf, char conv, int prec, int alt, double val);
+
 extern void check_for_extra_args(vpiHandle argv, vpiHandle callh, const char *name,
                                  const char *arg_str, unsigned opt);
 
@@ -31,29 +31,46 @@
  * Twister'' random number generator MT19937.
  */
 
-/* make sure this matches N+1 in mti19937int.c */
-#define NP1	624+1
-
 /* Icarus seed cookie */
 #define COOKIE	0x1ca1ca1c
 
-static struct context_s global_context = {
-#if defined(__GCC__)
-    .mti =
-#else
-    /* For MSVC simply use the fact that mti is located first */
-#endif
-        NP1 };
+/*
+ * Each call site gets its own generator stream, created the first
+ * time the site is touched and stashed in the call's user data. The
+ * new stream is seeded from this master sequence: successive streams
+ * take successive values of the Knuth LCG that sgenrand() also uses,
+ * which spreads the call sites across the twister's seed space
+ * instead of serializing them all through one shared state.
+ */
+static unsigned long stream_seed = COOKIE;
 
-static long mti_dist_uniform(long*seed, long start, long end)
+static struct context_s *get_context(vpiHandle callh)
+{
+      struct context_s *context = (struct context_s *)
+	    vpi_get_userdata(callh);
+
+      if (!context) {
+	    context = (struct context_s *)calloc(1, sizeof(*context));
+	    assert(context);
+	    stream_seed = (69069 * stream_seed + 1) & 0xffffffff;
+	    sgenrand(context, stream_seed);
+
+	      /* squirrel away context */
+	    vpi_put_userdata(callh, (void *)context);
+      }
+
+      return context;
+}
+
+static long mti_dist_uniform(struct context_s *context, long start, long end)
 {
       if (start >= end) return start;
 
       if ((start > LONG_MIN) || (end < LONG_MAX)) {
 	    long range = end - start;
-	    return start + genrand(&global_context)%range;
+	    return start + genrand(context)%range;
       } else {
-	    return genrand(&global_context);
+	    return genrand(context);
       }
 }
 
@@ -81,7 +98,7 @@ static PLI_INT32 sys_mti_dist_uniform_calltf(ICARUS_VPI_CONST PLI_BYTE8*name)
       i_end = val.value.integer;
 
 	/* Calculate and return the result. */
-      val.value.integer = mti_dist_uniform(&i_seed, i_start, i_end);
+      val.value.integer = mti_dist_uniform(get_context(callh), i_start, i_end);
       vpi_put_value(callh, &val, 0, vpiNoDelay);
 
 	/* Return the seed. */
@@ -104,29 +121,16 @@ static PLI_INT32 sys_mti_random_calltf(ICARUS_VPI_CONST PLI_BYTE8*name)
       callh = vpi_handle(vpiSysTfCall, 0);
       argv = vpi_iterate(vpiArgument, callh);
       val.format = vpiIntVal;
+      context = get_context(callh);
       if (argv) {
 	    seed = vpi_scan(argv);
 	    vpi_free_object(argv);
 	    vpi_get_value(seed, &val);
 	    i_seed = val.value.integer;
 
-	      /* Since there is a seed use the current
-	         context or create a new one */
-	    context = (struct context_s *)vpi_get_userdata(callh);
-	    if (!context) {
-		  context = (struct context_s *)calloc(1, sizeof(*context));
-		  context->mti = NP1;
-
-		    /* squirrel away context */
-		  vpi_put_userdata(callh, (void *)context);
-	    }
-
 	      /* If the argument is not the Icarus cookie, then
 		 reseed context */
 	    if (i_seed != COOKIE) sgenrand(context, i_seed);
-      } else {
-	    /* use global context */
-          context = &global_context;
       }
 
         /* Calculate and return the result */
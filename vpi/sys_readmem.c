@@ -27,9 +27,215 @@
 # include  <sys/stat.h>
 # include  "ivl_alloc.h"
 
+#if !defined(__MINGW32__) && !defined(_MSC_VER)
+# include  <sys/mman.h>
+# include  <unistd.h>
+# define READMEM_USE_MMAP 1
+#endif
+
 char **search_list = NULL;
 unsigned sl_count = 0;
 
+/*
+ * Fast scanner for the $readmem input language. The flex lexer pulls
+ * the file through stdio a character at a time, which dominates
+ * startup when loading multi-GB firmware images. This scanner works
+ * on the whole image in memory (mapped when possible, bulk-read
+ * otherwise) and produces exactly the same token stream and vecval
+ * contents as sys_readmem_lex.lex, which remains the fallback when
+ * the image cannot be loaded.
+ */
+static char*fast_buf = 0;
+static size_t fast_len = 0;
+static size_t fast_pos = 0;
+static int fast_mapped = 0;
+static int fast_bin_flag = 0;
+static unsigned fast_width = 0;
+static struct t_vpi_vecval*fast_vecval = 0;
+static char fast_error_token[2];
+
+static int readmem_fast_init(FILE*file, int bin_flag, unsigned width,
+                             struct t_vpi_vecval*vv)
+{
+      struct stat stat_buf;
+
+      fast_buf = 0;
+      fast_len = 0;
+      fast_pos = 0;
+      fast_mapped = 0;
+
+      if (fstat(fileno(file), &stat_buf) < 0)
+	    return 0;
+      if (stat_buf.st_size < 0)
+	    return 0;
+
+      fast_len = stat_buf.st_size;
+
+#ifdef READMEM_USE_MMAP
+      if (fast_len > 0) {
+	    void*base = mmap(0, fast_len, PROT_READ, MAP_PRIVATE,
+	                     fileno(file), 0);
+	    if (base != MAP_FAILED) {
+		  fast_buf = (char*)base;
+		  fast_mapped = 1;
+	    }
+      }
+#endif
+      if (fast_buf == 0) {
+	    fast_buf = malloc(fast_len + 1);
+	    if (fast_buf == 0)
+		  return 0;
+	    if (fread(fast_buf, 1, fast_len, file) != fast_len) {
+		  free(fast_buf);
+		  fast_buf = 0;
+		  return 0;
+	    }
+      }
+
+      fast_bin_flag = bin_flag;
+      fast_width = width;
+      fast_vecval = vv;
+      return 1;
+}
+
+static void readmem_fast_done(void)
+{
+      if (fast_buf == 0)
+	    return;
+#ifdef READMEM_USE_MMAP
+      if (fast_mapped) {
+	    munmap(fast_buf, fast_len);
+	    fast_buf = 0;
+	    return;
+      }
+#endif
+      free(fast_buf);
+      fast_buf = 0;
+}
+
+/* Convert the digit span [beg,end) into the vecval, just like
+   make_hex_value()/make_bin_value() in the lexer. */
+static void fast_make_value(const char*beg, const char*end)
+{
+      struct t_vpi_vecval*cur;
+      int idx;
+      int width = 0, word_max = fast_width;
+      int shift = fast_bin_flag? 1 : 4;
+
+      for (idx = 0, cur = fast_vecval ;  idx < word_max ;  idx += 32, cur += 1) {
+	    cur->aval = 0;
+	    cur->bval = 0;
+      }
+
+      cur = fast_vecval;
+      while ((width < word_max) && (end > beg)) {
+	    int aval = 0;
+	    int bval = 0;
+	    char ch;
+
+	    end -= 1;
+	    ch = *end;
+	    if (ch == '_') continue;
+
+	    if (ch >= '0' && ch <= '9') aval = ch - '0';
+	    else if (ch >= 'a' && ch <= 'f') aval = ch - 'a' + 10;
+	    else if (ch >= 'A' && ch <= 'F') aval = ch - 'A' + 10;
+	    else if (ch == 'x' || ch == 'X') { aval = (1 << shift) - 1;
+	                                       bval = aval; }
+	    else if (ch == 'z' || ch == 'Z') bval = (1 << shift) - 1;
+
+	    cur->aval |= aval << width;
+	    cur->bval |= bval << width;
+	    width += shift;
+	    if (width == 32) {
+		  cur += 1;
+		  width = 0;
+		  word_max -= 32;
+	    }
+      }
+}
+
+static int fast_is_digit(char ch)
+{
+      if (ch == '_' || ch == 'x' || ch == 'X' || ch == 'z' || ch == 'Z')
+	    return 1;
+      if (fast_bin_flag)
+	    return ch == '0' || ch == '1';
+      return isxdigit((int)(unsigned char)ch);
+}
+
+static int readmem_fast_lex(void)
+{
+      char ch;
+
+	/* Skip white space and comments. */
+      for (;;) {
+	    if (fast_pos >= fast_len)
+		  return 0;
+	    ch = fast_buf[fast_pos];
+	    if (ch == ' ' || ch == '\t' || ch == '\f'
+	        || ch == '\n' || ch == '\r') {
+		  fast_pos += 1;
+		  continue;
+	    }
+	    if (ch == '/' && fast_pos+1 < fast_len
+	        && fast_buf[fast_pos+1] == '/') {
+		  while (fast_pos < fast_len && fast_buf[fast_pos] != '\n')
+			fast_pos += 1;
+		  continue;
+	    }
+	    if (ch == '/' && fast_pos+1 < fast_len
+	        && fast_buf[fast_pos+1] == '*') {
+		  fast_pos += 2;
+		  while (fast_pos+1 < fast_len
+		         && !(fast_buf[fast_pos] == '*'
+		              && fast_buf[fast_pos+1] == '/'))
+			fast_pos += 1;
+		  if (fast_pos+1 >= fast_len)
+			return 0;
+		  fast_pos += 2;
+		  continue;
+	    }
+	    break;
+      }
+
+      if (ch == '@') {
+	    unsigned addr = 0;
+	    size_t start = fast_pos + 1;
+	    fast_pos += 1;
+	    while (fast_pos < fast_len
+	           && isxdigit((int)(unsigned char)fast_buf[fast_pos])) {
+		  char dig = fast_buf[fast_pos];
+		  addr *= 16;
+		  if (dig >= '0' && dig <= '9') addr += dig - '0';
+		  else if (dig >= 'a' && dig <= 'f') addr += dig - 'a' + 10;
+		  else addr += dig - 'A' + 10;
+		  fast_pos += 1;
+	    }
+	    if (fast_pos == start) {
+		  fast_error_token[0] = '@';
+		  fast_error_token[1] = 0;
+		  readmem_error_token = fast_error_token;
+		  return MEM_ERROR;
+	    }
+	    fast_vecval->aval = addr;
+	    return MEM_ADDRESS;
+      }
+
+      if (fast_is_digit(ch)) {
+	    size_t start = fast_pos;
+	    while (fast_pos < fast_len && fast_is_digit(fast_buf[fast_pos]))
+		  fast_pos += 1;
+	    fast_make_value(fast_buf + start, fast_buf + fast_pos);
+	    return MEM_WORD;
+      }
+
+      fast_error_token[0] = ch;
+      fast_error_token[1] = 0;
+      readmem_error_token = fast_error_token;
+      return MEM_ERROR;
+}
+
 static void get_mem_params(vpiHandle argv, vpiHandle callh, const char *name,
                            char **fname, vpiHandle *mitem,
                            vpiHandle *start_item, vpiHandle *stop_item)
@@ -259,6 +465,7 @@ static PLI_INT32 sys_mem_compiletf(ICARUS_VPI_CONST PLI_BYTE8*name)
 static PLI_INT32 sys_readmem_calltf(ICARUS_VPI_CONST PLI_BYTE8*name)
 {
       int code, wwid, addr;
+      int use_fast;
       FILE*file;
       char *fname = 0;
       s_vpi_value value;
@@ -328,17 +535,22 @@ static PLI_INT32 sys_readmem_calltf(ICARUS_VPI_CONST PLI_BYTE8*name)
       value.format = vpiVectorVal;
       value.value.vector = calloc((wwid+31)/32, sizeof(s_vpi_vecval));
 
-      /* Configure the readmem lexer */
-      if (strcmp(name,"$readmemb") == 0)
-	  sys_readmem_start_file(file, 1, wwid, value.value.vector);
-      else
-	  sys_readmem_start_file(file, 0, wwid, value.value.vector);
+      /* Configure the scanner. Prefer the in-memory fast scanner and
+         fall back to the stdio lexer if the image cannot be loaded. */
+      {
+	  int bin_flag = strcmp(name,"$readmemb") == 0;
+	  use_fast = readmem_fast_init(file, bin_flag, wwid,
+	                               value.value.vector);
+	  if (!use_fast)
+	      sys_readmem_start_file(file, bin_flag, wwid,
+	                             value.value.vector);
+      }
 
       /*======================================== Read memory file */
 
       /* Run through the input file and store the new contents in the memory */
       addr = start_addr;
-      while ((code = readmemlex()) != 0) {
+      while ((code = use_fast? readmem_fast_lex() : readmemlex()) != 0) {
 	  switch (code) {
 	  case MEM_ADDRESS:
 	      addr = value.value.vector->aval;
@@ -404,6 +616,7 @@ static PLI_INT32 sys_readmem_calltf(ICARUS_VPI_CONST PLI_BYTE8*name)
       free(value.value.vector);
       free(fname);
       fclose(file);
+      readmem_fast_done();
       destroy_readmem_lexor();
       return 0;
 }
@@ -505,6 +718,111 @@ static PLI_INT32 sys_readmempath_calltf(ICARUS_VPI_CONST PLI_BYTE8*name)
       return 0;
 }
 
+/*
+ * Map one 4-state nibble onto its hex digit, using the same rules as
+ * the vvp hex_digits table: all-z is 'z', all-x is 'x', a mix with z
+ * only is 'Z', any x in a mix is 'X', otherwise the binary digit.
+ * The aval/bval encoding is the VPI one: 0/0=0, 1/0=1, 0/1=z, 1/1=x.
+ * nbits is the number of valid bits, which is less than 4 for a
+ * partial top nibble.
+ */
+static char writemem_hex_digit(unsigned aval, unsigned bval, unsigned nbits)
+{
+      unsigned cnt_x = 0, cnt_z = 0, bv = 0, bdx;
+
+      for (bdx = 0; bdx < nbits; bdx += 1) {
+	    unsigned a = (aval >> bdx) & 1;
+	    unsigned b = (bval >> bdx) & 1;
+	    if (b) {
+		  if (a) cnt_x += 1;
+		  else cnt_z += 1;
+	    } else if (a) {
+		  bv |= 1 << bdx;
+	    }
+      }
+
+      if (cnt_z == nbits) return 'z';
+      if (cnt_x == nbits) return 'x';
+      if ((cnt_z > 0) && (cnt_x == 0)) return 'Z';
+      if (cnt_x > 0) return 'X';
+      return "0123456789abcdef"[bv];
+}
+
+/*
+ * Bulk writer for $writememh. Words are fetched as vpiVectorVal, so
+ * the runtime hands back raw aval/bval words instead of formatting a
+ * string per word, and the hex digits are produced by table lookup
+ * (one lookup per nibble) into a large staging buffer that is flushed
+ * with fwrite. This keeps big memory dumps I/O bound instead of
+ * formatting bound.
+ */
+#define WRITEMEM_BUF_SIZE 65536
+
+static void writemem_hex(FILE*file, vpiHandle mitem,
+                         int start_addr, int stop_addr, int addr_incr)
+{
+      static char hex_tbl[256];
+      static int hex_tbl_ready = 0;
+
+      s_vpi_value value;
+      unsigned wwid, dwid;
+      unsigned cnt;
+      unsigned olen = 0;
+      int addr;
+      char *obuf;
+
+      if (! hex_tbl_ready) {
+	    unsigned idx;
+	    for (idx = 0; idx < 256; idx += 1)
+		  hex_tbl[idx] = writemem_hex_digit(idx & 0xf, idx >> 4, 4);
+	    hex_tbl_ready = 1;
+      }
+
+      wwid = vpi_get(vpiSize, vpi_handle_by_index(mitem, start_addr));
+      dwid = (wwid + 3) / 4;
+
+      obuf = malloc(WRITEMEM_BUF_SIZE);
+      value.format = vpiVectorVal;
+
+      cnt = 0;
+      for(addr=start_addr; addr!=stop_addr+addr_incr; addr+=addr_incr, ++cnt) {
+	    vpiHandle word_index;
+	    p_vpi_vecval vec;
+	    unsigned didx;
+
+	      /* Flush the staging buffer when a full line may not fit. */
+	    if (olen + dwid + 32 > WRITEMEM_BUF_SIZE) {
+		  fwrite(obuf, 1, olen, file);
+		  olen = 0;
+	    }
+
+	    if (cnt%16 == 0)
+		  olen += sprintf(obuf+olen, "// 0x%08x\n", cnt);
+
+	    word_index = vpi_handle_by_index(mitem, addr);
+	    assert(word_index);
+	    vpi_get_value(word_index, &value);
+	    vec = value.value.vector;
+
+	      /* Most significant nibble first. A nibble never spans a
+	       * vector word, so each digit is two shifts and a lookup. */
+	    for (didx = dwid; didx > 0; didx -= 1) {
+		  unsigned base = (didx-1)*4;
+		  unsigned aval = (vec[base/32].aval >> (base%32)) & 0xf;
+		  unsigned bval = (vec[base/32].bval >> (base%32)) & 0xf;
+		  unsigned nbits = wwid - base;
+		  if (nbits >= 4)
+			obuf[olen++] = hex_tbl[aval | (bval << 4)];
+		  else
+			obuf[olen++] = writemem_hex_digit(aval, bval, nbits);
+	    }
+	    obuf[olen++] = '\n';
+      }
+
+      if (olen > 0) fwrite(obuf, 1, olen, file);
+      free(obuf);
+}
+
 static PLI_INT32 sys_writemem_calltf(ICARUS_VPI_CONST PLI_BYTE8*name)
 {
       int addr;
@@ -547,21 +865,25 @@ static PLI_INT32 sys_writemem_calltf(ICARUS_VPI_CONST PLI_BYTE8*name)
 	    return 0;
       }
 
-      if (strcmp(name,"$writememb")==0) value.format = vpiBinStrVal;
-      else value.format = vpiHexStrVal;
-
       /*======================================== Write memory file */
 
-      cnt = 0;
-      for(addr=start_addr; addr!=stop_addr+addr_incr; addr+=addr_incr, ++cnt) {
-	  vpiHandle word_index;
+      if (strcmp(name,"$writememb")==0) {
+	    value.format = vpiBinStrVal;
+
+	    cnt = 0;
+	    for(addr=start_addr; addr!=stop_addr+addr_incr;
+	        addr+=addr_incr, ++cnt) {
+		vpiHandle word_index;
 
-	  if (cnt%16 == 0) fprintf(file, "// 0x%08x\n", cnt);
+		if (cnt%16 == 0) fprintf(file, "// 0x%08x\n", cnt);
 
-	  word_index = vpi_handle_by_index(mitem, addr);
-	  assert(word_index);
-	  vpi_get_value(word_index, &value);
-	  fprintf(file, "%s\n", value.value.str);
+		word_index = vpi_handle_by_index(mitem, addr);
+		assert(word_index);
+		vpi_get_value(word_index, &value);
+		fprintf(file, "%s\n", value.value.str);
+	    }
+      } else {
+	    writemem_hex(file, mitem, start_addr, stop_addr, addr_incr);
       }
 
       fclose(file);
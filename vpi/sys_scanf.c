@@ -996,125 +996,169 @@ static int scan_format_four_state(vpiHandle callh, vpiHandle argv,
 }
 
 /*
- * The $fscanf and $sscanf functions are the same except for the first
- * argument, which is the source. The wrapper functions below peel off
- * the first argument and make a byte_source object that then gets
- * passed to this function, which processes the rest of the function.
+ * A format string is compiled once into a list of these ops, and the
+ * scan is driven from the compiled form. When the format is a string
+ * constant the compiled program is cached on the call handle, so a
+ * call site that is executed millions of times (log replay) parses
+ * its format exactly once.
  */
-static int scan_format(vpiHandle callh, struct byte_source*src, vpiHandle argv,
-                       PLI_BYTE8 *name)
-{
-      s_vpi_value val;
-      vpiHandle item;
-      PLI_INT32 len, words, idx, mask;
-
-      char *fmt, *fmtp;
-      int rc = 0;
-      int ch;
-
-      int match = 1;
-
-	/* Get the format string. */
-      item = vpi_scan(argv);
-      assert(item);
-	/* Look for an undefined bit (X/Z) in the format string. If one is
-	 * found just return EOF. */
-      len = vpi_get(vpiSize, item);
-      words = ((len + 31) / 32) - 1;
-      val.format = vpiVectorVal;
-      vpi_get_value(item, &val);
-	/* Check the full words for an undefined bit. */
-      for (idx = 0; idx < words; idx += 1) {
-	    if (val.value.vector[idx].bval) {
-		  match = 0;
-		  rc = EOF;
-		  break;
-	    }
-      }
-	/* The mask is defined to be 32 bits. */
-      mask = UINT32_MAX >> (32U - ((len - 1U) % 32U + 1U));
-	/* Check the top word for an undefined bit. */
-      if (match && (val.value.vector[words].bval & mask)) {
-	    match = 0;
-	    rc = EOF;
-      }
+#define SCAN_OP_SPACE  0	/* Match zero or more white space chars. */
+#define SCAN_OP_LIT    1	/* Match a literal character run. */
+#define SCAN_OP_FORMAT 2	/* A %<N>x format code. */
+
+struct scan_op {
+      char type;
+      char code;		/* Format code character. */
+      unsigned width;		/* Maximum match width or UINT_MAX. */
+      unsigned suppress;	/* True for a %* suppressed match. */
+      char *lit;		/* Literal text for SCAN_OP_LIT ops. */
+};
 
-	/* Now get the format as a string. */
-      val.format = vpiStringVal;
-      vpi_get_value(item, &val);
-      fmtp = fmt = strdup(val.value.str);
+struct scan_prog {
+      struct scan_op *ops;
+      unsigned nops;
+};
 
-	/* See if we are at EOF before we even start. */
-      ch = byte_getc(src);
-      if (ch == EOF) {
-	    rc = EOF;
-	    match = 0;
-      }
-      byte_ungetc(src, ch);
+/*
+ * Compile a format string into an op list. Invalid format codes are
+ * kept in the op list and diagnosed at execution time, so the error
+ * reporting is unchanged from the interpreted form.
+ */
+static struct scan_prog* compile_scan_format(const char *fmtp)
+{
+      struct scan_prog *prog = malloc(sizeof(struct scan_prog));
+      prog->ops = 0;
+      prog->nops = 0;
 
-      while ( fmtp && *fmtp != 0 && match) {
+      while (fmtp && *fmtp != 0) {
+	    struct scan_op op;
+	    op.lit = 0;
 
 	    if (isspace((int)*fmtp)) {
-		    /* White space matches a string of white space in the
-		     * input. The number of spaces is not relevant, and
-		     * the match may be 0 or more spaces. */
+		    /* A run of white space is a single op. */
 		  while (*fmtp && isspace((int)*fmtp)) fmtp += 1;
-
-		  ch = byte_getc(src);
-		  while (isspace(ch)) ch = byte_getc(src);
-
-		  byte_ungetc(src, ch);
+		  op.type = SCAN_OP_SPACE;
+		  op.code = 0;
+		  op.width = 0;
+		  op.suppress = 0;
 
 	    } else if (*fmtp != '%') {
-		    /* Characters other than % match themselves. */
-		  ch = byte_getc(src);
-		  if (ch != *fmtp) {
-			byte_ungetc(src, ch);
-			break;
+		    /* Characters other than % match themselves. Collect
+		     * the whole run into one op. */
+		  unsigned len = 0;
+		  op.type = SCAN_OP_LIT;
+		  op.code = 0;
+		  op.width = 0;
+		  op.suppress = 0;
+		  op.lit = malloc(1);
+		  while (*fmtp && !isspace((int)*fmtp) && (*fmtp != '%')) {
+			op.lit = realloc(op.lit, len+2);
+			op.lit[len++] = *fmtp;
+			fmtp += 1;
 		  }
-
-		  fmtp += 1;
+		  op.lit[len] = 0;
 
 	    } else {
-
 		    /* We are at a pattern character. The pattern has
 		     * the format %<N>x no matter what the x code, so
-		     * parse it generically first. */
-
-		  unsigned suppress_flag = 0;
-		  unsigned max_width = UINT_MAX;
-		  int code = 0;
+		     * parse it generically. */
+		  op.type = SCAN_OP_FORMAT;
+		  op.suppress = 0;
+		  op.width = UINT_MAX;
 
 		    /* Look for the suppression character '*'. */
 		  fmtp += 1;
 		  if (*fmtp == '*') {
-			suppress_flag = 1;
+			op.suppress = 1;
 			fmtp += 1;
 		  }
 		    /* Look for the maximum match width. */
 		  if (isdigit((int)*fmtp)) {
-			max_width = 0;
+			op.width = 0;
 			while (isdigit((int)*fmtp)) {
-			      max_width *= 10;
-			      max_width += *fmtp - '0';
+			      op.width *= 10;
+			      op.width += *fmtp - '0';
 			      fmtp += 1;
 			}
 		  }
 
 		    /* Get the format character. */
-		  code = *fmtp;
-		  fmtp += 1;
+		  op.code = *fmtp;
+		  if (*fmtp) fmtp += 1;
+	    }
+
+	    prog->ops = realloc(prog->ops,
+	                        (prog->nops+1)*sizeof(struct scan_op));
+	    prog->ops[prog->nops] = op;
+	    prog->nops += 1;
+      }
+
+      return prog;
+}
+
+static void free_scan_prog(struct scan_prog *prog)
+{
+      unsigned idx;
+      for (idx = 0; idx < prog->nops; idx += 1)
+	    free(prog->ops[idx].lit);
+      free(prog->ops);
+      free(prog);
+}
+
+/*
+ * Run a compiled format program against the byte source. Returns the
+ * number of successful matches, or EOF.
+ */
+static int exec_scan_prog(const struct scan_prog *prog, vpiHandle callh,
+                          struct byte_source *src, vpiHandle argv,
+                          PLI_BYTE8 *name)
+{
+      unsigned opi;
+      int rc = 0;
+      int ch;
+
+      int match = 1;
+
+	/* See if we are at EOF before we even start. */
+      ch = byte_getc(src);
+      if (ch == EOF) return EOF;
+      byte_ungetc(src, ch);
+
+      for (opi = 0; opi < prog->nops && match; opi += 1) {
+	    const struct scan_op *op = prog->ops + opi;
+
+	    if (op->type == SCAN_OP_SPACE) {
+		    /* White space matches a string of white space in the
+		     * input. The number of spaces is not relevant, and
+		     * the match may be 0 or more spaces. */
+		  ch = byte_getc(src);
+		  while (isspace(ch)) ch = byte_getc(src);
+
+		  byte_ungetc(src, ch);
+
+	    } else if (op->type == SCAN_OP_LIT) {
+		    /* Literal characters match themselves. */
+		  const char *lit = op->lit;
+		  while (*lit) {
+			ch = byte_getc(src);
+			if (ch != *lit) {
+			      byte_ungetc(src, ch);
+			      match = 0;
+			      break;
+			}
+			lit += 1;
+		  }
+
+	    } else {
+		  unsigned suppress_flag = op->suppress;
+		  unsigned max_width = op->width;
+		  char code = op->code;
 
-		    /* The format string is parsed:
-		     *   - max_width is the width,
-		     *   - code is the format code character,
-		     *   - suppress_flag is true if the match is to be ignored.
-		     * Now interpret the code. */
 		  switch (code) {
 
 			  /* Read a '%' character from the input. */
 		      case '%':
-			assert(max_width == -1);
+			assert(max_width == UINT_MAX);
 			assert(suppress_flag == 0);
 			ch = byte_getc(src);
 			if (ch != '%') {
@@ -1224,8 +1268,82 @@ static int scan_format(vpiHandle callh, struct byte_source*src, vpiHandle argv,
 	    }
       }
 
-	/* Clean up the allocated memory. */
-      free(fmt);
+      return rc;
+}
+
+/*
+ * The $fscanf and $sscanf functions are the same except for the first
+ * argument, which is the source. The wrapper functions below peel off
+ * the first argument and make a byte_source object that then gets
+ * passed to this function, which processes the rest of the function.
+ */
+static int scan_format(vpiHandle callh, struct byte_source*src, vpiHandle argv,
+                       PLI_BYTE8 *name)
+{
+      s_vpi_value val;
+      vpiHandle item;
+
+      struct scan_prog *prog = 0;
+      int cache_flag = 0;
+      int rc = 0;
+
+      int match = 1;
+
+	/* Get the format string. */
+      item = vpi_scan(argv);
+      assert(item);
+
+	/* A string constant format never changes, so its compiled
+	 * program can be cached on the call handle. */
+      switch (vpi_get(vpiType, item)) {
+	  case vpiConstant:
+	  case vpiParameter:
+	    if (vpi_get(vpiConstType, item) == vpiStringConst) {
+		  cache_flag = 1;
+		  prog = (struct scan_prog *) vpi_get_userdata(callh);
+	    }
+	    break;
+
+	  default: {
+		  /* A mutable format may contain an undefined bit (X/Z).
+		   * If one is found just return EOF. */
+		PLI_INT32 len, words, idx, mask;
+		len = vpi_get(vpiSize, item);
+		words = ((len + 31) / 32) - 1;
+		val.format = vpiVectorVal;
+		vpi_get_value(item, &val);
+		  /* Check the full words for an undefined bit. */
+		for (idx = 0; idx < words; idx += 1) {
+		      if (val.value.vector[idx].bval) {
+			    match = 0;
+			    rc = EOF;
+			    break;
+		      }
+		}
+		  /* The mask is defined to be 32 bits. */
+		mask = UINT32_MAX >> (32U - ((len - 1U) % 32U + 1U));
+		  /* Check the top word for an undefined bit. */
+		if (match && (val.value.vector[words].bval & mask)) {
+		      match = 0;
+		      rc = EOF;
+		}
+		break;
+	  }
+      }
+
+      if (match && (prog == 0)) {
+	      /* Get the format as a string and compile it. */
+	    val.format = vpiStringVal;
+	    vpi_get_value(item, &val);
+	    prog = compile_scan_format(val.value.str);
+	    if (cache_flag) vpi_put_userdata(callh, prog);
+      }
+
+      if (match) rc = exec_scan_prog(prog, callh, src, argv, name);
+
+	/* Clean up the allocated memory. Cached programs are kept for
+	 * the next call. */
+      if (prog && !cache_flag) free_scan_prog(prog);
       vpi_free_object(argv);
 
 	/* Return the number of successful matches. */
@@ -37,25 +37,151 @@ static vpiHandle sdf_callh = 0;
   /* The cell in process. */
 static vpiHandle sdf_cur_cell;
 
-static vpiHandle find_scope(vpiHandle scope, const char*name)
+/*
+ * A large SDF file names cells by hierarchical path, and scanning the
+ * child modules of a scope with the VPI iterator for every path step
+ * of every CELL record is quadratic in practice. Cache the children
+ * of each scope in this hash table the first time the scope is
+ * visited; scope handles and names are stable, so the cache is never
+ * invalidated and also survives multiple $sdf_annotate calls.
+ */
+# define SDF_SCOPE_HASH 512
+# define SDF_CHILD_HASH 64
+
+struct sdf_child_cell {
+      char*name;
+      vpiHandle handle;
+      struct sdf_child_cell*next;
+};
+
+struct sdf_scope_cell {
+      vpiHandle scope;
+      struct sdf_child_cell*children[SDF_CHILD_HASH];
+      struct sdf_scope_cell*next;
+};
+
+static struct sdf_scope_cell*sdf_scope_cache[SDF_SCOPE_HASH];
+
+static unsigned sdf_name_hash(const char*name)
+{
+      unsigned hash = 0;
+      while (*name)
+	    hash = hash*13 + (unsigned char)*name++;
+      return hash;
+}
+
+static struct sdf_scope_cell* load_scope_cell(vpiHandle scope)
 {
-      vpiHandle idx = vpi_iterate(vpiModule, scope);
-	/* If this scope has no modules then it can't have the one we
-	 * are looking for so just return 0. */
-      if (idx == 0) return 0;
+      unsigned hash = ((unsigned long)scope >> 4) % SDF_SCOPE_HASH;
+      struct sdf_scope_cell*cur;
+      vpiHandle idx, child;
+
+      for (cur = sdf_scope_cache[hash] ;  cur ;  cur = cur->next)
+	    if (cur->scope == scope) return cur;
+
+      cur = calloc(1, sizeof(struct sdf_scope_cell));
+      cur->scope = scope;
+      cur->next = sdf_scope_cache[hash];
+      sdf_scope_cache[hash] = cur;
+
+	/* Enumerate the children of this scope exactly once. */
+      idx = vpi_iterate(vpiModule, scope);
+      if (idx) while ( (child = vpi_scan(idx)) ) {
+	    struct sdf_child_cell*cell = malloc(sizeof(struct sdf_child_cell));
+	    unsigned chash;
+
+	    cell->name = strdup(vpi_get_str(vpiName, child));
+	    cell->handle = child;
+	    chash = sdf_name_hash(cell->name) % SDF_CHILD_HASH;
+	    cell->next = cur->children[chash];
+	    cur->children[chash] = cell;
+      }
+
+      return cur;
+}
 
-      vpiHandle cur;
-      while ( (cur = vpi_scan(idx)) ) {
+static vpiHandle find_scope(vpiHandle scope, const char*name)
+{
+      struct sdf_scope_cell*cell = load_scope_cell(scope);
+      struct sdf_child_cell*cur;
+      unsigned chash = sdf_name_hash(name) % SDF_CHILD_HASH;
 
-	    if ( strcmp(name, vpi_get_str(vpiName,cur)) == 0) {
-		  vpi_free_object(idx);
-		  return cur;
-	    }
+      for (cur = cell->children[chash] ;  cur ;  cur = cur->next) {
+	    if (strcmp(name, cur->name) == 0)
+		  return cur->handle;
       }
 
       return 0;
 }
 
+/*
+ * The modpaths of the currently selected cell, with their terminal
+ * names and edge already extracted. An SDF cell commonly carries many
+ * IOPATH records, and matching each of them against the modpaths
+ * through per-record VPI handle and string queries was the dominant
+ * annotation cost. The table is rebuilt only when a different cell
+ * is selected.
+ */
+struct sdf_path_cell {
+      vpiHandle path;
+      char*src;
+      char*dst;
+      int edge;
+};
+
+static struct sdf_path_cell*sdf_cur_paths = 0;
+static unsigned sdf_cur_npaths = 0;
+static unsigned sdf_cur_paths_cap = 0;
+
+static void load_cell_paths(void)
+{
+      vpiHandle iter, path;
+      unsigned idx;
+
+      for (idx = 0 ; idx < sdf_cur_npaths ; idx += 1) {
+	    free(sdf_cur_paths[idx].src);
+	    free(sdf_cur_paths[idx].dst);
+      }
+      sdf_cur_npaths = 0;
+
+      if (sdf_cur_cell == 0)
+	    return;
+
+      iter = vpi_iterate(vpiModPath, sdf_cur_cell);
+      if (iter == 0)
+	    return;
+
+      while ( (path = vpi_scan(iter)) ) {
+	    vpiHandle path_t_in = vpi_handle(vpiModPathIn,path);
+	    vpiHandle path_t_out = vpi_handle(vpiModPathOut,path);
+
+	    vpiHandle path_in = vpi_handle(vpiExpr,path_t_in);
+	    vpiHandle path_out = vpi_handle(vpiExpr,path_t_out);
+
+	    struct sdf_path_cell*cur;
+
+	      /* The expressions for the path terms must be signals,
+	         vpiNet or vpiReg. */
+	    assert(vpi_get(vpiType,path_in) == vpiNet);
+	    assert(vpi_get(vpiType,path_out) == vpiNet
+		   || vpi_get(vpiType,path_out) == vpiReg);
+
+	    if (sdf_cur_npaths == sdf_cur_paths_cap) {
+		  sdf_cur_paths_cap = sdf_cur_paths_cap? 2*sdf_cur_paths_cap : 16;
+		  sdf_cur_paths = realloc(sdf_cur_paths,
+					  sdf_cur_paths_cap*sizeof(struct sdf_path_cell));
+	    }
+
+	    cur = sdf_cur_paths + sdf_cur_npaths;
+	    sdf_cur_npaths += 1;
+
+	    cur->path = path;
+	    cur->src = strdup(vpi_get_str(vpiName,path_in));
+	    cur->dst = strdup(vpi_get_str(vpiName,path_out));
+	    cur->edge = vpi_get(vpiEdge,path_t_in);
+      }
+}
+
 /*
  * These functions are called by the SDF parser during parsing to
  * handling items discovered in the parse.
@@ -63,6 +189,7 @@ static vpiHandle find_scope(vpiHandle scope, const char*name)
 
 void sdf_select_instance(const char*celltype, const char*cellinst)
 {
+      vpiHandle prev_cell = sdf_cur_cell;
       char buffer[128];
 
 	/* First follow the hierarchical parts of the cellinst name to
@@ -122,6 +249,10 @@ void sdf_select_instance(const char*celltype, const char*cellinst)
 		       vpi_get_str(vpiDefName, sdf_cur_cell));
       }
 
+	/* Load the modpaths of the newly selected cell for the
+	   IOPATH records that follow. */
+      if (sdf_cur_cell != prev_cell)
+	    load_cell_paths();
 }
 
 static const char*edge_str(int vpi_edge)
@@ -138,46 +269,34 @@ static const char*edge_str(int vpi_edge)
 void sdf_iopath_delays(int vpi_edge, const char*src, const char*dst,
 		       const struct sdf_delval_list_s*delval_list)
 {
-      vpiHandle iter, path;
+      unsigned pdx;
       int match_count = 0;
 
       if (sdf_cur_cell == 0)
 	    return;
 
-      iter = vpi_iterate(vpiModPath, sdf_cur_cell);
-
 	/* Search for the modpath that matches the IOPATH by looking
 	   for the modpath that uses the same ports as the ports that
-	   the parser has found. */
-      if (iter) while ( (path = vpi_scan(iter)) ) {
+	   the parser has found. The terminal names and edges were
+	   extracted when the cell was selected. */
+      for (pdx = 0 ; pdx < sdf_cur_npaths ; pdx += 1) {
+	    struct sdf_path_cell*cur = sdf_cur_paths + pdx;
 	    s_vpi_delay delays;
 	    struct t_vpi_time delay_vals[12];
 	    int idx;
 
-	    vpiHandle path_t_in = vpi_handle(vpiModPathIn,path);
-	    vpiHandle path_t_out = vpi_handle(vpiModPathOut,path);
-
-	    vpiHandle path_in = vpi_handle(vpiExpr,path_t_in);
-	    vpiHandle path_out = vpi_handle(vpiExpr,path_t_out);
-
-	      /* The expressions for the path terms must be signals,
-	         vpiNet or vpiReg. */
-	    assert(vpi_get(vpiType,path_in) == vpiNet);
-	    assert(vpi_get(vpiType,path_out) == vpiNet
-		   || vpi_get(vpiType,path_out) == vpiReg);
-
 	      /* If the src name doesn't match, go on. */
-	    if (strcmp(src,vpi_get_str(vpiName,path_in)) != 0)
+	    if (strcmp(src,cur->src) != 0)
 		  continue;
 	      /* The edge type must match too. But note that if this
 	         IOPATH has no edge, then it matches with all edges of
 	         the modpath object. */
 /* --> Is this correct in the context of the 10, 01, etc. edges? */
-	    if (vpi_edge != vpiNoEdge && vpi_get(vpiEdge,path_t_in) != vpi_edge)
+	    if (vpi_edge != vpiNoEdge && cur->edge != vpi_edge)
 		  continue;
 
 	      /* If the dst name doesn't match, go on. */
-	    if (strcmp(dst,vpi_get_str(vpiName,path_out)) != 0)
+	    if (strcmp(dst,cur->dst) != 0)
 		  continue;
 
 	      /* Ah, this must be a match! */
@@ -187,7 +306,7 @@ void sdf_iopath_delays(int vpi_edge, const char*src, const char*dst,
 	    delays.mtm_flag = 0;
 	    delays.append_flag = 0;
 	    delays.plusere_flag = 0;
-	    vpi_get_delays(path, &delays);
+	    vpi_get_delays(cur->path, &delays);
 
 	    for (idx = 0 ; idx < delval_list->count ; idx += 1) {
 		  delay_vals[idx].type = vpiScaledRealTime;
@@ -196,7 +315,7 @@ void sdf_iopath_delays(int vpi_edge, const char*src, const char*dst,
 		  }
 	    }
 
-	    vpi_put_delays(path, &delays);
+	    vpi_put_delays(cur->path, &delays);
 	    match_count += 1;
       }
 
@@ -39,14 +39,29 @@ struct vcd_info {
       vpiHandle cb;
       struct t_vpi_time time;
       const char *ident;
+	/* Full name of the containing scope, for subtree toggles. */
+      const char *scope_name;
       struct vcd_info *next;
       struct vcd_info *dmp_next;
       int scheduled;
+      int enabled;
 };
 
 
 static struct vcd_info *vcd_list = NULL;
 static struct vcd_info *vcd_dmp_list = NULL;
+
+/*
+ * The monitored items, indexed by scope name, so that $dumpoff and
+ * $dumpon with scope arguments can flip a subtree without walking
+ * the design again. The index is built once from the vcd_list after
+ * the header scan; items of one subtree are contiguous in the sorted
+ * order, so a toggle is a binary search plus a sweep of the covered
+ * range. The value-change callbacks stay installed throughout; a
+ * disabled item just drops its changes at the top of the callback.
+ */
+static struct vcd_info **scope_index = NULL;
+static unsigned scope_index_cnt = 0;
 static PLI_UINT64 vcd_cur_time = 0;
 static int dump_is_off = 0;
 static long dump_limit = 0;
@@ -163,7 +178,7 @@ static void vcd_checkpoint()
       struct vcd_info*cur;
 
       for (cur = vcd_list ;  cur ;  cur = cur->next)
-	    show_this_item(cur);
+	    if (cur->enabled) show_this_item(cur);
 }
 
 static void vcd_checkpoint_x()
@@ -171,7 +186,94 @@ static void vcd_checkpoint_x()
       struct vcd_info*cur;
 
       for (cur = vcd_list ;  cur ;  cur = cur->next)
-	    show_this_item_x(cur);
+	    if (cur->enabled) show_this_item_x(cur);
+}
+
+static int scope_index_compare(const void*l, const void*r)
+{
+      const struct vcd_info*lp = *(const struct vcd_info*const*)l;
+      const struct vcd_info*rp = *(const struct vcd_info*const*)r;
+      return strcmp(lp->scope_name, rp->scope_name);
+}
+
+static void build_scope_index(void)
+{
+      struct vcd_info*cur;
+      unsigned idx;
+
+      scope_index_cnt = 0;
+      for (cur = vcd_list ;  cur ;  cur = cur->next)
+	    scope_index_cnt += 1;
+      if (scope_index_cnt == 0) return;
+
+      scope_index = malloc(scope_index_cnt * sizeof(struct vcd_info*));
+      idx = 0;
+      for (cur = vcd_list ;  cur ;  cur = cur->next)
+	    scope_index[idx++] = cur;
+
+      qsort(scope_index, scope_index_cnt, sizeof(struct vcd_info*),
+            scope_index_compare);
+}
+
+/*
+ * Flip the enable of every item at or below the named scope. When
+ * emit_flag is set, the new state is also written to the dump file:
+ * x values for a disabled subtree, the current values when it comes
+ * back on.
+ */
+static void set_scope_dump_enable(const char*prefix, int enable,
+                                  int emit_flag)
+{
+      size_t len = strlen(prefix);
+      unsigned lo, hi, idx;
+
+	/* Before the header callback the item list is still growing,
+	 * so walk it directly instead of fixing the index early. */
+      if (dump_header_pending()) {
+	    struct vcd_info*cur;
+	    for (cur = vcd_list ;  cur ;  cur = cur->next) {
+		  if (strncmp(cur->scope_name, prefix, len) != 0)
+			continue;
+		  if (cur->scope_name[len] != 0 && cur->scope_name[len] != '.')
+			continue;
+		  cur->enabled = enable;
+	    }
+	    return;
+      }
+
+      if (scope_index == 0) build_scope_index();
+      if (scope_index_cnt == 0) return;
+
+	/* Find the first entry with scope_name >= prefix. Every
+	 * entry under the scope starts with the prefix, so the
+	 * covered range begins here. */
+      lo = 0;
+      hi = scope_index_cnt;
+      while (lo < hi) {
+	    unsigned mid = lo + (hi-lo)/2;
+	    if (strcmp(scope_index[mid]->scope_name, prefix) < 0)
+		  lo = mid + 1;
+	    else
+		  hi = mid;
+      }
+
+      for (idx = lo ;  idx < scope_index_cnt ;  idx += 1) {
+	    struct vcd_info*info = scope_index[idx];
+	    if (strncmp(info->scope_name, prefix, len) != 0)
+		  break;
+	      /* Only match on a scope boundary, so "top.cpu" does
+	       * not cover "top.cpuif". */
+	    if (info->scope_name[len] != 0 && info->scope_name[len] != '.')
+		  continue;
+	    if (info->enabled == enable)
+		  continue;
+
+	    info->enabled = enable;
+	    if (emit_flag) {
+		  if (enable) show_this_item(info);
+		  else show_this_item_x(info);
+	    }
+      }
 }
 
 static PLI_INT32 variable_cb_2(p_cb_data cause)
@@ -201,6 +303,7 @@ static PLI_INT32 variable_cb_1(p_cb_data cause)
 
       if (dump_is_full) return 0;
       if (dump_is_off) return 0;
+      if (! info->enabled) return 0;
       if (dump_header_pending()) return 0;
       if (info->scheduled) return 0;
 
@@ -267,9 +370,13 @@ static PLI_INT32 finish_cb(p_cb_data cause)
       for (cur = vcd_list ;  cur ;  cur = next) {
 	    next = cur->next;
 	    free((char *)cur->ident);
+	    free((char *)cur->scope_name);
 	    free(cur);
       }
       vcd_list = 0;
+      free(scope_index);
+      scope_index = 0;
+      scope_index_cnt = 0;
       vcd_names_delete(&vcd_tab);
       vcd_names_delete(&vcd_var);
       nexus_ident_delete();
@@ -311,11 +418,66 @@ __inline__ static int install_dumpvars_callback(void)
       return 0;
 }
 
+/*
+ * $dumpoff and $dumpon with scope arguments toggle only the named
+ * subtrees, against the persistent scope index, instead of the whole
+ * dump. The callbacks are never torn down or re-registered, so the
+ * toggle costs only the index lookup and the values written.
+ */
+static PLI_INT32 dump_scope_toggle(vpiHandle callh,
+                                   ICARUS_VPI_CONST PLI_BYTE8*name,
+                                   vpiHandle argv, int enable)
+{
+      s_vpi_time now;
+      PLI_UINT64 now64;
+      vpiHandle arg;
+      int emit_flag = dump_file != 0 && ! dump_header_pending()
+                      && ! dump_is_off && ! dump_is_full;
+
+      if (emit_flag) {
+	    now.type = vpiSimTime;
+	    vpi_get_time(0, &now);
+	    now64 = timerec_to_time64(&now);
+
+	    if (now64 > vcd_cur_time) {
+		  fprintf(dump_file, "#%" PLI_UINT64_FMT "\n", now64);
+		  vcd_cur_time = now64;
+	    }
+      }
+
+      while ((arg = vpi_scan(argv)) != 0) {
+	    const char*fullname = vpi_get_str(vpiFullName, arg);
+	    char*prefix;
+
+	    if (fullname == 0) {
+		  vpi_printf("VCD warning: %s:%d: %s argument has no "
+		             "full name, ignored.\n",
+		             vpi_get_str(vpiFile, callh),
+		             (int)vpi_get(vpiLineNo, callh), name);
+		  continue;
+	    }
+
+	      /* The vpi_get_str() buffer is reused by the value
+	       * reads below, so work from a copy. */
+	    prefix = strdup(fullname);
+	    set_scope_dump_enable(prefix, enable, emit_flag);
+	    free(prefix);
+      }
+
+      return 0;
+}
+
 static PLI_INT32 sys_dumpoff_calltf(ICARUS_VPI_CONST PLI_BYTE8*name)
 {
       s_vpi_time now;
       PLI_UINT64 now64;
 
+      {
+	    vpiHandle callh = vpi_handle(vpiSysTfCall, 0);
+	    vpiHandle argv = vpi_iterate(vpiArgument, callh);
+	    if (argv) return dump_scope_toggle(callh, name, argv, 0);
+      }
+
       if (dump_is_off) return 0;
 
       dump_is_off = 1;
@@ -344,6 +506,12 @@ static PLI_INT32 sys_dumpon_calltf(ICARUS_VPI_CONST PLI_BYTE8*name)
       s_vpi_time now;
       PLI_UINT64 now64;
 
+      {
+	    vpiHandle callh = vpi_handle(vpiSysTfCall, 0);
+	    vpiHandle argv = vpi_iterate(vpiArgument, callh);
+	    if (argv) return dump_scope_toggle(callh, name, argv, 1);
+      }
+
       if (!dump_is_off) return 0;
 
       dump_is_off = 0;
@@ -367,6 +535,37 @@ static PLI_INT32 sys_dumpon_calltf(ICARUS_VPI_CONST PLI_BYTE8*name)
       return 0;
 }
 
+/*
+ * $dumpoff/$dumpon take either no argument (the whole dump) or a
+ * list of scopes (subtree toggles).
+ */
+static PLI_INT32 sys_dumpoffon_compiletf(ICARUS_VPI_CONST PLI_BYTE8*name)
+{
+      vpiHandle callh = vpi_handle(vpiSysTfCall, 0);
+      vpiHandle argv = vpi_iterate(vpiArgument, callh);
+      vpiHandle arg;
+
+      if (argv == 0) return 0;
+
+      while ((arg = vpi_scan(argv)) != 0) {
+	    switch (vpi_get(vpiType, arg)) {
+		case vpiModule:
+		case vpiTask:
+		case vpiFunction:
+		case vpiNamedBegin:
+		case vpiNamedFork:
+		  break;
+		default:
+		  vpi_printf("ERROR: %s:%d: ", vpi_get_str(vpiFile, callh),
+		             (int)vpi_get(vpiLineNo, callh));
+		  vpi_printf("%s argument must be a scope.\n", name);
+		  vpi_control(vpiFinish, 1);
+	    }
+      }
+
+      return 0;
+}
+
 static PLI_INT32 sys_dumpall_calltf(ICARUS_VPI_CONST PLI_BYTE8*name)
 {
       s_vpi_time now;
@@ -405,11 +604,17 @@ static void open_dumpfile(vpiHandle callh)
 	    vpi_control(vpiFinish, 1);
 	    return;
       } else {
+	    static char dump_buffer[256*1024];
 	    int prec = vpi_get(vpiTimePrecision, 0);
 	    unsigned scale = 1;
 	    unsigned udx = 0;
 	    time_t walltime;
 
+	      /* Give the dump file a large stdio buffer, so that the
+	       * header (and the value changes that follow) stream out
+	       * in large writes instead of a syscall per record. */
+	    setvbuf(dump_file, dump_buffer, _IOFBF, sizeof(dump_buffer));
+
 	    vpi_printf("VCD info: dumpfile %s opened for output.\n",
 	               dump_path);
 
@@ -504,6 +709,7 @@ static void scan_item(unsigned depth, vpiHandle item, int skip)
       const char *fullname;
       const char *prefix;
       const char *ident;
+      char *scope_name = 0;
       int nexus_id;
       unsigned size;
       PLI_INT32 item_type;
@@ -626,6 +832,15 @@ static void scan_item(unsigned depth, vpiHandle item, int skip)
 	       * This can only happen for implicitly given signals. */
 	    if (vcd_names_search(&vcd_var, fullname)) return;
 
+	      /* Capture the scope name for the subtree toggle index,
+	       * before the vpi_get_str() buffer is reused below. */
+	    {
+		  vpiHandle item_scope = vpi_handle(vpiScope, item);
+		  scope_name = strdup(item_scope ?
+		                      vpi_get_str(vpiFullName, item_scope) :
+		                      "");
+	    }
+
 	      /* Declare the variable in the VCD file. */
 	    name = vpi_get_str(vpiName, item);
 	    prefix = is_escaped_id(name) ? "\\" : "";
@@ -648,7 +863,10 @@ static void scan_item(unsigned depth, vpiHandle item, int skip)
 		  info->time.type = vpiSimTime;
 		  info->item  = item;
 		  info->ident = ident;
+		  info->scope_name = scope_name;
+		  scope_name = 0;
 		  info->scheduled = 0;
+		  info->enabled = 1;
 
 		  cb.time      = &info->time;
 		  cb.user_data = (char*)info;
@@ -681,6 +899,9 @@ static void scan_item(unsigned depth, vpiHandle item, int skip)
 	    }
 
 	    fprintf(dump_file, " $end\n");
+	      /* The scope name is owned by the vcd_info now; this
+	       * only releases it for the nexus-alias case. */
+	    free(scope_name);
 	    break;
 
 	  case vpiModule:
@@ -834,8 +1055,6 @@ static PLI_INT32 sys_dumpvars_calltf(ICARUS_VPI_CONST PLI_BYTE8*name)
 	    dep = draw_scope(item, callh);
 
 	    scan_item(depth, item, 0);
-	      /* The scope list must be sorted after we scan an item.  */
-	    vcd_names_sort(&vcd_tab);
 
 	    while (dep--) fprintf(dump_file, "$upscope $end\n");
 
@@ -844,7 +1063,6 @@ static PLI_INT32 sys_dumpvars_calltf(ICARUS_VPI_CONST PLI_BYTE8*name)
 	       * been added */
 	    if (add_var) {
 		  vcd_names_add(&vcd_var, vpi_get_str(vpiFullName, item));
-		  vcd_names_sort(&vcd_var);
 	    }
       }
 
@@ -897,7 +1115,7 @@ void sys_vcd_register()
       tf_data.type      = vpiSysTask;
       tf_data.tfname    = "$dumpoff";
       tf_data.calltf    = sys_dumpoff_calltf;
-      tf_data.compiletf = sys_no_arg_compiletf;
+      tf_data.compiletf = sys_dumpoffon_compiletf;
       tf_data.sizetf    = 0;
       tf_data.user_data = "$dumpoff";
       res = vpi_register_systf(&tf_data);
@@ -906,7 +1124,7 @@ void sys_vcd_register()
       tf_data.type      = vpiSysTask;
       tf_data.tfname    = "$dumpon";
       tf_data.calltf    = sys_dumpon_calltf;
-      tf_data.compiletf = sys_no_arg_compiletf;
+      tf_data.compiletf = sys_dumpoffon_compiletf;
       tf_data.sizetf    = 0;
       tf_data.user_data = "$dumpon";
       res = vpi_register_systf(&tf_data);
@@ -145,54 +145,159 @@ static PLI_INT32 ivl_enum_method_next_prev_compiletf(ICARUS_VPI_CONST PLI_BYTE8*
 }
 
 /*
- * Compare it two values are equal to each other.
+ * Value-to-member lookup cache, one per enumeration typespec. The
+ * typespec handle is shared by every variable of the type, so a single
+ * cache serves them all. The cache is built the first time a method
+ * touches the type, by iterating the member list once, and is never
+ * invalidated since the member values are constants. With the cache in
+ * place the name()/next()/prev() methods cost one hash probe instead
+ * of a scan over the member list, which matters for enumerations with
+ * thousands of members.
  */
-static int compare_value_eequal(s_vpi_value*ref1, s_vpi_value*ref2,
-                                PLI_INT32 wid)
+
+struct enum_member_s {
+      char*name;
+      p_vpi_vecval bits;
+      struct enum_member_s*val_next;
+};
+
+struct enum_cache_s {
+      vpiHandle type;
+      PLI_INT32 width;
+      PLI_INT32 words;
+      PLI_UINT32 size;
+	/* The members, in declaration order. */
+      struct enum_member_s*members;
+	/* Hash from member value to member. The size is a power of
+	 * two, and the chains hang off the val_next links above. */
+      PLI_UINT32 hash_size;
+      struct enum_member_s**val_hash;
+      struct enum_cache_s*next;
+};
+
+static struct enum_cache_s*enum_cache_list = 0;
+
+static PLI_UINT32 enum_value_hash(p_vpi_vecval bits, PLI_INT32 words)
 {
-	/* Two integer values are easy. */
-      if (ref1->format == vpiIntVal && ref2->format == vpiIntVal)
-	    return ref1->value.integer == ref2->value.integer;
-
-	/* For two vectors compare them word by word. */
-      if (ref1->format == vpiVectorVal && ref2->format == vpiVectorVal) {
-	    PLI_INT32 words = (wid-1)/32 + 1;
-	    PLI_INT32 idx;
-
-	    for (idx = 0 ; idx < words ; idx += 1) {
-		  if (ref1->value.vector[idx].aval !=
-		      ref2->value.vector[idx].aval) return 0;
-		  if (ref1->value.vector[idx].bval !=
-		      ref2->value.vector[idx].bval) return 0;
-	    }
-	    return 1;
-      }
+      PLI_UINT32 hash = 0;
+      PLI_INT32 idx;
 
-	/* Swap the order so the code below can be used. */
-      if (ref1->format == vpiVectorVal && ref2->format == vpiIntVal) {
-	    s_vpi_value*tmp = ref1;
-	    ref1 = ref2;
-	    ref2 = tmp;
+      for (idx = 0 ; idx < words ; idx += 1) {
+	    hash = hash*0x9e3779b1u + (PLI_UINT32)bits[idx].aval;
+	    hash = hash*0x9e3779b1u + (PLI_UINT32)bits[idx].bval;
       }
+      return hash;
+}
 
-	/* Compare an integer to a vector. */
-      if (ref1->format == vpiIntVal && ref2->format == vpiVectorVal) {
-	    PLI_INT32 aval = ref1->value.integer;
-	    PLI_INT32 words = (wid-1)/32 + 1;
-	    PLI_INT32 idx;
+static struct enum_cache_s*get_enum_cache(vpiHandle arg_enum)
+{
+      struct enum_cache_s*cache, *prev;
+      vpiHandle enum_list, cur;
+      PLI_UINT32 idx;
+
+	/* Look for an already built cache. Move a hit to the front of
+	 * the list, since calls tend to touch the same type in runs. */
+      prev = 0;
+      for (cache = enum_cache_list ; cache ; prev = cache, cache = cache->next) {
+	    if (cache->type == arg_enum) {
+		  if (prev) {
+			prev->next = cache->next;
+			cache->next = enum_cache_list;
+			enum_cache_list = cache;
+		  }
+		  return cache;
+	    }
+      }
 
-	    for (idx = 0 ; idx < words ; idx += 1) {
-		  if (aval != ref2->value.vector[idx].aval) return 0;
-		  if (ref2->value.vector[idx].bval) return 0;
+	/* Not seen before, so build the cache from the member list. */
+      cache = (struct enum_cache_s*) malloc(sizeof(struct enum_cache_s));
+      assert(cache);
+      cache->type = arg_enum;
+      cache->width = 0;
+      cache->words = 0;
+      cache->size = vpi_get(vpiSize, arg_enum);
+      cache->members = (struct enum_member_s*)
+	    calloc(cache->size, sizeof(struct enum_member_s));
+      cache->hash_size = 1;
+      while (cache->hash_size < 2*cache->size)
+	    cache->hash_size <<= 1;
+      cache->val_hash = (struct enum_member_s**)
+	    calloc(cache->hash_size, sizeof(struct enum_member_s*));
+      assert(cache->members && cache->val_hash);
 
-		  aval = 0;
+      enum_list = vpi_iterate(vpiEnumConst, arg_enum);
+      assert(enum_list);
+      idx = 0;
+      while ((cur = vpi_scan(enum_list)) != 0) {
+	    struct enum_member_s*memb;
+	    s_vpi_value val;
+	    PLI_UINT32 slot;
+	    PLI_INT32 wdx;
+
+	    assert(idx < cache->size);
+	    memb = cache->members + idx;
+
+	    if (idx == 0) {
+		  cache->width = vpi_get(vpiSize, cur);
+		  cache->words = (cache->width - 1)/32 + 1;
+	    }
+	    assert(cache->width == vpi_get(vpiSize, cur));
+
+	    memb->name = strdup(vpi_get_str(vpiName, cur));
+	    memb->bits = (p_vpi_vecval)
+		  malloc(cache->words * sizeof(s_vpi_vecval));
+	    assert(memb->name && memb->bits);
+
+	    val.format = vpiVectorVal;
+	    vpi_get_value(cur, &val);
+	    for (wdx = 0 ; wdx < cache->words ; wdx += 1) {
+		  memb->bits[wdx].aval = val.value.vector[wdx].aval;
+		  memb->bits[wdx].bval = val.value.vector[wdx].bval;
 	    }
-	    return 1;
+
+	    slot = enum_value_hash(memb->bits, cache->words)
+		 & (cache->hash_size - 1);
+	    memb->val_next = cache->val_hash[slot];
+	    cache->val_hash[slot] = memb;
+
+	    idx += 1;
       }
+      assert(idx == cache->size);
+
+      cache->next = enum_cache_list;
+      enum_cache_list = cache;
+      return cache;
+}
 
-	/* Unsupported types. */
-      vpi_printf("XXXX formats are: %d vs %d\n", ref1->format, ref2->format);
-      assert(0);
+/*
+ * Find the member with the given value, or return 0 if the value does
+ * not name a member. If loc is given, it receives the position of the
+ * member in declaration order.
+ */
+static struct enum_member_s*find_enum_value(struct enum_cache_s*cache,
+                                            p_vpi_vecval bits,
+                                            PLI_UINT32*loc)
+{
+      struct enum_member_s*memb;
+      PLI_UINT32 slot = enum_value_hash(bits, cache->words)
+	    & (cache->hash_size - 1);
+
+      for (memb = cache->val_hash[slot] ; memb ; memb = memb->val_next) {
+	    PLI_INT32 wdx;
+	    int match = 1;
+
+	    for (wdx = 0 ; wdx < cache->words ; wdx += 1) {
+		  if (memb->bits[wdx].aval != bits[wdx].aval ||
+		      memb->bits[wdx].bval != bits[wdx].bval) {
+			match = 0;
+			break;
+		  }
+	    }
+	    if (match) {
+		  if (loc) *loc = (PLI_UINT32)(memb - cache->members);
+		  return memb;
+	    }
+      }
       return 0;
 }
 
@@ -234,8 +339,8 @@ static PLI_INT32 ivl_enum_method_next_prev_calltf(PLI_BYTE8*name)
       vpiHandle arg_var = vpi_scan(argv);
       vpiHandle arg_count = vpi_scan(argv);
 
-      vpiHandle enum_list;
-      vpiHandle cur;
+      struct enum_cache_s*cache;
+      struct enum_member_s*memb;
       PLI_INT32 var_width = vpi_get(vpiSize, arg_var);
       PLI_UINT32 enum_size = vpi_get(vpiSize, arg_enum);
       PLI_UINT32 count = 1;
@@ -257,8 +362,14 @@ static PLI_INT32 ivl_enum_method_next_prev_calltf(PLI_BYTE8*name)
 	    vpi_free_object(argv);
       }
 
+	/* Get the lookup cache for the type before reading the
+	 * variable, since building the cache makes vpi_get_value()
+	 * calls of its own that would trash the value buffer. */
+      cache = get_enum_cache(arg_enum);
+      assert(var_width == cache->width);
+
 	/* Get the current value. */
-      var_val.format = vpiObjTypeVal;
+      var_val.format = vpiVectorVal;
       vpi_get_value(arg_var, &var_val);
 
 	/* If the count is zero then just return the current value. */
@@ -267,84 +378,25 @@ static PLI_INT32 ivl_enum_method_next_prev_calltf(PLI_BYTE8*name)
 	    return 0;
       }
 
-	/* If the current value is a vector, then make a safe copy of
-	   it so that other vpi_get_value() calls don't trash the value. */
-      if (var_val.format == vpiVectorVal) {
-	    PLI_INT32 idx;
-	    PLI_INT32 words = (var_width - 1)/32 + 1;
-	    p_vpi_vecval nvec = malloc(words*sizeof(s_vpi_vecval));
-	    for (idx = 0 ; idx < words ; idx += 1) {
-		  nvec[idx].aval = var_val.value.vector[idx].aval;
-		  nvec[idx].bval = var_val.value.vector[idx].bval;
-	    }
-	    var_val.value.vector = nvec;
-      }
-
-	/* Search for the current value in the enumeration list. */
-      enum_list = vpi_iterate(vpiEnumConst, arg_enum);
-      assert(enum_list);
-      do {
-	    cur = vpi_scan(enum_list);
-	    if (cur == 0) break;
-
-	    cur_val.format = vpiObjTypeVal;
-	    vpi_get_value(cur, &cur_val);
-	    assert(var_width == vpi_get(vpiSize, cur));
-	    loc += 1;
-      } while (! compare_value_eequal(&cur_val, &var_val, var_width));
-
-	/* If the variable is a vector then free the copy we created above. */
-      if (var_val.format == vpiVectorVal) free(var_val.value.vector);
+	/* Look up the current value in the member table. */
+      memb = find_enum_value(cache, var_val.value.vector, &loc);
 
 	/* The current value was not found in the list so return X/0. */
-      if (cur == 0) {
+      if (memb == 0) {
 	      /* This only works correctly since we don't really define the
 	       * the correct base typespec. */
 	    int is_two_state = vpi_get(vpiBaseTypespec, arg_enum) != vpiReg;
 	    fill_handle_with_init(sys, is_two_state);
       } else {
 	    if (strcmp(name, "$ivl_enum_method$next") == 0) {
-		    /* Check to see if we need to wrap to the beginning. */
-		  if (loc + count > enum_size) {
-			  /* Free the current iterator before creating a new
-			   * one that is at the beginning of the list. */
-			vpi_free_object(enum_list);
-			enum_list = vpi_iterate(vpiEnumConst, arg_enum);
-			assert(enum_list);
-			count -= (enum_size - loc);
-		  }
+		  loc = (loc + count) % enum_size;
 	    } else if (strcmp(name, "$ivl_enum_method$prev") == 0) {
-		    /* Because of wrapping the count could be either before
-		     * or after the current element. */
-		  if (loc <= count ) {
-			  /* The element we want is after the current
-			   * element. */
-			count = enum_size - count;
-		  } else {
-			  /* The element we want is before the current
-			   * element (at the beginning of the list). Free
-			   * the current iterator before creating a new
-			   * one that is at the beginning of the list. */
-			vpi_free_object(enum_list);
-			enum_list = vpi_iterate(vpiEnumConst, arg_enum);
-			assert(enum_list);
-			count = loc - count;
-		  }
+		  loc = (loc + enum_size - count) % enum_size;
 	    } else assert(0);
 
-	      /* Find the correct element. */
-	    while (count) {
-		  cur = vpi_scan(enum_list);
-		  count -= 1;
-	    }
-	    assert(cur != 0);
-
-	      /* Free the iterator. */
-	    vpi_free_object(enum_list);
-
-	      /* Get the value and return it. */
-	    cur_val.format = vpiObjTypeVal;
-	    vpi_get_value(cur, &cur_val);
+	      /* Return the value of the selected element. */
+	    cur_val.format = vpiVectorVal;
+	    cur_val.value.vector = cache->members[loc].bits;
 	    vpi_put_value(sys, &cur_val, 0, vpiNoDelay);
       }
 
@@ -438,8 +490,8 @@ static PLI_INT32 ivl_enum_method_name_calltf(PLI_BYTE8*name)
       vpiHandle arg_enum = vpi_scan(argv);
       vpiHandle arg_var = vpi_scan(argv);
 
-      vpiHandle enum_list;
-      vpiHandle cur;
+      struct enum_cache_s*cache;
+      struct enum_member_s*memb;
       PLI_INT32 var_width = vpi_get(vpiSize, arg_var);
 
       s_vpi_value cur_val, var_val;
@@ -447,49 +499,21 @@ static PLI_INT32 ivl_enum_method_name_calltf(PLI_BYTE8*name)
 	/* Free the argument iterator. */
       vpi_free_object(argv);
 
+	/* Get the lookup cache for the type before reading the
+	 * variable, since building the cache makes vpi_get_value()
+	 * calls of its own that would trash the value buffer. */
+      cache = get_enum_cache(arg_enum);
+      assert(var_width == cache->width);
+
 	/* Get the current value. */
-      var_val.format = vpiObjTypeVal;
+      var_val.format = vpiVectorVal;
       vpi_get_value(arg_var, &var_val);
 
-	/* If the current value is a vector, then make a safe copy of
-	   it so that other vpi_get_value() calls don't trash the value. */
-      if (var_val.format == vpiVectorVal) {
-	    PLI_INT32 idx;
-	    PLI_INT32 words = (var_width - 1)/32 + 1;
-	    p_vpi_vecval nvec = malloc(words*sizeof(s_vpi_vecval));
-	    for (idx = 0 ; idx < words ; idx += 1) {
-		  nvec[idx].aval = var_val.value.vector[idx].aval;
-		  nvec[idx].bval = var_val.value.vector[idx].bval;
-	    }
-	    var_val.value.vector = nvec;
-      }
-
-	/* Search for the current value in the enumeration list. */
-      enum_list = vpi_iterate(vpiEnumConst, arg_enum);
-      assert(enum_list);
-      do {
-	    cur = vpi_scan(enum_list);
-	    if (cur == 0) break;
-
-	    cur_val.format = vpiObjTypeVal;
-	    vpi_get_value(cur, &cur_val);
-	    assert(var_width == vpi_get(vpiSize, cur));
-      } while (! compare_value_eequal(&cur_val, &var_val, var_width));
-
-	/* If the variable is a vector then free the copy we created above. */
-      if (var_val.format == vpiVectorVal) free(var_val.value.vector);
-
-	/* The current value was not found in the list so return an empty
-	 * string. */
+	/* Look up the current value in the member table. If the value
+	 * is not a member, return an empty string. */
+      memb = find_enum_value(cache, var_val.value.vector, 0);
       cur_val.format = vpiStringVal;
-      if (cur == 0) {
-	    cur_val.value.str = "";
-      } else {
-	    cur_val.value.str = vpi_get_str(vpiName, cur);
-
-	      /* Free the iterator. */
-	    vpi_free_object(enum_list);
-      }
+      cur_val.value.str = memb? memb->name : "";
 
 	/* Return the appropriate string value. */
       vpi_put_value(sys, &cur_val, 0, vpiNoDelay);
@@ -49,85 +49,91 @@ int is_escaped_id(const char *name)
 
 struct stringheap_s name_heap = {0, 0};
 
-struct vcd_names_s {
-      const char *name;
-      struct vcd_names_s *next;
-};
+/*
+ * The name tables are open addressed hash sets. The strings
+ * themselves live in the name_heap string arena, so adding a name
+ * costs one arena copy and one table slot, and searching never
+ * allocates. The table starts out presized for a reasonably large
+ * design and is doubled whenever it reaches half full, so
+ * registering all the names of a design is linear in the number of
+ * names. Names are visible to vcd_names_search as soon as they are
+ * added.
+ */
+#define VCD_NAMES_HASH_MIN 4096
 
-void vcd_names_add(struct vcd_names_list_s*tab, const char *name)
+static unsigned vcd_names_hash(const char *text)
 {
-      struct vcd_names_s *nl = (struct vcd_names_s *)
-	    malloc(sizeof(struct vcd_names_s));
-      nl->name = strdup_sh(&name_heap, name);
-      nl->next = tab->vcd_names_list;
-      tab->vcd_names_list = nl;
-      tab->listed_names ++;
+      unsigned hash = 5381;
+      while (*text)
+	    hash = hash*33 + (unsigned char) *(text++);
+      return hash;
 }
 
-void vcd_names_delete(struct vcd_names_list_s*tab)
+static void vcd_names_resize(struct vcd_names_list_s*tab, unsigned size)
 {
-      struct vcd_names_s *cur, *tmp;
-      for (cur = tab->vcd_names_list; cur; cur = tmp) {
-	    tmp = cur->next;
-	    free(cur);
+      const char **old_table = tab->hash_table;
+      unsigned old_size = tab->hash_size;
+      unsigned idx;
+
+      tab->hash_table = (const char **) calloc(size, sizeof(const char *));
+      tab->hash_size = size;
+
+      for (idx = 0; idx < old_size; idx += 1) {
+	    const char *name = old_table[idx];
+	    unsigned slot;
+	    if (name == 0) continue;
+	    slot = vcd_names_hash(name) & (size - 1);
+	    while (tab->hash_table[slot])
+		  slot = (slot + 1) & (size - 1);
+	    tab->hash_table[slot] = name;
       }
-      tab->vcd_names_list = 0;
-      tab->listed_names = 0;
-      free(tab->vcd_names_sorted);
-      tab->vcd_names_sorted = 0;
-      tab->sorted_names = 0;
-      string_heap_delete(&name_heap);
+      free(old_table);
 }
 
-static int vcd_names_compare(const void *s1, const void *s2)
+void vcd_names_add(struct vcd_names_list_s*tab, const char *name)
 {
-      const char *v1 = *(const char * const *) s1;
-      const char *v2 = *(const char * const *) s2;
+      unsigned slot;
+
+      if (2*tab->hash_count >= tab->hash_size)
+	    vcd_names_resize(tab, tab->hash_size ? 2*tab->hash_size
+	                                         : VCD_NAMES_HASH_MIN);
+
+      slot = vcd_names_hash(name) & (tab->hash_size - 1);
+      while (tab->hash_table[slot]) {
+	      /* The name is already in the table, so nothing to do. */
+	    if (strcmp(tab->hash_table[slot], name) == 0)
+		  return;
+	    slot = (slot + 1) & (tab->hash_size - 1);
+      }
 
-      return strcmp(v1, v2);
+      tab->hash_table[slot] = strdup_sh(&name_heap, name);
+      tab->hash_count += 1;
 }
 
-const char *vcd_names_search(struct vcd_names_list_s*tab, const char *key)
+void vcd_names_delete(struct vcd_names_list_s*tab)
 {
-      const char **v;
-
-      if (tab->vcd_names_sorted == 0)
-	    return 0;
-
-      v = (const char **) bsearch(&key,
-				  tab->vcd_names_sorted, tab->sorted_names,
-				  sizeof(const char *), vcd_names_compare );
-
-      return(v ? *v : NULL);
+      free(tab->hash_table);
+      tab->hash_table = 0;
+      tab->hash_size = 0;
+      tab->hash_count = 0;
+      string_heap_delete(&name_heap);
 }
 
-void vcd_names_sort(struct vcd_names_list_s*tab)
+const char *vcd_names_search(struct vcd_names_list_s*tab, const char *key)
 {
-      if (tab->listed_names) {
-	    struct vcd_names_s *r;
-	    const char **l;
-
-	    tab->sorted_names += tab->listed_names;
-	    tab->vcd_names_sorted = (const char **)
-		  realloc(tab->vcd_names_sorted,
-			  tab->sorted_names*(sizeof(const char *)));
-
-	    l = tab->vcd_names_sorted + tab->sorted_names - tab->listed_names;
-	    tab->listed_names = 0;
-
-	    r = tab->vcd_names_list;
-	    tab->vcd_names_list = 0x0;
-
-	    while (r) {
-		  struct vcd_names_s *rr = r;
-		  r = rr->next;
-		  *(l++) = rr->name;
-		  free(rr);
-	    }
+      unsigned slot;
+
+      if (tab->hash_size == 0)
+	    return 0;
 
-	    qsort(tab->vcd_names_sorted, tab->sorted_names,
-		  sizeof(const char **), vcd_names_compare);
+      slot = vcd_names_hash(key) & (tab->hash_size - 1);
+      while (tab->hash_table[slot]) {
+	    if (strcmp(tab->hash_table[slot], key) == 0)
+		  return tab->hash_table[slot];
+	    slot = (slot + 1) & (tab->hash_size - 1);
       }
+
+      return 0;
 }
 
 /*
@@ -29,13 +29,16 @@
 
 EXTERN int is_escaped_id(const char *name);
 
-struct vcd_names_s;
 EXTERN struct stringheap_s name_heap;
 
+/*
+ * A name table is a hash set of names, with the strings stored in
+ * the name_heap arena. Names are visible to vcd_names_search as soon
+ * as they are added.
+ */
 struct vcd_names_list_s {
-      struct vcd_names_s *vcd_names_list;
-      const char **vcd_names_sorted;
-      int listed_names, sorted_names;
+      const char **hash_table;
+      unsigned hash_size, hash_count;
 };
 
 EXTERN void vcd_names_add(struct vcd_names_list_s*tab, const char *name);
@@ -43,8 +46,6 @@ EXTERN void vcd_names_add(struct vcd_names_list_s*tab, const char *name);
 EXTERN const char *vcd_names_search(struct vcd_names_list_s*tab,
 				    const char *key);
 
-EXTERN void vcd_names_sort(struct vcd_names_list_s*tab);
-
 EXTERN void vcd_names_delete();
 
 /*
@@ -0,0 +1,36 @@
+/* vpi/vpi_config.h.  Generated from vpi_config.h.in by configure.  */
+#ifndef __vpi_config_H
+#define __vpi_config_H
+/*
+ * Copyright (c) 2004-2010 Stephen Williams (steve@icarus.com)
+ *
+ *    This source code is free software; you can redistribute it
+ *    and/or modify it in source code form under the terms of the GNU
+ *    General Public License as published by the Free Software
+ *    Foundation; either version 2 of the License, or (at your option)
+ *    any later version.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this program; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* # undef HAVE_LIBIBERTY_H */
+# define HAVE_INTTYPES_H 1
+# define HAVE_LIBZ 1
+# define HAVE_LIBBZ2 1
+# define HAVE_FMIN 1
+# define HAVE_FMAX 1
+/* # undef WORDS_BIGENDIAN */
+
+# define _LARGEFILE_SOURCE 1
+#ifdef _LARGEFILE_SOURCE
+# define _FILE_OFFSET_BITS 64
+#endif
+
+#endif /* __config_H */
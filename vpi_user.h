@@ -484,6 +484,16 @@ typedef struct t_cb_data {
 #define cbInteractiveScopeChange 23
 #define cbUnresolvedSystf   24
 
+/* Icarus private callback reasons. These schedule a callback just
+   like cbReadWriteSynch/cbReadOnlySynch, but in the early or late
+   priority bucket of the phase. Early callbacks run before all
+   default callbacks of the same phase, and late callbacks run after
+   them; registration order is kept within a bucket. */
+#define _cbReadWriteSynchEarly 0x1000010
+#define _cbReadWriteSynchLate  0x1000011
+#define _cbReadOnlySynchEarly  0x1000012
+#define _cbReadOnlySynchLate   0x1000013
+
 extern vpiHandle vpi_register_cb(p_cb_data data);
 extern PLI_INT32 vpi_remove_cb(vpiHandle ref);
 
@@ -633,6 +643,38 @@ extern void vpip_make_systf_system_defined(vpiHandle ref);
 extern void vpip_count_drivers(vpiHandle ref, unsigned idx,
                                unsigned counts[4]);
 
+  /* Bulk transfer for dynamic arrays and queues. The 'ref' argument
+     should reference a dynamic array or queue object. Words are moved
+     in the layout reported by vpip_darray_word_size(): packed native
+     words for two-state element types, doubles for real arrays, and
+     aval/bval s_vpi_vecval groups for four-state element types. The
+     get/put routines copy up to 'cnt' words starting at index 'adr'
+     and return the number of words actually moved. A word size of 0
+     means the array cannot be transferred in bulk (e.g. strings).
+     vpip_darray_reserve() is a capacity hint for writers that are
+     about to push 'cnt' words onto a queue. */
+extern PLI_INT32 vpip_darray_word_size(vpiHandle ref);
+extern PLI_INT32 vpip_darray_get_words(vpiHandle ref, PLI_UINT32 adr,
+                                       PLI_UINT32 cnt, void*dst);
+extern PLI_INT32 vpip_darray_put_words(vpiHandle ref, PLI_UINT32 adr,
+                                       PLI_UINT32 cnt, const void*src);
+extern void vpip_darray_reserve(vpiHandle ref, PLI_UINT32 cnt);
+
+  /* Columnar aggregate sampling. Register a set of vector signal
+     handles once with vpip_sample_group_create(); each call to
+     vpip_sample_group_fill() then copies the current aval/bval
+     planes of every member into the caller's buffer, in
+     registration order, each member occupying (width+31)/32
+     s_vpi_vecval entries. vpip_sample_group_size() reports the
+     buffer size in entries. Create returns a group id, or -1 when
+     some handle is not a vector signal. This replaces a
+     vpi_get_value() call per counter per sample event with one
+     linear sweep over the group. */
+extern PLI_INT32 vpip_sample_group_create(vpiHandle*items, PLI_UINT32 cnt);
+extern PLI_INT32 vpip_sample_group_size(PLI_INT32 group_id);
+extern void vpip_sample_group_fill(PLI_INT32 group_id, p_vpi_vecval buf);
+extern void vpip_sample_group_delete(PLI_INT32 group_id);
+
 /*
  * Stopgap fix for br916. We need to reject any attempt to pass a thread
  * variable to $strobe or $monitor. To do this, we use some private VPI
@@ -582,14 +582,9 @@ void vvp_cmp_eeq::recv_vec4(vvp_net_ptr_t ptr, const vvp_vector4_t&bit,
       dispatch_operand_(ptr, bit);
 
       vvp_vector4_t eeq (1);
-      eeq.set_bit(0, BIT4_1);
 
       assert(op_a_.size() == op_b_.size());
-      for (unsigned idx = 0 ;  idx < op_a_.size() ;  idx += 1)
-	    if (op_a_.value(idx) != op_b_.value(idx)) {
-		  eeq.set_bit(0, BIT4_0);
-		  break;
-	    }
+      eeq.set_bit(0, op_a_.eeq(op_b_)? BIT4_1 : BIT4_0);
 
 
       vvp_net_t*net = ptr.ptr();
@@ -607,14 +602,9 @@ void vvp_cmp_nee::recv_vec4(vvp_net_ptr_t ptr, const vvp_vector4_t&bit,
       dispatch_operand_(ptr, bit);
 
       vvp_vector4_t eeq (1);
-      eeq.set_bit(0, BIT4_0);
 
       assert(op_a_.size() == op_b_.size());
-      for (unsigned idx = 0 ;  idx < op_a_.size() ;  idx += 1)
-	    if (op_a_.value(idx) != op_b_.value(idx)) {
-		  eeq.set_bit(0, BIT4_1);
-		  break;
-	    }
+      eeq.set_bit(0, op_a_.eeq(op_b_)? BIT4_0 : BIT4_1);
 
 
       vvp_net_t*net = ptr.ptr();
@@ -646,6 +636,13 @@ void vvp_cmp_eq::recv_vec4(vvp_net_ptr_t ptr, const vvp_vector4_t&bit,
       vvp_vector4_t res (1);
       res.set_bit(0, BIT4_1);
 
+	// Fully defined operands can be compared a word at a time.
+      if (! (op_a_.has_xz() || op_b_.has_xz())) {
+	    res.set_bit(0, op_a_.eeq(op_b_)? BIT4_1 : BIT4_0);
+	    ptr.ptr()->send_vec4(res, 0);
+	    return;
+      }
+
       for (unsigned idx = 0 ;  idx < op_a_.size() ;  idx += 1) {
 	    vvp_bit4_t a = op_a_.value(idx);
 	    vvp_bit4_t b = op_b_.value(idx);
@@ -694,6 +691,13 @@ void vvp_cmp_ne::recv_vec4(vvp_net_ptr_t ptr, const vvp_vector4_t&bit,
       vvp_vector4_t res (1);
       res.set_bit(0, BIT4_0);
 
+	// Fully defined operands can be compared a word at a time.
+      if (! (op_a_.has_xz() || op_b_.has_xz())) {
+	    res.set_bit(0, op_a_.eeq(op_b_)? BIT4_0 : BIT4_1);
+	    ptr.ptr()->send_vec4(res, 0);
+	    return;
+      }
+
       for (unsigned idx = 0 ;  idx < op_a_.size() ;  idx += 1) {
 	    vvp_bit4_t a = op_a_.value(idx);
 	    vvp_bit4_t b = op_b_.value(idx);
@@ -23,6 +23,7 @@
 # include  "vpi_priv.h"
 # include  "vvp_net_sig.h"
 # include  "vvp_darray.h"
+# include  "mem_stats.h"
 # include  "config.h"
 #ifdef CHECK_WITH_VALGRIND
 #include  "vvp_cleanup.h"
@@ -31,6 +32,7 @@
 # include  <cstring>
 # include  <climits>
 # include  <iostream>
+# include  <map>
 # include  "compile.h"
 # include  <cassert>
 # include  "ivl_alloc.h"
@@ -103,9 +105,16 @@ struct __vpiArray : public __vpiHandle {
 	// If this is a var array, then these are used instead of nets.
       vvp_vector4array_t*vals4;
       vvp_darray        *vals;
-      struct __vpiArrayWord*vals_words;
+	// Directory of word handle pages, created on demand. See
+	// array_word_handle() below.
+      struct __vpiArrayWord**vals_pages;
 
       vvp_fun_arrayport*ports_;
+	// Callbacks on individual words, indexed by the word
+	// address, so a write to one word only has to inspect the
+	// callbacks registered on that word.
+      std::map<unsigned long, struct __vpiCallback*> word_callbacks;
+	// Callbacks that watch every word of the array.
       struct __vpiCallback *vpi_callbacks;
       bool signed_flag;
       bool swap_addr;
@@ -297,7 +306,7 @@ struct __vpiArrayWord {
       };
 };
 
-static void array_make_vals_words(struct __vpiArray*parent);
+static vpiHandle array_word_handle(struct __vpiArray*parent, unsigned index);
 
 static vpiHandle array_index_scan(vpiHandle ref, int);
 
@@ -407,10 +416,7 @@ vpiHandle __vpiArray::vpi_index(int index)
 	    return nets[index];
       }
 
-      if (vals_words == 0)
-	    array_make_vals_words(this);
-
-      return &(vals_words[index].as_word);
+      return array_word_handle(this, index);
 }
 
 
@@ -434,9 +440,7 @@ vpiHandle __vpiArrayIterator::vpi_index(int)
 
       assert(array->vals4 || array->vals);
 
-      if (array->vals_words == 0) array_make_vals_words(array);
-
-      return &(array->vals_words[use_index].as_word);
+      return array_word_handle(array, use_index);
 }
 
 
@@ -563,28 +567,61 @@ static struct __vpiArrayWord* array_var_index_from_handle(vpiHandle ref)
       return (struct __vpiArrayWord*) (ref-1);
 }
 
-static void array_make_vals_words(struct __vpiArray*parent)
+/*
+ * The word handles of a variable array are created a page at a time,
+ * on demand. A VPI application that only looks at a few words of a
+ * million-word memory then only pays for the pages it touches,
+ * instead of getting a handle per word up front. Each page carries
+ * two header cells ahead of the words: the parent array, and the
+ * array index of the first word in the page (stored in the pointer
+ * cell of the union), so that decode_array_word_pointer can recover
+ * both from a bare word pointer without any per-word storage.
+ */
+static const unsigned ARRAY_WORDS_PAGE = 1024;
+
+static vpiHandle array_word_handle(struct __vpiArray*parent, unsigned index)
 {
-      assert(parent->vals_words == 0);
-      parent->vals_words = new struct __vpiArrayWord[parent->array_count + 1];
+      if (parent->vals_pages == 0) {
+	    unsigned pcnt = (parent->array_count + ARRAY_WORDS_PAGE - 1)
+		  / ARRAY_WORDS_PAGE;
+	    parent->vals_pages = new struct __vpiArrayWord*[pcnt];
+	    for (unsigned idx = 0 ;  idx < pcnt ;  idx += 1)
+		  parent->vals_pages[idx] = 0;
+      }
+
+      unsigned page = index / ARRAY_WORDS_PAGE;
+      unsigned off  = index % ARRAY_WORDS_PAGE;
 
-	// Make word[-1] point to the parent.
-      parent->vals_words->parent = parent;
-	// Now point to word-0
-      parent->vals_words += 1;
+      struct __vpiArrayWord*words = parent->vals_pages[page];
+      if (words == 0) {
+	    unsigned wcnt = parent->array_count - page*ARRAY_WORDS_PAGE;
+	    if (wcnt > ARRAY_WORDS_PAGE) wcnt = ARRAY_WORDS_PAGE;
 
-      struct __vpiArrayWord*words = parent->vals_words;
-      for (unsigned idx = 0 ; idx < parent->array_count ; idx += 1) {
-	    words[idx].word0 = words;
+	    words = new struct __vpiArrayWord[wcnt + 2];
+	      // Make word[-2] point to the parent...
+	    words[0].parent = parent;
+	      // ...and word[-1] carry the index of word 0 of this page.
+	    words[1].word0 = (struct __vpiArrayWord*)
+		  (unsigned long) (page * ARRAY_WORDS_PAGE);
+	      // Now point to word-0
+	    words += 2;
+
+	    for (unsigned idx = 0 ;  idx < wcnt ;  idx += 1)
+		  words[idx].word0 = words;
+
+	    parent->vals_pages[page] = words;
       }
+
+      return &(words[off].as_word);
 }
 
 static unsigned decode_array_word_pointer(struct __vpiArrayWord*word,
 					  struct __vpiArray*&parent)
 {
       struct __vpiArrayWord*word0 = word->word0;
-      parent = (word0 - 1) -> parent;
-      return word - word0;
+      parent = (word0 - 2) -> parent;
+      unsigned page_base = (unsigned) (unsigned long) (word0 - 1)->word0;
+      return page_base + (word - word0);
 }
 
 static int vpi_array_var_word_get(int code, vpiHandle ref)
@@ -1056,6 +1093,38 @@ void array_set_word(vvp_array_t arr, unsigned address, const string&val)
       array_word_change(arr, address);
 }
 
+/*
+ * Fill a run of words with the same value. This is the bulk path for
+ * the %arr/fill instruction, so it skips the per-word address and
+ * dispatch overhead of array_set_word. The per-word change
+ * notification still happens, so VPI callbacks and array ports see
+ * every word that changes.
+ */
+void array_fill_words(vvp_array_t arr, unsigned address, unsigned count,
+		      const vvp_vector4_t&val)
+{
+      unsigned idx;
+
+      if (address >= arr->array_count)
+	    return;
+      if (count > (arr->array_count - address))
+	    count = arr->array_count - address;
+
+      if (arr->vals4 && val.size() == arr->vals_width) {
+	    assert(arr->nets == 0);
+	    for (idx = 0 ;  idx < count ;  idx += 1) {
+		  arr->vals4->set_word(address+idx, val);
+		  array_word_change(arr, address+idx);
+	    }
+	    return;
+      }
+
+	/* Odd cases (nets arrays, mismatched widths) fall back to
+	   the general word store. */
+      for (idx = 0 ;  idx < count ;  idx += 1)
+	    array_set_word(arr, address+idx, 0, val);
+}
+
 vvp_vector4_t array_get_word(vvp_array_t arr, unsigned address)
 {
       if (arr->vals4) {
@@ -1185,7 +1254,7 @@ static vpiHandle vpip_make_array(char*label, const char*name,
       obj->vals4 = 0;
       obj->vals  = 0;
       obj->vals_width = 0;
-      obj->vals_words = 0;
+      obj->vals_pages = 0;
 
 	// Initialize (clear) the read-ports list.
       obj->ports_ = 0;
@@ -1267,6 +1336,12 @@ void compile_var_array(char*label, char*name, int last, int first,
       if (vpip_peek_current_scope()->is_automatic) {
             arr->vals4 = new vvp_vector4array_aa(arr->vals_width,
 						 arr->array_count);
+      } else if (arr->array_count > 16*vvp_vector4array_sp::PAGE_WORDS) {
+	      // Very large arrays are typically sparsely used memory
+	      // models, so use demand-paged storage for them instead
+	      // of allocating every word up front.
+            arr->vals4 = new vvp_vector4array_sp(arr->vals_width,
+						 arr->array_count);
       } else {
             arr->vals4 = new vvp_vector4array_sa(arr->vals_width,
 						 arr->array_count);
@@ -1274,6 +1349,15 @@ void compile_var_array(char*label, char*name, int last, int first,
       arr->msb.value = msb;
       arr->lsb.value = lsb;
 
+	// Estimate the word storage for the memory report. Each word
+	// has a pair of value words in the cell, plus separately
+	// allocated bit planes when the word is wide. For the
+	// demand-paged storage this is the full capacity, not the
+	// pages actually touched.
+      mem_stats_add(arr->scope, MEM_STATS_ARRAY,
+		    arr->array_count * (2*sizeof(unsigned long)
+					+ mem_stats_vec4_bytes(arr->vals_width)));
+
       count_var_arrays += 1;
       count_var_array_words += arr->array_count;
 
@@ -1295,21 +1379,29 @@ void compile_var2_array(char*label, char*name, int last, int first,
 
       assert(! arr->nets);
       if (lsb == 0 && msb == 7 && signed_flag) {
-	    arr->vals = new vvp_darray_atom<int8_t>(arr->array_count);
+	    arr->vals = new vvp_darray_atom<int8_t>(arr->array_count,
+						    MEM_STATS_ARRAY);
       } else if (lsb == 0 && msb == 7 && !signed_flag) {
-	    arr->vals = new vvp_darray_atom<uint8_t>(arr->array_count);
+	    arr->vals = new vvp_darray_atom<uint8_t>(arr->array_count,
+						    MEM_STATS_ARRAY);
       } else if (lsb == 0 && msb == 15 && signed_flag) {
-	    arr->vals = new vvp_darray_atom<int16_t>(arr->array_count);
+	    arr->vals = new vvp_darray_atom<int16_t>(arr->array_count,
+						    MEM_STATS_ARRAY);
       } else if (lsb == 0 && msb == 15 && !signed_flag) {
-	    arr->vals = new vvp_darray_atom<uint16_t>(arr->array_count);
+	    arr->vals = new vvp_darray_atom<uint16_t>(arr->array_count,
+						    MEM_STATS_ARRAY);
       } else if (lsb == 0 && msb == 31 && signed_flag) {
-	    arr->vals = new vvp_darray_atom<int32_t>(arr->array_count);
+	    arr->vals = new vvp_darray_atom<int32_t>(arr->array_count,
+						    MEM_STATS_ARRAY);
       } else if (lsb == 0 && msb == 31 && !signed_flag) {
-	    arr->vals = new vvp_darray_atom<uint32_t>(arr->array_count);
+	    arr->vals = new vvp_darray_atom<uint32_t>(arr->array_count,
+						    MEM_STATS_ARRAY);
       } else if (lsb == 0 && msb == 63 && signed_flag) {
-	    arr->vals = new vvp_darray_atom<int64_t>(arr->array_count);
+	    arr->vals = new vvp_darray_atom<int64_t>(arr->array_count,
+						    MEM_STATS_ARRAY);
       } else if (lsb == 0 && msb == 63 && !signed_flag) {
-	    arr->vals = new vvp_darray_atom<uint64_t>(arr->array_count);
+	    arr->vals = new vvp_darray_atom<uint64_t>(arr->array_count,
+						    MEM_STATS_ARRAY);
       } else {
 	      // For now, only support the atom sizes.
 	    assert(0);
@@ -1328,7 +1420,7 @@ void compile_real_array(char*label, char*name, int last, int first)
       struct __vpiArray*arr = dynamic_cast<__vpiArray*>(obj);
 
 	/* Make the words. */
-      arr->vals = new vvp_darray_real(arr->array_count);
+      arr->vals = new vvp_darray_real(arr->array_count, MEM_STATS_ARRAY);
       arr->vals_width = 1;
 
       count_real_arrays += 1;
@@ -1345,7 +1437,7 @@ void compile_string_array(char*label, char*name, int last, int first)
       struct __vpiArray*arr = dynamic_cast<__vpiArray*>(obj);
 
 	/* Make the words. */
-      arr->vals = new vvp_darray_string(arr->array_count);
+      arr->vals = new vvp_darray_string(arr->array_count, MEM_STATS_ARRAY);
       arr->vals_width = 1;
 
       count_real_arrays += 1;
@@ -1365,6 +1457,11 @@ void compile_net_array(char*label, char*name, int last, int first)
       struct __vpiArray*arr = dynamic_cast<__vpiArray*>(obj);
       arr->nets = (vpiHandle*)calloc(arr->array_count, sizeof(vpiHandle));
 
+	// The word signals count themselves; this is just the table
+	// of word handles.
+      mem_stats_add(arr->scope, MEM_STATS_ARRAY,
+		    arr->array_count * sizeof(vpiHandle));
+
       count_net_arrays += 1;
       count_net_array_words += arr->array_count;
 
@@ -1632,27 +1729,26 @@ class array_word_value_callback : public value_callback {
       long word_addr;
 };
 
-void array_word_change(vvp_array_t array, unsigned long addr)
+/*
+ * Run the callbacks in one list for a change to the addressed
+ * word. Reaped callbacks (null cb_rtn) are unlinked and deleted along
+ * the way, so the head pointer is passed by reference. The
+ * whole_array flag marks the list of callbacks that watch every word,
+ * which need the index member set to the changed address.
+ */
+static void array_run_callbacks_(vvp_array_t array,
+				 struct __vpiCallback*&head,
+				 unsigned long addr, bool whole_array)
 {
-      for (vvp_fun_arrayport*cur = array->ports_; cur; cur = cur->next_)
-	    cur->check_word_change(addr);
-
-	// Run callbacks attached to the array itself.
-      struct __vpiCallback *next = array->vpi_callbacks;
+      struct __vpiCallback *next = head;
       struct __vpiCallback *prev = 0;
 
       while (next) {
 	    array_word_value_callback*cur = dynamic_cast<array_word_value_callback*>(next);
 	    next = cur->next;
 
-	      // Skip callbacks that are not for me. -1 is for every element.
-	    if (cur->word_addr != (long)addr && cur->word_addr != -1) {
-		  prev = cur;
-		  continue;
-	    }
-
 	      // For whole array callbacks we need to set the index.
-	    if (cur->word_addr == -1) {
+	    if (whole_array) {
 		  cur->cb_data.index = (PLI_INT32) ((int)addr +
 		                       array->first_addr.value);
 	    }
@@ -1680,7 +1776,7 @@ void array_word_change(vvp_array_t array, unsigned long addr)
 
 	    } else if (prev == 0) {
 
-		  array->vpi_callbacks = next;
+		  head = next;
 		  cur->next = 0;
 		  delete cur;
 
@@ -1693,6 +1789,24 @@ void array_word_change(vvp_array_t array, unsigned long addr)
       }
 }
 
+void array_word_change(vvp_array_t array, unsigned long addr)
+{
+      for (vvp_fun_arrayport*cur = array->ports_; cur; cur = cur->next_)
+	    cur->check_word_change(addr);
+
+	// Run the callbacks registered on this particular word, then
+	// the callbacks that watch the whole array.
+      std::map<unsigned long, struct __vpiCallback*>::iterator idx
+	    = array->word_callbacks.find(addr);
+      if (idx != array->word_callbacks.end()) {
+	    array_run_callbacks_(array, idx->second, addr, false);
+	    if (idx->second == 0)
+		  array->word_callbacks.erase(idx);
+      }
+
+      array_run_callbacks_(array, array->vpi_callbacks, addr, true);
+}
+
 class array_resolv_list_t : public resolv_list_s {
 
     public:
@@ -1835,8 +1949,10 @@ value_callback*vpip_array_word_change(p_cb_data data)
 
       assert(cbh);
       assert(parent);
-      cbh->next = parent->vpi_callbacks;
-      parent->vpi_callbacks = cbh;
+      struct __vpiCallback*&head
+	    = parent->word_callbacks[(unsigned long)cbh->word_addr];
+      cbh->next = head;
+      head = cbh;
 
       return cbh;
 }
@@ -1902,7 +2018,7 @@ void compile_array_alias(char*label, char*name, char*src)
       obj->vals4 = mem->vals4;
       obj->vals  = mem->vals;
       obj->vals_width = mem->vals_width;
-      obj->vals_words = mem->vals_words;
+      obj->vals_pages = mem->vals_pages;
 
       obj->ports_ = 0;
       obj->vpi_callbacks = 0;
@@ -2038,7 +2154,15 @@ void compile_array_cleanup(void)
 void memory_delete(vpiHandle item)
 {
       struct __vpiArray*arr = (struct __vpiArray*) item;
-      if (arr->vals_words) delete [] (arr->vals_words-1);
+      if (arr->vals_pages) {
+	    unsigned pcnt = (arr->array_count + ARRAY_WORDS_PAGE - 1)
+		  / ARRAY_WORDS_PAGE;
+	    for (unsigned idx = 0 ;  idx < pcnt ;  idx += 1) {
+		  if (arr->vals_pages[idx])
+			delete [] (arr->vals_pages[idx] - 2);
+	    }
+	    delete [] arr->vals_pages;
+      }
 
 //      if (arr->vals4) {}
 // Delete the individual words?
@@ -2070,6 +2194,16 @@ void memory_delete(vpiHandle item)
 	    free(arr->nets);
       }
 
+      for (std::map<unsigned long, struct __vpiCallback*>::iterator idx
+		 = arr->word_callbacks.begin()
+		 ; idx != arr->word_callbacks.end() ; ++ idx ) {
+	    while (idx->second) {
+		  struct __vpiCallback*tmp = idx->second->next;
+		  delete idx->second;
+		  idx->second = tmp;
+	    }
+      }
+
       while (arr->vpi_callbacks) {
 	    struct __vpiCallback*tmp = arr->vpi_callbacks->next;
 	    delete arr->vpi_callbacks;
@@ -45,6 +45,8 @@ extern void array_set_word(vvp_array_t arr, unsigned idx,
 			   double val);
 extern void array_set_word(vvp_array_t arr, unsigned idx,
 			   const std::string&val);
+extern void array_fill_words(vvp_array_t arr, unsigned idx, unsigned cnt,
+			     const vvp_vector4_t&val);
 
 extern vvp_vector4_t array_get_word(vvp_array_t array, unsigned address);
 extern double array_get_word_r(vvp_array_t array, unsigned address);
@@ -30,6 +30,37 @@ vvp_fun_bufif::vvp_fun_bufif(bool en_invert, bool out_invert,
       drive0_ = str0;
       drive1_ = str1;
       count_functors_bufif += 1;
+
+	// Fill in the output map for all the (enable, data) pairs.
+      for (unsigned bdx = 0 ;  bdx < 4 ;  bdx += 1) {
+	    vvp_bit4_t b_bit = (vvp_bit4_t) bdx;
+
+	      // Enable 0 releases the output.
+	    out_map_[BIT4_0][bdx] = vvp_scalar_t(BIT4_Z,drive0_,drive1_);
+
+	      // Enable 1 drives the data bit, with unknown data
+	      // driven as x.
+	    if (bit4_is_xz(b_bit))
+		  out_map_[BIT4_1][bdx] = vvp_scalar_t(BIT4_X,drive0_,drive1_);
+	    else
+		  out_map_[BIT4_1][bdx] = vvp_scalar_t(b_bit,drive0_,drive1_);
+
+	      // Unknown enable drives H/L for known data.
+	    vvp_scalar_t tmp;
+	    switch (b_bit) {
+		case BIT4_0:
+		  tmp = vvp_scalar_t(BIT4_X,drive0_,0);
+		  break;
+		case BIT4_1:
+		  tmp = vvp_scalar_t(BIT4_X,0,drive1_);
+		  break;
+		default:
+		  tmp = vvp_scalar_t(BIT4_X,drive0_,drive1_);
+		  break;
+	    }
+	    out_map_[BIT4_X][bdx] = tmp;
+	    out_map_[BIT4_Z][bdx] = tmp;
+      }
 }
 
 void vvp_fun_bufif::recv_vec4(vvp_net_ptr_t ptr, const vvp_vector4_t&bit,
@@ -52,31 +83,7 @@ void vvp_fun_bufif::recv_vec4(vvp_net_ptr_t ptr, const vvp_vector4_t&bit,
 	    vvp_bit4_t b_en  = en_.value(idx);
 	    vvp_bit4_t b_bit = bit_.value(idx);
 
-	    switch (b_en) {
-		case BIT4_0:
-		  out.set_bit(idx, vvp_scalar_t(BIT4_Z,drive0_,drive1_));
-		  break;
-		case BIT4_1:
-		  if (bit4_is_xz(b_bit))
-			out.set_bit(idx, vvp_scalar_t(BIT4_X,drive0_,drive1_));
-		  else
-			out.set_bit(idx, vvp_scalar_t(b_bit,drive0_,drive1_));
-		  break;
-
-		default:
-		  switch (b_bit) {
-		      case BIT4_0:
-			out.set_bit(idx, vvp_scalar_t(BIT4_X,drive0_,0));
-			break;
-		      case BIT4_1:
-			out.set_bit(idx, vvp_scalar_t(BIT4_X,0,drive1_));
-			break;
-		      default:
-			out.set_bit(idx, vvp_scalar_t(BIT4_X,drive0_,drive1_));
-			break;
-		  }
-		  break;
-	    }
+	    out.set_bit(idx, out_map_[b_en][b_bit]);
       }
 
       ptr.ptr()->send_vec8(out);
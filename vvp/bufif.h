@@ -47,6 +47,12 @@ class vvp_fun_bufif  : public vvp_net_fun_t {
       unsigned inv_ : 1;
       unsigned drive0_ : 8;
       unsigned drive1_ : 8;
+
+	// The output for a bit depends only on the (enable, data)
+	// bit pair, and the drive strengths are fixed when the gate
+	// is created, so the constructor precomputes the output
+	// scalar for all 16 input combinations.
+      vvp_scalar_t out_map_[4][4];
 };
 
 #endif
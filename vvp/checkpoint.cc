@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2013 Stephen Williams (steve@icarus.com)
+ *
+ *    This source code is free software; you can redistribute it
+ *    and/or modify it in source code form under the terms of the GNU
+ *    General Public License as published by the Free Software
+ *    Foundation; either version 2 of the License, or (at your option)
+ *    any later version.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this program; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+# include  "checkpoint.h"
+# include  "vpi_user.h"
+# include  <cstdio>
+#if !defined(__MINGW32__)
+# include  <unistd.h>
+# include  <sys/wait.h>
+#endif
+
+/*
+ * The $ivl_checkpoint(count) system function snapshots the entire
+ * simulation at the point of the call and runs the rest of the
+ * simulation <count> times from that snapshot, returning the run
+ * index (0 to count-1) to each run. A testbench that needs a long
+ * boot sequence before many short tests pays for the boot only once:
+ *
+ *    initial begin
+ *          boot_firmware;
+ *          run_test( $ivl_checkpoint(`NUM_TESTS) );
+ *    end
+ *
+ * The snapshot is taken with fork(), so the full runtime state --
+ * event queues, threads, functor values, arrays and VPI callbacks --
+ * is preserved exactly, without the simulator having to serialize any
+ * of it. The runs execute sequentially, each in its own process, and
+ * the last run executes in the original process so that the exit
+ * status of vvp is the status of the final run. The cost of this
+ * approach is that the snapshot cannot be kept across vvp
+ * invocations, and anything outside the process (most notably file
+ * positions, which the runs share) is not rolled back between runs.
+ */
+
+static PLI_INT32 ivl_checkpoint_compiletf(ICARUS_VPI_CONST PLI_BYTE8*name)
+{
+      vpiHandle callh = vpi_handle(vpiSysTfCall, 0);
+      vpiHandle argv = vpi_iterate(vpiArgument, callh);
+
+      if (argv == 0) {
+	    vpi_printf("ERROR: %s:%d: %s requires a run count argument.\n",
+		       vpi_get_str(vpiFile, callh),
+		       (int)vpi_get(vpiLineNo, callh), name);
+	    vpi_control(vpiFinish, 1);
+	    return 0;
+      }
+
+      (void) vpi_scan(argv);
+      if (vpi_scan(argv) != 0) {
+	    vpi_printf("ERROR: %s:%d: %s takes a single argument.\n",
+		       vpi_get_str(vpiFile, callh),
+		       (int)vpi_get(vpiLineNo, callh), name);
+	    vpi_free_object(argv);
+	    vpi_control(vpiFinish, 1);
+      }
+
+      return 0;
+}
+
+static PLI_INT32 ivl_checkpoint_calltf(ICARUS_VPI_CONST PLI_BYTE8*name)
+{
+      vpiHandle callh = vpi_handle(vpiSysTfCall, 0);
+      vpiHandle argv = vpi_iterate(vpiArgument, callh);
+      vpiHandle arg = vpi_scan(argv);
+      vpi_free_object(argv);
+
+      s_vpi_value val;
+      val.format = vpiIntVal;
+      vpi_get_value(arg, &val);
+
+      int count = val.value.integer;
+      if (count < 1)
+	    count = 1;
+
+      int run = 0;
+
+#if defined(__MINGW32__)
+      if (count > 1)
+	    vpi_printf("WARNING: %s is not able to snapshot the process "
+		       "on this platform, so only one run is made.\n", name);
+#else
+      (void) name; /* Not used! */
+
+	/* Flush buffered output so that it is not replayed into
+	   every run. */
+      fflush(0);
+
+      int status = 0;
+      while (run+1 < count) {
+	    pid_t pid = fork();
+	    if (pid < 0) {
+		  perror("$ivl_checkpoint: fork");
+		  break;
+	    }
+
+	      /* The child is the next run; it goes on to simulate
+		 from the snapshot. */
+	    if (pid == 0)
+		  break;
+
+	      /* The parent holds the snapshot. Wait for the run to
+		 finish, then loop to start the next one. The last
+		 run falls out of the loop and continues in this
+		 process, so vvp exits with the status of the final
+		 run. */
+	    waitpid(pid, &status, 0);
+	    run += 1;
+      }
+#endif
+
+      val.format = vpiIntVal;
+      val.value.integer = run;
+      vpi_put_value(callh, &val, 0, vpiNoDelay);
+      return 0;
+}
+
+void checkpoint_register_systf(void)
+{
+      s_vpi_systf_data tf_data;
+      vpiHandle res;
+
+      tf_data.type        = vpiSysFunc;
+      tf_data.sysfunctype = vpiIntFunc;
+      tf_data.calltf      = ivl_checkpoint_calltf;
+      tf_data.compiletf   = ivl_checkpoint_compiletf;
+      tf_data.sizetf      = 0;
+      tf_data.tfname      = "$ivl_checkpoint";
+      tf_data.user_data   = const_cast<PLI_BYTE8*>("$ivl_checkpoint");
+      res = vpi_register_systf(&tf_data);
+      vpip_make_systf_system_defined(res);
+}
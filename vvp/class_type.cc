@@ -259,6 +259,8 @@ class_type::class_type(const string&nam, size_t nprop)
 : class_name_(nam), properties_(nprop)
 {
       instance_size_ = 0;
+      slab_free_ = 0;
+      slab_cell_size_ = 0;
 }
 
 void class_type::set_property(size_t idx, const string&name, const string&type)
@@ -323,9 +325,9 @@ void class_type::finish_setup(void)
       }
 }
 
-class_type::inst_t class_type::instance_new() const
+class_type::inst_t class_type::instance_init(void*space) const
 {
-      char*buf = new char [instance_size_];
+      char*buf = reinterpret_cast<char*> (space);
 
       for (size_t idx = 0 ; idx < properties_.size() ; idx += 1)
 	    properties_[idx].type->construct(buf);
@@ -333,14 +335,72 @@ class_type::inst_t class_type::instance_new() const
       return reinterpret_cast<inst_t> (buf);
 }
 
-void class_type::instance_delete(class_type::inst_t obj) const
+void class_type::instance_done(class_type::inst_t obj) const
 {
       char*buf = reinterpret_cast<char*> (obj);
 
       for (size_t idx = 0 ; idx < properties_.size() ; idx += 1)
 	    properties_[idx].type->destruct(buf);
+}
+
+/*
+ * Instances are carved from slabs dedicated to the class, with the
+ * properties packed directly behind the header object in a single
+ * cell. Each cell starts with one pointer word that holds the class
+ * definition while the cell is in use, so the free path can find the
+ * right free list, and doubles as the free list link while the cell
+ * is free. The slabs themselves are never released; class objects
+ * churn, so freed cells are promptly reused.
+ */
+struct class_type::slab_cell_s {
+      union {
+	    const class_type*defn;
+	    struct slab_cell_s*next;
+      };
+	// The instance data starts here.
+};
+
+void* class_type::instance_alloc(size_t hdr_size) const
+{
+      if (slab_cell_size_ == 0) {
+	      // First allocation fixes the cell size: header object
+	      // plus packed properties, rounded up so that the cells
+	      // keep pointer/double alignment.
+	    size_t use_size = sizeof(slab_cell_s) + hdr_size + instance_size_;
+	    slab_cell_size_ = (use_size + 7) & ~(size_t)7;
+      }
+
+      if (slab_free_ == 0) {
+	      // Carve a new slab into cells. Aim for slabs of about
+	      // 8K bytes, so small classes get many cells per slab
+	      // and huge classes still get a few.
+	    size_t count = 8192 / slab_cell_size_;
+	    if (count < 8)
+		  count = 8;
+
+	    char*slab = new char [count * slab_cell_size_];
+	    for (size_t idx = 0 ; idx < count ; idx += 1) {
+		  slab_cell_s*cell
+			= reinterpret_cast<slab_cell_s*>
+			     (slab + idx*slab_cell_size_);
+		  cell->next = slab_free_;
+		  slab_free_ = cell;
+	    }
+      }
+
+      slab_cell_s*cell = slab_free_;
+      slab_free_ = cell->next;
+      cell->defn = this;
+      return cell + 1;
+}
+
+void class_type::instance_free(void*ptr)
+{
+      slab_cell_s*cell = reinterpret_cast<slab_cell_s*> (ptr) - 1;
+      const class_type*defn = cell->defn;
 
-      delete[]buf;
+      cell->next = defn->slab_free_;
+      defn->slab_free_ = cell;
 }
 
 void class_type::set_vec4(class_type::inst_t obj, size_t pid,
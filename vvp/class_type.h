@@ -55,9 +55,23 @@ class class_type : public __vpiHandle {
       void finish_setup(void);
 
     public:
-	// Constructures and destructors for making instances.
-      inst_t instance_new() const;
-      void instance_delete(inst_t) const;
+	// Constructures and destructors for making instances. The
+	// property space is constructed in place in the given buffer,
+	// which the caller allocates (instance_alloc below hands out
+	// a buffer with room for a header object and the properties
+	// packed behind it).
+      inst_t instance_init(void*buf) const;
+      void instance_done(inst_t) const;
+
+	// Slab allocation of instance memory. instance_alloc()
+	// returns hdr_size plus instance_size() bytes carved from a
+	// slab dedicated to this class, and instance_free() returns
+	// the memory to the slab it came from.
+      void* instance_alloc(size_t hdr_size) const;
+      static void instance_free(void*ptr);
+
+	// The bytes held by one instance, for memory accounting.
+      inline size_t instance_size(void) const { return instance_size_; }
 
       void set_vec4(inst_t inst, size_t pid, const vvp_vector4_t&val) const;
       void get_vec4(inst_t inst, size_t pid, vvp_vector4_t&val) const;
@@ -80,6 +94,13 @@ class class_type : public __vpiHandle {
       };
       std::vector<prop_t> properties_;
       size_t instance_size_;
+
+	// Free list and cell size for the instance slab. These are
+	// mutable because making instances of a class does not
+	// logically change the type definition.
+      struct slab_cell_s;
+      mutable struct slab_cell_s*slab_free_;
+      mutable size_t slab_cell_size_;
 };
 
 #endif
@@ -19,6 +19,7 @@
 
 # include  "codes.h"
 # include  "statistics.h"
+# include  "permaheap.h"
 # include  "config.h"
 #ifdef CHECK_WITH_VALGRIND
 # include  "vvp_cleanup.h"
@@ -39,6 +40,43 @@ static struct vvp_code_s *first_chunk = 0;
 static struct vvp_code_s *current_chunk = 0;
 static unsigned current_within_chunk = 0;
 
+/*
+ * Carve the code chunks out of a dedicated arena instead of taking
+ * each one from the global heap. The compiler emits each thread's
+ * code in order, so parse order already keeps a thread's basic blocks
+ * together; what scattered the code was that every chunk allocation
+ * was interleaved with the net and functor allocations made while
+ * parsing. With the arena, consecutive chunks of code are adjacent in
+ * memory and vthread_run() walks a compact region. The blocks are
+ * never freed, which is fine because the code space lives for the
+ * whole simulation. Under valgrind checking keep the plain
+ * allocations so codespace_delete can release them one by one.
+ */
+static vvp_code_t code_chunk_alloc_(void)
+{
+#ifdef CHECK_WITH_VALGRIND
+      return new struct vvp_code_s [code_chunk_size];
+#else
+	/* Size the arena blocks to span at least one huge page, so
+	   the shared backing store can align them for 2M pages. */
+      static const unsigned arena_chunks
+	    = 1 + ARENA_HUGE_CHUNK / (sizeof(struct vvp_code_s)*code_chunk_size);
+      static struct vvp_code_s*arena = 0;
+      static unsigned arena_fill = arena_chunks;
+
+      if (arena_fill == arena_chunks) {
+	    arena = (struct vvp_code_s*)
+		  arena_chunk_alloc(arena_chunks * code_chunk_size
+				    * sizeof(struct vvp_code_s));
+	    arena_fill = 0;
+      }
+
+      vvp_code_t res = arena + arena_fill * code_chunk_size;
+      arena_fill += 1;
+      return res;
+#endif
+}
+
 /*
  * This initializes the code space. It sets up the first code chunk,
  * and places at address 0 a ZOMBIE instruction.
@@ -46,7 +84,7 @@ static unsigned current_within_chunk = 0;
 void codespace_init(void)
 {
       assert(current_chunk == 0);
-      first_chunk = new struct vvp_code_s [code_chunk_size];
+      first_chunk = code_chunk_alloc_();
       current_chunk = first_chunk;
 
       current_chunk[0].opcode = &of_ZOMBIE;
@@ -63,8 +101,7 @@ void codespace_init(void)
 vvp_code_t codespace_next(void)
 {
       if (current_within_chunk == (code_chunk_size-1)) {
-	    current_chunk[code_chunk_size-1].cptr
-		  = new struct vvp_code_s [code_chunk_size];
+	    current_chunk[code_chunk_size-1].cptr = code_chunk_alloc_();
 	    current_chunk = current_chunk[code_chunk_size-1].cptr;
 
 	      /* Put a link opcode on the end of the chunk. */
@@ -96,6 +133,66 @@ vvp_code_t codespace_null(void)
       return first_chunk + 0;
 }
 
+/*
+ * After linking, all the branch targets are numeric pointers, so they
+ * can be canonicalized. A branch that lands on an unconditional %jmp,
+ * a %noop, or the link cell at the end of a chunk would make the
+ * interpreter execute pure control transfers at run time; follow the
+ * chain here, once, and store the final destination. Chains can be
+ * circular (a forever loop compiles to a %jmp to itself) so the walk
+ * is guarded by a hop limit.
+ */
+static vvp_code_t canonical_target_(vvp_code_t target)
+{
+      for (unsigned hops = 0 ; hops < 64 ; hops += 1) {
+	    if (target->opcode == &of_CHUNK_LINK) {
+		  target = target->cptr;
+		  continue;
+	    }
+	    if (target->opcode == &of_NOOP) {
+		  target += 1;
+		  continue;
+	    }
+	    if (target->opcode == &of_JMP && target->cptr != target) {
+		  target = target->cptr;
+		  continue;
+	    }
+	    break;
+      }
+      return target;
+}
+
+unsigned codespace_optimize(void)
+{
+      unsigned count = 0;
+      if (first_chunk == 0)
+	    return 0;
+
+      for (vvp_code_t chunk = first_chunk ; chunk
+		 ; chunk = chunk[code_chunk_size-1].cptr) {
+	    unsigned fill = code_chunk_size-1;
+	    if (chunk == current_chunk)
+		  fill = current_within_chunk;
+
+	    for (unsigned idx = 0 ; idx < fill ; idx += 1) {
+		  vvp_code_t cur = chunk + idx;
+		  if (cur->opcode != &of_JMP
+		      && cur->opcode != &of_JMP0
+		      && cur->opcode != &of_JMP0XZ
+		      && cur->opcode != &of_JMP1)
+			continue;
+
+		  vvp_code_t use_target = canonical_target_(cur->cptr);
+		  if (use_target != cur->cptr) {
+			cur->cptr = use_target;
+			count += 1;
+		  }
+	    }
+      }
+
+      return count;
+}
+
 #ifdef CHECK_WITH_VALGRIND
 void codespace_delete(void)
 {
@@ -115,8 +212,6 @@ void codespace_delete(void)
 			vpi_call_delete((cur+idx)->handle);
 		  } else if ((cur+idx)->opcode == &of_EXEC_UFUNC) {
 			exec_ufunc_delete((cur+idx));
-		  } else if ((cur+idx)->opcode == &of_FILE_LINE) {
-			delete((cur+idx)->handle);
 		  } else if (((cur+idx)->opcode == &of_CONCATI_STR) ||
 		             ((cur+idx)->opcode == &of_NEW_DARRAY) ||
 		             ((cur+idx)->opcode == &of_PUSHI_STR)) {
@@ -38,6 +38,7 @@ extern bool of_ADDI(vthread_t thr, vvp_code_t code);
 extern bool of_ALLOC(vthread_t thr, vvp_code_t code);
 extern bool of_AND(vthread_t thr, vvp_code_t code);
 extern bool of_ANDI(vthread_t thr, vvp_code_t code);
+extern bool of_ARR_FILL(vthread_t thr, vvp_code_t code);
 extern bool of_ANDR(vthread_t thr, vvp_code_t code);
 extern bool of_ASSIGN_AR(vthread_t thr, vvp_code_t code);
 extern bool of_ASSIGN_ARD(vthread_t thr, vvp_code_t code);
@@ -147,6 +148,7 @@ extern bool of_MOV_WU(vthread_t thr, vvp_code_t code);
 extern bool of_MOVI(vthread_t thr, vvp_code_t code);
 extern bool of_MUL(vthread_t thr, vvp_code_t code);
 extern bool of_MUL_WR(vthread_t thr, vvp_code_t code);
+extern bool of_MULADD_WR(vthread_t thr, vvp_code_t code);
 extern bool of_MULI(vthread_t thr, vvp_code_t code);
 extern bool of_NAND(vthread_t thr, vvp_code_t code);
 extern bool of_NANDR(vthread_t thr, vvp_code_t code);
@@ -228,6 +230,9 @@ struct vvp_code_s {
 	    class __vpiHandle*handle;
 	    struct __vpiScope*scope;
 	    const char*text;
+	      /* The %load family resolves the net to its signal value
+		 object on first execution and caches it here. */
+	    class vvp_signal_value*sig_val;
       };
 
       union {
@@ -238,6 +243,13 @@ struct vvp_code_s {
       };
 };
 
+/*
+ * Map an opcode implementation function back to its assembly
+ * mnemonic, for diagnostic reports. Returns nil if the function is
+ * not in the opcode table (internal linkage codes, for example).
+ */
+extern const char*opcode_mnemonic(vvp_code_fun fun);
+
 /*
  * This function clears the code space, ready for initialization. This
  * needs to be done exactly once before any instructions are created.
@@ -256,4 +268,11 @@ extern vvp_code_t codespace_allocate(void);
 extern vvp_code_t codespace_next(void);
 extern vvp_code_t codespace_null(void);
 
+/*
+ * This function is called once, after linking resolves the code
+ * labels, to canonicalize branch targets (collapse jump chains and
+ * skip %noop padding). It returns the number of branches redirected.
+ */
+extern unsigned codespace_optimize(void);
+
 #endif
@@ -28,12 +28,16 @@
 # include  "symbols.h"
 # include  "codes.h"
 # include  "schedule.h"
+# include  "vvp_net_sig.h"
 # include  "vpi_priv.h"
 # include  "parse_misc.h"
 # include  "statistics.h"
 # include  "schedule.h"
 # include  <iostream>
 # include  <list>
+# include  <string>
+# include  <vector>
+# include  <algorithm>
 # include  <cstdlib>
 # include  <cstring>
 # include  <cassert>
@@ -92,6 +96,7 @@ static const struct opcode_table_s opcode_table[] = {
       { "%and",    of_AND,    3,  {OA_BIT1,     OA_BIT2,     OA_NUMBER} },
       { "%and/r",  of_ANDR,   3,  {OA_BIT1,     OA_BIT2,     OA_NUMBER} },
       { "%andi",   of_ANDI,   3,  {OA_BIT1,     OA_BIT2,     OA_NUMBER} },
+      { "%arr/fill",of_ARR_FILL,3, {OA_ARR_PTR,  OA_BIT1,     OA_BIT2} },
       { "%assign/ar",of_ASSIGN_AR,2,{OA_ARR_PTR,OA_BIT1,     OA_NONE} },
       { "%assign/ar/d",of_ASSIGN_ARD,2,{OA_ARR_PTR,OA_BIT1,  OA_NONE} },
       { "%assign/ar/e",of_ASSIGN_ARE,1,{OA_ARR_PTR,OA_NONE,  OA_NONE} },
@@ -195,6 +200,7 @@ static const struct opcode_table_s opcode_table[] = {
       { "%movi",   of_MOVI,   3,  {OA_BIT1,     OA_BIT2,     OA_NUMBER} },
       { "%mul",    of_MUL,    3,  {OA_BIT1,     OA_BIT2,     OA_NUMBER} },
       { "%mul/wr", of_MUL_WR, 0,  {OA_NONE,     OA_NONE,     OA_NONE} },
+      { "%muladd/wr", of_MULADD_WR, 0, {OA_NONE, OA_NONE,    OA_NONE} },
       { "%muli",   of_MULI,   3,  {OA_BIT1,     OA_BIT2,     OA_NUMBER} },
       { "%nand",   of_NAND,   3,  {OA_BIT1,     OA_BIT2,     OA_NUMBER} },
       { "%nand/r", of_NANDR,  3,  {OA_BIT1,     OA_BIT2,     OA_NUMBER} },
@@ -266,6 +272,15 @@ static int opcode_compare(const void*k, const void*r)
       return strcmp(kp, rp->mnemonic);
 }
 
+const char*opcode_mnemonic(vvp_code_fun fun)
+{
+      for (unsigned idx = 0 ;  idx < opcode_count ;  idx += 1) {
+	    if (opcode_table[idx].opcode == fun)
+		  return opcode_table[idx].mnemonic;
+      }
+      return 0;
+}
+
 /*
  * Keep a symbol table of addresses within code space. Labels on
  * executable opcodes are mapped to their address here.
@@ -324,7 +339,7 @@ vpiHandle vvp_lookup_handle(const char*label)
       return 0;
 }
 
-vvp_net_t* vvp_net_lookup(const char*label)
+static vvp_net_t* vvp_net_lookup_(const char*label)
 {
         /* First, look to see if the symbol is a vpi object of some
 	   sort. If it is, then get the vvp_ipoint_t pointer out of
@@ -376,6 +391,33 @@ vvp_net_t* vvp_net_lookup(const char*label)
       return tmp;
 }
 
+/*
+ * Wide nets are referenced many times over by their drivers and
+ * loads, and the deferred references are resolved in label order (see
+ * compile_cleanup) so repeats of a label arrive back to back. Keep a
+ * one-entry memo of the last successful lookup so only the first
+ * reference to a symbol pays for the table probes and the vpiHandle
+ * cast. Only hits are memoized: a label may well be defined after a
+ * failed lookup, but nets are never removed or redefined during
+ * load, so a non-null memo cannot go stale.
+ */
+vvp_net_t* vvp_net_lookup(const char*label)
+{
+      static std::string memo_label;
+      static vvp_net_t*memo_net = 0;
+
+      if (memo_net && memo_label == label)
+	    return memo_net;
+
+      vvp_net_t*tmp = vvp_net_lookup_(label);
+      if (tmp) {
+	    memo_label = label;
+	    memo_net = tmp;
+      }
+
+      return tmp;
+}
+
 /*
  * The resolv_list_s is the base class for a symbol resolve action, and
  * the resolv_list is an unordered list of these resolve actions. Some
@@ -415,9 +457,9 @@ void resolv_submit(resolv_list_s*cur)
 
 /*
  * Look up vvp_nets in the symbol table. The "source" is the label for
- * the net that I want to feed, and net->port[port] is the vvp_net
+ * the net that I want to feed, and the port member is the vvp_net
  * input that I want that node to feed into. When the name is found,
- * put net->port[port] into the fan-out list for that node.
+ * add the port to the fan-out of that node.
  */
 struct vvp_net_resolv_list_s: public resolv_list_s {
 
@@ -682,6 +724,11 @@ void compile_compiletf(struct __vpiSysTaskCall*obj)
  * the final stuff. Clean up deferred linking here.
  */
 
+struct resolv_list_label_lt {
+      bool operator() (const resolv_list_s*a, const resolv_list_s*b) const
+      { return strcmp(a->label(), b->label()) < 0; }
+};
+
 void compile_cleanup(void)
 {
       int lnerrs = -1;
@@ -693,6 +740,26 @@ void compile_cleanup(void)
 	    fflush(stderr);
       }
 
+	/* Order the deferred resolutions by label so that all the
+	   references to one symbol resolve back to back. The first
+	   reference does the real symbol table lookup and the rest
+	   hit the memo in vvp_net_lookup, so a heavily fanned-out
+	   net is looked up once instead of once per load. */
+      if (resolv_list && resolv_list->next) {
+	    std::vector<resolv_list_s*> sorted;
+	    for (resolv_list_s*cur = resolv_list ; cur ; cur = cur->next)
+		  sorted.push_back(cur);
+
+	    std::stable_sort(sorted.begin(), sorted.end(),
+			     resolv_list_label_lt());
+
+	    resolv_list = 0;
+	    for (size_t idx = sorted.size() ; idx > 0 ; idx -= 1) {
+		  sorted[idx-1]->next = resolv_list;
+		  resolv_list = sorted[idx-1];
+	    }
+      }
+
       do {
 	    resolv_list_s *res = resolv_list;
 	    resolv_list = 0x0;
@@ -718,6 +785,15 @@ void compile_cleanup(void)
 
       compile_errors += nerrs;
 
+	/* With the labels resolved, collapse branch chains so the
+	   interpreter does not execute %jmp-to-%jmp sequences. */
+      unsigned threaded_branches = codespace_optimize();
+      if (verbose_flag) {
+	    fprintf(stderr, " ... Optimized code space "
+		    "(%u branch targets threaded)\n", threaded_branches);
+	    fflush(stderr);
+      }
+
       if (verbose_flag) {
 	    fprintf(stderr, " ... Removing symbol tables\n");
 	    fflush(stderr);
@@ -774,11 +850,15 @@ void compile_vpi_symbol(const char*label, vpiHandle obj)
  */
 void compile_init(void)
 {
-      sym_vpi = new_symbol_table();
+	/* These tables carry one entry per labeled statement of the
+	   input, so they run to millions of symbols for big designs.
+	   Presize them past the growth stages that every non-trivial
+	   design would go through anyway. */
+      sym_vpi = new_symbol_table(16384);
 
-      sym_functors = new_symbol_table();
+      sym_functors = new_symbol_table(65536);
 
-      sym_codespace = new_symbol_table();
+      sym_codespace = new_symbol_table(16384);
       codespace_init();
 }
 
@@ -1731,7 +1811,11 @@ void compile_code(char*label, char*mnem, comp_operands_t opa)
 			break;
 		  }
 
-		  code->text = opa->argv[idx].text;
+		    /* Intern the string so that identical literals in
+		       the code space share one permanent copy, and
+		       release the lexor-allocated text. */
+		  code->text = vpip_name_string(opa->argv[idx].text);
+		  free(const_cast<char*>(opa->argv[idx].text));
 		  break;
 	    }
       }
@@ -1797,9 +1881,9 @@ void compile_file_line(char*label, long file_idx, long lineno,
       vvp_code_t code = codespace_allocate();
       code->opcode = &of_FILE_LINE;
 
-	/* Create a vpiHandle that contains the information. */
-      code->handle = vpip_build_file_line(description, file_idx, lineno);
-      assert(code->handle);
+	/* Enter the information in the file/line table. */
+      code->number = vpip_add_file_line(description, file_idx, lineno);
+      assert(code->number);
 
 	/* Done with the lexor-allocated name string. */
       delete[] description;
@@ -1857,6 +1941,88 @@ void compile_vpi_func_call(char*label, char*name,
       delete[] name;
 }
 
+/*
+ * Step to the instruction that follows cp in the code space, stepping
+ * over a chunk link if the code happens to straddle a chunk boundary.
+ */
+static vvp_code_t code_successor_(vvp_code_t cp)
+{
+      cp += 1;
+      if (cp->opcode == &of_CHUNK_LINK)
+	    cp = cp->cptr;
+      return cp;
+}
+
+/*
+ * A free-running clock of the canonical shape
+ *
+ *    always #<period> clk = ~clk;
+ *
+ * compiles to exactly this loop:
+ *
+ *    T_x %delay <low>, <high>;
+ *        %load/v <bit>, <var>, 1;
+ *        %inv <bit>, 1;
+ *        %set/v <var>, <bit>, 1;
+ *        %jmp T_x;
+ *
+ * Recognize that shape here so that compile_thread can hand the
+ * toggle to the scheduler as a periodic event instead of creating a
+ * thread. The scheduler toggles the variable with the same load,
+ * invert, store effect, and can fast-forward over edges that nothing
+ * observes. Anything else about the shape (wider vectors, extra
+ * statements, intra-assignment delays) falls back to a regular
+ * thread.
+ */
+static bool thread_is_periodic_toggle_(vvp_code_t pc, vvp_net_t*&net,
+				       vvp_time64_t&period)
+{
+      if (pc->opcode != &of_DELAY)
+	    return false;
+
+      vvp_code_t load = code_successor_(pc);
+      if (load == 0 || load->opcode != &of_LOAD_VEC)
+	    return false;
+      if (load->bit_idx[1] != 1)
+	    return false;
+      if (load->net == 0)
+	    return false;
+
+      vvp_code_t inv = code_successor_(load);
+      if (inv == 0 || inv->opcode != &of_INV)
+	    return false;
+      if (inv->bit_idx[0] != load->bit_idx[0] || inv->bit_idx[1] != 1)
+	    return false;
+
+      vvp_code_t set = code_successor_(inv);
+      if (set == 0 || set->opcode != &of_SET_VEC)
+	    return false;
+      if (set->net != load->net)
+	    return false;
+      if (set->bit_idx[0] != load->bit_idx[0] || set->bit_idx[1] != 1)
+	    return false;
+
+      vvp_code_t jmp = code_successor_(set);
+      if (jmp == 0 || jmp->opcode != &of_JMP)
+	    return false;
+      if (jmp->cptr != pc)
+	    return false;
+
+      period = pc->bit_idx[1];
+      period <<= 32;
+      period |= pc->bit_idx[0];
+      if (period == 0)
+	    return false;
+
+	/* The scheduler reads the value back through the signal
+	   filter, so the variable must really be a signal. */
+      if (dynamic_cast<vvp_signal_value*> (load->net->fil) == 0)
+	    return false;
+
+      net = load->net;
+      return true;
+}
+
 /*
  * When the parser finds a thread statement, I create a new thread
  * with the start address referenced by the program symbol passed to
@@ -1876,6 +2042,20 @@ void compile_thread(char*start_sym, char*flag)
       if (flag && (strcmp(flag,"$push") == 0))
 	    push_flag = true;
 
+	/* A recognized free-running clock needs no thread at all;
+	   the scheduler toggles the variable directly. The push flag
+	   does not matter, because the thread would do nothing at
+	   time 0 but schedule its first delay. */
+      vvp_net_t*toggle_net = 0;
+      vvp_time64_t toggle_period = 0;
+      if ((flag == 0 || strcmp(flag,"$final") != 0)
+	  && thread_is_periodic_toggle_(pc, toggle_net, toggle_period)) {
+	    schedule_periodic_toggle(toggle_net, toggle_period);
+	    free(start_sym);
+	    free(flag);
+	    return;
+      }
+
       vthread_t thr = vthread_new(pc, vpip_peek_current_scope());
 
       if (flag && (strcmp(flag,"$final") == 0))
@@ -242,7 +242,7 @@ extern void compile_extend_signed(char*label, long width, struct symb_s arg);
 extern void compile_sfunc(char*label, char*name, char*format_string,
 			  long file_idx, long lineno,
 			  unsigned argc, struct symb_s*argv,
-                          char*trigger_label);
+                          char*trigger_label, bool memo_flag);
 
 extern void compile_repeat(char*label, long width, long repeat,
 			   struct symb_s arg);
@@ -299,6 +299,7 @@ class resolv_list_s {
     private:
       friend void resolv_submit(class resolv_list_s*cur);
       friend void compile_cleanup(void);
+      friend struct resolv_list_label_lt;
 
       char*label_;
       class resolv_list_s*next;
@@ -159,7 +159,8 @@ vvp_fun_delay::vvp_fun_delay(vvp_net_t*n, unsigned width, const vvp_delay_t&d)
       } else {
             schedule_init_propagate(net_, cur_real_);
       }
-      list_ = 0;
+      pend_ = 0;
+      sched_time_ = 0;
       type_ = UNKNOWN_DELAY;
       initial_ = true;
 	// Calculate the values used when converting variable delays
@@ -177,67 +178,25 @@ vvp_fun_delay::vvp_fun_delay(vvp_net_t*n, unsigned width, const vvp_delay_t&d)
 
 vvp_fun_delay::~vvp_fun_delay()
 {
-      while (struct event_*cur = dequeue_())
-	    delete cur;
+      delete pend_;
 }
 
-bool vvp_fun_delay::clean_pulse_events_(vvp_time64_t use_delay,
-                                        const vvp_vector4_t&bit)
-{
-      if (list_ == 0) return false;
-
-	/* If the most recent event and the new event have the same
-	 * value then we need to skip the new event. */
-      if (list_->next->ptr_vec4.eeq(bit)) return true;
-
-      clean_pulse_events_(use_delay);
-      return false;
-}
-
-bool vvp_fun_delay::clean_pulse_events_(vvp_time64_t use_delay,
-                                        const vvp_vector8_t&bit)
-{
-      if (list_ == 0) return false;
-
-	/* If the most recent event and the new event have the same
-	 * value then we need to skip the new event. */
-      if (list_->next->ptr_vec8.eeq(bit)) return true;
-
-      clean_pulse_events_(use_delay);
-      return false;
-}
-
-bool vvp_fun_delay::clean_pulse_events_(vvp_time64_t use_delay,
-                                        double bit)
+/*
+ * Arm a scheduler callback for the pending transaction, but only if
+ * there is not already one armed that is early enough. A callback
+ * that fires before the transaction is due re-arms itself for the
+ * remaining delay in run_run(), so when a pulse pushes the pending
+ * transaction later, nothing needs to be cancelled and nothing new
+ * is put into the event queue.
+ */
+void vvp_fun_delay::schedule_propagate_(vvp_time64_t use_delay,
+					vvp_time64_t use_simtime)
 {
-      if (list_ == 0) return false;
-
-	/* If the most recent event and the new event have the same
-	 * value then we need to skip the new event. */
-      if (list_->next->ptr_real == bit) return true;
-
-      clean_pulse_events_(use_delay);
-      return false;
-}
+      if (sched_time_ > schedule_simtime() && use_simtime >= sched_time_)
+	    return;
 
-void vvp_fun_delay::clean_pulse_events_(vvp_time64_t use_delay)
-{
-      assert(list_ != 0);
-
-      do {
-	    struct event_*cur = list_->next;
-	      /* If this event is far enough from the event I'm about
-	         to create, then that scheduled event is not a pulse
-	         to be eliminated, so we're done. */
-	    if (cur->sim_time+use_delay <= use_delay+schedule_simtime())
-		  break;
-
-	    if (list_ == cur)
-		  list_ = 0;
-	    else
-		  list_->next = cur->next;
-	    delete cur;
-      } while (list_);
+      schedule_generic(this, use_delay, false);
+      sched_time_ = use_simtime;
 }
 
 /*
@@ -294,7 +253,7 @@ void vvp_fun_delay::recv_vec4(vvp_net_ptr_t port, const vvp_vector4_t&bit,
 	      // current value of the output. Detect and handle the
 	      // special case that the event list contains the current
 	      // value as a zero-delay-remaining event.
-	    const vvp_vector4_t&use_vec4 = (list_ && list_->next->sim_time == schedule_simtime())? list_->next->ptr_vec4 : cur_vec4_;
+	    const vvp_vector4_t&use_vec4 = (pend_ && pend_->sim_time == schedule_simtime())? pend_->ptr_vec4 : cur_vec4_;
 
 	      /* How many bits to compare? */
 	    unsigned use_wid = use_vec4.size();
@@ -311,24 +270,28 @@ void vvp_fun_delay::recv_vec4(vvp_net_ptr_t port, const vvp_vector4_t&bit,
 	    }
       }
 
-      /* what *should* happen here is we check to see if there is a
-         transaction in the queue. This would be a pulse that needs to be
-         eliminated. */
-      if (clean_pulse_events_(use_delay, bit)) return;
+	/* A pending transaction with the same value absorbs this
+	   transition; keep its schedule as it is. */
+      if (pend_ && pend_->ptr_vec4.eeq(bit)) return;
 
       vvp_time64_t use_simtime = schedule_simtime() + use_delay;
 
 	/* And propagate it. */
-      if (use_delay == 0 && list_ == 0) {
+      if (use_delay == 0 && pend_ == 0) {
 	    cur_vec4_ = bit;
 	    initial_ = false;
 	    net_->send_vec4(cur_vec4_, 0);
       } else {
-	    struct event_*cur = new struct event_(use_simtime);
-	    cur->run_run_ptr = &vvp_fun_delay::run_run_vec4_;
-	    cur->ptr_vec4 = bit;
-	    enqueue_(cur);
-	    schedule_generic(this, use_delay, false);
+	      /* Replace (and retime) the pending transaction in
+	         place. This is the inertial delay eliminating the
+	         glitch. */
+	    if (pend_ == 0)
+		  pend_ = new struct event_(use_simtime);
+	    else
+		  pend_->sim_time = use_simtime;
+	    pend_->run_run_ptr = &vvp_fun_delay::run_run_vec4_;
+	    pend_->ptr_vec4 = bit;
+	    schedule_propagate_(use_delay, use_simtime);
       }
 }
 
@@ -357,7 +320,7 @@ void vvp_fun_delay::recv_vec8(vvp_net_ptr_t port, const vvp_vector8_t&bit)
 	      // current value of the output. Detect and handle the
 	      // special case that the event list contains the current
 	      // value as a zero-delay-remaining event.
-	    const vvp_vector8_t&use_vec8 = (list_ && list_->next->sim_time == schedule_simtime())? list_->next->ptr_vec8 : cur_vec8_;
+	    const vvp_vector8_t&use_vec8 = (pend_ && pend_->sim_time == schedule_simtime())? pend_->ptr_vec8 : cur_vec8_;
 
 	      /* How many bits to compare? */
 	    unsigned use_wid = use_vec8.size();
@@ -376,24 +339,28 @@ void vvp_fun_delay::recv_vec8(vvp_net_ptr_t port, const vvp_vector8_t&bit)
 	    }
       }
 
-      /* what *should* happen here is we check to see if there is a
-         transaction in the queue. This would be a pulse that needs to be
-         eliminated. */
-      if (clean_pulse_events_(use_delay, bit)) return;
+	/* A pending transaction with the same value absorbs this
+	   transition; keep its schedule as it is. */
+      if (pend_ && pend_->ptr_vec8.eeq(bit)) return;
 
       vvp_time64_t use_simtime = schedule_simtime() + use_delay;
 
 	/* And propagate it. */
-      if (use_delay == 0 && list_ == 0) {
+      if (use_delay == 0 && pend_ == 0) {
 	    cur_vec8_ = bit;
 	    initial_ = false;
 	    net_->send_vec8(cur_vec8_);
       } else {
-	    struct event_*cur = new struct event_(use_simtime);
-	    cur->ptr_vec8 = bit;
-	    cur->run_run_ptr = &vvp_fun_delay::run_run_vec8_;
-	    enqueue_(cur);
-	    schedule_generic(this, use_delay, false);
+	      /* Replace (and retime) the pending transaction in
+	         place. This is the inertial delay eliminating the
+	         glitch. */
+	    if (pend_ == 0)
+		  pend_ = new struct event_(use_simtime);
+	    else
+		  pend_->sim_time = use_simtime;
+	    pend_->ptr_vec8 = bit;
+	    pend_->run_run_ptr = &vvp_fun_delay::run_run_vec8_;
+	    schedule_propagate_(use_delay, use_simtime);
       }
 }
 
@@ -437,39 +404,60 @@ void vvp_fun_delay::recv_real(vvp_net_ptr_t port, double bit,
       vvp_time64_t use_delay;
       use_delay = delay_.get_min_delay();
 
-      /* Eliminate glitches. */
-      if (clean_pulse_events_(use_delay, bit)) return;
-
-      /* This must be done after cleaning pulses to avoid propagating
-       * an incorrect value. */
-      if (cur_real_ == bit) return;
+      /* A pending transaction with the same value absorbs this
+       * transition; keep its schedule as it is. */
+      if (pend_ && pend_->ptr_real == bit) return;
+
+      /* This must be done after checking the pending transaction to
+       * avoid propagating an incorrect value. If the output is going
+       * to stay put after all, drop any pending glitch. */
+      if (cur_real_ == bit) {
+	    if (pend_ && pend_->sim_time > schedule_simtime()) {
+		  delete pend_;
+		  pend_ = 0;
+	    }
+	    return;
+      }
 
       vvp_time64_t use_simtime = schedule_simtime() + use_delay;
 
-      if (use_delay == 0 && list_ == 0) {
+      if (use_delay == 0 && pend_ == 0) {
 	    cur_real_ = bit;
 	    initial_ = false;
 	    net_->send_real(cur_real_, 0);
       } else {
-	    struct event_*cur = new struct event_(use_simtime);
-	    cur->run_run_ptr = &vvp_fun_delay::run_run_real_;
-	    cur->ptr_real = bit;
-	    enqueue_(cur);
+	      /* Replace (and retime) the pending transaction in
+	         place. This is the inertial delay eliminating the
+	         glitch. */
+	    if (pend_ == 0)
+		  pend_ = new struct event_(use_simtime);
+	    else
+		  pend_->sim_time = use_simtime;
+	    pend_->run_run_ptr = &vvp_fun_delay::run_run_real_;
+	    pend_->ptr_real = bit;
 
-	    schedule_generic(this, use_delay, false);
+	    schedule_propagate_(use_delay, use_simtime);
       }
 }
 
 void vvp_fun_delay::run_run()
 {
-      vvp_time64_t sim_time = schedule_simtime();
-      if (list_ == 0 || list_->next->sim_time > sim_time)
+      if (pend_ == 0)
 	    return;
 
-      struct event_*cur = dequeue_();
-      if (cur == 0)
+      vvp_time64_t sim_time = schedule_simtime();
+
+	/* The pending transaction was retimed to a later moment
+	   after this callback was armed. Re-arm for the remaining
+	   delay; this takes the place of cancelling callbacks. */
+      if (pend_->sim_time > sim_time) {
+	    schedule_generic(this, pend_->sim_time - sim_time, false);
+	    sched_time_ = pend_->sim_time;
 	    return;
+      }
 
+      struct event_*cur = pend_;
+      pend_ = 0;
       (this->*(cur->run_run_ptr))(cur);
       initial_ = false;
       delete cur;
@@ -78,14 +78,12 @@ class vvp_fun_delay  : public vvp_net_fun_t, private vvp_gen_event_s {
       struct event_ {
 	    event_(vvp_time64_t s) : sim_time(s) {
 		  ptr_real = 0.0;
-		  next = NULL;
 	    }
 	    void (vvp_fun_delay::*run_run_ptr)(struct vvp_fun_delay::event_*cur);
-	    const vvp_time64_t sim_time;
+	    vvp_time64_t sim_time;
 	    vvp_vector4_t ptr_vec4;
 	    vvp_vector8_t ptr_vec8;
 	    double ptr_real;
-	    struct event_*next;
       };
 
     public:
@@ -118,34 +116,20 @@ class vvp_fun_delay  : public vvp_net_fun_t, private vvp_gen_event_s {
       double cur_real_;
       vvp_time64_t round_, scale_; // Needed to scale variable time values.
 
-      struct event_ *list_;
-      void enqueue_(struct event_*cur)
-      {
-	    if (list_) {
-		  cur->next = list_->next;
-		  list_->next = cur;
-		  list_ = cur;
-	    } else {
-		  cur->next = cur;
-		  list_ = cur;
-	    }
-      }
-      struct event_* dequeue_(void)
-      {
-	    if (list_ == 0)
-		  return 0;
-	    struct event_*cur = list_->next;
-	    if (list_ == cur)
-		  list_ = 0;
-	    else
-		  list_->next = cur->next;
-	    return cur;
-      }
-      bool clean_pulse_events_(vvp_time64_t use_delay, const vvp_vector4_t&bit);
-      bool clean_pulse_events_(vvp_time64_t use_delay, const vvp_vector8_t&bit);
-      bool clean_pulse_events_(vvp_time64_t use_delay, double bit);
-// Delete this when done!
-      void clean_pulse_events_(vvp_time64_t use_delay);
+	// At most one transaction is pending on the output. A new
+	// input transition replaces the value and the time in place
+	// (inertial delay), so there is no pending list to scan and
+	// no events to cancel.
+      struct event_ *pend_;
+
+	// Time of the earliest scheduler callback that is armed for
+	// this functor. A callback that fires before pend_ is due
+	// re-arms itself for the remaining delay in run_run(), so a
+	// transaction that moved later never needs a new callback.
+      vvp_time64_t sched_time_;
+
+      void schedule_propagate_(vvp_time64_t use_delay,
+			       vvp_time64_t use_simtime);
 };
 
 /*
@@ -55,8 +55,18 @@ void vvp_dff::recv_vec4(vvp_net_ptr_t port, const vvp_vector4_t&bit,
 		  break;
 	    tmp = clk_cur_;
 	    clk_cur_ = bit.value(0);
-	    if (clk_cur_ == BIT4_1 && tmp != BIT4_1)
+	    if (clk_cur_ == BIT4_1 && tmp != BIT4_1) {
+		    // The output can only change when the data
+		    // changed, so skip the propagation when the
+		    // stored data matches the last output. Most
+		    // registers hold their value on most edges, and
+		    // the clock fanout dominates the event counts in
+		    // gate level designs.
+		  if (prop_.eeq(d_))
+			break;
+		  prop_ = d_;
 		  port.ptr()->send_vec4(d_, 0);
+	    }
 	    break;
 
 	  case 2: // CE
@@ -75,6 +85,7 @@ void vvp_dff::recv_vec4(vvp_net_ptr_t port, const vvp_vector4_t&bit,
 		  d_ .copy_bits(bit);
 	    else
 		  d_ = bit;
+	    prop_ = d_;
 	    port.ptr()->send_vec4(d_, 0);
 	    break;
       }
@@ -47,6 +47,10 @@ class vvp_dff  : public vvp_net_fun_t {
       vvp_bit4_t clk_cur_;
       vvp_bit4_t enable_;
       vvp_vector4_t d_;
+	// The last value propagated to the output. The clock edge
+	// only sends the data when it differs from this, so
+	// quiescent registers do not re-propagate on every edge.
+      vvp_vector4_t prop_;
 };
 
 #endif
@@ -387,12 +387,10 @@ bool vvp_fun_anyedge::recv_vec4_(const vvp_vector4_t&bit,
 	    }
 
       } else {
-	    for (unsigned idx = 0 ;  idx < bit.size() ;  idx += 1) {
-		  if (old_bits.value(idx) != bit.value(idx)) {
-			flag = true;
-			break;
-		  }
-	    }
+	      // The eeq method compares the vectors a word at a time
+	      // over the bit planes, so a wide bus does not need a
+	      // scan of the individual bits.
+	    flag = ! old_bits.eeq(bit);
       }
 
       if (flag) {
@@ -24,7 +24,7 @@
 # include  <cassert>
 
 vvp_fun_extend_signed::vvp_fun_extend_signed(unsigned wid)
-: width_(wid)
+: width_(wid), pad_(BIT4_Z)
 {
 }
 
@@ -40,14 +40,22 @@ void vvp_fun_extend_signed::recv_vec4(vvp_net_ptr_t port, const vvp_vector4_t&bi
 	    return;
       }
 
-      vvp_vector4_t res (width_);
-
-      for (unsigned idx = 0 ;  idx < bit.size() ;  idx += 1)
-	    res.set_bit(idx, bit.value(idx));
-
+	/* Rebuild the output in the cached vector instead of
+	   materializing a fresh one per delivery. The pad region is
+	   filled whole-vector by the (size,pad) constructor and only
+	   refilled when the sign bit changes; the low bits are
+	   written over it word-at-a-time. With the copy-on-write
+	   payloads, writing the cached vector allocates only if a
+	   receiver still holds a reference to the previously sent
+	   value, so in steady state the extension allocates
+	   nothing. */
       vvp_bit4_t pad = bit.size() > 0? bit.value(bit.size()-1) : BIT4_0;
-      for (unsigned idx = bit.size() ;  idx < res.size() ;  idx += 1)
-	    res.set_bit(idx, pad);
+      if (res_.size() != width_ || pad != pad_) {
+	    res_ = vvp_vector4_t(width_, pad);
+	    pad_ = pad;
+      }
+
+      res_.set_vec(0, bit);
 
-      port.ptr()->send_vec4(res, 0);
+      port.ptr()->send_vec4(res_, 0);
 }
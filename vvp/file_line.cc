@@ -18,6 +18,33 @@
 
 # include "compile.h"
 # include "vpi_priv.h"
+# include <map>
+# include <vector>
+
+/*
+ * The %file_line records of an instrumented design are kept in a
+ * packed side table, and the %file_line opcodes carry an index into
+ * it. An instrumented design has one record per statement, so the
+ * table is what the instrumentation memory cost mostly consists of;
+ * keeping the records at a few words each, deduplicated, matters.
+ * The vpiHandle view of a record is only needed when a diagnostic
+ * actually prints it (trace output, $stop, profile reports), so the
+ * handle objects are created on demand and cached, and the records
+ * that are never displayed never grow one.
+ */
+struct file_line_rec {
+      const char*description;
+      unsigned file_idx;
+      unsigned lineno;
+};
+
+static std::vector<file_line_rec> file_line_table;
+static std::map<unsigned, struct __vpiFileLine*> handle_cache;
+
+	/* Records with no description are deduplicated; several
+	   statements on one source line share one record. */
+typedef std::pair<unsigned,unsigned> file_line_key;
+static std::map<file_line_key, unsigned> dedup_table;
 
 struct __vpiFileLine : public __vpiHandle {
       __vpiFileLine();
@@ -76,18 +103,71 @@ char* __vpiFileLine::vpi_get_str(int code)
 { return file_line_get_str(code, this); }
 
 
-vpiHandle vpip_build_file_line(char*description, long file_idx, long lineno)
+unsigned vpip_add_file_line(char*description, long file_idx, long lineno)
 {
-      struct __vpiFileLine*obj = new struct __vpiFileLine;
-
 	/* Turn on the diagnostic output when we find a %file_line. */
       show_file_line = true;
       code_is_instrumented = true;
 
-      if (description) obj->description = vpip_name_string(description);
-      else obj->description = 0;
-      obj->file_idx = (unsigned) file_idx;
-      obj->lineno = (unsigned) lineno;
+	/* Index 0 means "no record", so burn the first slot. */
+      if (file_line_table.empty()) {
+	    file_line_rec none;
+	    none.description = 0;
+	    none.file_idx = 0;
+	    none.lineno = 0;
+	    file_line_table.push_back(none);
+      }
 
+      if (description == 0) {
+	    file_line_key key ((unsigned)file_idx, (unsigned)lineno);
+	    std::map<file_line_key, unsigned>::iterator cur
+		  = dedup_table.find(key);
+	    if (cur != dedup_table.end())
+		  return cur->second;
+
+	    file_line_rec rec;
+	    rec.description = 0;
+	    rec.file_idx = (unsigned) file_idx;
+	    rec.lineno = (unsigned) lineno;
+	    file_line_table.push_back(rec);
+	    dedup_table[key] = file_line_table.size() - 1;
+	    return file_line_table.size() - 1;
+      }
+
+      file_line_rec rec;
+      rec.description = vpip_name_string(description);
+      rec.file_idx = (unsigned) file_idx;
+      rec.lineno = (unsigned) lineno;
+      file_line_table.push_back(rec);
+      return file_line_table.size() - 1;
+}
+
+vpiHandle vpip_file_line_handle(unsigned idx)
+{
+      if (idx == 0 || idx >= file_line_table.size())
+	    return 0;
+
+      std::map<unsigned, struct __vpiFileLine*>::iterator cur
+	    = handle_cache.find(idx);
+      if (cur != handle_cache.end())
+	    return cur->second;
+
+      struct __vpiFileLine*obj = new struct __vpiFileLine;
+      obj->description = file_line_table[idx].description;
+      obj->file_idx = file_line_table[idx].file_idx;
+      obj->lineno = file_line_table[idx].lineno;
+      handle_cache[idx] = obj;
       return obj;
 }
+
+#ifdef CHECK_WITH_VALGRIND
+void file_line_delete(void)
+{
+      for (std::map<unsigned, struct __vpiFileLine*>::iterator cur
+		 = handle_cache.begin() ; cur != handle_cache.end() ; ++ cur)
+	    delete cur->second;
+      handle_cache.clear();
+      file_line_table.clear();
+      dedup_table.clear();
+}
+#endif
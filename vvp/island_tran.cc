@@ -22,6 +22,7 @@
 # include  "symbols.h"
 # include  "schedule.h"
 # include  <list>
+# include  <vector>
 
 # include  <iostream>
 
@@ -30,9 +31,20 @@ using namespace std;
 class vvp_island_tran : public vvp_island {
 
     public:
+      vvp_island_tran() : comps_valid_(false), ncomps_(0) { }
+
       void run_island();
       void count_drivers(vvp_island_port*port, unsigned bit_idx,
                          unsigned counts[3]);
+
+    private:
+      void number_components_();
+
+	// Set when the branch mesh has been separated into connected
+	// components. The mesh is fixed after linking, so the
+	// numbering is done once, on the first run.
+      bool comps_valid_;
+      unsigned ncomps_;
 };
 
 enum tran_state_t {
@@ -54,6 +66,9 @@ struct vvp_island_branch_tran : public vvp_island_branch {
       unsigned width, part, offset;
       bool active_high;
       tran_state_t state;
+	// Connected component this branch belongs to, numbered from
+	// 1 by vvp_island_tran::number_components_().
+      unsigned comp;
 };
 
 vvp_island_branch_tran::vvp_island_branch_tran(vvp_net_t*en__,
@@ -65,6 +80,7 @@ vvp_island_branch_tran::vvp_island_branch_tran(vvp_net_t*en__,
   active_high(active_high__)
 {
       state = en__ ? tran_disabled : tran_enabled;
+      comp = 0;
 }
 
 static inline vvp_island_branch_tran* BRANCH_TRAN(vvp_island_branch*tmp)
@@ -74,34 +90,108 @@ static inline vvp_island_branch_tran* BRANCH_TRAN(vvp_island_branch*tmp)
       return res;
 }
 
+/*
+ * Number the connected components of the branch mesh. Two branches
+ * are in the same component when they share a node, i.e. when one
+ * shows up in the circular list around either end of the other. A
+ * value change can only affect the component it arrives in, so the
+ * component number is what limits how much of the island a change
+ * re-solves.
+ */
+void vvp_island_tran::number_components_()
+{
+      for (vvp_island_branch*cur = branches_ ; cur ; cur = cur->next_branch)
+	    BRANCH_TRAN(cur)->comp = 0;
+
+      ncomps_ = 0;
+      for (vvp_island_branch*cur = branches_ ; cur ; cur = cur->next_branch) {
+	    vvp_island_branch_tran*tmp = BRANCH_TRAN(cur);
+	    if (tmp->comp != 0)
+		  continue;
+
+	    ncomps_ += 1;
+	    vector<vvp_island_branch_tran*> stack;
+	    tmp->comp = ncomps_;
+	    stack.push_back(tmp);
+
+	    while (! stack.empty()) {
+		  vvp_island_branch_tran*bra = stack.back();
+		  stack.pop_back();
+
+		  for (unsigned ab = 0 ;  ab < 2 ;  ab += 1) {
+			vvp_branch_ptr_t side(bra, ab);
+			for (vvp_branch_ptr_t idx = next(side)
+				   ; idx != side ; idx = next(idx)) {
+			      vvp_island_branch_tran*oth = BRANCH_TRAN(idx.ptr());
+			      if (oth->comp != 0)
+				    continue;
+			      oth->comp = ncomps_;
+			      stack.push_back(oth);
+			}
+		  }
+	    }
+      }
+
+      comps_valid_ = true;
+}
+
 /*
  * The run_island() method is called by the scheduler to run the
- * entire island. We run the island by calling run_resolution() for
- * all the branches in the island.
+ * island. We only need to re-solve the connected components that a
+ * change arrived in since the last run; the others still hold their
+ * last stable solution, and their output ports keep their values.
 */
 void vvp_island_tran::run_island()
 {
-	// Test to see if any of the branches are enabled. This loop
-	// tests the enabled inputs for all the branches and caches
-	// the results in the state for each branch.
-      bool runnable = false;
+      if (! comps_valid_)
+	    number_components_();
+
+	// Test the enable inputs for all the branches and cache the
+	// results in the state for each branch. A branch whose
+	// enable state changed, or that touches a port with changed
+	// input, marks its component to be solved again.
+      vector<bool> dirty (ncomps_+1, false);
       for (vvp_island_branch*cur = branches_ ; cur ; cur = cur->next_branch) {
 	    vvp_island_branch_tran*tmp = dynamic_cast<vvp_island_branch_tran*>(cur);
 	    assert(tmp);
-	    runnable |= tmp->run_test_enabled();
+
+	    tran_state_t prev_state = tmp->state;
+	    tmp->run_test_enabled();
+	    if (tmp->state != prev_state)
+		  dirty[tmp->comp] = true;
+
+	    vvp_island_port*pa = dynamic_cast<vvp_island_port*>(tmp->a->fun);
+	    vvp_island_port*pb = dynamic_cast<vvp_island_port*>(tmp->b->fun);
+	    if (pa->changed || pb->changed)
+		  dirty[tmp->comp] = true;
       }
 
-	// Now resolve all the branches in the island.
+	// The changes are accounted for now, so clear the port
+	// flags. This must happen before the resolution below, which
+	// can feed values back into ports of this same island.
       for (vvp_island_branch*cur = branches_ ; cur ; cur = cur->next_branch) {
-	    vvp_island_branch_tran*tmp = dynamic_cast<vvp_island_branch_tran*>(cur);
-	    assert(tmp);
+	    vvp_island_branch_tran*tmp = BRANCH_TRAN(cur);
+	    dynamic_cast<vvp_island_port*>(tmp->a->fun)->changed = false;
+	    dynamic_cast<vvp_island_port*>(tmp->b->fun)->changed = false;
+	    if (tmp->en) {
+		  vvp_island_port*pe = dynamic_cast<vvp_island_port*>(tmp->en->fun);
+		  if (pe) pe->changed = false;
+	    }
+      }
+
+	// Now resolve the branches in the affected components.
+      for (vvp_island_branch*cur = branches_ ; cur ; cur = cur->next_branch) {
+	    vvp_island_branch_tran*tmp = BRANCH_TRAN(cur);
+	    if (! dirty[tmp->comp])
+		  continue;
 	    tmp->run_resolution();
       }
 
 	// Now output the resolved values.
       for (vvp_island_branch*cur = branches_ ; cur ; cur = cur->next_branch) {
-	    vvp_island_branch_tran*tmp = dynamic_cast<vvp_island_branch_tran*>(cur);
-	    assert(tmp);
+	    vvp_island_branch_tran*tmp = BRANCH_TRAN(cur);
+	    if (! dirty[tmp->comp])
+		  continue;
 	    tmp->run_output();
       }
 }
@@ -29,11 +29,15 @@
 # include  <cassert>
 # include  <cstdlib>
 
-vvp_fun_boolean_::vvp_fun_boolean_(unsigned wid)
+vvp_fun_boolean_::vvp_fun_boolean_(unsigned wid, vvp_bit4_t ident)
 {
       net_ = 0;
       for (unsigned idx = 0 ;  idx < 4 ;  idx += 1)
 	    input_[idx] = vvp_vector4_t(wid, BIT4_Z);
+
+	// No port holds the identity until a value is received.
+      ident_vec_ = vvp_vector4_t(wid, ident);
+      ident_mask_ = 0;
 }
 
 vvp_fun_boolean_::~vvp_fun_boolean_()
@@ -48,6 +52,16 @@ void vvp_fun_boolean_::recv_vec4(vvp_net_ptr_t ptr, const vvp_vector4_t&bit,
 	    return;
 
       input_[port] = bit;
+
+	// Note whether the port now holds the identity vector. The
+	// real inputs differ in the first word almost always, so
+	// this compare is cheap for them; the padding constants pass
+	// it once at time 0 and are then skipped by run_run.
+      if (input_[port] .eeq( ident_vec_ ))
+	    ident_mask_ |= 1u << port;
+      else
+	    ident_mask_ &= ~(1u << port);
+
       if (net_ == 0) {
 	    net_ = ptr.ptr();
 	    schedule_functor(this);
@@ -68,14 +82,28 @@ void vvp_fun_boolean_::recv_vec4_pv(vvp_net_ptr_t ptr, const vvp_vector4_t&bit,
       if (flag == false)
 	    return;
 
+      if (input_[port] .eeq( ident_vec_ ))
+	    ident_mask_ |= 1u << port;
+      else
+	    ident_mask_ &= ~(1u << port);
+
       if (net_ == 0) {
 	    net_ = ptr.ptr();
 	    schedule_functor(this);
       }
 }
 
+void vvp_fun_boolean_::send_result_(vvp_net_t*net, const vvp_vector4_t&result)
+{
+      if (out_ .eeq( result ))
+	    return;
+
+      out_ = result;
+      net->send_vec4(out_, 0);
+}
+
 vvp_fun_and::vvp_fun_and(unsigned wid, bool invert)
-: vvp_fun_boolean_(wid), invert_(invert)
+: vvp_fun_boolean_(wid, BIT4_1), invert_(invert)
 {
       count_functors_logic += 1;
 }
@@ -91,9 +119,29 @@ void vvp_fun_and::run_run()
 
       vvp_vector4_t result (input_[0]);
 
+	/* In the common case all the inputs have the full width, and
+	   the word-parallel vector4 operator implements the same
+	   4-state truth table, so the bit-by-bit loop (which is only
+	   there to patch short inputs with X) can be skipped. */
+      if (input_[1].size() == result.size()
+	  && input_[2].size() == result.size()
+	  && input_[3].size() == result.size()) {
+	    for (unsigned pdx = 1 ;  pdx < 4 ;  pdx += 1) {
+		  if (ident_mask_ & (1u << pdx))
+			continue;
+		  result &= input_[pdx];
+	    }
+	    if (invert_)
+		  result.invert();
+	    send_result_(ptr, result);
+	    return;
+      }
+
       for (unsigned idx = 0 ;  idx < result.size() ;  idx += 1) {
 	    vvp_bit4_t bitbit = result.value(idx);
 	    for (unsigned pdx = 1 ;  pdx < 4 ;  pdx += 1) {
+		  if (ident_mask_ & (1u << pdx))
+			continue;
 		  if (input_[pdx].size() < idx) {
 			bitbit = BIT4_X;
 			break;
@@ -107,13 +155,14 @@ void vvp_fun_and::run_run()
 	    result.set_bit(idx, bitbit);
       }
 
-      ptr->send_vec4(result, 0);
+      send_result_(ptr, result);
 }
 
 vvp_fun_buf::vvp_fun_buf(unsigned wid)
 : input_(wid, BIT4_Z)
 {
       net_ = 0;
+      immediate_ = false;
       count_functors_logic += 1;
 }
 
@@ -136,6 +185,16 @@ void vvp_fun_buf::recv_vec4(vvp_net_ptr_t ptr, const vvp_vector4_t&bit,
 
       input_ = bit;
 
+      if (immediate_) {
+	    vvp_vector4_t tmp (input_);
+	    tmp.change_z2x();
+	    if (! out_ .eeq( tmp )) {
+		  out_ = tmp;
+		  ptr.ptr()->send_vec4(out_, 0);
+	    }
+	    return;
+      }
+
       if (net_ == 0) {
 	    net_ = ptr.ptr();
 	    schedule_functor(this);
@@ -157,6 +216,16 @@ void vvp_fun_buf::recv_vec4_pv(vvp_net_ptr_t ptr, const vvp_vector4_t&bit,
       if (flag == false)
 	    return;
 
+      if (immediate_) {
+	    vvp_vector4_t tmp (input_);
+	    tmp.change_z2x();
+	    if (! out_ .eeq( tmp )) {
+		  out_ = tmp;
+		  ptr.ptr()->send_vec4(out_, 0);
+	    }
+	    return;
+      }
+
       if (net_ == 0) {
 	    net_ = ptr.ptr();
 	    schedule_functor(this);
@@ -170,7 +239,14 @@ void vvp_fun_buf::run_run()
 
       vvp_vector4_t tmp (input_);
       tmp.change_z2x();
-      ptr->send_vec4(tmp, 0);
+
+	/* A Z->X edge on the input can leave the output unchanged,
+	   so filter against the last value sent. */
+      if (out_ .eeq( tmp ))
+	    return;
+
+      out_ = tmp;
+      ptr->send_vec4(out_, 0);
 }
 
 vvp_fun_bufz::vvp_fun_bufz()
@@ -441,6 +517,7 @@ vvp_fun_not::vvp_fun_not(unsigned wid)
 : input_(wid, BIT4_Z)
 {
       net_ = 0;
+      immediate_ = false;
       count_functors_logic += 1;
 }
 
@@ -462,6 +539,16 @@ void vvp_fun_not::recv_vec4(vvp_net_ptr_t ptr, const vvp_vector4_t&bit,
 	    return;
 
       input_ = bit;
+
+      if (immediate_) {
+	    vvp_vector4_t result (input_, true /* invert */);
+	    if (! out_ .eeq( result )) {
+		  out_ = result;
+		  ptr.ptr()->send_vec4(out_, 0);
+	    }
+	    return;
+      }
+
       if (net_ == 0) {
 	    net_ = ptr.ptr();
 	    schedule_functor(this);
@@ -483,6 +570,15 @@ void vvp_fun_not::recv_vec4_pv(vvp_net_ptr_t ptr, const vvp_vector4_t&bit,
       if (flag == false)
 	    return;
 
+      if (immediate_) {
+	    vvp_vector4_t result (input_, true /* invert */);
+	    if (! out_ .eeq( result )) {
+		  out_ = result;
+		  ptr.ptr()->send_vec4(out_, 0);
+	    }
+	    return;
+      }
+
       if (net_ == 0) {
 	    net_ = ptr.ptr();
 	    schedule_functor(this);
@@ -495,11 +591,18 @@ void vvp_fun_not::run_run()
       net_ = 0;
 
       vvp_vector4_t result (input_, true /* invert */);
-      ptr->send_vec4(result, 0);
+
+	/* Inversion maps both Z and X input bits to X, so an input
+	   change is not always an output change. */
+      if (out_ .eeq( result ))
+	    return;
+
+      out_ = result;
+      ptr->send_vec4(out_, 0);
 }
 
 vvp_fun_or::vvp_fun_or(unsigned wid, bool invert)
-: vvp_fun_boolean_(wid), invert_(invert)
+: vvp_fun_boolean_(wid, BIT4_0), invert_(invert)
 {
       count_functors_logic += 1;
 }
@@ -515,9 +618,26 @@ void vvp_fun_or::run_run()
 
       vvp_vector4_t result (input_[0]);
 
+	/* Same word-parallel fast path as vvp_fun_and::run_run. */
+      if (input_[1].size() == result.size()
+	  && input_[2].size() == result.size()
+	  && input_[3].size() == result.size()) {
+	    for (unsigned pdx = 1 ;  pdx < 4 ;  pdx += 1) {
+		  if (ident_mask_ & (1u << pdx))
+			continue;
+		  result |= input_[pdx];
+	    }
+	    if (invert_)
+		  result.invert();
+	    send_result_(ptr, result);
+	    return;
+      }
+
       for (unsigned idx = 0 ;  idx < result.size() ;  idx += 1) {
 	    vvp_bit4_t bitbit = result.value(idx);
 	    for (unsigned pdx = 1 ;  pdx < 4 ;  pdx += 1) {
+		  if (ident_mask_ & (1u << pdx))
+			continue;
 		  if (input_[pdx].size() < idx) {
 			bitbit = BIT4_X;
 			break;
@@ -531,11 +651,11 @@ void vvp_fun_or::run_run()
 	    result.set_bit(idx, bitbit);
       }
 
-      ptr->send_vec4(result, 0);
+      send_result_(ptr, result);
 }
 
 vvp_fun_xor::vvp_fun_xor(unsigned wid, bool invert)
-: vvp_fun_boolean_(wid), invert_(invert)
+: vvp_fun_boolean_(wid, BIT4_0), invert_(invert)
 {
       count_functors_logic += 1;
 }
@@ -554,6 +674,8 @@ void vvp_fun_xor::run_run()
       for (unsigned idx = 0 ;  idx < result.size() ;  idx += 1) {
 	    vvp_bit4_t bitbit = result.value(idx);
 	    for (unsigned pdx = 1 ;  pdx < 4 ;  pdx += 1) {
+		  if (ident_mask_ & (1u << pdx))
+			continue;
 		  if (input_[pdx].size() < idx) {
 			bitbit = BIT4_X;
 			break;
@@ -567,7 +689,73 @@ void vvp_fun_xor::run_run()
 	    result.set_bit(idx, bitbit);
       }
 
-      ptr->send_vec4(result, 0);
+      send_result_(ptr, result);
+}
+
+/*
+ * Fusion of linear combinational chains. Synthesized netlists string
+ * several single-input gates (BUF, NOT) between the interesting
+ * logic, and each one normally costs a scheduler round trip: the
+ * receive call stores the input and schedules a functor event, whose
+ * run_run later sends the output one hop further. For a gate with a
+ * single input that batching buys nothing, so such gates can instead
+ * evaluate and propagate inside the receive call, the way the BUFZ
+ * functor always has, and a value change then sweeps the whole chain
+ * in one call.
+ *
+ * A gate is only marked for immediate evaluation when following its
+ * single fan-out through single-fanout pipe gates reaches a gate
+ * that still schedules (or a non-gate receiver) within a bounded
+ * number of hops. That bound caps the receive-call recursion depth,
+ * and it refuses to mark a zero-delay cycle made entirely of pipe
+ * gates, which must keep going through the scheduler to hang
+ * politely instead of overflowing the stack.
+ */
+static const unsigned FUSE_PIPE_RUN_MAX = 64;
+
+static bool is_pipe_gate(vvp_net_t*net)
+{
+      if (dynamic_cast<vvp_fun_buf*> (net->fun))
+	    return true;
+      if (dynamic_cast<vvp_fun_not*> (net->fun))
+	    return true;
+      return false;
+}
+
+unsigned long vvp_fuse_pipe_gates(void)
+{
+      unsigned long fused = 0;
+
+      for (unsigned long idx = 0 ; idx < count_vvp_nets ; idx += 1) {
+	    vvp_net_t*net = vvp_net_index(idx);
+	    if (! is_pipe_gate(net))
+		  continue;
+	    if (net->fanout_count() != 1)
+		  continue;
+
+	      // Look for a scheduling point downstream. Any functor
+	      // that is not a single-fanout pipe gate breaks the run
+	      // of immediate evaluations.
+	    vvp_net_t*cur = net->fanout(0).ptr();
+	    bool stop_found = false;
+	    for (unsigned hop = 1 ; hop < FUSE_PIPE_RUN_MAX ; hop += 1) {
+		  if (! is_pipe_gate(cur) || cur->fanout_count() != 1) {
+			stop_found = true;
+			break;
+		  }
+		  cur = cur->fanout(0).ptr();
+	    }
+	    if (! stop_found)
+		  continue;
+
+	    if (vvp_fun_buf*buf = dynamic_cast<vvp_fun_buf*> (net->fun))
+		  buf->fuse_immediate();
+	    else if (vvp_fun_not*inv = dynamic_cast<vvp_fun_not*> (net->fun))
+		  inv->fuse_immediate();
+	    fused += 1;
+      }
+
+      return fused;
 }
 
 /*
@@ -24,12 +24,19 @@
 # include  <cstddef>
 
 /*
- * vvp_fun_boolean_ is just a common hook for holding operands.
+ * vvp_fun_boolean_ is just a common hook for holding operands. The
+ * code generator always pads a gate out to 4 inputs with the identity
+ * constant of the operation (1 for AND, 0 for OR and XOR), so most
+ * gates in a synthesized netlist have two real inputs and two that
+ * receive the identity once at time 0 and never change. Each receive
+ * notes whether the port now holds the identity vector, and the
+ * evaluation kernels skip those ports entirely, so a padded 2-input
+ * gate evaluates with a single plane operation.
  */
 class vvp_fun_boolean_ : public vvp_net_fun_t, protected vvp_gen_event_s {
 
     public:
-      explicit vvp_fun_boolean_(unsigned wid);
+      vvp_fun_boolean_(unsigned wid, vvp_bit4_t ident);
       ~vvp_fun_boolean_();
 
       void recv_vec4(vvp_net_ptr_t p, const vvp_vector4_t&bit,
@@ -38,9 +45,22 @@ class vvp_fun_boolean_ : public vvp_net_fun_t, protected vvp_gen_event_s {
 			unsigned base, unsigned wid, unsigned vwid,
                         vvp_context_t);
 
+    protected:
+	// Send the result downstream only if it differs from the
+	// last value sent. An input edge that the gate absorbs (some
+	// other input dominates the output) stops here instead of
+	// sweeping the whole fanout with an identical value.
+      void send_result_(vvp_net_t*net, const vvp_vector4_t&result);
+
     protected:
       vvp_vector4_t input_[4];
       vvp_net_t*net_;
+	// The identity vector of the operation, and the mask of the
+	// ports whose input currently equals it.
+      vvp_vector4_t ident_vec_;
+      unsigned ident_mask_;
+	// The last value sent, for the change cutoff.
+      vvp_vector4_t out_;
 };
 
 class vvp_fun_and  : public vvp_fun_boolean_ {
@@ -72,12 +92,18 @@ class vvp_fun_buf: public vvp_net_fun_t, private vvp_gen_event_s {
 			unsigned base, unsigned wid, unsigned vwid,
                         vvp_context_t);
 
+	// Evaluate in the receive call instead of scheduling a
+	// functor event. Set by vvp_fuse_pipe_gates at load time.
+      void fuse_immediate() { immediate_ = true; }
+
     private:
       void run_run();
 
     private:
       vvp_vector4_t input_;
+      vvp_vector4_t out_;
       vvp_net_t*net_;
+      bool immediate_;
 };
 
 /*
@@ -182,12 +208,18 @@ class vvp_fun_not: public vvp_net_fun_t, private vvp_gen_event_s {
 			unsigned base, unsigned wid, unsigned vwid,
                         vvp_context_t);
 
+	// Evaluate in the receive call instead of scheduling a
+	// functor event. Set by vvp_fuse_pipe_gates at load time.
+      void fuse_immediate() { immediate_ = true; }
+
     private:
       void run_run();
 
     private:
       vvp_vector4_t input_;
+      vvp_vector4_t out_;
       vvp_net_t*net_;
+      bool immediate_;
 };
 
 class vvp_fun_or  : public vvp_fun_boolean_ {
@@ -212,4 +244,11 @@ class vvp_fun_xor  : public vvp_fun_boolean_ {
       bool invert_;
 };
 
+// Walk the net graph and mark the single-fanout BUF and NOT gates of
+// linear combinational chains for immediate evaluation, so that a
+// value change sweeps the whole chain in one receive call instead of
+// costing a scheduler round trip per hop. Returns the number of
+// gates marked. Run once after compile, before simulation starts.
+extern unsigned long vvp_fuse_pipe_gates(void);
+
 #endif // __logic_H
@@ -23,10 +23,12 @@
 # include  "parse_misc.h"
 # include  "compile.h"
 # include  "schedule.h"
+# include  "logic.h"
 # include  "vpi_priv.h"
 # include  "statistics.h"
 # include  "vvp_cleanup.h"
 # include  "vvp_object.h"
+# include  "permaheap.h"
 # include  <cstdio>
 # include  <cstdlib>
 # include  <cstring>
@@ -46,6 +48,11 @@
 
 #if defined(__MINGW32__)
 # include  <windows.h>
+#else
+# include  <cerrno>
+# include  <sys/socket.h>
+# include  <sys/un.h>
+# include  <sys/wait.h>
 #endif
 
 ofstream debug_file;
@@ -215,6 +222,7 @@ static void final_cleanup()
 	/* Clear the static result buffer. */
       (void)need_result_buf(0, RBUF_DEL);
       codespace_delete();
+      file_line_delete();
       root_table_delete();
       def_table_delete();
       vpi_mcd_delete();
@@ -245,6 +253,119 @@ static void final_cleanup()
 #endif
 }
 
+#if !defined(__MINGW32__)
+/*
+ * Server mode. By the time this is called the design is compiled and
+ * initialized, so this process holds a ready-to-run simulation.
+ * Listen on a UNIX domain socket; each connection supplies one line
+ * of plusargs for a test run, and the run executes in a fork()ed
+ * child that inherits the initialized design by copy-on-write, so the
+ * per-run startup cost is just the fork. The output of the run is
+ * sent back over the connection. The line "quit" shuts the server
+ * down.
+ */
+static int server_mode_run(const char*path, const char*design_path)
+{
+      extern void vpi_set_vlog_info(int, char**);
+      const unsigned ARGS_MAX = 256;
+
+      int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+      if (fd < 0) {
+	    perror(path);
+	    return 1;
+      }
+
+      struct sockaddr_un addr;
+      memset(&addr, 0, sizeof addr);
+      addr.sun_family = AF_UNIX;
+      strncpy(addr.sun_path, path, sizeof addr.sun_path - 1);
+
+      unlink(path);
+      if (bind(fd, (struct sockaddr*)&addr, sizeof addr) < 0) {
+	    perror(path);
+	    close(fd);
+	    return 1;
+      }
+      if (listen(fd, 4) < 0) {
+	    perror(path);
+	    close(fd);
+	    return 1;
+      }
+
+      for (;;) {
+	    int conn = accept(fd, 0, 0);
+	    if (conn < 0) {
+		  if (errno == EINTR)
+			continue;
+		  perror(path);
+		  break;
+	    }
+
+	      /* Read the request line. */
+	    char line[4096];
+	    size_t fill = 0;
+	    ssize_t rc;
+	    while (fill < sizeof line - 1
+		   && memchr(line, '\n', fill) == 0
+		   && (rc = read(conn, line+fill, sizeof line-1-fill)) > 0)
+		  fill += rc;
+	    line[fill] = 0;
+	    if (char*nl = strchr(line, '\n'))
+		  *nl = 0;
+
+	    if (strcmp(line, "quit") == 0) {
+		  close(conn);
+		  break;
+	    }
+
+	      /* Flush buffered output so that it is not replayed
+		 into every run. */
+	    fflush(0);
+
+	    pid_t pid = fork();
+	    if (pid < 0) {
+		  perror("vvp: fork");
+		  close(conn);
+		  continue;
+	    }
+
+	    if (pid == 0) {
+		    /* This child is the test run. Send the output to
+		       the client, and replace the plusargs with the
+		       ones from the request. */
+		  close(fd);
+		  dup2(conn, 1);
+		  dup2(conn, 2);
+		  close(conn);
+
+		  static char*run_argv[ARGS_MAX];
+		  int run_argc = 0;
+		  run_argv[run_argc++] = const_cast<char*>(design_path);
+		  for (char*cp = strtok(line, " \t")
+			     ; cp && run_argc < (int)ARGS_MAX
+			     ; cp = strtok(0, " \t"))
+			run_argv[run_argc++] = cp;
+		  vpi_set_vlog_info(run_argc, run_argv);
+
+		  schedule_simulate();
+		  final_cleanup();
+		  exit(vvp_return_value);
+	    }
+
+	      /* The parent holds the initialized design. Close our
+		 end of the connection and wait for the run to finish
+		 before taking the next request. */
+	    close(conn);
+	    int status = 0;
+	    waitpid(pid, &status, 0);
+      }
+
+      close(fd);
+      unlink(path);
+      return 0;
+}
+#endif
+
 unsigned module_cnt = 0;
 const char*module_tab[64];
 
@@ -256,6 +377,7 @@ int main(int argc, char*argv[])
       int opt;
       unsigned flag_errors = 0;
       const char*design_path = 0;
+      const char*server_path = 0;
       struct rusage cycles[3];
       const char *logfile_name = 0x0;
       FILE *logfile = 0x0;
@@ -316,7 +438,7 @@ int main(int argc, char*argv[])
         /* For non-interactive runs we do not want to run the interactive
          * debugger, so make $stop just execute a $finish. */
       stop_is_finish = false;
-      while ((opt = getopt(argc, argv, "+hl:M:m:nNsvV")) != EOF) switch (opt) {
+      while ((opt = getopt(argc, argv, "+hl:M:m:nNsS:vV")) != EOF) switch (opt) {
          case 'h':
            fprintf(stderr,
                    "Usage: vvp [options] input-file [+plusargs...]\n"
@@ -329,6 +451,8 @@ int main(int argc, char*argv[])
 		   " -n             Non-interactive ($stop = $finish).\n"
                    " -N             Same as -n, but exit code is 1 instead of 0\n"
 		   " -s             $stop right away.\n"
+		   " -S socket      Server mode: take plusargs for each run\n"
+		   "                from the UNIX domain socket.\n"
                    " -v             Verbose progress messages.\n"
                    " -V             Print the version information.\n" );
            exit(0);
@@ -356,6 +480,15 @@ int main(int argc, char*argv[])
 	  case 's':
 	    schedule_stop(0);
 	    break;
+	  case 'S':
+#if defined(__MINGW32__)
+	    fprintf(stderr, "%s: server mode is not available on this "
+		    "platform.\n", argv[0]);
+	    flag_errors += 1;
+#else
+	    server_path = optarg;
+#endif
+	    break;
 	  case 'v':
 	    verbose_flag = true;
 	    break;
@@ -493,6 +626,17 @@ int main(int argc, char*argv[])
 	    vpi_mcd_printf(1, " ... %8lu vvp_nets (%zu bytes)\n",
 #endif
 			   count_vvp_nets, size_vvp_nets);
+#ifdef __MINGW32__  /* MinGW does not know about z. */
+	    vpi_mcd_printf(1, " ... arena %u bytes (%u hugepage-aligned)\n",
+#else
+	    vpi_mcd_printf(1, " ... arena %zu bytes (%zu hugepage-aligned)\n",
+#endif
+			   arena_chunk_total(), arena_chunk_huge());
+	    { unsigned long largest = 0;
+	      unsigned long parts = count_net_partitions(largest);
+	      vpi_mcd_printf(1, " ... %8lu net partitions (largest %lu nets)\n",
+			     parts, largest);
+	    }
 	    vpi_mcd_printf(1, " ... %8lu arrays (%lu words)\n",
 			   count_net_arrays, count_net_array_words);
 	    vpi_mcd_printf(1, " ... %8lu memories\n",
@@ -504,12 +648,30 @@ int main(int argc, char*argv[])
 	    vpi_mcd_printf(1, " ... %8lu scopes\n",   count_vpi_scopes);
       }
 
+	/* Mark the single-fanout BUF and NOT gates of linear
+	   combinational chains for immediate evaluation, so a value
+	   change sweeps the whole chain in one receive call instead
+	   of costing a scheduler round trip per hop. */
+      { unsigned long fused = vvp_fuse_pipe_gates();
+	if (verbose_flag && fused)
+	      vpi_mcd_printf(1, " ... %8lu fused pipe gates\n", fused);
+      }
+
       if (verbose_flag) {
 	    my_getrusage(cycles+1);
 	    print_rusage(cycles+1, cycles+0);
 	    vpi_mcd_printf(1, "Running ...\n");
       }
 
+#if !defined(__MINGW32__)
+      if (server_path != 0) {
+	    int rc = server_mode_run(server_path, design_path);
+	    final_cleanup();
+	    return rc;
+      }
+#else
+      (void) server_path;
+#endif
 
       schedule_simulate();
 
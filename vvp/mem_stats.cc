@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2013 Stephen Williams (steve@icarus.com)
+ *
+ *    This source code is free software; you can redistribute it
+ *    and/or modify it in source code form under the terms of the GNU
+ *    General Public License as published by the Free Software
+ *    Foundation; either version 2 of the License, or (at your option)
+ *    any later version.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this program; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+# include  "mem_stats.h"
+# include  "vpi_priv.h"
+# include  "vthread.h"
+# include  <map>
+# include  <string>
+
+using namespace std;
+
+/*
+ * The accounts themselves. Each scope that owns any counted object
+ * gets a cell with a byte count per object kind. The map is small
+ * (one entry per scope) so it is kept live for the whole run and only
+ * walked when a report is requested.
+ */
+struct mem_stats_cell_s {
+      long bytes[MEM_STATS_KINDS];
+};
+
+static map<struct __vpiScope*, mem_stats_cell_s> mem_stats_table;
+
+	/* Running total over all scopes and kinds, kept up to date in
+	   mem_stats_add() so querying it is O(1). */
+static long mem_stats_total = 0;
+
+struct __vpiScope* mem_stats_current_scope(void)
+{
+      if (struct __vpiScope*scope = vthread_running_scope())
+	    return scope;
+
+      return vpip_peek_current_scope();
+}
+
+void mem_stats_add(struct __vpiScope*scope, mem_stats_kind_e kind, long bytes)
+{
+	// A new cell from the map is value-initialized, so the
+	// counts start out zero.
+      mem_stats_cell_s&cell = mem_stats_table[scope];
+      cell.bytes[kind] += bytes;
+      mem_stats_total += bytes;
+}
+
+long mem_stats_total_bytes(void)
+{
+      return mem_stats_total;
+}
+
+size_t mem_stats_vec4_bytes(unsigned wid)
+{
+      const unsigned bits_per_word = 8 * sizeof(unsigned long);
+
+	// Narrow values fit in the value words of the object itself.
+      if (wid <= bits_per_word)
+	    return 0;
+
+      size_t words = (wid + bits_per_word - 1) / bits_per_word;
+      return 2 * words * sizeof(unsigned long);
+}
+
+/*
+ * Print the full hierarchical name of the scope, by recursively
+ * printing the parent path then appending the scope base name.
+ */
+static void mem_stats_scope_path(struct __vpiScope*scope, string&path)
+{
+      if (scope->scope) {
+	    mem_stats_scope_path(scope->scope, path);
+	    path += ".";
+	    path += scope->name;
+      } else {
+	    path = scope->name;
+      }
+}
+
+static PLI_INT32 ivl_memory_report_calltf(ICARUS_VPI_CONST PLI_BYTE8*name)
+{
+      (void) name; /* Not used! */
+
+	// Sort the scopes by their total, largest first.
+      multimap<long, struct __vpiScope*> order;
+      long grand[MEM_STATS_KINDS];
+      long grand_total = 0;
+      for (unsigned idx = 0 ;  idx < MEM_STATS_KINDS ;  idx += 1)
+	    grand[idx] = 0;
+
+      for (map<struct __vpiScope*, mem_stats_cell_s>::iterator cur
+		 = mem_stats_table.begin()
+		 ; cur != mem_stats_table.end() ; ++ cur) {
+	    long total = 0;
+	    for (unsigned idx = 0 ;  idx < MEM_STATS_KINDS ;  idx += 1) {
+		  total += cur->second.bytes[idx];
+		  grand[idx] += cur->second.bytes[idx];
+	    }
+	    grand_total += total;
+	    order.insert(make_pair(-total, cur->first));
+      }
+
+      vpi_printf("Estimated design memory by scope:\n");
+      vpi_printf("%12s %12s %12s %12s %12s  %s\n",
+		 "signals", "arrays", "class", "darray", "total", "scope");
+
+      for (multimap<long, struct __vpiScope*>::iterator cur = order.begin()
+		 ; cur != order.end() ; ++ cur) {
+	    mem_stats_cell_s&cell = mem_stats_table[cur->second];
+	    string path ("<no scope>");
+	    if (cur->second)
+		  mem_stats_scope_path(cur->second, path);
+	    vpi_printf("%12ld %12ld %12ld %12ld %12ld  %s\n",
+		       cell.bytes[MEM_STATS_SIGNAL],
+		       cell.bytes[MEM_STATS_ARRAY],
+		       cell.bytes[MEM_STATS_COBJECT],
+		       cell.bytes[MEM_STATS_DARRAY],
+		       -cur->first, path.c_str());
+      }
+
+      vpi_printf("%12ld %12ld %12ld %12ld %12ld  TOTAL\n",
+		 grand[MEM_STATS_SIGNAL],
+		 grand[MEM_STATS_ARRAY],
+		 grand[MEM_STATS_COBJECT],
+		 grand[MEM_STATS_DARRAY],
+		 grand_total);
+
+      return 0;
+}
+
+void mem_stats_register_systf(void)
+{
+      s_vpi_systf_data tf_data;
+      vpiHandle res;
+
+      tf_data.type        = vpiSysTask;
+      tf_data.calltf      = ivl_memory_report_calltf;
+      tf_data.compiletf   = 0;
+      tf_data.sizetf      = 0;
+      tf_data.tfname      = "$ivl_memory_report";
+      tf_data.user_data   = 0;
+      res = vpi_register_systf(&tf_data);
+      vpip_make_systf_system_defined(res);
+}
@@ -0,0 +1,87 @@
+#ifndef __mem_stats_H
+#define __mem_stats_H
+/*
+ * Copyright (c) 2013 Stephen Williams (steve@icarus.com)
+ *
+ *    This source code is free software; you can redistribute it
+ *    and/or modify it in source code form under the terms of the GNU
+ *    General Public License as published by the Free Software
+ *    Foundation; either version 2 of the License, or (at your option)
+ *    any later version.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this program; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+// The SunPro C++ compiler is broken and does not define size_t in cstddef.
+#ifdef __SUNPRO_CC
+# include  <stddef.h>
+#else
+# include  <cstddef>
+#endif
+
+/*
+ * These functions keep a running account of the major design memory
+ * that vvp allocates -- signal storage, memories/arrays, class
+ * objects and dynamic arrays -- keyed by the scope that owns each
+ * object. The byte counts are estimates of the storage held, not
+ * exact heap measurements, but they are good enough to point at the
+ * generate region or class that is responsible when a simulation
+ * balloons.
+ *
+ * The per-scope breakdown is printed by the $ivl_memory_report system
+ * task, which mem_stats_register_systf() registers during simulator
+ * setup.
+ */
+
+enum mem_stats_kind_e {
+      MEM_STATS_SIGNAL  = 0,
+      MEM_STATS_ARRAY   = 1,
+      MEM_STATS_COBJECT = 2,
+      MEM_STATS_DARRAY  = 3,
+      MEM_STATS_KINDS   = 4
+};
+
+/*
+ * Return the scope that a new allocation should be charged to. This
+ * is the scope of the running thread if a thread is executing, or
+ * otherwise the scope currently being compiled. Objects that give
+ * memory back at run time save this pointer so the destructor can
+ * subtract from the same account.
+ */
+extern struct __vpiScope* mem_stats_current_scope(void);
+
+/*
+ * Add (or with a negative delta, subtract) bytes to the account for
+ * the given scope and object kind.
+ */
+extern void mem_stats_add(struct __vpiScope*scope,
+			  mem_stats_kind_e kind, long bytes);
+
+/*
+ * Get the current total of all the accounts, over all scopes and
+ * kinds. This is the estimate of the design heap that is reported by
+ * the $ivl_stats_heap_kb system function.
+ */
+extern long mem_stats_total_bytes(void);
+
+/*
+ * Estimate the heap bytes held by the bit planes of a single
+ * vvp_vector4_t value of the given width. Narrow values are stored
+ * inside the object itself and cost nothing extra.
+ */
+extern size_t mem_stats_vec4_bytes(unsigned wid);
+
+/*
+ * Register the $ivl_memory_report system task. Called once from
+ * vvp_vpi_init() before the VPI modules are loaded.
+ */
+extern void mem_stats_register_systf(void);
+
+#endif
@@ -0,0 +1,3697 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison implementation for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* C LALR(1) parser skeleton written by Richard Stallman, by
+   simplifying the original so-called "semantic" parser.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+/* All symbols defined below should begin with yy or YY, to avoid
+   infringing on user name space.  This should be done even for local
+   variables, as they might otherwise be expanded by user macros.
+   There are some unavoidable exceptions within include files to
+   define necessary library symbols; they are noted "INFRINGES ON
+   USER NAME SPACE" below.  */
+
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
+
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
+
+/* Skeleton name.  */
+#define YYSKELETON_NAME "yacc.c"
+
+/* Pure parsers.  */
+#define YYPURE 0
+
+/* Push parsers.  */
+#define YYPUSH 0
+
+/* Pull parsers.  */
+#define YYPULL 1
+
+
+
+
+/* First part of user prologue.  */
+#line 2 "parse.y"
+
+/*
+ * Copyright (c) 2001-2012 Stephen Williams (steve@icarus.com)
+ *
+ *    This source code is free software; you can redistribute it
+ *    and/or modify it in source code form under the terms of the GNU
+ *    General Public License as published by the Free Software
+ *    Foundation; either version 2 of the License, or (at your option)
+ *    any later version.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this program; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+# include  "parse_misc.h"
+# include  "compile.h"
+# include  "delay.h"
+# include  <list>
+# include  <cstdio>
+# include  <cstdlib>
+# include  <cassert>
+# include  "ivl_alloc.h"
+
+/*
+ * These are bits in the lexor.
+ */
+extern FILE*yyin;
+
+vector <const char*> file_names;
+
+/*
+ * Local variables.
+ */
+
+/*
+ * When parsing a modpath list, this is the processed destination that
+ * the source items will attach themselves to.
+ */
+static struct __vpiModPath*modpath_dst = 0;
+
+#line 118 "parse.cc"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+#include "parse.hh"
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_K_A = 3,                        /* K_A  */
+  YYSYMBOL_K_ALIAS = 4,                    /* K_ALIAS  */
+  YYSYMBOL_K_ALIAS_R = 5,                  /* K_ALIAS_R  */
+  YYSYMBOL_K_APV = 6,                      /* K_APV  */
+  YYSYMBOL_K_ARITH_ABS = 7,                /* K_ARITH_ABS  */
+  YYSYMBOL_K_ARITH_DIV = 8,                /* K_ARITH_DIV  */
+  YYSYMBOL_K_ARITH_DIV_R = 9,              /* K_ARITH_DIV_R  */
+  YYSYMBOL_K_ARITH_DIV_S = 10,             /* K_ARITH_DIV_S  */
+  YYSYMBOL_K_ARITH_MOD = 11,               /* K_ARITH_MOD  */
+  YYSYMBOL_K_ARITH_MOD_R = 12,             /* K_ARITH_MOD_R  */
+  YYSYMBOL_K_ARITH_MOD_S = 13,             /* K_ARITH_MOD_S  */
+  YYSYMBOL_K_ARITH_MULT = 14,              /* K_ARITH_MULT  */
+  YYSYMBOL_K_ARITH_MULT_R = 15,            /* K_ARITH_MULT_R  */
+  YYSYMBOL_K_ARITH_SUB = 16,               /* K_ARITH_SUB  */
+  YYSYMBOL_K_ARITH_SUB_R = 17,             /* K_ARITH_SUB_R  */
+  YYSYMBOL_K_ARITH_SUM = 18,               /* K_ARITH_SUM  */
+  YYSYMBOL_K_ARITH_SUM_R = 19,             /* K_ARITH_SUM_R  */
+  YYSYMBOL_K_ARITH_POW = 20,               /* K_ARITH_POW  */
+  YYSYMBOL_K_ARITH_POW_R = 21,             /* K_ARITH_POW_R  */
+  YYSYMBOL_K_ARITH_POW_S = 22,             /* K_ARITH_POW_S  */
+  YYSYMBOL_K_ARRAY = 23,                   /* K_ARRAY  */
+  YYSYMBOL_K_ARRAY_2U = 24,                /* K_ARRAY_2U  */
+  YYSYMBOL_K_ARRAY_2S = 25,                /* K_ARRAY_2S  */
+  YYSYMBOL_K_ARRAY_I = 26,                 /* K_ARRAY_I  */
+  YYSYMBOL_K_ARRAY_R = 27,                 /* K_ARRAY_R  */
+  YYSYMBOL_K_ARRAY_S = 28,                 /* K_ARRAY_S  */
+  YYSYMBOL_K_ARRAY_STR = 29,               /* K_ARRAY_STR  */
+  YYSYMBOL_K_ARRAY_PORT = 30,              /* K_ARRAY_PORT  */
+  YYSYMBOL_K_CAST_INT = 31,                /* K_CAST_INT  */
+  YYSYMBOL_K_CAST_REAL = 32,               /* K_CAST_REAL  */
+  YYSYMBOL_K_CAST_REAL_S = 33,             /* K_CAST_REAL_S  */
+  YYSYMBOL_K_CAST_2 = 34,                  /* K_CAST_2  */
+  YYSYMBOL_K_CLASS = 35,                   /* K_CLASS  */
+  YYSYMBOL_K_CMP_EEQ = 36,                 /* K_CMP_EEQ  */
+  YYSYMBOL_K_CMP_EQ = 37,                  /* K_CMP_EQ  */
+  YYSYMBOL_K_CMP_EQ_R = 38,                /* K_CMP_EQ_R  */
+  YYSYMBOL_K_CMP_NEE = 39,                 /* K_CMP_NEE  */
+  YYSYMBOL_K_CMP_NE = 40,                  /* K_CMP_NE  */
+  YYSYMBOL_K_CMP_NE_R = 41,                /* K_CMP_NE_R  */
+  YYSYMBOL_K_CMP_GE = 42,                  /* K_CMP_GE  */
+  YYSYMBOL_K_CMP_GE_R = 43,                /* K_CMP_GE_R  */
+  YYSYMBOL_K_CMP_GE_S = 44,                /* K_CMP_GE_S  */
+  YYSYMBOL_K_CMP_GT = 45,                  /* K_CMP_GT  */
+  YYSYMBOL_K_CMP_GT_R = 46,                /* K_CMP_GT_R  */
+  YYSYMBOL_K_CMP_GT_S = 47,                /* K_CMP_GT_S  */
+  YYSYMBOL_K_CONCAT = 48,                  /* K_CONCAT  */
+  YYSYMBOL_K_CONCAT8 = 49,                 /* K_CONCAT8  */
+  YYSYMBOL_K_DEBUG = 50,                   /* K_DEBUG  */
+  YYSYMBOL_K_DELAY = 51,                   /* K_DELAY  */
+  YYSYMBOL_K_DFF = 52,                     /* K_DFF  */
+  YYSYMBOL_K_ENUM2 = 53,                   /* K_ENUM2  */
+  YYSYMBOL_K_ENUM2_S = 54,                 /* K_ENUM2_S  */
+  YYSYMBOL_K_ENUM4 = 55,                   /* K_ENUM4  */
+  YYSYMBOL_K_ENUM4_S = 56,                 /* K_ENUM4_S  */
+  YYSYMBOL_K_EVENT = 57,                   /* K_EVENT  */
+  YYSYMBOL_K_EVENT_OR = 58,                /* K_EVENT_OR  */
+  YYSYMBOL_K_EXPORT = 59,                  /* K_EXPORT  */
+  YYSYMBOL_K_EXTEND_S = 60,                /* K_EXTEND_S  */
+  YYSYMBOL_K_FUNCTOR = 61,                 /* K_FUNCTOR  */
+  YYSYMBOL_K_IMPORT = 62,                  /* K_IMPORT  */
+  YYSYMBOL_K_ISLAND = 63,                  /* K_ISLAND  */
+  YYSYMBOL_K_MODPATH = 64,                 /* K_MODPATH  */
+  YYSYMBOL_K_NET = 65,                     /* K_NET  */
+  YYSYMBOL_K_NET_S = 66,                   /* K_NET_S  */
+  YYSYMBOL_K_NET_R = 67,                   /* K_NET_R  */
+  YYSYMBOL_K_NET_2S = 68,                  /* K_NET_2S  */
+  YYSYMBOL_K_NET_2U = 69,                  /* K_NET_2U  */
+  YYSYMBOL_K_NET8 = 70,                    /* K_NET8  */
+  YYSYMBOL_K_NET8_2S = 71,                 /* K_NET8_2S  */
+  YYSYMBOL_K_NET8_2U = 72,                 /* K_NET8_2U  */
+  YYSYMBOL_K_NET8_S = 73,                  /* K_NET8_S  */
+  YYSYMBOL_K_PARAM_STR = 74,               /* K_PARAM_STR  */
+  YYSYMBOL_K_PARAM_L = 75,                 /* K_PARAM_L  */
+  YYSYMBOL_K_PARAM_REAL = 76,              /* K_PARAM_REAL  */
+  YYSYMBOL_K_PART = 77,                    /* K_PART  */
+  YYSYMBOL_K_PART_PV = 78,                 /* K_PART_PV  */
+  YYSYMBOL_K_PART_V = 79,                  /* K_PART_V  */
+  YYSYMBOL_K_PART_V_S = 80,                /* K_PART_V_S  */
+  YYSYMBOL_K_PORT = 81,                    /* K_PORT  */
+  YYSYMBOL_K_PORT_INFO = 82,               /* K_PORT_INFO  */
+  YYSYMBOL_K_PV = 83,                      /* K_PV  */
+  YYSYMBOL_K_REDUCE_AND = 84,              /* K_REDUCE_AND  */
+  YYSYMBOL_K_REDUCE_OR = 85,               /* K_REDUCE_OR  */
+  YYSYMBOL_K_REDUCE_XOR = 86,              /* K_REDUCE_XOR  */
+  YYSYMBOL_K_REDUCE_NAND = 87,             /* K_REDUCE_NAND  */
+  YYSYMBOL_K_REDUCE_NOR = 88,              /* K_REDUCE_NOR  */
+  YYSYMBOL_K_REDUCE_XNOR = 89,             /* K_REDUCE_XNOR  */
+  YYSYMBOL_K_REPEAT = 90,                  /* K_REPEAT  */
+  YYSYMBOL_K_RESOLV = 91,                  /* K_RESOLV  */
+  YYSYMBOL_K_SCOPE = 92,                   /* K_SCOPE  */
+  YYSYMBOL_K_SFUNC = 93,                   /* K_SFUNC  */
+  YYSYMBOL_K_SFUNC_E = 94,                 /* K_SFUNC_E  */
+  YYSYMBOL_K_SFUNC_M = 95,                 /* K_SFUNC_M  */
+  YYSYMBOL_K_SHIFTL = 96,                  /* K_SHIFTL  */
+  YYSYMBOL_K_SHIFTR = 97,                  /* K_SHIFTR  */
+  YYSYMBOL_K_SHIFTRS = 98,                 /* K_SHIFTRS  */
+  YYSYMBOL_K_THREAD = 99,                  /* K_THREAD  */
+  YYSYMBOL_K_TIMESCALE = 100,              /* K_TIMESCALE  */
+  YYSYMBOL_K_TRAN = 101,                   /* K_TRAN  */
+  YYSYMBOL_K_TRANIF0 = 102,                /* K_TRANIF0  */
+  YYSYMBOL_K_TRANIF1 = 103,                /* K_TRANIF1  */
+  YYSYMBOL_K_TRANVP = 104,                 /* K_TRANVP  */
+  YYSYMBOL_K_UFUNC = 105,                  /* K_UFUNC  */
+  YYSYMBOL_K_UFUNC_E = 106,                /* K_UFUNC_E  */
+  YYSYMBOL_K_UDP = 107,                    /* K_UDP  */
+  YYSYMBOL_K_UDP_C = 108,                  /* K_UDP_C  */
+  YYSYMBOL_K_UDP_S = 109,                  /* K_UDP_S  */
+  YYSYMBOL_K_VAR = 110,                    /* K_VAR  */
+  YYSYMBOL_K_VAR_COBJECT = 111,            /* K_VAR_COBJECT  */
+  YYSYMBOL_K_VAR_DARRAY = 112,             /* K_VAR_DARRAY  */
+  YYSYMBOL_K_VAR_S = 113,                  /* K_VAR_S  */
+  YYSYMBOL_K_VAR_STR = 114,                /* K_VAR_STR  */
+  YYSYMBOL_K_VAR_I = 115,                  /* K_VAR_I  */
+  YYSYMBOL_K_VAR_R = 116,                  /* K_VAR_R  */
+  YYSYMBOL_K_VAR_2S = 117,                 /* K_VAR_2S  */
+  YYSYMBOL_K_VAR_2U = 118,                 /* K_VAR_2U  */
+  YYSYMBOL_K_vpi_call = 119,               /* K_vpi_call  */
+  YYSYMBOL_K_vpi_call_w = 120,             /* K_vpi_call_w  */
+  YYSYMBOL_K_vpi_call_i = 121,             /* K_vpi_call_i  */
+  YYSYMBOL_K_vpi_func = 122,               /* K_vpi_func  */
+  YYSYMBOL_K_vpi_func_r = 123,             /* K_vpi_func_r  */
+  YYSYMBOL_K_disable = 124,                /* K_disable  */
+  YYSYMBOL_K_fork = 125,                   /* K_fork  */
+  YYSYMBOL_K_ivl_version = 126,            /* K_ivl_version  */
+  YYSYMBOL_K_ivl_delay_selection = 127,    /* K_ivl_delay_selection  */
+  YYSYMBOL_K_vpi_module = 128,             /* K_vpi_module  */
+  YYSYMBOL_K_vpi_time_precision = 129,     /* K_vpi_time_precision  */
+  YYSYMBOL_K_file_names = 130,             /* K_file_names  */
+  YYSYMBOL_K_file_line = 131,              /* K_file_line  */
+  YYSYMBOL_K_PORT_INPUT = 132,             /* K_PORT_INPUT  */
+  YYSYMBOL_K_PORT_OUTPUT = 133,            /* K_PORT_OUTPUT  */
+  YYSYMBOL_K_PORT_INOUT = 134,             /* K_PORT_INOUT  */
+  YYSYMBOL_K_PORT_MIXED = 135,             /* K_PORT_MIXED  */
+  YYSYMBOL_K_PORT_NODIR = 136,             /* K_PORT_NODIR  */
+  YYSYMBOL_T_INSTR = 137,                  /* T_INSTR  */
+  YYSYMBOL_T_LABEL = 138,                  /* T_LABEL  */
+  YYSYMBOL_T_NUMBER = 139,                 /* T_NUMBER  */
+  YYSYMBOL_T_STRING = 140,                 /* T_STRING  */
+  YYSYMBOL_T_SYMBOL = 141,                 /* T_SYMBOL  */
+  YYSYMBOL_T_VECTOR = 142,                 /* T_VECTOR  */
+  YYSYMBOL_143_ = 143,                     /* ';'  */
+  YYSYMBOL_144_ = 144,                     /* '+'  */
+  YYSYMBOL_145_ = 145,                     /* '-'  */
+  YYSYMBOL_146_ = 146,                     /* ','  */
+  YYSYMBOL_147_ = 147,                     /* '['  */
+  YYSYMBOL_148_ = 148,                     /* ']'  */
+  YYSYMBOL_149_ = 149,                     /* '('  */
+  YYSYMBOL_150_ = 150,                     /* ')'  */
+  YYSYMBOL_151_ = 151,                     /* '{'  */
+  YYSYMBOL_152_ = 152,                     /* '}'  */
+  YYSYMBOL_153_ = 153,                     /* ':'  */
+  YYSYMBOL_154_ = 154,                     /* '*'  */
+  YYSYMBOL_155_ = 155,                     /* '<'  */
+  YYSYMBOL_156_ = 156,                     /* '>'  */
+  YYSYMBOL_157_ = 157,                     /* '?'  */
+  YYSYMBOL_YYACCEPT = 158,                 /* $accept  */
+  YYSYMBOL_source_file = 159,              /* source_file  */
+  YYSYMBOL_header_lines_opt = 160,         /* header_lines_opt  */
+  YYSYMBOL_header_lines = 161,             /* header_lines  */
+  YYSYMBOL_header_line = 162,              /* header_line  */
+  YYSYMBOL_footer_lines = 163,             /* footer_lines  */
+  YYSYMBOL_164_1 = 164,                    /* $@1  */
+  YYSYMBOL_name_strings = 165,             /* name_strings  */
+  YYSYMBOL_program = 166,                  /* program  */
+  YYSYMBOL_statement = 167,                /* statement  */
+  YYSYMBOL_168_2 = 168,                    /* $@2  */
+  YYSYMBOL_169_3 = 169,                    /* $@3  */
+  YYSYMBOL_class_properties = 170,         /* class_properties  */
+  YYSYMBOL_class_property = 171,           /* class_property  */
+  YYSYMBOL_enum_type = 172,                /* enum_type  */
+  YYSYMBOL_enum_type_names = 173,          /* enum_type_names  */
+  YYSYMBOL_enum_type_name = 174,           /* enum_type_name  */
+  YYSYMBOL_local_flag = 175,               /* local_flag  */
+  YYSYMBOL_label_opt = 176,                /* label_opt  */
+  YYSYMBOL_operands_opt = 177,             /* operands_opt  */
+  YYSYMBOL_operands = 178,                 /* operands  */
+  YYSYMBOL_operand = 179,                  /* operand  */
+  YYSYMBOL_argument_opt = 180,             /* argument_opt  */
+  YYSYMBOL_argument_list = 181,            /* argument_list  */
+  YYSYMBOL_argument = 182,                 /* argument  */
+  YYSYMBOL_symbol_access = 183,            /* symbol_access  */
+  YYSYMBOL_symbols = 184,                  /* symbols  */
+  YYSYMBOL_numbers = 185,                  /* numbers  */
+  YYSYMBOL_symbols_net = 186,              /* symbols_net  */
+  YYSYMBOL_symbol = 187,                   /* symbol  */
+  YYSYMBOL_symbol_opt = 188,               /* symbol_opt  */
+  YYSYMBOL_modpath_src_list = 189,         /* modpath_src_list  */
+  YYSYMBOL_port_type = 190,                /* port_type  */
+  YYSYMBOL_modpath_src = 191,              /* modpath_src  */
+  YYSYMBOL_udp_table = 192,                /* udp_table  */
+  YYSYMBOL_signed_t_number = 193,          /* signed_t_number  */
+  YYSYMBOL_delay = 194                     /* delay  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
+
+
+
+#ifdef short
+# undef short
+#endif
+
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
+
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
+#else
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
+#endif
+
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
+#else
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
+#endif
+
+#ifndef YYSIZE_T
+# ifdef __SIZE_TYPE__
+#  define YYSIZE_T __SIZE_TYPE__
+# elif defined size_t
+#  define YYSIZE_T size_t
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYSIZE_T size_t
+# else
+#  define YYSIZE_T unsigned
+# endif
+#endif
+
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
+#endif
+
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
+
+# ifdef YYSTACK_USE_ALLOCA
+#  if YYSTACK_USE_ALLOCA
+#   ifdef __GNUC__
+#    define YYSTACK_ALLOC __builtin_alloca
+#   elif defined __BUILTIN_VA_ARG_INCR
+#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
+#   elif defined _AIX
+#    define YYSTACK_ALLOC __alloca
+#   elif defined _MSC_VER
+#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
+#    define alloca _alloca
+#   else
+#    define YYSTACK_ALLOC alloca
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
+#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
+#     endif
+#    endif
+#   endif
+#  endif
+# endif
+
+# ifdef YYSTACK_ALLOC
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+    /* The OS might guarantee only one guard page at the bottom of the stack,
+       and a page size can be as small as 4096 bytes.  So we cannot safely
+       invoke alloca (N) if N exceeds 4096.  Use a slightly smaller number
+       to allow for a few compiler-allocated temporary stack slots.  */
+#   define YYSTACK_ALLOC_MAXIMUM 4032 /* reasonable circa 2006 */
+#  endif
+# else
+#  define YYSTACK_ALLOC YYMALLOC
+#  define YYSTACK_FREE YYFREE
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+#   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
+#  endif
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
+       && ! ((defined YYMALLOC || defined malloc) \
+             && (defined YYFREE || defined free)))
+#   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
+#   endif
+#  endif
+#  ifndef YYMALLOC
+#   define YYMALLOC malloc
+#   if ! defined malloc && ! defined EXIT_SUCCESS
+void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+#  ifndef YYFREE
+#   define YYFREE free
+#   if ! defined free && ! defined EXIT_SUCCESS
+void free (void *); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+# endif
+#endif /* !defined yyoverflow */
+
+#if (! defined yyoverflow \
+     && (! defined __cplusplus \
+         || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+
+/* A type that is properly aligned for any stack member.  */
+union yyalloc
+{
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+};
+
+/* The size of the maximum gap between one aligned stack and the next.  */
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
+
+/* The size of an array large to enough to hold all stacks, each with
+   N elements.  */
+# define YYSTACK_BYTES(N) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
+      + YYSTACK_GAP_MAXIMUM)
+
+# define YYCOPY_NEEDED 1
+
+/* Relocate STACK from its old location to the new one.  The
+   local variables YYSIZE and YYSTACKSIZE give the old and new number of
+   elements in the stack, and YYPTR gives the new location of the
+   stack.  Advance YYPTR to a properly aligned location for the next
+   stack.  */
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
+
+#endif
+
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
+/* YYFINAL -- State number of the termination state.  */
+#define YYFINAL  14
+/* YYLAST -- Last index in YYTABLE.  */
+#define YYLAST   1166
+
+/* YYNTOKENS -- Number of terminals.  */
+#define YYNTOKENS  158
+/* YYNNTS -- Number of nonterminals.  */
+#define YYNNTS  37
+/* YYNRULES -- Number of rules.  */
+#define YYNRULES  239
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  1062
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   397
+
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_uint8 yytranslate[] =
+{
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+     149,   150,   154,   144,   146,   145,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,   153,   143,
+     155,     2,   156,   157,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,   147,     2,   148,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,   151,     2,   152,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
+      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
+      95,    96,    97,    98,    99,   100,   101,   102,   103,   104,
+     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
+     115,   116,   117,   118,   119,   120,   121,   122,   123,   124,
+     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
+     135,   136,   137,   138,   139,   140,   141,   142
+};
+
+#if YYDEBUG
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
+{
+       0,   132,   132,   134,   134,   138,   139,   143,   145,   147,
+     149,   151,   153,   158,   158,   163,   165,   171,   172,   187,
+     190,   203,   206,   209,   215,   218,   220,   223,   226,   229,
+     232,   235,   238,   241,   244,   251,   258,   268,   276,   279,
+     282,   284,   289,   293,   300,   305,   310,   315,   320,   328,
+     333,   338,   343,   348,   353,   358,   363,   368,   373,   378,
+     383,   388,   393,   398,   403,   408,   413,   418,   423,   428,
+     433,   438,   443,   448,   453,   458,   467,   469,   473,   480,
+     479,   486,   491,   494,   497,   500,   503,   506,   509,   514,
+     518,   522,   527,   532,   536,   542,   547,   553,   563,   566,
+     569,   572,   580,   583,   588,   591,   601,   608,   615,   620,
+     625,   633,   637,   655,   658,   664,   670,   673,   679,   684,
+     688,   690,   692,   694,   701,   704,   711,   714,   717,   720,
+     723,   726,   729,   732,   735,   741,   745,   749,   753,   757,
+     761,   765,   769,   773,   779,   783,   787,   791,   795,   801,
+     806,   814,   817,   820,   823,   828,   831,   834,   837,   840,
+     843,   846,   849,   855,   854,   859,   864,   868,   869,   873,
+     879,   881,   883,   885,   890,   895,   903,   905,   910,   911,
+     918,   919,   923,   924,   928,   937,   942,   950,   958,   983,
+     989,   996,  1002,  1007,  1013,  1021,  1023,  1027,  1032,  1034,
+    1036,  1038,  1040,  1042,  1044,  1046,  1048,  1050,  1056,  1062,
+    1071,  1077,  1086,  1092,  1104,  1111,  1114,  1124,  1125,  1129,
+    1130,  1131,  1132,  1133,  1137,  1139,  1141,  1143,  1145,  1147,
+    1149,  1151,  1153,  1158,  1160,  1165,  1166,  1170,  1172,  1174
+};
+#endif
+
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
+/* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+   First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
+static const char *const yytname[] =
+{
+  "\"end of file\"", "error", "\"invalid token\"", "K_A", "K_ALIAS",
+  "K_ALIAS_R", "K_APV", "K_ARITH_ABS", "K_ARITH_DIV", "K_ARITH_DIV_R",
+  "K_ARITH_DIV_S", "K_ARITH_MOD", "K_ARITH_MOD_R", "K_ARITH_MOD_S",
+  "K_ARITH_MULT", "K_ARITH_MULT_R", "K_ARITH_SUB", "K_ARITH_SUB_R",
+  "K_ARITH_SUM", "K_ARITH_SUM_R", "K_ARITH_POW", "K_ARITH_POW_R",
+  "K_ARITH_POW_S", "K_ARRAY", "K_ARRAY_2U", "K_ARRAY_2S", "K_ARRAY_I",
+  "K_ARRAY_R", "K_ARRAY_S", "K_ARRAY_STR", "K_ARRAY_PORT", "K_CAST_INT",
+  "K_CAST_REAL", "K_CAST_REAL_S", "K_CAST_2", "K_CLASS", "K_CMP_EEQ",
+  "K_CMP_EQ", "K_CMP_EQ_R", "K_CMP_NEE", "K_CMP_NE", "K_CMP_NE_R",
+  "K_CMP_GE", "K_CMP_GE_R", "K_CMP_GE_S", "K_CMP_GT", "K_CMP_GT_R",
+  "K_CMP_GT_S", "K_CONCAT", "K_CONCAT8", "K_DEBUG", "K_DELAY", "K_DFF",
+  "K_ENUM2", "K_ENUM2_S", "K_ENUM4", "K_ENUM4_S", "K_EVENT", "K_EVENT_OR",
+  "K_EXPORT", "K_EXTEND_S", "K_FUNCTOR", "K_IMPORT", "K_ISLAND",
+  "K_MODPATH", "K_NET", "K_NET_S", "K_NET_R", "K_NET_2S", "K_NET_2U",
+  "K_NET8", "K_NET8_2S", "K_NET8_2U", "K_NET8_S", "K_PARAM_STR",
+  "K_PARAM_L", "K_PARAM_REAL", "K_PART", "K_PART_PV", "K_PART_V",
+  "K_PART_V_S", "K_PORT", "K_PORT_INFO", "K_PV", "K_REDUCE_AND",
+  "K_REDUCE_OR", "K_REDUCE_XOR", "K_REDUCE_NAND", "K_REDUCE_NOR",
+  "K_REDUCE_XNOR", "K_REPEAT", "K_RESOLV", "K_SCOPE", "K_SFUNC",
+  "K_SFUNC_E", "K_SFUNC_M", "K_SHIFTL", "K_SHIFTR", "K_SHIFTRS",
+  "K_THREAD", "K_TIMESCALE", "K_TRAN", "K_TRANIF0", "K_TRANIF1",
+  "K_TRANVP", "K_UFUNC", "K_UFUNC_E", "K_UDP", "K_UDP_C", "K_UDP_S",
+  "K_VAR", "K_VAR_COBJECT", "K_VAR_DARRAY", "K_VAR_S", "K_VAR_STR",
+  "K_VAR_I", "K_VAR_R", "K_VAR_2S", "K_VAR_2U", "K_vpi_call",
+  "K_vpi_call_w", "K_vpi_call_i", "K_vpi_func", "K_vpi_func_r",
+  "K_disable", "K_fork", "K_ivl_version", "K_ivl_delay_selection",
+  "K_vpi_module", "K_vpi_time_precision", "K_file_names", "K_file_line",
+  "K_PORT_INPUT", "K_PORT_OUTPUT", "K_PORT_INOUT", "K_PORT_MIXED",
+  "K_PORT_NODIR", "T_INSTR", "T_LABEL", "T_NUMBER", "T_STRING", "T_SYMBOL",
+  "T_VECTOR", "';'", "'+'", "'-'", "','", "'['", "']'", "'('", "')'",
+  "'{'", "'}'", "':'", "'*'", "'<'", "'>'", "'?'", "$accept",
+  "source_file", "header_lines_opt", "header_lines", "header_line",
+  "footer_lines", "$@1", "name_strings", "program", "statement", "$@2",
+  "$@3", "class_properties", "class_property", "enum_type",
+  "enum_type_names", "enum_type_name", "local_flag", "label_opt",
+  "operands_opt", "operands", "operand", "argument_opt", "argument_list",
+  "argument", "symbol_access", "symbols", "numbers", "symbols_net",
+  "symbol", "symbol_opt", "modpath_src_list", "port_type", "modpath_src",
+  "udp_table", "signed_t_number", "delay", YY_NULLPTR
+};
+
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
+#endif
+
+#define YYPACT_NINF (-939)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-1)
+
+#define yytable_value_is_error(Yyn) \
+  0
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int16 yypact[] =
+{
+      63,   -80,   -17,    -5,   243,    79,    18,    63,  -939,   -81,
+      14,    21,    67,    80,  -939,   148,     6,    54,   -38,   136,
+     152,   181,   171,   945,  -939,   -55,  -939,  -939,   -67,  -939,
+     202,  -939,  -939,  -939,   207,   289,   -20,   294,    23,   -37,
+     309,   306,   307,   312,   315,   314,   318,   319,   322,   323,
+     324,   325,   326,   327,   328,   329,   330,   331,   332,   333,
+     334,   335,   336,   337,   338,   339,   340,   341,   343,   344,
+     345,   348,   319,   319,   349,   350,   352,   353,   354,   355,
+     356,   357,   358,   359,   360,   361,   362,   363,   342,   364,
+     365,   319,   366,   367,   368,   369,   -42,   319,   371,   370,
+     372,   373,   392,   395,  -132,  -129,  -128,   351,   351,  -126,
+     351,   351,  -103,   396,   397,   398,   399,   400,   401,   402,
+     403,   319,   319,   319,   319,   319,   319,   406,   405,   407,
+     408,   410,   411,   412,   413,   414,   415,   418,   419,   423,
+     424,   351,   425,   426,   351,   427,   351,   428,   351,   351,
+    -939,   416,  -939,  -939,   430,   431,   433,   434,   435,   319,
+     319,   436,     1,  -939,  -939,  -939,  -939,  -939,  -939,  -939,
+    -939,   437,  -939,  -939,   438,   441,   439,   -36,   445,   446,
+     447,   450,   451,   452,  -939,    50,  -939,   393,   448,   449,
+     453,   454,   455,   456,   457,   458,   459,   460,   461,   462,
+     463,   464,   465,   466,   467,   468,   469,   470,   471,   472,
+     473,    51,    56,   474,   475,   477,   478,   479,   480,   481,
+     482,   483,   484,   485,   486,   488,   489,   497,   498,  -120,
+     492,   500,   501,   502,   504,   503,   505,   499,    57,   506,
+     507,   508,   509,   511,   319,   512,  -939,   510,   513,   516,
+     518,   519,   520,   521,   523,   528,   529,   530,   532,   533,
+     535,   536,   537,   526,   531,   534,   538,   539,   515,   540,
+     543,   544,   545,   546,   547,   548,   549,   542,   551,   557,
+     552,   553,   554,   555,   556,   558,   560,   561,   563,   565,
+     566,   570,   582,   586,   581,   588,   589,   587,   592,   593,
+     594,   595,   596,   597,   590,   598,  -939,  -939,   599,   600,
+    -939,  -939,   601,   602,  -939,   604,   605,   610,   541,   603,
+     609,   606,   607,   608,  -939,   319,   319,   319,   319,   319,
+     319,   319,   319,   319,   319,   319,   319,   319,   319,   319,
+     319,   -61,   -34,   -34,   -34,   -34,   -34,   -34,   -35,   319,
+    -939,  -939,   319,   612,   319,   319,   319,   319,   319,   319,
+     319,   319,   319,   319,   319,   319,   616,   617,   618,    58,
+     319,   319,   404,   442,   443,   496,   613,  -939,   319,  -939,
+    -939,   319,   -53,   619,  -939,   319,   615,   620,   621,   622,
+     623,   624,   625,   626,   627,   628,   629,   630,   631,   632,
+     640,   641,   642,   644,   645,   646,   647,   648,  -939,  -939,
+    -939,  -939,  -939,  -939,   651,   319,   652,   653,   654,   655,
+     319,   319,   319,   657,   659,   319,   663,   664,   639,  -939,
+    -939,   658,  -939,   660,   -34,   661,   662,  -939,   665,   669,
+     670,   671,   672,  -939,   319,   258,  -939,     1,  -939,  -939,
+    -939,  -939,   643,   673,   667,   668,   650,   -34,   -34,  -939,
+      62,    64,    66,    68,    70,    72,    74,    84,    85,    86,
+      90,    92,    94,    96,    98,  -939,   674,   676,   -34,   -34,
+     -34,   -34,   -34,   -34,   -34,   675,   677,   100,   102,   429,
+     104,   106,   108,   110,   112,   114,   116,   118,   120,   122,
+     124,   126,   680,   682,  -110,  -939,   308,   679,   678,   685,
+     685,   685,   685,   319,   128,   683,   319,   688,   686,   684,
+     -34,   -34,   -34,   -34,   -34,   -34,   -34,   -34,   -34,   -34,
+     -34,   -34,   -34,   -34,   689,   692,   693,   690,   694,   695,
+     696,   700,   698,   130,   -51,   699,   701,   702,   132,   138,
+     139,   703,   704,   140,   705,   706,   -34,   -34,   707,   -34,
+     -34,   -34,   713,   708,   708,   708,   709,   708,   714,   715,
+     716,  -939,  -939,  -939,   697,   719,   710,   -34,   -34,  -939,
+    -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,
+    -939,  -939,  -939,  -939,  -939,  -939,   145,   717,   718,   720,
+     722,   721,   725,  -939,  -939,  -939,  -939,  -939,  -939,  -939,
+    -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,
+     730,   731,   732,  -939,   729,  -939,   319,   150,   168,  -939,
+     169,   173,   174,   192,  -939,  -939,   196,   734,  -939,  -939,
+     -34,   -34,   -34,   -34,   -34,   -34,   -34,   -34,   -34,   -34,
+     -34,   -34,   -34,   -34,   728,   733,   737,   736,   738,   739,
+     741,  -939,   319,  -939,   745,  -939,   735,   746,   744,   747,
+    -939,  -939,  -939,   319,   748,  -939,   750,   749,   -34,   -34,
+     752,   751,   -34,   -34,   753,   755,     4,   527,   611,   614,
+     754,   757,  -939,  -939,  -939,   756,   762,   759,   760,   763,
+    -939,   -34,   -34,   -34,   -34,  -939,   -34,  -939,   758,   591,
+     687,   -14,  -939,   764,  -939,  -939,  -939,   685,  -939,  -939,
+    -939,  -939,  -939,   691,   319,   765,   766,   768,   769,   770,
+     771,   772,   773,   775,   776,   778,   779,   781,   782,   790,
+     199,   792,   788,   789,   791,   793,   794,   799,   796,   198,
+     795,   797,   200,   798,  -939,   208,   801,   802,   808,   852,
+    -939,   884,   885,  -939,   901,   321,   524,   583,  -939,  -939,
+    -939,   899,  -939,  -939,   803,   907,   908,   902,   910,  -939,
+    -939,   923,   319,   319,   -34,   -34,   -34,   -34,   -34,   444,
+      16,  -939,   919,   920,   928,  -939,   319,  -939,   922,   -11,
+     209,  -939,   319,   319,   319,   319,   319,   319,   319,   319,
+     319,   319,   319,   319,   319,   319,   926,   927,   930,   929,
+    -939,   934,  -939,  -939,  -939,   221,  -939,  -939,   319,   800,
+     319,   319,   319,  -939,   935,   750,  -939,  -939,  -939,  -939,
+    -939,  -939,   933,   936,   937,     8,   940,   941,   942,   943,
+     944,   946,   222,  -939,  -939,   223,   947,   948,   949,   950,
+     951,   955,  -939,  -939,   319,   319,   711,   953,   319,   743,
+     938,   958,  -939,   319,   227,   228,   229,   233,   234,   235,
+     239,   240,   249,   250,   270,   271,   275,   276,  -939,  -939,
+     956,  -939,   957,  -939,   959,   277,   281,   282,    12,   280,
+    -939,   287,   939,   960,   961,  -939,  -939,   924,   932,   952,
+     708,   962,  -939,  -939,   319,  -939,  -939,  -939,  -939,  -939,
+    -939,   963,   288,   298,  -939,  -939,   299,   958,   958,  -939,
+    -107,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,
+    -939,  -939,  -939,  -939,  -939,  -939,  -939,  -939,   964,  -939,
+    -939,   319,  -939,   319,   319,  -939,    13,   966,    -2,   965,
+     967,   968,   969,   970,  -939,   972,  -939,  -939,  -939,   -85,
+     -83,   976,   319,   -68,  -122,   300,   975,    38,  -133,   347,
+     440,   971,   -49,   973,   979,   977,  -939,  -939,  -939,   982,
+    -939,  -939,   319,   -65,   319,   -64,  -939,  -939,   319,   974,
+     980,   981,  -939,   984,   319,   985,  -939,  -939,  -939,   989,
+     990,   992,   993,   983,   994,   995,  -939,   319,   986,  -939,
+     319,   987,  -939,   319,   997,   996,  -939,   999,   742,   998,
+    1000,   991,  1001,  1002,  1003,  1004,  -939,   319,  -939,   319,
+    -939,  1005,  -939,  1006,  -939,  1011,  1012,  -939,  -939,  1007,
+    -939,  1009,  -939,  -939,  -939,  -939,  1008,  1010,  -939,  -939,
+    -939,  -939
+};
+
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_uint8 yydefact[] =
+{
+       4,     0,     0,     0,     0,     0,   181,     3,     5,     0,
+       0,     0,     0,     0,     1,     0,     0,     0,     0,     0,
+       0,     0,     0,   180,   166,   181,    17,   165,     0,     6,
+       0,     7,     9,    10,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   179,   179,   179,   179,   179,   179,
+     179,   179,   179,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   179,     0,     0,   179,     0,   179,     0,   179,   179,
+     103,     0,     2,    18,     0,     0,     0,     0,     0,     0,
+       0,     0,   183,     8,    11,    12,   219,   220,   221,   222,
+     223,     0,   118,   124,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   214,     0,   208,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   178,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   187,   188,     0,   182,
+     185,   186,     0,     0,   120,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    44,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      46,    47,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   100,     0,   101,
+     158,     0,     0,     0,   155,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    82,    83,
+      84,    85,    86,    87,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   134,
+     133,     0,   132,     0,     0,     0,     0,    13,     0,     0,
+       0,     0,     0,   111,     0,     0,   102,     0,   119,   125,
+     122,   121,     0,     0,     0,     0,     0,     0,     0,   209,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   235,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    77,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   190,   190,   190,     0,   190,     0,     0,
+       0,   184,   123,   159,     0,     0,     0,     0,     0,    49,
+      50,    51,    52,    53,    54,    55,    56,    60,    61,    62,
+      63,    57,    58,    59,    34,   236,     0,     0,     0,     0,
+       0,     0,     0,    33,    32,    45,    48,   163,    64,    66,
+      67,    65,    68,    69,    70,    71,    72,    73,    74,    75,
+       0,     0,     0,   237,     0,    76,     0,     0,     0,   174,
+       0,     0,     0,     0,    98,    89,     0,     0,   157,    79,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   156,     0,    37,     0,   116,     0,     0,     0,     0,
+      95,    96,    97,     0,     0,    23,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    14,     0,     0,     0,     0,
+       0,     0,   112,   105,   104,     0,     0,     0,     0,     0,
+      31,     0,     0,     0,     0,    28,     0,    30,     0,     0,
+       0,     0,    78,     0,   176,   177,   170,     0,   171,   172,
+     173,    99,    19,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   233,     0,     0,     0,     0,     0,
+     131,     0,     0,    15,     0,     0,     0,     0,   195,   193,
+     196,   189,   191,   197,     0,     0,     0,     0,     0,   160,
+     161,     0,   216,   216,     0,     0,     0,     0,     0,     0,
+       0,   168,     0,     0,     0,   238,     0,   175,     0,     0,
+       0,   217,   216,   216,   216,   216,   216,   216,   216,   216,
+     216,   216,   216,   216,   216,   216,     0,     0,     0,     0,
+      38,     0,    40,    41,    88,     0,   117,    93,     0,     0,
+       0,     0,     0,    22,     0,     0,   126,   127,   128,   129,
+     130,    16,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   215,   212,     0,     0,     0,     0,     0,
+       0,     0,   164,   167,     0,     0,     0,     0,     0,     0,
+       0,     0,    80,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   151,   152,
+       0,   154,     0,   113,     0,     0,     0,     0,     0,     0,
+     234,     0,     0,     0,     0,   194,   192,     0,     0,     0,
+     190,     0,   162,   149,   216,   150,    24,    25,    26,    27,
+      29,     0,     0,     0,   239,    81,     0,     0,     0,   210,
+       0,   218,   144,   135,   145,   136,   148,   143,   138,   137,
+     146,   139,   142,   140,   147,   141,   153,    39,     0,    90,
+      94,     0,    92,     0,     0,    21,     0,     0,     0,     0,
+       0,     0,     0,     0,   213,     0,    42,    43,    20,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   106,   107,   108,     0,
+     110,   169,     0,     0,     0,     0,   211,   224,     0,     0,
+       0,     0,    91,     0,     0,     0,   198,   200,   201,     0,
+       0,     0,     0,     0,     0,     0,   227,     0,     0,   230,
+       0,     0,   225,     0,     0,     0,    35,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   228,     0,   231,     0,
+     226,     0,   115,     0,   199,     0,     0,   202,   204,     0,
+     205,     0,   229,   232,   114,    36,     0,     0,   203,   109,
+     207,   206
+};
+
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int16 yypgoto[] =
+{
+    -939,  -939,  -939,  -939,  1079,  -939,  -939,  -939,  -939,   573,
+    -939,  -939,  -939,  -284,  -939,  -325,  -210,    19,  -939,  -939,
+    -939,    61,  -562,  -939,  -335,  -938,   -31,  -477,  -632,   -91,
+    -293,  -939,  -939,  -176,   -92,  -121,  -939
+};
+
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int16 yydefgoto[] =
+{
+       0,     5,     6,     7,     8,   152,   562,   685,    25,    26,
+     724,   708,   790,   791,    27,   628,   629,   247,    28,   308,
+     309,   310,   687,   771,   772,   773,   185,   930,   852,   186,
+     854,   800,   171,   801,   755,   478,   370
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int16 yytable[] =
+{
+     230,   765,   688,   689,   766,   691,  1005,   765,   235,   245,
+     766,   765,   248,   250,   766,   254,   765,  1000,   980,   766,
+     985,   184,   246,  1006,  1001,   246,   246,    15,   246,   368,
+     268,   269,   270,   271,   272,   273,   622,    16,   258,   971,
+     623,   211,   212,   972,    17,    18,    19,    20,    21,    22,
+     973,   246,   154,   155,   156,   157,   158,   159,   160,    30,
+       9,   971,    31,   971,   161,   992,   238,   994,   303,   304,
+     162,   311,   993,   184,   995,   151,   184,   184,   475,    14,
+     476,   767,   998,    23,   477,  1017,  1020,   767,    24,   664,
+    1010,   767,   665,   516,   517,   666,   767,  1011,   236,   237,
+      15,    39,   175,   316,   485,   475,   486,    40,   176,   317,
+      16,   477,   166,   167,   168,   169,   170,    17,    18,    19,
+      20,    21,    22,    10,   249,   251,   252,   253,   255,   256,
+     257,   259,   794,   869,   870,    11,   795,   982,   871,   983,
+     306,   307,   184,   984,   768,   769,   770,    37,   768,   905,
+     770,   855,   978,   385,   979,   789,    23,    32,   325,   862,
+     288,    24,   953,   291,    33,   293,   173,   295,   296,   174,
+     874,   875,   876,   877,   878,   879,   880,   881,   882,   883,
+     884,   885,   886,   887,   325,   630,   631,   632,  1004,     1,
+       2,     3,     4,   324,   350,    38,   325,   325,   369,   351,
+     379,   505,   325,   325,   506,   579,    34,   580,   325,   581,
+     325,   582,   325,   583,   325,   584,   325,   585,   325,    35,
+     325,   479,   480,   481,   482,   483,   484,   586,   587,   588,
+     325,   325,   325,   589,   459,   590,   325,   591,   325,   592,
+     325,   593,   325,   605,   325,   606,   325,   608,   325,   609,
+     325,   610,   325,   611,   325,   612,   325,   613,   325,   614,
+     325,   615,   325,   616,   325,   617,   325,   618,   325,   619,
+     325,   634,   325,   663,   325,   670,   325,    41,   325,   507,
+     508,   671,   672,   675,   325,   325,   325,    36,   700,   714,
+     515,   701,   715,    42,   519,   460,   461,   462,   463,   464,
+     465,   466,   467,   468,   469,   470,   471,   472,   473,   474,
+      44,   716,   718,   559,   717,   717,   719,   720,   487,   717,
+     717,   488,    43,   490,   491,   492,   493,   494,   495,   496,
+     497,   498,   499,   500,   501,   721,   577,   578,   325,   722,
+     817,   827,   325,   818,   828,   163,   325,   514,   962,   831,
+     164,   833,   872,   568,   834,   873,   311,   596,   597,   598,
+     599,   600,   601,   602,   893,   913,   915,   894,   914,   914,
+     932,   933,   934,   914,   914,   914,   935,   936,   937,   914,
+     914,   914,   938,   939,   543,   914,   914,    12,    13,   548,
+     549,   550,   940,   941,   553,   914,   914,   569,   570,   640,
+     641,   642,   643,   644,   645,   646,   647,   648,   649,   650,
+     651,   652,   653,   942,   943,   459,   914,   914,   944,   945,
+     949,   914,   914,   325,   950,   952,   325,   951,   325,   954,
+     955,   966,   165,   834,   325,   678,   679,   172,   681,   682,
+     683,   967,   968,  1002,   325,   325,   325,   624,   177,   184,
+     969,   970,   178,   179,   181,   182,   698,   699,   180,   183,
+     184,   187,   188,   189,   190,   191,   192,   193,   194,   195,
+     196,   197,   198,   199,   200,   201,   842,   202,   203,   204,
+     205,   206,   633,   207,   208,   636,   209,   210,   213,   227,
+     214,   215,   216,   217,   218,   219,   220,   221,   222,   223,
+     224,   225,   226,  1007,   229,   246,   863,   797,   571,   240,
+     906,   228,   239,   241,   242,   231,   232,   233,   234,   725,
+     726,   727,   728,   729,   730,   731,   732,   733,   734,   735,
+     736,   737,   738,   243,   244,   713,   260,   261,   262,   326,
+     263,   264,   265,   266,   267,   274,   275,   277,   276,   278,
+     279,   280,   281,   282,   509,   297,   283,   757,   758,   284,
+     285,   761,   762,   286,   287,   289,   290,   292,   294,   298,
+     299,   746,   300,   301,   302,   305,   312,   607,   315,   313,
+     784,   785,   786,   787,   314,   788,   318,   319,   320,   321,
+     322,   323,   510,   511,   327,   328,  1008,   861,   153,   329,
+     330,   331,   332,   333,   334,   335,   336,   337,   338,   339,
+     340,   341,   342,   343,   344,   345,   346,   347,   348,   349,
+     352,   964,   353,   354,   355,   356,   357,   358,   359,   360,
+     361,   362,   363,   799,   364,   365,   366,   367,   371,   372,
+     373,   374,   752,   375,   376,   378,   512,   382,   377,   380,
+     387,   386,   388,   381,   384,   383,   389,   390,   408,   391,
+     392,   393,   394,   856,   857,   858,   859,   860,   395,   396,
+     397,   398,   403,   399,   400,   401,   402,   404,   774,   843,
+     405,   417,   453,   409,   406,   407,   410,   411,   412,   413,
+     418,   853,   853,   414,   415,   416,   419,   931,   420,   421,
+     422,   423,   424,   428,   425,   867,   426,   427,   429,   430,
+     431,   853,   853,   853,   853,   853,   853,   853,   853,   853,
+     853,   853,   853,   853,   853,   432,   433,   434,   435,   436,
+     437,   438,   439,   440,   441,   442,   444,   445,   844,   792,
+     443,   448,   446,   901,   454,   449,   447,   450,   451,   452,
+     455,   489,   456,   457,   458,   502,   503,   504,     0,   513,
+     518,   520,   775,     0,     0,   776,   521,   522,   523,   524,
+     525,   526,   527,   528,   529,   530,   531,   532,   533,   534,
+     535,   536,   799,   537,   538,   556,   572,   539,   540,   541,
+     542,   576,   544,   545,   546,   547,   551,   895,   552,   897,
+     898,   899,   554,   555,   557,   563,   558,   560,   561,   564,
+     565,   566,   567,   574,   575,   595,   573,   594,   603,   620,
+     604,   621,   625,   853,   626,   627,   635,   637,   654,   638,
+     639,   655,   656,   922,   923,   793,   657,   926,   695,   798,
+     658,   659,   660,   661,   662,   667,   680,   668,   669,   673,
+     674,   676,   677,   684,   686,   690,   697,   692,   693,   694,
+     696,   924,   976,   702,   703,   705,   704,   706,   707,   709,
+     710,   711,   712,   723,   739,   742,   748,   743,   744,   740,
+     745,   997,   999,   741,   747,   750,   749,   751,   756,   753,
+     754,   759,   927,   777,   760,   764,   763,   789,  1044,   779,
+     781,  1016,  1018,  1019,  1021,   780,   782,  1022,   778,   783,
+     796,   802,   803,  1027,   804,   805,   806,   807,   808,   809,
+     975,   810,   811,   977,   812,   813,  1036,   814,   815,  1038,
+     816,   820,  1040,   819,   822,   821,   823,   824,   825,   826,
+     896,   829,   846,   830,   832,   836,  1052,   835,  1053,    45,
+      46,   837,    47,    48,    49,    50,    51,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
+      85,    86,    87,    88,    89,   838,    90,    91,    92,    93,
+      94,    95,    96,    97,    98,    99,   100,   101,   102,   103,
+     104,   105,   106,   107,   108,   109,   110,   111,   112,   113,
+     114,   115,   116,   117,   118,   119,   120,   839,   840,   121,
+     122,   123,   124,   125,   126,   127,   128,   129,   130,   131,
+     132,   133,   134,   135,   841,   845,   847,   848,   849,   850,
+     136,   137,   138,   139,   140,   141,   142,   143,   144,   145,
+     146,   147,   148,   149,   851,   864,   865,   866,   868,   888,
+     889,   890,   891,   892,   902,   900,   959,   903,   904,   907,
+     908,   909,   910,   911,   960,   956,    29,   928,   150,   912,
+     916,   917,   918,   919,   920,   921,   925,   929,   948,   946,
+     947,     0,     0,   974,   961,   981,   957,   958,   986,   965,
+     987,   988,   991,   990,   963,   996,  1003,  1009,  1013,  1012,
+     989,  1015,  1025,  1014,  1023,  1028,  1024,  1026,  1029,  1033,
+    1030,  1031,  1032,  1034,  1035,     0,  1037,  1039,  1041,  1042,
+    1043,  1049,     0,     0,  1045,     0,  1046,  1047,  1054,  1055,
+    1056,  1057,  1059,     0,     0,     0,  1051,  1048,     0,  1050,
+       0,     0,     0,  1058,  1060,     0,  1061
+};
+
+static const yytype_int16 yycheck[] =
+{
+      91,     3,   564,   565,     6,   567,   139,     3,    50,   141,
+       6,     3,   141,   141,     6,   141,     3,   139,   956,     6,
+     958,   141,   154,   156,   146,   154,   154,    82,   154,   149,
+     121,   122,   123,   124,   125,   126,   146,    92,   141,   146,
+     150,    72,    73,   150,    99,   100,   101,   102,   103,   104,
+     157,   154,   119,   120,   121,   122,   123,   124,   125,   140,
+     140,   146,   143,   146,   131,   150,    97,   150,   159,   160,
+     137,   162,   157,   141,   157,   130,   141,   141,   139,     0,
+     141,    83,   150,   138,   145,   150,   150,    83,   143,   140,
+     139,    83,   143,   146,   147,   146,    83,   146,   140,   141,
+      82,   139,   139,   139,   139,   139,   141,   145,   145,   145,
+      92,   145,   132,   133,   134,   135,   136,    99,   100,   101,
+     102,   103,   104,   140,   105,   106,   107,   108,   109,   110,
+     111,   112,   146,   144,   145,   140,   150,   139,   149,   141,
+     139,   140,   141,   145,   140,   141,   142,   141,   140,   141,
+     142,   783,   139,   244,   141,   139,   138,   143,   146,   143,
+     141,   143,   150,   144,   143,   146,   143,   148,   149,   146,
+     802,   803,   804,   805,   806,   807,   808,   809,   810,   811,
+     812,   813,   814,   815,   146,   510,   511,   512,   150,   126,
+     127,   128,   129,   143,   143,   141,   146,   146,   229,   143,
+     143,   143,   146,   146,   146,   143,   139,   143,   146,   143,
+     146,   143,   146,   143,   146,   143,   146,   143,   146,   139,
+     146,   342,   343,   344,   345,   346,   347,   143,   143,   143,
+     146,   146,   146,   143,   325,   143,   146,   143,   146,   143,
+     146,   143,   146,   143,   146,   143,   146,   143,   146,   143,
+     146,   143,   146,   143,   146,   143,   146,   143,   146,   143,
+     146,   143,   146,   143,   146,   143,   146,   143,   146,   143,
+     146,   143,   146,   143,   146,   143,   146,   141,   146,   370,
+     371,   143,   143,   143,   146,   146,   146,   139,   143,   139,
+     381,   146,   142,   141,   385,   326,   327,   328,   329,   330,
+     331,   332,   333,   334,   335,   336,   337,   338,   339,   340,
+     139,   143,   143,   434,   146,   146,   143,   143,   349,   146,
+     146,   352,   141,   354,   355,   356,   357,   358,   359,   360,
+     361,   362,   363,   364,   365,   143,   457,   458,   146,   143,
+     141,   143,   146,   144,   146,   143,   146,   378,   910,   149,
+     143,   143,   143,   444,   146,   146,   447,   478,   479,   480,
+     481,   482,   483,   484,   143,   143,   143,   146,   146,   146,
+     143,   143,   143,   146,   146,   146,   143,   143,   143,   146,
+     146,   146,   143,   143,   415,   146,   146,   144,   145,   420,
+     421,   422,   143,   143,   425,   146,   146,   139,   140,   520,
+     521,   522,   523,   524,   525,   526,   527,   528,   529,   530,
+     531,   532,   533,   143,   143,   506,   146,   146,   143,   143,
+     143,   146,   146,   146,   143,   143,   146,   146,   146,   149,
+     143,   143,   143,   146,   146,   556,   557,   143,   559,   560,
+     561,   143,   143,   143,   146,   146,   146,   139,   139,   141,
+     927,   928,   146,   146,   139,   141,   577,   578,   146,   141,
+     141,   139,   139,   139,   139,   139,   139,   139,   139,   139,
+     139,   139,   139,   139,   139,   139,   155,   140,   140,   140,
+     140,   140,   513,   140,   140,   516,   141,   139,   139,   147,
+     140,   139,   139,   139,   139,   139,   139,   139,   139,   139,
+     139,   139,   139,   156,   139,   154,   790,   717,   447,   139,
+     845,   147,   141,   141,   141,   149,   149,   149,   149,   640,
+     641,   642,   643,   644,   645,   646,   647,   648,   649,   650,
+     651,   652,   653,   141,   139,   626,   140,   140,   140,   146,
+     141,   141,   141,   141,   141,   139,   141,   139,   141,   139,
+     139,   139,   139,   139,   150,   139,   141,   678,   679,   141,
+     141,   682,   683,   140,   140,   140,   140,   140,   140,   139,
+     139,   662,   139,   139,   139,   139,   139,   148,   139,   141,
+     701,   702,   703,   704,   143,   706,   141,   141,   141,   139,
+     139,   139,   150,   150,   146,   146,   156,   153,    25,   146,
+     146,   146,   146,   146,   146,   146,   146,   146,   146,   146,
+     146,   146,   146,   146,   146,   146,   146,   146,   146,   146,
+     146,   914,   147,   146,   146,   146,   146,   146,   146,   146,
+     146,   146,   146,   724,   146,   146,   139,   139,   146,   139,
+     139,   139,   673,   139,   141,   146,   150,   139,   143,   143,
+     140,   139,   139,   146,   143,   146,   140,   139,   143,   140,
+     140,   140,   139,   784,   785,   786,   787,   788,   140,   140,
+     140,   139,   146,   140,   139,   139,   139,   146,   151,   155,
+     146,   139,   141,   143,   146,   146,   143,   143,   143,   143,
+     139,   782,   783,   146,   146,   146,   139,   873,   146,   146,
+     146,   146,   146,   140,   146,   796,   146,   146,   143,   143,
+     140,   802,   803,   804,   805,   806,   807,   808,   809,   810,
+     811,   812,   813,   814,   815,   143,   140,   146,   140,   140,
+     143,   139,   139,   139,   139,   139,   146,   139,   155,   148,
+     143,   140,   143,   835,   141,   143,   146,   143,   143,   139,
+     141,   139,   146,   146,   146,   139,   139,   139,    -1,   146,
+     141,   146,   151,    -1,    -1,   151,   146,   146,   146,   146,
+     146,   146,   146,   146,   146,   146,   146,   146,   146,   139,
+     139,   139,   873,   139,   139,   146,   143,   141,   141,   141,
+     139,   141,   140,   140,   140,   140,   139,   828,   139,   830,
+     831,   832,   139,   139,   146,   140,   146,   146,   146,   140,
+     140,   140,   140,   146,   146,   139,   143,   143,   143,   139,
+     143,   139,   143,   914,   146,   140,   143,   139,   139,   143,
+     146,   139,   139,   864,   865,   148,   146,   868,   141,   148,
+     146,   146,   146,   143,   146,   146,   139,   146,   146,   146,
+     146,   146,   146,   140,   146,   146,   146,   143,   143,   143,
+     141,   150,   953,   146,   146,   143,   146,   146,   143,   139,
+     139,   139,   143,   139,   146,   139,   141,   139,   139,   146,
+     139,   972,   973,   146,   139,   141,   140,   140,   139,   141,
+     140,   139,   149,   139,   143,   140,   143,   139,   156,   143,
+     141,   992,   993,   994,   995,   143,   146,   998,   151,   146,
+     146,   146,   146,  1004,   146,   146,   146,   146,   146,   146,
+     951,   146,   146,   954,   146,   146,  1017,   146,   146,  1020,
+     140,   143,  1023,   141,   143,   146,   143,   143,   139,   143,
+     140,   146,   139,   146,   146,   143,  1037,   146,  1039,     4,
+       5,   143,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,   143,    51,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,    79,    80,    81,   143,   143,    84,
+      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
+      95,    96,    97,    98,   143,   146,   139,   139,   146,   139,
+     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
+     115,   116,   117,   118,   141,   146,   146,   139,   146,   143,
+     143,   141,   143,   139,   141,   140,   152,   141,   141,   139,
+     139,   139,   139,   139,   152,   146,     7,   149,   143,   143,
+     143,   143,   143,   143,   143,   140,   143,   139,   139,   143,
+     143,    -1,    -1,   139,   152,   139,   146,   146,   143,   146,
+     143,   143,   140,   143,   152,   139,   141,   146,   139,   146,
+     151,   139,   141,   146,   150,   140,   146,   143,   139,   146,
+     140,   139,   139,   139,   139,    -1,   150,   150,   141,   143,
+     141,   139,    -1,    -1,   146,    -1,   146,   156,   143,   143,
+     139,   139,   143,    -1,    -1,    -1,   152,   156,    -1,   156,
+      -1,    -1,    -1,   156,   156,    -1,   156
+};
+
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_uint8 yystos[] =
+{
+       0,   126,   127,   128,   129,   159,   160,   161,   162,   140,
+     140,   140,   144,   145,     0,    82,    92,    99,   100,   101,
+     102,   103,   104,   138,   143,   166,   167,   172,   176,   162,
+     140,   143,   143,   143,   139,   139,   139,   141,   141,   139,
+     145,   141,   141,   141,   139,     4,     5,     7,     8,     9,
+      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
+      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
+      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
+      40,    41,    42,    43,    44,    45,    46,    47,    48,    49,
+      51,    52,    53,    54,    55,    56,    57,    58,    59,    60,
+      61,    62,    63,    64,    65,    66,    67,    68,    69,    70,
+      71,    72,    73,    74,    75,    76,    77,    78,    79,    80,
+      81,    84,    85,    86,    87,    88,    89,    90,    91,    92,
+      93,    94,    95,    96,    97,    98,   105,   106,   107,   108,
+     109,   110,   111,   112,   113,   114,   115,   116,   117,   118,
+     143,   130,   163,   167,   119,   120,   121,   122,   123,   124,
+     125,   131,   137,   143,   143,   143,   132,   133,   134,   135,
+     136,   190,   143,   143,   146,   139,   145,   139,   146,   146,
+     146,   139,   141,   141,   141,   184,   187,   139,   139,   139,
+     139,   139,   139,   139,   139,   139,   139,   139,   139,   139,
+     139,   139,   140,   140,   140,   140,   140,   140,   140,   141,
+     139,   184,   184,   139,   140,   139,   139,   139,   139,   139,
+     139,   139,   139,   139,   139,   139,   139,   147,   147,   139,
+     187,   149,   149,   149,   149,    50,   140,   141,   184,   141,
+     139,   141,   141,   141,   139,   141,   154,   175,   141,   175,
+     141,   175,   175,   175,   141,   175,   175,   175,   141,   175,
+     140,   140,   140,   141,   141,   141,   141,   141,   187,   187,
+     187,   187,   187,   187,   139,   141,   141,   139,   139,   139,
+     139,   139,   139,   141,   141,   141,   140,   140,   175,   140,
+     140,   175,   140,   175,   140,   175,   175,   139,   139,   139,
+     139,   139,   139,   187,   187,   139,   139,   140,   177,   178,
+     179,   187,   139,   141,   143,   139,   139,   145,   141,   141,
+     141,   139,   139,   139,   143,   146,   146,   146,   146,   146,
+     146,   146,   146,   146,   146,   146,   146,   146,   146,   146,
+     146,   146,   146,   146,   146,   146,   146,   146,   146,   146,
+     143,   143,   146,   147,   146,   146,   146,   146,   146,   146,
+     146,   146,   146,   146,   146,   146,   139,   139,   149,   184,
+     194,   146,   139,   139,   139,   139,   141,   143,   146,   143,
+     143,   146,   139,   146,   143,   187,   139,   140,   139,   140,
+     139,   140,   140,   140,   139,   140,   140,   140,   139,   140,
+     139,   139,   139,   146,   146,   146,   146,   146,   143,   143,
+     143,   143,   143,   143,   146,   146,   146,   139,   139,   139,
+     146,   146,   146,   146,   146,   146,   146,   146,   140,   143,
+     143,   140,   143,   140,   146,   140,   140,   143,   139,   139,
+     139,   139,   139,   143,   146,   139,   143,   146,   140,   143,
+     143,   143,   139,   141,   141,   141,   146,   146,   146,   187,
+     184,   184,   184,   184,   184,   184,   184,   184,   184,   184,
+     184,   184,   184,   184,   184,   139,   141,   145,   193,   193,
+     193,   193,   193,   193,   193,   139,   141,   184,   184,   139,
+     184,   184,   184,   184,   184,   184,   184,   184,   184,   184,
+     184,   184,   139,   139,   139,   143,   146,   187,   187,   150,
+     150,   150,   150,   146,   184,   187,   146,   147,   141,   187,
+     146,   146,   146,   146,   146,   146,   146,   146,   146,   146,
+     146,   146,   146,   146,   139,   139,   139,   139,   139,   141,
+     141,   141,   139,   184,   140,   140,   140,   140,   184,   184,
+     184,   139,   139,   184,   139,   139,   146,   146,   146,   193,
+     146,   146,   164,   140,   140,   140,   140,   140,   187,   139,
+     140,   179,   143,   143,   146,   146,   141,   193,   193,   143,
+     143,   143,   143,   143,   143,   143,   143,   143,   143,   143,
+     143,   143,   143,   143,   143,   139,   193,   193,   193,   193,
+     193,   193,   193,   143,   143,   143,   143,   148,   143,   143,
+     143,   143,   143,   143,   143,   143,   143,   143,   143,   143,
+     139,   139,   146,   150,   139,   143,   146,   140,   173,   174,
+     173,   173,   173,   184,   143,   143,   184,   139,   143,   146,
+     193,   193,   193,   193,   193,   193,   193,   193,   193,   193,
+     193,   193,   193,   193,   139,   139,   139,   146,   146,   146,
+     146,   143,   146,   143,   140,   143,   146,   146,   146,   146,
+     143,   143,   143,   146,   146,   143,   146,   146,   193,   193,
+     139,   193,   193,   193,   140,   165,   146,   180,   180,   180,
+     146,   180,   143,   143,   143,   141,   141,   146,   193,   193,
+     143,   146,   146,   146,   146,   143,   146,   143,   169,   139,
+     139,   139,   143,   187,   139,   142,   143,   146,   143,   143,
+     143,   143,   143,   139,   168,   193,   193,   193,   193,   193,
+     193,   193,   193,   193,   193,   193,   193,   193,   193,   146,
+     146,   146,   139,   139,   139,   139,   187,   139,   141,   140,
+     141,   140,   184,   141,   140,   192,   139,   193,   193,   139,
+     143,   193,   193,   143,   140,     3,     6,    83,   140,   141,
+     142,   181,   182,   183,   151,   151,   151,   139,   151,   143,
+     143,   141,   146,   146,   193,   193,   193,   193,   193,   139,
+     170,   171,   148,   148,   146,   150,   146,   174,   148,   187,
+     189,   191,   146,   146,   146,   146,   146,   146,   146,   146,
+     146,   146,   146,   146,   146,   146,   140,   141,   144,   141,
+     143,   146,   143,   143,   143,   139,   143,   143,   146,   146,
+     146,   149,   146,   143,   146,   146,   143,   143,   143,   143,
+     143,   143,   155,   155,   155,   146,   139,   139,   139,   146,
+     139,   141,   186,   187,   188,   186,   193,   193,   193,   193,
+     193,   153,   143,   171,   146,   146,   139,   187,   146,   144,
+     145,   149,   143,   146,   186,   186,   186,   186,   186,   186,
+     186,   186,   186,   186,   186,   186,   186,   186,   143,   143,
+     141,   143,   139,   143,   146,   184,   140,   184,   184,   184,
+     140,   192,   141,   141,   141,   141,   182,   139,   139,   139,
+     139,   139,   143,   143,   146,   143,   143,   143,   143,   143,
+     143,   140,   184,   184,   150,   143,   184,   149,   149,   139,
+     185,   191,   143,   143,   143,   143,   143,   143,   143,   143,
+     143,   143,   143,   143,   143,   143,   143,   143,   139,   143,
+     143,   146,   143,   150,   149,   143,   146,   146,   146,   152,
+     152,   152,   180,   152,   188,   146,   143,   143,   143,   185,
+     185,   146,   150,   157,   139,   184,   187,   184,   139,   141,
+     183,   139,   139,   141,   145,   183,   143,   143,   143,   151,
+     143,   140,   150,   157,   150,   157,   139,   187,   150,   187,
+     139,   146,   143,   141,   150,   139,   156,   156,   156,   146,
+     139,   146,   146,   139,   146,   139,   187,   150,   187,   187,
+     150,   187,   187,   150,   146,   141,   143,   187,   140,   139,
+     140,   139,   139,   146,   139,   139,   187,   150,   187,   150,
+     187,   141,   143,   141,   156,   146,   146,   156,   156,   139,
+     156,   152,   187,   187,   143,   143,   139,   139,   156,   143,
+     156,   156
+};
+
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_uint8 yyr1[] =
+{
+       0,   158,   159,   160,   160,   161,   161,   162,   162,   162,
+     162,   162,   162,   164,   163,   165,   165,   166,   166,   167,
+     167,   167,   167,   167,   167,   167,   167,   167,   167,   167,
+     167,   167,   167,   167,   167,   167,   167,   167,   167,   167,
+     167,   167,   167,   167,   167,   167,   167,   167,   167,   167,
+     167,   167,   167,   167,   167,   167,   167,   167,   167,   167,
+     167,   167,   167,   167,   167,   167,   167,   167,   167,   167,
+     167,   167,   167,   167,   167,   167,   167,   167,   167,   168,
+     167,   167,   167,   167,   167,   167,   167,   167,   167,   167,
+     167,   167,   167,   167,   167,   167,   167,   167,   167,   167,
+     167,   167,   167,   167,   167,   167,   167,   167,   167,   167,
+     167,   167,   167,   167,   167,   167,   167,   167,   167,   167,
+     167,   167,   167,   167,   167,   167,   167,   167,   167,   167,
+     167,   167,   167,   167,   167,   167,   167,   167,   167,   167,
+     167,   167,   167,   167,   167,   167,   167,   167,   167,   167,
+     167,   167,   167,   167,   167,   167,   167,   167,   167,   167,
+     167,   167,   167,   169,   167,   167,   167,   170,   170,   171,
+     172,   172,   172,   172,   173,   173,   174,   174,   175,   175,
+     176,   176,   177,   177,   178,   178,   179,   179,   179,   180,
+     180,   181,   181,   181,   181,   182,   182,   182,   183,   183,
+     183,   183,   183,   183,   183,   183,   183,   183,   184,   184,
+     185,   185,   186,   186,   187,   188,   188,   189,   189,   190,
+     190,   190,   190,   190,   191,   191,   191,   191,   191,   191,
+     191,   191,   191,   192,   192,   193,   193,   194,   194,   194
+};
+
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     3,     1,     0,     1,     2,     3,     4,     3,
+       3,     4,     4,     0,     5,     2,     3,     1,     2,     7,
+      11,    10,     8,     6,    10,    10,    10,    10,     7,    10,
+       7,     7,     6,     6,     6,    13,    15,     6,     8,    10,
+       8,     8,    11,    11,     4,     6,     4,     4,     6,     6,
+       6,     6,     6,     6,     6,     6,     6,     6,     6,     6,
+       6,     6,     6,     6,     6,     6,     6,     6,     6,     6,
+       6,     6,     6,     6,     6,     6,     6,     5,     7,     0,
+       9,    10,     4,     4,     4,     4,     4,     4,     8,     6,
+      10,    12,    10,     8,    10,     6,     6,     6,     6,     7,
+       4,     4,     4,     2,     6,     6,    11,    11,    11,    15,
+      11,     4,     6,     9,    15,    14,     6,     8,     3,     5,
+       4,     5,     5,     6,     3,     5,     8,     8,     8,     8,
+       8,     7,     4,     4,     4,    10,    10,    10,    10,    10,
+      10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
+      10,     9,     9,    10,     9,     4,     6,     6,     4,     6,
+       8,     8,    10,     0,     9,     1,     1,     2,     1,     5,
+       7,     7,     7,     7,     1,     3,     2,     2,     1,     0,
+       1,     0,     1,     0,     3,     1,     1,     1,     1,     2,
+       0,     1,     3,     1,     3,     1,     1,     1,     6,     8,
+       6,     6,     8,     9,     8,     8,    10,    10,     1,     3,
+       1,     3,     1,     3,     1,     1,     0,     1,     3,     1,
+       1,     1,     1,     1,     5,     6,     7,     6,     7,     8,
+       6,     7,     8,     1,     3,     1,     2,     3,     5,     7
+};
+
+
+enum { YYENOMEM = -2 };
+
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
+
+
+#define YYRECOVERING()  (!!yyerrstatus)
+
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
+
+
+/* Enable debugging if requested.  */
+#if YYDEBUG
+
+# ifndef YYFPRINTF
+#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYFPRINTF fprintf
+# endif
+
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
+static void
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
+
+static void
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
+
+  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  YYFPRINTF (yyo, ")");
+}
+
+/*------------------------------------------------------------------.
+| yy_stack_print -- Print the state stack from its BOTTOM up to its |
+| TOP (included).                                                   |
+`------------------------------------------------------------------*/
+
+static void
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
+{
+  YYFPRINTF (stderr, "Stack now");
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
+  YYFPRINTF (stderr, "\n");
+}
+
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
+
+
+/*------------------------------------------------.
+| Report that the YYRULE is going to be reduced.  |
+`------------------------------------------------*/
+
+static void
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule)
+{
+  int yylno = yyrline[yyrule];
+  int yynrhs = yyr2[yyrule];
+  int yyi;
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
+  /* The symbols being reduced.  */
+  for (yyi = 0; yyi < yynrhs; yyi++)
+    {
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)]);
+      YYFPRINTF (stderr, "\n");
+    }
+}
+
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule); \
+} while (0)
+
+/* Nonzero means print parse trace.  It is left uninitialized so that
+   multiple parsers can coexist.  */
+int yydebug;
+#else /* !YYDEBUG */
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
+# define YY_STACK_PRINT(Bottom, Top)
+# define YY_REDUCE_PRINT(Rule)
+#endif /* !YYDEBUG */
+
+
+/* YYINITDEPTH -- initial size of the parser's stacks.  */
+#ifndef YYINITDEPTH
+# define YYINITDEPTH 200
+#endif
+
+/* YYMAXDEPTH -- maximum size the stacks can grow to (effective only
+   if the built-in stack extension method is used).
+
+   Do not make this value too large; the results are undefined if
+   YYSTACK_ALLOC_MAXIMUM < YYSTACK_BYTES (YYMAXDEPTH)
+   evaluated with infinite-precision integer arithmetic.  */
+
+#ifndef YYMAXDEPTH
+# define YYMAXDEPTH 10000
+#endif
+
+
+
+
+
+
+/*-----------------------------------------------.
+| Release the memory associated to this symbol.  |
+`-----------------------------------------------*/
+
+static void
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
+{
+  YY_USE (yyvaluep);
+  if (!yymsg)
+    yymsg = "Deleting";
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/* Lookahead token kind.  */
+int yychar;
+
+/* The semantic value of the lookahead symbol.  */
+YYSTYPE yylval;
+/* Number of syntax errors so far.  */
+int yynerrs;
+
+
+
+
+/*----------.
+| yyparse.  |
+`----------*/
+
+int
+yyparse (void)
+{
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
+
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
+
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
+
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
+
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
+
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
+  /* The variables used to return semantic value and location from the
+     action routines.  */
+  YYSTYPE yyval;
+
+
+
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
+
+  /* The number of symbols on the RHS of the reduced rule.
+     Keep to zero when no symbol should be popped.  */
+  int yylen = 0;
+
+  YYDPRINTF ((stderr, "Starting parse\n"));
+
+  yychar = YYEMPTY; /* Cause a token to be read.  */
+
+  goto yysetstate;
+
+
+/*------------------------------------------------------------.
+| yynewstate -- push a new state, which is found in yystate.  |
+`------------------------------------------------------------*/
+yynewstate:
+  /* In all cases, when you get here, the value and location stacks
+     have just been pushed.  So pushing a state here evens the stacks.  */
+  yyssp++;
+
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
+
+  if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
+    {
+      /* Get the current used size of the three stacks, in elements.  */
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
+
+# if defined yyoverflow
+      {
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
+      }
+# else /* defined YYSTACK_RELOCATE */
+      /* Extend the stack our own way.  */
+      if (YYMAXDEPTH <= yystacksize)
+        YYNOMEM;
+      yystacksize *= 2;
+      if (YYMAXDEPTH < yystacksize)
+        yystacksize = YYMAXDEPTH;
+
+      {
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+#  undef YYSTACK_RELOCATE
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
+      }
+# endif
+
+      yyssp = yyss + yysize - 1;
+      yyvsp = yyvs + yysize - 1;
+
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
+
+      if (yyss + yystacksize - 1 <= yyssp)
+        YYABORT;
+    }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
+
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
+
+  goto yybackup;
+
+
+/*-----------.
+| yybackup.  |
+`-----------*/
+yybackup:
+  /* Do appropriate processing given the current state.  Read a
+     lookahead token if we need one and don't already have one.  */
+
+  /* First try to decide what to do without reference to lookahead token.  */
+  yyn = yypact[yystate];
+  if (yypact_value_is_default (yyn))
+    goto yydefault;
+
+  /* Not known => get a lookahead token if don't already have one.  */
+
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == YYEMPTY)
+    {
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex ();
+    }
+
+  if (yychar <= YYEOF)
+    {
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
+      YYDPRINTF ((stderr, "Now at end of input.\n"));
+    }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
+  else
+    {
+      yytoken = YYTRANSLATE (yychar);
+      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
+    }
+
+  /* If the proper action on seeing token YYTOKEN is to reduce or to
+     detect an error, take that action.  */
+  yyn += yytoken;
+  if (yyn < 0 || YYLAST < yyn || yycheck[yyn] != yytoken)
+    goto yydefault;
+  yyn = yytable[yyn];
+  if (yyn <= 0)
+    {
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
+      yyn = -yyn;
+      goto yyreduce;
+    }
+
+  /* Count tokens shifted since error; after three, turn off error
+     status.  */
+  if (yyerrstatus)
+    yyerrstatus--;
+
+  /* Shift the lookahead token.  */
+  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
+  yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
+  goto yynewstate;
+
+
+/*-----------------------------------------------------------.
+| yydefault -- do the default action for the current state.  |
+`-----------------------------------------------------------*/
+yydefault:
+  yyn = yydefact[yystate];
+  if (yyn == 0)
+    goto yyerrlab;
+  goto yyreduce;
+
+
+/*-----------------------------.
+| yyreduce -- do a reduction.  |
+`-----------------------------*/
+yyreduce:
+  /* yyn is the number of a rule to reduce with.  */
+  yylen = yyr2[yyn];
+
+  /* If YYLEN is nonzero, implement the default value of the action:
+     '$$ = $1'.
+
+     Otherwise, the following line sets YYVAL to garbage.
+     This behavior is undocumented and Bison
+     users should not rely upon it.  Assigning to YYVAL
+     unconditionally makes the parser a bit smaller, and it avoids a
+     GCC warning that YYVAL may be used uninitialized.  */
+  yyval = yyvsp[1-yylen];
+
+
+  YY_REDUCE_PRINT (yyn);
+  switch (yyn)
+    {
+  case 7: /* header_line: K_ivl_version T_STRING ';'  */
+#line 144 "parse.y"
+                { verify_version((yyvsp[-1].text), NULL); }
+#line 1961 "parse.cc"
+    break;
+
+  case 8: /* header_line: K_ivl_version T_STRING T_STRING ';'  */
+#line 146 "parse.y"
+                { verify_version((yyvsp[-2].text), (yyvsp[-1].text)); }
+#line 1967 "parse.cc"
+    break;
+
+  case 9: /* header_line: K_ivl_delay_selection T_STRING ';'  */
+#line 148 "parse.y"
+                { set_delay_selection((yyvsp[-1].text)); }
+#line 1973 "parse.cc"
+    break;
+
+  case 10: /* header_line: K_vpi_module T_STRING ';'  */
+#line 150 "parse.y"
+                { compile_load_vpi_module((yyvsp[-1].text)); }
+#line 1979 "parse.cc"
+    break;
+
+  case 11: /* header_line: K_vpi_time_precision '+' T_NUMBER ';'  */
+#line 152 "parse.y"
+                { compile_vpi_time_precision((yyvsp[-1].numb)); }
+#line 1985 "parse.cc"
+    break;
+
+  case 12: /* header_line: K_vpi_time_precision '-' T_NUMBER ';'  */
+#line 154 "parse.y"
+                { compile_vpi_time_precision(-(yyvsp[-1].numb)); }
+#line 1991 "parse.cc"
+    break;
+
+  case 13: /* $@1: %empty  */
+#line 158 "parse.y"
+                                    { file_names.reserve((yyvsp[-1].numb)); }
+#line 1997 "parse.cc"
+    break;
+
+  case 15: /* name_strings: T_STRING ';'  */
+#line 164 "parse.y"
+                { file_names.push_back((yyvsp[-1].text)); }
+#line 2003 "parse.cc"
+    break;
+
+  case 16: /* name_strings: name_strings T_STRING ';'  */
+#line 166 "parse.y"
+                { file_names.push_back((yyvsp[-1].text)); }
+#line 2009 "parse.cc"
+    break;
+
+  case 19: /* statement: T_LABEL K_FUNCTOR T_SYMBOL T_NUMBER ',' symbols ';'  */
+#line 188 "parse.y"
+                { compile_functor((yyvsp[-6].text), (yyvsp[-4].text), (yyvsp[-3].numb), 6, 6, (yyvsp[-1].symbv).cnt, (yyvsp[-1].symbv).vect); }
+#line 2015 "parse.cc"
+    break;
+
+  case 20: /* statement: T_LABEL K_FUNCTOR T_SYMBOL T_NUMBER '[' T_NUMBER T_NUMBER ']' ',' symbols ';'  */
+#line 192 "parse.y"
+                { unsigned str0 = (yyvsp[-5].numb);
+		  unsigned str1 = (yyvsp[-4].numb);
+		  compile_functor((yyvsp[-10].text), (yyvsp[-8].text), (yyvsp[-7].numb), str0, str1,
+				  (yyvsp[-1].symbv).cnt, (yyvsp[-1].symbv).vect);
+		}
+#line 2025 "parse.cc"
+    break;
+
+  case 21: /* statement: T_LABEL K_UDP_S T_STRING ',' T_NUMBER ',' T_NUMBER ',' udp_table ';'  */
+#line 204 "parse.y"
+                { compile_udp_def(1, (yyvsp[-9].text), (yyvsp[-7].text), (yyvsp[-5].numb), (yyvsp[-3].numb), (yyvsp[-1].table)); }
+#line 2031 "parse.cc"
+    break;
+
+  case 22: /* statement: T_LABEL K_UDP_C T_STRING ',' T_NUMBER ',' udp_table ';'  */
+#line 207 "parse.y"
+                { compile_udp_def(0, (yyvsp[-7].text), (yyvsp[-5].text), (yyvsp[-3].numb), 0, (yyvsp[-1].table)); }
+#line 2037 "parse.cc"
+    break;
+
+  case 23: /* statement: T_LABEL K_UDP T_SYMBOL ',' symbols ';'  */
+#line 210 "parse.y"
+                { compile_udp_functor((yyvsp[-5].text), (yyvsp[-3].text), (yyvsp[-1].symbv).cnt, (yyvsp[-1].symbv).vect); }
+#line 2043 "parse.cc"
+    break;
+
+  case 24: /* statement: T_LABEL K_ARRAY T_STRING ',' signed_t_number signed_t_number ',' signed_t_number signed_t_number ';'  */
+#line 216 "parse.y"
+                { compile_var_array((yyvsp[-9].text), (yyvsp[-7].text), (yyvsp[-5].numb), (yyvsp[-4].numb), (yyvsp[-2].numb), (yyvsp[-1].numb), 0); }
+#line 2049 "parse.cc"
+    break;
+
+  case 25: /* statement: T_LABEL K_ARRAY_2U T_STRING ',' signed_t_number signed_t_number ',' signed_t_number signed_t_number ';'  */
+#line 219 "parse.y"
+                { compile_var2_array((yyvsp[-9].text), (yyvsp[-7].text), (yyvsp[-5].numb), (yyvsp[-4].numb), (yyvsp[-2].numb), (yyvsp[-1].numb), false); }
+#line 2055 "parse.cc"
+    break;
+
+  case 26: /* statement: T_LABEL K_ARRAY_2S T_STRING ',' signed_t_number signed_t_number ',' signed_t_number signed_t_number ';'  */
+#line 221 "parse.y"
+                { compile_var2_array((yyvsp[-9].text), (yyvsp[-7].text), (yyvsp[-5].numb), (yyvsp[-4].numb), (yyvsp[-2].numb), (yyvsp[-1].numb), true); }
+#line 2061 "parse.cc"
+    break;
+
+  case 27: /* statement: T_LABEL K_ARRAY_I T_STRING ',' signed_t_number signed_t_number ',' signed_t_number signed_t_number ';'  */
+#line 224 "parse.y"
+                { compile_var_array((yyvsp[-9].text), (yyvsp[-7].text), (yyvsp[-5].numb), (yyvsp[-4].numb), (yyvsp[-2].numb), (yyvsp[-1].numb), 2); }
+#line 2067 "parse.cc"
+    break;
+
+  case 28: /* statement: T_LABEL K_ARRAY_R T_STRING ',' signed_t_number signed_t_number ';'  */
+#line 227 "parse.y"
+                { compile_real_array((yyvsp[-6].text), (yyvsp[-4].text), (yyvsp[-2].numb), (yyvsp[-1].numb)); }
+#line 2073 "parse.cc"
+    break;
+
+  case 29: /* statement: T_LABEL K_ARRAY_S T_STRING ',' signed_t_number signed_t_number ',' signed_t_number signed_t_number ';'  */
+#line 230 "parse.y"
+                { compile_var_array((yyvsp[-9].text), (yyvsp[-7].text), (yyvsp[-5].numb), (yyvsp[-4].numb), (yyvsp[-2].numb), (yyvsp[-1].numb), 1); }
+#line 2079 "parse.cc"
+    break;
+
+  case 30: /* statement: T_LABEL K_ARRAY_STR T_STRING ',' signed_t_number signed_t_number ';'  */
+#line 233 "parse.y"
+                { compile_string_array((yyvsp[-6].text), (yyvsp[-4].text), (yyvsp[-2].numb), (yyvsp[-1].numb)); }
+#line 2085 "parse.cc"
+    break;
+
+  case 31: /* statement: T_LABEL K_ARRAY T_STRING ',' signed_t_number signed_t_number ';'  */
+#line 236 "parse.y"
+                { compile_net_array((yyvsp[-6].text), (yyvsp[-4].text), (yyvsp[-2].numb), (yyvsp[-1].numb)); }
+#line 2091 "parse.cc"
+    break;
+
+  case 32: /* statement: T_LABEL K_ARRAY_PORT T_SYMBOL ',' T_SYMBOL ';'  */
+#line 239 "parse.y"
+                { compile_array_port((yyvsp[-5].text), (yyvsp[-3].text), (yyvsp[-1].text)); }
+#line 2097 "parse.cc"
+    break;
+
+  case 33: /* statement: T_LABEL K_ARRAY_PORT T_SYMBOL ',' T_NUMBER ';'  */
+#line 242 "parse.y"
+                { compile_array_port((yyvsp[-5].text), (yyvsp[-3].text), (yyvsp[-1].numb)); }
+#line 2103 "parse.cc"
+    break;
+
+  case 34: /* statement: T_LABEL K_ARRAY T_STRING ',' T_SYMBOL ';'  */
+#line 245 "parse.y"
+                { compile_array_alias((yyvsp[-5].text), (yyvsp[-3].text), (yyvsp[-1].text)); }
+#line 2109 "parse.cc"
+    break;
+
+  case 35: /* statement: T_LABEL K_UFUNC T_SYMBOL ',' T_NUMBER ',' symbols '(' symbols ')' symbol T_SYMBOL ';'  */
+#line 253 "parse.y"
+                { compile_ufunc((yyvsp[-12].text), (yyvsp[-10].text), (yyvsp[-8].numb),
+				(yyvsp[-6].symbv).cnt, (yyvsp[-6].symbv).vect,
+				(yyvsp[-4].symbv).cnt, (yyvsp[-4].symbv).vect,
+				(yyvsp[-2].symb), (yyvsp[-1].text), 0); }
+#line 2118 "parse.cc"
+    break;
+
+  case 36: /* statement: T_LABEL K_UFUNC_E T_SYMBOL ',' T_NUMBER ',' T_SYMBOL ',' symbols '(' symbols ')' symbol T_SYMBOL ';'  */
+#line 260 "parse.y"
+                { compile_ufunc((yyvsp[-14].text), (yyvsp[-12].text), (yyvsp[-10].numb),
+				(yyvsp[-6].symbv).cnt, (yyvsp[-6].symbv).vect,
+				(yyvsp[-4].symbv).cnt, (yyvsp[-4].symbv).vect,
+				(yyvsp[-2].symb), (yyvsp[-1].text), (yyvsp[-8].text)); }
+#line 2127 "parse.cc"
+    break;
+
+  case 37: /* statement: T_LABEL K_RESOLV T_SYMBOL ',' symbols ';'  */
+#line 269 "parse.y"
+                { struct symbv_s obj = (yyvsp[-1].symbv);
+		  compile_resolver((yyvsp[-5].text), (yyvsp[-3].text), obj.cnt, obj.vect);
+		}
+#line 2135 "parse.cc"
+    break;
+
+  case 38: /* statement: T_LABEL K_PART T_SYMBOL ',' T_NUMBER ',' T_NUMBER ';'  */
+#line 277 "parse.y"
+                { compile_part_select((yyvsp[-7].text), (yyvsp[-5].text), (yyvsp[-3].numb), (yyvsp[-1].numb)); }
+#line 2141 "parse.cc"
+    break;
+
+  case 39: /* statement: T_LABEL K_PART_PV T_SYMBOL ',' T_NUMBER ',' T_NUMBER ',' T_NUMBER ';'  */
+#line 280 "parse.y"
+                { compile_part_select_pv((yyvsp[-9].text), (yyvsp[-7].text), (yyvsp[-5].numb), (yyvsp[-3].numb), (yyvsp[-1].numb)); }
+#line 2147 "parse.cc"
+    break;
+
+  case 40: /* statement: T_LABEL K_PART_V T_SYMBOL ',' T_SYMBOL ',' T_NUMBER ';'  */
+#line 283 "parse.y"
+                { compile_part_select_var((yyvsp[-7].text), (yyvsp[-5].text), (yyvsp[-3].text), (yyvsp[-1].numb), false); }
+#line 2153 "parse.cc"
+    break;
+
+  case 41: /* statement: T_LABEL K_PART_V_S T_SYMBOL ',' T_SYMBOL ',' T_NUMBER ';'  */
+#line 285 "parse.y"
+                { compile_part_select_var((yyvsp[-7].text), (yyvsp[-5].text), (yyvsp[-3].text), (yyvsp[-1].numb), true); }
+#line 2159 "parse.cc"
+    break;
+
+  case 42: /* statement: T_LABEL K_CONCAT '[' T_NUMBER T_NUMBER T_NUMBER T_NUMBER ']' ',' symbols ';'  */
+#line 291 "parse.y"
+      { compile_concat((yyvsp[-10].text), (yyvsp[-7].numb), (yyvsp[-6].numb), (yyvsp[-5].numb), (yyvsp[-4].numb), (yyvsp[-1].symbv).cnt, (yyvsp[-1].symbv).vect); }
+#line 2165 "parse.cc"
+    break;
+
+  case 43: /* statement: T_LABEL K_CONCAT8 '[' T_NUMBER T_NUMBER T_NUMBER T_NUMBER ']' ',' symbols ';'  */
+#line 295 "parse.y"
+      { compile_concat8((yyvsp[-10].text), (yyvsp[-7].numb), (yyvsp[-6].numb), (yyvsp[-5].numb), (yyvsp[-4].numb), (yyvsp[-1].symbv).cnt, (yyvsp[-1].symbv).vect); }
+#line 2171 "parse.cc"
+    break;
+
+  case 44: /* statement: T_LABEL K_ARITH_ABS symbols ';'  */
+#line 301 "parse.y"
+                { struct symbv_s obj = (yyvsp[-1].symbv);
+		  compile_arith_abs((yyvsp[-3].text), obj.cnt, obj.vect);
+		}
+#line 2179 "parse.cc"
+    break;
+
+  case 45: /* statement: T_LABEL K_CAST_INT T_NUMBER ',' symbols ';'  */
+#line 306 "parse.y"
+      { struct symbv_s obj = (yyvsp[-1].symbv);
+	compile_arith_cast_int((yyvsp[-5].text), (yyvsp[-3].numb), obj.cnt, obj.vect);
+      }
+#line 2187 "parse.cc"
+    break;
+
+  case 46: /* statement: T_LABEL K_CAST_REAL symbols ';'  */
+#line 311 "parse.y"
+      { struct symbv_s obj = (yyvsp[-1].symbv);
+	compile_arith_cast_real((yyvsp[-3].text), false, obj.cnt, obj.vect);
+      }
+#line 2195 "parse.cc"
+    break;
+
+  case 47: /* statement: T_LABEL K_CAST_REAL_S symbols ';'  */
+#line 316 "parse.y"
+      { struct symbv_s obj = (yyvsp[-1].symbv);
+	compile_arith_cast_real((yyvsp[-3].text), true, obj.cnt, obj.vect);
+      }
+#line 2203 "parse.cc"
+    break;
+
+  case 48: /* statement: T_LABEL K_CAST_2 T_NUMBER ',' symbols ';'  */
+#line 321 "parse.y"
+      { struct symbv_s obj = (yyvsp[-1].symbv);
+	compile_arith_cast_vec2((yyvsp[-5].text), (yyvsp[-3].numb), obj.cnt, obj.vect);
+      }
+#line 2211 "parse.cc"
+    break;
+
+  case 49: /* statement: T_LABEL K_ARITH_DIV T_NUMBER ',' symbols ';'  */
+#line 329 "parse.y"
+                { struct symbv_s obj = (yyvsp[-1].symbv);
+		  compile_arith_div((yyvsp[-5].text), (yyvsp[-3].numb), false, obj.cnt, obj.vect);
+		}
+#line 2219 "parse.cc"
+    break;
+
+  case 50: /* statement: T_LABEL K_ARITH_DIV_R T_NUMBER ',' symbols ';'  */
+#line 334 "parse.y"
+                { struct symbv_s obj = (yyvsp[-1].symbv);
+		  compile_arith_div_r((yyvsp[-5].text), obj.cnt, obj.vect);
+		}
+#line 2227 "parse.cc"
+    break;
+
+  case 51: /* statement: T_LABEL K_ARITH_DIV_S T_NUMBER ',' symbols ';'  */
+#line 339 "parse.y"
+                { struct symbv_s obj = (yyvsp[-1].symbv);
+		  compile_arith_div((yyvsp[-5].text), (yyvsp[-3].numb), true, obj.cnt, obj.vect);
+		}
+#line 2235 "parse.cc"
+    break;
+
+  case 52: /* statement: T_LABEL K_ARITH_MOD T_NUMBER ',' symbols ';'  */
+#line 344 "parse.y"
+                { struct symbv_s obj = (yyvsp[-1].symbv);
+		  compile_arith_mod((yyvsp[-5].text), (yyvsp[-3].numb), false, obj.cnt, obj.vect);
+		}
+#line 2243 "parse.cc"
+    break;
+
+  case 53: /* statement: T_LABEL K_ARITH_MOD_R T_NUMBER ',' symbols ';'  */
+#line 349 "parse.y"
+                { struct symbv_s obj = (yyvsp[-1].symbv);
+		  compile_arith_mod_r((yyvsp[-5].text), obj.cnt, obj.vect);
+		}
+#line 2251 "parse.cc"
+    break;
+
+  case 54: /* statement: T_LABEL K_ARITH_MOD_S T_NUMBER ',' symbols ';'  */
+#line 354 "parse.y"
+                { struct symbv_s obj = (yyvsp[-1].symbv);
+		  compile_arith_mod((yyvsp[-5].text), (yyvsp[-3].numb), true, obj.cnt, obj.vect);
+		}
+#line 2259 "parse.cc"
+    break;
+
+  case 55: /* statement: T_LABEL K_ARITH_MULT T_NUMBER ',' symbols ';'  */
+#line 359 "parse.y"
+                { struct symbv_s obj = (yyvsp[-1].symbv);
+		  compile_arith_mult((yyvsp[-5].text), (yyvsp[-3].numb), obj.cnt, obj.vect);
+		}
+#line 2267 "parse.cc"
+    break;
+
+  case 56: /* statement: T_LABEL K_ARITH_MULT_R T_NUMBER ',' symbols ';'  */
+#line 364 "parse.y"
+                { struct symbv_s obj = (yyvsp[-1].symbv);
+		  compile_arith_mult_r((yyvsp[-5].text), obj.cnt, obj.vect);
+		}
+#line 2275 "parse.cc"
+    break;
+
+  case 57: /* statement: T_LABEL K_ARITH_POW T_NUMBER ',' symbols ';'  */
+#line 369 "parse.y"
+                { struct symbv_s obj = (yyvsp[-1].symbv);
+		  compile_arith_pow((yyvsp[-5].text), (yyvsp[-3].numb), false, obj.cnt, obj.vect);
+		}
+#line 2283 "parse.cc"
+    break;
+
+  case 58: /* statement: T_LABEL K_ARITH_POW_R T_NUMBER ',' symbols ';'  */
+#line 374 "parse.y"
+                { struct symbv_s obj = (yyvsp[-1].symbv);
+		  compile_arith_pow_r((yyvsp[-5].text), obj.cnt, obj.vect);
+		}
+#line 2291 "parse.cc"
+    break;
+
+  case 59: /* statement: T_LABEL K_ARITH_POW_S T_NUMBER ',' symbols ';'  */
+#line 379 "parse.y"
+                { struct symbv_s obj = (yyvsp[-1].symbv);
+		  compile_arith_pow((yyvsp[-5].text), (yyvsp[-3].numb), true, obj.cnt, obj.vect);
+		}
+#line 2299 "parse.cc"
+    break;
+
+  case 60: /* statement: T_LABEL K_ARITH_SUB T_NUMBER ',' symbols ';'  */
+#line 384 "parse.y"
+                { struct symbv_s obj = (yyvsp[-1].symbv);
+		  compile_arith_sub((yyvsp[-5].text), (yyvsp[-3].numb), obj.cnt, obj.vect);
+		}
+#line 2307 "parse.cc"
+    break;
+
+  case 61: /* statement: T_LABEL K_ARITH_SUB_R T_NUMBER ',' symbols ';'  */
+#line 389 "parse.y"
+                { struct symbv_s obj = (yyvsp[-1].symbv);
+		  compile_arith_sub_r((yyvsp[-5].text), obj.cnt, obj.vect);
+		}
+#line 2315 "parse.cc"
+    break;
+
+  case 62: /* statement: T_LABEL K_ARITH_SUM T_NUMBER ',' symbols ';'  */
+#line 394 "parse.y"
+                { struct symbv_s obj = (yyvsp[-1].symbv);
+		  compile_arith_sum((yyvsp[-5].text), (yyvsp[-3].numb), obj.cnt, obj.vect);
+		}
+#line 2323 "parse.cc"
+    break;
+
+  case 63: /* statement: T_LABEL K_ARITH_SUM_R T_NUMBER ',' symbols ';'  */
+#line 399 "parse.y"
+                { struct symbv_s obj = (yyvsp[-1].symbv);
+		  compile_arith_sum_r((yyvsp[-5].text), obj.cnt, obj.vect);
+		}
+#line 2331 "parse.cc"
+    break;
+
+  case 64: /* statement: T_LABEL K_CMP_EEQ T_NUMBER ',' symbols ';'  */
+#line 404 "parse.y"
+                { struct symbv_s obj = (yyvsp[-1].symbv);
+		  compile_cmp_eeq((yyvsp[-5].text), (yyvsp[-3].numb), obj.cnt, obj.vect);
+		}
+#line 2339 "parse.cc"
+    break;
+
+  case 65: /* statement: T_LABEL K_CMP_NEE T_NUMBER ',' symbols ';'  */
+#line 409 "parse.y"
+                { struct symbv_s obj = (yyvsp[-1].symbv);
+		  compile_cmp_nee((yyvsp[-5].text), (yyvsp[-3].numb), obj.cnt, obj.vect);
+		}
+#line 2347 "parse.cc"
+    break;
+
+  case 66: /* statement: T_LABEL K_CMP_EQ T_NUMBER ',' symbols ';'  */
+#line 414 "parse.y"
+                { struct symbv_s obj = (yyvsp[-1].symbv);
+		  compile_cmp_eq((yyvsp[-5].text), (yyvsp[-3].numb), obj.cnt, obj.vect);
+		}
+#line 2355 "parse.cc"
+    break;
+
+  case 67: /* statement: T_LABEL K_CMP_EQ_R T_NUMBER ',' symbols ';'  */
+#line 419 "parse.y"
+                { struct symbv_s obj = (yyvsp[-1].symbv);
+		  compile_cmp_eq_r((yyvsp[-5].text), obj.cnt, obj.vect);
+		}
+#line 2363 "parse.cc"
+    break;
+
+  case 68: /* statement: T_LABEL K_CMP_NE T_NUMBER ',' symbols ';'  */
+#line 424 "parse.y"
+                { struct symbv_s obj = (yyvsp[-1].symbv);
+		  compile_cmp_ne((yyvsp[-5].text), (yyvsp[-3].numb), obj.cnt, obj.vect);
+		}
+#line 2371 "parse.cc"
+    break;
+
+  case 69: /* statement: T_LABEL K_CMP_NE_R T_NUMBER ',' symbols ';'  */
+#line 429 "parse.y"
+                { struct symbv_s obj = (yyvsp[-1].symbv);
+		  compile_cmp_ne_r((yyvsp[-5].text), obj.cnt, obj.vect);
+		}
+#line 2379 "parse.cc"
+    break;
+
+  case 70: /* statement: T_LABEL K_CMP_GE T_NUMBER ',' symbols ';'  */
+#line 434 "parse.y"
+                { struct symbv_s obj = (yyvsp[-1].symbv);
+		  compile_cmp_ge((yyvsp[-5].text), (yyvsp[-3].numb), false, obj.cnt, obj.vect);
+		}
+#line 2387 "parse.cc"
+    break;
+
+  case 71: /* statement: T_LABEL K_CMP_GE_R T_NUMBER ',' symbols ';'  */
+#line 439 "parse.y"
+                { struct symbv_s obj = (yyvsp[-1].symbv);
+		  compile_cmp_ge_r((yyvsp[-5].text), obj.cnt, obj.vect);
+		}
+#line 2395 "parse.cc"
+    break;
+
+  case 72: /* statement: T_LABEL K_CMP_GE_S T_NUMBER ',' symbols ';'  */
+#line 444 "parse.y"
+                { struct symbv_s obj = (yyvsp[-1].symbv);
+		  compile_cmp_ge((yyvsp[-5].text), (yyvsp[-3].numb), true, obj.cnt, obj.vect);
+		}
+#line 2403 "parse.cc"
+    break;
+
+  case 73: /* statement: T_LABEL K_CMP_GT T_NUMBER ',' symbols ';'  */
+#line 449 "parse.y"
+                { struct symbv_s obj = (yyvsp[-1].symbv);
+		  compile_cmp_gt((yyvsp[-5].text), (yyvsp[-3].numb), false, obj.cnt, obj.vect);
+		}
+#line 2411 "parse.cc"
+    break;
+
+  case 74: /* statement: T_LABEL K_CMP_GT_R T_NUMBER ',' symbols ';'  */
+#line 454 "parse.y"
+                { struct symbv_s obj = (yyvsp[-1].symbv);
+		  compile_cmp_gt_r((yyvsp[-5].text), obj.cnt, obj.vect);
+		}
+#line 2419 "parse.cc"
+    break;
+
+  case 75: /* statement: T_LABEL K_CMP_GT_S T_NUMBER ',' symbols ';'  */
+#line 459 "parse.y"
+                { struct symbv_s obj = (yyvsp[-1].symbv);
+		  compile_cmp_gt((yyvsp[-5].text), (yyvsp[-3].numb), true, obj.cnt, obj.vect);
+		}
+#line 2427 "parse.cc"
+    break;
+
+  case 76: /* statement: T_LABEL K_DELAY T_NUMBER delay symbol ';'  */
+#line 468 "parse.y"
+    { compile_delay((yyvsp[-5].text), (yyvsp[-3].numb), (yyvsp[-2].cdelay), (yyvsp[-1].symb)); }
+#line 2433 "parse.cc"
+    break;
+
+  case 77: /* statement: T_LABEL K_DELAY T_NUMBER symbols ';'  */
+#line 470 "parse.y"
+    { struct symbv_s obj = (yyvsp[-1].symbv);
+      compile_delay((yyvsp[-4].text), (yyvsp[-2].numb), obj.cnt, obj.vect, false);
+    }
+#line 2441 "parse.cc"
+    break;
+
+  case 78: /* statement: T_LABEL K_DELAY T_NUMBER symbols ',' T_NUMBER ';'  */
+#line 474 "parse.y"
+    { struct symbv_s obj = (yyvsp[-3].symbv);
+      if ((yyvsp[-1].numb) != 0) assert(0);
+      compile_delay((yyvsp[-6].text), (yyvsp[-4].numb), obj.cnt, obj.vect, true);
+    }
+#line 2450 "parse.cc"
+    break;
+
+  case 79: /* $@2: %empty  */
+#line 480 "parse.y"
+    { modpath_dst = compile_modpath((yyvsp[-5].text), (yyvsp[-3].numb), (yyvsp[-2].symb), (yyvsp[-1].symb)); }
+#line 2456 "parse.cc"
+    break;
+
+  case 80: /* statement: T_LABEL K_MODPATH T_NUMBER symbol symbol ',' $@2 modpath_src_list ';'  */
+#line 482 "parse.y"
+    { modpath_dst = 0; }
+#line 2462 "parse.cc"
+    break;
+
+  case 81: /* statement: T_LABEL K_DFF symbol ',' symbol ',' symbol ',' symbol ';'  */
+#line 487 "parse.y"
+                { compile_dff((yyvsp[-9].text), (yyvsp[-7].symb), (yyvsp[-5].symb), (yyvsp[-3].symb), (yyvsp[-1].symb)); }
+#line 2468 "parse.cc"
+    break;
+
+  case 82: /* statement: T_LABEL K_REDUCE_AND symbol ';'  */
+#line 492 "parse.y"
+                { compile_reduce_and((yyvsp[-3].text), (yyvsp[-1].symb)); }
+#line 2474 "parse.cc"
+    break;
+
+  case 83: /* statement: T_LABEL K_REDUCE_OR symbol ';'  */
+#line 495 "parse.y"
+                { compile_reduce_or((yyvsp[-3].text), (yyvsp[-1].symb)); }
+#line 2480 "parse.cc"
+    break;
+
+  case 84: /* statement: T_LABEL K_REDUCE_XOR symbol ';'  */
+#line 498 "parse.y"
+                { compile_reduce_xor((yyvsp[-3].text), (yyvsp[-1].symb)); }
+#line 2486 "parse.cc"
+    break;
+
+  case 85: /* statement: T_LABEL K_REDUCE_NAND symbol ';'  */
+#line 501 "parse.y"
+                { compile_reduce_nand((yyvsp[-3].text), (yyvsp[-1].symb)); }
+#line 2492 "parse.cc"
+    break;
+
+  case 86: /* statement: T_LABEL K_REDUCE_NOR symbol ';'  */
+#line 504 "parse.y"
+                { compile_reduce_nor((yyvsp[-3].text), (yyvsp[-1].symb)); }
+#line 2498 "parse.cc"
+    break;
+
+  case 87: /* statement: T_LABEL K_REDUCE_XNOR symbol ';'  */
+#line 507 "parse.y"
+                { compile_reduce_xnor((yyvsp[-3].text), (yyvsp[-1].symb)); }
+#line 2504 "parse.cc"
+    break;
+
+  case 88: /* statement: T_LABEL K_REPEAT T_NUMBER ',' T_NUMBER ',' symbol ';'  */
+#line 510 "parse.y"
+                { compile_repeat((yyvsp[-7].text), (yyvsp[-5].numb), (yyvsp[-3].numb), (yyvsp[-1].symb)); }
+#line 2510 "parse.cc"
+    break;
+
+  case 89: /* statement: T_LABEL K_EXTEND_S T_NUMBER ',' symbol ';'  */
+#line 515 "parse.y"
+                { compile_extend_signed((yyvsp[-5].text), (yyvsp[-3].numb), (yyvsp[-1].symb)); }
+#line 2516 "parse.cc"
+    break;
+
+  case 90: /* statement: T_LABEL K_SFUNC T_NUMBER T_NUMBER T_STRING ',' T_STRING ',' symbols ';'  */
+#line 520 "parse.y"
+                { compile_sfunc((yyvsp[-9].text), (yyvsp[-5].text), (yyvsp[-3].text), (yyvsp[-7].numb), (yyvsp[-6].numb), (yyvsp[-1].symbv).cnt, (yyvsp[-1].symbv).vect, 0, false); }
+#line 2522 "parse.cc"
+    break;
+
+  case 91: /* statement: T_LABEL K_SFUNC_E T_NUMBER T_NUMBER T_STRING ',' T_SYMBOL ',' T_STRING ',' symbols ';'  */
+#line 524 "parse.y"
+                { compile_sfunc((yyvsp[-11].text), (yyvsp[-7].text), (yyvsp[-3].text), (yyvsp[-9].numb), (yyvsp[-8].numb), (yyvsp[-1].symbv).cnt, (yyvsp[-1].symbv).vect, (yyvsp[-5].text), false); }
+#line 2528 "parse.cc"
+    break;
+
+  case 92: /* statement: T_LABEL K_SFUNC_M T_NUMBER T_NUMBER T_STRING ',' T_STRING ',' symbols ';'  */
+#line 529 "parse.y"
+                { compile_sfunc((yyvsp[-9].text), (yyvsp[-5].text), (yyvsp[-3].text), (yyvsp[-7].numb), (yyvsp[-6].numb), (yyvsp[-1].symbv).cnt, (yyvsp[-1].symbv).vect, 0, true); }
+#line 2534 "parse.cc"
+    break;
+
+  case 93: /* statement: T_LABEL K_SFUNC T_NUMBER T_NUMBER T_STRING ',' T_STRING ';'  */
+#line 534 "parse.y"
+                { compile_sfunc((yyvsp[-7].text), (yyvsp[-3].text), (yyvsp[-1].text), (yyvsp[-5].numb), (yyvsp[-4].numb), 0, 0, 0, false); }
+#line 2540 "parse.cc"
+    break;
+
+  case 94: /* statement: T_LABEL K_SFUNC_E T_NUMBER T_NUMBER T_STRING ',' T_SYMBOL ',' T_STRING ';'  */
+#line 538 "parse.y"
+                { compile_sfunc((yyvsp[-9].text), (yyvsp[-5].text), (yyvsp[-1].text), (yyvsp[-7].numb), (yyvsp[-6].numb), 0, 0, (yyvsp[-3].text), false); }
+#line 2546 "parse.cc"
+    break;
+
+  case 95: /* statement: T_LABEL K_SHIFTL T_NUMBER ',' symbols ';'  */
+#line 543 "parse.y"
+                { struct symbv_s obj = (yyvsp[-1].symbv);
+		  compile_shiftl((yyvsp[-5].text), (yyvsp[-3].numb), obj.cnt, obj.vect);
+		}
+#line 2554 "parse.cc"
+    break;
+
+  case 96: /* statement: T_LABEL K_SHIFTR T_NUMBER ',' symbols ';'  */
+#line 548 "parse.y"
+                { struct symbv_s obj = (yyvsp[-1].symbv);
+		      compile_shiftr((yyvsp[-5].text), (yyvsp[-3].numb), false, obj.cnt, obj.vect);
+		}
+#line 2562 "parse.cc"
+    break;
+
+  case 97: /* statement: T_LABEL K_SHIFTRS T_NUMBER ',' symbols ';'  */
+#line 554 "parse.y"
+                { struct symbv_s obj = (yyvsp[-1].symbv);
+		      compile_shiftr((yyvsp[-5].text), (yyvsp[-3].numb), true, obj.cnt, obj.vect);
+		}
+#line 2570 "parse.cc"
+    break;
+
+  case 98: /* statement: T_LABEL K_EVENT T_SYMBOL ',' symbols ';'  */
+#line 564 "parse.y"
+                { compile_event((yyvsp[-5].text), (yyvsp[-3].text), (yyvsp[-1].symbv).cnt, (yyvsp[-1].symbv).vect); }
+#line 2576 "parse.cc"
+    break;
+
+  case 99: /* statement: T_LABEL K_EVENT K_DEBUG T_SYMBOL ',' symbols ';'  */
+#line 567 "parse.y"
+                { compile_event((yyvsp[-6].text), (yyvsp[-3].text), (yyvsp[-1].symbv).cnt, (yyvsp[-1].symbv).vect); }
+#line 2582 "parse.cc"
+    break;
+
+  case 100: /* statement: T_LABEL K_EVENT T_STRING ';'  */
+#line 570 "parse.y"
+                { compile_named_event((yyvsp[-3].text), (yyvsp[-1].text)); }
+#line 2588 "parse.cc"
+    break;
+
+  case 101: /* statement: T_LABEL K_EVENT_OR symbols ';'  */
+#line 573 "parse.y"
+                { compile_event((yyvsp[-3].text), 0, (yyvsp[-1].symbv).cnt, (yyvsp[-1].symbv).vect); }
+#line 2594 "parse.cc"
+    break;
+
+  case 102: /* statement: label_opt T_INSTR operands_opt ';'  */
+#line 581 "parse.y"
+                { compile_code((yyvsp[-3].text), (yyvsp[-2].text), (yyvsp[-1].opa)); }
+#line 2600 "parse.cc"
+    break;
+
+  case 103: /* statement: T_LABEL ';'  */
+#line 584 "parse.y"
+                { compile_codelabel((yyvsp[-1].text)); }
+#line 2606 "parse.cc"
+    break;
+
+  case 104: /* statement: label_opt K_file_line T_NUMBER T_NUMBER T_STRING ';'  */
+#line 589 "parse.y"
+                { compile_file_line((yyvsp[-5].text), (yyvsp[-3].numb), (yyvsp[-2].numb), (yyvsp[-1].text)); }
+#line 2612 "parse.cc"
+    break;
+
+  case 105: /* statement: label_opt K_file_line T_NUMBER T_NUMBER T_NUMBER ';'  */
+#line 592 "parse.y"
+                { assert((yyvsp[-1].numb) == 0);
+		  compile_file_line((yyvsp[-5].text), (yyvsp[-3].numb), (yyvsp[-2].numb), 0); }
+#line 2619 "parse.cc"
+    break;
+
+  case 106: /* statement: label_opt K_vpi_call T_NUMBER T_NUMBER T_STRING argument_opt '{' T_NUMBER T_NUMBER '}' ';'  */
+#line 603 "parse.y"
+      { compile_vpi_call((yyvsp[-10].text), (yyvsp[-6].text), true, false, (yyvsp[-8].numb), (yyvsp[-7].numb),
+			 (yyvsp[-5].argv).argc, (yyvsp[-5].argv).argv, (yyvsp[-3].numb), (yyvsp[-2].numb)); }
+#line 2626 "parse.cc"
+    break;
+
+  case 107: /* statement: label_opt K_vpi_call_w T_NUMBER T_NUMBER T_STRING argument_opt '{' T_NUMBER T_NUMBER '}' ';'  */
+#line 610 "parse.y"
+      { compile_vpi_call((yyvsp[-10].text), (yyvsp[-6].text), false, true, (yyvsp[-8].numb), (yyvsp[-7].numb),
+			 (yyvsp[-5].argv).argc, (yyvsp[-5].argv).argv, (yyvsp[-3].numb), (yyvsp[-2].numb)); }
+#line 2633 "parse.cc"
+    break;
+
+  case 108: /* statement: label_opt K_vpi_call_i T_NUMBER T_NUMBER T_STRING argument_opt '{' T_NUMBER T_NUMBER '}' ';'  */
+#line 617 "parse.y"
+      { compile_vpi_call((yyvsp[-10].text), (yyvsp[-6].text), false, false, (yyvsp[-8].numb), (yyvsp[-7].numb),
+			 (yyvsp[-5].argv).argc, (yyvsp[-5].argv).argv, (yyvsp[-3].numb), (yyvsp[-2].numb)); }
+#line 2640 "parse.cc"
+    break;
+
+  case 109: /* statement: label_opt K_vpi_func T_NUMBER T_NUMBER T_STRING ',' T_NUMBER ',' T_NUMBER argument_opt '{' T_NUMBER T_NUMBER '}' ';'  */
+#line 622 "parse.y"
+      { compile_vpi_func_call((yyvsp[-14].text), (yyvsp[-10].text), (yyvsp[-8].numb), (yyvsp[-6].numb), (yyvsp[-12].numb), (yyvsp[-11].numb),
+			      (yyvsp[-5].argv).argc, (yyvsp[-5].argv).argv, (yyvsp[-3].numb), (yyvsp[-2].numb)); }
+#line 2647 "parse.cc"
+    break;
+
+  case 110: /* statement: label_opt K_vpi_func_r T_NUMBER T_NUMBER T_STRING argument_opt '{' T_NUMBER T_NUMBER '}' ';'  */
+#line 627 "parse.y"
+      { compile_vpi_func_call((yyvsp[-10].text), (yyvsp[-6].text), 0, -vpiRealConst, (yyvsp[-8].numb), (yyvsp[-7].numb),
+			      (yyvsp[-5].argv).argc, (yyvsp[-5].argv).argv, (yyvsp[-3].numb), (yyvsp[-2].numb)); }
+#line 2654 "parse.cc"
+    break;
+
+  case 111: /* statement: label_opt K_disable symbol ';'  */
+#line 634 "parse.y"
+                { compile_disable((yyvsp[-3].text), (yyvsp[-1].symb)); }
+#line 2660 "parse.cc"
+    break;
+
+  case 112: /* statement: label_opt K_fork symbol ',' symbol ';'  */
+#line 638 "parse.y"
+                { compile_fork((yyvsp[-5].text), (yyvsp[-3].symb), (yyvsp[-1].symb)); }
+#line 2666 "parse.cc"
+    break;
+
+  case 113: /* statement: T_LABEL K_SCOPE T_SYMBOL ',' T_STRING T_STRING T_NUMBER T_NUMBER ';'  */
+#line 656 "parse.y"
+                { compile_scope_decl((yyvsp[-8].text), (yyvsp[-6].text), (yyvsp[-4].text), (yyvsp[-3].text), 0, (yyvsp[-2].numb), (yyvsp[-1].numb), (yyvsp[-2].numb), (yyvsp[-1].numb), 0); }
+#line 2672 "parse.cc"
+    break;
+
+  case 114: /* statement: T_LABEL K_SCOPE T_SYMBOL ',' T_STRING T_STRING T_NUMBER T_NUMBER ',' T_NUMBER T_NUMBER T_NUMBER ',' T_SYMBOL ';'  */
+#line 660 "parse.y"
+                { compile_scope_decl((yyvsp[-14].text), (yyvsp[-12].text), (yyvsp[-10].text), (yyvsp[-9].text), (yyvsp[-1].text), (yyvsp[-8].numb), (yyvsp[-7].numb), (yyvsp[-5].numb), (yyvsp[-4].numb), (yyvsp[-3].numb)); }
+#line 2678 "parse.cc"
+    break;
+
+  case 115: /* statement: T_LABEL K_SCOPE T_SYMBOL ',' T_STRING T_STRING T_NUMBER T_NUMBER ',' T_NUMBER T_NUMBER ',' T_SYMBOL ';'  */
+#line 666 "parse.y"
+                { compile_scope_decl((yyvsp[-13].text), (yyvsp[-11].text), (yyvsp[-9].text), (yyvsp[-8].text), (yyvsp[-1].text), (yyvsp[-7].numb), (yyvsp[-6].numb), (yyvsp[-4].numb), (yyvsp[-3].numb), 0); }
+#line 2684 "parse.cc"
+    break;
+
+  case 116: /* statement: T_LABEL K_SCOPE T_SYMBOL ',' T_STRING ';'  */
+#line 671 "parse.y"
+                { compile_scope_decl((yyvsp[-5].text), (yyvsp[-3].text), (yyvsp[-1].text), 0, 0, 0, 0, 0, 0, 0); }
+#line 2690 "parse.cc"
+    break;
+
+  case 117: /* statement: T_LABEL K_SCOPE T_SYMBOL ',' T_STRING ',' T_SYMBOL ';'  */
+#line 674 "parse.y"
+                { compile_scope_decl((yyvsp[-7].text), (yyvsp[-5].text), (yyvsp[-3].text), 0, (yyvsp[-1].text), 0, 0, 0, 0, 0); }
+#line 2696 "parse.cc"
+    break;
+
+  case 118: /* statement: K_SCOPE T_SYMBOL ';'  */
+#line 680 "parse.y"
+                { compile_scope_recall((yyvsp[-1].text)); }
+#line 2702 "parse.cc"
+    break;
+
+  case 119: /* statement: K_PORT_INFO T_NUMBER port_type T_NUMBER T_STRING  */
+#line 685 "parse.y"
+                { compile_port_info( (yyvsp[-3].numb) /* port_index */, (yyvsp[-2].vpi_enum), (yyvsp[-1].numb) /* width */,
+		                     (yyvsp[0].text) /*&name */ ); }
+#line 2709 "parse.cc"
+    break;
+
+  case 120: /* statement: K_TIMESCALE T_NUMBER T_NUMBER ';'  */
+#line 689 "parse.y"
+                { compile_timescale((yyvsp[-2].numb), (yyvsp[-1].numb)); }
+#line 2715 "parse.cc"
+    break;
+
+  case 121: /* statement: K_TIMESCALE '-' T_NUMBER T_NUMBER ';'  */
+#line 691 "parse.y"
+                { compile_timescale(-(yyvsp[-2].numb), (yyvsp[-1].numb)); }
+#line 2721 "parse.cc"
+    break;
+
+  case 122: /* statement: K_TIMESCALE T_NUMBER '-' T_NUMBER ';'  */
+#line 693 "parse.y"
+                { compile_timescale((yyvsp[-3].numb), -(yyvsp[-1].numb)); }
+#line 2727 "parse.cc"
+    break;
+
+  case 123: /* statement: K_TIMESCALE '-' T_NUMBER '-' T_NUMBER ';'  */
+#line 695 "parse.y"
+                { compile_timescale(-(yyvsp[-3].numb), -(yyvsp[-1].numb)); }
+#line 2733 "parse.cc"
+    break;
+
+  case 124: /* statement: K_THREAD T_SYMBOL ';'  */
+#line 702 "parse.y"
+                { compile_thread((yyvsp[-1].text), 0); }
+#line 2739 "parse.cc"
+    break;
+
+  case 125: /* statement: K_THREAD T_SYMBOL ',' T_SYMBOL ';'  */
+#line 705 "parse.y"
+                { compile_thread((yyvsp[-3].text), (yyvsp[-1].text)); }
+#line 2745 "parse.cc"
+    break;
+
+  case 126: /* statement: T_LABEL K_VAR local_flag T_STRING ',' signed_t_number signed_t_number ';'  */
+#line 712 "parse.y"
+      { compile_variable((yyvsp[-7].text), (yyvsp[-4].text), (yyvsp[-2].numb), (yyvsp[-1].numb), vpiLogicVar, false, (yyvsp[-5].flag)); }
+#line 2751 "parse.cc"
+    break;
+
+  case 127: /* statement: T_LABEL K_VAR_S local_flag T_STRING ',' signed_t_number signed_t_number ';'  */
+#line 715 "parse.y"
+      { compile_variable((yyvsp[-7].text), (yyvsp[-4].text), (yyvsp[-2].numb), (yyvsp[-1].numb), vpiLogicVar, true, (yyvsp[-5].flag)); }
+#line 2757 "parse.cc"
+    break;
+
+  case 128: /* statement: T_LABEL K_VAR_I local_flag T_STRING ',' T_NUMBER T_NUMBER ';'  */
+#line 718 "parse.y"
+      { compile_variable((yyvsp[-7].text), (yyvsp[-4].text), (yyvsp[-2].numb), (yyvsp[-1].numb), vpiIntegerVar, true, (yyvsp[-5].flag)); }
+#line 2763 "parse.cc"
+    break;
+
+  case 129: /* statement: T_LABEL K_VAR_2S local_flag T_STRING ',' signed_t_number signed_t_number ';'  */
+#line 721 "parse.y"
+      { compile_variable((yyvsp[-7].text), (yyvsp[-4].text), (yyvsp[-2].numb), (yyvsp[-1].numb), vpiIntVar, true, (yyvsp[-5].flag)); }
+#line 2769 "parse.cc"
+    break;
+
+  case 130: /* statement: T_LABEL K_VAR_2U local_flag T_STRING ',' signed_t_number signed_t_number ';'  */
+#line 724 "parse.y"
+      { compile_variable((yyvsp[-7].text), (yyvsp[-4].text), (yyvsp[-2].numb), (yyvsp[-1].numb), vpiIntVar, false, (yyvsp[-5].flag)); }
+#line 2775 "parse.cc"
+    break;
+
+  case 131: /* statement: T_LABEL K_VAR_R T_STRING ',' signed_t_number signed_t_number ';'  */
+#line 727 "parse.y"
+      { compile_var_real((yyvsp[-6].text), (yyvsp[-4].text)); }
+#line 2781 "parse.cc"
+    break;
+
+  case 132: /* statement: T_LABEL K_VAR_STR T_STRING ';'  */
+#line 730 "parse.y"
+      { compile_var_string((yyvsp[-3].text), (yyvsp[-1].text)); }
+#line 2787 "parse.cc"
+    break;
+
+  case 133: /* statement: T_LABEL K_VAR_DARRAY T_STRING ';'  */
+#line 733 "parse.y"
+      { compile_var_darray((yyvsp[-3].text), (yyvsp[-1].text)); }
+#line 2793 "parse.cc"
+    break;
+
+  case 134: /* statement: T_LABEL K_VAR_COBJECT T_STRING ';'  */
+#line 736 "parse.y"
+      { compile_var_cobject((yyvsp[-3].text), (yyvsp[-1].text)); }
+#line 2799 "parse.cc"
+    break;
+
+  case 135: /* statement: T_LABEL K_NET local_flag T_STRING ',' signed_t_number signed_t_number ',' symbols_net ';'  */
+#line 743 "parse.y"
+      { compile_net((yyvsp[-9].text), (yyvsp[-6].text), (yyvsp[-4].numb), (yyvsp[-3].numb), vpiLogicVar, false, (yyvsp[-7].flag), (yyvsp[-1].symbv).cnt, (yyvsp[-1].symbv).vect); }
+#line 2805 "parse.cc"
+    break;
+
+  case 136: /* statement: T_LABEL K_NET_S local_flag T_STRING ',' signed_t_number signed_t_number ',' symbols_net ';'  */
+#line 747 "parse.y"
+      { compile_net((yyvsp[-9].text), (yyvsp[-6].text), (yyvsp[-4].numb), (yyvsp[-3].numb), vpiLogicVar, true, (yyvsp[-7].flag), (yyvsp[-1].symbv).cnt, (yyvsp[-1].symbv).vect); }
+#line 2811 "parse.cc"
+    break;
+
+  case 137: /* statement: T_LABEL K_NET_2U local_flag T_STRING ',' signed_t_number signed_t_number ',' symbols_net ';'  */
+#line 751 "parse.y"
+      { compile_net((yyvsp[-9].text), (yyvsp[-6].text), (yyvsp[-4].numb), (yyvsp[-3].numb), vpiIntVar, false, (yyvsp[-7].flag), (yyvsp[-1].symbv).cnt, (yyvsp[-1].symbv).vect); }
+#line 2817 "parse.cc"
+    break;
+
+  case 138: /* statement: T_LABEL K_NET_2S local_flag T_STRING ',' signed_t_number signed_t_number ',' symbols_net ';'  */
+#line 755 "parse.y"
+      { compile_net((yyvsp[-9].text), (yyvsp[-6].text), (yyvsp[-4].numb), (yyvsp[-3].numb), vpiIntVar, true, (yyvsp[-7].flag), (yyvsp[-1].symbv).cnt, (yyvsp[-1].symbv).vect); }
+#line 2823 "parse.cc"
+    break;
+
+  case 139: /* statement: T_LABEL K_NET8 local_flag T_STRING ',' signed_t_number signed_t_number ',' symbols_net ';'  */
+#line 759 "parse.y"
+      { compile_net((yyvsp[-9].text), (yyvsp[-6].text), (yyvsp[-4].numb), (yyvsp[-3].numb), -vpiLogicVar, false, (yyvsp[-7].flag), (yyvsp[-1].symbv).cnt, (yyvsp[-1].symbv).vect); }
+#line 2829 "parse.cc"
+    break;
+
+  case 140: /* statement: T_LABEL K_NET8_2U local_flag T_STRING ',' signed_t_number signed_t_number ',' symbols_net ';'  */
+#line 763 "parse.y"
+      { compile_net((yyvsp[-9].text), (yyvsp[-6].text), (yyvsp[-4].numb), (yyvsp[-3].numb), -vpiLogicVar, false, (yyvsp[-7].flag), (yyvsp[-1].symbv).cnt, (yyvsp[-1].symbv).vect); }
+#line 2835 "parse.cc"
+    break;
+
+  case 141: /* statement: T_LABEL K_NET8_S local_flag T_STRING ',' signed_t_number signed_t_number ',' symbols_net ';'  */
+#line 767 "parse.y"
+      { compile_net((yyvsp[-9].text), (yyvsp[-6].text), (yyvsp[-4].numb), (yyvsp[-3].numb), -vpiLogicVar, true, (yyvsp[-7].flag), (yyvsp[-1].symbv).cnt, (yyvsp[-1].symbv).vect); }
+#line 2841 "parse.cc"
+    break;
+
+  case 142: /* statement: T_LABEL K_NET8_2S local_flag T_STRING ',' signed_t_number signed_t_number ',' symbols_net ';'  */
+#line 771 "parse.y"
+      { compile_net((yyvsp[-9].text), (yyvsp[-6].text), (yyvsp[-4].numb), (yyvsp[-3].numb), -vpiLogicVar, true, (yyvsp[-7].flag), (yyvsp[-1].symbv).cnt, (yyvsp[-1].symbv).vect); }
+#line 2847 "parse.cc"
+    break;
+
+  case 143: /* statement: T_LABEL K_NET_R local_flag T_STRING ',' signed_t_number signed_t_number ',' symbols_net ';'  */
+#line 775 "parse.y"
+      { compile_net_real((yyvsp[-9].text), (yyvsp[-6].text), (yyvsp[-4].numb), (yyvsp[-3].numb), (yyvsp[-7].flag), (yyvsp[-1].symbv).cnt, (yyvsp[-1].symbv).vect); }
+#line 2853 "parse.cc"
+    break;
+
+  case 144: /* statement: T_LABEL K_NET T_SYMBOL T_NUMBER ',' signed_t_number signed_t_number ',' symbols_net ';'  */
+#line 781 "parse.y"
+      { compile_netw((yyvsp[-9].text), (yyvsp[-7].text), (yyvsp[-6].numb), (yyvsp[-4].numb), (yyvsp[-3].numb), vpiLogicVar, false, (yyvsp[-1].symbv).cnt, (yyvsp[-1].symbv).vect); }
+#line 2859 "parse.cc"
+    break;
+
+  case 145: /* statement: T_LABEL K_NET_S T_SYMBOL T_NUMBER ',' signed_t_number signed_t_number ',' symbols_net ';'  */
+#line 785 "parse.y"
+      { compile_netw((yyvsp[-9].text), (yyvsp[-7].text), (yyvsp[-6].numb), (yyvsp[-4].numb), (yyvsp[-3].numb), vpiLogicVar, true, (yyvsp[-1].symbv).cnt, (yyvsp[-1].symbv).vect); }
+#line 2865 "parse.cc"
+    break;
+
+  case 146: /* statement: T_LABEL K_NET8 T_SYMBOL T_NUMBER ',' signed_t_number signed_t_number ',' symbols_net ';'  */
+#line 789 "parse.y"
+      { compile_netw((yyvsp[-9].text), (yyvsp[-7].text), (yyvsp[-6].numb), (yyvsp[-4].numb), (yyvsp[-3].numb), -vpiLogicVar, false, (yyvsp[-1].symbv).cnt, (yyvsp[-1].symbv).vect); }
+#line 2871 "parse.cc"
+    break;
+
+  case 147: /* statement: T_LABEL K_NET8_S T_SYMBOL T_NUMBER ',' signed_t_number signed_t_number ',' symbols_net ';'  */
+#line 793 "parse.y"
+      { compile_netw((yyvsp[-9].text), (yyvsp[-7].text), (yyvsp[-6].numb), (yyvsp[-4].numb), (yyvsp[-3].numb), -vpiLogicVar, true, (yyvsp[-1].symbv).cnt, (yyvsp[-1].symbv).vect); }
+#line 2877 "parse.cc"
+    break;
+
+  case 148: /* statement: T_LABEL K_NET_R T_SYMBOL T_NUMBER ',' signed_t_number signed_t_number ',' symbols_net ';'  */
+#line 797 "parse.y"
+      { compile_netw_real((yyvsp[-9].text), (yyvsp[-7].text), (yyvsp[-6].numb), (yyvsp[-4].numb), (yyvsp[-3].numb), (yyvsp[-1].symbv).cnt, (yyvsp[-1].symbv).vect); }
+#line 2883 "parse.cc"
+    break;
+
+  case 149: /* statement: T_LABEL K_ALIAS T_SYMBOL T_NUMBER ',' signed_t_number signed_t_number ',' symbols_net ';'  */
+#line 804 "parse.y"
+                 { compile_aliasw((yyvsp[-9].text), (yyvsp[-7].text), (yyvsp[-6].numb), (yyvsp[-4].numb), (yyvsp[-3].numb), (yyvsp[-1].symbv).cnt, (yyvsp[-1].symbv).vect); }
+#line 2889 "parse.cc"
+    break;
+
+  case 150: /* statement: T_LABEL K_ALIAS_R T_SYMBOL T_NUMBER ',' signed_t_number signed_t_number ',' symbols_net ';'  */
+#line 809 "parse.y"
+                 { compile_aliasw((yyvsp[-9].text), (yyvsp[-7].text), (yyvsp[-6].numb), (yyvsp[-4].numb), (yyvsp[-3].numb), (yyvsp[-1].symbv).cnt, (yyvsp[-1].symbv).vect); }
+#line 2895 "parse.cc"
+    break;
+
+  case 151: /* statement: T_LABEL K_PARAM_STR T_STRING T_NUMBER T_NUMBER T_NUMBER ',' T_STRING ';'  */
+#line 815 "parse.y"
+                { compile_param_string((yyvsp[-8].text), (yyvsp[-6].text), (yyvsp[-1].text), (yyvsp[-5].numb), (yyvsp[-4].numb), (yyvsp[-3].numb)); }
+#line 2901 "parse.cc"
+    break;
+
+  case 152: /* statement: T_LABEL K_PARAM_L T_STRING T_NUMBER T_NUMBER T_NUMBER ',' T_SYMBOL ';'  */
+#line 818 "parse.y"
+                { compile_param_logic((yyvsp[-8].text), (yyvsp[-6].text), (yyvsp[-1].text), false, (yyvsp[-5].numb), (yyvsp[-4].numb), (yyvsp[-3].numb)); }
+#line 2907 "parse.cc"
+    break;
+
+  case 153: /* statement: T_LABEL K_PARAM_L T_STRING T_NUMBER T_NUMBER T_NUMBER ',' '+' T_SYMBOL ';'  */
+#line 821 "parse.y"
+                { compile_param_logic((yyvsp[-9].text), (yyvsp[-7].text), (yyvsp[-1].text), true, (yyvsp[-6].numb), (yyvsp[-5].numb), (yyvsp[-4].numb) ); }
+#line 2913 "parse.cc"
+    break;
+
+  case 154: /* statement: T_LABEL K_PARAM_REAL T_STRING T_NUMBER T_NUMBER T_NUMBER ',' T_SYMBOL ';'  */
+#line 824 "parse.y"
+                { compile_param_real((yyvsp[-8].text), (yyvsp[-6].text), (yyvsp[-1].text), (yyvsp[-5].numb), (yyvsp[-4].numb), (yyvsp[-3].numb)); }
+#line 2919 "parse.cc"
+    break;
+
+  case 155: /* statement: T_LABEL K_ISLAND T_SYMBOL ';'  */
+#line 829 "parse.y"
+      { compile_island((yyvsp[-3].text), (yyvsp[-1].text)); }
+#line 2925 "parse.cc"
+    break;
+
+  case 156: /* statement: T_LABEL K_PORT T_SYMBOL ',' T_SYMBOL ';'  */
+#line 832 "parse.y"
+      { compile_island_port((yyvsp[-5].text), (yyvsp[-3].text), (yyvsp[-1].text)); }
+#line 2931 "parse.cc"
+    break;
+
+  case 157: /* statement: T_LABEL K_IMPORT T_SYMBOL ',' T_SYMBOL ';'  */
+#line 835 "parse.y"
+      { compile_island_import((yyvsp[-5].text), (yyvsp[-3].text), (yyvsp[-1].text)); }
+#line 2937 "parse.cc"
+    break;
+
+  case 158: /* statement: T_LABEL K_EXPORT T_SYMBOL ';'  */
+#line 838 "parse.y"
+      { compile_island_export((yyvsp[-3].text), (yyvsp[-1].text)); }
+#line 2943 "parse.cc"
+    break;
+
+  case 159: /* statement: K_TRAN T_SYMBOL ',' T_SYMBOL T_SYMBOL ';'  */
+#line 841 "parse.y"
+      { compile_island_tranif(0, (yyvsp[-4].text), (yyvsp[-2].text), (yyvsp[-1].text), 0); }
+#line 2949 "parse.cc"
+    break;
+
+  case 160: /* statement: K_TRANIF0 T_SYMBOL ',' T_SYMBOL T_SYMBOL ',' T_SYMBOL ';'  */
+#line 844 "parse.y"
+      { compile_island_tranif(0, (yyvsp[-6].text), (yyvsp[-4].text), (yyvsp[-3].text), (yyvsp[-1].text)); }
+#line 2955 "parse.cc"
+    break;
+
+  case 161: /* statement: K_TRANIF1 T_SYMBOL ',' T_SYMBOL T_SYMBOL ',' T_SYMBOL ';'  */
+#line 847 "parse.y"
+      { compile_island_tranif(1, (yyvsp[-6].text), (yyvsp[-4].text), (yyvsp[-3].text), (yyvsp[-1].text)); }
+#line 2961 "parse.cc"
+    break;
+
+  case 162: /* statement: K_TRANVP T_NUMBER T_NUMBER T_NUMBER ',' T_SYMBOL ',' T_SYMBOL T_SYMBOL ';'  */
+#line 850 "parse.y"
+      { compile_island_tranvp((yyvsp[-4].text), (yyvsp[-2].text), (yyvsp[-1].text), (yyvsp[-8].numb), (yyvsp[-7].numb), (yyvsp[-6].numb)); }
+#line 2967 "parse.cc"
+    break;
+
+  case 163: /* $@3: %empty  */
+#line 855 "parse.y"
+      { compile_class_start((yyvsp[-5].text), (yyvsp[-3].text), (yyvsp[-1].numb)); }
+#line 2973 "parse.cc"
+    break;
+
+  case 164: /* statement: T_LABEL K_CLASS T_STRING '[' T_NUMBER ']' $@3 class_properties ';'  */
+#line 857 "parse.y"
+      { compile_class_done(); }
+#line 2979 "parse.cc"
+    break;
+
+  case 165: /* statement: enum_type  */
+#line 860 "parse.y"
+      { ; }
+#line 2985 "parse.cc"
+    break;
+
+  case 169: /* class_property: T_NUMBER ':' T_STRING ',' T_STRING  */
+#line 874 "parse.y"
+      { compile_class_property((yyvsp[-4].numb), (yyvsp[-2].text), (yyvsp[0].text)); }
+#line 2991 "parse.cc"
+    break;
+
+  case 170: /* enum_type: T_LABEL K_ENUM2 '(' T_NUMBER ')' enum_type_names ';'  */
+#line 880 "parse.y"
+      { compile_enum2_type((yyvsp[-6].text), (yyvsp[-3].numb), false, (yyvsp[-1].enum_namev)); }
+#line 2997 "parse.cc"
+    break;
+
+  case 171: /* enum_type: T_LABEL K_ENUM2_S '(' T_NUMBER ')' enum_type_names ';'  */
+#line 882 "parse.y"
+      { compile_enum2_type((yyvsp[-6].text), (yyvsp[-3].numb), true, (yyvsp[-1].enum_namev)); }
+#line 3003 "parse.cc"
+    break;
+
+  case 172: /* enum_type: T_LABEL K_ENUM4 '(' T_NUMBER ')' enum_type_names ';'  */
+#line 884 "parse.y"
+      { compile_enum4_type((yyvsp[-6].text), (yyvsp[-3].numb), false, (yyvsp[-1].enum_namev)); }
+#line 3009 "parse.cc"
+    break;
+
+  case 173: /* enum_type: T_LABEL K_ENUM4_S '(' T_NUMBER ')' enum_type_names ';'  */
+#line 886 "parse.y"
+      { compile_enum4_type((yyvsp[-6].text), (yyvsp[-3].numb), true, (yyvsp[-1].enum_namev)); }
+#line 3015 "parse.cc"
+    break;
+
+  case 174: /* enum_type_names: enum_type_name  */
+#line 891 "parse.y"
+      { list<struct enum_name_s>*tmp = new list<struct enum_name_s>;
+	tmp->push_back((yyvsp[0].enum_name));
+	(yyval.enum_namev) = tmp;
+      }
+#line 3024 "parse.cc"
+    break;
+
+  case 175: /* enum_type_names: enum_type_names ',' enum_type_name  */
+#line 896 "parse.y"
+      { list<struct enum_name_s>*tmp = (yyvsp[-2].enum_namev);
+	tmp->push_back((yyvsp[0].enum_name));
+	(yyval.enum_namev) = tmp;
+      }
+#line 3033 "parse.cc"
+    break;
+
+  case 176: /* enum_type_name: T_STRING T_NUMBER  */
+#line 904 "parse.y"
+      { (yyval.enum_name).text = (yyvsp[-1].text); (yyval.enum_name).val2 = (yyvsp[0].numb); (yyval.enum_name).val4 = 0; }
+#line 3039 "parse.cc"
+    break;
+
+  case 177: /* enum_type_name: T_STRING T_VECTOR  */
+#line 906 "parse.y"
+      { (yyval.enum_name).text = (yyvsp[-1].text); (yyval.enum_name).val2 = 0; (yyval.enum_name).val4 = (yyvsp[0].vect).text; }
+#line 3045 "parse.cc"
+    break;
+
+  case 178: /* local_flag: '*'  */
+#line 910 "parse.y"
+        { (yyval.flag) = true; }
+#line 3051 "parse.cc"
+    break;
+
+  case 179: /* local_flag: %empty  */
+#line 911 "parse.y"
+        { (yyval.flag) = false; }
+#line 3057 "parse.cc"
+    break;
+
+  case 180: /* label_opt: T_LABEL  */
+#line 918 "parse.y"
+                  { (yyval.text) = (yyvsp[0].text); }
+#line 3063 "parse.cc"
+    break;
+
+  case 181: /* label_opt: %empty  */
+#line 919 "parse.y"
+                  { (yyval.text) = 0; }
+#line 3069 "parse.cc"
+    break;
+
+  case 182: /* operands_opt: operands  */
+#line 923 "parse.y"
+                   { (yyval.opa) = (yyvsp[0].opa); }
+#line 3075 "parse.cc"
+    break;
+
+  case 183: /* operands_opt: %empty  */
+#line 924 "parse.y"
+                   { (yyval.opa) = 0; }
+#line 3081 "parse.cc"
+    break;
+
+  case 184: /* operands: operands ',' operand  */
+#line 929 "parse.y"
+                { comp_operands_t opa = (yyvsp[-2].opa);
+		  assert(opa->argc < 3);
+		  assert((yyvsp[0].opa)->argc == 1);
+		  opa->argv[opa->argc] = (yyvsp[0].opa)->argv[0];
+		  opa->argc += 1;
+		  free((yyvsp[0].opa));
+		  (yyval.opa) =  opa;
+		}
+#line 3094 "parse.cc"
+    break;
+
+  case 185: /* operands: operand  */
+#line 938 "parse.y"
+                { (yyval.opa) = (yyvsp[0].opa); }
+#line 3100 "parse.cc"
+    break;
+
+  case 186: /* operand: symbol  */
+#line 943 "parse.y"
+      { comp_operands_t opa = (comp_operands_t)
+		  calloc(1, sizeof(struct comp_operands_s));
+	opa->argc = 1;
+	opa->argv[0].ltype = L_SYMB;
+	opa->argv[0].symb = (yyvsp[0].symb);
+	(yyval.opa) = opa;
+      }
+#line 3112 "parse.cc"
+    break;
+
+  case 187: /* operand: T_NUMBER  */
+#line 951 "parse.y"
+      { comp_operands_t opa = (comp_operands_t)
+		  calloc(1, sizeof(struct comp_operands_s));
+	opa->argc = 1;
+	opa->argv[0].ltype = L_NUMB;
+	opa->argv[0].numb = (yyvsp[0].numb);
+	(yyval.opa) = opa;
+      }
+#line 3124 "parse.cc"
+    break;
+
+  case 188: /* operand: T_STRING  */
+#line 959 "parse.y"
+      { comp_operands_t opa = (comp_operands_t)
+		  calloc(1, sizeof(struct comp_operands_s));
+	opa->argc = 1;
+	opa->argv[0].ltype = L_STRING;
+	opa->argv[0].text = (yyvsp[0].text);
+	(yyval.opa) = opa;
+      }
+#line 3136 "parse.cc"
+    break;
+
+  case 189: /* argument_opt: ',' argument_list  */
+#line 984 "parse.y"
+                {
+		  argv_sym_lookup(&(yyvsp[0].argv));
+		  (yyval.argv) = (yyvsp[0].argv);
+		}
+#line 3145 "parse.cc"
+    break;
+
+  case 190: /* argument_opt: %empty  */
+#line 989 "parse.y"
+                { struct argv_s tmp;
+		  argv_init(&tmp);
+		  (yyval.argv) = tmp;
+		}
+#line 3154 "parse.cc"
+    break;
+
+  case 191: /* argument_list: argument  */
+#line 997 "parse.y"
+      { struct argv_s tmp;
+	argv_init(&tmp);
+	argv_add(&tmp, (yyvsp[0].vpi));
+	(yyval.argv) = tmp;
+      }
+#line 3164 "parse.cc"
+    break;
+
+  case 192: /* argument_list: argument_list ',' argument  */
+#line 1003 "parse.y"
+      { struct argv_s tmp = (yyvsp[-2].argv);
+	argv_add(&tmp, (yyvsp[0].vpi));
+	(yyval.argv) = tmp;
+      }
+#line 3173 "parse.cc"
+    break;
+
+  case 193: /* argument_list: T_SYMBOL  */
+#line 1008 "parse.y"
+      { struct argv_s tmp;
+	argv_init(&tmp);
+	argv_sym_add(&tmp, (yyvsp[0].text));
+	(yyval.argv) = tmp;
+      }
+#line 3183 "parse.cc"
+    break;
+
+  case 194: /* argument_list: argument_list ',' T_SYMBOL  */
+#line 1014 "parse.y"
+      { struct argv_s tmp = (yyvsp[-2].argv);
+	argv_sym_add(&tmp, (yyvsp[0].text));
+	(yyval.argv) = tmp;
+      }
+#line 3192 "parse.cc"
+    break;
+
+  case 195: /* argument: T_STRING  */
+#line 1022 "parse.y"
+      { (yyval.vpi) = vpip_make_string_const((yyvsp[0].text)); }
+#line 3198 "parse.cc"
+    break;
+
+  case 196: /* argument: T_VECTOR  */
+#line 1024 "parse.y"
+      { (yyval.vpi) = vpip_make_binary_const((yyvsp[0].vect).idx, (yyvsp[0].vect).text, true);
+	free((yyvsp[0].vect).text);
+      }
+#line 3206 "parse.cc"
+    break;
+
+  case 197: /* argument: symbol_access  */
+#line 1028 "parse.y"
+      { (yyval.vpi) = (yyvsp[0].vpi); }
+#line 3212 "parse.cc"
+    break;
+
+  case 198: /* symbol_access: K_A '<' T_SYMBOL ',' T_NUMBER '>'  */
+#line 1033 "parse.y"
+      { (yyval.vpi) = vpip_make_vthr_A((yyvsp[-3].text), (yyvsp[-1].numb)); }
+#line 3218 "parse.cc"
+    break;
+
+  case 199: /* symbol_access: K_A '<' T_SYMBOL ',' T_NUMBER T_NUMBER T_STRING '>'  */
+#line 1035 "parse.y"
+      { (yyval.vpi) = vpip_make_vthr_A((yyvsp[-5].text), (yyvsp[-3].numb), (yyvsp[-2].numb), (yyvsp[-1].text)); }
+#line 3224 "parse.cc"
+    break;
+
+  case 200: /* symbol_access: K_A '<' T_SYMBOL ',' T_SYMBOL '>'  */
+#line 1037 "parse.y"
+      { (yyval.vpi) = vpip_make_vthr_A((yyvsp[-3].text), (yyvsp[-1].text)); }
+#line 3230 "parse.cc"
+    break;
+
+  case 201: /* symbol_access: K_A '<' T_SYMBOL ',' symbol_access '>'  */
+#line 1039 "parse.y"
+      { (yyval.vpi) = vpip_make_vthr_A((yyvsp[-3].text), (yyvsp[-1].vpi)); }
+#line 3236 "parse.cc"
+    break;
+
+  case 202: /* symbol_access: K_PV '<' T_SYMBOL ',' T_NUMBER ',' T_NUMBER '>'  */
+#line 1041 "parse.y"
+      { (yyval.vpi) = vpip_make_PV((yyvsp[-5].text), (yyvsp[-3].numb), (yyvsp[-1].numb)); }
+#line 3242 "parse.cc"
+    break;
+
+  case 203: /* symbol_access: K_PV '<' T_SYMBOL ',' '-' T_NUMBER ',' T_NUMBER '>'  */
+#line 1043 "parse.y"
+      { (yyval.vpi) = vpip_make_PV((yyvsp[-6].text), -(yyvsp[-3].numb), (yyvsp[-1].numb)); }
+#line 3248 "parse.cc"
+    break;
+
+  case 204: /* symbol_access: K_PV '<' T_SYMBOL ',' T_SYMBOL ',' T_NUMBER '>'  */
+#line 1045 "parse.y"
+      { (yyval.vpi) = vpip_make_PV((yyvsp[-5].text), (yyvsp[-3].text), (yyvsp[-1].numb)); }
+#line 3254 "parse.cc"
+    break;
+
+  case 205: /* symbol_access: K_PV '<' T_SYMBOL ',' symbol_access ',' T_NUMBER '>'  */
+#line 1047 "parse.y"
+      { (yyval.vpi) = vpip_make_PV((yyvsp[-5].text), (yyvsp[-3].vpi), (yyvsp[-1].numb)); }
+#line 3260 "parse.cc"
+    break;
+
+  case 206: /* symbol_access: K_PV '<' T_SYMBOL ',' T_NUMBER T_NUMBER T_STRING ',' T_NUMBER '>'  */
+#line 1049 "parse.y"
+      { (yyval.vpi) = vpip_make_PV((yyvsp[-7].text), (yyvsp[-5].numb), (yyvsp[-4].numb), (yyvsp[-3].text), (yyvsp[-1].numb)); }
+#line 3266 "parse.cc"
+    break;
+
+  case 207: /* symbol_access: K_APV '<' T_SYMBOL ',' T_NUMBER ',' T_NUMBER ',' T_NUMBER '>'  */
+#line 1051 "parse.y"
+      { (yyval.vpi) = vpip_make_vthr_APV((yyvsp[-7].text), (yyvsp[-5].numb), (yyvsp[-3].numb), (yyvsp[-1].numb)); }
+#line 3272 "parse.cc"
+    break;
+
+  case 208: /* symbols: symbol  */
+#line 1057 "parse.y"
+                { struct symbv_s obj;
+		  symbv_init(&obj);
+		  symbv_add(&obj, (yyvsp[0].symb));
+		  (yyval.symbv) = obj;
+		}
+#line 3282 "parse.cc"
+    break;
+
+  case 209: /* symbols: symbols ',' symbol  */
+#line 1063 "parse.y"
+                { struct symbv_s obj = (yyvsp[-2].symbv);
+		  symbv_add(&obj, (yyvsp[0].symb));
+		  (yyval.symbv) = obj;
+		}
+#line 3291 "parse.cc"
+    break;
+
+  case 210: /* numbers: T_NUMBER  */
+#line 1072 "parse.y"
+                { struct numbv_s obj;
+		  numbv_init(&obj);
+		  numbv_add(&obj, (yyvsp[0].numb));
+		  (yyval.numbv) = obj;
+		}
+#line 3301 "parse.cc"
+    break;
+
+  case 211: /* numbers: numbers ',' T_NUMBER  */
+#line 1078 "parse.y"
+                { struct numbv_s obj = (yyvsp[-2].numbv);
+		  numbv_add(&obj, (yyvsp[0].numb));
+		  (yyval.numbv) = obj;
+		}
+#line 3310 "parse.cc"
+    break;
+
+  case 212: /* symbols_net: symbol_opt  */
+#line 1087 "parse.y"
+                { struct symbv_s obj;
+		  symbv_init(&obj);
+		  symbv_add(&obj, (yyvsp[0].symb));
+		  (yyval.symbv) = obj;
+		}
+#line 3320 "parse.cc"
+    break;
+
+  case 213: /* symbols_net: symbols_net ',' symbol_opt  */
+#line 1093 "parse.y"
+                { struct symbv_s obj = (yyvsp[-2].symbv);
+		  symbv_add(&obj, (yyvsp[0].symb));
+		  (yyval.symbv) = obj;
+		}
+#line 3329 "parse.cc"
+    break;
+
+  case 214: /* symbol: T_SYMBOL  */
+#line 1105 "parse.y"
+                { (yyval.symb).text = (yyvsp[0].text);
+		  (yyval.symb).idx = 0;
+		}
+#line 3337 "parse.cc"
+    break;
+
+  case 215: /* symbol_opt: symbol  */
+#line 1112 "parse.y"
+                { (yyval.symb) = (yyvsp[0].symb); }
+#line 3343 "parse.cc"
+    break;
+
+  case 216: /* symbol_opt: %empty  */
+#line 1114 "parse.y"
+                { (yyval.symb).text = 0;
+		  (yyval.symb).idx = 0;
+		}
+#line 3351 "parse.cc"
+    break;
+
+  case 219: /* port_type: K_PORT_INPUT  */
+#line 1129 "parse.y"
+                       { (yyval.vpi_enum) = vpiInput; }
+#line 3357 "parse.cc"
+    break;
+
+  case 220: /* port_type: K_PORT_OUTPUT  */
+#line 1130 "parse.y"
+                        { (yyval.vpi_enum) = vpiOutput; }
+#line 3363 "parse.cc"
+    break;
+
+  case 221: /* port_type: K_PORT_INOUT  */
+#line 1131 "parse.y"
+                        { (yyval.vpi_enum) = vpiInout; }
+#line 3369 "parse.cc"
+    break;
+
+  case 222: /* port_type: K_PORT_MIXED  */
+#line 1132 "parse.y"
+                        { (yyval.vpi_enum) = vpiMixedIO; }
+#line 3375 "parse.cc"
+    break;
+
+  case 223: /* port_type: K_PORT_NODIR  */
+#line 1133 "parse.y"
+                        { (yyval.vpi_enum) = vpiNoDirection; }
+#line 3381 "parse.cc"
+    break;
+
+  case 224: /* modpath_src: symbol '(' numbers ')' symbol  */
+#line 1138 "parse.y"
+      { compile_modpath_src(modpath_dst, 0, (yyvsp[-4].symb), (yyvsp[-2].numbv), 0, (yyvsp[0].symb), false); }
+#line 3387 "parse.cc"
+    break;
+
+  case 225: /* modpath_src: symbol '(' numbers '?' ')' symbol  */
+#line 1140 "parse.y"
+      { compile_modpath_src(modpath_dst, 0, (yyvsp[-5].symb), (yyvsp[-3].numbv), 0, (yyvsp[0].symb), true); }
+#line 3393 "parse.cc"
+    break;
+
+  case 226: /* modpath_src: symbol '(' numbers '?' symbol ')' symbol  */
+#line 1142 "parse.y"
+      { compile_modpath_src(modpath_dst, 0, (yyvsp[-6].symb), (yyvsp[-4].numbv), (yyvsp[-2].symb), (yyvsp[0].symb)); }
+#line 3399 "parse.cc"
+    break;
+
+  case 227: /* modpath_src: symbol '+' '(' numbers ')' symbol  */
+#line 1144 "parse.y"
+      { compile_modpath_src(modpath_dst, '+', (yyvsp[-5].symb), (yyvsp[-2].numbv), 0, (yyvsp[0].symb), false); }
+#line 3405 "parse.cc"
+    break;
+
+  case 228: /* modpath_src: symbol '+' '(' numbers '?' ')' symbol  */
+#line 1146 "parse.y"
+      { compile_modpath_src(modpath_dst, '+', (yyvsp[-6].symb), (yyvsp[-3].numbv), 0, (yyvsp[0].symb), true); }
+#line 3411 "parse.cc"
+    break;
+
+  case 229: /* modpath_src: symbol '+' '(' numbers '?' symbol ')' symbol  */
+#line 1148 "parse.y"
+      { compile_modpath_src(modpath_dst, '+', (yyvsp[-7].symb), (yyvsp[-4].numbv), (yyvsp[-2].symb), (yyvsp[0].symb)); }
+#line 3417 "parse.cc"
+    break;
+
+  case 230: /* modpath_src: symbol '-' '(' numbers ')' symbol  */
+#line 1150 "parse.y"
+      { compile_modpath_src(modpath_dst, '-', (yyvsp[-5].symb), (yyvsp[-2].numbv), 0, (yyvsp[0].symb), false); }
+#line 3423 "parse.cc"
+    break;
+
+  case 231: /* modpath_src: symbol '-' '(' numbers '?' ')' symbol  */
+#line 1152 "parse.y"
+      { compile_modpath_src(modpath_dst, '-', (yyvsp[-6].symb), (yyvsp[-3].numbv), 0, (yyvsp[0].symb), true); }
+#line 3429 "parse.cc"
+    break;
+
+  case 232: /* modpath_src: symbol '-' '(' numbers '?' symbol ')' symbol  */
+#line 1154 "parse.y"
+      { compile_modpath_src(modpath_dst, '-', (yyvsp[-7].symb), (yyvsp[-4].numbv), (yyvsp[-2].symb), (yyvsp[0].symb)); }
+#line 3435 "parse.cc"
+    break;
+
+  case 233: /* udp_table: T_STRING  */
+#line 1159 "parse.y"
+                { (yyval.table) = compile_udp_table(0x0, (yyvsp[0].text)); }
+#line 3441 "parse.cc"
+    break;
+
+  case 234: /* udp_table: udp_table ',' T_STRING  */
+#line 1161 "parse.y"
+                { (yyval.table) = compile_udp_table((yyvsp[-2].table),  (yyvsp[0].text)); }
+#line 3447 "parse.cc"
+    break;
+
+  case 235: /* signed_t_number: T_NUMBER  */
+#line 1165 "parse.y"
+                       { (yyval.numb) = (yyvsp[0].numb); }
+#line 3453 "parse.cc"
+    break;
+
+  case 236: /* signed_t_number: '-' T_NUMBER  */
+#line 1166 "parse.y"
+                       { (yyval.numb) = -(yyvsp[0].numb); }
+#line 3459 "parse.cc"
+    break;
+
+  case 237: /* delay: '(' T_NUMBER ')'  */
+#line 1171 "parse.y"
+                { (yyval.cdelay) = new vvp_delay_t((yyvsp[-1].numb), (yyvsp[-1].numb)); }
+#line 3465 "parse.cc"
+    break;
+
+  case 238: /* delay: '(' T_NUMBER ',' T_NUMBER ')'  */
+#line 1173 "parse.y"
+                { (yyval.cdelay) = new vvp_delay_t((yyvsp[-3].numb), (yyvsp[-1].numb)); }
+#line 3471 "parse.cc"
+    break;
+
+  case 239: /* delay: '(' T_NUMBER ',' T_NUMBER ',' T_NUMBER ')'  */
+#line 1175 "parse.y"
+                { (yyval.cdelay) = new vvp_delay_t((yyvsp[-5].numb), (yyvsp[-3].numb), (yyvsp[-1].numb)); }
+#line 3477 "parse.cc"
+    break;
+
+
+#line 3481 "parse.cc"
+
+      default: break;
+    }
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
+
+  YYPOPSTACK (yylen);
+  yylen = 0;
+
+  *++yyvsp = yyval;
+
+  /* Now 'shift' the result of the reduction.  Determine what state
+     that goes to, based on the state we popped back to and the rule
+     number reduced by.  */
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
+
+  goto yynewstate;
+
+
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
+yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
+  /* If not already recovering from an error, report this error.  */
+  if (!yyerrstatus)
+    {
+      ++yynerrs;
+      yyerror (YY_("syntax error"));
+    }
+
+  if (yyerrstatus == 3)
+    {
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
+
+      if (yychar <= YYEOF)
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
+      else
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval);
+          yychar = YYEMPTY;
+        }
+    }
+
+  /* Else will try to reuse lookahead token after shifting the error
+     token.  */
+  goto yyerrlab1;
+
+
+/*---------------------------------------------------.
+| yyerrorlab -- error raised explicitly by YYERROR.  |
+`---------------------------------------------------*/
+yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
+
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYERROR.  */
+  YYPOPSTACK (yylen);
+  yylen = 0;
+  YY_STACK_PRINT (yyss, yyssp);
+  yystate = *yyssp;
+  goto yyerrlab1;
+
+
+/*-------------------------------------------------------------.
+| yyerrlab1 -- common code for both syntax error and YYERROR.  |
+`-------------------------------------------------------------*/
+yyerrlab1:
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
+
+  /* Pop stack until we find a state that shifts the error token.  */
+  for (;;)
+    {
+      yyn = yypact[yystate];
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
+
+      /* Pop the current state because it cannot handle the error token.  */
+      if (yyssp == yyss)
+        YYABORT;
+
+
+      yydestruct ("Error: popping",
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
+      YYPOPSTACK (1);
+      yystate = *yyssp;
+      YY_STACK_PRINT (yyss, yyssp);
+    }
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+
+  /* Shift the error token.  */
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
+
+  yystate = yyn;
+  goto yynewstate;
+
+
+/*-------------------------------------.
+| yyacceptlab -- YYACCEPT comes here.  |
+`-------------------------------------*/
+yyacceptlab:
+  yyresult = 0;
+  goto yyreturnlab;
+
+
+/*-----------------------------------.
+| yyabortlab -- YYABORT comes here.  |
+`-----------------------------------*/
+yyabortlab:
+  yyresult = 1;
+  goto yyreturnlab;
+
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
+yyexhaustedlab:
+  yyerror (YY_("memory exhausted"));
+  yyresult = 2;
+  goto yyreturnlab;
+
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != YYEMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYABORT or YYACCEPT.  */
+  YYPOPSTACK (yylen);
+  YY_STACK_PRINT (yyss, yyssp);
+  while (yyssp != yyss)
+    {
+      yydestruct ("Cleanup: popping",
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
+      YYPOPSTACK (1);
+    }
+#ifndef yyoverflow
+  if (yyss != yyssa)
+    YYSTACK_FREE (yyss);
+#endif
+
+  return yyresult;
+}
+
+#line 1178 "parse.y"
+
+
+int compile_design(const char*path)
+{
+      yypath = path;
+      yyline = 1;
+
+	/* Prefer to scan the design image in place. */
+      if (lexor_map_input(path) >= 0) {
+	    int rc = yyparse();
+	    lexor_unmap_input();
+	    return rc;
+      }
+
+      yyin = fopen(path, "r");
+      if (yyin == 0) {
+	    fprintf(stderr, "%s: Unable to open input file.\n", path);
+	    return -1;
+      }
+
+      int rc = yyparse();
+      fclose(yyin);
+      return rc;
+}
@@ -0,0 +1,246 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison interface for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+#ifndef YY_YY_PARSE_HH_INCLUDED
+# define YY_YY_PARSE_HH_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 1
+#endif
+#if YYDEBUG
+extern int yydebug;
+#endif
+
+/* Token kinds.  */
+#ifndef YYTOKENTYPE
+# define YYTOKENTYPE
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    K_A = 258,                     /* K_A  */
+    K_ALIAS = 259,                 /* K_ALIAS  */
+    K_ALIAS_R = 260,               /* K_ALIAS_R  */
+    K_APV = 261,                   /* K_APV  */
+    K_ARITH_ABS = 262,             /* K_ARITH_ABS  */
+    K_ARITH_DIV = 263,             /* K_ARITH_DIV  */
+    K_ARITH_DIV_R = 264,           /* K_ARITH_DIV_R  */
+    K_ARITH_DIV_S = 265,           /* K_ARITH_DIV_S  */
+    K_ARITH_MOD = 266,             /* K_ARITH_MOD  */
+    K_ARITH_MOD_R = 267,           /* K_ARITH_MOD_R  */
+    K_ARITH_MOD_S = 268,           /* K_ARITH_MOD_S  */
+    K_ARITH_MULT = 269,            /* K_ARITH_MULT  */
+    K_ARITH_MULT_R = 270,          /* K_ARITH_MULT_R  */
+    K_ARITH_SUB = 271,             /* K_ARITH_SUB  */
+    K_ARITH_SUB_R = 272,           /* K_ARITH_SUB_R  */
+    K_ARITH_SUM = 273,             /* K_ARITH_SUM  */
+    K_ARITH_SUM_R = 274,           /* K_ARITH_SUM_R  */
+    K_ARITH_POW = 275,             /* K_ARITH_POW  */
+    K_ARITH_POW_R = 276,           /* K_ARITH_POW_R  */
+    K_ARITH_POW_S = 277,           /* K_ARITH_POW_S  */
+    K_ARRAY = 278,                 /* K_ARRAY  */
+    K_ARRAY_2U = 279,              /* K_ARRAY_2U  */
+    K_ARRAY_2S = 280,              /* K_ARRAY_2S  */
+    K_ARRAY_I = 281,               /* K_ARRAY_I  */
+    K_ARRAY_R = 282,               /* K_ARRAY_R  */
+    K_ARRAY_S = 283,               /* K_ARRAY_S  */
+    K_ARRAY_STR = 284,             /* K_ARRAY_STR  */
+    K_ARRAY_PORT = 285,            /* K_ARRAY_PORT  */
+    K_CAST_INT = 286,              /* K_CAST_INT  */
+    K_CAST_REAL = 287,             /* K_CAST_REAL  */
+    K_CAST_REAL_S = 288,           /* K_CAST_REAL_S  */
+    K_CAST_2 = 289,                /* K_CAST_2  */
+    K_CLASS = 290,                 /* K_CLASS  */
+    K_CMP_EEQ = 291,               /* K_CMP_EEQ  */
+    K_CMP_EQ = 292,                /* K_CMP_EQ  */
+    K_CMP_EQ_R = 293,              /* K_CMP_EQ_R  */
+    K_CMP_NEE = 294,               /* K_CMP_NEE  */
+    K_CMP_NE = 295,                /* K_CMP_NE  */
+    K_CMP_NE_R = 296,              /* K_CMP_NE_R  */
+    K_CMP_GE = 297,                /* K_CMP_GE  */
+    K_CMP_GE_R = 298,              /* K_CMP_GE_R  */
+    K_CMP_GE_S = 299,              /* K_CMP_GE_S  */
+    K_CMP_GT = 300,                /* K_CMP_GT  */
+    K_CMP_GT_R = 301,              /* K_CMP_GT_R  */
+    K_CMP_GT_S = 302,              /* K_CMP_GT_S  */
+    K_CONCAT = 303,                /* K_CONCAT  */
+    K_CONCAT8 = 304,               /* K_CONCAT8  */
+    K_DEBUG = 305,                 /* K_DEBUG  */
+    K_DELAY = 306,                 /* K_DELAY  */
+    K_DFF = 307,                   /* K_DFF  */
+    K_ENUM2 = 308,                 /* K_ENUM2  */
+    K_ENUM2_S = 309,               /* K_ENUM2_S  */
+    K_ENUM4 = 310,                 /* K_ENUM4  */
+    K_ENUM4_S = 311,               /* K_ENUM4_S  */
+    K_EVENT = 312,                 /* K_EVENT  */
+    K_EVENT_OR = 313,              /* K_EVENT_OR  */
+    K_EXPORT = 314,                /* K_EXPORT  */
+    K_EXTEND_S = 315,              /* K_EXTEND_S  */
+    K_FUNCTOR = 316,               /* K_FUNCTOR  */
+    K_IMPORT = 317,                /* K_IMPORT  */
+    K_ISLAND = 318,                /* K_ISLAND  */
+    K_MODPATH = 319,               /* K_MODPATH  */
+    K_NET = 320,                   /* K_NET  */
+    K_NET_S = 321,                 /* K_NET_S  */
+    K_NET_R = 322,                 /* K_NET_R  */
+    K_NET_2S = 323,                /* K_NET_2S  */
+    K_NET_2U = 324,                /* K_NET_2U  */
+    K_NET8 = 325,                  /* K_NET8  */
+    K_NET8_2S = 326,               /* K_NET8_2S  */
+    K_NET8_2U = 327,               /* K_NET8_2U  */
+    K_NET8_S = 328,                /* K_NET8_S  */
+    K_PARAM_STR = 329,             /* K_PARAM_STR  */
+    K_PARAM_L = 330,               /* K_PARAM_L  */
+    K_PARAM_REAL = 331,            /* K_PARAM_REAL  */
+    K_PART = 332,                  /* K_PART  */
+    K_PART_PV = 333,               /* K_PART_PV  */
+    K_PART_V = 334,                /* K_PART_V  */
+    K_PART_V_S = 335,              /* K_PART_V_S  */
+    K_PORT = 336,                  /* K_PORT  */
+    K_PORT_INFO = 337,             /* K_PORT_INFO  */
+    K_PV = 338,                    /* K_PV  */
+    K_REDUCE_AND = 339,            /* K_REDUCE_AND  */
+    K_REDUCE_OR = 340,             /* K_REDUCE_OR  */
+    K_REDUCE_XOR = 341,            /* K_REDUCE_XOR  */
+    K_REDUCE_NAND = 342,           /* K_REDUCE_NAND  */
+    K_REDUCE_NOR = 343,            /* K_REDUCE_NOR  */
+    K_REDUCE_XNOR = 344,           /* K_REDUCE_XNOR  */
+    K_REPEAT = 345,                /* K_REPEAT  */
+    K_RESOLV = 346,                /* K_RESOLV  */
+    K_SCOPE = 347,                 /* K_SCOPE  */
+    K_SFUNC = 348,                 /* K_SFUNC  */
+    K_SFUNC_E = 349,               /* K_SFUNC_E  */
+    K_SFUNC_M = 350,               /* K_SFUNC_M  */
+    K_SHIFTL = 351,                /* K_SHIFTL  */
+    K_SHIFTR = 352,                /* K_SHIFTR  */
+    K_SHIFTRS = 353,               /* K_SHIFTRS  */
+    K_THREAD = 354,                /* K_THREAD  */
+    K_TIMESCALE = 355,             /* K_TIMESCALE  */
+    K_TRAN = 356,                  /* K_TRAN  */
+    K_TRANIF0 = 357,               /* K_TRANIF0  */
+    K_TRANIF1 = 358,               /* K_TRANIF1  */
+    K_TRANVP = 359,                /* K_TRANVP  */
+    K_UFUNC = 360,                 /* K_UFUNC  */
+    K_UFUNC_E = 361,               /* K_UFUNC_E  */
+    K_UDP = 362,                   /* K_UDP  */
+    K_UDP_C = 363,                 /* K_UDP_C  */
+    K_UDP_S = 364,                 /* K_UDP_S  */
+    K_VAR = 365,                   /* K_VAR  */
+    K_VAR_COBJECT = 366,           /* K_VAR_COBJECT  */
+    K_VAR_DARRAY = 367,            /* K_VAR_DARRAY  */
+    K_VAR_S = 368,                 /* K_VAR_S  */
+    K_VAR_STR = 369,               /* K_VAR_STR  */
+    K_VAR_I = 370,                 /* K_VAR_I  */
+    K_VAR_R = 371,                 /* K_VAR_R  */
+    K_VAR_2S = 372,                /* K_VAR_2S  */
+    K_VAR_2U = 373,                /* K_VAR_2U  */
+    K_vpi_call = 374,              /* K_vpi_call  */
+    K_vpi_call_w = 375,            /* K_vpi_call_w  */
+    K_vpi_call_i = 376,            /* K_vpi_call_i  */
+    K_vpi_func = 377,              /* K_vpi_func  */
+    K_vpi_func_r = 378,            /* K_vpi_func_r  */
+    K_disable = 379,               /* K_disable  */
+    K_fork = 380,                  /* K_fork  */
+    K_ivl_version = 381,           /* K_ivl_version  */
+    K_ivl_delay_selection = 382,   /* K_ivl_delay_selection  */
+    K_vpi_module = 383,            /* K_vpi_module  */
+    K_vpi_time_precision = 384,    /* K_vpi_time_precision  */
+    K_file_names = 385,            /* K_file_names  */
+    K_file_line = 386,             /* K_file_line  */
+    K_PORT_INPUT = 387,            /* K_PORT_INPUT  */
+    K_PORT_OUTPUT = 388,           /* K_PORT_OUTPUT  */
+    K_PORT_INOUT = 389,            /* K_PORT_INOUT  */
+    K_PORT_MIXED = 390,            /* K_PORT_MIXED  */
+    K_PORT_NODIR = 391,            /* K_PORT_NODIR  */
+    T_INSTR = 392,                 /* T_INSTR  */
+    T_LABEL = 393,                 /* T_LABEL  */
+    T_NUMBER = 394,                /* T_NUMBER  */
+    T_STRING = 395,                /* T_STRING  */
+    T_SYMBOL = 396,                /* T_SYMBOL  */
+    T_VECTOR = 397                 /* T_VECTOR  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
+#endif
+
+/* Value type.  */
+#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
+union YYSTYPE
+{
+#line 49 "parse.y"
+
+      char*text;
+      char **table;
+      uint64_t numb;
+      bool flag;
+
+      comp_operands_t opa;
+
+      struct symb_s  symb;
+      struct symbv_s symbv;
+
+      struct numbv_s numbv;
+
+      struct enum_name_s enum_name;
+      std::list<struct enum_name_s>*enum_namev;
+
+      struct symb_s vect;
+
+      struct argv_s argv;
+      vpiHandle vpi;
+
+      vvp_delay_t*cdelay;
+
+      int      vpi_enum;
+
+#line 232 "parse.hh"
+
+};
+typedef union YYSTYPE YYSTYPE;
+# define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
+#endif
+
+
+extern YYSTYPE yylval;
+
+
+int yyparse (void);
+
+
+#endif /* !YY_YY_PARSE_HH_INCLUDED  */
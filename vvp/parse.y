@@ -90,7 +90,8 @@ static struct __vpiModPath*modpath_dst = 0;
 %token K_PARAM_STR K_PARAM_L K_PARAM_REAL K_PART K_PART_PV
 %token K_PART_V K_PART_V_S K_PORT K_PORT_INFO K_PV K_REDUCE_AND K_REDUCE_OR K_REDUCE_XOR
 %token K_REDUCE_NAND K_REDUCE_NOR K_REDUCE_XNOR K_REPEAT
-%token K_RESOLV K_SCOPE K_SFUNC K_SFUNC_E K_SHIFTL K_SHIFTR K_SHIFTRS
+%token K_RESOLV K_SCOPE K_SFUNC K_SFUNC_E K_SFUNC_M
+%token K_SHIFTL K_SHIFTR K_SHIFTRS
 %token K_THREAD K_TIMESCALE K_TRAN K_TRANIF0 K_TRANIF1 K_TRANVP
 %token K_UFUNC K_UFUNC_E K_UDP K_UDP_C K_UDP_S
 %token K_VAR K_VAR_COBJECT K_VAR_DARRAY
@@ -516,20 +517,25 @@ statement
   /* System function call */
         | T_LABEL K_SFUNC T_NUMBER T_NUMBER T_STRING ','
           T_STRING ',' symbols ';'
-                { compile_sfunc($1, $5, $7, $3, $4, $9.cnt, $9.vect, 0); }
+                { compile_sfunc($1, $5, $7, $3, $4, $9.cnt, $9.vect, 0, false); }
 
         | T_LABEL K_SFUNC_E T_NUMBER T_NUMBER T_STRING ',' T_SYMBOL ','
           T_STRING ',' symbols ';'
-                { compile_sfunc($1, $5, $9, $3, $4, $11.cnt, $11.vect, $7); }
+                { compile_sfunc($1, $5, $9, $3, $4, $11.cnt, $11.vect, $7, false); }
+
+  /* System function call - memoized results (pure function) */
+        | T_LABEL K_SFUNC_M T_NUMBER T_NUMBER T_STRING ','
+          T_STRING ',' symbols ';'
+                { compile_sfunc($1, $5, $7, $3, $4, $9.cnt, $9.vect, 0, true); }
 
   /* System function call - no arguments */
         | T_LABEL K_SFUNC T_NUMBER T_NUMBER T_STRING ','
           T_STRING ';'
-                { compile_sfunc($1, $5, $7, $3, $4, 0, 0, 0); }
+                { compile_sfunc($1, $5, $7, $3, $4, 0, 0, 0, false); }
 
         | T_LABEL K_SFUNC_E T_NUMBER T_NUMBER T_STRING ',' T_SYMBOL ','
           T_STRING ';'
-                { compile_sfunc($1, $5, $9, $3, $4, 0, 0, $7); }
+                { compile_sfunc($1, $5, $9, $3, $4, 0, 0, $7, false); }
 
   /* Shift nodes. */
 
@@ -1015,7 +1021,7 @@ argument
   : T_STRING
       { $$ = vpip_make_string_const($1); }
   | T_VECTOR
-      { $$ = vpip_make_binary_const($1.idx, $1.text);
+      { $$ = vpip_make_binary_const($1.idx, $1.text, true);
 	free($1.text);
       }
   | symbol_access
@@ -1175,6 +1181,14 @@ int compile_design(const char*path)
 {
       yypath = path;
       yyline = 1;
+
+	/* Prefer to scan the design image in place. */
+      if (lexor_map_input(path) >= 0) {
+	    int rc = yyparse();
+	    lexor_unmap_input();
+	    return rc;
+      }
+
       yyin = fopen(path, "r");
       if (yyin == 0) {
 	    fprintf(stderr, "%s: Unable to open input file.\n", path);
@@ -34,13 +34,18 @@ void yyerror(const char*msg)
 void symbv_init(struct symbv_s*obj)
 {
       obj->cnt = 0;
+      obj->cap = 0;
       obj->vect = 0;
 }
 
 void symbv_add(struct symbv_s*obj, struct symb_s item)
 {
-      obj->vect = (struct symb_s*)
-	    realloc(obj->vect, (obj->cnt+1) * sizeof(struct symb_s));
+      if (obj->cnt == obj->cap) {
+	      /* Most vectors are functor inputs, which have 4. */
+	    obj->cap = obj->cap? 2*obj->cap : 4;
+	    obj->vect = (struct symb_s*)
+		  realloc(obj->vect, obj->cap * sizeof(struct symb_s));
+      }
       obj->vect[obj->cnt] = item;
       obj->cnt += 1;
 }
@@ -48,12 +53,16 @@ void symbv_add(struct symbv_s*obj, struct symb_s item)
 void numbv_init(struct numbv_s*obj)
 {
       obj->cnt = 0;
+      obj->cap = 0;
       obj->nvec = 0;
 }
 
 void numbv_add(struct numbv_s*obj, long item)
 {
-      obj->nvec = (long*) realloc(obj->nvec, (obj->cnt+1) * sizeof(long));
+      if (obj->cnt == obj->cap) {
+	    obj->cap = obj->cap? 2*obj->cap : 4;
+	    obj->nvec = (long*) realloc(obj->nvec, obj->cap * sizeof(long));
+      }
       obj->nvec[obj->cnt] = item;
       obj->cnt += 1;
 }
@@ -63,19 +72,29 @@ void numbv_clear(struct numbv_s*obj)
       free(obj->nvec);
       obj->nvec = 0;
       obj->cnt = 0;
+      obj->cap = 0;
 }
 
 void argv_init(struct argv_s*obj)
 {
       obj->argc = 0;
+      obj->cap = 0;
       obj->argv = 0;
       obj->syms = 0;
 }
 
 void argv_add(struct argv_s*obj, vpiHandle item)
 {
-      obj->argv = (vpiHandle*)
-	    realloc(obj->argv, (obj->argc+1)*sizeof(vpiHandle));
+      if (obj->argc == obj->cap) {
+	    obj->cap = obj->cap? 2*obj->cap : 4;
+	    obj->argv = (vpiHandle*)
+		  realloc(obj->argv, obj->cap * sizeof(vpiHandle));
+	      /* The syms array, once present, shadows argv entry for
+		 entry, so keep it grown in step. */
+	    if (obj->syms)
+		  obj->syms = (char**)
+			realloc(obj->syms, obj->cap * sizeof(char*));
+      }
       obj->argv[obj->argc] = item;
       obj->argc += 1;
 }
@@ -83,8 +102,8 @@ void argv_add(struct argv_s*obj, vpiHandle item)
 void argv_sym_add(struct argv_s*obj, char *item)
 {
       argv_add(obj, 0x0);
-      obj->syms = (char**)
-	    realloc(obj->syms, (obj->argc)*sizeof(char*));
+      if (obj->syms == 0)
+	    obj->syms = (char**) malloc(obj->cap * sizeof(char*));
       obj->syms[obj->argc-1] = item;
 }
 
@@ -46,6 +46,15 @@ extern void yyerror(const char*msg);
 
 extern void destroy_lexor();
 
+/*
+ * Try to map the input file into memory and hand the image directly
+ * to the lexor, so that the compiler scans the design in place
+ * instead of copying it through stdio buffers. Returns -1 if the
+ * mapping is not possible (then fall back to yyin).
+ */
+extern int lexor_map_input(const char*path);
+extern void lexor_unmap_input(void);
+
 /*
  * This is the path of the current source file.
  */
@@ -57,8 +66,18 @@ struct symb_s {
       unsigned idx;
 };
 
+/*
+ * The parser collects statement operands into these little vectors
+ * before handing them to the compile_* functions. They grow by
+ * doubling (the cap member is the allocated count) so that a
+ * statement with many operands does not realloc per operand. The
+ * consumer owns the vect/nvec/argv array and releases it with free(),
+ * or keeps it for the life of the simulation; either way the cap
+ * member is dead once the statement is reduced.
+ */
 struct symbv_s {
       unsigned cnt;
+      unsigned cap;
       struct symb_s*vect;
 };
 
@@ -67,6 +86,7 @@ extern void symbv_add(struct symbv_s*obj, struct symb_s item);
 
 struct numbv_s {
       unsigned cnt;
+      unsigned cap;
       long*nvec;
 };
 
@@ -82,6 +102,7 @@ extern void numbv_clear(struct numbv_s*obj);
 
 struct argv_s {
       unsigned  argc;
+      unsigned  cap;
       vpiHandle*argv;
       char    **syms;
 };
@@ -33,6 +33,26 @@ struct vvp_fun_part_state_s {
       double bitsr;
 };
 
+/*
+ * Extract the selected part of the input vector. This uses the word
+ * based subvalue constructor when the select is completely within the
+ * source, which is the usual case, and pads with X bits when the
+ * select hangs off the end. A part that fits in a single machine word
+ * is held in the value word of the vector, so extracting a byte lane
+ * from a wide bus does not touch the heap at all.
+ */
+static vvp_vector4_t part_from_input(const vvp_vector4_t&bit,
+				     unsigned base, unsigned wid)
+{
+      if (base + wid <= bit.size())
+	    return vvp_vector4_t(bit, base, wid);
+
+      vvp_vector4_t tmp (wid, BIT4_X);
+      if (base < bit.size())
+	    tmp.set_vec(0, bit.subvalue(base, bit.size()-base));
+      return tmp;
+}
+
 vvp_fun_part::vvp_fun_part(unsigned base, unsigned wid)
 : base_(base), wid_(wid)
 {
@@ -57,15 +77,16 @@ void vvp_fun_part_sa::recv_vec4(vvp_net_ptr_t port, const vvp_vector4_t&bit,
 {
       assert(port.port() == 0);
 
-      vvp_vector4_t tmp (wid_, BIT4_X);
-      for (unsigned idx = 0 ;  idx < wid_ ;  idx += 1) {
-	    if (idx + base_ < bit.size())
-		  tmp.set_bit(idx, bit.value(base_+idx));
-      }
+      vvp_vector4_t tmp = part_from_input(bit, base_, wid_);
       if (val_ .eeq( tmp ))
 	    return;
 
-      val_ = tmp;
+	/* Copy the bits in place when the value is already the right
+	   size, to save reallocating the bit planes. */
+      if (val_.size() == tmp.size())
+	    val_.copy_bits(tmp);
+      else
+	    val_ = tmp;
 
       if (net_ == 0) {
 	    net_ = port.ptr();
@@ -73,6 +94,23 @@ void vvp_fun_part_sa::recv_vec4(vvp_net_ptr_t port, const vvp_vector4_t&bit,
       }
 }
 
+/*
+ * The change window from the driving signal bounds the bits that
+ * differ from the previous propagation. When the select window lies
+ * entirely outside of it, the extracted part cannot have changed, so
+ * skip the extract-and-compare altogether. The val_ size test keeps
+ * the very first delivery on the full path.
+ */
+void vvp_fun_part_sa::recv_vec4_window(vvp_net_ptr_t port, const vvp_vector4_t&bit,
+				       unsigned lo, unsigned hi,
+				       vvp_context_t ctx)
+{
+      if (val_.size() == wid_ && (hi <= base_ || lo >= base_ + wid_))
+	    return;
+
+      recv_vec4(port, bit, ctx);
+}
+
 /*
  * Handle the case that the part select node is actually fed by a part
  * select assignment. It's not exactly clear what might make this
@@ -140,13 +178,12 @@ void vvp_fun_part_aa::recv_vec4(vvp_net_ptr_t port, const vvp_vector4_t&bit,
             vvp_vector4_t*val = static_cast<vvp_vector4_t*>
                   (vvp_get_context_item(context, context_idx_));
 
-            vvp_vector4_t tmp (wid_, BIT4_X);
-            for (unsigned idx = 0 ;  idx < wid_ ;  idx += 1) {
-                  if (idx + base_ < bit.size())
-                        tmp.set_bit(idx, bit.value(base_+idx));
-            }
+            vvp_vector4_t tmp = part_from_input(bit, base_, wid_);
             if (!val->eeq( tmp )) {
-                  *val = tmp;
+                  if (val->size() == tmp.size())
+                        val->copy_bits(tmp);
+                  else
+                        *val = tmp;
                   port.ptr()->send_vec4(tmp, context);
             }
       } else {
@@ -158,6 +195,32 @@ void vvp_fun_part_aa::recv_vec4(vvp_net_ptr_t port, const vvp_vector4_t&bit,
       }
 }
 
+/*
+ * As for the static version, skip values whose change window misses
+ * the select window. The check is per context, since each context
+ * tracks its own previous extraction.
+ */
+void vvp_fun_part_aa::recv_vec4_window(vvp_net_ptr_t port, const vvp_vector4_t&bit,
+				       unsigned lo, unsigned hi,
+				       vvp_context_t context)
+{
+      if (context) {
+            vvp_vector4_t*val = static_cast<vvp_vector4_t*>
+                  (vvp_get_context_item(context, context_idx_));
+
+            if (val->size() == wid_ && (hi <= base_ || lo >= base_ + wid_))
+                  return;
+
+            recv_vec4(port, bit, context);
+      } else {
+            context = context_scope_->live_contexts;
+            while (context) {
+                  recv_vec4_window(port, bit, lo, hi, context);
+                  context = vvp_get_next_context(context);
+            }
+      }
+}
+
 /*
  * Handle the case that the part select node is actually fed by a part
  * select assignment. It's not exactly clear what might make this
@@ -52,6 +52,10 @@ class vvp_fun_part_sa  : public vvp_fun_part, public vvp_gen_event_s {
       void recv_vec4(vvp_net_ptr_t port, const vvp_vector4_t&bit,
                      vvp_context_t);
 
+      void recv_vec4_window(vvp_net_ptr_t port, const vvp_vector4_t&bit,
+			    unsigned lo, unsigned hi,
+			    vvp_context_t);
+
       void recv_vec4_pv(vvp_net_ptr_t port, const vvp_vector4_t&bit,
 			unsigned, unsigned, unsigned,
                         vvp_context_t);
@@ -83,6 +87,10 @@ class vvp_fun_part_aa  : public vvp_fun_part, public automatic_hooks_s {
       void recv_vec4(vvp_net_ptr_t port, const vvp_vector4_t&bit,
                      vvp_context_t context);
 
+      void recv_vec4_window(vvp_net_ptr_t port, const vvp_vector4_t&bit,
+			    unsigned lo, unsigned hi,
+			    vvp_context_t context);
+
       void recv_vec4_pv(vvp_net_ptr_t port, const vvp_vector4_t&bit,
 			unsigned, unsigned, unsigned,
                         vvp_context_t context);
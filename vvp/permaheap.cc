@@ -19,6 +19,49 @@
 
 # include  "permaheap.h"
 # include  <cassert>
+# include  <cstdlib>
+#if defined(__linux__)
+# include  <sys/mman.h>
+#endif
+
+static size_t arena_total_ = 0;
+static size_t arena_huge_ = 0;
+
+/*
+ * Grab a chunk of backing store for one of the never-freed arenas.
+ * Chunks big enough to span a huge page are aligned to the huge page
+ * size and advised to the kernel, so that transparent huge pages can
+ * back them where the host supports it. If the aligned allocation
+ * fails for any reason, fall back to the plain heap; the chunk is
+ * then merely unaligned, not lost.
+ */
+void* arena_chunk_alloc(size_t size)
+{
+      arena_total_ += size;
+
+#if defined(MADV_HUGEPAGE)
+      if (size >= ARENA_HUGE_CHUNK) {
+	    void*res = 0;
+	    if (posix_memalign(&res, ARENA_HUGE_CHUNK, size) == 0) {
+		  madvise(res, size, MADV_HUGEPAGE);
+		  arena_huge_ += size;
+		  return res;
+	    }
+      }
+#endif
+
+      return ::new char[size];
+}
+
+size_t arena_chunk_total(void)
+{
+      return arena_total_;
+}
+
+size_t arena_chunk_huge(void)
+{
+      return arena_huge_;
+}
 
 permaheap::permaheap()
 {
@@ -36,7 +79,7 @@ void* permaheap::alloc(size_t size)
       assert(size <= CHUNK_SIZE);
 
       if (size > chunk_remaining_) {
-	    chunk_ptr_ = ::new char[CHUNK_SIZE];
+	    chunk_ptr_ = (char*) arena_chunk_alloc(CHUNK_SIZE);
 	    chunk_remaining_ = CHUNK_SIZE;
 	    heap_total_ += CHUNK_SIZE;
       }
@@ -37,7 +37,7 @@ class permaheap {
       size_t heap_total() const { return heap_total_; }
 
     private:
-      enum { INITIAL_CHUNK_SIZE = 512*1024, CHUNK_SIZE=256*1024 };
+      enum { INITIAL_CHUNK_SIZE = 512*1024, CHUNK_SIZE=2*1024*1024 };
 
       union {
 	    void*align;
@@ -49,4 +49,18 @@ class permaheap {
       size_t heap_total_;
 };
 
+/*
+ * Shared backing store for the never-freed arenas: the permaheap
+ * chunks, the vvp_net_t chunks and the code space. Chunks of at least
+ * ARENA_HUGE_CHUNK bytes are aligned to that boundary so that on
+ * hosts with transparent huge pages the kernel can back them with 2M
+ * pages, which cuts TLB misses when walking very large netlist
+ * images. The totals feed the -v report.
+ */
+static const size_t ARENA_HUGE_CHUNK = 2*1024*1024;
+
+extern void* arena_chunk_alloc(size_t size);
+extern size_t arena_chunk_total(void);
+extern size_t arena_chunk_huge(void);
+
 #endif
@@ -41,13 +41,81 @@
 
 
 resolv_core::resolv_core(unsigned nports, vvp_net_t*net)
-: nports_(nports), net_(net)
+: nports_(nports), net_(net), drive_counts_(0), drive_width_(0)
 {
       count_functors_resolv += 1;
 }
 
 resolv_core::~resolv_core()
 {
+      delete[] drive_counts_;
+}
+
+/*
+ * The inverse of update_driver_counts, used to back out the
+ * contribution of a stale input value from the driver-count index.
+ */
+static void remove_driver_counts(vvp_bit4_t bit, unsigned counts[3])
+{
+      switch (bit) {
+          case BIT4_0:
+            counts[0] -= 1;
+            break;
+          case BIT4_1:
+            counts[1] -= 1;
+            break;
+          case BIT4_X:
+            counts[2] -= 1;
+            break;
+          default:
+            break;
+      }
+}
+
+void resolv_core::index_change_(const vvp_vector4_t&old_val,
+                                const vvp_vector4_t&new_val)
+{
+        // An input wider than the index shouldn't happen, but if it
+        // does, drop the index and let the next query rebuild it.
+      if (new_val.size() > drive_width_) {
+            delete[] drive_counts_;
+            drive_counts_ = 0;
+            drive_width_ = 0;
+            return;
+      }
+
+      for (unsigned idx = 0 ;  idx < drive_width_ ;  idx += 1) {
+            vvp_bit4_t obit = (idx < old_val.size())
+                                    ? old_val.value(idx) : BIT4_Z;
+            vvp_bit4_t nbit = (idx < new_val.size())
+                                    ? new_val.value(idx) : BIT4_Z;
+            if (obit == nbit)
+                  continue;
+            remove_driver_counts(obit, drive_counts_ + 3*idx);
+            update_driver_counts(nbit, drive_counts_ + 3*idx);
+      }
+}
+
+void resolv_core::index_change_(const vvp_vector8_t&old_val,
+                                const vvp_vector8_t&new_val)
+{
+      if (new_val.size() > drive_width_) {
+            delete[] drive_counts_;
+            drive_counts_ = 0;
+            drive_width_ = 0;
+            return;
+      }
+
+      for (unsigned idx = 0 ;  idx < drive_width_ ;  idx += 1) {
+            vvp_bit4_t obit = (idx < old_val.size())
+                                    ? old_val.value(idx).value() : BIT4_Z;
+            vvp_bit4_t nbit = (idx < new_val.size())
+                                    ? new_val.value(idx).value() : BIT4_Z;
+            if (obit == nbit)
+                  continue;
+            remove_driver_counts(obit, drive_counts_ + 3*idx);
+            update_driver_counts(nbit, drive_counts_ + 3*idx);
+      }
 }
 
 void resolv_core::recv_vec4_pv_(unsigned port, const vvp_vector4_t&bit,
@@ -133,39 +201,60 @@ void resolv_tri::recv_vec8_(unsigned port, const vvp_vector8_t&bit)
       if (val_[port].eeq(bit))
 	    return;
 
+      if (drive_counts_)
+	    index_change_(val_[port], bit);
+
       val_[port] = bit;
 
-        // Starting at the leaf level, work down the tree, resolving
-        // the changed values. base is the first node in the current
-        // level and span is the number of nodes at that level. ip
-        // is the first node in the group of four nodes at that level
-        // that include the node that has changed, and op is the node
-        // at the next level that stores the resolved value from that
-        // group.
       unsigned base = 0;
-      unsigned span = nports_;
-      while (span > 1) {
-            unsigned next_base = base + span;
-            unsigned ip = base + (port & ~0x3);
-            unsigned op = next_base + (port / 4);
-            unsigned ll = min(ip + 4, next_base);
 
-            vvp_vector8_t out = val_[ip];
-            for (ip = ip + 1; ip < ll; ip += 1) {
-                  if (val_[ip].size() == 0)
-                        continue;
-                  if (out.size() == 0)
-                        out = val_[ip];
-                  else
-                        out = resolve(out, val_[ip]);
-            }
-            if (val_[op].eeq(out))
+      if (nports_ == 2) {
+              // The overwhelming majority of resolved nets have
+              // exactly two drivers, so short-circuit the tree
+              // bookkeeping for that case.
+            vvp_vector8_t out = val_[0];
+            if (out.size() == 0)
+                  out = val_[1];
+            else if (val_[1].size() != 0)
+                  out = resolve(out, val_[1]);
+
+            if (val_[2].eeq(out))
                   return;
-            val_[op] = out;
-
-            base = next_base;
-            span = (span + 3) / 4;
-            port = port / 4;
+            val_[2] = out;
+            base = 2;
+
+      } else {
+              // Starting at the leaf level, work down the tree, resolving
+              // the changed values. base is the first node in the current
+              // level and span is the number of nodes at that level. ip
+              // is the first node in the group of four nodes at that level
+              // that include the node that has changed, and op is the node
+              // at the next level that stores the resolved value from that
+              // group.
+            unsigned span = nports_;
+            while (span > 1) {
+                  unsigned next_base = base + span;
+                  unsigned ip = base + (port & ~0x3);
+                  unsigned op = next_base + (port / 4);
+                  unsigned ll = min(ip + 4, next_base);
+
+                  vvp_vector8_t out = val_[ip];
+                  for (ip = ip + 1; ip < ll; ip += 1) {
+                        if (val_[ip].size() == 0)
+                              continue;
+                        if (out.size() == 0)
+                              out = val_[ip];
+                        else
+                              out = resolve(out, val_[ip]);
+                  }
+                  if (val_[op].eeq(out))
+                        return;
+                  val_[op] = out;
+
+                  base = next_base;
+                  span = (span + 3) / 4;
+                  port = port / 4;
+            }
       }
 
       if (! hiz_value_.is_hiz()) {
@@ -180,6 +269,33 @@ void resolv_tri::recv_vec8_(unsigned port, const vvp_vector8_t&bit)
 
 void resolv_tri::count_drivers(unsigned bit_idx, unsigned counts[3])
 {
+        // The first query builds the per-bit index. The recv methods
+        // keep it current, so later queries are a simple table read.
+      if (drive_counts_ == 0) {
+            unsigned wid = 0;
+            for (unsigned idx = 0 ; idx < nports_ ; idx += 1)
+                  wid = max(wid, val_[idx].size());
+            if (wid > 0) {
+                  drive_counts_ = new unsigned [3*wid];
+                  for (unsigned idx = 0 ; idx < 3*wid ; idx += 1)
+                        drive_counts_[idx] = 0;
+                  drive_width_ = wid;
+                  for (unsigned idx = 0 ; idx < nports_ ; idx += 1) {
+                        for (unsigned bit = 0 ; bit < val_[idx].size() ; bit += 1)
+                              update_driver_counts(val_[idx].value(bit).value(),
+                                                   drive_counts_ + 3*bit);
+                  }
+            }
+      }
+
+      if (bit_idx < drive_width_) {
+            counts[0] += drive_counts_[3*bit_idx+0];
+            counts[1] += drive_counts_[3*bit_idx+1];
+            counts[2] += drive_counts_[3*bit_idx+2];
+            return;
+      }
+
+        // Cold fallback for nets that have no index (yet).
       for (unsigned idx = 0 ; idx < nports_ ; idx += 1) {
 	    if (val_[idx].size() == 0)
 	          continue;
@@ -220,6 +336,9 @@ void resolv_wired_logic::recv_vec4_(unsigned port, const vvp_vector4_t&bit)
       if (val_[port].eeq(bit))
 	    return;
 
+      if (drive_counts_)
+	    index_change_(val_[port], bit);
+
       val_[port] = bit;
 
         // Starting at the leaf level, work down the tree, resolving
@@ -265,6 +384,33 @@ void resolv_wired_logic::recv_vec8_(unsigned port, const vvp_vector8_t&bit)
 
 void resolv_wired_logic::count_drivers(unsigned bit_idx, unsigned counts[3])
 {
+        // The first query builds the per-bit index. The recv methods
+        // keep it current, so later queries are a simple table read.
+      if (drive_counts_ == 0) {
+            unsigned wid = 0;
+            for (unsigned idx = 0 ; idx < nports_ ; idx += 1)
+                  wid = max(wid, val_[idx].size());
+            if (wid > 0) {
+                  drive_counts_ = new unsigned [3*wid];
+                  for (unsigned idx = 0 ; idx < 3*wid ; idx += 1)
+                        drive_counts_[idx] = 0;
+                  drive_width_ = wid;
+                  for (unsigned idx = 0 ; idx < nports_ ; idx += 1) {
+                        for (unsigned bit = 0 ; bit < val_[idx].size() ; bit += 1)
+                              update_driver_counts(val_[idx].value(bit),
+                                                   drive_counts_ + 3*bit);
+                  }
+            }
+      }
+
+      if (bit_idx < drive_width_) {
+            counts[0] += drive_counts_[3*bit_idx+0];
+            counts[1] += drive_counts_[3*bit_idx+1];
+            counts[2] += drive_counts_[3*bit_idx+2];
+            return;
+      }
+
+        // Cold fallback for nets that have no index (yet).
       for (unsigned idx = 0 ; idx < nports_ ; idx += 1) {
 	    if (val_[idx].size() == 0)
 	          continue;
@@ -64,9 +64,22 @@ class resolv_core : public vvp_net_fun_t {
       void recv_vec8_pv_(unsigned port, const vvp_vector8_t&bit,
 			 unsigned base, unsigned wid, unsigned vwid);
 
+    protected:
+	// The driver-count index is built by the first count_drivers
+	// query and kept current by the recv methods, so that repeated
+	// $countdrivers calls do not need to rescan the input values.
+      void index_change_(const vvp_vector4_t&old_val,
+                         const vvp_vector4_t&new_val);
+      void index_change_(const vvp_vector8_t&old_val,
+                         const vvp_vector8_t&new_val);
+
     protected:
       unsigned nports_;
       vvp_net_t*net_;
+	// Lazily-built driver-count index (3 counters per bit), or
+	// nil if no $countdrivers query has been made on this net.
+      unsigned*drive_counts_;
+      unsigned drive_width_;
 };
 
 class resolv_extend : public vvp_net_fun_t {
@@ -19,13 +19,17 @@
 
 # include  "schedule.h"
 # include  "vthread.h"
+# include  "vvp_net_sig.h"
 # include  "vpi_priv.h"
 # include  "slab.h"
 # include  "compile.h"
+# include  <map>
 # include  <new>
 # include  <typeinfo>
 # include  <csignal>
 # include  <cstdlib>
+# include  <cstdio>
+# include  <stdint.h>
 # include  <cassert>
 
 # include  <iostream>
@@ -72,8 +76,10 @@ struct event_time_s {
 	    start = 0;
 	    active = 0;
 	    nbassign = 0;
-	    rwsync = 0;
-	    rosync = 0;
+	    for (int idx = 0 ;  idx < SYNC_PRIO_N ;  idx += 1) {
+		  rwsync[idx] = 0;
+		  rosync[idx] = 0;
+	    }
 	    del_thr = 0;
 	    next = NULL;
       }
@@ -82,8 +88,12 @@ struct event_time_s {
       struct event_s*start;
       struct event_s*active;
       struct event_s*nbassign;
-      struct event_s*rwsync;
-      struct event_s*rosync;
+	/* The read-sync phases are split into priority buckets, so
+	   that cheap checks (that often cancel the rest of the phase)
+	   can be ordered before expensive formatting. Events within a
+	   bucket keep their FIFO order. */
+      struct event_s*rwsync[SYNC_PRIO_N];
+      struct event_s*rosync[SYNC_PRIO_N];
       struct event_s*del_thr;
 
       struct event_time_s*next;
@@ -455,6 +465,49 @@ void generic_event_s::operator delete(void*ptr)
 
 unsigned long count_gen_pool(void) { return generic_event_heap.pool; }
 
+/*
+ * A periodic toggle event stands in for a free-running clock thread
+ * ("always #5 clk = ~clk;") that compile_thread recognized at load
+ * time. Each run inverts the signal and reschedules itself one period
+ * later, without any thread machinery. When the scheduler finds that
+ * the only pending work for a stretch of time steps is unobserved
+ * toggles, it advances them arithmetically instead of edge by edge.
+ */
+struct periodic_toggle_event_s : public event_s {
+      vvp_net_t*net;
+      vvp_time64_t period;
+      void run_run(void);
+      void single_step_display(void);
+
+      static void* operator new(size_t);
+      static void operator delete(void*);
+};
+
+static const size_t PERIODIC_CHUNK_COUNT = 8192 / sizeof(struct periodic_toggle_event_s);
+static slab_t<sizeof(periodic_toggle_event_s),PERIODIC_CHUNK_COUNT> periodic_event_heap;
+
+inline void* periodic_toggle_event_s::operator new(size_t size)
+{
+      assert(size == sizeof(periodic_toggle_event_s));
+      return periodic_event_heap.alloc_slab();
+}
+
+void periodic_toggle_event_s::operator delete(void*ptr)
+{
+      periodic_event_heap.free_slab(ptr);
+}
+
+void periodic_toggle_event_s::single_step_display(void)
+{
+      cerr << "periodic_toggle_event: Toggle clock"
+	   << " period=" << period << endl;
+}
+
+	/* The number of periodic toggles in the design. The scheduler
+	   main loop uses this to skip the fast-forward tests entirely
+	   for the common design that has no recognized clocks. */
+static unsigned periodic_toggle_count = 0;
+
 /*
 ** These event_time_s will be required a lot, at high frequency.
 ** Once allocated, we never free them, but stash them away for next time.
@@ -485,6 +538,16 @@ unsigned long count_time_pool(void) { return event_time_heap.pool; }
  */
 static struct event_time_s* sched_list = 0;
 
+/*
+ * The tail of the sched_list, and the sum of the delay fields of the
+ * whole list, which is the offset of the last time step from the
+ * current time. Far-future events (watchdogs, protocol timeouts) land
+ * at or past the tail, so keeping these makes that case O(1) instead
+ * of a walk of the entire list.
+ */
+static struct event_time_s* sched_list_tail = 0;
+static vvp_time64_t sched_tail_delay = 0;
+
 /*
  * This is a list of initialization events. The setup puts
  * initializations in this list so that they happen before the
@@ -502,13 +565,13 @@ static struct event_s* schedule_final_list = 0;
  * This flag is true until a VPI task or function finishes the
  * simulation.
  */
-static bool schedule_runnable = true;
-static bool schedule_stopped_flag  = false;
+bool schedule_runnable_flag = true;
+bool schedule_stopped_flag  = false;
 static bool schedule_single_step_flag = false;
 
 void schedule_finish(int)
 {
-      schedule_runnable = false;
+      schedule_runnable_flag = false;
 }
 
 void schedule_stop(int)
@@ -521,16 +584,6 @@ void schedule_single_step(int)
       schedule_single_step_flag = true;
 }
 
-bool schedule_finished(void)
-{
-      return !schedule_runnable;
-}
-
-bool schedule_stopped(void)
-{
-      return schedule_stopped_flag;
-}
-
 /*
  * These are the signal handling infrastructure. The SIGINT signal
  * leads to an implicit $stop.
@@ -587,9 +640,362 @@ static void schedule_final_event(struct event_s*cur)
 typedef enum event_queue_e { SEQ_START, SEQ_ACTIVE, SEQ_NBASSIGN,
 			     SEQ_RWSYNC, SEQ_ROSYNC, DEL_THREAD } event_queue_t;
 
+/*
+ * Optional event-queue statistics, enabled by setting the environment
+ * variable VVP_EVENT_STATS to an output path. This counts the events
+ * scheduled into each of the stratified queues, histograms the
+ * pending-event depth at every time-step boundary, and counts how
+ * many events each generic event source (delay nodes, islands, UDP
+ * cores and the like) schedules, so that pathological event churn can
+ * be traced to the devices causing it. The cost is a flag test per
+ * event when disabled, and a few counter updates when enabled. The
+ * report is written when the process exits.
+ */
+static bool event_stats_flag = false;
+static const char*event_stats_path = 0;
+
+static unsigned long event_stats_sched_[6];
+static const char* const event_stats_queue_name_[6] = {
+      "start", "active", "nbassign", "rwsync", "rosync", "del_thread" };
+
+	/* Number of scheduled events not yet executed. This count is
+	   kept unconditionally (the cost is an increment next to an
+	   event allocation) so that the backlog can be reported to
+	   the design through $ivl_stats_backlog. The histogram of the
+	   depth (log2 buckets) is part of the event statistics and is
+	   sampled whenever the simulation time advances. */
+static unsigned long sched_event_depth_ = 0;
+static unsigned long event_stats_hist_[8*sizeof(unsigned long)];
+
+struct event_stats_src_s {
+      unsigned long count;
+      const char*type_name;
+};
+static std::map<vvp_gen_event_t, event_stats_src_s> event_stats_src_;
+
+static void event_stats_sample_depth_(void)
+{
+      unsigned bucket = 0;
+      for (unsigned long tmp = sched_event_depth_ ; tmp > 1 ; tmp >>= 1)
+	    bucket += 1;
+      event_stats_hist_[bucket] += 1;
+}
+
+static void event_stats_count_src_(vvp_gen_event_t obj)
+{
+      event_stats_src_s&cell = event_stats_src_[obj];
+      cell.count += 1;
+      if (cell.type_name == 0)
+	    cell.type_name = typeid(*obj).name();
+}
+
+static void event_stats_dump_(void)
+{
+      FILE*fd = fopen(event_stats_path, "w");
+      if (fd == 0)
+	    return;
+
+      fprintf(fd, "Scheduled events by queue:\n");
+      for (unsigned idx = 0 ;  idx < 6 ;  idx += 1)
+	    fprintf(fd, "%12lu %s\n", event_stats_sched_[idx],
+		    event_stats_queue_name_[idx]);
+
+      fprintf(fd, "\nPending-event depth at time-step boundaries:\n");
+      for (unsigned idx = 0 ;  idx < 8*sizeof(unsigned long) ;  idx += 1) {
+	    if (event_stats_hist_[idx] == 0)
+		  continue;
+	    fprintf(fd, "%12lu steps with %lu..%lu pending\n",
+		    event_stats_hist_[idx],
+		    idx? (1UL << idx) : 0, (1UL << (idx+1)) - 1);
+      }
+
+	/* Report the most active generic event sources. These are
+	   identified by address and implementation type; the count is
+	   how many events the object scheduled over the whole run. */
+      static const unsigned TOP_SRC_LIMIT = 20;
+      std::multimap<unsigned long, std::pair<vvp_gen_event_t,const char*> > sorted;
+      for (std::map<vvp_gen_event_t, event_stats_src_s>::iterator cur
+		 = event_stats_src_.begin()
+		 ; cur != event_stats_src_.end() ; ++ cur)
+	    sorted.insert(std::make_pair(cur->second.count,
+					 std::make_pair(cur->first,
+							cur->second.type_name)));
+
+      if (! sorted.empty())
+	    fprintf(fd, "\nTop generic event sources (%u of %u):\n",
+		    TOP_SRC_LIMIT < sorted.size()? TOP_SRC_LIMIT
+			  : (unsigned)sorted.size(),
+		    (unsigned)sorted.size());
+      unsigned emitted = 0;
+      for (std::multimap<unsigned long,
+		 std::pair<vvp_gen_event_t,const char*> >::reverse_iterator
+		 cur = sorted.rbegin()
+		 ; cur != sorted.rend() && emitted < TOP_SRC_LIMIT
+		 ; ++ cur, emitted += 1) {
+	    fprintf(fd, "%12lu %s (%p)\n", cur->first,
+		    cur->second.second, (void*)cur->second.first);
+      }
+
+      fclose(fd);
+}
+
+static void event_stats_init_(void)
+{
+      event_stats_path = getenv("VVP_EVENT_STATS");
+      if (event_stats_path == 0)
+	    return;
+
+      event_stats_flag = true;
+      atexit(&event_stats_dump_);
+}
+
+/*
+ * Optional scheduler order record/replay, for pinning down bugs that
+ * depend on the order of same-time events. Setting VVP_RECORD_ORDER
+ * to a path records the sequence of thread resumptions as one compact
+ * binary record per resume, written through a large stdio buffer so
+ * most records are just an append to memory and the mode is cheap
+ * enough to leave on in long runs. Setting VVP_REPLAY_ORDER to a
+ * previously recorded path makes the scheduler pull the recorded
+ * thread out of the active queue at each step, enforcing the recorded
+ * resume order even if the natural queue order has changed. A
+ * divergence (the recorded thread is not ready) is reported and the
+ * scheduler continues in its natural order.
+ *
+ * The records are host-endian uint32_t thread creation numbers (see
+ * vthread_get_id), with the value 0xffffffff marking a time advance.
+ * A recording is only meaningful when replayed on the same machine
+ * with the same .vvp input.
+ */
+static FILE*replay_rec_fd = 0;
+static FILE*replay_play_fd = 0;
+static bool replay_any_flag = false;
+
+static const uint32_t REPLAY_TIME_MARK = 0xffffffff;
+static char replay_rec_buf[64*1024];
+static char replay_play_buf[64*1024];
+
+static uint32_t replay_next_rec = 0;
+static bool replay_next_valid = false;
+static unsigned replay_mismatch_count = 0;
+
+static void replay_close_(void)
+{
+      if (replay_rec_fd) {
+	    fclose(replay_rec_fd);
+	    replay_rec_fd = 0;
+      }
+}
+
+static void replay_init_(void)
+{
+      if (const char*path = getenv("VVP_RECORD_ORDER")) {
+	    replay_rec_fd = fopen(path, "wb");
+	    if (replay_rec_fd == 0) {
+		  perror(path);
+	    } else {
+		  setvbuf(replay_rec_fd, replay_rec_buf, _IOFBF,
+			  sizeof replay_rec_buf);
+		  atexit(&replay_close_);
+	    }
+      }
+
+      if (const char*path = getenv("VVP_REPLAY_ORDER")) {
+	    replay_play_fd = fopen(path, "rb");
+	    if (replay_play_fd == 0)
+		  perror(path);
+	    else
+		  setvbuf(replay_play_fd, replay_play_buf, _IOFBF,
+			  sizeof replay_play_buf);
+      }
+
+      replay_any_flag = replay_rec_fd || replay_play_fd;
+}
+
+static inline void replay_record_(uint32_t val)
+{
+      fwrite(&val, sizeof val, 1, replay_rec_fd);
+}
+
+/*
+ * Peek the next record of the replay stream. At the end of the
+ * stream, turn replay off and let the rest of the run take its
+ * natural order.
+ */
+static bool replay_peek_(uint32_t&val)
+{
+      if (!replay_next_valid) {
+	    if (fread(&replay_next_rec, sizeof replay_next_rec, 1,
+		      replay_play_fd) != 1) {
+		  fclose(replay_play_fd);
+		  replay_play_fd = 0;
+		  replay_any_flag = replay_rec_fd != 0;
+		  return false;
+	    }
+	    replay_next_valid = true;
+      }
+
+      val = replay_next_rec;
+      return true;
+}
+
+static void replay_mismatch_(const char*what, unsigned long id)
+{
+      replay_mismatch_count += 1;
+      if (replay_mismatch_count > 10) {
+	    if (replay_mismatch_count == 11)
+		  cerr << "VVP_REPLAY_ORDER: (more divergence reports "
+		       << "suppressed)" << endl;
+	    return;
+      }
+
+      cerr << "VVP_REPLAY_ORDER: divergence at simulation time "
+	   << schedule_simtime() << ": " << what
+	   << " (thread " << id << ")" << endl;
+}
+
+/*
+ * Pull the event to run next off the active list. When the replay
+ * stream expects a specific thread next, find that thread event in
+ * the list and unlink it instead of the head.
+ */
+static struct event_s* replay_pull_active_(struct event_time_s*ctim)
+{
+      uint32_t expect;
+      if (replay_play_fd && replay_peek_(expect)
+	  && expect != REPLAY_TIME_MARK) {
+	    struct event_s*prev = ctim->active;
+	    do {
+		  struct event_s*cur = prev->next;
+		  vthread_event_s*tev = dynamic_cast<vthread_event_s*>(cur);
+		  if (tev && vthread_get_id(tev->thr) == expect) {
+			  /* Unlink cur from the circular list. The
+			     record itself is consumed by
+			     replay_step_ after the event runs. */
+			if (cur->next == cur) {
+			      ctim->active = 0;
+			} else {
+			      prev->next = cur->next;
+			      if (ctim->active == cur)
+				    ctim->active = prev;
+			}
+			return cur;
+		  }
+		  prev = cur;
+	    } while (prev != ctim->active);
+      }
+
+	/* No replay constraint on this step (or the recorded thread
+	   is not ready). Take the head of the list as usual. */
+      struct event_s*cur = ctim->active->next;
+      if (cur->next == cur) {
+	    ctim->active = 0;
+      } else {
+	    ctim->active->next = cur->next;
+      }
+
+      return cur;
+}
+
+/*
+ * Called for every event pulled from the active queue while
+ * recording or replaying. Thread resumptions are written to the
+ * record stream and checked against the replay stream; other event
+ * types are not order-constrained.
+ */
+static void replay_step_(struct event_s*cur)
+{
+      vthread_event_s*tev = dynamic_cast<vthread_event_s*>(cur);
+      if (tev == 0)
+	    return;
+
+      unsigned long id = vthread_get_id(tev->thr);
+
+      if (replay_rec_fd)
+	    replay_record_(id);
+
+      uint32_t expect;
+      if (replay_play_fd && replay_peek_(expect)) {
+	    if (expect == REPLAY_TIME_MARK) {
+		    /* Do not consume the mark; it re-syncs the
+		       stream at the next time advance. */
+		  replay_mismatch_("thread resumed after the recorded "
+				   "time advance", id);
+	    } else {
+		  if (expect != id)
+			replay_mismatch_("recording resumes a thread "
+					 "that is not ready", expect);
+		  replay_next_valid = false;
+	    }
+      }
+}
+
+/*
+ * Called when the simulation time advances. Consume any leftover
+ * resume records (reporting them as divergence) up to and including
+ * the time mark, so the streams line up again for the new time step.
+ */
+static void replay_time_advance_(void)
+{
+      uint32_t expect;
+      while (replay_peek_(expect) && expect != REPLAY_TIME_MARK) {
+	    replay_mismatch_("time advanced before the recorded resume",
+			     expect);
+	    replay_next_valid = false;
+      }
+
+      replay_next_valid = false;
+}
+
+/*
+ * Try to fold a new nonblocking assign into the last one already
+ * pending in the same time step. Register-file style processes
+ * schedule NBAs to adjacent parts of the same destination
+ * back-to-back, so checking only the queue tail catches that pattern
+ * at O(1) cost. Only exactly adjacent, non-overlapping part writes to
+ * the same port with the same destination width are merged, which
+ * keeps the assign order semantics intact while turning thousands of
+ * single-part commits into one vector write and one propagation.
+ */
+static bool nbassign_coalesce(struct event_s*tail_ev, struct event_s*cur_ev)
+{
+      assign_vector4_event_s*tail
+	    = dynamic_cast<assign_vector4_event_s*>(tail_ev);
+      if (tail == 0)
+	    return false;
+
+      assign_vector4_event_s*cur
+	    = dynamic_cast<assign_vector4_event_s*>(cur_ev);
+      if (cur == 0)
+	    return false;
+
+      if (tail->ptr != cur->ptr)
+	    return false;
+      if (tail->vwid == 0 || cur->vwid == 0)
+	    return false;
+      if (tail->vwid != cur->vwid)
+	    return false;
+      if (tail->base + tail->val.size() != cur->base)
+	    return false;
+      if (cur->base + cur->val.size() > cur->vwid)
+	    return false;
+
+      unsigned off = tail->val.size();
+      tail->val.resize(off + cur->val.size());
+      tail->val.set_vec(off, cur->val);
+      delete cur;
+      return true;
+}
+
 static void schedule_event_(struct event_s*cur, vvp_time64_t delay,
-			    event_queue_t select_queue)
+			    event_queue_t select_queue,
+			    int sync_prio = SYNC_PRIO_DEFAULT)
 {
+      assert(sync_prio >= 0 && sync_prio < SYNC_PRIO_N);
+      if (event_stats_flag)
+	    event_stats_sched_[select_queue] += 1;
+      sched_event_depth_ += 1;
+
       cur->next = cur;
 
       struct event_time_s*ctim = sched_list;
@@ -601,6 +1007,8 @@ static void schedule_event_(struct event_s*cur, vvp_time64_t delay,
 	    ctim->delay = delay;
 	    ctim->next  = 0;
 	    sched_list = ctim;
+	    sched_list_tail = ctim;
+	    sched_tail_delay = delay;
 
       } else if (sched_list->delay > delay) {
 
@@ -613,6 +1021,23 @@ static void schedule_event_(struct event_s*cur, vvp_time64_t delay,
 	    ctim = tmp;
 	    sched_list = ctim;
 
+      } else if (delay == sched_tail_delay) {
+
+	      /* The event lands exactly on the last time step. */
+	    ctim = sched_list_tail;
+
+      } else if (delay > sched_tail_delay) {
+
+	      /* The event is past the end of the list, so append a
+		 new event_time without walking the list. */
+	    struct event_time_s*tmp = new struct event_time_s;
+	    tmp->delay = delay - sched_tail_delay;
+	    tmp->next = 0;
+	    sched_list_tail->next = tmp;
+	    sched_list_tail = tmp;
+	    sched_tail_delay = delay;
+	    ctim = tmp;
+
       } else {
 	    struct event_time_s*prev = 0;
 
@@ -639,6 +1064,8 @@ static void schedule_event_(struct event_s*cur, vvp_time64_t delay,
 		  tmp->delay = delay - ctim->delay;
 		  tmp->next = 0;
 		  ctim->next = tmp;
+		  sched_list_tail = tmp;
+		  sched_tail_delay += tmp->delay;
 
 		  ctim = tmp;
 	    }
@@ -673,6 +1100,12 @@ static void schedule_event_(struct event_s*cur, vvp_time64_t delay,
 	    break;
 
 	  case SEQ_NBASSIGN:
+	    if (ctim->nbassign && nbassign_coalesce(ctim->nbassign, cur)) {
+		    /* The event was folded into the queue tail, so it
+		       no longer counts toward the backlog. */
+		  sched_event_depth_ -= 1;
+		  break;
+	    }
 	    if (ctim->nbassign == 0) {
 		  ctim->nbassign = cur;
 
@@ -685,26 +1118,26 @@ static void schedule_event_(struct event_s*cur, vvp_time64_t delay,
 	    break;
 
 	  case SEQ_RWSYNC:
-	    if (ctim->rwsync == 0) {
-		  ctim->rwsync = cur;
+	    if (ctim->rwsync[sync_prio] == 0) {
+		  ctim->rwsync[sync_prio] = cur;
 
 	    } else {
 		    /* Put the cur event on the end of the active list. */
-		  cur->next = ctim->rwsync->next;
-		  ctim->rwsync->next = cur;
-		  ctim->rwsync = cur;
+		  cur->next = ctim->rwsync[sync_prio]->next;
+		  ctim->rwsync[sync_prio]->next = cur;
+		  ctim->rwsync[sync_prio] = cur;
 	    }
 	    break;
 
 	  case SEQ_ROSYNC:
-	    if (ctim->rosync == 0) {
-		  ctim->rosync = cur;
+	    if (ctim->rosync[sync_prio] == 0) {
+		  ctim->rosync[sync_prio] = cur;
 
 	    } else {
 		    /* Put the cur event on the end of the active list. */
-		  cur->next = ctim->rosync->next;
-		  ctim->rosync->next = cur;
-		  ctim->rosync = cur;
+		  cur->next = ctim->rosync[sync_prio]->next;
+		  ctim->rosync[sync_prio]->next = cur;
+		  ctim->rosync[sync_prio] = cur;
 	    }
 	    break;
 
@@ -729,6 +1162,10 @@ static void schedule_event_push_(struct event_s*cur)
 	    return;
       }
 
+      if (event_stats_flag)
+	    event_stats_sched_[SEQ_ACTIVE] += 1;
+      sched_event_depth_ += 1;
+
       struct event_time_s*ctim = sched_list;
 
       if (ctim->active == 0) {
@@ -907,19 +1344,161 @@ void schedule_del_thr(vthread_t thr)
 }
 
 void schedule_generic(vvp_gen_event_t obj, vvp_time64_t delay,
-		      bool sync_flag, bool ro_flag, bool delete_when_done)
+		      bool sync_flag, bool ro_flag, bool delete_when_done,
+		      int sync_prio)
 {
       struct generic_event_s*cur = new generic_event_s;
 
       cur->obj = obj;
       cur->delete_obj_when_done = delete_when_done;
+      if (event_stats_flag)
+	    event_stats_count_src_(obj);
       schedule_event_(cur, delay,
-		      sync_flag? (ro_flag?SEQ_ROSYNC:SEQ_RWSYNC) : SEQ_ACTIVE);
+		      sync_flag? (ro_flag?SEQ_ROSYNC:SEQ_RWSYNC) : SEQ_ACTIVE,
+		      sync_prio);
 
       if (sync_flag)
 	    vthread_delay_delete();
 }
 
+/*
+ * Invert the current value of a recognized clock signal and send the
+ * result into port 0 of its functor, exactly as the %load/v, %inv,
+ * %set/v sequence of the replaced thread would have done.
+ */
+static void periodic_toggle_net_(vvp_net_t*net)
+{
+      vvp_signal_value*sig = dynamic_cast<vvp_signal_value*> (net->fil);
+      assert(sig);
+
+      vvp_vector4_t val;
+      sig->vec4_value(val);
+      vvp_send_vec4(vvp_net_ptr_t(net,0), ~val, 0);
+}
+
+void periodic_toggle_event_s::run_run(void)
+{
+      count_thread_events += 1;
+      periodic_toggle_net_(net);
+
+	/* The scheduler deletes this event after the run, so
+	   reschedule a fresh copy for the next edge. */
+      struct periodic_toggle_event_s*cur = new periodic_toggle_event_s;
+      cur->net = net;
+      cur->period = period;
+      schedule_event_(cur, period, SEQ_ACTIVE);
+}
+
+void schedule_periodic_toggle(vvp_net_t*net, vvp_time64_t period)
+{
+      struct periodic_toggle_event_s*cur = new periodic_toggle_event_s;
+
+      cur->net = net;
+      cur->period = period;
+      periodic_toggle_count += 1;
+
+	/* The replaced thread would have executed its %delay at time
+	   0, so the first toggle lands one period in. */
+      schedule_event_(cur, period, SEQ_ACTIVE);
+}
+
+/*
+ * Return true if this time step holds nothing but periodic toggles
+ * whose signals nobody can see: no fanout to propagate into, and no
+ * value-change callbacks to run. Such a step has no observable effect
+ * until some other event gets a chance to read the signal value, so
+ * the scheduler may skip over it arithmetically.
+ */
+static bool time_step_is_idle_toggle_(struct event_time_s*ctim)
+{
+      if (ctim->start || ctim->nbassign || ctim->del_thr)
+	    return false;
+      for (int idx = 0 ;  idx < SYNC_PRIO_N ;  idx += 1)
+	    if (ctim->rwsync[idx] || ctim->rosync[idx])
+		  return false;
+      if (ctim->active == 0)
+	    return false;
+
+      struct event_s*cur = ctim->active;
+      do {
+	    cur = cur->next;
+	    periodic_toggle_event_s*pev
+		  = dynamic_cast<periodic_toggle_event_s*> (cur);
+	    if (pev == 0)
+		  return false;
+	    if (pev->net->fanout_count() != 0)
+		  return false;
+	    if (pev->net->fil->has_vpi_callbacks())
+		  return false;
+      } while (cur != ctim->active);
+
+      return true;
+}
+
+/*
+ * Fast-forward over a run of idle clock edges. Find the first time
+ * step with real (or observable) work in it, then replace the edges
+ * in between with arithmetic: a toggle that would fire n times in the
+ * window flips its signal once if n is odd, and its next event lands
+ * on the first edge at or past the window end. The intermediate
+ * values are unobservable by construction, so only the parity
+ * matters. If nothing but idle clocks is pending at all, do nothing
+ * and let the scheduler step normally, as it always has.
+ */
+static void periodic_fast_forward_(void)
+{
+      if (! time_step_is_idle_toggle_(sched_list))
+	    return;
+
+      vvp_time64_t limit = 0;
+      struct event_time_s*target = sched_list;
+      while (target && time_step_is_idle_toggle_(target)) {
+	    limit += target->delay;
+	    target = target->next;
+      }
+      if (target == 0)
+	    return;
+      limit += target->delay;
+
+	/* Detach the idle steps from the list and make the target the
+	   new head, carrying the whole delay of the window. This must
+	   happen before any reschedule below, because schedule_event_
+	   works in delays relative to the head of the list. */
+      struct event_time_s*head = sched_list;
+      sched_list = target;
+      target->delay = limit;
+
+	/* Drain the detached steps, rescheduling each toggle past
+	   the window. The base is the offset of the step being
+	   drained, relative to the current time. */
+      vvp_time64_t base = 0;
+      while (head != target) {
+	    struct event_time_s*ctim = head;
+	    head = ctim->next;
+	    base += ctim->delay;
+
+	    while (ctim->active) {
+		  struct event_s*cur = ctim->active->next;
+		  if (cur->next == cur) {
+			ctim->active = 0;
+		  } else {
+			ctim->active->next = cur->next;
+		  }
+		  sched_event_depth_ -= 1;
+
+		  periodic_toggle_event_s*pev
+			= static_cast<periodic_toggle_event_s*> (cur);
+		  vvp_time64_t fires
+			= (limit - base + pev->period - 1) / pev->period;
+		  if (fires % 2 == 1)
+			periodic_toggle_net_(pev->net);
+		  schedule_event_(pev, base + fires*pev->period, SEQ_ACTIVE);
+	    }
+
+	    delete ctim;
+      }
+}
+
 static bool sim_started;
 
 void schedule_functor(vvp_gen_event_t obj)
@@ -928,6 +1507,8 @@ void schedule_functor(vvp_gen_event_t obj)
 
       cur->obj = obj;
       cur->delete_obj_when_done = false;
+      if (event_stats_flag)
+	    event_stats_count_src_(obj);
       if (!sim_started) {
             schedule_init_event(cur);
       } else {
@@ -941,6 +1522,8 @@ void schedule_at_start_of_simtime(vvp_gen_event_t obj, vvp_time64_t delay)
 
       cur->obj = obj;
       cur->delete_obj_when_done = false;
+      if (event_stats_flag)
+	    event_stats_count_src_(obj);
       schedule_event_(cur, delay, SEQ_START);
 }
 
@@ -948,10 +1531,14 @@ static vvp_time64_t schedule_time;
 vvp_time64_t schedule_simtime(void)
 { return schedule_time; }
 
+unsigned long schedule_event_backlog(void)
+{ return sched_event_depth_; }
+
 extern void vpiEndOfCompile();
 extern void vpiStartOfSim();
 extern void vpiPostsim();
 extern void vpiNextSimTime(void);
+extern bool vpip_next_sim_time_registered(void);
 
 /*
  * The scheduler uses this function to drain the rosync events of the
@@ -965,16 +1552,27 @@ extern void vpiNextSimTime(void);
  */
 static void run_rosync(struct event_time_s*ctim)
 {
-      while (ctim->rosync) {
-	    struct event_s*cur = ctim->rosync->next;
+	/* Drain the priority buckets in order. Since a rosync
+	   callback may create new rosync callbacks in any bucket,
+	   rescan from the first bucket after every event. */
+      int pdx = 0;
+      while (pdx < SYNC_PRIO_N) {
+	    if (ctim->rosync[pdx] == 0) {
+		  pdx += 1;
+		  continue;
+	    }
+
+	    struct event_s*cur = ctim->rosync[pdx]->next;
 	    if (cur->next == cur) {
-		  ctim->rosync = 0;
+		  ctim->rosync[pdx] = 0;
 	    } else {
-		  ctim->rosync->next = cur->next;
+		  ctim->rosync[pdx]->next = cur->next;
 	    }
 
+	    sched_event_depth_ -= 1;
 	    cur->run_run();
 	    delete cur;
+	    pdx = 0;
       }
 
       while (ctim->del_thr) {
@@ -985,11 +1583,16 @@ static void run_rosync(struct event_time_s*ctim)
 		  ctim->del_thr->next = cur->next;
 	    }
 
+	    sched_event_depth_ -= 1;
 	    cur->run_run();
 	    delete cur;
       }
 
-      if (ctim->active || ctim->nbassign || ctim->rwsync) {
+      bool rwsync_pending = false;
+      for (int idx = 0 ;  idx < SYNC_PRIO_N ;  idx += 1)
+	    if (ctim->rwsync[idx]) rwsync_pending = true;
+
+      if (ctim->active || ctim->nbassign || rwsync_pending) {
 	    cerr << "SCHEDULER ERROR: read-only sync events "
 		 << "created RW events!" << endl;
       }
@@ -1001,6 +1604,9 @@ void schedule_simulate(void)
 
       schedule_time = 0;
 
+      event_stats_init_();
+      replay_init_();
+
       if (verbose_flag) {
 	    vpi_mcd_printf(1, " ...execute EndOfCompile callbacks\n");
       }
@@ -1039,16 +1645,28 @@ void schedule_simulate(void)
 	    vpi_mcd_printf(1, " ...run scheduler\n");
       }
 
-      if (schedule_runnable) while (sched_list) {
+      if (schedule_runnable_flag) while (sched_list) {
 
 	    if (schedule_stopped_flag) {
 		  schedule_stopped_flag = false;
 		  stop_handler(0);
 		  // You can finish from the debugger without a time change.
-		  if (!schedule_runnable) break;
+		  if (!schedule_runnable_flag) break;
 		  continue;
 	    }
 
+	      /* If the design has recognized clocks, try to
+		 fast-forward over idle edges. Skipping would change
+		 what a debug trace or a replay stream records, and
+		 would elide cbNextSimTime callbacks, so stay with
+		 plain stepping in those modes. */
+	    if (periodic_toggle_count > 0
+		&& !replay_any_flag
+		&& !show_file_line
+		&& !schedule_single_step_flag
+		&& !vpip_next_sim_time_registered())
+		  periodic_fast_forward_();
+
 	      /* ctim is the current time step. */
 	    struct event_time_s* ctim = sched_list;
 
@@ -1056,14 +1674,21 @@ void schedule_simulate(void)
 		 postponed sync events. Run them all. */
 	    if (ctim->delay > 0) {
 
-		  if (!schedule_runnable) break;
+		  if (!schedule_runnable_flag) break;
 		  schedule_time += ctim->delay;
+		  if (event_stats_flag)
+			event_stats_sample_depth_();
+		  if (replay_rec_fd)
+			replay_record_(REPLAY_TIME_MARK);
+		  if (replay_play_fd)
+			replay_time_advance_();
 		    /* When the design is being traced (we are emitting
 		     * file/line information) also print any time changes. */
 		  if (show_file_line) {
 			cerr << "Advancing to simulation time: "
 			     << schedule_time << endl;
 		  }
+		  sched_tail_delay -= ctim->delay;
 		  ctim->delay = 0;
 
 		  vpiNextSimTime();
@@ -1075,6 +1700,7 @@ void schedule_simulate(void)
 			} else {
 			      ctim->start->next = cur->next;
 			}
+			sched_event_depth_ -= 1;
 			cur->run_run();
 			delete (cur);
 		  }
@@ -1089,8 +1715,16 @@ void schedule_simulate(void)
 		  ctim->nbassign = 0;
 
 		  if (ctim->active == 0) {
-			ctim->active = ctim->rwsync;
-			ctim->rwsync = 0;
+			  /* Splice the highest-priority non-empty
+			     rwsync bucket into the active queue. Any
+			     active events it creates run before the
+			     next bucket is spliced. */
+			for (int pdx = 0
+			     ; ctim->active == 0 && pdx < SYNC_PRIO_N
+			     ; pdx += 1) {
+			      ctim->active = ctim->rwsync[pdx];
+			      ctim->rwsync[pdx] = 0;
+			}
 
 			  /* If out of rw events, then run the rosync
 			     events and delete this time step. This also
@@ -1098,6 +1732,10 @@ void schedule_simulate(void)
 			if (ctim->active == 0) {
 			      run_rosync(ctim);
 			      sched_list = ctim->next;
+			      if (sched_list == 0) {
+				    sched_list_tail = 0;
+				    sched_tail_delay = 0;
+			      }
 			      delete ctim;
 			      continue;
 			}
@@ -1106,14 +1744,26 @@ void schedule_simulate(void)
 
 	      /* Pull the first item off the list. If this is the last
 		 cell in the list, then clear the list. Execute that
-		 event type, and delete it. */
-	    struct event_s*cur = ctim->active->next;
-	    if (cur->next == cur) {
-		  ctim->active = 0;
+		 event type, and delete it. When a replay stream is
+		 active it may select a different pending event than
+		 the head. */
+	    struct event_s*cur;
+	    if (replay_play_fd) {
+		  cur = replay_pull_active_(ctim);
 	    } else {
-		  ctim->active->next = cur->next;
+		  cur = ctim->active->next;
+		  if (cur->next == cur) {
+			ctim->active = 0;
+		  } else {
+			ctim->active->next = cur->next;
+		  }
 	    }
 
+	    if (replay_any_flag)
+		  replay_step_(cur);
+
+	    sched_event_depth_ -= 1;
+
 	    if (schedule_single_step_flag) {
 		  cur->single_step_display();
 		  schedule_stopped_flag = true;
@@ -121,9 +121,34 @@ extern void schedule_init_propagate(vvp_net_t*net, double val);
 
 typedef struct vvp_gen_event_s *vvp_gen_event_t;
 
+/*
+ * The read-write and read-only sync phases are split into priority
+ * buckets. Events in a lower-numbered bucket run before events in a
+ * higher-numbered bucket of the same phase; events within a bucket
+ * keep their FIFO order. This lets cheap end-of-timestep checks that
+ * frequently cancel the rest of the phase run before expensive
+ * formatting work. Non-sync events ignore the priority.
+ */
+const int SYNC_PRIO_EARLY   = 0;
+const int SYNC_PRIO_DEFAULT = 1;
+const int SYNC_PRIO_LATE    = 2;
+const int SYNC_PRIO_N       = 3;
+
 extern void schedule_generic(vvp_gen_event_t obj, vvp_time64_t delay,
 			     bool sync_flag, bool ro_flag =true,
-			     bool delete_obj_when_done =false);
+			     bool delete_obj_when_done =false,
+			     int sync_prio =SYNC_PRIO_DEFAULT);
+
+/*
+ * Create a free-running periodic toggle for the signal behind the
+ * given net. This stands in for a thread of the canonical clock shape
+ * "always #<period> clk = ~clk;" that compile_thread recognized at
+ * load time. The signal is inverted every period, starting one period
+ * from now. Driving the toggle from the scheduler instead of a thread
+ * lets the scheduler fast-forward over runs of clock edges that
+ * nothing in the design can observe.
+ */
+extern void schedule_periodic_toggle(vvp_net_t*net, vvp_time64_t period);
 
 /* Create a functor output event. This is placed in the pre-simulation
  * event queue if the scheduler is still processing pre-simulation
@@ -159,6 +184,13 @@ extern void schedule_simulate(void);
  */
 extern vvp_time64_t schedule_simtime(void);
 
+/*
+ * Get the number of scheduled events that have not been executed
+ * yet. This is used for printouts and for the $ivl_stats_backlog
+ * system function.
+ */
+extern unsigned long schedule_event_backlog(void);
+
 /*
  * This function is the equivalent of the $finish system task. It
  * tells the simulator that simulation is done, the current thread
@@ -171,8 +203,21 @@ extern vvp_time64_t schedule_simtime(void);
 extern void schedule_finish(int rc);
 extern void schedule_stop(int rc);
 extern void schedule_single_step(int flag);
-extern bool schedule_finished(void);
-extern bool schedule_stopped(void);
+
+/*
+ * The stop/finish flags are exported so that the hot opcode paths
+ * can test them inline. The jump instructions poll the stop flag on
+ * every pass so that a SIGINT can break a thread out of a hung
+ * zero-delay loop, and an out-of-line call per jump is measurable on
+ * loop heavy code. Use the schedule_stopped()/schedule_finished()
+ * functions to read the flags; the variables themselves belong to
+ * schedule.cc.
+ */
+extern bool schedule_stopped_flag;
+extern bool schedule_runnable_flag;
+
+inline bool schedule_finished(void) { return ! schedule_runnable_flag; }
+inline bool schedule_stopped(void)  { return schedule_stopped_flag; }
 
 /*
  * The scheduler calls this function to process stop events. When this
@@ -29,13 +29,51 @@
 # include  <cassert>
 
 
+/*
+ * Memo cache for pure system functions. The .sfunc/m statement marks a
+ * function whose result depends only on its arguments, so when the
+ * inputs land on a previously seen combination the cached result can
+ * be propagated without calling into the VPI implementation at
+ * all. The cache is a small direct mapped table; a hash collision
+ * simply replaces the old entry.
+ */
+struct sfunc_core::memo_cell_s {
+	// True when the key and result below are meaningful.
+      bool valid;
+	// Argument values, parallel to the argv_ array. Vector
+	// arguments are keyed in args, real arguments in rargs.
+      vvp_vector4_t*args;
+      double*rargs;
+	// The captured result.
+      bool res_is_real;
+      vvp_vector4_t res;
+      double res_r;
+};
+
+static const unsigned MEMO_SIZE = 64;
+
+	/* The core (and cell) waiting for the result of the VPI call
+	   currently in progress, if that call is being memoized. */
+static sfunc_core* memo_active_core = 0;
+
 sfunc_core::sfunc_core(vvp_net_t*net, vpiHandle sys,
-		       unsigned argc, vpiHandle*argv)
+		       unsigned argc, vpiHandle*argv, bool memo_flag)
 : vvp_wide_fun_core(net, argc)
 {
       sys_  = sys;
       argc_ = argc;
       argv_ = argv;
+      memo_flag_ = memo_flag;
+      memo_table_ = 0;
+      memo_pending_ = 0;
+      if (memo_flag_) {
+	    memo_table_ = new memo_cell_s[MEMO_SIZE];
+	    for (unsigned idx = 0 ;  idx < MEMO_SIZE ;  idx += 1) {
+		  memo_table_[idx].valid = false;
+		  memo_table_[idx].args = 0;
+		  memo_table_[idx].rargs = 0;
+	    }
+      }
 }
 
 sfunc_core::~sfunc_core()
@@ -47,6 +85,13 @@ sfunc_core::~sfunc_core()
       }
 #endif
       delete [] argv_;
+      if (memo_table_) {
+	    for (unsigned idx = 0 ;  idx < MEMO_SIZE ;  idx += 1) {
+		  delete [] memo_table_[idx].args;
+		  delete [] memo_table_[idx].rargs;
+	    }
+	    delete [] memo_table_;
+      }
 }
 
 /*
@@ -83,8 +128,130 @@ void sfunc_core::recv_real_from_inputs(unsigned port)
       schedule_functor(this);
 }
 
+/*
+ * Hash the current argument values, as already copied into the VPI
+ * constants by the recv_*_from_inputs methods above.
+ */
+unsigned long sfunc_core::memo_hash_(void) const
+{
+      unsigned long hash = argc_;
+
+      for (unsigned idx = 0 ;  idx < argc_ ;  idx += 1) {
+	    if (struct __vpiBinaryConst*obj
+		       = dynamic_cast<__vpiBinaryConst*>(argv_[idx])) {
+		  const vvp_vector4_t&bits = obj->bits;
+		  for (unsigned bdx = 0 ;  bdx < bits.size() ;  bdx += 1)
+			hash = hash*13 + bits.value(bdx);
+
+	    } else if (__vpiRealConst*robj
+		       = dynamic_cast<__vpiRealConst*>(argv_[idx])) {
+		  unsigned long tmp[sizeof(double)/sizeof(unsigned long) + 1];
+		  tmp[sizeof(tmp)/sizeof(tmp[0]) - 1] = 0;
+		  memcpy(tmp, &robj->value, sizeof(double));
+		  for (unsigned wdx = 0 ;  wdx < sizeof(tmp)/sizeof(tmp[0]) ;  wdx += 1)
+			hash = hash*13 + tmp[wdx];
+	    }
+      }
+
+      return hash;
+}
+
+bool sfunc_core::memo_match_(const struct memo_cell_s&cell) const
+{
+      for (unsigned idx = 0 ;  idx < argc_ ;  idx += 1) {
+	    if (struct __vpiBinaryConst*obj
+		       = dynamic_cast<__vpiBinaryConst*>(argv_[idx])) {
+		  if (! cell.args[idx].eeq(obj->bits))
+			return false;
+
+	    } else if (__vpiRealConst*robj
+		       = dynamic_cast<__vpiRealConst*>(argv_[idx])) {
+		  if (memcmp(&cell.rargs[idx], &robj->value, sizeof(double)) != 0)
+			return false;
+	    }
+      }
+
+      return true;
+}
+
+void sfunc_core::memo_fill_key_(struct memo_cell_s&cell)
+{
+      if (cell.args == 0) {
+	    cell.args = new vvp_vector4_t[argc_];
+	    cell.rargs = new double[argc_];
+      }
+
+      for (unsigned idx = 0 ;  idx < argc_ ;  idx += 1) {
+	    cell.rargs[idx] = 0.0;
+	    if (struct __vpiBinaryConst*obj
+		       = dynamic_cast<__vpiBinaryConst*>(argv_[idx])) {
+		  cell.args[idx] = obj->bits;
+
+	    } else if (__vpiRealConst*robj
+		       = dynamic_cast<__vpiRealConst*>(argv_[idx])) {
+		  cell.args[idx] = vvp_vector4_t();
+		  cell.rargs[idx] = robj->value;
+	    }
+      }
+}
+
+void sfunc_core::memo_note_vec4(const vvp_vector4_t&val)
+{
+      assert(memo_pending_);
+      memo_pending_->res_is_real = false;
+      memo_pending_->res = val;
+      memo_pending_->valid = true;
+}
+
+void sfunc_core::memo_note_real(double val)
+{
+      assert(memo_pending_);
+      memo_pending_->res_is_real = true;
+      memo_pending_->res_r = val;
+      memo_pending_->valid = true;
+}
+
+void sfunc_memo_capture_vec4(const vvp_vector4_t&val)
+{
+      if (memo_active_core)
+	    memo_active_core->memo_note_vec4(val);
+}
+
+void sfunc_memo_capture_real(double val)
+{
+      if (memo_active_core)
+	    memo_active_core->memo_note_real(val);
+}
+
 void sfunc_core::run_run()
 {
+      if (memo_flag_ && argc_ > 0) {
+	    struct memo_cell_s&cell = memo_table_[memo_hash_() % MEMO_SIZE];
+
+	    if (cell.valid && memo_match_(cell)) {
+		    /* Hit. Propagate the cached result without
+		       calling the VPI implementation at all. */
+		  if (cell.res_is_real)
+			propagate_real(cell.res_r, 0);
+		  else
+			propagate_vec4(cell.res, 0);
+		  return;
+	    }
+
+	      /* Miss. Claim the cell for the current arguments, then
+		 execute the call with the capture hook armed so that
+		 the put_value path records the result. If the call
+		 never puts a value, the cell is simply left invalid. */
+	    memo_fill_key_(cell);
+	    cell.valid = false;
+	    memo_pending_ = &cell;
+	    memo_active_core = this;
+	    vpip_execute_vpi_call(0, sys_);
+	    memo_active_core = 0;
+	    memo_pending_ = 0;
+	    return;
+      }
+
       vpip_execute_vpi_call(0, sys_);
 }
 
@@ -145,7 +312,7 @@ static int make_vpi_argv(unsigned argc, vpiHandle*vpi_argv,
 void compile_sfunc(char*label, char*name,  char*format_string,
 		   long file_idx, long lineno,
 		   unsigned argc, struct symb_s*argv,
-                   char*trigger_label)
+                   char*trigger_label, bool memo_flag)
 {
       unsigned real_stack = 0;
       unsigned string_stack = 0;
@@ -162,7 +329,7 @@ void compile_sfunc(char*label, char*name,  char*format_string,
       assert(sys);
 
 	/* Create and connect the functor to the label. */
-      sfunc_core*score = new sfunc_core(ptr, sys, argc, vpi_argv);
+      sfunc_core*score = new sfunc_core(ptr, sys, argc, vpi_argv, memo_flag);
       ptr->fun = score;
       define_functor_symbol(label, ptr);
       free(label);
@@ -24,23 +24,52 @@
 class sfunc_core : public vvp_wide_fun_core, protected vvp_gen_event_s {
 
     public:
-      sfunc_core(vvp_net_t*ptr, vpiHandle sys, unsigned argc, vpiHandle*argv);
+      sfunc_core(vvp_net_t*ptr, vpiHandle sys, unsigned argc, vpiHandle*argv,
+		 bool memo_flag);
       ~sfunc_core();
 
       void recv_vec4(vvp_net_ptr_t port, const vvp_vector4_t&bit,
                      vvp_context_t context);
 
+	// These are called from the system function put_value path
+	// while this core's VPI call is executing, to record the
+	// result in the memo cell selected by run_run().
+      void memo_note_vec4(const vvp_vector4_t&val);
+      void memo_note_real(double val);
+
     private:
+	// A cell of the memo cache. Defined in sfunc.cc.
+      struct memo_cell_s;
+
       void recv_vec4_from_inputs(unsigned port);
       void recv_real_from_inputs(unsigned port);
 
       void run_run();
 
+      unsigned long memo_hash_(void) const;
+      bool memo_match_(const struct memo_cell_s&cell) const;
+      void memo_fill_key_(struct memo_cell_s&cell);
 
     private:
       vpiHandle sys_;
       unsigned  argc_;
       vpiHandle*argv_;
+	// Memoize results of this (pure) function. The table is a
+	// direct mapped cache allocated only if the .sfunc/m statement
+	// asked for it, and memo_pending_ points at the cell waiting
+	// for the result of the call in progress.
+      bool memo_flag_;
+      struct memo_cell_s*memo_table_;
+      struct memo_cell_s*memo_pending_;
 };
 
+/*
+ * These functions are implemented in sfunc.cc and called from the
+ * sysfunc put_value implementations in vpi_tasks.cc. They record the
+ * function result if (and only if) a memoizing sfunc_core is in the
+ * middle of its VPI call, and are no-ops otherwise.
+ */
+extern void sfunc_memo_capture_vec4(const vvp_vector4_t&val);
+extern void sfunc_memo_capture_real(double val);
+
 #endif
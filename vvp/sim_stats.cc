@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2013 Stephen Williams (steve@icarus.com)
+ *
+ *    This source code is free software; you can redistribute it
+ *    and/or modify it in source code form under the terms of the GNU
+ *    General Public License as published by the Free Software
+ *    Foundation; either version 2 of the License, or (at your option)
+ *    any later version.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this program; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+# include  "sim_stats.h"
+# include  "statistics.h"
+# include  "schedule.h"
+# include  "mem_stats.h"
+# include  "vpi_user.h"
+# include  <cstring>
+
+/*
+ * Each member of the $ivl_stats_* family is the same function with a
+ * different counter behind it, so they share one calltf that selects
+ * the counter by the task name carried in the user_data.
+ *
+ *   $ivl_stats_time_steps     time steps executed so far
+ *   $ivl_stats_thread_events  thread schedule events executed so far
+ *   $ivl_stats_assign_events  assign events executed so far
+ *   $ivl_stats_other_events   other (generic) events executed so far
+ *   $ivl_stats_threads        thread objects that currently exist
+ *   $ivl_stats_backlog        scheduled events not yet executed
+ *   $ivl_stats_heap_kb        estimated design memory, in KBytes
+ *
+ * The results are returned as 32bit integers, so on very long runs
+ * the cumulative event counts can wrap. Testbenches that poll these
+ * functions should work with differences between samples, which
+ * remain correct across a wrap.
+ */
+
+static unsigned long fetch_time_steps(void)
+{ return count_time_events; }
+
+static unsigned long fetch_thread_events(void)
+{ return count_thread_events; }
+
+static unsigned long fetch_assign_events(void)
+{ return count_assign_events; }
+
+static unsigned long fetch_other_events(void)
+{ return count_gen_events; }
+
+static unsigned long fetch_threads(void)
+{ return count_live_threads; }
+
+static unsigned long fetch_backlog(void)
+{ return schedule_event_backlog(); }
+
+static unsigned long fetch_heap_kb(void)
+{ return (unsigned long) (mem_stats_total_bytes() / 1024); }
+
+struct sim_stats_tf_s {
+      const char*name;
+      unsigned long (*fetch)(void);
+};
+
+static const struct sim_stats_tf_s sim_stats_tf_table[] = {
+      { "$ivl_stats_time_steps",    &fetch_time_steps },
+      { "$ivl_stats_thread_events", &fetch_thread_events },
+      { "$ivl_stats_assign_events", &fetch_assign_events },
+      { "$ivl_stats_other_events",  &fetch_other_events },
+      { "$ivl_stats_threads",       &fetch_threads },
+      { "$ivl_stats_backlog",       &fetch_backlog },
+      { "$ivl_stats_heap_kb",       &fetch_heap_kb },
+      { 0, 0 }
+};
+
+static PLI_INT32 sim_stats_calltf(ICARUS_VPI_CONST PLI_BYTE8*name)
+{
+      vpiHandle callh = vpi_handle(vpiSysTfCall, 0);
+
+      unsigned long result = 0;
+      for (const struct sim_stats_tf_s*cur = sim_stats_tf_table
+		 ; cur->name ; cur += 1) {
+	    if (strcmp(cur->name, name) == 0) {
+		  result = (cur->fetch)();
+		  break;
+	    }
+      }
+
+      s_vpi_value val;
+      val.format = vpiIntVal;
+      val.value.integer = (PLI_INT32) result;
+      vpi_put_value(callh, &val, 0, vpiNoDelay);
+      return 0;
+}
+
+void sim_stats_register_systf(void)
+{
+      for (const struct sim_stats_tf_s*cur = sim_stats_tf_table
+		 ; cur->name ; cur += 1) {
+	    s_vpi_systf_data tf_data;
+	    vpiHandle res;
+
+	    tf_data.type        = vpiSysFunc;
+	    tf_data.sysfunctype = vpiIntFunc;
+	    tf_data.calltf      = sim_stats_calltf;
+	    tf_data.compiletf   = 0;
+	    tf_data.sizetf      = 0;
+	    tf_data.tfname      = cur->name;
+	    tf_data.user_data   = const_cast<PLI_BYTE8*>(cur->name);
+	    res = vpi_register_systf(&tf_data);
+	    vpip_make_systf_system_defined(res);
+      }
+}
@@ -0,0 +1,32 @@
+#ifndef __sim_stats_H
+#define __sim_stats_H
+/*
+ * Copyright (c) 2013 Stephen Williams (steve@icarus.com)
+ *
+ *    This source code is free software; you can redistribute it
+ *    and/or modify it in source code form under the terms of the GNU
+ *    General Public License as published by the Free Software
+ *    Foundation; either version 2 of the License, or (at your option)
+ *    any later version.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this program; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Register the $ivl_stats_* family of system functions. These expose
+ * the counters that the run time already keeps (and normally only
+ * prints at exit in verbose mode) to the running design, so that a
+ * testbench can throttle its own logging or detect an event storm
+ * without external monitoring. Called once from vvp_vpi_init() before
+ * the VPI modules are loaded.
+ */
+extern void sim_stats_register_systf(void);
+
+#endif
@@ -34,6 +34,9 @@ extern unsigned long count_functors_resolv;
 extern unsigned long count_functors_sig;
 extern unsigned long count_filters;
 extern unsigned long count_vvp_nets;
+// Count the weakly-coupled partitions of the vvp_net graph. Sets
+// largest to the net count of the biggest partition.
+extern unsigned long count_net_partitions(unsigned long&largest);
 extern unsigned long count_vpi_nets;
 extern unsigned long count_vpi_scopes;
 
@@ -48,6 +51,9 @@ extern unsigned long count_real_array_words;
 extern unsigned long count_time_events;
 extern unsigned long count_time_pool(void);
 
+// Number of thread objects that currently exist.
+extern unsigned long count_live_threads;
+
 extern unsigned long count_assign_events;
 extern unsigned long count_assign4_pool(void);
 extern unsigned long count_assign8_pool(void);
@@ -27,6 +27,7 @@
 
 # include  "vpi_priv.h"
 # include  "vthread.h"
+# include  "symbols.h"
 # include  "schedule.h"
 # include  <cstdio>
 # include  <cctype>
@@ -72,6 +73,58 @@ static char* readline_stub(const char*prompt)
 
 static bool interact_flag = true;
 
+/*
+ * Command arguments are resolved against the current scope by
+ * name. The scope tables are not sorted, so index the resolvable
+ * names in a symbol table the first time a name is looked up in a
+ * given table, and reuse the index for the rest of the session.
+ * Scope contents are fixed after elaboration, so an index built for
+ * a scope stays valid; only a change of scope selects a different
+ * table.
+ */
+static symbol_map_s<__vpiHandle>*stop_name_index = 0;
+static __vpiHandle**stop_name_index_table = 0;
+
+static vpiHandle lookup_name_in_table(__vpiHandle**table, unsigned ntable,
+				      const char*name)
+{
+      if (stop_name_index_table != table) {
+	    delete stop_name_index;
+	    stop_name_index = new symbol_map_s<__vpiHandle>;
+	    stop_name_index_table = table;
+
+	    for (unsigned tmp = 0 ;  tmp < ntable ;  tmp += 1) {
+		  struct __vpiScope*scope;
+		  const char*key = 0;
+
+		  switch (table[tmp]->get_type_code()) {
+
+		      case vpiModule:
+		      case vpiFunction:
+		      case vpiTask:
+		      case vpiNamedBegin:
+		      case vpiNamedFork:
+			scope = dynamic_cast<__vpiScope*>(table[tmp]);
+			key = scope->name;
+			break;
+
+		      case vpiReg:
+		      case vpiNet:
+		      case vpiParameter:
+			key = vpi_get_str(vpiName, table[tmp]);
+			break;
+		  }
+
+		    /* Keep the first match for a name, like the scan
+		       this index replaces. */
+		  if (key && stop_name_index->sym_get_value(key) == 0)
+			stop_name_index->sym_set_value(key, table[tmp]);
+	    }
+      }
+
+      return stop_name_index->sym_get_value(name);
+}
+
 static void cmd_call(unsigned argc, char*argv[])
 {
       __vpiHandle**table;
@@ -124,33 +177,10 @@ static void cmd_call(unsigned argc, char*argv[])
 	    }
 
 	      /* Try to find the vpiHandle within this scope that has
-		 the name in argv[idx+2]. Look in the current scope. */
-
-	    for (unsigned tmp = 0 ;  (tmp < ntable)&& !handle ;  tmp += 1) {
-		  struct __vpiScope*scope;
-		  const char*name;
-
-		  switch (table[tmp]->get_type_code()) {
-
-		      case vpiModule:
-		      case vpiFunction:
-		      case vpiTask:
-		      case vpiNamedBegin:
-		      case vpiNamedFork:
-			scope = dynamic_cast<__vpiScope*>(table[idx]);
-			if (strcmp(scope->name, argv[idx+1]) == 0)
-			      handle = table[tmp];
-			break;
+		 the name in argv[idx+1]. Look in the current scope. */
 
-		      case vpiReg:
-		      case vpiNet:
-		      case vpiParameter:
-			name = vpi_get_str(vpiName,table[tmp]);
-			if (strcmp(argv[idx+1], name) == 0)
-			      handle = table[tmp];
-			break;
-		  }
-	    }
+	    if (handle == 0)
+		  handle = lookup_name_in_table(table, ntable, argv[idx+1]);
 
 	    if (handle == 0) {
 		  printf("call error: I don't know how to"
@@ -28,7 +28,7 @@
  * for compact use of memory. This also makes it easy to delete the
  * entire lot of keys, simply by deleting the heaps.
  *
- * The key_strdup() function below allocates the strings from this
+ * The key_strdup_() function below allocates the strings from this
  * buffer, possibly making a new buffer if needed.
  */
 struct key_strings {
@@ -55,347 +55,126 @@ char*symbol_table_s::key_strdup_(const char*str)
 }
 
 /*
- * This is a B-Tree data structure, where there are nodes and
- * leaves.
+ * The table itself is a flat open-addressing hash table with linear
+ * probing. The table size is kept a power of two, and is doubled when
+ * the table reaches half full, so probe runs stay short and a lookup
+ * touches one cache line in the common case. Each cell caches the
+ * full hash of its key, so probing past a collision costs an integer
+ * compare instead of a strcmp, and growing the table re-files the
+ * cells without rehashing any strings.
  *
- * Nodes have a bunch of pointers to children. Each child pointer has
- * associated with it a key that is the largest key referenced by that
- * child. So, if the key being searched for has a value <= the first
- * key of a node, then the value is in the first child.
- *
- * leaves have a sorted table of key-value pairs. The search can use a
- * simple binary search to find an item. Each key represents an item.
+ * Symbols are never removed, except by deleting the entire table, so
+ * there is no tombstone handling.
  */
-
-const unsigned leaf_width = 254;
-const unsigned node_width = 508;
-
-struct tree_data_ {
-      char*key;
+struct table_cell_ {
+      char*key;			/* nil means the cell is empty. */
+      unsigned hash;
       symbol_value_t val;
 };
 
-struct tree_node_ {
-      bool leaf_flag;
-      unsigned count;
-      struct tree_node_*parent;
-
-      union {
-	    struct tree_data_ leaf[leaf_width];
-	    struct tree_node_ *child[node_width];
-      };
-
-};
-
-static inline char* node_last_key(struct tree_node_*node)
+static inline unsigned key_hash_(const char*key)
 {
-      while (node->leaf_flag == false)
-	    node = node->child[node->count-1];
-
-      return node->leaf[node->count-1].key;
+      unsigned hash = 0;
+      while (*key)
+	    hash = hash*13 + *key++;
+      return hash;
 }
 
-/*
- * Allocate a new symbol table means creating the table structure and
- * a root node, and initializing the pointers and members of the root
- * node.
- */
-symbol_table_s::symbol_table_s()
+symbol_table_s::symbol_table_s(unsigned size_hint)
 {
-      root = new struct tree_node_;
-      root->leaf_flag = false;
-      root->count = 0;
-      root->parent = 0;
+	/* Size the table to hold the hinted symbol count at no more
+	   than half load. */
+      table_size_ = 64;
+      while (table_size_ < 2*size_hint)
+	    table_size_ *= 2;
+
+      table_ = new struct table_cell_ [table_size_];
+      for (unsigned idx = 0 ;  idx < table_size_ ;  idx += 1)
+	    table_[idx].key = 0;
+      table_fill_ = 0;
 
       str_chunk = new key_strings;
       str_chunk->next = 0;
       str_used = 0;
 }
 
-static void delete_symbol_node(struct tree_node_*cur)
-{
-      if (! cur->leaf_flag) {
-	    for (unsigned idx = 0 ;  idx < cur->count ;  idx += 1)
-		  delete_symbol_node(cur->child[idx]);
-      }
-
-      delete cur;
-}
-
-/* Do as split_leaf_ does, but for nodes. */
-static void split_node_(struct tree_node_*cur)
-{
-	unsigned int idx, idx1, idx2, tmp;
-	struct tree_node_ *new_node;
-
-	assert(!cur->leaf_flag);
-	if (cur->parent)  assert(! cur->parent->leaf_flag);
-
-	while (cur->count == node_width)
-	{
-		/* Create a new node to hold half the data from cur. */
-		new_node = new struct tree_node_;
-		new_node->leaf_flag = false;
-		new_node->count = cur->count / 2;
-		if (cur->parent)
-			/* cur is not root; new_node becomes sibling. */
-			new_node->parent = cur->parent;
-
-		/* Move the last half of the data from the end of the old node
-		   to the beginning of the new node. At the same time, reduce
-		   the size of the old node. */
-		idx1 = new_node->count;
-		idx2 = cur->count;
-		while (idx1 > 0) {
-		      idx1 -= 1;
-		      idx2 -= 1;
-		      new_node->child[idx1] = cur->child[idx2];
-		      new_node->child[idx1]->parent = new_node;
-		      cur->count -= 1;
-		}
-
-		assert(new_node->count > 0);
-		assert(cur->count > 0);
-
-		if (cur->parent == 0) {
-			/* cur is root. Move first half of children to
-			   another new node, and put the two new nodes
-			   in cur. The plan here is to make cur into
-			   the new root and split its contents into 2
-			   children. */
-
-		      new_node->parent = cur;
-		      struct tree_node_*new2_node = new struct tree_node_;
-		      new2_node->leaf_flag = false;
-		      new2_node->count = cur->count;
-		      new2_node->parent = cur;
-		      for (idx = 0; idx < cur->count; idx += 1) {
-			    new2_node->child[idx] = cur->child[idx];
-			    new2_node->child[idx]->parent = new2_node;
-		      }
-		      cur->child[0] = new2_node;
-		      cur->child[1] = new_node;
-		      cur->count = 2;
-			/* no more ancestors, stop the while loop */
-		      break;
-		}
-
-		/* cur is not root. hook new_node to cur->parent. */
-		idx = 0;
-		while (cur->parent->child[idx] != cur) {
-			assert(idx < cur->parent->count);
-			idx += 1;
-		}
-
-		idx += 1;
-
-		for (tmp = cur->parent->count ;  tmp > idx ;  tmp -= 1)
-			cur->parent->child[tmp] = cur->parent->child[tmp-1];
-
-		cur->parent->child[idx] = new_node;
-		cur->parent->count += 1;
-
-		/* check the ancestor */
-		cur = cur->parent;
-	}
-}
-
 /*
- * This function takes a leaf node and splits in into two. Move half
- * the leaf keys into the new node, and add the new leaf into the
- * parent node.
+ * Double the table and re-file the live cells. The cached hash makes
+ * this a matter of recomputing slots, not rehashing strings.
  */
-static struct tree_node_* split_leaf_(struct tree_node_*cur)
+void symbol_table_s::rehash_()
 {
-      assert(cur->leaf_flag);
-      assert(cur->parent);
-      assert(! cur->parent->leaf_flag);
+      unsigned old_size = table_size_;
+      struct table_cell_*old_table = table_;
 
-	/* Create a new leaf to hold half the data from the old leaf. */
-      struct tree_node_*new_leaf = new struct tree_node_;
-      new_leaf->leaf_flag = true;
-      new_leaf->count = cur->count / 2;
-      new_leaf->parent = cur->parent;
+      table_size_ *= 2;
+      table_ = new struct table_cell_ [table_size_];
+      for (unsigned idx = 0 ;  idx < table_size_ ;  idx += 1)
+	    table_[idx].key = 0;
 
-	/* Move the last half of the data from the end of the old leaf
-	   to the beginning of the new leaf. At the same time, reduce
-	   the size of the old leaf. */
-      unsigned idx1 = new_leaf->count;
-      unsigned idx2 = cur->count;
-      while (idx1 > 0) {
-	    idx1 -= 1;
-	    idx2 -= 1;
-	    new_leaf->leaf[idx1] = cur->leaf[idx2];
-	    cur->count -= 1;
-      }
+      unsigned mask = table_size_ - 1;
+      for (unsigned idx = 0 ;  idx < old_size ;  idx += 1) {
+	    if (old_table[idx].key == 0)
+		  continue;
 
-      assert(new_leaf->count > 0);
-      assert(cur->count > 0);
+	    unsigned slot = old_table[idx].hash & mask;
+	    while (table_[slot].key)
+		  slot = (slot+1) & mask;
 
-      unsigned idx = 0;
-      while (cur->parent->child[idx] != cur) {
-	    assert(idx < cur->parent->count);
-	    idx += 1;
+	    table_[slot] = old_table[idx];
       }
 
-      idx += 1;
-
-      for (unsigned tmp = cur->parent->count ;  tmp > idx ;  tmp -= 1)
-	    cur->parent->child[tmp] = cur->parent->child[tmp-1];
-
-      cur->parent->child[idx] = new_leaf;
-      cur->parent->count += 1;
-
-      if (cur->parent->count == node_width)
-	    split_node_(cur->parent);
-
-      return new_leaf;
+      delete[] old_table;
 }
 
-
 /*
- * This function searches tree recursively for the key. If the value
- * is not found (and we are at a leaf) then set the key with the given
- * value. If the key is found, set the value only if the force_flag is
- * true.
+ * Find the cell for the key, or the empty cell where it belongs. If
+ * the key is not present, enter it (with a copy of the string in the
+ * key buffer) and leave the value for the caller to fill in.
  */
-
-symbol_value_t symbol_table_s::find_value_(struct tree_node_*cur,
-					   const char*key, symbol_value_t val,
-					   bool force_flag)
+struct table_cell_* symbol_table_s::find_cell_(const char*key)
 {
-      if (cur->leaf_flag) {
-
-	    unsigned idx = 0;
-	    for (;;) {
-		    /* If we run out of keys in the leaf, then add
-		       this at the end of the leaf. */
-		  if (idx == cur->count) {
-			cur->leaf[idx].key = key_strdup_(key);
-			cur->leaf[idx].val = val;
-			cur->count += 1;
-			if (cur->count == leaf_width)
-			      split_leaf_(cur);
-
-			return val;
-		  }
-
-		  int rc = strcmp(key, cur->leaf[idx].key);
-
-		    /* If we found the key already in the table, then
-		       set the new value and break. */
-		  if (rc == 0) {
-			if (force_flag)
-			      cur->leaf[idx].val = val;
-			return cur->leaf[idx].val;
-		  }
-
-		    /* If this key goes before the current key, then
-		       push all the following entries back and add
-		       this key here. */
-		  if (rc < 0) {
-			for (unsigned tmp = cur->count; tmp > idx; tmp -= 1)
-			      cur->leaf[tmp] = cur->leaf[tmp-1];
-
-			cur->leaf[idx].key = key_strdup_(key);
-			cur->leaf[idx].val = val;
-			cur->count += 1;
-			if (cur->count == leaf_width)
-			      split_leaf_(cur);
-
-			return val;
-		  }
-
-		  idx += 1;
-	    }
-
-      } else {
-	      /* Do a binary search within the inner node. */
-	    unsigned min = 0;
-	    unsigned max = cur->count;
-	    unsigned idx = max/2;
-	    for (;;) {
-		  int rc = strcmp(key, node_last_key(cur->child[idx]));
-		  if (rc == 0) {
-			return find_value_(cur->child[idx],
-					   key, val, force_flag);
-		  }
-
-		  if (rc > 0) {
-			min = idx + 1;
-			if (min == cur->count)
-			      return find_value_(cur->child[idx],
-						 key, val, force_flag);
-			if (min == max)
-			      return find_value_(cur->child[max],
-						 key, val, force_flag);
-
-			idx = min + (max-min)/2;
-
-		  } else  {
-			max = idx;
-			if (idx == min)
-			      return find_value_(cur->child[idx],
-						 key, val, force_flag);
-			idx = min + (max-min)/2;
-		  }
-	    }
+      unsigned hash = key_hash_(key);
+      unsigned mask = table_size_ - 1;
+      unsigned slot = hash & mask;
+
+      while (table_[slot].key) {
+	    if (table_[slot].hash == hash
+		&& strcmp(table_[slot].key, key) == 0)
+		  return table_ + slot;
+	    slot = (slot+1) & mask;
       }
 
-      assert(0);
-      { symbol_value_t tmp;
-        tmp.num = 0;
-        return tmp;
+      table_fill_ += 1;
+      if (2*table_fill_ >= table_size_) {
+	    rehash_();
+	    mask = table_size_ - 1;
+	    slot = hash & mask;
+	    while (table_[slot].key)
+		  slot = (slot+1) & mask;
       }
+
+      table_[slot].key = key_strdup_(key);
+      table_[slot].hash = hash;
+      table_[slot].val.num = 0;
+      return table_ + slot;
 }
 
 void symbol_table_s::sym_set_value(const char*key, symbol_value_t val)
 {
-      if (root->count == 0) {
-	      /* Handle the special case that this is the very first
-		 value in the symbol table. Create the first leaf node
-		 and initialize the pointers. */
-	    struct tree_node_*cur = new struct tree_node_;
-	    cur->leaf_flag = true;
-	    cur->parent = root;
-	    cur->count = 1;
-	    cur->leaf[0].key = key_strdup_(key);
-	    cur->leaf[0].val = val;
-
-	    root->count = 1;
-	    root->child[0] = cur;
-      } else {
-	    find_value_(root, key, val, true);
-      }
+      struct table_cell_*cell = find_cell_(key);
+      cell->val = val;
 }
 
 symbol_value_t symbol_table_s::sym_get_value(const char*key)
 {
-      symbol_value_t def;
-      def.num = 0;
-
-      if (root->count == 0) {
-	      /* Handle the special case that this is the very first
-		 value in the symbol table. Create the first leaf node
-		 and initialize the pointers. */
-	    struct tree_node_*cur = new struct tree_node_;
-	    cur->leaf_flag = true;
-	    cur->parent = root;
-	    cur->count = 1;
-	    cur->leaf[0].key = key_strdup_(key);
-	    cur->leaf[0].val = def;
-
-	    root->count = 1;
-	    root->child[0] = cur;
-	    return cur->leaf[0].val;
-      } else {
-	    return find_value_(root, key, def, false);
-      }
+      struct table_cell_*cell = find_cell_(key);
+      return cell->val;
 }
 
 symbol_table_s::~symbol_table_s()
 {
-      delete_symbol_node(root);
+      delete[] table_;
       while (str_chunk) {
 	    key_strings*tmp = str_chunk;
 	    str_chunk = tmp->next;
@@ -56,7 +56,10 @@ typedef struct symbol_value_s {
 
 class symbol_table_s {
     public:
-      explicit symbol_table_s();
+	// The size hint, if given, presizes the table for roughly
+	// that many symbols. The table grows by itself either way;
+	// the hint only saves rehashing while loading big designs.
+      explicit symbol_table_s(unsigned size_hint =0);
       virtual ~symbol_table_s();
 
 	// This method locates the value in the symbol table and sets its
@@ -69,13 +72,14 @@ class symbol_table_s {
       symbol_value_t sym_get_value(const char*key);
 
     private:
-      struct tree_node_*root;
+      struct table_cell_*table_;
+      unsigned table_size_;
+      unsigned table_fill_;
       struct key_strings*str_chunk;
       unsigned str_used;
 
-      symbol_value_t find_value_(struct tree_node_*cur,
-				 const char*key, symbol_value_t val,
-				 bool force_flag);
+      struct table_cell_*find_cell_(const char*key);
+      void rehash_();
       char*key_strdup_(const char*str);
 };
 
@@ -86,7 +90,8 @@ class symbol_table_s {
  * the delete_symbol_table method will delete the table, including all
  * the space for the keys.
  */
-inline symbol_table_t new_symbol_table(void) { return new symbol_table_s; }
+inline symbol_table_t new_symbol_table(unsigned size_hint =0)
+{ return new symbol_table_s(size_hint); }
 inline void delete_symbol_table(symbol_table_t tbl) { delete tbl; }
 
 // These are obsolete, and here only to support older code.
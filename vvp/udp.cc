@@ -125,12 +125,44 @@ vvp_udp_comb_s::vvp_udp_comb_s(char*label, char*name__, unsigned ports)
       levels1_ = 0;
       nlevels0_ = 0;
       nlevels1_ = 0;
+      levels_dense_ = 0;
 }
 
 vvp_udp_comb_s::~vvp_udp_comb_s()
 {
       delete[] levels0_;
       delete[] levels1_;
+      delete[] levels_dense_;
+}
+
+/*
+ * The dense tables map the complete input state of a device directly
+ * to the output value, so that an input change is a single lookup
+ * instead of a scan over the table rows. Every position of the state
+ * is one of 0, 1 or x, so a state packs into 2 bits per position and
+ * the table has 4**positions byte entries, with the codes that would
+ * need a fourth digit value left as unreachable gaps. The tables are
+ * only built up to this many positions, which caps a table at 64K
+ * entries; wider devices keep the row scan.
+ */
+static const unsigned DENSE_LEVELS_LIMIT = 8;
+
+static unsigned levels_dense_index(const udp_levels_table&cur,
+				   unsigned positions)
+{
+      unsigned idx = 0;
+
+      for (unsigned pp = positions ;  pp > 0 ;  pp -= 1) {
+	    unsigned long mask_bit = 1UL << (pp-1);
+	    unsigned digit = 0;
+	    if (cur.mask1 & mask_bit)
+		  digit = 1;
+	    else if (cur.maskx & mask_bit)
+		  digit = 2;
+	    idx = (idx << 2) | digit;
+      }
+
+      return idx;
 }
 
 /*
@@ -152,6 +184,15 @@ vvp_udp_comb_s::~vvp_udp_comb_s()
  * position will generate a match.
  */
 vvp_bit4_t vvp_udp_comb_s::test_levels(const udp_levels_table&cur)
+{
+      if (levels_dense_)
+	    return (vvp_bit4_t)
+		  levels_dense_[levels_dense_index(cur, port_count())];
+
+      return scan_levels_(cur);
+}
+
+vvp_bit4_t vvp_udp_comb_s::scan_levels_(const udp_levels_table&cur)
 {
 	/* To test for a row match, test that the mask0, mask1 and
 	   maskx vectors all have bits set where the matching
@@ -294,6 +335,60 @@ void vvp_udp_comb_s::compile_table(char**tab)
 
       assert(nrows0 == nlevels0_);
       assert(nrows1 == nlevels1_);
+
+      make_levels_dense_();
+}
+
+void vvp_udp_comb_s::make_levels_dense_()
+{
+      if (port_count() > DENSE_LEVELS_LIMIT)
+	    return;
+
+      unsigned size = 1U << (2*port_count());
+      levels_dense_ = new unsigned char[size];
+      for (unsigned idx = 0 ;  idx < size ;  idx += 1)
+	    levels_dense_[idx] = BIT4_X;
+
+	/* Walk every combination of 0/1/x input digits, run the row
+	   scan once for each, and record the result in the table. */
+      unsigned digits[DENSE_LEVELS_LIMIT];
+      for (unsigned pp = 0 ;  pp < port_count() ;  pp += 1)
+	    digits[pp] = 0;
+
+      for (;;) {
+	    struct udp_levels_table tmp;
+	    tmp.mask0 = 0;
+	    tmp.mask1 = 0;
+	    tmp.maskx = 0;
+	    for (unsigned pp = 0 ;  pp < port_count() ;  pp += 1) {
+		  unsigned long mask_bit = 1UL << pp;
+		  switch (digits[pp]) {
+		      case 0:
+			tmp.mask0 |= mask_bit;
+			break;
+		      case 1:
+			tmp.mask1 |= mask_bit;
+			break;
+		      default:
+			tmp.maskx |= mask_bit;
+			break;
+		  }
+	    }
+
+	    unsigned idx = levels_dense_index(tmp, port_count());
+	    levels_dense_[idx] = scan_levels_(tmp);
+
+	    unsigned pp = 0;
+	    while (pp < port_count()) {
+		  digits[pp] += 1;
+		  if (digits[pp] < 3)
+			break;
+		  digits[pp] = 0;
+		  pp += 1;
+	    }
+	    if (pp == port_count())
+		  break;
+      }
 }
 
 vvp_udp_seq_s::vvp_udp_seq_s(char*label, char*name__,
@@ -317,6 +412,8 @@ vvp_udp_seq_s::vvp_udp_seq_s(char*label, char*name__,
       nedges0_ = 0;
       nedges1_ = 0;
       nedgesL_ = 0;
+
+      levels_dense_ = 0;
 }
 
 vvp_udp_seq_s::~vvp_udp_seq_s()
@@ -328,6 +425,7 @@ vvp_udp_seq_s::~vvp_udp_seq_s()
       delete[] edges0_;
       delete[] edges1_;
       delete[] edgesL_;
+      delete[] levels_dense_;
 }
 
 void edge_based_on_char(struct udp_edges_table&cur, char chr, unsigned pos)
@@ -674,6 +772,66 @@ void vvp_udp_seq_s::compile_table(char**tab)
       assert(idx_edg1 == nedges1_);
       assert(idx_edgL == nedgesL_);
 
+      make_levels_dense_();
+}
+
+/*
+ * The sequential state packs the inputs and the phantom current
+ * output position, so the limit applies to port_count()+1
+ * positions. The level rows that ask for no-change resolve against
+ * the output position of the state, which is part of the index, so
+ * they bake into the table too. Only the edge rows keep the scan,
+ * and those are only consulted when the level lookup misses.
+ */
+void vvp_udp_seq_s::make_levels_dense_()
+{
+      unsigned positions = port_count() + 1;
+      if (positions > DENSE_LEVELS_LIMIT)
+	    return;
+
+      unsigned size = 1U << (2*positions);
+      levels_dense_ = new unsigned char[size];
+      for (unsigned idx = 0 ;  idx < size ;  idx += 1)
+	    levels_dense_[idx] = BIT4_Z;
+
+      unsigned digits[DENSE_LEVELS_LIMIT];
+      for (unsigned pp = 0 ;  pp < positions ;  pp += 1)
+	    digits[pp] = 0;
+
+      for (;;) {
+	    struct udp_levels_table tmp;
+	    tmp.mask0 = 0;
+	    tmp.mask1 = 0;
+	    tmp.maskx = 0;
+	    for (unsigned pp = 0 ;  pp < positions ;  pp += 1) {
+		  unsigned long mask_bit = 1UL << pp;
+		  switch (digits[pp]) {
+		      case 0:
+			tmp.mask0 |= mask_bit;
+			break;
+		      case 1:
+			tmp.mask1 |= mask_bit;
+			break;
+		      default:
+			tmp.maskx |= mask_bit;
+			break;
+		  }
+	    }
+
+	    unsigned idx = levels_dense_index(tmp, positions);
+	    levels_dense_[idx] = scan_levels_(tmp);
+
+	    unsigned pp = 0;
+	    while (pp < positions) {
+		  digits[pp] += 1;
+		  if (digits[pp] < 3)
+			break;
+		  digits[pp] = 0;
+		  pp += 1;
+	    }
+	    if (pp == positions)
+		  break;
+      }
 }
 
 bool operator == (const udp_levels_table&a, const udp_levels_table&b)
@@ -727,6 +885,15 @@ vvp_bit4_t vvp_udp_seq_s::calculate_output(const udp_levels_table&cur,
  * current output.
  */
 vvp_bit4_t vvp_udp_seq_s::test_levels_(const udp_levels_table&cur)
+{
+      if (levels_dense_)
+	    return (vvp_bit4_t)
+		  levels_dense_[levels_dense_index(cur, port_count()+1)];
+
+      return scan_levels_(cur);
+}
+
+vvp_bit4_t vvp_udp_seq_s::scan_levels_(const udp_levels_table&cur)
 {
       for (unsigned idx = 0 ;  idx < nlevels0_ ;  idx += 1) {
 	    if (cur.mask0 != (cur.mask0 & levels0_[idx].mask0))
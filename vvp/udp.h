@@ -127,10 +127,17 @@ class vvp_udp_comb_s : public vvp_udp_s {
 				  vvp_bit4_t cur_out);
 
     private:
+      vvp_bit4_t scan_levels_(const udp_levels_table&cur);
+      void make_levels_dense_();
+
 	// Level sensitive rows of the device.
       struct udp_levels_table*levels0_;
       struct udp_levels_table*levels1_;
       unsigned nlevels0_, nlevels1_;
+
+	// Dense lookup table built from the rows above, indexed by
+	// the packed input state. Nil if the device is too wide.
+      unsigned char*levels_dense_;
 };
 
 /*
@@ -191,6 +198,8 @@ class vvp_udp_seq_s : public vvp_udp_s {
 
     private:
       vvp_bit4_t test_levels_(const udp_levels_table&cur);
+      vvp_bit4_t scan_levels_(const udp_levels_table&cur);
+      void make_levels_dense_();
 
 	// Level sensitive rows of the device.
       struct udp_levels_table*levels0_;
@@ -199,6 +208,11 @@ class vvp_udp_seq_s : public vvp_udp_s {
       struct udp_levels_table*levelsL_;
       unsigned nlevels0_, nlevels1_, nlevelsx_, nlevelsL_;
 
+	// Dense lookup table built from the level rows, indexed by
+	// the packed input and current output state. Nil if the
+	// device is too wide.
+      unsigned char*levels_dense_;
+
       vvp_bit4_t test_edges_(const udp_levels_table&cur,
 			     const udp_levels_table&prev);
 
@@ -28,6 +28,7 @@
 # include  "vpi_priv.h"
 # include  "vvp_net.h"
 # include  "schedule.h"
+# include  "slab.h"
 # include  "event.h"
 # include  "vvp_net_sig.h"
 # include  "config.h"
@@ -37,6 +38,7 @@
 # include  <cstdio>
 # include  <cassert>
 # include  <cstdlib>
+# include  <cstring>
 /*
  * Callback handles are created when the VPI function registers a
  * callback. The handle is stored by the run time, and it triggered
@@ -61,6 +63,9 @@ struct sync_cb  : public vvp_gen_event_s {
       ~sync_cb () { }
 
       virtual void run_run();
+
+      static void* operator new(size_t);
+      static void operator delete(void*);
 };
 
 inline __vpiCallback::__vpiCallback()
@@ -178,6 +183,51 @@ bool value_part_callback::test_value_callback_ready(void)
       return true;
 }
 
+/*
+ * A watchpoint is a value change callback that carries a (mask,
+ * comparison-value) pair and tests the signal against that pair
+ * natively. The test is a few word compares on the vector bit planes,
+ * so nothing is formatted and the user callback does not run at all
+ * unless the masked compare actually matches. The match is edge
+ * triggered: the callback fires when the signal enters the matching
+ * state, not on every change while it stays there.
+ */
+class value_watch_callback : public value_callback {
+    public:
+      value_watch_callback(p_cb_data data, vvp_signal_value*sig_val,
+			   const vvp_vector4_t&mask,
+			   const vvp_vector4_t&compare);
+
+      bool test_value_callback_ready(void);
+
+    private:
+      vvp_signal_value*sig_val_;
+      vvp_vector4_t mask_;
+      vvp_vector4_t compare_;
+	// Scratch vector, kept around so that testing the watchpoint
+	// does not allocate on every value change.
+      vvp_vector4_t tmp_;
+      bool matched_;
+};
+
+inline value_watch_callback::value_watch_callback(p_cb_data data,
+						  vvp_signal_value*sig_val,
+						  const vvp_vector4_t&mask,
+						  const vvp_vector4_t&compare)
+: value_callback(data), sig_val_(sig_val), mask_(mask), compare_(compare),
+  tmp_(mask.size()), matched_(false)
+{
+}
+
+bool value_watch_callback::test_value_callback_ready(void)
+{
+      sig_val_->vec4_value(tmp_);
+      bool match = tmp_.eeq_masked(compare_, mask_);
+      bool fire = match && !matched_;
+      matched_ = match;
+      return fire;
+}
+
 /*
  * Attach the __vpiCallback to the object that this part select
  * selects from. The part select itself is not a vvp_vpi_callback
@@ -283,6 +333,9 @@ class sync_callback : public __vpiCallback {
 	// user supplied callback data
       struct t_vpi_time cb_time;
 
+      static void* operator new(size_t);
+      static void operator delete(void*);
+
     private:
 };
 
@@ -301,6 +354,42 @@ sync_callback::~sync_callback()
       delete cb_sync;
 }
 
+/*
+ * Sync callbacks are churned at a high rate: the VCD/FST dumpers
+ * register a fresh cbReadOnlySynch in every time step that has value
+ * changes, and timed callbacks (cbAfterDelay) come and go with every
+ * watchdog. Recycle the handle and event objects through slab pools
+ * in the same spirit as the event structures in schedule.cc.
+ */
+static const size_t SYNC_CB_CHUNK_COUNT = 8192 / sizeof(struct sync_cb);
+static slab_t<sizeof(sync_cb),SYNC_CB_CHUNK_COUNT> sync_cb_heap;
+
+void* sync_cb::operator new(size_t size)
+{
+      assert(size == sizeof(sync_cb));
+      return sync_cb_heap.alloc_slab();
+}
+
+void sync_cb::operator delete(void*ptr)
+{
+      sync_cb_heap.free_slab(ptr);
+}
+
+static const size_t SYNC_CALLBACK_CHUNK_COUNT
+                          = 8192 / sizeof(struct sync_callback);
+static slab_t<sizeof(sync_callback),SYNC_CALLBACK_CHUNK_COUNT> sync_callback_heap;
+
+void* sync_callback::operator new(size_t size)
+{
+      assert(size == sizeof(sync_callback));
+      return sync_callback_heap.alloc_slab();
+}
+
+void sync_callback::operator delete(void*ptr)
+{
+      sync_callback_heap.free_slab(ptr);
+}
+
 void sync_cb::run_run()
 {
       if (handle == 0)
@@ -323,7 +412,8 @@ void sync_cb::run_run()
       delete cur;
 }
 
-static sync_callback* make_sync(p_cb_data data, bool readonly_flag)
+static sync_callback* make_sync(p_cb_data data, bool readonly_flag,
+				int sync_prio = SYNC_PRIO_DEFAULT)
 {
       sync_callback*obj = new sync_callback(data);
 
@@ -334,16 +424,18 @@ static sync_callback* make_sync(p_cb_data data, bool readonly_flag)
 
       switch (obj->cb_time.type) {
 	  case vpiSuppressTime:
-	    schedule_generic(cb, 0, true, readonly_flag);
+	    schedule_generic(cb, 0, true, readonly_flag, false, sync_prio);
 	    break;
 
 	  case vpiSimTime:
 	      { vvp_time64_t tv = vpip_timestruct_to_time(&obj->cb_time);
 		vvp_time64_t tn = schedule_simtime();
 		if (tv < tn) {
-		      schedule_generic(cb, 0, true, readonly_flag);
+		      schedule_generic(cb, 0, true, readonly_flag, false,
+				       sync_prio);
 		} else {
-		      schedule_generic(cb, tv - tn, true, readonly_flag);
+		      schedule_generic(cb, tv - tn, true, readonly_flag, false,
+				       sync_prio);
 		}
 		break;
 	      }
@@ -528,6 +620,16 @@ void vpiNextSimTime(void)
       vpi_mode_flag = VPI_MODE_NONE;
 }
 
+/*
+ * The scheduler asks this before fast-forwarding over idle time
+ * steps, which would elide the vpiNextSimTime calls for the skipped
+ * times.
+ */
+bool vpip_next_sim_time_registered(void)
+{
+      return NextSimTime != 0;
+}
+
 static simulator_callback* make_prepost(p_cb_data data)
 {
       simulator_callback*obj = new simulator_callback(data);
@@ -573,6 +675,22 @@ vpiHandle vpi_register_cb(p_cb_data data)
 	    obj = make_sync(data, false);
 	    break;
 
+	  case _cbReadOnlySynchEarly:
+	    obj = make_sync(data, true, SYNC_PRIO_EARLY);
+	    break;
+
+	  case _cbReadOnlySynchLate:
+	    obj = make_sync(data, true, SYNC_PRIO_LATE);
+	    break;
+
+	  case _cbReadWriteSynchEarly:
+	    obj = make_sync(data, false, SYNC_PRIO_EARLY);
+	    break;
+
+	  case _cbReadWriteSynchLate:
+	    obj = make_sync(data, false, SYNC_PRIO_LATE);
+	    break;
+
 	  case cbAtStartOfSimTime:
 	    obj = make_afterdelay(data, true);
 	    break;
@@ -644,14 +762,13 @@ void callback_execute(struct __vpiCallback*cur)
 
 vvp_vpi_callback::vvp_vpi_callback()
 {
-      vpi_callbacks_ = 0;
       array_ = 0;
       array_word_ = 0;
 }
 
 vvp_vpi_callback::~vvp_vpi_callback()
 {
-      assert(vpi_callbacks_ == 0);
+      assert(vpi_callbacks_.empty());
       assert(array_ == 0);
 }
 
@@ -664,19 +781,16 @@ void vvp_vpi_callback::attach_as_word(vvp_array_t arr, unsigned long addr)
 
 void vvp_vpi_callback::add_vpi_callback(value_callback*cb)
 {
-      cb->next = vpi_callbacks_;
-      vpi_callbacks_ = cb;
+      cb->next = 0;
+      vpi_callbacks_.push_back(cb);
 }
 
 #ifdef CHECK_WITH_VALGRIND
 void vvp_vpi_callback::clear_all_callbacks()
 {
-      while (vpi_callbacks_) {
-	    value_callback *tmp = dynamic_cast<value_callback*>
-	                            (vpi_callbacks_->next);
-	    delete vpi_callbacks_;
-	    vpi_callbacks_ = tmp;
-      }
+      for (size_t idx = 0 ;  idx < vpi_callbacks_.size() ;  idx += 1)
+	    delete vpi_callbacks_[idx];
+      vpi_callbacks_.clear();
 }
 #endif
 
@@ -686,16 +800,19 @@ void vvp_vpi_callback::clear_all_callbacks()
  * callback function. If the cb_rtn pointer is nil, then the object
  * has been marked for deletion. Free it.
  */
-void vvp_vpi_callback::run_vpi_callbacks()
+void vvp_vpi_callback::run_vpi_callbacks_()
 {
       if (array_) array_word_change(array_, array_word_);
 
-      value_callback *next = vpi_callbacks_;
-      value_callback *prev = 0;
+	/* Only sweep the callbacks that were present on entry. A
+	   callback routine may register new callbacks on this same
+	   signal, and those are appended past nrun for the next
+	   value change. */
+      size_t nrun = vpi_callbacks_.size();
+      size_t wr = 0;
 
-      while (next) {
-	    value_callback*cur = next;
-	    next = dynamic_cast<value_callback*>(cur->next);
+      for (size_t idx = 0 ;  idx < nrun ;  idx += 1) {
+	    value_callback*cur = vpi_callbacks_[idx];
 
 	    if (cur->cb_data.cb_rtn != 0) {
 		  if (cur->test_value_callback_ready()) {
@@ -704,21 +821,19 @@ void vvp_vpi_callback::run_vpi_callbacks()
 
 			callback_execute(cur);
 		  }
-		  prev = cur;
-
-	    } else if (prev == 0) {
-
-		  vpi_callbacks_ = next;
-		  cur->next = 0;
-		  delete cur;
+		  vpi_callbacks_[wr] = cur;
+		  wr += 1;
 
 	    } else {
-		  assert(prev->next == cur);
-		  prev->next = next;
-		  cur->next = 0;
 		  delete cur;
 	    }
       }
+
+	/* Close up any gap left by reaped callbacks, keeping the
+	   entries that were added while we were dispatching. */
+      if (wr < nrun)
+	    vpi_callbacks_.erase(vpi_callbacks_.begin()+wr,
+	                         vpi_callbacks_.begin()+nrun);
 }
 
 void vvp_signal_value::get_signal_value(struct t_vpi_value*vp)
@@ -843,6 +958,11 @@ void vvp_wire_vec4::get_value(struct t_vpi_value*val)
       get_signal_value(val);
 }
 
+void vvp_var_vec4::get_value(struct t_vpi_value*val)
+{
+      get_signal_value(val);
+}
+
 void vvp_wire_vec8::get_value(struct t_vpi_value*val)
 {
       get_signal_value(val);
@@ -858,3 +978,136 @@ void vvp_wire_string::get_value(struct t_vpi_value*val)
       assert(0);
 }
 #endif
+
+/*
+ * $ivl_watchpoint(<signal>, <mask>, <value>);
+ *
+ * Arm a watchpoint on the signal. Whenever the signal changes so that
+ * its bits match <value> in the positions where <mask> is 1, print a
+ * diagnostic and stop the simulation, as if the design had executed
+ * $stop. The test is done with the native value_watch_callback above,
+ * so hundreds of armed watchpoints cost only a masked word compare
+ * per value change.
+ */
+
+static vvp_vector4_t binstr_to_vec4(const char*str, unsigned wid)
+{
+      vvp_vector4_t res (wid, BIT4_0);
+      size_t len = strlen(str);
+	// The vpiBinStr format puts the MSB first, but the vector is
+	// addressed LSB first.
+      for (unsigned idx = 0 ;  idx < wid && idx < len ;  idx += 1) {
+	    vvp_bit4_t bit;
+	    switch (str[len-1-idx]) {
+		case '0':
+		  bit = BIT4_0;
+		  break;
+		case '1':
+		  bit = BIT4_1;
+		  break;
+		case 'z':
+		case 'Z':
+		  bit = BIT4_Z;
+		  break;
+		default:
+		  bit = BIT4_X;
+		  break;
+	    }
+	    res.set_bit(idx, bit);
+      }
+      return res;
+}
+
+static PLI_INT32 watchpoint_trip(p_cb_data cb)
+{
+      s_vpi_value val;
+      val.format = vpiBinStrVal;
+      vpi_get_value(cb->obj, &val);
+
+      vpi_printf("WATCHPOINT: %s = %s at %" TIME_FMT_U "\n",
+		 vpi_get_str(vpiFullName, cb->obj), val.value.str,
+		 schedule_simtime());
+      vpi_control(vpiStop, 1);
+      return 0;
+}
+
+static PLI_INT32 ivl_watchpoint_calltf(ICARUS_VPI_CONST PLI_BYTE8*)
+{
+      vpiHandle callh = vpi_handle(vpiSysTfCall, 0);
+      vpiHandle argv = vpi_iterate(vpiArgument, callh);
+      vpiHandle sig = vpi_scan(argv);
+      vpiHandle mask_arg = vpi_scan(argv);
+      vpiHandle value_arg = vpi_scan(argv);
+      vpi_free_object(argv);
+
+      struct __vpiSignal*rfp = dynamic_cast<__vpiSignal*>(sig);
+      if (rfp == 0) {
+	    vpi_printf("ERROR: %s:%d: $ivl_watchpoint argument must be "
+		       "a net or variable.\n",
+		       vpi_get_str(vpiFile, callh),
+		       (int)vpi_get(vpiLineNo, callh));
+	    return 0;
+      }
+
+      vvp_signal_value*vsig = dynamic_cast<vvp_signal_value*>(rfp->node->fil);
+      vvp_net_fil_t*sig_fil = dynamic_cast<vvp_net_fil_t*>(rfp->node->fil);
+      assert(vsig && sig_fil);
+
+      unsigned wid = vsig->value_size();
+
+	// The value.str result buffer is shared, so convert the mask
+	// to its vector form before fetching the comparison value.
+      s_vpi_value tmp;
+      tmp.format = vpiBinStrVal;
+      vpi_get_value(mask_arg, &tmp);
+      vvp_vector4_t mask = binstr_to_vec4(tmp.value.str, wid);
+
+      tmp.format = vpiBinStrVal;
+      vpi_get_value(value_arg, &tmp);
+      vvp_vector4_t compare = binstr_to_vec4(tmp.value.str, wid);
+
+      s_cb_data cb;
+      memset(&cb, 0, sizeof cb);
+      cb.reason = cbValueChange;
+      cb.cb_rtn = watchpoint_trip;
+      cb.obj = sig;
+
+      value_callback*cbh = new value_watch_callback(&cb, vsig, mask, compare);
+      sig_fil->add_vpi_callback(cbh);
+      return 0;
+}
+
+static PLI_INT32 ivl_watchpoint_compiletf(ICARUS_VPI_CONST PLI_BYTE8*name)
+{
+      vpiHandle callh = vpi_handle(vpiSysTfCall, 0);
+      vpiHandle argv = vpi_iterate(vpiArgument, callh);
+      unsigned argc = 0;
+
+      while (argv && vpi_scan(argv))
+	    argc += 1;
+
+      if (argc != 3) {
+	    vpi_printf("ERROR: %s:%d: %s requires three arguments: "
+		       "a signal, a mask and a comparison value.\n",
+		       vpi_get_str(vpiFile, callh),
+		       (int)vpi_get(vpiLineNo, callh), name);
+	    vpip_set_return_value(1);
+	    vpi_control(vpiFinish, 1);
+      }
+      return 0;
+}
+
+void watchpoint_register_systf(void)
+{
+      s_vpi_systf_data tf_data;
+      vpiHandle res;
+
+      tf_data.type        = vpiSysTask;
+      tf_data.calltf      = ivl_watchpoint_calltf;
+      tf_data.compiletf   = ivl_watchpoint_compiletf;
+      tf_data.sizetf      = 0;
+      tf_data.tfname      = "$ivl_watchpoint";
+      tf_data.user_data   = 0;
+      res = vpi_register_systf(&tf_data);
+      vpip_make_systf_system_defined(res);
+}
@@ -37,6 +37,9 @@ class __vpiStringConst : public __vpiHandle {
       int vpi_get(int code);
       void vpi_get_value(p_vpi_value val);
 
+	// The processed text of the constant, used as the intern key.
+      const char*value_str() const { return value_; }
+
     private:
       void process_string_();
     private:
@@ -238,11 +241,62 @@ static int free_temp_string(vpiHandle obj)
 __vpiHandle::free_object_fun_t __vpiStringConstTEMP::free_object_fun(void)
 { return &free_temp_string; }
 
+/*
+ * Persistent string constants are interned, so that the many repeated
+ * references to the same literal (format strings especially) share a
+ * single handle. The handles are immutable and live for the duration
+ * of the simulation, so the table is never torn down. The table is a
+ * fixed array of hash chains, in the same style as the string table
+ * in vpi_priv.cc.
+ */
+struct string_const_cell {
+      __vpiStringConst*obj;
+      struct string_const_cell*next;
+};
+
+static const unsigned STRING_CONST_HASH_SIZE = 4096;
+static struct string_const_cell*string_const_table[STRING_CONST_HASH_SIZE];
+
+static unsigned hash_string_text(const char*text)
+{
+      unsigned hash = 0;
+      while (*text)
+	    hash = hash*13 + (unsigned char)*text++;
+      return hash;
+}
+
 vpiHandle vpip_make_string_const(char*text, bool persistent_flag)
 {
-      __vpiStringConst*obj;
+      if (! persistent_flag)
+	    return new __vpiStringConstTEMP(text);
+
+	/* Build the constant (this also processes escapes in the
+	   text) then look for an existing handle with the same
+	   processed value. */
+      __vpiStringConst*obj = new __vpiStringConst(text);
+
+#ifdef CHECK_WITH_VALGRIND
+	/* Sharing handles would make the per-call cleanup
+	   double-delete them, so keep them distinct when leak
+	   checking. */
+      return obj;
+#endif
+
+      unsigned slot = hash_string_text(obj->value_str())
+	    % STRING_CONST_HASH_SIZE;
+
+      for (struct string_const_cell*cur = string_const_table[slot]
+		 ; cur ; cur = cur->next) {
+	    if (strcmp(cur->obj->value_str(), obj->value_str()) == 0) {
+		  delete obj;
+		  return cur->obj;
+	    }
+      }
 
-      obj = persistent_flag? new __vpiStringConst(text) : new __vpiStringConstTEMP(text);
+      struct string_const_cell*cell = new struct string_const_cell;
+      cell->obj = obj;
+      cell->next = string_const_table[slot];
+      string_const_table[slot] = cell;
 
       return obj;
 }
@@ -396,12 +450,36 @@ void __vpiBinaryConst::vpi_get_value(p_vpi_value val)
 }
 
 
+/*
+ * Binary constants referenced from system task arguments are shared
+ * the same way the string constants are. The key is the signedness
+ * and the bit vector itself. Only callers that ask for a shared
+ * handle get one, since some (the .sfunc argument carriers, for
+ * example) rewrite the bits of their constants at run time.
+ */
+struct binary_const_cell {
+      struct __vpiBinaryConst*obj;
+      struct binary_const_cell*next;
+};
+
+static const unsigned BINARY_CONST_HASH_SIZE = 1024;
+static struct binary_const_cell*binary_const_table[BINARY_CONST_HASH_SIZE];
+
+static unsigned hash_binary_bits(const vvp_vector4_t&bits)
+{
+      unsigned hash = bits.size();
+      for (unsigned idx = 0 ;  idx < bits.size() ;  idx += 1)
+	    hash = hash*13 + bits.value(idx);
+      return hash;
+}
+
 /*
  * Make a VPI constant from a vector string. The string is normally a
  * ASCII string, with each letter a 4-value bit. The first character
  * may be an 's' if the vector is signed.
  */
-vpiHandle vpip_make_binary_const(unsigned wid, const char*bits)
+vpiHandle vpip_make_binary_const(unsigned wid, const char*bits,
+                                 bool shared_flag)
 {
       struct __vpiBinaryConst*obj = new __vpiBinaryConst;
 
@@ -416,6 +494,32 @@ vpiHandle vpip_make_binary_const(unsigned wid, const char*bits)
 
       obj->bits = vector4_from_text(bp, wid);
 
+      if (! shared_flag)
+	    return obj;
+
+#ifdef CHECK_WITH_VALGRIND
+	/* Sharing handles would make the per-call cleanup
+	   double-delete them, so keep them distinct when leak
+	   checking. */
+      return obj;
+#endif
+
+      unsigned slot = hash_binary_bits(obj->bits) % BINARY_CONST_HASH_SIZE;
+
+      for (struct binary_const_cell*cur = binary_const_table[slot]
+		 ; cur ; cur = cur->next) {
+	    if (cur->obj->signed_flag == obj->signed_flag
+		&& cur->obj->bits.eeq(obj->bits)) {
+		  delete obj;
+		  return cur->obj;
+	    }
+      }
+
+      struct binary_const_cell*cell = new struct binary_const_cell;
+      cell->obj = obj;
+      cell->next = binary_const_table[slot];
+      binary_const_table[slot] = cell;
+
       return obj;
 }
 
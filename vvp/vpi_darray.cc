@@ -84,3 +84,154 @@ void darray_delete(vpiHandle item)
       delete obj;
 }
 #endif
+
+/*
+ * These routines implement the bulk-transfer extension for dynamic
+ * arrays and queues. A checker that drains a queue word by word pays
+ * a VPI call and a format conversion per element; these entry points
+ * move a run of words in one call. Two-state atom arrays and real
+ * arrays/queues are copied in their native storage layout; arrays
+ * with four-state words are transferred as s_vpi_vecval pairs, one
+ * (wid+31)/32 group per word.
+ */
+
+static vvp_darray* darray_from_ref(vpiHandle ref, vvp_object_t&hold)
+{
+      __vpiDarrayVar*obj = dynamic_cast<__vpiDarrayVar*>(ref);
+      if (obj == 0) return 0;
+
+      vvp_fun_signal_object*fun = dynamic_cast<vvp_fun_signal_object*> (obj->get_net()->fun);
+      if (fun == 0) return 0;
+
+      hold = fun->get_object();
+      return hold.peek<vvp_darray>();
+}
+
+/*
+ * Build a vector4 from the aval/bval encoding. This is the inverse
+ * of vvp_vector4_t::as_vpi_vecval.
+ */
+static vvp_vector4_t vecval_to_vec4(unsigned wid, const s_vpi_vecval*vp)
+{
+      vvp_vector4_t res (wid);
+
+      for (unsigned idx = 0 ;  idx < wid ;  idx += 1) {
+	    unsigned aval = (vp[idx/32].aval >> (idx%32)) & 1;
+	    unsigned bval = (vp[idx/32].bval >> (idx%32)) & 1;
+	    vvp_bit4_t bit;
+	    if (bval)
+		  bit = aval? BIT4_X : BIT4_Z;
+	    else
+		  bit = aval? BIT4_1 : BIT4_0;
+	    res.set_bit(idx, bit);
+      }
+
+      return res;
+}
+
+/*
+ * Report the per-word size, in bytes, of the bulk-transfer layout for
+ * the referenced array. Returns 0 if the array is empty-typed or its
+ * words (e.g. strings) cannot be transferred in bulk.
+ */
+extern "C" PLI_INT32 vpip_darray_word_size(vpiHandle ref)
+{
+      vvp_object_t hold;
+      vvp_darray*aval = darray_from_ref(ref, hold);
+      if (aval == 0) return 0;
+
+	// Probe the flat layouts with a zero-length copy.
+      size_t wordsz = aval->copy_words_out(0, 0, 0);
+      if (wordsz > 0) return wordsz;
+
+	// Four-state words: derive the width from the first word.
+      if (aval->get_size() == 0) return 0;
+      vvp_vector4_t word;
+      aval->get_word(0, word);
+      if (word.size() == 0) return 0;
+      return ((word.size() + 31) / 32) * sizeof(s_vpi_vecval);
+}
+
+/*
+ * Copy cnt words starting at adr into the caller's buffer, in the
+ * layout reported by vpip_darray_word_size. Returns the number of
+ * words copied, which is clamped to the array size.
+ */
+extern "C" PLI_INT32 vpip_darray_get_words(vpiHandle ref, PLI_UINT32 adr,
+                                           PLI_UINT32 cnt, void*dst)
+{
+      vvp_object_t hold;
+      vvp_darray*aval = darray_from_ref(ref, hold);
+      if (aval == 0) return 0;
+
+      size_t size = aval->get_size();
+      if (adr >= size) return 0;
+      if (cnt > size - adr) cnt = size - adr;
+      if (cnt == 0) return 0;
+
+      if (aval->copy_words_out(adr, cnt, dst) > 0)
+	    return cnt;
+
+	// Four-state fallback: convert word by word, but still in a
+	// single VPI call with no handle churn.
+      s_vpi_vecval*op = static_cast<s_vpi_vecval*> (dst);
+      for (unsigned idx = 0 ;  idx < cnt ;  idx += 1) {
+	    vvp_vector4_t word;
+	    aval->get_word(adr+idx, word);
+	    if (word.size() == 0) return idx;
+	    word.as_vpi_vecval(0, word.size(), op);
+	    op += (word.size() + 31) / 32;
+      }
+
+      return cnt;
+}
+
+/*
+ * Copy cnt words from the caller's buffer into the array, starting
+ * at adr. Words beyond the current array size are dropped; use
+ * vpip_darray_reserve and the normal push path to grow a queue.
+ * Returns the number of words stored.
+ */
+extern "C" PLI_INT32 vpip_darray_put_words(vpiHandle ref, PLI_UINT32 adr,
+                                           PLI_UINT32 cnt, const void*src)
+{
+      vvp_object_t hold;
+      vvp_darray*aval = darray_from_ref(ref, hold);
+      if (aval == 0) return 0;
+
+      size_t size = aval->get_size();
+      if (adr >= size) return 0;
+      if (cnt > size - adr) cnt = size - adr;
+      if (cnt == 0) return 0;
+
+      if (aval->copy_words_in(adr, cnt, src) > 0)
+	    return cnt;
+
+	// Four-state fallback: the word width comes from the stored
+	// words, so the caller layout matches vpip_darray_word_size.
+      vvp_vector4_t word;
+      aval->get_word(adr, word);
+      if (word.size() == 0) return 0;
+      unsigned wid = word.size();
+      const s_vpi_vecval*ip = static_cast<const s_vpi_vecval*> (src);
+      for (unsigned idx = 0 ;  idx < cnt ;  idx += 1) {
+	    aval->set_word(adr+idx, vecval_to_vec4(wid, ip));
+	    ip += (wid + 31) / 32;
+      }
+
+      return cnt;
+}
+
+/*
+ * Capacity hint for writers that know how many words they are about
+ * to push. Only queues act on this; it never changes the visible
+ * size of the array.
+ */
+extern "C" void vpip_darray_reserve(vpiHandle ref, PLI_UINT32 cnt)
+{
+      vvp_object_t hold;
+      vvp_darray*aval = darray_from_ref(ref, hold);
+      if (aval == 0) return;
+
+      aval->reserve_words(cnt);
+}
@@ -29,16 +29,13 @@ inline __vpiNamedEvent::__vpiNamedEvent(__vpiScope*sc, const char*nam)
 {
       scope_ = sc;
       name_ = vpip_name_string(nam);
-      callbacks_ = 0;
 }
 
 __vpiNamedEvent::~__vpiNamedEvent()
 {
-      while (callbacks_) {
-	    struct __vpiCallback *tmp = callbacks_->next;
-	    delete callbacks_;
-	    callbacks_ = tmp;
-      }
+      for (size_t idx = 0 ;  idx < callbacks_.size() ;  idx += 1)
+	    delete callbacks_[idx];
+      callbacks_.clear();
 }
 
 int __vpiNamedEvent::get_type_code(void) const
@@ -89,39 +86,42 @@ vpiHandle vpip_make_named_event(const char*name, vvp_net_t*funct)
 
 /*
  * This function runs the callbacks for a named event. All the
- * callbacks are listed in the callback member of the event handle,
- * this function scans that list.
+ * callbacks are held in the callbacks_ array of the event handle,
+ * this function sweeps that array.
  *
  * This also handles the case where the callback has been removed. The
  * vpi_remove_cb doesn't actually remove any callbacks, it marks them
  * as canceled by clearing the cb_rtn function. This function reaps
- * those marked handles when it scans the list.
+ * those marked handles when it sweeps the array.
  *
  * We can not use vpi_free_object() here since it does not really
  * delete the callback.
  */
-void __vpiNamedEvent::run_vpi_callbacks()
+void __vpiNamedEvent::run_vpi_callbacks_()
 {
-      struct __vpiCallback*next = callbacks_;
-      struct __vpiCallback*prev = 0;
-      while (next) {
-	    struct __vpiCallback*cur = next;
-	    next = cur->next;
+	/* Only sweep the callbacks that were present on entry. A
+	   callback routine may register new callbacks on this same
+	   event, and those are appended past nrun for the next
+	   trigger. */
+      size_t nrun = callbacks_.size();
+      size_t wr = 0;
+
+      for (size_t idx = 0 ;  idx < nrun ;  idx += 1) {
+	    struct __vpiCallback*cur = callbacks_[idx];
 
 	    if (cur->cb_data.cb_rtn != 0) {
 		  callback_execute(cur);
-		  prev = cur;
-
-	    } else if (prev == 0) {
-		  callbacks_ = next;
-		  cur->next = 0;
-		  delete cur;
+		  callbacks_[wr] = cur;
+		  wr += 1;
 
 	    } else {
-		  assert(prev->next == cur);
-		  prev->next = next;
-		  cur->next = 0;
 		  delete cur;
 	    }
       }
+
+	/* Close up any gap left by reaped callbacks, keeping the
+	   entries that were added while we were dispatching. */
+      if (wr < nrun)
+	    callbacks_.erase(callbacks_.begin()+wr,
+	                     callbacks_.begin()+nrun);
 }
@@ -45,6 +45,17 @@ extern FILE* vpi_trace;
 #define FD_IDX(fd)	((fd)&~(1U<<31))
 #define FD_INCR		32
 
+/* Files opened for writing get a large stdio buffer so that log-heavy
+ * simulations ($fwrite/$fdisplay of millions of short lines) do not
+ * issue an OS write per line. $fflush still lands in vpi_mcd_flush()
+ * and fflush(), so explicit flush ordering is unchanged. */
+#define WRITE_BUF_SIZE	(64*1024)
+
+static void set_write_buffer(FILE*fp)
+{
+      setvbuf(fp, NULL, _IOFBF, WRITE_BUF_SIZE);
+}
+
 typedef struct mcd_entry {
 	FILE *fp;
 	char *filename;
@@ -164,6 +175,7 @@ got_entry:
 	mcd_table[i].fp = fopen(name, "w");
 	if(mcd_table[i].fp == NULL)
 		return 0;
+	set_write_buffer(mcd_table[i].fp);
 	mcd_table[i].filename = strdup(name);
 
 	if (vpi_trace) {
@@ -308,6 +320,8 @@ extern "C" PLI_INT32 vpi_fopen(const char*name, const char*mode)
 got_entry:
       fd_table[i].fp = fopen(name, mode);
       if (fd_table[i].fp == NULL) return 0;
+      if (strchr(mode, 'w') || strchr(mode, 'a'))
+	    set_write_buffer(fd_table[i].fp);
       fd_table[i].filename = strdup(name);
       return ((1U<<31)|i);
 }
@@ -32,6 +32,151 @@ static unsigned dll_list_cnt = 0;
 
 typedef void (*vlog_startup_routines_t)(void);
 
+/*
+ * A module may ship a manifest next to its .vpi/.vpl file, with the
+ * same base name and a .vpm suffix, listing one system task/function
+ * name per line ("$readmemh" style, '#' starts a comment). The
+ * manifest is a promise that the startup routines of the module do
+ * nothing but register exactly those names. For such a module the
+ * dlopen is deferred until the loaded design (or a VPI application)
+ * first references one of the listed names; a module whose names are
+ * never referenced is never mapped at all. Modules without a manifest
+ * load eagerly, exactly as they always have.
+ */
+struct deferred_module_s {
+      struct deferred_module_s*next;
+      char*name;
+      char*path;
+      bool export_flag;
+      char**tf_names;
+      unsigned tf_count;
+};
+
+static struct deferred_module_s*deferred_list = 0;
+
+static void deferred_module_free_(struct deferred_module_s*mod)
+{
+      for (unsigned idx = 0 ;  idx < mod->tf_count ;  idx += 1)
+	    free(mod->tf_names[idx]);
+      free(mod->tf_names);
+      free(mod->path);
+      free(mod->name);
+      free(mod);
+}
+
+static char**read_module_manifest_(const char*path, unsigned*count_out)
+{
+      char manifest[4096];
+      size_t len = strlen(path);
+
+	/* The path always ends in .vpi or .vpl here. */
+      if (len < 4 || len >= sizeof manifest)
+	    return 0;
+      strcpy(manifest, path);
+      strcpy(manifest + len - 4, ".vpm");
+
+      FILE*fd = fopen(manifest, "r");
+      if (fd == 0)
+	    return 0;
+
+      char**names = 0;
+      unsigned count = 0;
+      char line[512];
+      while (fgets(line, sizeof line, fd)) {
+	    char*cp = line + strspn(line, " \t");
+	    cp[strcspn(cp, " \t\r\n")] = 0;
+	    if (cp[0] == 0 || cp[0] == '#')
+		  continue;
+
+	    names = (char**)realloc(names, (count+1)*sizeof(char*));
+	    names[count] = strdup(cp);
+	    count += 1;
+      }
+      fclose(fd);
+
+      if (count == 0) {
+	    free(names);
+	    return 0;
+      }
+
+      *count_out = count;
+      return names;
+}
+
+/*
+ * Open the module file and run its startup routines. This is the tail
+ * of what vpip_load_module always did, split out so that deferred
+ * modules can go through it lazily, possibly from within compilation.
+ */
+static bool load_module_file_(const char*name, const char*path,
+			      bool export_flag)
+{
+      ivl_dll_t dll = ivl_dlopen(path, export_flag);
+      if (dll == 0) {
+	      /* this failed, let the user know what has really gone wrong */
+	    fprintf(stderr,"%s:`%s' failed to open using dlopen() because:\n"
+		    "    %s.\n", name, path, dlerror());
+	    return false;
+      }
+
+#ifdef __MINGW32__
+	/* For this check MinGW does not want the leading underscore! */
+      void*table = ivl_dlsym(dll, "vlog_startup_routines");
+#else
+      void*table = ivl_dlsym(dll, LU "vlog_startup_routines" TU);
+#endif
+      if (table == 0) {
+	    fprintf(stderr, "%s: no vlog_startup_routines\n", name);
+	    ivl_dlclose(dll);
+	    return false;
+      }
+
+	/* Add the dll to the list so it can be closed when we are done. */
+      dll_list_cnt += 1;
+      dll_list = (ivl_dll_t*)realloc(dll_list, dll_list_cnt*sizeof(ivl_dll_t));
+      dll_list[dll_list_cnt-1] = dll;
+
+      vpi_mode_t save_mode = vpi_mode_flag;
+      vpi_mode_flag = VPI_MODE_REGISTER;
+      vlog_startup_routines_t*routines = (vlog_startup_routines_t*)table;
+      for (unsigned tmp = 0 ;  routines[tmp] ;  tmp += 1)
+	    (routines[tmp])();
+      vpi_mode_flag = save_mode;
+      return true;
+}
+
+/*
+ * The systf name lookup calls this when a name is not registered. If
+ * a deferred module claims the name, load it now so the caller can
+ * look again. Returns true if a module was loaded.
+ */
+bool vpip_load_module_for_systf(const char*name)
+{
+      for (struct deferred_module_s**prev = &deferred_list ;  *prev ; ) {
+	    struct deferred_module_s*cur = *prev;
+
+	    bool match_flag = false;
+	    for (unsigned idx = 0 ;  idx < cur->tf_count ;  idx += 1) {
+		  if (strcmp(cur->tf_names[idx], name) == 0) {
+			match_flag = true;
+			break;
+		  }
+	    }
+
+	    if (! match_flag) {
+		  prev = &cur->next;
+		  continue;
+	    }
+
+	    *prev = cur->next;
+	    load_module_file_(cur->name, cur->path, cur->export_flag);
+	    deferred_module_free_(cur);
+	    return true;
+      }
+
+      return false;
+}
+
 
 const char* vpip_module_path[64] = {
 #ifdef MODULE_DIR1
@@ -60,6 +205,12 @@ void load_module_delete(void)
       free(dll_list);
       dll_list = 0;
       dll_list_cnt = 0;
+
+      while (deferred_list) {
+	    struct deferred_module_s*cur = deferred_list;
+	    deferred_list = cur->next;
+	    deferred_module_free_(cur);
+      }
 }
 
 void vpip_load_module(const char*name)
@@ -75,7 +226,6 @@ void vpip_load_module(const char*name)
       const char sep = '/';
 #endif
 
-      ivl_dll_t dll = 0;
       buf[0] = 0;                     /* terminate the string */
       if (strchr(name, sep)) {
 	      /* If the name has at least one directory character in
@@ -132,39 +282,24 @@ void vpip_load_module(const char*name)
 
       }
 
-      /* must have found some file that could possibly be a vpi module
-       * try to open it as a shared object.
+      /* must have found some file that could possibly be a vpi
+       * module. If it carries a manifest of the names it registers,
+       * put off the dlopen until one of the names is referenced.
        */
-      dll = ivl_dlopen(buf, export_flag);
-      if(dll==0) {
-	/* hmm, this failed, let the user know what has really gone wrong */
-	fprintf(stderr,"%s:`%s' failed to open using dlopen() because:\n"
-		"    %s.\n",name,buf,dlerror());
-
-	return;
-      }
-
-
-#ifdef __MINGW32__
-	/* For this check MinGW does not want the leading underscore! */
-      void*table = ivl_dlsym(dll, "vlog_startup_routines");
-#else
-      void*table = ivl_dlsym(dll, LU "vlog_startup_routines" TU);
-#endif
-      if (table == 0) {
-	    fprintf(stderr, "%s: no vlog_startup_routines\n", name);
-	    ivl_dlclose(dll);
+      unsigned tf_count = 0;
+      char**tf_names = read_module_manifest_(buf, &tf_count);
+      if (tf_names) {
+	    struct deferred_module_s*mod = (struct deferred_module_s*)
+		  malloc(sizeof(struct deferred_module_s));
+	    mod->name = strdup(name);
+	    mod->path = strdup(buf);
+	    mod->export_flag = export_flag;
+	    mod->tf_names = tf_names;
+	    mod->tf_count = tf_count;
+	    mod->next = deferred_list;
+	    deferred_list = mod;
 	    return;
       }
 
-	/* Add the dll to the list so it can be closed when we are done. */
-      dll_list_cnt += 1;
-      dll_list = (ivl_dll_t*)realloc(dll_list, dll_list_cnt*sizeof(ivl_dll_t));
-      dll_list[dll_list_cnt-1] = dll;
-
-      vpi_mode_flag = VPI_MODE_REGISTER;
-      vlog_startup_routines_t*routines = (vlog_startup_routines_t*)table;
-      for (unsigned tmp = 0 ;  routines[tmp] ;  tmp += 1)
-	    (routines[tmp])();
-      vpi_mode_flag = VPI_MODE_NONE;
+      load_module_file_(name, buf, export_flag);
 }
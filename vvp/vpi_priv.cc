@@ -623,9 +623,23 @@ void vpip_vec4_get_value(const vvp_vector4_t&word_val, unsigned width,
 
 	  case vpiBinStrVal:
 	    rbuf = need_result_buf(width+1, RBUF_VAL);
-	    for (unsigned idx = 0 ;  idx < width ;  idx += 1) {
-		  vvp_bit4_t bit = word_val.value(idx);
-		  rbuf[width-idx-1] = vvp_bit4_to_ascii(bit);
+	    if (width <= word_val.size() && ! word_val.has_xz()) {
+		    /* No X/Z bits, so pull the 2-state words out and
+		       emit digits straight from the bits instead of
+		       calling value() for each one. */
+		  unsigned long*awords = word_val.subarray(0, width);
+		  assert(awords);
+		  const unsigned wbits = 8 * sizeof(awords[0]);
+		  for (unsigned idx = 0 ;  idx < width ;  idx += 1) {
+			unsigned long bit = (awords[idx/wbits] >> (idx%wbits)) & 1;
+			rbuf[width-idx-1] = '0' + bit;
+		  }
+		  delete[]awords;
+	    } else {
+		  for (unsigned idx = 0 ;  idx < width ;  idx += 1) {
+			vvp_bit4_t bit = word_val.value(idx);
+			rbuf[width-idx-1] = vvp_bit4_to_ascii(bit);
+		  }
 	    }
 	    rbuf[width] = 0;
 	    vp->value.str = rbuf;
@@ -704,31 +718,15 @@ void vpip_vec4_get_value(const vvp_vector4_t&word_val, unsigned width,
 		s_vpi_vecval *op = (p_vpi_vecval)rbuf;
 		vp->value.vector = op;
 
-		op->aval = op->bval = 0;
-		for (unsigned idx = 0 ;  idx < width ;  idx += 1) {
-		      switch (word_val.value(idx)) {
-			  case BIT4_0:
-			    op->aval &= ~(1 << idx % 32);
-			    op->bval &= ~(1 << idx % 32);
-			    break;
-			  case BIT4_1:
-			    op->aval |=  (1 << idx % 32);
-			    op->bval &= ~(1 << idx % 32);
-			    break;
-			  case BIT4_X:
-			    op->aval |= (1 << idx % 32);
-			    op->bval |= (1 << idx % 32);
-			    break;
-			  case BIT4_Z:
-			    op->aval &= ~(1 << idx % 32);
-			    op->bval |=  (1 << idx % 32);
-			    break;
-		      }
-		      if (!((idx+1) % 32) && (idx+1 < width)) {
-			    op++;
-			    op->aval = op->bval = 0;
-		      }
-		}
+		  /* The vecval aval/bval encoding matches the vector4
+		     a/b bit planes, so copy the whole value across 32
+		     bits at a time instead of decoding each bit. */
+		unsigned use_wid = width;
+		if (use_wid > word_val.size())
+		      use_wid = word_val.size();
+		word_val.as_vpi_vecval(0, use_wid, op);
+		for (unsigned idx = (use_wid+31)/32 ;  idx < hwid ;  idx += 1)
+		      op[idx].aval = op[idx].bval = 0;
 		break;
 	  }
 
@@ -1507,3 +1505,105 @@ extern "C" void vpip_count_drivers(vpiHandle ref, unsigned idx,
       assert(rfp);
       rfp->node->count_drivers(idx, counts);
 }
+
+/*
+ * Columnar aggregate sampling, for coverage-style monitors that read
+ * thousands of small counters on every sample event. A group
+ * registers the signal handles once; each fill then copies the
+ * current aval/bval planes of all the members into the caller's
+ * buffer in registration order, in one linear sweep with no per-item
+ * VPI dispatch or format decoding. Members whose value can be read
+ * directly copy straight from the stored vector; a forced signal
+ * falls back to the filtered value.
+ */
+
+# include  "vvp_net_sig.h"
+
+struct sample_member_s {
+      vvp_signal_value*vsig;
+      unsigned width;
+      unsigned words;
+};
+
+struct sample_group_s {
+      struct sample_member_s*members;
+      unsigned member_cnt;
+      unsigned total_words;
+};
+
+static struct sample_group_s**sample_groups = 0;
+static unsigned sample_groups_cnt = 0;
+
+extern "C" PLI_INT32 vpip_sample_group_create(vpiHandle*items, PLI_UINT32 cnt)
+{
+      struct sample_group_s*grp = (struct sample_group_s*)
+	    malloc(sizeof(struct sample_group_s));
+      grp->members = (struct sample_member_s*)
+	    calloc(cnt, sizeof(struct sample_member_s));
+      grp->member_cnt = cnt;
+      grp->total_words = 0;
+
+      for (unsigned idx = 0 ; idx < cnt ; idx += 1) {
+	    struct __vpiSignal*rfp = dynamic_cast<__vpiSignal*>(items[idx]);
+	    vvp_signal_value*vsig = rfp
+		  ? dynamic_cast<vvp_signal_value*>(rfp->node->fil)
+		  : 0;
+	    if (vsig == 0) {
+		  free(grp->members);
+		  free(grp);
+		  return -1;
+	    }
+	    grp->members[idx].vsig = vsig;
+	    grp->members[idx].width = vpip_size(rfp);
+	    grp->members[idx].words = (grp->members[idx].width + 31) / 32;
+	    grp->total_words += grp->members[idx].words;
+      }
+
+      sample_groups = (struct sample_group_s**)
+	    realloc(sample_groups,
+		    (sample_groups_cnt+1) * sizeof(*sample_groups));
+      sample_groups[sample_groups_cnt] = grp;
+      return sample_groups_cnt++;
+}
+
+extern "C" PLI_INT32 vpip_sample_group_size(PLI_INT32 group_id)
+{
+      assert(group_id >= 0 && (unsigned)group_id < sample_groups_cnt);
+      struct sample_group_s*grp = sample_groups[group_id];
+      assert(grp);
+      return grp->total_words;
+}
+
+extern "C" void vpip_sample_group_fill(PLI_INT32 group_id, p_vpi_vecval buf)
+{
+      assert(group_id >= 0 && (unsigned)group_id < sample_groups_cnt);
+      struct sample_group_s*grp = sample_groups[group_id];
+      assert(grp);
+
+      p_vpi_vecval op = buf;
+      for (unsigned idx = 0 ; idx < grp->member_cnt ; idx += 1) {
+	    struct sample_member_s*cur = grp->members + idx;
+	    const vvp_vector4_t*direct = cur->vsig->vec4_direct();
+	    if (direct && direct->size() == cur->width) {
+		  direct->as_vpi_vecval(0, cur->width, op);
+	    } else {
+		  vvp_vector4_t tmp;
+		  cur->vsig->vec4_value(tmp);
+		  if (tmp.size() != cur->width)
+			tmp.resize(cur->width);
+		  tmp.as_vpi_vecval(0, cur->width, op);
+	    }
+	    op += cur->words;
+      }
+}
+
+extern "C" void vpip_sample_group_delete(PLI_INT32 group_id)
+{
+      assert(group_id >= 0 && (unsigned)group_id < sample_groups_cnt);
+      struct sample_group_s*grp = sample_groups[group_id];
+      if (grp == 0) return;
+
+      free(grp->members);
+      free(grp);
+      sample_groups[group_id] = 0;
+}
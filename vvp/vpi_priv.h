@@ -26,6 +26,7 @@
 # include  <map>
 # include  <set>
 # include  <string>
+# include  <vector>
 
 /*
  * Added to use some "vvp_fun_modpath_src"
@@ -51,8 +52,16 @@ class class_type;
 extern bool show_file_line;
 extern bool code_is_instrumented;
 
-extern vpiHandle vpip_build_file_line(char*description,
-                                      long file_idx, long lineno);
+/*
+ * File/line records live in a compact side table and are referred to
+ * by index. vpip_add_file_line enters a record (deduplicating where it
+ * can) and returns its index; index 0 means "no record". The vpiHandle
+ * view of a record is built on demand by vpip_file_line_handle, so
+ * records that are never displayed stay a few words each.
+ */
+extern unsigned vpip_add_file_line(char*description,
+                                   long file_idx, long lineno);
+extern vpiHandle vpip_file_line_handle(unsigned idx);
 
 /*
  * Private VPI properties that are only used in the cleanup code.
@@ -226,6 +235,8 @@ struct __vpiScope : public __vpiHandle {
 	/* The scope has a name. */
       const char*name;
       const char*tname;
+	/* Lazily composed full name, in permallocated storage. */
+      const char*fullname_cache;
       unsigned file_idx;
       unsigned lineno;
       unsigned def_file_idx;
@@ -258,6 +269,9 @@ struct __vpiScope : public __vpiHandle {
 };
 
 extern struct __vpiScope* vpip_peek_current_scope(void);
+	/* Get the full hierarchical name of the scope, from the
+	   permallocated cache. */
+extern const char* vpip_scope_fullname(struct __vpiScope*scope);
 extern void vpip_attach_to_scope(struct __vpiScope*scope, vpiHandle obj);
 extern void vpip_attach_to_current_scope(vpiHandle obj);
 extern struct __vpiScope* vpip_peek_context_scope(void);
@@ -295,6 +309,12 @@ struct __vpiSignal : public __vpiHandle {
       unsigned is_netarray  : 1; // This is word of a net array
 	/* The represented value is here. */
       vvp_net_t*node;
+	/* Lazily composed vpiFullName, in permallocated storage. */
+      const char*fullname_cache;
+	/* Lazily bound value interface of node->fil. Monitors and
+	   dumpers read the same handle forever, so the bind is done
+	   once and repeated vpi_get_value calls skip the cast. */
+      class vvp_signal_value*vsig_cache;
 
     public:
       static void*operator new(std::size_t size);
@@ -336,6 +356,8 @@ struct __vpiPV : public __vpiHandle {
       int tbase;
       unsigned twid, width;
       bool is_signed;
+	/* Lazily bound value interface of net->fil, as in __vpiSignal. */
+      class vvp_signal_value*vsig_cache;
 };
 extern vpiHandle vpip_make_PV(char*name, int base, int width);
 extern vpiHandle vpip_make_PV(char*name, char*symbol, int width);
@@ -425,22 +447,28 @@ class __vpiNamedEvent : public __vpiHandle {
       vpiHandle vpi_handle(int code);
 
       inline void add_vpi_callback(__vpiCallback*cb)
-      { cb->next = callbacks_;
-	callbacks_ = cb;
+      { cb->next = 0;
+	callbacks_.push_back(cb);
       }
 
-      void run_vpi_callbacks(void);
+	/* Most named events have no VPI callbacks attached at all,
+	   so test that inline and keep the dispatch out of line. */
+      inline void run_vpi_callbacks(void)
+      { if (! callbacks_.empty()) run_vpi_callbacks_(); }
 
 	/* The functor, used for %set operations. */
       vvp_net_t*funct;
 
     private:
+      void run_vpi_callbacks_(void);
+
 	/* base name of the event object */
       const char*name_;
 	/* Parent scope of this object. */
       struct __vpiScope*scope_;
-	/* List of callbacks interested in this event. */
-      __vpiCallback*callbacks_;
+	/* Callbacks interested in this event, kept compact so a
+	   trigger sweeps a contiguous array. */
+      std::vector<__vpiCallback*> callbacks_;
 };
 
 extern vpiHandle vpip_make_named_event(const char*name, vvp_net_t*f);
@@ -560,6 +588,13 @@ struct __vpiUserSystf : public __vpiHandle {
 
 extern vpiHandle vpip_make_systf_iterator(void);
 
+/*
+ * Register the $ivl_watchpoint system task that the core provides.
+ * This is implemented in vpi_callback.cc and called from
+ * vvp_vpi_init().
+ */
+extern void watchpoint_register_systf(void);
+
 extern struct __vpiUserSystf* vpip_find_systf(const char*name);
 
 
@@ -617,7 +652,13 @@ struct __vpiBinaryConst : public __vpiHandle {
       int sized_flag   :1;
 };
 
-vpiHandle vpip_make_binary_const(unsigned wid, const char*bits);
+/*
+ * The shared flag to vpip_make_binary_const causes the handle to be
+ * interned, so that identical constants share one handle. Shared
+ * handles must never be written to.
+ */
+vpiHandle vpip_make_binary_const(unsigned wid, const char*bits,
+                                 bool shared =false);
 vpiHandle vpip_make_binary_param(char*name, const vvp_vector4_t&bits,
 				 bool signed_flag, bool local_flag,
 				 long file_idx, long lineno);
@@ -671,6 +712,15 @@ vpiHandle vpip_make_vthr_APV(char*label, unsigned index, unsigned bit, unsigned
  */
 extern void vpip_load_module(const char*name);
 
+/*
+ * A module that ships a .vpm manifest of the names it registers is
+ * not dlopen'ed by vpip_load_module at all; the systf name lookup
+ * calls this when a name is missing, to load the module that claims
+ * it. Returns true if a module was loaded (so the lookup should be
+ * repeated), false if no deferred module has the name.
+ */
+extern bool vpip_load_module_for_systf(const char*name);
+
 # define VPIP_MODULE_PATH_MAX 64
 extern const char* vpip_module_path[64];
 extern unsigned vpip_module_path_cnt;
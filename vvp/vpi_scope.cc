@@ -170,14 +170,36 @@ static int scope_get(int code, vpiHandle obj)
       return vpiUndefined;
 }
 
-static void construct_scope_fullname(struct __vpiScope*ref, char*buf)
+/*
+ * Compose the full name of the scope on first use and keep it in
+ * permallocated string storage. Every signal in the scope queries
+ * this for its own vpiFullName, so the walk up the scope chain and
+ * the string assembly happen only once per scope, and children reuse
+ * the parent's cached prefix.
+ */
+static const char* scope_fullname(struct __vpiScope*ref)
 {
-      if (ref->scope) {
-	    construct_scope_fullname(ref->scope, buf);
-	    strcat(buf, ".");
+      if (ref->fullname_cache == 0) {
+	    if (ref->scope) {
+		  const char*prefix = scope_fullname(ref->scope);
+		  char*buf = new char[strlen(prefix) + strlen(ref->name) + 2];
+		  strcpy(buf, prefix);
+		  strcat(buf, ".");
+		  strcat(buf, ref->name);
+		  ref->fullname_cache = vpip_string(buf);
+		  delete[]buf;
+	    } else {
+		    /* A root scope name is already permallocated. */
+		  ref->fullname_cache = ref->name;
+	    }
       }
 
-      strcat(buf, ref->name);
+      return ref->fullname_cache;
+}
+
+const char* vpip_scope_fullname(struct __vpiScope*scope)
+{
+      return scope_fullname(scope);
 }
 
 static const char* scope_get_type(int code)
@@ -204,7 +226,6 @@ static char* scope_get_str(int code, vpiHandle obj)
       struct __vpiScope*ref = dynamic_cast<__vpiScope*>(obj);
       assert(ref);
 
-      char buf[4096];  // XXX is a fixed buffer size really reliable?
       const char *p=0;
       switch (code) {
 	  case vpiDefFile:
@@ -216,9 +237,7 @@ static char* scope_get_str(int code, vpiHandle obj)
 	    break;
 
 	  case vpiFullName:
-	    buf[0] = 0;
-	    construct_scope_fullname(ref, buf);
-	    p = buf;
+	    p = scope_fullname(ref);
 	    break;
 
 	  case vpiName:
@@ -291,26 +310,70 @@ static int compare_types(int code, int type)
       return 0;
 }
 
-static vpiHandle module_iter_subset(int code, struct __vpiScope*ref)
+/*
+ * Iterate over the internal scope items lazily. The iterator holds a
+ * cursor into the intern table and applies the type filter as
+ * vpi_scan advances it, so no snapshot of the matching handles is
+ * taken. A scan that stops after a few items then costs nothing
+ * proportional to the scope size.
+ */
+struct __vpiScopeIterator : public __vpiHandle {
+      __vpiScopeIterator();
+      int get_type_code(void) const;
+      vpiHandle vpi_index(int idx);
+      free_object_fun_t free_object_fun(void);
+
+      struct __vpiScope*scope;
+      int code;
+      unsigned next;
+};
+
+inline __vpiScopeIterator::__vpiScopeIterator()
+{ }
+
+int __vpiScopeIterator::get_type_code(void) const
+{ return vpiIterator; }
+
+vpiHandle __vpiScopeIterator::vpi_index(int)
 {
-      unsigned mcnt = 0, ncnt = 0;
-      vpiHandle*args;
+      while (next < scope->nintern) {
+	    vpiHandle cur = scope->intern[next];
+	    next += 1;
+	    if (compare_types(code, cur->get_type_code()))
+		  return cur;
+      }
 
-      for (unsigned idx = 0 ;  idx < ref->nintern ;  idx += 1)
-	    if (compare_types(code, ref->intern[idx]->get_type_code()))
-		  mcnt += 1;
+      vpi_free_object(this);
+      return 0;
+}
 
-      if (mcnt == 0)
-	    return 0;
+static int scope_iterator_free_object(vpiHandle ref)
+{
+      struct __vpiScopeIterator*obj = dynamic_cast<__vpiScopeIterator*>(ref);
+      delete obj;
+      return 1;
+}
 
-      args = (vpiHandle*)calloc(mcnt, sizeof(vpiHandle));
-      for (unsigned idx = 0 ;  idx < ref->nintern ;  idx += 1)
-	    if (compare_types(code, ref->intern[idx]->get_type_code()))
-		  args[ncnt++] = ref->intern[idx];
+__vpiHandle::free_object_fun_t __vpiScopeIterator::free_object_fun(void)
+{ return &scope_iterator_free_object; }
 
-      assert(ncnt == mcnt);
+static vpiHandle module_iter_subset(int code, struct __vpiScope*ref)
+{
+	/* The iterate method must return nil when no objects match,
+	   so find the first match before making the iterator. */
+      unsigned first = 0;
+      while (first < ref->nintern
+	     && !compare_types(code, ref->intern[first]->get_type_code()))
+	    first += 1;
+
+      if (first == ref->nintern)
+	    return 0;
 
-      return vpip_make_iterator(mcnt, args, true);
+      struct __vpiScopeIterator*res = new __vpiScopeIterator;
+      res->scope = ref;
+      res->code = code;
+      res->next = first;
+      return res;
 }
 
 /*
@@ -439,6 +502,7 @@ compile_scope_decl(char*label, char*type, char*name, char*tname,
       scope->name = vpip_name_string(name);
       if (tname) scope->tname = vpip_name_string(tname);
       else scope->tname = vpip_name_string("");
+      scope->fullname_cache = 0;
       scope->file_idx = (unsigned) file_idx;
       scope->lineno  = (unsigned) lineno;
       scope->def_file_idx = (unsigned) def_file_idx;
@@ -148,11 +148,17 @@ static void format_vpiBinStrVal(vvp_signal_value*sig, int base, unsigned wid,
       long offset = end - 1;
       long ssize = (signed)sig->value_size();
 
+	/* Fetch the whole vector with one virtual call instead of
+	   one per bit. The local copy shares the payload of the
+	   source vector until either is written. */
+      vvp_vector4_t bits;
+      sig->vec4_value(bits);
+
       for (long idx = base ;  idx < end ;  idx += 1) {
 	    if (idx < 0 || idx >= ssize) {
                   rbuf[offset-idx] = 'x';
 	    } else {
-                  rbuf[offset-idx] = vvp_bit4_to_ascii(sig->value(idx));
+                  rbuf[offset-idx] = vvp_bit4_to_ascii(bits.value(idx));
 	    }
       }
       rbuf[wid] = 0;
@@ -169,13 +175,16 @@ static void format_vpiOctStrVal(vvp_signal_value*sig, int base, unsigned wid,
       long ssize = (signed)sig->value_size();
       unsigned val = 0;
 
+      vvp_vector4_t bits;
+      sig->vec4_value(bits);
+
       rbuf[dwid] = 0;
       for (long idx = base ;  idx < end ;  idx += 1) {
 	    unsigned bit = 0;
 	    if (idx < 0 || idx >= ssize) {
                   bit = 2; // BIT4_X
 	    } else {
-                  switch (sig->value(idx)) {
+                  switch (bits.value(idx)) {
 		      case BIT4_0:
 			bit = 0;
 			break;
@@ -225,13 +234,16 @@ static void format_vpiHexStrVal(vvp_signal_value*sig, int base, unsigned wid,
       long ssize = (signed)sig->value_size();
       unsigned val = 0;
 
+      vvp_vector4_t bits;
+      sig->vec4_value(bits);
+
       rbuf[dwid] = 0;
       for (long idx = base ;  idx < end ;  idx += 1) {
 	    unsigned bit = 0;
 	    if (idx < 0 || idx >= ssize) {
                   bit = 2; // BIT4_X
 	    } else {
-                  switch (sig->value(idx)) {
+                  switch (bits.value(idx)) {
 		      case BIT4_0:
 			bit = 0;
 			break;
@@ -600,6 +612,11 @@ static char* signal_get_str(int code, vpiHandle ref)
 
       if ((code != vpiName) && (code != vpiFullName)) return NULL;
 
+	/* The composed full name never changes, so answer later
+	   queries from the copy cached by the first one. */
+      if ((code == vpiFullName) && rfp->fullname_cache)
+	    return simple_set_rbuf_str(rfp->fullname_cache);
+
       char *nm, *ixs;
       if (rfp->is_netarray) {
 	    nm = strdup(vpi_get_str(vpiName, rfp->within.parent));
@@ -615,6 +632,8 @@ static char* signal_get_str(int code, vpiHandle ref)
 	/* The scope information is added here for vpiFullName. */
       char *rbuf = generic_get_str(code, vpip_scope(rfp), nm, ixs);
       free(nm);
+      if ((code == vpiFullName) && rbuf)
+	    rfp->fullname_cache = vpip_string(rbuf);
       return rbuf;
 }
 
@@ -674,8 +693,14 @@ static void signal_get_value(vpiHandle ref, s_vpi_value*vp)
 
       unsigned wid = signal_width(rfp);
 
-      vvp_signal_value*vsig = dynamic_cast<vvp_signal_value*>(rfp->node->fil);
-      assert(vsig);
+	/* Bind the value interface of the filter once; after that
+	   every call on this handle is a plain load. */
+      vvp_signal_value*vsig = rfp->vsig_cache;
+      if (vsig == 0) {
+	    vsig = dynamic_cast<vvp_signal_value*>(rfp->node->fil);
+	    assert(vsig);
+	    rfp->vsig_cache = vsig;
+      }
 
       switch (vp->format) {
 
@@ -1098,6 +1123,8 @@ static vpiHandle fill_in_net4(struct __vpiSignal*obj,
       obj->signed_flag = signed_flag? 1 : 0;
       obj->is_netarray = 0;
       obj->node = node;
+      obj->fullname_cache = 0;
+      obj->vsig_cache = 0;
 
 	// Place this object within a scope. If this object is
 	// attached to an array, then this value will be replaced with
@@ -1248,8 +1275,12 @@ static void PV_get_value(vpiHandle ref, p_vpi_value vp)
       struct __vpiPV*rfp = dynamic_cast<__vpiPV*>(ref);
       assert(rfp);
 
-      vvp_signal_value*sig = dynamic_cast<vvp_signal_value*>(rfp->net->fil);
-      assert(sig);
+      vvp_signal_value*sig = rfp->vsig_cache;
+      if (sig == 0) {
+	    sig = dynamic_cast<vvp_signal_value*>(rfp->net->fil);
+	    assert(sig);
+	    rfp->vsig_cache = sig;
+      }
 
       switch (vp->format) {
 
@@ -1366,7 +1397,7 @@ static vpiHandle PV_get_handle(int code, vpiHandle ref)
 }
 
 inline __vpiPV::__vpiPV()
-{ }
+{ vsig_cache = 0; }
 
 int __vpiPV::get_type_code(void) const
 { return vpiPartSelect; }
@@ -25,6 +25,7 @@
 # include  "vpi_priv.h"
 # include  "vthread.h"
 # include  "compile.h"
+# include  "sfunc.h"
 # include  "config.h"
 #ifdef CHECK_WITH_VALGRIND
 # include  "vvp_cleanup.h"
@@ -384,6 +385,10 @@ static vpiHandle sysfunc_put_4net_value(vpiHandle ref, p_vpi_value vp, int)
 	    assert(0);
       }
 
+	/* If a memoizing .sfunc/m core is waiting on this call, let it
+	   record the result before it goes out. */
+      sfunc_memo_capture_vec4(val);
+
       rfp->fnet->send_vec4(val, vthread_get_wt_context());
       return 0;
 }
@@ -407,6 +412,8 @@ static vpiHandle sysfunc_put_rnet_value(vpiHandle ref, p_vpi_value vp, int)
 	    assert(0);
       }
 
+      sfunc_memo_capture_real(val);
+
       rfp->fnet->send_real(val, vthread_get_wt_context());
 
       return 0;
@@ -619,6 +626,14 @@ struct __vpiUserSystf* vpip_find_systf(const char*name)
 	    if (strcmp(def_table[idx]->info.tfname, name) == 0)
 		  return def_table[idx];
 
+	/* The name is not registered. If a module with a deferred
+	   load claims it, load that module now and look again. */
+      if (vpip_load_module_for_systf(name)) {
+	    for (unsigned idx = 0 ;  idx < def_count ;  idx += 1)
+		  if (strcmp(def_table[idx]->info.tfname, name) == 0)
+			return def_table[idx];
+      }
+
       return 0;
 }
 
@@ -21,6 +21,7 @@
 # include  "vpi_priv.h"
 # include  "schedule.h"
 # include  <cstdio>
+# include  <cstring>
 # include  <cmath>
 # include  <cassert>
 
@@ -101,6 +102,18 @@ static void timevar_get_value(vpiHandle ref, s_vpi_value*vp, bool is_int_func,
 	   the caller. */
       static struct t_vpi_time time_value;
 
+	/* Within a delta the simulation time does not change, but a
+	   log-heavy run makes this query for every %t of every
+	   $display line. Cache the scaling from the last call, keyed
+	   on the raw time and the scope units, and the decimal text,
+	   keyed on the scaled value. */
+      static vvp_time64_t cache_raw, cache_scaled;
+      static int cache_units;
+      static bool cache_valid = false;
+      static vvp_time64_t cache_dec_key;
+      static char cache_dec[24];
+      static bool cache_dec_valid = false;
+
       struct __vpiSystemTime*rfp = dynamic_cast<__vpiSystemTime*>(ref);
       unsigned long num_bits;
       vvp_time64_t x, simtime = schedule_simtime();
@@ -108,21 +121,34 @@ static void timevar_get_value(vpiHandle ref, s_vpi_value*vp, bool is_int_func,
 
       char*rbuf = need_result_buf(128, RBUF_VAL);
 
-	/* Calculate the divisor needed to scale the simulation time
-	   (in time_precision units) to time units of the scope. */
-      vvp_time64_t divisor = 1;
-      while (units > vpi_time_precision) {
-	    divisor *= 10;
-	    units -= 1;
-      }
+      if (cache_valid && (simtime == cache_raw) && (units == cache_units)) {
+	    simtime = cache_scaled;
+
+      } else {
+	    vvp_time64_t raw_time = simtime;
+
+	      /* Calculate the divisor needed to scale the simulation time
+		 (in time_precision units) to time units of the scope. */
+	    vvp_time64_t divisor = 1;
+	    int use_units = units;
+	    while (use_units > vpi_time_precision) {
+		  divisor *= 10;
+		  use_units -= 1;
+	    }
 
-	/* Scale the simtime, and use the modulus to round up if
-	   appropriate. */
-      vvp_time64_t simtime_fraction = simtime % divisor;
-      simtime /= divisor;
+	      /* Scale the simtime, and use the modulus to round up if
+		 appropriate. */
+	    vvp_time64_t simtime_fraction = simtime % divisor;
+	    simtime /= divisor;
 
-      if ((divisor >= 10) && (simtime_fraction >= (divisor/2)))
-	    simtime += 1;
+	    if ((divisor >= 10) && (simtime_fraction >= (divisor/2)))
+		  simtime += 1;
+
+	    cache_raw = raw_time;
+	    cache_units = units;
+	    cache_scaled = simtime;
+	    cache_valid = true;
+      }
 
 	/* If this is a call to $stime only return the lower 32 bits. */
       if (is_stime) simtime &= 0xffffffff;
@@ -161,7 +187,14 @@ static void timevar_get_value(vpiHandle ref, s_vpi_value*vp, bool is_int_func,
 	    break;
 
 	  case vpiDecStrVal:
-	    sprintf(rbuf, "%" TIME_FMT_U, simtime);
+	    if (cache_dec_valid && (simtime == cache_dec_key)) {
+		  strcpy(rbuf, cache_dec);
+	    } else {
+		  sprintf(rbuf, "%" TIME_FMT_U, simtime);
+		  strcpy(cache_dec, rbuf);
+		  cache_dec_key = simtime;
+		  cache_dec_valid = true;
+	    }
 	    vp->value.str = rbuf;
 	    break;
 
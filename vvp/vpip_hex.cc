@@ -146,6 +146,24 @@ void vpip_vec4_to_hex_str(const vvp_vector4_t&bits, char*buf, unsigned nbuf)
 
       buf[slen] = 0;
 
+	/* If there are no X or Z bits anywhere in the vector, pull
+	   the 2-state words out and convert a whole digit at a time
+	   instead of assembling each digit bit by bit. This is the
+	   path that wide $display("%h",...) of clean values takes. */
+      if (! bits.has_xz()) {
+	    static const char two_state_digits[17] = "0123456789abcdef";
+	    unsigned long*awords = bits.subarray(0, bits.size());
+	    assert(awords);
+	    const unsigned WBITS = 8 * sizeof(awords[0]);
+	    for (unsigned dig = 0 ;  dig < slen ;  dig += 1) {
+		  unsigned base = dig * 4;
+		  unsigned nib = (awords[base/WBITS] >> (base%WBITS)) & 15;
+		  buf[slen-1-dig] = two_state_digits[nib];
+	    }
+	    delete[]awords;
+	    return;
+      }
+
       unsigned val = 0;
       for (unsigned idx = 0 ;  idx < bits.size() ;  idx += 1) {
 	    unsigned vs = (idx%4) * 2;
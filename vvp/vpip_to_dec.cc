@@ -156,6 +156,30 @@ unsigned vpip_vec4_to_dec_str(const vvp_vector4_t&vec4,
 	    memset(valv,0,vlen*sizeof(valv[0]));
       }
 
+	/* If there are no X or Z bits anywhere in the value, shift the
+	 * 2-state words into the base BASE accumulator BBITS bits at a
+	 * time instead of one bit at a time. BBITS always divides the
+	 * word size, so the chunks never straddle word boundaries. */
+      if (mbits > 0 && ! vec4.has_xz()) {
+	    unsigned long*awords = vec4.subarray(0, mbits);
+	    assert(awords);
+	    const unsigned WBITS = 8 * sizeof(awords[0]);
+	    unsigned nchunks = (mbits + BBITS - 1) / BBITS;
+	    for (idx = 0; idx < nchunks; idx += 1) {
+		  unsigned base = (nchunks-idx-1) * BBITS;
+		  unsigned cwid = mbits - base;
+		  if (cwid > BBITS) cwid = BBITS;
+		  unsigned long chunk = awords[base/WBITS] >> (base%WBITS);
+		  if (comp) chunk = ~chunk;
+		  chunk &= (1UL << cwid) - 1;
+		    /* make negative 2's complement, not 1's complement */
+		  if (comp && idx == nchunks-1) chunk += 1;
+		  shift_in(valv, vlen, chunk);
+	    }
+	    delete[]awords;
+	    mbits = 0;
+      }
+
       for (idx = 0; idx < mbits; idx += 1) {
 	      /* printf("%c ",bits[mbits-idx-1]); */
 	    switch (vec4.value(mbits-idx-1)) {
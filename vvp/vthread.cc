@@ -28,9 +28,11 @@
 # include  "vvp_cobject.h"
 # include  "vvp_darray.h"
 # include  "class_type.h"
+# include  "slab.h"
 #ifdef CHECK_WITH_VALGRIND
 # include  "vvp_cleanup.h"
 #endif
+# include  <map>
 # include  <set>
 # include  <typeinfo>
 # include  <vector>
@@ -43,6 +45,11 @@
 # include  <iostream>
 # include  <cstdio>
 
+#if defined(HAVE_SYS_RESOURCE_H)
+# include  <csignal>
+# include  <sys/time.h>
+#endif
+
 using namespace std;
 
 /* This is the size of an unsigned long in bits. This is just a
@@ -196,6 +203,21 @@ struct vthread_s {
 	    stack_obj_size_ += 1;
       }
 
+	/* Release the heap storage of a thread that is dead but
+	   cannot be deleted yet. A killed thread that is parked in
+	   the time wheel (the watchdog pattern: fork a %delay and
+	   %disable it when the protected work finishes) stays there
+	   as a zombie until its timeout expires, and only of_ZOMBIE
+	   runs then, so the value stacks and thread bits can be
+	   freed at kill time instead of expiry time. */
+      inline void release_storage(void)
+      {
+	    bits4 = vvp_vector4_t();
+	    vector<double>().swap(stack_real_);
+	    vector<string>().swap(stack_str_);
+	    pop_object(stack_obj_size_);
+      }
+
 	/* My parent sets this when it wants me to wake it up. */
       unsigned i_am_joining      :1;
       unsigned i_have_ended      :1;
@@ -217,6 +239,20 @@ struct vthread_s {
 	/* These are used to pass non-blocking event control information. */
       vvp_net_t*event;
       uint64_t ecount;
+	/* The most recent %file_line executed by this thread, as an
+	   index into the file/line table, for the sampling profiler.
+	   Zero if the code is not instrumented. */
+      unsigned file_line;
+	/* Sequential creation number. Thread creation order is
+	   reproducible for a given .vvp input, so this identifies
+	   the same thread across runs for the scheduler replay. */
+      unsigned long id;
+
+	/* Thread structures are created and reaped at very high
+	   rates by fork/join and automatic task calls, so they are
+	   recycled through a pool instead of the system allocator. */
+      static void* operator new(size_t);
+      static void operator delete(void*);
 };
 
 inline vthread_s::vthread_s()
@@ -224,16 +260,361 @@ inline vthread_s::vthread_s()
       stack_obj_size_ = 0;
 }
 
+/*
+** vthread_s objects are required a lot, at high frequency. They are
+** not permanent, so they are pooled in the same spirit as the event
+** structures in schedule.cc, with the slab_t handling the recycling.
+*/
+static const size_t THREAD_CHUNK_COUNT = 64*1024 / sizeof(struct vthread_s);
+static slab_t<sizeof(vthread_s),THREAD_CHUNK_COUNT> vthread_heap;
+
+void* vthread_s::operator new(size_t size)
+{
+      assert(size == sizeof(struct vthread_s));
+      return vthread_heap.alloc_slab();
+}
+
+void vthread_s::operator delete(void*ptr)
+{
+      vthread_heap.free_slab(ptr);
+}
+
 static bool test_joinable(vthread_t thr, vthread_t child);
 static void do_join(vthread_t thr, vthread_t child);
 
+/*
+ * Optional hot-block profile, enabled by setting the environment
+ * variable VVP_PROFILE_BLOCKS to an output path. Each time a thread
+ * is resumed, the entry program counter is counted. This is the
+ * tier-up trigger a native-code backend would key from, and until one
+ * exists the dump (sorted by resume count, with the owning scope)
+ * tells us which behavioral blocks dominate a run. The cost is one
+ * map update per thread resume, nothing per instruction, and nothing
+ * at all when the variable is not set.
+ *
+ * The owning scope is written as its full hierarchical name, which is
+ * stable across compiles of the same design. The tgt-vvp code
+ * generator parses this dump (see -pprofile) and aggregates the
+ * counts per scope to bias its emission choices on the next compile.
+ */
+struct block_profile_s {
+      unsigned long count;
+      const char*scope_name;
+};
+static map<vvp_code_t, block_profile_s> block_profile_table;
+static const char*block_profile_path = 0;
+
+static void block_profile_dump(void)
+{
+      FILE*fd = fopen(block_profile_path, "w");
+      if (fd == 0)
+	    return;
+
+      multimap<unsigned long, pair<vvp_code_t, const char*> > sorted;
+      for (map<vvp_code_t, block_profile_s>::iterator cur
+		 = block_profile_table.begin()
+		 ; cur != block_profile_table.end() ; ++ cur) {
+	    sorted.insert(make_pair(cur->second.count,
+				    make_pair(cur->first,
+					      cur->second.scope_name)));
+      }
+
+      for (multimap<unsigned long, pair<vvp_code_t, const char*> >
+		 ::reverse_iterator cur = sorted.rbegin()
+		 ; cur != sorted.rend() ; ++ cur) {
+	    fprintf(fd, "%p %12lu %s\n", (void*)cur->second.first,
+		    cur->first, cur->second.second);
+      }
+
+      fclose(fd);
+}
+
+static void block_profile_count(vthread_t thr)
+{
+      block_profile_s&cell = block_profile_table[thr->pc];
+      cell.count += 1;
+      if (cell.scope_name == 0 && thr->parent_scope)
+	    cell.scope_name = vpip_scope_fullname(thr->parent_scope);
+}
+
+static bool block_profile_init(void)
+{
+      block_profile_path = getenv("VVP_PROFILE_BLOCKS");
+      if (block_profile_path == 0)
+	    return false;
+
+      atexit(&block_profile_dump);
+      return true;
+}
+
 struct __vpiScope* vthread_scope(struct vthread_s*thr)
 {
       return thr->parent_scope;
 }
 
+unsigned long vthread_get_id(struct vthread_s*thr)
+{
+      return thr->id;
+}
+
+/*
+ * Optional sampling profiler, enabled by setting the environment
+ * variable VVP_PROFILE_SAMPLE to an output path. A profiling timer
+ * interrupts the run at a regular interval and the handler records
+ * which thread (if any) was executing, along with its scope and, when
+ * the code is instrumented with %file_line, the source line it was
+ * on. The report written at exit attributes run time to module
+ * instances and source lines. The handler only stores pointers into a
+ * preallocated buffer, so sampling costs a few stores per tick and
+ * nothing at all when the variable is not set.
+ */
+#if defined(HAVE_SYS_RESOURCE_H)
+
+struct sample_s {
+      struct __vpiScope*scope;
+      unsigned file_line;
+};
+
+	/* At the 1ms period, the sample limit covers a bit over four
+	   minutes of CPU time. Samples past the limit are dropped,
+	   and the report says so. */
+static const unsigned SAMPLE_LIMIT = 256*1024;
+static const long SAMPLE_PERIOD_US = 1000;
+
+static struct sample_s*sample_buf = 0;
+static volatile unsigned sample_cnt = 0;
+static const char*sample_path = 0;
+
+extern struct vthread_s*running_thread;
+
+static void sample_profile_sigprof(int)
+{
+      if (sample_cnt >= SAMPLE_LIMIT)
+	    return;
+
+      struct sample_s&cell = sample_buf[sample_cnt];
+      if (running_thread) {
+	    cell.scope = running_thread->parent_scope;
+	    cell.file_line = running_thread->file_line;
+      } else {
+	      /* The tick landed outside thread code: functor
+		 propagation, event scheduling, or VPI work. */
+	    cell.scope = 0;
+	    cell.file_line = 0;
+      }
+      sample_cnt = sample_cnt + 1;
+}
+
+static void sample_scope_path(FILE*fd, struct __vpiScope*scope)
+{
+      if (scope->scope) {
+	    sample_scope_path(fd, scope->scope);
+	    fprintf(fd, ".");
+      }
+      fprintf(fd, "%s", scope->name);
+}
+
+static void sample_profile_dump(void)
+{
+	/* Disarm the timer before taking the buffer apart. */
+      struct itimerval stop;
+      stop.it_interval.tv_sec = 0;
+      stop.it_interval.tv_usec = 0;
+      stop.it_value = stop.it_interval;
+      setitimer(ITIMER_PROF, &stop, 0);
+      signal(SIGPROF, SIG_IGN);
+
+      FILE*fd = fopen(sample_path, "w");
+      if (fd == 0)
+	    return;
+
+      unsigned total = sample_cnt;
+      fprintf(fd, "%u samples at %ld us of profiled CPU time each\n",
+	      total, SAMPLE_PERIOD_US);
+      if (total == SAMPLE_LIMIT)
+	    fprintf(fd, "(sample buffer filled; later time is not counted)\n");
+
+      map<struct __vpiScope*, unsigned long> by_scope;
+      map<unsigned, unsigned long> by_line;
+      for (unsigned idx = 0 ;  idx < total ;  idx += 1) {
+	    by_scope[sample_buf[idx].scope] += 1;
+	    if (sample_buf[idx].file_line)
+		  by_line[sample_buf[idx].file_line] += 1;
+      }
+
+      fprintf(fd, "\nTime by scope:\n");
+      multimap<unsigned long, struct __vpiScope*> scope_sort;
+      for (map<struct __vpiScope*, unsigned long>::iterator cur
+		 = by_scope.begin() ; cur != by_scope.end() ; ++ cur)
+	    scope_sort.insert(make_pair(cur->second, cur->first));
+
+      for (multimap<unsigned long, struct __vpiScope*>::reverse_iterator cur
+		 = scope_sort.rbegin() ; cur != scope_sort.rend() ; ++ cur) {
+	    fprintf(fd, "%12lu %5.1f%%  ", cur->first,
+		    total? 100.0 * cur->first / total : 0.0);
+	    if (cur->second)
+		  sample_scope_path(fd, cur->second);
+	    else
+		  fprintf(fd, "<functors/scheduler>");
+	    fprintf(fd, "\n");
+      }
+
+      if (! by_line.empty()) {
+	    fprintf(fd, "\nTime by source line:\n");
+	    multimap<unsigned long, unsigned> line_sort;
+	    for (map<unsigned, unsigned long>::iterator cur
+		       = by_line.begin() ; cur != by_line.end() ; ++ cur)
+		  line_sort.insert(make_pair(cur->second, cur->first));
+
+	    for (multimap<unsigned long, unsigned>::reverse_iterator
+		       cur = line_sort.rbegin()
+		       ; cur != line_sort.rend() ; ++ cur) {
+		  vpiHandle fl = vpip_file_line_handle(cur->second);
+		  fprintf(fd, "%12lu %5.1f%%  %s:%d\n", cur->first,
+			  total? 100.0 * cur->first / total : 0.0,
+			  vpi_get_str(vpiFile, fl),
+			  vpi_get(vpiLineNo, fl));
+	    }
+      } else if (total > 0) {
+	    fprintf(fd, "\nNo source line samples. Compile with "
+		    "-pfileline=1 to get per-line attribution.\n");
+      }
+
+      fclose(fd);
+}
+
+static bool sample_profile_init(void)
+{
+      sample_path = getenv("VVP_PROFILE_SAMPLE");
+      if (sample_path == 0)
+	    return false;
+
+      sample_buf = new struct sample_s[SAMPLE_LIMIT];
+      atexit(&sample_profile_dump);
+
+      signal(SIGPROF, &sample_profile_sigprof);
+      struct itimerval val;
+      val.it_interval.tv_sec = 0;
+      val.it_interval.tv_usec = SAMPLE_PERIOD_US;
+      val.it_value = val.it_interval;
+      setitimer(ITIMER_PROF, &val, 0);
+      return true;
+}
+
+#else
+
+static bool sample_profile_init(void) { return false; }
+
+#endif
+
 struct vthread_s*running_thread = 0;
 
+	/* Number of thread objects that currently exist. This is
+	   reported to the design through $ivl_stats_threads. */
+unsigned long count_live_threads = 0;
+
+struct __vpiScope* vthread_running_scope(void)
+{
+      if (running_thread == 0)
+	    return 0;
+
+      return running_thread->parent_scope;
+}
+
+/*
+ * Optional opcode execution histogram, compiled in by defining
+ * VVP_OPCODE_COUNTS. It is off by default because the per-instruction
+ * table updates are far too slow for production runs, but on the
+ * reduced workloads used to study the interpreter it gives the exact
+ * dynamic opcode mix. Every executed instruction is tallied by opcode
+ * and by code address, and the report written at exit maps the hot
+ * addresses back to source lines when the design is compiled with
+ * -pfileline so that the threads track their current %file_line.
+ */
+#if defined(VVP_OPCODE_COUNTS)
+
+struct opcode_addr_count_s {
+      unsigned long count;
+      unsigned file_line;
+};
+
+static map<vvp_code_fun, unsigned long> opcode_mix_table;
+static map<vvp_code_t, opcode_addr_count_s> opcode_addr_table;
+
+static void opcode_count_dump(void)
+{
+      FILE*fd = fopen("vvp_opcode_counts.log", "w");
+      if (fd == 0)
+	    return;
+
+      unsigned long total = 0;
+      for (map<vvp_code_fun, unsigned long>::iterator cur
+		 = opcode_mix_table.begin()
+		 ; cur != opcode_mix_table.end() ; ++ cur)
+	    total += cur->second;
+
+      fprintf(fd, "%lu instructions executed\n", total);
+
+      fprintf(fd, "\nDynamic opcode mix:\n");
+      multimap<unsigned long, vvp_code_fun> mix_sort;
+      for (map<vvp_code_fun, unsigned long>::iterator cur
+		 = opcode_mix_table.begin()
+		 ; cur != opcode_mix_table.end() ; ++ cur)
+	    mix_sort.insert(make_pair(cur->second, cur->first));
+
+      for (multimap<unsigned long, vvp_code_fun>::reverse_iterator cur
+		 = mix_sort.rbegin() ; cur != mix_sort.rend() ; ++ cur) {
+	    const char*mnem = opcode_mnemonic(cur->second);
+	    fprintf(fd, "%12lu %5.1f%%  %s\n", cur->first,
+		    total? 100.0 * cur->first / total : 0.0,
+		    mnem? mnem : "<internal>");
+      }
+
+      static const unsigned TOP_ADDR_LIMIT = 50;
+      fprintf(fd, "\nHot code addresses:\n");
+      multimap<unsigned long, vvp_code_t> addr_sort;
+      for (map<vvp_code_t, opcode_addr_count_s>::iterator cur
+		 = opcode_addr_table.begin()
+		 ; cur != opcode_addr_table.end() ; ++ cur)
+	    addr_sort.insert(make_pair(cur->second.count, cur->first));
+
+      unsigned emitted = 0;
+      for (multimap<unsigned long, vvp_code_t>::reverse_iterator cur
+		 = addr_sort.rbegin()
+		 ; cur != addr_sort.rend() && emitted < TOP_ADDR_LIMIT
+		 ; ++ cur, emitted += 1) {
+	    vvp_code_t cp = cur->second;
+	    const char*mnem = opcode_mnemonic(cp->opcode);
+	    fprintf(fd, "%12lu  %p %-14s", cur->first, (void*)cp,
+		    mnem? mnem : "<internal>");
+	    vpiHandle fl = vpip_file_line_handle(opcode_addr_table[cp].file_line);
+	    if (fl)
+		  fprintf(fd, " %s:%d", vpi_get_str(vpiFile, fl),
+			  vpi_get(vpiLineNo, fl));
+	    fprintf(fd, "\n");
+      }
+
+      fclose(fd);
+}
+
+static void opcode_count_tally(vthread_t thr, vvp_code_t cp)
+{
+      static bool registered = false;
+      if (! registered) {
+	    atexit(&opcode_count_dump);
+	    registered = true;
+      }
+
+      opcode_mix_table[cp->opcode] += 1;
+
+      opcode_addr_count_s&cell = opcode_addr_table[cp];
+      cell.count += 1;
+      if (cell.file_line == 0)
+	    cell.file_line = thr->file_line;
+}
+
+#endif
+
 // this table maps the thread special index bit addresses to
 // vvp_bit4_t bit values.
 static vvp_bit4_t thr_index_to_bit4[4] = { BIT4_0, BIT4_1, BIT4_X, BIT4_Z };
@@ -513,7 +894,12 @@ void contexts_delete(struct __vpiScope*scope)
  */
 vthread_t vthread_new(vvp_code_t pc, struct __vpiScope*scope)
 {
+      static unsigned long id_counter = 0;
+
+      count_live_threads += 1;
+
       vthread_t thr = new struct vthread_s;
+      thr->id     = id_counter++;
       thr->pc     = pc;
       thr->bits4  = vvp_vector4_t(32);
       thr->parent = 0;
@@ -529,6 +915,7 @@ vthread_t vthread_new(vvp_code_t pc, struct __vpiScope*scope)
       thr->waiting_for_event = 0;
       thr->event  = 0;
       thr->ecount = 0;
+      thr->file_line = 0;
 
       thr_put_bit(thr, 0, BIT4_0);
       thr_put_bit(thr, 1, BIT4_1);
@@ -613,11 +1000,19 @@ static void vthread_reap(vthread_t thr)
 		  schedule_del_thr(thr);
 	    else
 		  vthread_delete(thr);
+      } else {
+	      /* The thread stays parked in the time wheel or on an
+		 event waiting list until its wakeup fires, but it
+		 will only ever execute of_ZOMBIE. Free its storage
+		 now so a cancelled watchdog timeout does not hold
+		 its stacks for the full timeout period. */
+	    thr->release_storage();
       }
 }
 
 void vthread_delete(vthread_t thr)
 {
+      count_live_threads -= 1;
       thr->bits4 = vvp_vector4_t();
       delete thr;
 }
@@ -644,6 +1039,10 @@ void vthread_delay_delete()
  */
 void vthread_run(vthread_t thr)
 {
+      static const bool profile_blocks = block_profile_init();
+      static const bool profile_sample = sample_profile_init();
+      (void) profile_sample;
+
       while (thr != 0) {
 	    vthread_t tmp = thr->wait_next;
 	    thr->wait_next = 0;
@@ -651,18 +1050,39 @@ void vthread_run(vthread_t thr)
 	    assert(thr->is_scheduled);
 	    thr->is_scheduled = 0;
 
+	    if (profile_blocks)
+		  block_profile_count(thr);
+
             running_thread = thr;
 
 	    for (;;) {
 		  vvp_code_t cp = thr->pc;
 		  thr->pc += 1;
 
+#if defined(VVP_OPCODE_COUNTS)
+		  opcode_count_tally(thr, cp);
+#endif
+
+		    /* The common case is straight-line execution, so
+		       start the fetch of the next opcode cell while
+		       the current opcode runs. This keeps the
+		       dispatch load off the critical path for long
+		       behavioral stretches. */
+#if defined(__GNUC__)
+		  __builtin_prefetch(thr->pc);
+#endif
+
 		    /* Run the opcode implementation. If the execution of
 		       the opcode returns false, then the thread is meant to
 		       be paused, so break out of the loop. */
 		  bool rc = (cp->opcode)(thr, cp);
+#if defined(__GNUC__)
+		  if (__builtin_expect(rc == false, 0))
+			break;
+#else
 		  if (rc == false)
 			break;
+#endif
 	    }
 
 	    thr = tmp;
@@ -1598,10 +2018,13 @@ bool of_CMPS(vthread_t thr, vvp_code_t cp)
 
 bool of_CMPSTR(vthread_t thr, vvp_code_t)
 {
-      string re = thr->pop_str();
-      string le = thr->pop_str();
+	/* Compare the operands in place, then pop them, to avoid
+	   copying the strings off the stack. */
+      const string&re = thr->peek_str(0);
+      const string&le = thr->peek_str(1);
 
       int rc = strcmp(le.c_str(), re.c_str());
+      thr->pop_str(2);
 
       vvp_bit4_t eq;
       vvp_bit4_t lt;
@@ -1924,8 +2347,8 @@ bool of_CMPZ(vthread_t thr, vvp_code_t cp)
  */
 bool of_CONCAT_STR(vthread_t thr, vvp_code_t)
 {
-      string text = thr->pop_str();
-      thr->peek_str(0).append(text);
+      thr->peek_str(1).append(thr->peek_str(0));
+      thr->pop_str(1);
       return true;
 }
 
@@ -2727,6 +3150,19 @@ bool of_FORCE_X0(vthread_t thr, vvp_code_t cp)
  * added to the list of children, and for me to be the parent of the
  * new child.
  */
+/*
+ * Detect the task call shape at run time: the instruction after the
+ * %fork (stepping over a chunk link if the code straddles a chunk
+ * boundary) is a %join.
+ */
+static bool vthread_fork_is_call_(vthread_t thr)
+{
+      vvp_code_t next = thr->pc;
+      if (next->opcode == &of_CHUNK_LINK)
+	    next = next->cptr;
+      return next->opcode == &of_JOIN;
+}
+
 bool of_FORK(vthread_t thr, vvp_code_t cp)
 {
       vthread_t child = vthread_new(cp->cptr2, cp->scope);
@@ -2749,6 +3185,20 @@ bool of_FORK(vthread_t thr, vvp_code_t cp)
 	    child->is_scheduled = 1;
 	    vthread_run(child);
             running_thread = thr;
+
+      } else if (vthread_fork_is_call_(thr) && thr->children.size() == 1) {
+	      /* The %fork is immediately followed by a %join for a
+		 single child -- this is how task calls compile -- so
+		 this thread can do nothing until the child yields.
+		 Run the child directly instead of taking a round
+		 trip through the scheduler. If the child blocks
+		 (tasks may contain delays) the %join that follows
+		 will wait for it exactly as if it had been
+		 scheduled. */
+	    child->is_scheduled = 1;
+	    vthread_run(child);
+            running_thread = thr;
+
       } else {
 	    schedule_vthread(child, 0, true);
       }
@@ -3484,7 +3934,23 @@ bool of_LOAD_STRA(vthread_t thr, vvp_code_t cp)
  * The functor to read from is the vvp_net_t object pointed to by the
  * cp->net pointer.
  */
-static void load_base(vvp_code_t cp, vvp_vector4_t&dst)
+/*
+ * The %load family addresses its source by the vvp_net_t object in
+ * cp->net, but reads are served by the signal value object behind
+ * that net. Resolve the object once, on the first execution of the
+ * instruction, and cache it in the code word so that steady-state
+ * reads skip the cast. All the of_LOAD*_ functions below are the
+ * resolved forms that the public opcodes replace themselves with.
+ *
+ * Once resolved, a read first asks the signal for direct access to
+ * its value storage (vec4_direct). A signal whose drivers have
+ * settled -- a parameter-like configuration vector, say -- is
+ * effectively constant storage, and the load is then a straight copy
+ * out of the signal with no functor dispatch and no intermediate
+ * vector. The direct pointer is refused while a force is in effect,
+ * so those reads drop back to the filtered vec4_value path.
+ */
+static vvp_signal_value* load_base_resolve(vvp_code_t cp)
 {
       vvp_net_t*net = cp->net;
 
@@ -3497,20 +3963,31 @@ static void load_base(vvp_code_t cp, vvp_vector4_t&dst)
 	    assert(sig);
       }
 
-      sig->vec4_value(dst);
+      cp->sig_val = sig;
+      return sig;
 }
 
-bool of_LOAD_VEC(vthread_t thr, vvp_code_t cp)
+static bool of_LOAD_VEC_(vthread_t thr, vvp_code_t cp)
 {
       unsigned bit = cp->bit_idx[0];
       unsigned wid = cp->bit_idx[1];
-
-      vvp_vector4_t sig_value;
-      load_base(cp, sig_value);
+      vvp_signal_value*sig = cp->sig_val;
 
 	/* Check the address once, before we scan the vector. */
       thr_check_addr(thr, bit+wid-1);
 
+	/* If the signal value is directly readable and the width
+	   matches, copy the bits into the thread vector without an
+	   intermediate vector. */
+      const vvp_vector4_t*direct = sig->vec4_direct();
+      if (direct && direct->size() == wid) {
+	    thr->bits4.set_vec(bit, *direct);
+	    return true;
+      }
+
+      vvp_vector4_t sig_value;
+      sig->vec4_value(sig_value);
+
       if (sig_value.size() > wid)
 	    sig_value.resize(wid);
 
@@ -3526,12 +4003,19 @@ bool of_LOAD_VEC(vthread_t thr, vvp_code_t cp)
       return true;
 }
 
+bool of_LOAD_VEC(vthread_t thr, vvp_code_t cp)
+{
+      load_base_resolve(cp);
+      cp->opcode = &of_LOAD_VEC_;
+      return cp->opcode(thr, cp);
+}
+
 /*
  * This is like of_LOAD_VEC, but includes an add of an integer value from
  * index 0. The <wid> is the expected result width not the vector width.
  */
 
-bool of_LOAD_VP0(vthread_t thr, vvp_code_t cp)
+static bool of_LOAD_VP0_(vthread_t thr, vvp_code_t cp)
 {
       unsigned wid = cp->bit_idx[1];
 
@@ -3539,53 +4023,69 @@ bool of_LOAD_VP0(vthread_t thr, vvp_code_t cp)
          * Copy the base bits into the vector, but keep the width. */
       vvp_vector4_t sig_value(wid, BIT4_0);
 
-      vvp_vector4_t tmp;
-      load_base(cp, tmp);
-      sig_value.copy_bits(tmp);
+      if (const vvp_vector4_t*direct = cp->sig_val->vec4_direct()) {
+	    sig_value.copy_bits(*direct);
+      } else {
+	    vvp_vector4_t tmp;
+	    cp->sig_val->vec4_value(tmp);
+	    sig_value.copy_bits(tmp);
+      }
 
       load_vp0_common(thr, cp, sig_value);
       return true;
 }
 
-bool of_LOAD_VP0_S(vthread_t thr, vvp_code_t cp)
+bool of_LOAD_VP0(vthread_t thr, vvp_code_t cp)
+{
+      load_base_resolve(cp);
+      cp->opcode = &of_LOAD_VP0_;
+      return cp->opcode(thr, cp);
+}
+
+static bool of_LOAD_VP0_S_(vthread_t thr, vvp_code_t cp)
 {
       unsigned wid = cp->bit_idx[1];
 
       vvp_vector4_t tmp;
-      load_base(cp, tmp);
+      const vvp_vector4_t*direct = cp->sig_val->vec4_direct();
+      if (direct == 0) {
+	    cp->sig_val->vec4_value(tmp);
+	    direct = &tmp;
+      }
 
         /* We need a vector this wide to make the math work correctly.
          * Copy the base bits into the vector, but keep the width. */
-      vvp_vector4_t sig_value(wid, tmp.value(tmp.size()-1));
-      sig_value.copy_bits(tmp);
+      vvp_vector4_t sig_value(wid, direct->value(direct->size()-1));
+      sig_value.copy_bits(*direct);
 
       load_vp0_common(thr, cp, sig_value);
       return true;
 }
 
+bool of_LOAD_VP0_S(vthread_t thr, vvp_code_t cp)
+{
+      load_base_resolve(cp);
+      cp->opcode = &of_LOAD_VP0_S_;
+      return cp->opcode(thr, cp);
+}
+
 /*
  * %load/x16 <bit>, <functor>, <wid>
  *
  * <bit> is the destination thread bit and must be >= 4.
  */
-bool of_LOAD_X1P(vthread_t thr, vvp_code_t cp)
+static bool of_LOAD_X1P_(vthread_t thr, vvp_code_t cp)
 {
 	// <bit> is the thread bit to load
-      assert(cp->bit_idx[0] >= 4);
       unsigned bit = cp->bit_idx[0];
       int wid = cp->bit_idx[1];
 
 	// <index> is the canonical base address of the part select.
       long index = thr->words[1].w_int;
 
-	// <functor> is converted to a vvp_net_t pointer from which we
-	// read our value.
-      vvp_net_t*net = cp->net;
-
-	// For the %load to work, the functor must actually be a
-	// signal functor. Only signals save their vector value.
-      vvp_signal_value*sig = dynamic_cast<vvp_signal_value*> (net->fil);
-      assert(sig);
+	// The signal value object was resolved on the first
+	// execution of the instruction.
+      vvp_signal_value*sig = cp->sig_val;
 
       for (long idx = 0 ; idx < wid ; idx += 1) {
 	    long use_index = index + idx;
@@ -3601,6 +4101,16 @@ bool of_LOAD_X1P(vthread_t thr, vvp_code_t cp)
       return true;
 }
 
+bool of_LOAD_X1P(vthread_t thr, vvp_code_t cp)
+{
+	// <bit> is the thread bit to load
+      assert(cp->bit_idx[0] >= 4);
+
+      load_base_resolve(cp);
+      cp->opcode = &of_LOAD_X1P_;
+      return cp->opcode(thr, cp);
+}
+
 static void do_verylong_mod(vthread_t thr, vvp_code_t cp,
 			    bool left_is_neg, bool right_is_neg)
 {
@@ -4047,6 +4557,22 @@ bool of_MUL_WR(vthread_t thr, vvp_code_t)
       return true;
 }
 
+/*
+ * %muladd/wr pops the two factors and then the addend, and pushes
+ * back <addend> + <left>*<right> in one step. Sum-of-products
+ * expressions compile to chains of this opcode, so the inner loop of
+ * a behavioral filter pays one dispatch per product instead of two.
+ */
+bool of_MULADD_WR(vthread_t thr, vvp_code_t)
+{
+      double r = thr->pop_real();
+      double l = thr->pop_real();
+      double acc = thr->pop_real();
+      thr->push_real(acc + l * r);
+
+      return true;
+}
+
 bool of_MULI(vthread_t thr, vvp_code_t cp)
 {
       unsigned adr = cp->bit_idx[0];
@@ -4136,7 +4662,7 @@ bool of_NEW_COBJ(vthread_t thr, vvp_code_t cp)
       const class_type*defn = dynamic_cast<const class_type*> (cp->handle);
       assert(defn);
 
-      vvp_object_t tmp (new vvp_cobject(defn));
+      vvp_object_t tmp (new (defn) vvp_cobject(defn));
       thr->push_object(tmp);
       return true;
 }
@@ -4828,6 +5354,25 @@ bool of_SET_AV(vthread_t thr, vvp_code_t cp)
       return true;
 }
 
+/*
+ * This implements the "%arr/fill <label>, <bit>, <wid>" instruction,
+ * the bulk form of %set/av. The address of the first word is in
+ * index register 3 and the word count is in index register 0. The
+ * same value is written to every word of the run.
+ */
+bool of_ARR_FILL(vthread_t thr, vvp_code_t cp)
+{
+      unsigned bit = cp->bit_idx[0];
+      unsigned wid = cp->bit_idx[1];
+      unsigned adr = thr->words[3].w_int;
+      unsigned cnt = thr->words[0].w_int;
+
+      vvp_vector4_t value = vthread_bits_to_vector(thr, bit, wid);
+
+      array_fill_words(cp->array, adr, cnt, value);
+      return true;
+}
+
 /*
  * %set/dar  <label>, <bit>, <wid>
  */
@@ -5105,8 +5650,8 @@ bool of_STORE_DAR_STR(vthread_t thr, vvp_code_t cp)
 {
       long adr = thr->words[3].w_int;
 
-	// Pop the string to be stored...
-      string value = thr->pop_str();
+	// The string to be stored...
+      const string&value = thr->peek_str(0);
 
       vvp_net_t*net = cp->net;
       vvp_fun_signal_object*obj = dynamic_cast<vvp_fun_signal_object*> (net->fun);
@@ -5116,6 +5661,7 @@ bool of_STORE_DAR_STR(vthread_t thr, vvp_code_t cp)
       assert(darray);
 
       darray->set_word(adr, value);
+      thr->pop_str(1);
       return true;
 }
 
@@ -5186,13 +5732,14 @@ bool of_STORE_PROP_R(vthread_t thr, vvp_code_t cp)
 bool of_STORE_PROP_STR(vthread_t thr, vvp_code_t cp)
 {
       size_t pid = cp->number;
-      string val = thr->pop_str();
+      const string&val = thr->peek_str(0);
 
       vvp_object_t&obj = thr->peek_object();
       vvp_cobject*cobj = obj.peek<vvp_cobject>();
       assert(cobj);
 
       cobj->set_string(pid, val);
+      thr->pop_str(1);
 
       return true;
 }
@@ -5247,8 +5794,8 @@ bool of_STORE_STR(vthread_t thr, vvp_code_t cp)
 	/* set the value into port 0 of the destination. */
       vvp_net_ptr_t ptr (cp->net, 0);
 
-      string val = thr->pop_str();
-      vvp_send_string(ptr, val, thr->wt_context);
+      vvp_send_string(ptr, thr->peek_str(0), thr->wt_context);
+      thr->pop_str(1);
 
       return true;
 }
@@ -5261,8 +5808,8 @@ bool of_STORE_STRA(vthread_t thr, vvp_code_t cp)
       unsigned idx = cp->bit_idx[0];
       unsigned adr = thr->words[idx].w_int;
 
-      string val = thr->pop_str();
-      array_set_word(cp->array, adr, val);
+      array_set_word(cp->array, adr, thr->peek_str(0));
+      thr->pop_str(1);
 
       return true;
 }
@@ -5402,10 +5949,11 @@ bool of_SUBSTR_V(vthread_t thr, vvp_code_t cp)
       return true;
 }
 
-bool of_FILE_LINE(vthread_t, vvp_code_t cp)
+bool of_FILE_LINE(vthread_t thr, vvp_code_t cp)
 {
+      thr->file_line = cp->number;
       if (show_file_line) {
-	    vpiHandle handle = cp->handle;
+	    vpiHandle handle = vpip_file_line_handle(cp->number);
 	    cerr << vpi_get_str(vpiFile, handle) << ":"
 	         << vpi_get(vpiLineNo, handle) << ": ";
 	    cerr << vpi_get_str(_vpiDescription, handle);
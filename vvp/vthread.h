@@ -74,6 +74,21 @@ extern void vthread_schedule_list(vthread_t thr);
 
 extern struct __vpiScope*vthread_scope(vthread_t thr);
 
+/*
+ * This function returns the scope of the thread that is currently
+ * executing, or nil if no thread is running. This is used to
+ * attribute run-time allocations to the responsible scope.
+ */
+extern struct __vpiScope*vthread_running_scope(void);
+
+/*
+ * Each thread is given a sequential creation number. The creation
+ * order is reproducible for a given .vvp input, so the number
+ * identifies the same thread across runs. The scheduler order
+ * recorder keys its records on this.
+ */
+extern unsigned long vthread_get_id(vthread_t thr);
+
 /*
  * This function returns a handle to the writable context of the currently
  * running thread. Normally the writable context is the context allocated
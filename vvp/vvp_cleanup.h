@@ -28,6 +28,7 @@
 extern void codespace_delete(void);
 extern void dec_str_delete(void);
 extern void def_table_delete(void);
+extern void file_line_delete(void);
 extern void island_delete(void);
 extern void vpi_mcd_delete(void);
 extern void load_module_delete(void);
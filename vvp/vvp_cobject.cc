@@ -19,22 +19,46 @@
 
 # include  "vvp_cobject.h"
 # include  "class_type.h"
+# include  "mem_stats.h"
 # include  <iostream>
 # include  <cassert>
 
 using namespace std;
 
 vvp_cobject::vvp_cobject(const class_type*defn)
-: defn_(defn), properties_(defn->instance_new())
+: defn_(defn), properties_(defn->instance_init(this + 1))
 {
+      scope_ = mem_stats_current_scope();
+      mem_stats_add(scope_, MEM_STATS_COBJECT,
+		    sizeof(*this) + defn_->instance_size());
 }
 
 vvp_cobject::~vvp_cobject()
 {
-      defn_->instance_delete(properties_);
+      mem_stats_add(scope_, MEM_STATS_COBJECT,
+		    -(long)(sizeof(*this) + defn_->instance_size()));
+      defn_->instance_done(properties_);
       properties_ = 0;
 }
 
+void* vvp_cobject::operator new(std::size_t size, const class_type*defn)
+{
+	// The properties are constructed at (this+1), so the slab
+	// cell must be laid out with the object at the front.
+      assert(size == sizeof(vvp_cobject));
+      return defn->instance_alloc(size);
+}
+
+void vvp_cobject::operator delete(void*ptr)
+{
+      class_type::instance_free(ptr);
+}
+
+void vvp_cobject::operator delete(void*ptr, const class_type*)
+{
+      class_type::instance_free(ptr);
+}
+
 void vvp_cobject::set_vec4(size_t pid, const vvp_vector4_t&val)
 {
       defn_->set_vec4(properties_, pid, val);
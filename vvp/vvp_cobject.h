@@ -44,10 +44,23 @@ class vvp_cobject : public vvp_object {
       void set_object(size_t pid, const vvp_object_t&val);
       void get_object(size_t pid, vvp_object_t&val);
 
+    public:
+	// Instances live in per-class slabs with the properties
+	// packed directly behind the object, so construction must
+	// pass the class definition to the allocator:
+	//     new (defn) vvp_cobject(defn)
+      static void* operator new(std::size_t size, const class_type*defn);
+      static void operator delete(void*ptr);
+	// Matching form, called if the constructor throws.
+      static void operator delete(void*ptr, const class_type*defn);
+
     private:
       const class_type* defn_;
 	// For now, only support 32bit bool signed properties.
       class_type::inst_t properties_;
+	// The scope this object was charged to, so the destructor
+	// gives the bytes back to the same account.
+      struct __vpiScope*scope_;
 };
 
 #endif
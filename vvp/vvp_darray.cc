@@ -21,11 +21,28 @@
 # include  "vvp_net.h"
 # include  <iostream>
 # include  <typeinfo>
+# include  <cstring>
 
 using namespace std;
 
 vvp_darray::~vvp_darray()
 {
+      if (bytes_)
+	    mem_stats_add(scope_, kind_, -(long)bytes_);
+}
+
+void vvp_darray::count_memory_(size_t bytes, mem_stats_kind_e kind)
+{
+	// The queue classes recount as their ring grows, so give any
+	// earlier count back before charging the new one. The charge
+	// stays with the scope that made the first allocation.
+      if (scope_ == 0)
+	    scope_ = mem_stats_current_scope();
+      else if (bytes_ > 0)
+	    mem_stats_add(scope_, kind_, -(long)bytes_);
+      bytes_ = bytes;
+      kind_ = kind;
+      mem_stats_add(scope_, kind_, bytes_);
 }
 
 void vvp_darray::set_word(unsigned, const vvp_vector4_t&)
@@ -58,6 +75,20 @@ void vvp_darray::get_word(unsigned, string&)
       cerr << "XXXX get_word(string) not implemented for " << typeid(*this).name() << endl;
 }
 
+size_t vvp_darray::copy_words_out(unsigned, size_t, void*)
+{
+      return 0;
+}
+
+size_t vvp_darray::copy_words_in(unsigned, size_t, const void*)
+{
+      return 0;
+}
+
+void vvp_darray::reserve_words(size_t)
+{
+}
+
 template <class TYPE> vvp_darray_atom<TYPE>::~vvp_darray_atom()
 {
 }
@@ -87,6 +118,18 @@ template <class TYPE> void vvp_darray_atom<TYPE>::get_word(unsigned adr, vvp_vec
       value = tmp;
 }
 
+template <class TYPE> size_t vvp_darray_atom<TYPE>::copy_words_out(unsigned adr, size_t cnt, void*dst)
+{
+      if (cnt) memcpy(dst, &array_[adr], cnt*sizeof(TYPE));
+      return sizeof(TYPE);
+}
+
+template <class TYPE> size_t vvp_darray_atom<TYPE>::copy_words_in(unsigned adr, size_t cnt, const void*src)
+{
+      if (cnt) memcpy(&array_[adr], src, cnt*sizeof(TYPE));
+      return sizeof(TYPE);
+}
+
 template class vvp_darray_atom<uint8_t>;
 template class vvp_darray_atom<uint16_t>;
 template class vvp_darray_atom<uint32_t>;
@@ -117,6 +160,18 @@ void vvp_darray_real::get_word(unsigned adr, double&value)
       value = array_[adr];
 }
 
+size_t vvp_darray_real::copy_words_out(unsigned adr, size_t cnt, void*dst)
+{
+      if (cnt) memcpy(dst, &array_[adr], cnt*sizeof(double));
+      return sizeof(double);
+}
+
+size_t vvp_darray_real::copy_words_in(unsigned adr, size_t cnt, const void*src)
+{
+      if (cnt) memcpy(&array_[adr], src, cnt*sizeof(double));
+      return sizeof(double);
+}
+
 vvp_darray_string::~vvp_darray_string()
 {
 }
@@ -137,3 +192,201 @@ void vvp_darray_string::get_word(unsigned adr, string&value)
 
       value = array_[adr];
 }
+
+template <class TYPE> bool vvp_ring<TYPE>::reserve_(size_t cnt)
+{
+      if (cnt <= cap_)
+	    return false;
+
+      size_t new_cap = cap_? cap_ : 4;
+      while (new_cap < cnt)
+	    new_cap *= 2;
+
+	// Copy the contents to the new buffer, linearized so the
+	// head starts over at index 0.
+      TYPE*new_buf = new TYPE[new_cap];
+      for (size_t idx = 0 ;  idx < used_ ;  idx += 1)
+	    new_buf[idx] = at(idx);
+
+      delete[]buf_;
+      buf_ = new_buf;
+      cap_ = new_cap;
+      head_ = 0;
+      return true;
+}
+
+template <class TYPE> bool vvp_ring<TYPE>::push_back(const TYPE&val)
+{
+      bool grew = reserve_(used_+1);
+      buf_[(head_+used_) & (cap_-1)] = val;
+      used_ += 1;
+      return grew;
+}
+
+template <class TYPE> bool vvp_ring<TYPE>::push_front(const TYPE&val)
+{
+      bool grew = reserve_(used_+1);
+      head_ = (head_ + cap_ - 1) & (cap_-1);
+      buf_[head_] = val;
+      used_ += 1;
+      return grew;
+}
+
+template <class TYPE> void vvp_ring<TYPE>::pop_back(TYPE&val)
+{
+      used_ -= 1;
+      val = buf_[(head_+used_) & (cap_-1)];
+}
+
+template <class TYPE> void vvp_ring<TYPE>::pop_front(TYPE&val)
+{
+      val = buf_[head_];
+      head_ = (head_+1) & (cap_-1);
+      used_ -= 1;
+}
+
+template <class TYPE> size_t vvp_queue<TYPE>::get_size(void) const
+{
+      return ring_.size();
+}
+
+template <class TYPE> void vvp_queue<TYPE>::push_back(const TYPE&value)
+{
+      if (ring_.push_back(value))
+	    count_memory_(ring_.alloc_bytes(), MEM_STATS_DARRAY);
+}
+
+template <class TYPE> void vvp_queue<TYPE>::push_front(const TYPE&value)
+{
+      if (ring_.push_front(value))
+	    count_memory_(ring_.alloc_bytes(), MEM_STATS_DARRAY);
+}
+
+template <class TYPE> bool vvp_queue<TYPE>::pop_back(TYPE&value)
+{
+      if (ring_.size() == 0)
+	    return false;
+
+      ring_.pop_back(value);
+      return true;
+}
+
+template <class TYPE> bool vvp_queue<TYPE>::pop_front(TYPE&value)
+{
+      if (ring_.size() == 0)
+	    return false;
+
+      ring_.pop_front(value);
+      return true;
+}
+
+template <class TYPE> void vvp_queue<TYPE>::push_back(const TYPE*items,
+						      size_t cnt)
+{
+      bool grew = false;
+      for (size_t idx = 0 ;  idx < cnt ;  idx += 1)
+	    grew |= ring_.push_back(items[idx]);
+
+      if (grew)
+	    count_memory_(ring_.alloc_bytes(), MEM_STATS_DARRAY);
+}
+
+template <class TYPE> void vvp_queue<TYPE>::reserve_words(size_t cnt)
+{
+      if (ring_.reserve(cnt))
+	    count_memory_(ring_.alloc_bytes(), MEM_STATS_DARRAY);
+}
+
+template <class TYPE> size_t vvp_queue<TYPE>::pop_front(TYPE*items, size_t cnt)
+{
+      if (cnt > ring_.size())
+	    cnt = ring_.size();
+
+      for (size_t idx = 0 ;  idx < cnt ;  idx += 1)
+	    ring_.pop_front(items[idx]);
+
+      return cnt;
+}
+
+template class vvp_queue<vvp_vector4_t>;
+template class vvp_queue<double>;
+template class vvp_queue<string>;
+
+vvp_queue_vec4::~vvp_queue_vec4()
+{
+}
+
+void vvp_queue_vec4::set_word(unsigned adr, const vvp_vector4_t&value)
+{
+      if (adr >= ring_.size())
+	    return;
+      ring_.at(adr) = value;
+}
+
+void vvp_queue_vec4::get_word(unsigned adr, vvp_vector4_t&value)
+{
+      if (adr >= ring_.size()) {
+	    value = vvp_vector4_t();
+	    return;
+      }
+
+      value = ring_.at(adr);
+}
+
+vvp_queue_real::~vvp_queue_real()
+{
+}
+
+void vvp_queue_real::set_word(unsigned adr, double value)
+{
+      if (adr >= ring_.size())
+	    return;
+      ring_.at(adr) = value;
+}
+
+void vvp_queue_real::get_word(unsigned adr, double&value)
+{
+      if (adr >= ring_.size()) {
+	    value = 0.0;
+	    return;
+      }
+
+      value = ring_.at(adr);
+}
+
+size_t vvp_queue_real::copy_words_out(unsigned adr, size_t cnt, void*dst)
+{
+      double*dp = static_cast<double*>(dst);
+      for (size_t idx = 0 ;  idx < cnt ;  idx += 1)
+	    dp[idx] = ring_.at(adr+idx);
+      return sizeof(double);
+}
+
+size_t vvp_queue_real::copy_words_in(unsigned adr, size_t cnt, const void*src)
+{
+      const double*sp = static_cast<const double*>(src);
+      for (size_t idx = 0 ;  idx < cnt ;  idx += 1)
+	    ring_.at(adr+idx) = sp[idx];
+      return sizeof(double);
+}
+
+vvp_queue_string::~vvp_queue_string()
+{
+}
+
+void vvp_queue_string::set_word(unsigned adr, const string&value)
+{
+      if (adr >= ring_.size())
+	    return;
+      ring_.at(adr) = value;
+}
+
+void vvp_queue_string::get_word(unsigned adr, string&value)
+{
+      if (adr >= ring_.size()) {
+	    value = "";
+	    return;
+      }
+
+      value = ring_.at(adr);
+}
@@ -20,6 +20,7 @@
  */
 
 # include  "vvp_object.h"
+# include  "mem_stats.h"
 # include  <string>
 # include  <vector>
 
@@ -28,10 +29,13 @@ class vvp_vector4_t;
 class vvp_darray : public vvp_object {
 
     public:
-      inline vvp_darray(size_t siz) : size_(siz) { }
+      inline vvp_darray(size_t siz)
+      : size_(siz), scope_(0), bytes_(0), kind_(MEM_STATS_DARRAY) { }
       virtual ~vvp_darray();
 
-      inline size_t get_size(void) const { return size_; }
+	// The queue classes below override this, since their size
+	// changes as words are pushed and popped.
+      virtual size_t get_size(void) const { return size_; }
 
       virtual void set_word(unsigned adr, const vvp_vector4_t&value);
       virtual void get_word(unsigned adr, vvp_vector4_t&value);
@@ -42,19 +46,49 @@ class vvp_darray : public vvp_object {
       virtual void set_word(unsigned adr, const std::string&value);
       virtual void get_word(unsigned adr, std::string&value);
 
+	// Bulk word access for the VPI bulk-transfer extension.
+	// Arrays whose words have a flat native layout (two-state
+	// atoms, doubles) copy cnt words starting at adr and return
+	// the per-word size in bytes. The base class returns 0, so
+	// callers fall back to per-word access. The caller is
+	// responsible for clamping adr/cnt to the array size.
+      virtual size_t copy_words_out(unsigned adr, size_t cnt, void*dst);
+      virtual size_t copy_words_in(unsigned adr, size_t cnt, const void*src);
+
+	// Capacity hint from a writer that knows how many words are
+	// coming. Only meaningful for the queue classes.
+      virtual void reserve_words(size_t cnt);
+
+    protected:
+	// Derived constructors call this to charge their word
+	// storage to the owning scope. Static arrays that use this
+	// class for their word storage pass MEM_STATS_ARRAY so the
+	// report shows them as arrays instead of dynamic objects.
+	// The destructor gives the bytes back to the same account.
+      void count_memory_(size_t bytes, mem_stats_kind_e kind);
+
     private:
       size_t size_;
+      struct __vpiScope*scope_;
+      size_t bytes_;
+      mem_stats_kind_e kind_;
 };
 
 template <class TYPE> class vvp_darray_atom : public vvp_darray {
 
     public:
-      inline vvp_darray_atom(size_t siz) : vvp_darray(siz), array_(siz) { }
+      inline vvp_darray_atom(size_t siz,
+			     mem_stats_kind_e kind =MEM_STATS_DARRAY)
+      : vvp_darray(siz), array_(siz)
+      { count_memory_(siz*sizeof(TYPE), kind); }
       ~vvp_darray_atom();
 
       void set_word(unsigned adr, const vvp_vector4_t&value);
       void get_word(unsigned adr, vvp_vector4_t&value);
 
+      size_t copy_words_out(unsigned adr, size_t cnt, void*dst);
+      size_t copy_words_in(unsigned adr, size_t cnt, const void*src);
+
     private:
       std::vector<TYPE> array_;
 };
@@ -62,12 +96,18 @@ template <class TYPE> class vvp_darray_atom : public vvp_darray {
 class vvp_darray_real : public vvp_darray {
 
     public:
-      inline vvp_darray_real(size_t siz) : vvp_darray(siz), array_(siz) { }
+      inline vvp_darray_real(size_t siz,
+			     mem_stats_kind_e kind =MEM_STATS_DARRAY)
+      : vvp_darray(siz), array_(siz)
+      { count_memory_(siz*sizeof(double), kind); }
       ~vvp_darray_real();
 
       void set_word(unsigned adr, double value);
       void get_word(unsigned adr, double&value);
 
+      size_t copy_words_out(unsigned adr, size_t cnt, void*dst);
+      size_t copy_words_in(unsigned adr, size_t cnt, const void*src);
+
     private:
       std::vector<double> array_;
 };
@@ -75,7 +115,10 @@ class vvp_darray_real : public vvp_darray {
 class vvp_darray_string : public vvp_darray {
 
     public:
-      inline vvp_darray_string(size_t siz) : vvp_darray(siz), array_(siz) { }
+      inline vvp_darray_string(size_t siz,
+			       mem_stats_kind_e kind =MEM_STATS_DARRAY)
+      : vvp_darray(siz), array_(siz)
+      { count_memory_(siz*sizeof(std::string), kind); }
       ~vvp_darray_string();
 
       void set_word(unsigned adr, const std::string&value);
@@ -85,5 +128,114 @@ class vvp_darray_string : public vvp_darray {
       std::vector<std::string> array_;
 };
 
+/*
+ * A ring buffer with power-of-two capacity, used as the word storage
+ * for the queue classes below. The head index chases the tail around
+ * the buffer, so pushing or popping at either end is O(1) and the
+ * wraparound arithmetic is a mask instead of a divide. Growing the
+ * buffer linearizes the contents at the new head.
+ */
+template <class TYPE> class vvp_ring {
+
+    public:
+      inline vvp_ring() : buf_(0), cap_(0), head_(0), used_(0) { }
+      inline ~vvp_ring() { delete[]buf_; }
+
+      inline size_t size(void) const { return used_; }
+
+	// Heap bytes held by the buffer, for memory accounting.
+      inline size_t alloc_bytes(void) const { return cap_*sizeof(TYPE); }
+
+	// Index relative to the front of the ring.
+      inline TYPE&at(size_t idx)
+      { return buf_[(head_+idx) & (cap_-1)]; }
+
+	// Make sure the buffer can hold cnt items. Returns true if
+	// the buffer grew, so the caller knows to recount its memory.
+      inline bool reserve(size_t cnt) { return reserve_(cnt); }
+
+	// The push methods return true if the buffer grew, so the
+	// caller knows to recount its memory.
+      bool push_back(const TYPE&val);
+      bool push_front(const TYPE&val);
+      void pop_back(TYPE&val);
+      void pop_front(TYPE&val);
+
+    private:
+      bool reserve_(size_t cnt);
+
+    private:
+      TYPE*buf_;
+      size_t cap_;
+      size_t head_;
+      size_t used_;
+
+    private: // Not implemented
+      vvp_ring(const vvp_ring&);
+      vvp_ring& operator = (const vvp_ring&);
+};
+
+/*
+ * This is the run time representation of a SystemVerilog queue. A
+ * queue is indexed like a darray (address 0 is the front) but also
+ * grows and shrinks at both ends, so the words live in a vvp_ring
+ * instead of a vector. The bulk entry points move a run of words
+ * with a single capacity check, for the scoreboard style that pushes
+ * or drains many words at once.
+ */
+template <class TYPE> class vvp_queue : public vvp_darray {
+
+    public:
+      inline vvp_queue() : vvp_darray(0) { }
+
+      size_t get_size(void) const;
+
+      void push_back(const TYPE&value);
+      void push_front(const TYPE&value);
+
+	// The pop methods return false if the queue is empty.
+      bool pop_back(TYPE&value);
+      bool pop_front(TYPE&value);
+
+	// Bulk entry points.
+      void push_back(const TYPE*items, size_t cnt);
+      size_t pop_front(TYPE*items, size_t cnt);
+
+      void reserve_words(size_t cnt);
+
+    protected:
+      vvp_ring<TYPE> ring_;
+};
+
+class vvp_queue_vec4 : public vvp_queue<vvp_vector4_t> {
+
+    public:
+      ~vvp_queue_vec4();
+
+      void set_word(unsigned adr, const vvp_vector4_t&value);
+      void get_word(unsigned adr, vvp_vector4_t&value);
+};
+
+class vvp_queue_real : public vvp_queue<double> {
+
+    public:
+      ~vvp_queue_real();
+
+      void set_word(unsigned adr, double value);
+      void get_word(unsigned adr, double&value);
+
+      size_t copy_words_out(unsigned adr, size_t cnt, void*dst);
+      size_t copy_words_in(unsigned adr, size_t cnt, const void*src);
+};
+
+class vvp_queue_string : public vvp_queue<std::string> {
+
+    public:
+      ~vvp_queue_string();
+
+      void set_word(unsigned adr, const std::string&value);
+      void get_word(unsigned adr, std::string&value);
+};
+
 
 #endif
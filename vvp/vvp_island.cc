@@ -164,6 +164,8 @@ void vvp_island::compile_cleanup()
 vvp_island_port::vvp_island_port(vvp_island*ip)
 : island_(ip)
 {
+	// Make sure the first run accounts for this port.
+      changed = true;
 }
 
 vvp_island_port::~vvp_island_port()
@@ -178,6 +180,7 @@ void vvp_island_port::recv_vec4(vvp_net_ptr_t, const vvp_vector4_t&bit,
 	    return;
 
       invalue = tmp;
+      changed = true;
       island_->flag_island();
 }
 
@@ -196,6 +199,7 @@ void vvp_island_port::recv_vec8(vvp_net_ptr_t, const vvp_vector8_t&bit)
 	    return;
 
       invalue = bit;
+      changed = true;
       island_->flag_island();
 }
 
@@ -214,11 +218,13 @@ void vvp_island_port::recv_vec8_pv(vvp_net_ptr_t, const vvp_vector8_t&bit,
 	    }
       }
 
+      changed = true;
       island_->flag_island();
 }
 
 void vvp_island_port::force_flag(void)
 {
+      changed = true;
       island_->flag_island();
 }
 
@@ -145,6 +145,12 @@ class vvp_island_port  : public vvp_net_fun_t {
       vvp_vector8_t outvalue;
       vvp_vector8_t value;
 
+	// Set when new input arrives at this port (or a force is
+	// applied to the attached net). The island clears this flag
+	// when it has accounted for the change, so it can limit the
+	// next solve to the parts of the mesh that actually changed.
+      bool changed;
+
     private:
       vvp_island*island_;
 
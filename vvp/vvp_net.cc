@@ -28,11 +28,14 @@
 # include  <cstdio>
 # include  <cstring>
 # include  <cstdlib>
+# include  <map>
+# include  <vector>
 # include  <iostream>
 # include  <typeinfo>
 # include  <climits>
 # include  <cmath>
 # include  <cassert>
+# include  <new>
 #ifdef CHECK_WITH_VALGRIND
 # include  <valgrind/memcheck.h>
 # include  <map>
@@ -44,9 +47,13 @@
 permaheap vvp_net_fun_t::heap_;
 permaheap vvp_net_fil_t::heap_;
 
-// Allocate around 1Megabyte/chunk.
-static const size_t VVP_NET_CHUNK = 1024*1024/sizeof(vvp_net_t);
+// Allocate around 2Megabytes/chunk, so that the arena backing store
+// can put each chunk on huge pages.
+static const size_t VVP_NET_CHUNK = ARENA_HUGE_CHUNK/sizeof(vvp_net_t);
 static vvp_net_t*vvp_net_alloc_table = NULL;
+// Remember the chunk bases so that load-time analysis passes can
+// visit every allocated net.
+static std::vector<vvp_net_t*> vvp_net_chunk_list;
 #ifdef CHECK_WITH_VALGRIND
 static vvp_net_t **vvp_net_pool = NULL;
 static unsigned vvp_net_pool_count = 0;
@@ -61,9 +68,19 @@ void* vvp_net_t::operator new (size_t size)
 {
       assert(size == sizeof(vvp_net_t));
       if (vvp_net_alloc_remaining == 0) {
+#ifdef CHECK_WITH_VALGRIND
+	      /* Keep plain array allocations here so that
+		 vvp_net_pool_delete can release them one by one. */
 	    vvp_net_alloc_table = ::new vvp_net_t[VVP_NET_CHUNK];
+#else
+	    void*raw = arena_chunk_alloc(VVP_NET_CHUNK * sizeof(vvp_net_t));
+	    vvp_net_alloc_table = reinterpret_cast<vvp_net_t*> (raw);
+	    for (size_t idx = 0 ;  idx < VVP_NET_CHUNK ;  idx += 1)
+		  ::new (vvp_net_alloc_table + idx) vvp_net_t;
+#endif
 	    vvp_net_alloc_remaining = VVP_NET_CHUNK;
 	    size_vvp_nets += size*VVP_NET_CHUNK;
+	    vvp_net_chunk_list.push_back(vvp_net_alloc_table);
 #ifdef CHECK_WITH_VALGRIND
 	    VALGRIND_MAKE_MEM_NOACCESS(vvp_net_alloc_table, size*VVP_NET_CHUNK);
 	    VALGRIND_CREATE_MEMPOOL(vvp_net_alloc_table, 0, 0);
@@ -86,6 +103,92 @@ void* vvp_net_t::operator new (size_t size)
       return return_this;
 }
 
+vvp_net_t* vvp_net_index(unsigned long idx)
+{
+      return vvp_net_chunk_list[idx / VVP_NET_CHUNK] + idx % VVP_NET_CHUNK;
+}
+
+/*
+ * Partition analysis over the net graph. Two nets belong to the same
+ * partition if a value change on one can reach the other through the
+ * fan-out chains, so the partition count is an upper bound on how
+ * many weakly-coupled regions a partitioned scheduler could run
+ * concurrently. This is a plain union-find over the allocation
+ * chunks, done once after compile when requested, so it costs nothing
+ * during simulation.
+ */
+static unsigned long partition_root(std::vector<unsigned long>&parent,
+				    unsigned long idx)
+{
+      while (parent[idx] != idx) {
+	    parent[idx] = parent[parent[idx]];
+	    idx = parent[idx];
+      }
+      return idx;
+}
+
+unsigned long count_net_partitions(unsigned long&largest)
+{
+      unsigned long nets = count_vvp_nets;
+      largest = 0;
+      if (nets == 0)
+	    return 0;
+
+	// The chunks are contiguous, so the dense index of a net is
+	// its chunk base index plus the offset within the chunk.
+      std::map<vvp_net_t*, unsigned long> chunk_base;
+      for (size_t cdx = 0 ; cdx < vvp_net_chunk_list.size() ; cdx += 1)
+	    chunk_base[vvp_net_chunk_list[cdx]] = cdx * VVP_NET_CHUNK;
+
+      std::vector<unsigned long> parent (nets);
+      for (unsigned long idx = 0 ; idx < nets ; idx += 1)
+	    parent[idx] = idx;
+
+      for (size_t cdx = 0 ; cdx < vvp_net_chunk_list.size() ; cdx += 1) {
+	    vvp_net_t*chunk = vvp_net_chunk_list[cdx];
+	    unsigned long fill = VVP_NET_CHUNK;
+	    if (cdx+1 == vvp_net_chunk_list.size())
+		  fill = nets - cdx*VVP_NET_CHUNK;
+
+	    for (unsigned long off = 0 ; off < fill ; off += 1) {
+		  vvp_net_t*net = chunk + off;
+		  unsigned long src = cdx*VVP_NET_CHUNK + off;
+
+		    // Union this net with everything in its fan-out.
+		  unsigned fan = net->fanout_count();
+		  for (unsigned fdx = 0 ; fdx < fan ; fdx += 1) {
+			vvp_net_t*dst_net = net->fanout(fdx).ptr();
+			std::map<vvp_net_t*, unsigned long>::iterator cur
+			      = chunk_base.upper_bound(dst_net);
+			assert(cur != chunk_base.begin());
+			-- cur;
+			unsigned long didx = cur->second
+			      + (dst_net - cur->first);
+
+			unsigned long ra = partition_root(parent, src);
+			unsigned long rb = partition_root(parent, didx);
+			if (ra != rb)
+			      parent[rb] = ra;
+		  }
+	    }
+      }
+
+      std::vector<unsigned long> sizes (nets, 0);
+      for (unsigned long idx = 0 ; idx < nets ; idx += 1)
+	    sizes[partition_root(parent, idx)] += 1;
+
+      unsigned long partitions = 0;
+      for (unsigned long idx = 0 ; idx < nets ; idx += 1) {
+	    if (sizes[idx] == 0)
+		  continue;
+	    partitions += 1;
+	    if (sizes[idx] > largest)
+		  largest = sizes[idx];
+      }
+
+      return partitions;
+}
+
 #ifdef CHECK_WITH_VALGRIND
 static map<vvp_net_t*, bool> vvp_net_map;
 static map<sfunc_core*, bool> sfunc_map;
@@ -176,50 +279,94 @@ void vvp_net_t::operator delete(void*)
 
 vvp_net_t::vvp_net_t()
 {
-      out_ = vvp_net_ptr_t(0,0);
+      out0_ = vvp_net_ptr_t(0,0);
+      out1_ = 0;
       fun = 0;
       fil = 0;
 }
 
+/*
+ * Add a destination to the fan-out of this net. The inline cells are
+ * filled first; the third destination replaces the inline out1_ cell
+ * with an overflow array that carries the second and subsequent
+ * destinations, growing by doubling thereafter.
+ */
 void vvp_net_t::link(vvp_net_ptr_t port_to_link)
 {
-      vvp_net_t*net = port_to_link.ptr();
-      net->port[port_to_link.port()] = out_;
-      out_ = port_to_link;
+      if (out0_.nil()) {
+	    out0_ = port_to_link;
+	    return;
+      }
+
+      if (out1_ == 0) {
+	    out1_ = port_to_link.bits();
+	    return;
+      }
+
+      fanout_ovf_s*ovf;
+      if (out1_ & OUT1_OVF) {
+	    ovf = out_ovf_();
+	    if (ovf->count == ovf->cap) {
+		  ovf->cap *= 2;
+		  ovf = (fanout_ovf_s*) realloc(ovf, sizeof(fanout_ovf_s)
+				+ (ovf->cap - 1) * sizeof(vvp_net_ptr_t));
+		  assert(ovf);
+		  out1_ = reinterpret_cast<unsigned long>(ovf) | OUT1_OVF;
+	    }
+      } else {
+	      /* Move the second inline destination into a fresh
+		 overflow array. */
+	    ovf = (fanout_ovf_s*) malloc(sizeof(fanout_ovf_s)
+				+ 3 * sizeof(vvp_net_ptr_t));
+	    assert(ovf);
+	    ovf->count = 1;
+	    ovf->cap = 4;
+	    ovf->dst[0] = vvp_net_ptr_t::from_bits(out1_);
+	    out1_ = reinterpret_cast<unsigned long>(ovf) | OUT1_OVF;
+      }
+
+      ovf->dst[ovf->count] = port_to_link;
+      ovf->count += 1;
 }
 
 /*
- * Unlink a ptr object from the driver. The input is the driver in the
- * form of a vvp_net_t pointer. The .out member of that object is the
- * driver. The dst_ptr argument is the receiver pin to be located and
- * removed from the fan-out list.
+ * Unlink a ptr object from the driver. The dst_ptr argument is the
+ * receiver pin to be located and removed from the fan-out. The
+ * remaining destinations are compacted forward, and an overflow
+ * array that drops back to a single entry is folded into the inline
+ * cell again.
  */
 void vvp_net_t::unlink(vvp_net_ptr_t dst_ptr)
 {
-      vvp_net_t*net = dst_ptr.ptr();
-      unsigned net_port = dst_ptr.port();
-
-      if (out_ == dst_ptr) {
-	      /* If the drive fan-out list starts with this pointer,
-		 then the unlink is easy. Pull the list forward. */
-	    out_ = net->port[net_port];
-      } else if (! out_.nil()) {
-	      /* Scan the linked list, looking for the net_ptr_t
-		 pointer *before* the one we wish to remove. */
-	    vvp_net_ptr_t cur = out_;
-	    assert(!cur.nil());
-	    vvp_net_t*cur_net = cur.ptr();
-	    unsigned cur_port = cur.port();
-	    while (cur_net && cur_net->port[cur_port] != dst_ptr) {
-		  cur = cur_net->port[cur_port];
-		  cur_net = cur.ptr();
-		  cur_port = cur.port();
+      if (out1_ & OUT1_OVF) {
+	    fanout_ovf_s*ovf = out_ovf_();
+	    unsigned idx = 0;
+	    if (out0_ == dst_ptr) {
+		  out0_ = ovf->dst[0];
+	    } else {
+		  while (idx < ovf->count && ovf->dst[idx] != dst_ptr)
+			idx += 1;
+		  if (idx == ovf->count)
+			return;
+	    }
+	    ovf->count -= 1;
+	    for ( ; idx < ovf->count ; idx += 1)
+		  ovf->dst[idx] = ovf->dst[idx+1];
+	    if (ovf->count == 1) {
+		  out1_ = ovf->dst[0].bits();
+		  free(ovf);
 	    }
-	      /* Unlink. */
-	    if (cur_net) cur_net->port[cur_port] = net->port[net_port];
+	    return;
+      }
+
+      if (out0_ == dst_ptr) {
+	    out0_ = vvp_net_ptr_t::from_bits(out1_);
+	    out1_ = 0;
+	    return;
       }
 
-      net->port[net_port] = vvp_net_ptr_t(0,0);
+      if (out1_ == dst_ptr.bits())
+	    out1_ = 0;
 }
 
 void vvp_net_t::count_drivers(unsigned idx, unsigned counts[4])
@@ -494,57 +641,116 @@ int edge(vvp_bit4_t from, vvp_bit4_t to)
 
 void vvp_send_vec8(vvp_net_ptr_t ptr, const vvp_vector8_t&val)
 {
-      while (vvp_net_t*cur = ptr.ptr()) {
-	    vvp_net_ptr_t next = cur->port[ptr.port()];
-
-	    if (cur->fun)
-		  cur->fun->recv_vec8(ptr, val);
-
-	    ptr = next;
-      }
+      vvp_net_t*cur = ptr.ptr();
+      if (cur && cur->fun)
+	    cur->fun->recv_vec8(ptr, val);
 }
 
 void vvp_send_real(vvp_net_ptr_t ptr, double val, vvp_context_t context)
 {
-      while (vvp_net_t*cur = ptr.ptr()) {
-	    vvp_net_ptr_t next = cur->port[ptr.port()];
+      vvp_net_t*cur = ptr.ptr();
+      if (cur && cur->fun)
+	    cur->fun->recv_real(ptr, val, context);
+}
 
-	    if (cur->fun)
-		  cur->fun->recv_real(ptr, val, context);
+/*
+ * Batched propagation for real-valued nets. While a batch is active,
+ * the real signal functors defer their fanout propagation here
+ * instead of sending each change immediately. The pending map keeps
+ * only the latest value per net, so a word that is written several
+ * times in the batch propagates once, and each downstream functor
+ * sees one recv_real per changed input instead of one per write.
+ */
+static bool batch_real_active_flag = false;
+static std::map<vvp_net_t*, double> batch_real_pending;
 
-	    ptr = next;
-      }
+void vvp_batch_real_begin(void)
+{
+      batch_real_active_flag = true;
 }
 
-void vvp_send_long(vvp_net_ptr_t ptr, long val)
+bool vvp_batch_real_active(void)
 {
-      while (vvp_net_t*cur = ptr.ptr()) {
-	    vvp_net_ptr_t next = cur->port[ptr.port()];
+      return batch_real_active_flag;
+}
 
-	    if (cur->fun)
-		  cur->fun->recv_long(ptr, val);
+void vvp_batch_real_defer(vvp_net_t*net, double val)
+{
+      batch_real_pending[net] = val;
+}
+
+void vvp_batch_real_flush(void)
+{
+      batch_real_active_flag = false;
 
-	    ptr = next;
+	// Erase each entry before sending it, so that updates caused
+	// by the propagation itself go out immediately rather than
+	// landing back in the map being walked.
+      while (! batch_real_pending.empty()) {
+	    std::map<vvp_net_t*, double>::iterator cur
+		  = batch_real_pending.begin();
+	    vvp_net_t*net = cur->first;
+	    double val = cur->second;
+	    batch_real_pending.erase(cur);
+
+	    net->send_real(val, 0);
       }
 }
 
+void vvp_send_long(vvp_net_ptr_t ptr, long val)
+{
+      vvp_net_t*cur = ptr.ptr();
+      if (cur && cur->fun)
+	    cur->fun->recv_long(ptr, val);
+}
+
 void vvp_send_long_pv(vvp_net_ptr_t ptr, long val,
                       unsigned base, unsigned wid)
 {
-      while (vvp_net_t*cur = ptr.ptr()) {
-	    vvp_net_ptr_t next = cur->port[ptr.port()];
+      vvp_net_t*cur = ptr.ptr();
+      if (cur && cur->fun)
+	    cur->fun->recv_long_pv(ptr, val, base, wid);
+}
 
-	    if (cur->fun)
-		  cur->fun->recv_long_pv(ptr, val, base, wid);
+const vvp_vector4_t vvp_vector4_t::nil;
 
-	    ptr = next;
-      }
+/*
+ * Allocate a payload buffer for a wide vector. The buffer holds the
+ * reference count header followed by the abits words and then the
+ * bbits words, so that the bbits_ptr_ can point into the same
+ * allocation.
+ */
+unsigned long* vvp_vector4_t::bits_alloc_(unsigned words)
+{
+      size_t size = sizeof(bits_buf_t)
+	    + (2*words - 1) * sizeof(unsigned long);
+      bits_buf_t*buf = reinterpret_cast<bits_buf_t*> (new char[size]);
+      buf->refs = 1;
+      return buf->bits;
 }
 
-const vvp_vector4_t vvp_vector4_t::nil;
+/*
+ * The payload is shared with another vector, so clone it before the
+ * caller writes to it. The fast path tests are in the inline
+ * bits_detach_() method, so this is only called when a copy really
+ * is needed.
+ */
+void vvp_vector4_t::bits_detach_slow_()
+{
+      unsigned words = (size_+BITS_PER_WORD-1) / BITS_PER_WORD;
+      unsigned long*newbits = bits_alloc_(words);
+
+      for (unsigned idx = 0 ;  idx < 2*words ;  idx += 1)
+	    newbits[idx] = abits_ptr_[idx];
+
+      bits_release_(abits_ptr_);
+      abits_ptr_ = newbits;
+      bbits_ptr_ = newbits + words;
+}
 
 void vvp_vector4_t::copy_bits(const vvp_vector4_t&that)
 {
+      bits_detach_();
 
       if (size_ == that.size_) {
 	    if (size_ > BITS_PER_WORD) {
@@ -629,14 +835,10 @@ void vvp_vector4_t::copy_from_(const vvp_vector4_t&that)
 {
       size_ = that.size_;
       if (size_ > BITS_PER_WORD) {
-	    unsigned words = (size_+BITS_PER_WORD-1) / BITS_PER_WORD;
-	    abits_ptr_ = new unsigned long[2*words];
-	    bbits_ptr_ = abits_ptr_ + words;
-
-	    for (unsigned idx = 0 ;  idx < words ;  idx += 1)
-		  abits_ptr_[idx] = that.abits_ptr_[idx];
-	    for (unsigned idx = 0 ;  idx < words ;  idx += 1)
-		  bbits_ptr_[idx] = that.bbits_ptr_[idx];
+	      // Share the payload with the source. The writers
+	      // detach (clone) the payload before changing it.
+	    abits_ptr_ = bits_share_(that.abits_ptr_);
+	    bbits_ptr_ = that.bbits_ptr_;
 
       } else {
 	    abits_val_ = that.abits_val_;
@@ -654,7 +856,7 @@ void vvp_vector4_t::copy_inverted_from_(const vvp_vector4_t&that)
       size_ = that.size_;
       if (size_ > BITS_PER_WORD) {
 	    unsigned words = (size_+BITS_PER_WORD-1) / BITS_PER_WORD;
-	    abits_ptr_ = new unsigned long[2*words];
+	    abits_ptr_ = bits_alloc_(words);
 	    bbits_ptr_ = abits_ptr_ + words;
 
 	    unsigned remaining = size_;
@@ -684,7 +886,7 @@ void vvp_vector4_t::allocate_words_(unsigned long inita, unsigned long initb)
 {
       if (size_ > BITS_PER_WORD) {
 	    unsigned cnt = (size_ + BITS_PER_WORD - 1) / BITS_PER_WORD;
-	    abits_ptr_ = new unsigned long[2*cnt];
+	    abits_ptr_ = bits_alloc_(cnt);
 	    bbits_ptr_ = abits_ptr_ + cnt;
 	    for (unsigned idx = 0 ;  idx < cnt ;  idx += 1)
 		  abits_ptr_[idx] = inita;
@@ -887,7 +1089,7 @@ void vvp_vector4_t::resize(unsigned newsize)
 		  return;
 	    }
 
-	    unsigned long*newbits = new unsigned long[2*newcnt];
+	    unsigned long*newbits = bits_alloc_(newcnt);
 
 	    if (cnt > 1) {
 		  unsigned trans = cnt;
@@ -899,7 +1101,7 @@ void vvp_vector4_t::resize(unsigned newsize)
 		  for (unsigned idx = 0 ;  idx < trans ;  idx += 1)
 			newbits[newcnt+idx] = bbits_ptr_[idx];
 
-		  delete[]abits_ptr_;
+		  bits_release_(abits_ptr_);
 
 	    } else {
 		  newbits[0] = abits_val_;
@@ -919,7 +1121,7 @@ void vvp_vector4_t::resize(unsigned newsize)
 	    if (cnt > 1) {
 		  unsigned long newvala = abits_ptr_[0];
 		  unsigned long newvalb = bbits_ptr_[0];
-		  delete[]abits_ptr_;
+		  bits_release_(abits_ptr_);
 		  abits_val_ = newvala;
 		  bbits_val_ = newvalb;
 	    }
@@ -1000,6 +1202,7 @@ unsigned long* vvp_vector4_t::subarray(unsigned adr, unsigned wid) const
 void vvp_vector4_t::setarray(unsigned adr, unsigned wid, const unsigned long*val)
 {
       assert(adr+wid <= size_);
+      bits_detach_();
 
       const unsigned BIT2_PER_WORD = 8*sizeof(unsigned long);
 
@@ -1063,6 +1266,50 @@ void vvp_vector4_t::setarray(unsigned adr, unsigned wid, const unsigned long*val
       }
 }
 
+/*
+ * Copy the a/b bit planes out 32 bits at a time. The vecval aval/bval
+ * encoding is bit for bit the same as the abits/bbits encoding, so
+ * each output element is just a shift/mask of the plane words. Bits
+ * past the requested width are left zero (BIT4_0).
+ */
+void vvp_vector4_t::as_vpi_vecval(unsigned adr, unsigned wid,
+				  struct t_vpi_vecval*val) const
+{
+      assert(adr+wid <= size_);
+
+      const unsigned CHUNK_BITS = 32;
+      unsigned nchunks = (wid + CHUNK_BITS - 1) / CHUNK_BITS;
+
+      for (unsigned cdx = 0 ;  cdx < nchunks ;  cdx += 1) {
+	    unsigned base = adr + cdx*CHUNK_BITS;
+	    unsigned cwid = wid - cdx*CHUNK_BITS;
+	    if (cwid > CHUNK_BITS) cwid = CHUNK_BITS;
+
+	    unsigned long atmp, btmp;
+	    if (size_ <= BITS_PER_WORD) {
+		  atmp = abits_val_ >> base;
+		  btmp = bbits_val_ >> base;
+	    } else {
+		  unsigned wdx = base / BITS_PER_WORD;
+		  unsigned off = base % BITS_PER_WORD;
+		  atmp = abits_ptr_[wdx] >> off;
+		  btmp = bbits_ptr_[wdx] >> off;
+		    // The chunk may straddle a plane word boundary.
+		  unsigned have = BITS_PER_WORD - off;
+		  if (have < cwid) {
+			atmp |= abits_ptr_[wdx+1] << have;
+			btmp |= bbits_ptr_[wdx+1] << have;
+		  }
+	    }
+
+	    unsigned long mask = (cwid < CHUNK_BITS)
+		  ? (1UL << cwid) - 1UL
+		  : 0xffffffffUL;
+	    val[cdx].aval = atmp & mask;
+	    val[cdx].bval = btmp & mask;
+      }
+}
+
 /*
  * Set the bits of that vector, which must be a subset of this vector,
  * into the addressed part of this vector. Use bit masking and word
@@ -1071,6 +1318,7 @@ void vvp_vector4_t::setarray(unsigned adr, unsigned wid, const unsigned long*val
 bool vvp_vector4_t::set_vec(unsigned adr, const vvp_vector4_t&that)
 {
       assert(adr+that.size_  <= size_);
+      bits_detach_();
       bool diff_flag = false;
 
       if (size_ <= BITS_PER_WORD) {
@@ -1283,6 +1531,7 @@ void vvp_vector4_t::mov(unsigned dst, unsigned src, unsigned cnt)
 {
       assert(dst+cnt <= size_);
       assert(src+cnt <= size_);
+      bits_detach_();
 
       if (size_ <= BITS_PER_WORD) {
 	    unsigned long vmask = (1UL << cnt) - 1;
@@ -1386,6 +1635,84 @@ bool vvp_vector4_t::eeq(const vvp_vector4_t&that) const
       return true;
 }
 
+bool vvp_vector4_t::eeq_masked(const vvp_vector4_t&that,
+			       const vvp_vector4_t&mask) const
+{
+      if (size_ != that.size_ || size_ != mask.size_)
+	    return false;
+
+	// A mask bit is 1 exactly when its abit is set and its bbit
+	// is clear, so the care word is computed from the mask planes
+	// and the compare only looks at the care positions.
+      if (size_ <= BITS_PER_WORD) {
+	    unsigned long care = mask.abits_val_ & ~mask.bbits_val_;
+	    if (size_ < BITS_PER_WORD)
+		  care &= (1UL << size_) - 1;
+	    return ((abits_val_ ^ that.abits_val_) & care) == 0
+		  && ((bbits_val_ ^ that.bbits_val_) & care) == 0;
+      }
+
+      unsigned words = (size_ + BITS_PER_WORD - 1) / BITS_PER_WORD;
+      for (unsigned idx = 0 ;  idx < words ;  idx += 1) {
+	    unsigned long care = mask.abits_ptr_[idx] & ~mask.bbits_ptr_[idx];
+	    if (idx+1 == words && size_%BITS_PER_WORD != 0)
+		  care &= (1UL << (size_%BITS_PER_WORD)) - 1;
+	    if ((abits_ptr_[idx] ^ that.abits_ptr_[idx]) & care)
+		  return false;
+	    if ((bbits_ptr_[idx] ^ that.bbits_ptr_[idx]) & care)
+		  return false;
+      }
+
+      return true;
+}
+
+/*
+ * Like eeq(), but report where the vectors differ. The range is
+ * rounded out to machine word boundaries, which is precise enough for
+ * the part select pruning and keeps the scan to a word-at-a-time XOR
+ * over the bit planes.
+ */
+bool vvp_vector4_t::changed_range(const vvp_vector4_t&that,
+				  unsigned&lo, unsigned&hi) const
+{
+      assert(size_ == that.size_);
+
+      if (size_ <= BITS_PER_WORD) {
+	    unsigned long diff = (abits_val_ ^ that.abits_val_)
+		               | (bbits_val_ ^ that.bbits_val_);
+	    if (size_ < BITS_PER_WORD)
+		  diff &= (1UL << size_) - 1;
+	    if (diff == 0)
+		  return false;
+	    lo = 0;
+	    hi = size_;
+	    return true;
+      }
+
+      unsigned words = (size_ + BITS_PER_WORD - 1) / BITS_PER_WORD;
+      unsigned first = words, last = 0;
+      for (unsigned idx = 0 ;  idx < words ;  idx += 1) {
+	    unsigned long diff = (abits_ptr_[idx] ^ that.abits_ptr_[idx])
+		               | (bbits_ptr_[idx] ^ that.bbits_ptr_[idx]);
+	    if (idx+1 == words && size_%BITS_PER_WORD != 0)
+		  diff &= (1UL << (size_%BITS_PER_WORD)) - 1;
+	    if (diff == 0)
+		  continue;
+	    if (first == words)
+		  first = idx;
+	    last = idx;
+      }
+
+      if (first == words)
+	    return false;
+
+      lo = first * BITS_PER_WORD;
+      hi = (last+1) * BITS_PER_WORD;
+      if (hi > size_)
+	    hi = size_;
+      return true;
+}
+
 bool vvp_vector4_t::eq_xz(const vvp_vector4_t&that) const
 {
       if (size_ != that.size_)
@@ -1446,6 +1773,104 @@ bool vvp_vector4_t::has_xz() const
       return false;
 }
 
+/*
+ * The reduction operators work on the bit planes a word at a
+ * time. In the vector4 encoding a defined 0 bit has both planes
+ * clear, a defined 1 bit has only the abit set, and X/Z bits have the
+ * bbit set, so the interesting conditions are all single mask tests:
+ *
+ *    defined 0 present:  ~abits & ~bbits  != 0
+ *    defined 1 present:   abits & ~bbits  != 0
+ *    X/Z present:                 bbits   != 0
+ *
+ * A defined 0 forces the AND reduction to 0 and a defined 1 forces
+ * the OR reduction to 1 no matter what other bits are present, so
+ * those tests can short circuit. Any X/Z bit makes the XOR reduction
+ * X; otherwise the result is the parity of the abits plane.
+ */
+vvp_bit4_t vvp_vector4_t::reduction_and() const
+{
+      const unsigned long*abits = (size_ > BITS_PER_WORD)? abits_ptr_ : &abits_val_;
+      const unsigned long*bbits = (size_ > BITS_PER_WORD)? bbits_ptr_ : &bbits_val_;
+
+      bool any_xz = false;
+
+      unsigned words = size_ / BITS_PER_WORD;
+      for (unsigned idx = 0 ;  idx < words ;  idx += 1) {
+	    if (~abits[idx] & ~bbits[idx])
+		  return BIT4_0;
+	    if (bbits[idx])
+		  any_xz = true;
+      }
+
+      unsigned long tail = size_ % BITS_PER_WORD;
+      if (tail > 0) {
+	    unsigned long mask = (1UL << tail) - 1UL;
+	    if (~abits[words] & ~bbits[words] & mask)
+		  return BIT4_0;
+	    if (bbits[words] & mask)
+		  any_xz = true;
+      }
+
+      return any_xz? BIT4_X : BIT4_1;
+}
+
+vvp_bit4_t vvp_vector4_t::reduction_or() const
+{
+      const unsigned long*abits = (size_ > BITS_PER_WORD)? abits_ptr_ : &abits_val_;
+      const unsigned long*bbits = (size_ > BITS_PER_WORD)? bbits_ptr_ : &bbits_val_;
+
+      bool any_xz = false;
+
+      unsigned words = size_ / BITS_PER_WORD;
+      for (unsigned idx = 0 ;  idx < words ;  idx += 1) {
+	    if (abits[idx] & ~bbits[idx])
+		  return BIT4_1;
+	    if (bbits[idx])
+		  any_xz = true;
+      }
+
+      unsigned long tail = size_ % BITS_PER_WORD;
+      if (tail > 0) {
+	    unsigned long mask = (1UL << tail) - 1UL;
+	    if (abits[words] & ~bbits[words] & mask)
+		  return BIT4_1;
+	    if (bbits[words] & mask)
+		  any_xz = true;
+      }
+
+      return any_xz? BIT4_X : BIT4_0;
+}
+
+vvp_bit4_t vvp_vector4_t::reduction_xor() const
+{
+      const unsigned long*abits = (size_ > BITS_PER_WORD)? abits_ptr_ : &abits_val_;
+      const unsigned long*bbits = (size_ > BITS_PER_WORD)? bbits_ptr_ : &bbits_val_;
+
+      unsigned long acc = 0;
+
+      unsigned words = size_ / BITS_PER_WORD;
+      for (unsigned idx = 0 ;  idx < words ;  idx += 1) {
+	    if (bbits[idx])
+		  return BIT4_X;
+	    acc ^= abits[idx];
+      }
+
+      unsigned long tail = size_ % BITS_PER_WORD;
+      if (tail > 0) {
+	    unsigned long mask = (1UL << tail) - 1UL;
+	    if (bbits[words] & mask)
+		  return BIT4_X;
+	    acc ^= abits[words] & mask;
+      }
+
+	// Fold the accumulated words down to the parity bit.
+      for (unsigned shift = BITS_PER_WORD/2 ;  shift > 0 ;  shift /= 2)
+	    acc ^= acc >> shift;
+
+      return (acc&1)? BIT4_1 : BIT4_0;
+}
+
 void vvp_vector4_t::change_z2x()
 {
 	// This method relies on the fact that both BIT4_X and BIT4_Z
@@ -1457,6 +1882,7 @@ void vvp_vector4_t::change_z2x()
       if (size_ <= BITS_PER_WORD) {
 	    abits_val_ |= bbits_val_;
       } else {
+	    bits_detach_();
 	    unsigned words = (size_+BITS_PER_WORD-1) / BITS_PER_WORD;
 	    for (unsigned idx = 0 ;  idx < words ;  idx += 1)
 		  abits_ptr_[idx] |= bbits_ptr_[idx];
@@ -1469,6 +1895,7 @@ void vvp_vector4_t::set_to_x()
 	    abits_val_ = vvp_vector4_t::WORD_X_ABITS;
             bbits_val_ = vvp_vector4_t::WORD_X_BBITS;
       } else {
+	    bits_detach_();
 	    unsigned words = (size_+BITS_PER_WORD-1) / BITS_PER_WORD;
 	    for (unsigned idx = 0 ;  idx < words ;  idx += 1) {
 		  abits_ptr_[idx] = vvp_vector4_t::WORD_X_ABITS;
@@ -1514,6 +1941,7 @@ void vvp_vector4_t::invert()
 	    abits_val_ = mask & ~abits_val_;
 	    abits_val_ |= bbits_val_;
       } else {
+	    bits_detach_();
 	    unsigned remaining = size_;
 	    unsigned idx = 0;
 	    while (remaining >= BITS_PER_WORD) {
@@ -1530,8 +1958,25 @@ void vvp_vector4_t::invert()
       }
 }
 
+/*
+ * The wide cases of the bitwise operators are plain word-parallel
+ * loops that are worth turning into SIMD code even at the default
+ * optimization level, where the gcc cost model is too conservative to
+ * do it on its own.
+ */
+#if defined(__GNUC__) && !defined(__clang__)
+# define VECTORIZE_KERNEL __attribute__((optimize("tree-vectorize","vect-cost-model=dynamic")))
+#else
+# define VECTORIZE_KERNEL
+#endif
+
+VECTORIZE_KERNEL
 vvp_vector4_t& vvp_vector4_t::operator &= (const vvp_vector4_t&that)
 {
+	// Writing into the bit planes, so make sure the payload is
+	// private. This also guarantees that the planes of this and
+	// that do not overlap, which the __restrict__ loop relies on.
+      bits_detach_();
 	// The truth table is:
 	//     00 01 11 10
 	//  00 00 00 00 00
@@ -1543,6 +1988,22 @@ vvp_vector4_t& vvp_vector4_t::operator &= (const vvp_vector4_t&that)
 	    unsigned long tmp2 = that.abits_val_ | that.bbits_val_;
 	    abits_val_ = tmp1 & tmp2;
 	    bbits_val_ = (tmp1 & that.bbits_val_) | (tmp2 & bbits_val_);
+      } else if (this != &that) {
+	      /* The __restrict__ qualifiers promise the compiler that
+		 the four bit planes do not overlap, which allows it
+		 to vectorize this loop. The aliased case is handled
+		 below. */
+	    unsigned words = (size_ + BITS_PER_WORD - 1) / BITS_PER_WORD;
+	    unsigned long* __restrict__ ap = abits_ptr_;
+	    unsigned long* __restrict__ bp = bbits_ptr_;
+	    const unsigned long* __restrict__ tap = that.abits_ptr_;
+	    const unsigned long* __restrict__ tbp = that.bbits_ptr_;
+	    for (unsigned idx = 0; idx < words ; idx += 1) {
+		  unsigned long tmp1 = ap[idx] | bp[idx];
+		  unsigned long tmp2 = tap[idx] | tbp[idx];
+		  ap[idx] = tmp1 & tmp2;
+		  bp[idx] = (tmp1 & tbp[idx]) | (tmp2 & bp[idx]);
+	    }
       } else {
 	    unsigned words = (size_ + BITS_PER_WORD - 1) / BITS_PER_WORD;
 	    for (unsigned idx = 0; idx < words ; idx += 1) {
@@ -1558,8 +2019,12 @@ vvp_vector4_t& vvp_vector4_t::operator &= (const vvp_vector4_t&that)
       return *this;
 }
 
+VECTORIZE_KERNEL
 vvp_vector4_t& vvp_vector4_t::operator |= (const vvp_vector4_t&that)
 {
+	// As with operator &=, detach before writing so the planes
+	// are private and cannot overlap those of that.
+      bits_detach_();
 	// The truth table is:
 	//     00 01 11 10
 	//  00 00 01 11 11
@@ -1573,6 +2038,20 @@ vvp_vector4_t& vvp_vector4_t::operator |= (const vvp_vector4_t&that)
 	                 ((~that.abits_val_ | that.bbits_val_) & bbits_val_);
 	    abits_val_ = tmp;
 
+      } else if (this != &that) {
+	      /* As with operator &=, the __restrict__ view of the bit
+		 planes makes this loop a candidate for SIMD. */
+	    unsigned words = (size_ + BITS_PER_WORD - 1) / BITS_PER_WORD;
+	    unsigned long* __restrict__ ap = abits_ptr_;
+	    unsigned long* __restrict__ bp = bbits_ptr_;
+	    const unsigned long* __restrict__ tap = that.abits_ptr_;
+	    const unsigned long* __restrict__ tbp = that.bbits_ptr_;
+	    for (unsigned idx = 0; idx < words ; idx += 1) {
+		  unsigned long tmp = ap[idx] | bp[idx] | tap[idx] | tbp[idx];
+		  bp[idx] = ((~ap[idx] | bp[idx]) & tbp[idx]) |
+		            ((~tap[idx] | tbp[idx]) & bp[idx]);
+		  ap[idx] = tmp;
+	    }
       } else {
 	    unsigned words = (size_ + BITS_PER_WORD - 1) / BITS_PER_WORD;
 	    for (unsigned idx = 0; idx < words ; idx += 1) {
@@ -1886,6 +2365,85 @@ vvp_vector4_t vvp_vector4array_sa::get_word(unsigned index) const
       return get_word_(cell);
 }
 
+vvp_vector4array_sp::vvp_vector4array_sp(unsigned width__, unsigned words__)
+: vvp_vector4array_t(width__, words__)
+{
+      npages_ = (words_ + PAGE_WORDS - 1) / PAGE_WORDS;
+      pages_ = new v4cell* [npages_];
+      for (unsigned idx = 0 ; idx < npages_ ; idx += 1)
+	    pages_[idx] = 0;
+}
+
+vvp_vector4array_sp::~vvp_vector4array_sp()
+{
+      for (unsigned pdx = 0 ; pdx < npages_ ; pdx += 1) {
+	    v4cell*page = pages_[pdx];
+	    if (page == 0)
+		  continue;
+
+	    if (width_ > vvp_vector4_t::BITS_PER_WORD) {
+		  for (unsigned idx = 0 ; idx < PAGE_WORDS ; idx += 1)
+			if (page[idx].abits_ptr_)
+			      delete[]page[idx].abits_ptr_;
+	    }
+	    delete[]page;
+      }
+      delete[]pages_;
+}
+
+/*
+ * Get the page that holds the addressed word, allocating it (with
+ * all the words initialized to X) on this first touch.
+ */
+vvp_vector4array_t::v4cell* vvp_vector4array_sp::get_page_(unsigned index) const
+{
+      unsigned pdx = index / PAGE_WORDS;
+      assert(pdx < npages_);
+
+      v4cell*page = pages_[pdx];
+      if (page)
+	    return page;
+
+      page = new v4cell [PAGE_WORDS];
+      if (width_ <= vvp_vector4_t::BITS_PER_WORD) {
+	    for (unsigned idx = 0 ; idx < PAGE_WORDS ; idx += 1) {
+		  page[idx].abits_val_ = vvp_vector4_t::WORD_X_ABITS;
+		  page[idx].bbits_val_ = vvp_vector4_t::WORD_X_BBITS;
+	    }
+      } else {
+	    for (unsigned idx = 0 ; idx < PAGE_WORDS ; idx += 1) {
+		  page[idx].abits_ptr_ = 0;
+		  page[idx].bbits_ptr_ = 0;
+	    }
+      }
+
+      pages_[pdx] = page;
+      return page;
+}
+
+void vvp_vector4array_sp::set_word(unsigned index, const vvp_vector4_t&that)
+{
+      assert(index < words_);
+
+      v4cell*cell = get_page_(index) + index%PAGE_WORDS;
+
+      set_word_(cell, that);
+}
+
+vvp_vector4_t vvp_vector4array_sp::get_word(unsigned index) const
+{
+      if (index >= words_)
+	    return vvp_vector4_t(width_, BIT4_X);
+
+	// Reads do not need to fault a page in: an untouched page is
+	// all X words.
+      v4cell*page = pages_[index / PAGE_WORDS];
+      if (page == 0)
+	    return vvp_vector4_t(width_, BIT4_X);
+
+      return get_word_(page + index%PAGE_WORDS);
+}
+
 vvp_vector4array_aa::vvp_vector4array_aa(unsigned width__, unsigned words__)
 : vvp_vector4array_t(width__, words__)
 {
@@ -2030,23 +2588,21 @@ void vvp_vector2_t::copy_from_that_(const vvp_vector4_t&that)
       }
 
       vec_ = new unsigned long[words];
-      for (unsigned idx = 0 ;  idx < words ;  idx += 1)
-	    vec_[idx] = 0;
 
-      for (unsigned idx = 0 ;  idx < that.size() ;  idx += 1) {
-	    unsigned addr = idx / BITS_PER_WORD;
-	    unsigned shift = idx % BITS_PER_WORD;
-
-	    switch (that.value(idx)) {
-		case BIT4_0:
-		case BIT4_X:
-		case BIT4_Z:
-		  break;
-		case BIT4_1:
-		  vec_[addr] |= 1UL << shift;
-		  break;
-	    }
+	// BIT4_1 is the only encoding with the abit set and the bbit
+	// clear, so the 2-state value of a whole word is abits&~bbits.
+	// This maps X and Z bits to 0, as the bit-wise conversion did.
+      if (that.size_ <= vvp_vector4_t::BITS_PER_WORD) {
+	    vec_[0] = that.abits_val_ & ~that.bbits_val_;
+      } else {
+	    for (unsigned idx = 0 ;  idx < words ;  idx += 1)
+		  vec_[idx] = that.abits_ptr_[idx] & ~that.bbits_ptr_[idx];
       }
+
+	// Mask off any stray bits above the vector width.
+      unsigned long tail = wid_ % BITS_PER_WORD;
+      if (tail > 0)
+	    vec_[words-1] &= (1UL << tail) - 1UL;
 }
 
 void vvp_vector2_t::copy_from_that_(const vvp_vector2_t&that)
@@ -2626,16 +3182,17 @@ bool operator == (const vvp_vector2_t&a, const vvp_vector2_t&b)
 
 vvp_vector4_t vector2_to_vector4(const vvp_vector2_t&that, unsigned wid)
 {
-      vvp_vector4_t res (wid);
+      vvp_vector4_t res (wid, BIT4_0);
 
-      for (unsigned idx = 0 ;  idx < res.size() ;  idx += 1) {
-	    vvp_bit4_t bit = BIT4_0;
+	// The source is fully defined, so the result is just the
+	// source words written into the a-bits plane. Bits past the
+	// end of the source stay 0.
+      unsigned trans = wid;
+      if (trans > that.wid_)
+	    trans = that.wid_;
 
-	    if (that.value(idx))
-		  bit = BIT4_1;
-
-	    res.set_bit(idx, bit);
-      }
+      if (trans > 0)
+	    res.setarray(0, trans, that.vec_);
 
       return res;
 }
@@ -2906,6 +3463,12 @@ void vvp_net_fun_t::recv_vec4(vvp_net_ptr_t, const vvp_vector4_t&,
       assert(0);
 }
 
+void vvp_net_fun_t::recv_vec4_window(vvp_net_ptr_t port, const vvp_vector4_t&bit,
+				     unsigned, unsigned, vvp_context_t context)
+{
+      recv_vec4(port, bit, context);
+}
+
 void vvp_net_fun_t::recv_vec4_pv(vvp_net_ptr_t, const vvp_vector4_t&bit,
                                  unsigned base, unsigned wid, unsigned vwid,
                                  vvp_context_t)
@@ -3164,33 +3727,43 @@ ostream& operator <<(ostream&out, vvp_scalar_t a)
 }
 
 /*
- * This function is only called if the actual interface function rules
- * out some of the easy cases. If we get here, we can assume that
- * neither of the values is HiZ, and the values are not exactly equal.
+ * This is the complete resolution of a pair of scalar values, given
+ * their raw VSSSvsss encodings. It is only used to fill in the lookup
+ * table below, so it also covers the HiZ and equal-value cases that
+ * the interface function normally strips off.
  */
-vvp_scalar_t fully_featured_resolv_(vvp_scalar_t a, vvp_scalar_t b)
+static unsigned char resolv_pair_(unsigned a, unsigned b)
 {
+	/* If the value is HiZ, resolution is simply a matter of
+	   returning the *other* value. */
+      if ((a & 0x77) == 0)
+	    return b;
+      if ((b & 0x77) == 0)
+	    return a;
 
-      if (UNAMBIG(a.value_) && UNAMBIG(b.value_)) {
+	/* If the values are identical, then resolution is simply
+	   returning *either* value. */
+      if (a == b)
+	    return a;
+
+      if (UNAMBIG(a) && UNAMBIG(b)) {
 
 	      /* If both signals are unambiguous, simply choose
 		 the stronger. If they have the same strength
 		 but different values, then this becomes
 		 ambiguous. */
 
-	    if ((b.value_&0x07) > (a.value_&0x07)) {
+	    if ((b&0x07) > (a&0x07)) {
 
 		    /* b value is stronger. Take it. */
 		  return b;
 
-	    } else if ((b.value_&0x77) == (a.value_&0x77)) {
+	    } else if ((b&0x77) == (a&0x77)) {
 
 		    // Strengths are the same. Since we know already
 		    // that the values are not the same, Make value
 		    // into "x".
-		  vvp_scalar_t tmp (a);
-		  tmp.value_ = (tmp.value_&0x77) | 0x80;
-		  return tmp;
+		  return (a&0x77) | 0x80;
 
 	    } else {
 
@@ -3204,34 +3777,34 @@ vvp_scalar_t fully_featured_resolv_(vvp_scalar_t a, vvp_scalar_t b)
 	   will sweep up the weaker parts of the ambiguous
 	   signal. The result may be ambiguous, or maybe not. */
 
-      if (UNAMBIG(a.value_)) {
-	    vvp_scalar_t res;
+      if (UNAMBIG(a)) {
+	    unsigned res = 0;
 
-	    if ((a.value_&0x70) > (b.value_&0x70))
-		  res.value_ |= a.value_&0xf0;
+	    if ((a&0x70) > (b&0x70))
+		  res |= a&0xf0;
 	    else
-		  res.value_ |= b.value_&0xf0;
+		  res |= b&0xf0;
 
-	    if ((a.value_&0x07) > (b.value_&0x07))
-		  res.value_ |= a.value_&0x0f;
+	    if ((a&0x07) > (b&0x07))
+		  res |= a&0x0f;
 	    else
-		  res.value_ |= b.value_&0x0f;
+		  res |= b&0x0f;
 
 	    return res;
 
-      } else if (UNAMBIG(b.value_)) {
+      } else if (UNAMBIG(b)) {
 
-	    vvp_scalar_t res;
+	    unsigned res = 0;
 
-	    if ((b.value_&0x70) > (a.value_&0x70))
-		  res.value_ |= b.value_&0xf0;
+	    if ((b&0x70) > (a&0x70))
+		  res |= b&0xf0;
 	    else
-		  res.value_ |= a.value_&0xf0;
+		  res |= a&0xf0;
 
-	    if ((b.value_&0x07) > (a.value_&0x07))
-		  res.value_ |= b.value_&0x0f;
+	    if ((b&0x07) > (a&0x07))
+		  res |= b&0x0f;
 	    else
-		  res.value_ |= a.value_&0x0f;
+		  res |= a&0x0f;
 
 	    return res;
 
@@ -3242,10 +3815,10 @@ vvp_scalar_t fully_featured_resolv_(vvp_scalar_t a, vvp_scalar_t b)
 	   has an even wider ambiguity. */
 
       unsigned tmp = 0;
-      int sv1a = a.value_&0x80 ? STREN1(a.value_) : - STREN1(a.value_);
-      int sv0a = a.value_&0x08 ? STREN0(a.value_) : - STREN0(a.value_);
-      int sv1b = b.value_&0x80 ? STREN1(b.value_) : - STREN1(b.value_);
-      int sv0b = b.value_&0x08 ? STREN0(b.value_) : - STREN0(b.value_);
+      int sv1a = a&0x80 ? STREN1(a) : - STREN1(a);
+      int sv0a = a&0x08 ? STREN0(a) : - STREN0(a);
+      int sv1b = b&0x80 ? STREN1(b) : - STREN1(b);
+      int sv0b = b&0x08 ? STREN0(b) : - STREN0(b);
 
       int sv1 = sv1a;
       int sv0 = sv0a;
@@ -3270,7 +3843,7 @@ vvp_scalar_t fully_featured_resolv_(vvp_scalar_t a, vvp_scalar_t b)
       } else {
 	      /* Set the MSB when both arguments MSBs are set. This
 		 can only happen if both one strengths are zero. */
-	    tmp |= (a.value_&b.value_)&0x80;
+	    tmp |= (a&b)&0x80;
 	    tmp |= (-sv1) << 4;
       }
 
@@ -3281,13 +3854,39 @@ vvp_scalar_t fully_featured_resolv_(vvp_scalar_t a, vvp_scalar_t b)
 	    tmp |= (-sv0);
       }
 
-      vvp_scalar_t res;
-      res.value_ = tmp;
-
 	/* Canonicalize the HiZ value. */
-      if ((res.value_&0x77) == 0)
-	    res.value_ = 0;
+      if ((tmp&0x77) == 0)
+	    tmp = 0;
 
+      return tmp;
+}
+
+/*
+ * The pair resolution above involves a fair amount of branching, and
+ * strength resolution is hot in designs with bidirectional buses, so
+ * precompute the result for all 256x256 encoding pairs once at
+ * startup and reduce resolution to a table lookup.
+ */
+static unsigned char resolv_lut_[256*256];
+
+static struct resolv_lut_init_s {
+      resolv_lut_init_s()
+      {
+	    for (unsigned a = 0 ;  a < 256 ;  a += 1)
+		  for (unsigned b = 0 ;  b < 256 ;  b += 1)
+			resolv_lut_[(a<<8)|b] = resolv_pair_(a, b);
+      }
+} resolv_lut_init_;
+
+/*
+ * This function is only called if the actual interface function rules
+ * out some of the easy cases. If we get here, we can assume that
+ * neither of the values is HiZ, and the values are not exactly equal.
+ */
+vvp_scalar_t fully_featured_resolv_(vvp_scalar_t a, vvp_scalar_t b)
+{
+      vvp_scalar_t res;
+      res.value_ = resolv_lut_[((unsigned)a.value_ << 8) | b.value_];
       return res;
 }
 
@@ -3350,26 +3949,41 @@ vvp_bit4_t compare_gtge(const vvp_vector4_t&lef, const vvp_vector4_t&rig,
       if (rig.has_xz())
 	    return BIT4_X;
 
-      for (unsigned idx = lef.size() ; idx > rig.size() ;  idx -= 1) {
-	    if (lef.value(idx-1) == BIT4_1)
-		  return BIT4_1;
-      }
-
-      for (unsigned idx = rig.size() ; idx > lef.size() ;  idx -= 1) {
-	    if (rig.value(idx-1) == BIT4_1)
-		  return BIT4_0;
-      }
-
-      for (unsigned idx = min_size ; idx > 0 ;  idx -= 1) {
-	    vvp_bit4_t lv = lef.value(idx-1);
-	    vvp_bit4_t rv = rig.value(idx-1);
+	// Both operands are fully defined here, so defined bits are
+	// exactly the bits of the a-bits plane and the magnitudes can
+	// be compared a word at a time, from the MSB down. Operands
+	// of different widths are zero extended by taking missing
+	// words as 0.
+      const unsigned BPW = vvp_vector4_t::BITS_PER_WORD;
+      unsigned max_size = lef.size();
+      if (rig.size() > max_size)
+	    max_size = rig.size();
+
+      unsigned words = (max_size + BPW - 1) / BPW;
+
+      for (unsigned idx = words ; idx > 0 ;  idx -= 1) {
+
+	    unsigned long lw = 0;
+	    if ((idx-1)*BPW < lef.size()) {
+		  lw = (lef.size() <= BPW)? lef.abits_val_
+			                  : lef.abits_ptr_[idx-1];
+		  unsigned tail = lef.size() - (idx-1)*BPW;
+		  if (tail < BPW)
+			lw &= (1UL << tail) - 1UL;
+	    }
 
-	    if (lv == rv)
-		  continue;
+	    unsigned long rw = 0;
+	    if ((idx-1)*BPW < rig.size()) {
+		  rw = (rig.size() <= BPW)? rig.abits_val_
+			                  : rig.abits_ptr_[idx-1];
+		  unsigned tail = rig.size() - (idx-1)*BPW;
+		  if (tail < BPW)
+			rw &= (1UL << tail) - 1UL;
+	    }
 
-	    if (lv == BIT4_1)
+	    if (lw > rw)
 		  return BIT4_1;
-	    else
+	    if (lw < rw)
 		  return BIT4_0;
       }
 
@@ -28,6 +28,7 @@
 # include  <cstdlib>
 # include  <cstring>
 # include  <new>
+# include  <vector>
 # include  <cassert>
 
 #ifdef HAVE_IOSFWD
@@ -218,8 +219,13 @@ inline void update_driver_counts(vvp_bit4_t bit, unsigned counts[3])
 class vvp_vector4_t {
 
       friend vvp_vector4_t operator ~(const vvp_vector4_t&that);
+      friend class vvp_vector2_t;
+      friend vvp_bit4_t compare_gtge(const vvp_vector4_t&lef,
+				     const vvp_vector4_t&rig,
+				     vvp_bit4_t out_if_equal);
       friend class vvp_vector4array_t;
       friend class vvp_vector4array_sa;
+      friend class vvp_vector4array_sp;
       friend class vvp_vector4array_aa;
 
     public:
@@ -253,6 +259,13 @@ class vvp_vector4_t {
       unsigned long*subarray(unsigned idx, unsigned size) const;
       void setarray(unsigned idx, unsigned size, const unsigned long*val);
 
+	// Copy the raw a/b bit planes of a subvector into a VPI
+	// vecval array, 32 bits per element. The a/b encoding used
+	// here matches the vpiVectorVal aval/bval encoding, so the
+	// planes copy straight across without per-bit decoding.
+      void as_vpi_vecval(unsigned idx, unsigned size,
+			 struct t_vpi_vecval*val) const;
+
 	// Set a 4-value bit or subvector into the vector. Return true
 	// if any bits of the vector change as a result of this operation.
       void set_bit(unsigned idx, vvp_bit4_t val);
@@ -267,12 +280,35 @@ class vvp_vector4_t {
 	// Test that the vectors are exactly equal
       bool eeq(const vvp_vector4_t&that) const;
 
+	// Test that the vectors are exactly equal in the bit
+	// positions where the mask vector is 1. Positions where the
+	// mask is 0/x/z are ignored. This works a word at a time over
+	// the bit planes, so it is cheap enough to use in hot paths.
+      bool eeq_masked(const vvp_vector4_t&that,
+		      const vvp_vector4_t&mask) const;
+
+	// Compare with that vector (which must be the same size) and
+	// return true if they differ. On a mismatch, [lo,hi) is set
+	// to the word-aligned bit range that contains all of the
+	// differing bits, so that receivers which only look at a
+	// window of the vector can skip propagations that cannot
+	// affect them.
+      bool changed_range(const vvp_vector4_t&that,
+			 unsigned&lo, unsigned&hi) const;
+
 	// Test that the vectors are equal, with xz comparing as equal.
       bool eq_xz(const vvp_vector4_t&that) const;
 
 	// Return true if there is an X or Z anywhere in the vector.
       bool has_xz() const;
 
+	// Reduce the vector to a scalar with the &, | or ^ operator.
+	// These work a word at a time over the bit planes, instead
+	// of folding the operator over the bits one at a time.
+      vvp_bit4_t reduction_and() const;
+      vvp_bit4_t reduction_or() const;
+      vvp_bit4_t reduction_xor() const;
+
 	// Change all Z bits to X bits.
       void change_z2x();
 
@@ -317,6 +353,42 @@ class vvp_vector4_t {
 
       void allocate_words_(unsigned long inita, unsigned long initb);
 
+	// Wide vectors (size_ > BITS_PER_WORD) share their payload
+	// words between copies until one of the copies is written.
+	// The payload is allocated with this reference count header
+	// in front of the word array, and the mutating methods call
+	// bits_detach_() to clone the payload before writing if it
+	// is shared. The size_ member stays per-object.
+      struct bits_buf_t {
+	    unsigned refs;
+	    unsigned long bits[1];
+      };
+      static bits_buf_t* bits_hdr_(unsigned long*bits)
+      { return reinterpret_cast<bits_buf_t*>
+	      (reinterpret_cast<char*>(bits) - offsetof(bits_buf_t, bits)); }
+      static unsigned long* bits_alloc_(unsigned words);
+      static unsigned long* bits_share_(unsigned long*bits)
+      { bits_hdr_(bits)->refs += 1; return bits; }
+      static void bits_release_(unsigned long*bits)
+      {
+	    bits_buf_t*buf = bits_hdr_(bits);
+	    buf->refs -= 1;
+	    if (buf->refs == 0)
+		  delete[] reinterpret_cast<char*>(buf);
+      }
+	// Make sure the payload is private before writing to
+	// it. This is a cheap test for narrow vectors and payloads
+	// that are not shared.
+      void bits_detach_()
+      {
+	    if (size_ <= BITS_PER_WORD)
+		  return;
+	    if (bits_hdr_(abits_ptr_)->refs == 1)
+		  return;
+	    bits_detach_slow_();
+      }
+      void bits_detach_slow_();
+
 	// Values in the vvp_vector4_t are stored split across two
 	// arrays. For each bit in the vector, there is an abit and a
 	// bbit. the encoding of a vvp_vector4_t is:
@@ -373,7 +445,7 @@ inline vvp_vector4_t::vvp_vector4_t(unsigned size__, vvp_bit4_t val)
 inline vvp_vector4_t::~vvp_vector4_t()
 {
       if (size_ > BITS_PER_WORD) {
-	    delete[] abits_ptr_;
+	    bits_release_(abits_ptr_);
 	      // bbits_ptr_ actually points half-way into a
 	      // double-length array started at abits_ptr_
       }
@@ -385,7 +457,7 @@ inline vvp_vector4_t& vvp_vector4_t::operator= (const vvp_vector4_t&that)
 	    return *this;
 
       if (size_ > BITS_PER_WORD)
-	    delete[] abits_ptr_;
+	    bits_release_(abits_ptr_);
 
       copy_from_(that);
 
@@ -438,6 +510,7 @@ inline void vvp_vector4_t::set_bit(unsigned idx, vvp_bit4_t val)
       unsigned long mask = 1UL << off;
 
       if (size_ > BITS_PER_WORD) {
+	    bits_detach_();
 	    unsigned wdx = idx / BITS_PER_WORD;
 	    switch (val) {
 		case BIT4_0:
@@ -577,6 +650,33 @@ class vvp_vector4array_sa : public vvp_vector4array_t {
       v4cell* array_;
 };
 
+/*
+ * Sparsely allocated vvp_vector4array_t. The word cells are grouped
+ * into fixed size pages that are only allocated when a word in the
+ * page is first written, and reads from untouched pages return the
+ * initial X value without allocating anything. Use this for very
+ * large arrays (modeled DRAMs and the like) where a simulation
+ * typically touches a small fraction of the words. The dense
+ * vvp_vector4array_sa remains the right choice for ordinary arrays.
+ */
+class vvp_vector4array_sp : public vvp_vector4array_t {
+
+    public:
+      vvp_vector4array_sp(unsigned width, unsigned words);
+      ~vvp_vector4array_sp();
+
+      vvp_vector4_t get_word(unsigned idx) const;
+      void set_word(unsigned idx, const vvp_vector4_t&that);
+
+      enum { PAGE_WORDS = 4096 };
+
+    private:
+      v4cell* get_page_(unsigned idx) const;
+
+      v4cell**pages_;
+      unsigned npages_;
+};
+
 /*
  * Automatically allocated vvp_vector4array_t
  */
@@ -613,6 +713,8 @@ class vvp_vector2_t {
       friend bool operator <  (const vvp_vector2_t&, const vvp_vector2_t&);
       friend bool operator <= (const vvp_vector2_t&, const vvp_vector2_t&);
       friend bool operator == (const vvp_vector2_t&, const vvp_vector2_t&);
+      friend vvp_vector4_t vector2_to_vector4(const vvp_vector2_t&,
+					      unsigned wid);
 
     public:
       vvp_vector2_t();
@@ -998,8 +1100,6 @@ template <class T> class vvp_sub_pointer_t {
 	    bits_ |= port__;
       }
 
-      ~vvp_sub_pointer_t() { }
-
       T* ptr()
       { return reinterpret_cast<T*> (bits_ & ~3UL); }
 
@@ -1013,6 +1113,12 @@ template <class T> class vvp_sub_pointer_t {
       bool operator == (vvp_sub_pointer_t that) const { return bits_ == that.bits_; }
       bool operator != (vvp_sub_pointer_t that) const { return bits_ != that.bits_; }
 
+	// Expose the encoded word, and rebuild a pointer from one,
+	// for code that needs to store the pointer in a raw cell.
+      unsigned long bits() const { return bits_; }
+      static vvp_sub_pointer_t from_bits(unsigned long bits__)
+      { vvp_sub_pointer_t tmp; tmp.bits_ = bits__; return tmp; }
+
     private:
       unsigned long bits_;
 };
@@ -1023,41 +1129,33 @@ template <class T> ostream& operator << (ostream&out, vvp_sub_pointer_t<T> val)
 
 /*
  * This is the basic unit of netlist connectivity. It is a fan-in of
- * up to 4 inputs, and output pointer, and a pointer to the node's
+ * up to 4 inputs, fan-out storage, and a pointer to the node's
  * functionality.
  *
- * A net output that is non-nil points to the input of one of its
- * destination nets. If there are multiple destinations, then the
- * referenced input port points to the next input. For example:
+ * The fan-out of a net is a set of vvp_net_ptr_t destination input
+ * ports. The first destination is stored inline in the net in the
+ * out0_ cell. A second destination is stored inline in the out1_
+ * cell; past two destinations, out1_ instead carries a tagged
+ * pointer to a heap array (fanout_ovf_s) with the second and
+ * subsequent destinations. Thus the common 1-2 destination nets pay
+ * no extra memory, and propagation to any fan-out is a sequential
+ * sweep over at most one contiguous array, with no pointer chasing
+ * through the destinations themselves.
  *
- *   +--+--+--+--+---+
- *   |  |  |  |  | . |  Output from this vvp_net_t points to...
- *   +--+--+--+--+-|-+
- *                 |
- *                /
- *               /
- *              /
- *             |
- *             v
- *   +--+--+--+--+---+
- *   |  |  |  |  | . |  ... the fourth input of this vvp_net_t, and...
- *   +--+--+--+--+-|-+
- *             |   |
- *            /    .
- *           /     .
- *          |      .
- *          v
- *   +--+--+--+--+---+
- *   |  |  |  |  | . |  ... the third input of this vvp_net_t.
- *   +--+--+--+--+-|-+
+ * The out1_ encodings cannot collide: destination pointers are
+ * vvp_net_ptr_t words, whose low 2 bits are the port number and
+ * whose bit 2 is always zero because vvp_net_t objects are at least
+ * 8-byte aligned. The overflow array pointer is stored with bit 2
+ * set (the array itself comes from malloc, so its own bit 2 is
+ * zero).
  *
  * Thus, the fan-in of a vvp_net_t node is limited to 4 inputs, but
  * the fan-out is unlimited.
  *
- * The vvp_send_*() functions take as input a vvp_net_ptr_t and follow
- * all the fan-out chain, delivering the specified value. The send_*()
- * methods of the vvp_net_t class are similar, but they follow the
- * output, possibly filtered, from the vvp_net_t.
+ * The vvp_send_*() functions take as input a vvp_net_ptr_t and
+ * deliver the specified value to that single input port. The send_*()
+ * methods of the vvp_net_t class deliver the output value, possibly
+ * filtered, to every destination in the fan-out of the net.
  */
 class vvp_net_t {
     public:
@@ -1078,6 +1176,10 @@ class vvp_net_t {
 
     public: // Methods to propagate output from this node.
       void send_vec4(const vvp_vector4_t&val, vvp_context_t context);
+	// Like send_vec4, but with the hint that only the bits in
+	// [lo,hi) changed since the previous propagation.
+      void send_vec4_window(const vvp_vector4_t&val,
+			    unsigned lo, unsigned hi, vvp_context_t context);
       void send_vec8(const vvp_vector8_t&val);
       void send_real(double val, vvp_context_t context);
       void send_long(long val);
@@ -1104,8 +1206,55 @@ class vvp_net_t {
     public: // Method to support $countdrivers
       void count_drivers(unsigned idx, unsigned counts[4]);
 
+    public: // Methods to enumerate the fan-out of this net, for
+	    // load-time analysis passes and idle tests.
+	// Number of destinations in the fan-out of this net.
+      unsigned fanout_count() const
+      { if (out0_.nil()) return 0;
+	if (out1_ == 0) return 1;
+	if (out1_ & OUT1_OVF) return 1 + out_ovf_()->count;
+	return 2;
+      }
+	// The idx'th destination, 0 <= idx < fanout_count().
+      vvp_net_ptr_t fanout(unsigned idx) const
+      { if (idx == 0) return out0_;
+	if (out1_ & OUT1_OVF) return out_ovf_()->dst[idx-1];
+	return vvp_net_ptr_t::from_bits(out1_);
+      }
+
     private:
-      vvp_net_ptr_t out_;
+	// Overflow fan-out storage, allocated when a net gains a
+	// third destination. The dst array is allocated with cap
+	// entries, of which the first count are in use.
+      struct fanout_ovf_s {
+	    unsigned count;
+	    unsigned cap;
+	    vvp_net_ptr_t dst[1];
+      };
+	// Tag bit that marks out1_ as an overflow array pointer
+	// instead of an inline destination.
+      static const unsigned long OUT1_OVF = 4;
+
+      fanout_ovf_s* out_ovf_() const
+      { return reinterpret_cast<fanout_ovf_s*> (out1_ & ~(OUT1_OVF|3UL)); }
+
+	// Fan-out delivery loops, one per value type. These are the
+	// bodies behind the public send_*() methods.
+      void out_vec4_(const vvp_vector4_t&val, vvp_context_t context);
+      void out_vec4_window_(const vvp_vector4_t&val,
+			    unsigned lo, unsigned hi, vvp_context_t context);
+      void out_vec4_pv_(const vvp_vector4_t&val,
+			unsigned base, unsigned wid, unsigned vwid,
+			vvp_context_t context);
+      void out_vec8_(const vvp_vector8_t&val);
+      void out_vec8_pv_(const vvp_vector8_t&val,
+			unsigned base, unsigned wid, unsigned vwid);
+      void out_real_(double val, vvp_context_t context);
+      void out_string_(const std::string&val, vvp_context_t context);
+      void out_object_(vvp_object_t val, vvp_context_t context);
+
+      vvp_net_ptr_t out0_;
+      unsigned long out1_;
 
     public: // Need a better new for these objects.
       static void* operator new(std::size_t size);
@@ -1115,6 +1264,13 @@ class vvp_net_t {
       static void operator delete[](void*);
 };
 
+/*
+ * Look up an allocated net by its dense allocation index, with
+ * 0 <= idx < count_vvp_nets. Load-time analysis passes use this to
+ * visit every net in the design.
+ */
+extern vvp_net_t* vvp_net_index(unsigned long idx);
+
 /*
  * Instances of this class represent the functionality of a
  * node. vvp_net_t objects hold pointers to the vvp_net_fun_t
@@ -1156,6 +1312,15 @@ class vvp_net_fun_t {
 
       virtual void recv_vec4(vvp_net_ptr_t port, const vvp_vector4_t&bit,
                              vvp_context_t context);
+	// Variant of recv_vec4 for sources that know which bits of
+	// the vector changed since their previous propagation. The
+	// range [lo,hi) bounds the changed bits. Receivers that only
+	// watch a window of the vector (part selects) override this
+	// to skip values that cannot affect them; the default simply
+	// drops the hint and calls recv_vec4.
+      virtual void recv_vec4_window(vvp_net_ptr_t port, const vvp_vector4_t&bit,
+				    unsigned lo, unsigned hi,
+				    vvp_context_t context);
       virtual void recv_vec8(vvp_net_ptr_t port, const vvp_vector8_t&bit);
       virtual void recv_real(vvp_net_ptr_t port, double bit,
                              vvp_context_t context);
@@ -1440,6 +1605,12 @@ class vvp_fun_extend_signed  : public vvp_net_fun_t {
 
     private:
       unsigned width_;
+	// The output vector, kept across deliveries so the extension
+	// reuses its payload instead of building a fresh vector each
+	// time. The pad bit its upper region is filled with is
+	// tracked so the fill is redone only when the sign changes.
+      vvp_vector4_t res_;
+      vvp_bit4_t pad_;
 };
 
 /*
@@ -1527,14 +1698,18 @@ class vvp_wide_fun_t : public vvp_net_fun_t {
 
 inline void vvp_send_vec4(vvp_net_ptr_t ptr, const vvp_vector4_t&val, vvp_context_t context)
 {
-      while (class vvp_net_t*cur = ptr.ptr()) {
-	    vvp_net_ptr_t next = cur->port[ptr.port()];
-
-	    if (cur->fun)
-		  cur->fun->recv_vec4(ptr, val, context);
+      vvp_net_t*cur = ptr.ptr();
+      if (cur && cur->fun)
+	    cur->fun->recv_vec4(ptr, val, context);
+}
 
-	    ptr = next;
-      }
+inline void vvp_send_vec4_window(vvp_net_ptr_t ptr, const vvp_vector4_t&val,
+				 unsigned lo, unsigned hi,
+				 vvp_context_t context)
+{
+      vvp_net_t*cur = ptr.ptr();
+      if (cur && cur->fun)
+	    cur->fun->recv_vec4_window(ptr, val, lo, hi, context);
 }
 
 extern void vvp_send_vec8(vvp_net_ptr_t ptr, const vvp_vector8_t&val);
@@ -1544,28 +1719,31 @@ extern void vvp_send_long(vvp_net_ptr_t ptr, long val);
 extern void vvp_send_long_pv(vvp_net_ptr_t ptr, long val,
                              unsigned base, unsigned width);
 
+/*
+ * Batched propagation for real-valued nets. A model that updates many
+ * real words in the same delta brackets the updates with begin/flush.
+ * While the batch is active the real signal functors record their new
+ * value but defer the fanout propagation; the flush then propagates
+ * each changed net once, with its latest value. Note that downstream
+ * functors and filters do not see the new values until the flush.
+ */
+extern void vvp_batch_real_begin(void);
+extern bool vvp_batch_real_active(void);
+extern void vvp_batch_real_defer(vvp_net_t*net, double val);
+extern void vvp_batch_real_flush(void);
+
 inline void vvp_send_string(vvp_net_ptr_t ptr, const std::string&val, vvp_context_t context)
 {
-      while (vvp_net_t*cur = ptr.ptr()) {
-	    vvp_net_ptr_t next = cur->port[ptr.port()];
-
-	    if (cur->fun)
-		  cur->fun->recv_string(ptr, val, context);
-
-	    ptr = next;
-      }
+      vvp_net_t*cur = ptr.ptr();
+      if (cur && cur->fun)
+	    cur->fun->recv_string(ptr, val, context);
 }
 
 inline void vvp_send_object(vvp_net_ptr_t ptr, vvp_object_t val, vvp_context_t context)
 {
-      while (vvp_net_t*cur = ptr.ptr()) {
-	    vvp_net_ptr_t next = cur->port[ptr.port()];
-
-	    if (cur->fun)
-		  cur->fun->recv_object(ptr, val, context);
-
-	    ptr = next;
-      }
+      vvp_net_t*cur = ptr.ptr();
+      if (cur && cur->fun)
+	    cur->fun->recv_object(ptr, val, context);
 }
 
 /*
@@ -1591,45 +1769,203 @@ inline void vvp_send_vec4_pv(vvp_net_ptr_t ptr, const vvp_vector4_t&val,
 			     unsigned base, unsigned wid, unsigned vwid,
 			     vvp_context_t context)
 {
-      while (class vvp_net_t*cur = ptr.ptr()) {
-	    vvp_net_ptr_t next = cur->port[ptr.port()];
+      vvp_net_t*cur = ptr.ptr();
+      if (cur && cur->fun)
+	    cur->fun->recv_vec4_pv(ptr, val, base, wid, vwid, context);
+}
 
-	    if (cur->fun)
-		  cur->fun->recv_vec4_pv(ptr, val, base, wid, vwid, context);
+inline void vvp_send_vec8_pv(vvp_net_ptr_t ptr, const vvp_vector8_t&val,
+			     unsigned base, unsigned wid, unsigned vwid)
+{
+      vvp_net_t*cur = ptr.ptr();
+      if (cur && cur->fun)
+	    cur->fun->recv_vec8_pv(ptr, val, base, wid, vwid);
+}
 
-	    ptr = next;
+/*
+ * Fan-out delivery. Each loop sweeps the destinations of this net in
+ * storage order: the inline cells first, then the overflow array if
+ * one is attached. The sweep is plain sequential iteration, so wide
+ * fan-outs (clock nets) walk one contiguous array instead of chasing
+ * a pointer through every destination.
+ */
+inline void vvp_net_t::out_vec4_(const vvp_vector4_t&val, vvp_context_t context)
+{
+      if (out0_.nil())
+	    return;
+      vvp_send_vec4(out0_, val, context);
+      if (out1_ == 0)
+	    return;
+      if (out1_ & OUT1_OVF) {
+	    fanout_ovf_s*ovf = out_ovf_();
+	    for (unsigned idx = 0 ; idx < ovf->count ; idx += 1)
+		  vvp_send_vec4(ovf->dst[idx], val, context);
+      } else {
+	    vvp_send_vec4(vvp_net_ptr_t::from_bits(out1_), val, context);
       }
 }
 
-inline void vvp_send_vec8_pv(vvp_net_ptr_t ptr, const vvp_vector8_t&val,
-			     unsigned base, unsigned wid, unsigned vwid)
+inline void vvp_net_t::out_vec4_window_(const vvp_vector4_t&val,
+					unsigned lo, unsigned hi,
+					vvp_context_t context)
 {
-      while (class vvp_net_t*cur = ptr.ptr()) {
-	    vvp_net_ptr_t next = cur->port[ptr.port()];
+      if (out0_.nil())
+	    return;
+      vvp_send_vec4_window(out0_, val, lo, hi, context);
+      if (out1_ == 0)
+	    return;
+      if (out1_ & OUT1_OVF) {
+	    fanout_ovf_s*ovf = out_ovf_();
+	    for (unsigned idx = 0 ; idx < ovf->count ; idx += 1)
+		  vvp_send_vec4_window(ovf->dst[idx], val, lo, hi, context);
+      } else {
+	    vvp_send_vec4_window(vvp_net_ptr_t::from_bits(out1_), val,
+				 lo, hi, context);
+      }
+}
 
-	    if (cur->fun)
-		  cur->fun->recv_vec8_pv(ptr, val, base, wid, vwid);
+inline void vvp_net_t::out_vec4_pv_(const vvp_vector4_t&val,
+				    unsigned base, unsigned wid, unsigned vwid,
+				    vvp_context_t context)
+{
+      if (out0_.nil())
+	    return;
+      vvp_send_vec4_pv(out0_, val, base, wid, vwid, context);
+      if (out1_ == 0)
+	    return;
+      if (out1_ & OUT1_OVF) {
+	    fanout_ovf_s*ovf = out_ovf_();
+	    for (unsigned idx = 0 ; idx < ovf->count ; idx += 1)
+		  vvp_send_vec4_pv(ovf->dst[idx], val, base, wid, vwid,
+				   context);
+      } else {
+	    vvp_send_vec4_pv(vvp_net_ptr_t::from_bits(out1_), val,
+			     base, wid, vwid, context);
+      }
+}
 
-	    ptr = next;
+inline void vvp_net_t::out_vec8_(const vvp_vector8_t&val)
+{
+      if (out0_.nil())
+	    return;
+      vvp_send_vec8(out0_, val);
+      if (out1_ == 0)
+	    return;
+      if (out1_ & OUT1_OVF) {
+	    fanout_ovf_s*ovf = out_ovf_();
+	    for (unsigned idx = 0 ; idx < ovf->count ; idx += 1)
+		  vvp_send_vec8(ovf->dst[idx], val);
+      } else {
+	    vvp_send_vec8(vvp_net_ptr_t::from_bits(out1_), val);
+      }
+}
+
+inline void vvp_net_t::out_vec8_pv_(const vvp_vector8_t&val,
+				    unsigned base, unsigned wid, unsigned vwid)
+{
+      if (out0_.nil())
+	    return;
+      vvp_send_vec8_pv(out0_, val, base, wid, vwid);
+      if (out1_ == 0)
+	    return;
+      if (out1_ & OUT1_OVF) {
+	    fanout_ovf_s*ovf = out_ovf_();
+	    for (unsigned idx = 0 ; idx < ovf->count ; idx += 1)
+		  vvp_send_vec8_pv(ovf->dst[idx], val, base, wid, vwid);
+      } else {
+	    vvp_send_vec8_pv(vvp_net_ptr_t::from_bits(out1_), val,
+			     base, wid, vwid);
+      }
+}
+
+inline void vvp_net_t::out_real_(double val, vvp_context_t context)
+{
+      if (out0_.nil())
+	    return;
+      vvp_send_real(out0_, val, context);
+      if (out1_ == 0)
+	    return;
+      if (out1_ & OUT1_OVF) {
+	    fanout_ovf_s*ovf = out_ovf_();
+	    for (unsigned idx = 0 ; idx < ovf->count ; idx += 1)
+		  vvp_send_real(ovf->dst[idx], val, context);
+      } else {
+	    vvp_send_real(vvp_net_ptr_t::from_bits(out1_), val, context);
+      }
+}
+
+inline void vvp_net_t::out_string_(const std::string&val, vvp_context_t context)
+{
+      if (out0_.nil())
+	    return;
+      vvp_send_string(out0_, val, context);
+      if (out1_ == 0)
+	    return;
+      if (out1_ & OUT1_OVF) {
+	    fanout_ovf_s*ovf = out_ovf_();
+	    for (unsigned idx = 0 ; idx < ovf->count ; idx += 1)
+		  vvp_send_string(ovf->dst[idx], val, context);
+      } else {
+	    vvp_send_string(vvp_net_ptr_t::from_bits(out1_), val, context);
+      }
+}
+
+inline void vvp_net_t::out_object_(vvp_object_t val, vvp_context_t context)
+{
+      if (out0_.nil())
+	    return;
+      vvp_send_object(out0_, val, context);
+      if (out1_ == 0)
+	    return;
+      if (out1_ & OUT1_OVF) {
+	    fanout_ovf_s*ovf = out_ovf_();
+	    for (unsigned idx = 0 ; idx < ovf->count ; idx += 1)
+		  vvp_send_object(ovf->dst[idx], val, context);
+      } else {
+	    vvp_send_object(vvp_net_ptr_t::from_bits(out1_), val, context);
       }
 }
 
 inline void vvp_net_t::send_vec4(const vvp_vector4_t&val, vvp_context_t context)
 {
       if (fil == 0) {
-	    vvp_send_vec4(out_, val, context);
+	    out_vec4_(val, context);
+	    return;
+      }
+
+      vvp_vector4_t rep;
+      switch (fil->filter_vec4(val, rep, 0, val.size())) {
+	  case vvp_net_fil_t::STOP:
+	    break;
+	  case vvp_net_fil_t::PROP:
+	    out_vec4_(val, context);
+	    break;
+	  case vvp_net_fil_t::REPL:
+	    out_vec4_(rep, context);
+	    break;
+      }
+}
+
+inline void vvp_net_t::send_vec4_window(const vvp_vector4_t&val,
+					unsigned lo, unsigned hi,
+					vvp_context_t context)
+{
+      if (fil == 0) {
+	    out_vec4_window_(val, lo, hi, context);
 	    return;
       }
 
+	// A force filter may replace bits anywhere in the vector, so
+	// the change window only survives an unfiltered propagation.
       vvp_vector4_t rep;
       switch (fil->filter_vec4(val, rep, 0, val.size())) {
 	  case vvp_net_fil_t::STOP:
 	    break;
 	  case vvp_net_fil_t::PROP:
-	    vvp_send_vec4(out_, val, context);
+	    out_vec4_window_(val, lo, hi, context);
 	    break;
 	  case vvp_net_fil_t::REPL:
-	    vvp_send_vec4(out_, rep, context);
+	    out_vec4_(rep, context);
 	    break;
       }
 }
@@ -1639,7 +1975,7 @@ inline void vvp_net_t::send_vec4_pv(const vvp_vector4_t&val,
 				    vvp_context_t context)
 {
       if (fil == 0) {
-	    vvp_send_vec4_pv(out_, val, base, wid, vwid, context);
+	    out_vec4_pv_(val, base, wid, vwid, context);
 	    return;
       }
 
@@ -1649,10 +1985,10 @@ inline void vvp_net_t::send_vec4_pv(const vvp_vector4_t&val,
 	  case vvp_net_fil_t::STOP:
 	    break;
 	  case vvp_net_fil_t::PROP:
-	    vvp_send_vec4_pv(out_, val, base, wid, vwid, context);
+	    out_vec4_pv_(val, base, wid, vwid, context);
 	    break;
 	  case vvp_net_fil_t::REPL:
-	    vvp_send_vec4_pv(out_, rep, base, wid, vwid, context);
+	    out_vec4_pv_(rep, base, wid, vwid, context);
 	    break;
       }
 }
@@ -1660,7 +1996,7 @@ inline void vvp_net_t::send_vec4_pv(const vvp_vector4_t&val,
 inline void vvp_net_t::send_vec8(const vvp_vector8_t&val)
 {
       if (fil == 0) {
-	    vvp_send_vec8(out_, val);
+	    out_vec8_(val);
 	    return;
       }
 
@@ -1669,10 +2005,10 @@ inline void vvp_net_t::send_vec8(const vvp_vector8_t&val)
 	  case vvp_net_fil_t::STOP:
 	    break;
 	  case vvp_net_fil_t::PROP:
-	    vvp_send_vec8(out_, val);
+	    out_vec8_(val);
 	    break;
 	  case vvp_net_fil_t::REPL:
-	    vvp_send_vec8(out_, rep);
+	    out_vec8_(rep);
 	    break;
       }
 }
@@ -1681,7 +2017,7 @@ inline void vvp_net_t::send_vec8_pv(const vvp_vector8_t&val,
 				    unsigned base, unsigned wid, unsigned vwid)
 {
       if (fil == 0) {
-	    vvp_send_vec8_pv(out_, val, base, wid, vwid);
+	    out_vec8_pv_(val, base, wid, vwid);
 	    return;
       }
 
@@ -1691,10 +2027,10 @@ inline void vvp_net_t::send_vec8_pv(const vvp_vector8_t&val,
 	  case vvp_net_fil_t::STOP:
 	    break;
 	  case vvp_net_fil_t::PROP:
-	    vvp_send_vec8_pv(out_, val, base, wid, vwid);
+	    out_vec8_pv_(val, base, wid, vwid);
 	    break;
 	  case vvp_net_fil_t::REPL:
-	    vvp_send_vec8_pv(out_, rep, base, wid, vwid);
+	    out_vec8_pv_(rep, base, wid, vwid);
 	    break;
       }
 }
@@ -1704,21 +2040,21 @@ inline void vvp_net_t::send_real(double val, vvp_context_t context)
       if (fil && ! fil->filter_real(val))
 	    return;
 
-      vvp_send_real(out_, val, context);
+      out_real_(val, context);
 }
 
 
 inline void vvp_net_t::send_string(const std::string&val, vvp_context_t context)
 {
       assert(!fil);
-      vvp_send_string(out_, val, context);
+      out_string_(val, context);
 }
 
 
 inline void vvp_net_t::send_object(vvp_object_t val, vvp_context_t context)
 {
       assert(!fil);
-      vvp_send_object(out_, val, context);
+      out_object_(val, context);
 }
 
 
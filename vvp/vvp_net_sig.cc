@@ -21,6 +21,7 @@
 # include  "vvp_net.h"
 # include  "vvp_net_sig.h"
 # include  "statistics.h"
+# include  "mem_stats.h"
 # include  "vpi_priv.h"
 # include  <vector>
 # include  <cassert>
@@ -117,12 +118,17 @@ double vvp_signal_value::real_value() const
       return 0;
 }
 
+const vvp_vector4_t* vvp_signal_value::vec4_direct() const
+{
+      return 0;
+}
+
 void vvp_net_t::force_vec4(const vvp_vector4_t&val, vvp_vector2_t mask)
 {
       assert(fil);
       fil->force_fil_vec4(val, mask);
       fun->force_flag();
-      vvp_send_vec4(out_, val, 0);
+      out_vec4_(val, 0);
 }
 
 void vvp_net_t::force_vec8(const vvp_vector8_t&val, vvp_vector2_t mask)
@@ -130,7 +136,7 @@ void vvp_net_t::force_vec8(const vvp_vector8_t&val, vvp_vector2_t mask)
       assert(fil);
       fil->force_fil_vec8(val, mask);
       fun->force_flag();
-      vvp_send_vec8(out_, val);
+      out_vec8_(val);
 }
 
 void vvp_net_t::force_real(double val, vvp_vector2_t mask)
@@ -138,7 +144,7 @@ void vvp_net_t::force_real(double val, vvp_vector2_t mask)
       assert(fil);
       fil->force_fil_real(val, mask);
       fun->force_flag();
-      vvp_send_real(out_, val, 0);
+      out_real_(val, 0);
 }
 
 /* **** vvp_fun_signal methods **** */
@@ -154,6 +160,8 @@ vvp_fun_signal_base::vvp_fun_signal_base()
 vvp_fun_signal4_sa::vvp_fun_signal4_sa(unsigned wid, vvp_bit4_t init)
 : bits4_(wid, init)
 {
+      mem_stats_add(mem_stats_current_scope(), MEM_STATS_SIGNAL,
+		    sizeof(*this) + mem_stats_vec4_bytes(wid));
 }
 
 /*
@@ -177,11 +185,17 @@ void vvp_fun_signal4_sa::recv_vec4(vvp_net_ptr_t ptr, const vvp_vector4_t&bit,
 		 copy the bits, otherwise we need to see if there are
 		 any holes in the mask so we can set those bits. */
 	    if (assign_mask_.size() == 0) {
-                  if (needs_init_ || !bits4_.eeq(bit)) {
+		    /* Compare a word at a time and remember where the
+		       vectors differ, so that part select readers of
+		       a wide vector can skip changes that miss their
+		       window. The initial propagation reports the
+		       whole vector as changed. */
+		  unsigned lo = 0, hi = bit.size();
+                  if (needs_init_ || bits4_.changed_range(bit, lo, hi)) {
 			assert(bit.size() == bits4_.size());
 			bits4_ = bit;
 			needs_init_ = false;
-			ptr.ptr()->send_vec4(bits4_, 0);
+			ptr.ptr()->send_vec4_window(bits4_, lo, hi, 0);
 		  }
 	    } else {
 		  bool changed = false;
@@ -227,12 +241,31 @@ void vvp_fun_signal4_sa::recv_vec4_pv(vvp_net_ptr_t ptr, const vvp_vector4_t&bit
       switch (ptr.port()) {
 	  case 0: // Normal input
 	    if (assign_mask_.size() == 0) {
+		    /* Only propagate when bits actually change, so
+		       that the filter need not track the value to
+		       suppress duplicates. */
+		  bool changed = false;
                   for (unsigned idx = 0 ;  idx < wid ;  idx += 1) {
 			if (base+idx >= bits4_.size()) break;
+			if (bits4_.value(base+idx) == bit.value(idx))
+			      continue;
 			bits4_.set_bit(base+idx, bit.value(idx));
+			changed = true;
+		  }
+		  if (changed || needs_init_) {
+			  /* A part assign can only change the bits it
+			     covers, so bound the change window with
+			     the assigned range. The initial
+			     propagation reports the whole vector. */
+			unsigned lo = base, hi = base + wid;
+			if (hi > bits4_.size()) hi = bits4_.size();
+			if (needs_init_) {
+			      lo = 0;
+			      hi = bits4_.size();
+			}
+			needs_init_ = false;
+			ptr.ptr()->send_vec4_window(bits4_, lo, hi, 0);
 		  }
-		  needs_init_ = false;
-		  ptr.ptr()->send_vec4(bits4_,0);
 	    } else {
 		  bool changed = false;
 		  assert(bits4_.size() == assign_mask_.size());
@@ -336,6 +369,11 @@ vvp_fun_signal4_aa::vvp_fun_signal4_aa(unsigned wid, vvp_bit4_t init)
       assert(init == BIT4_X);
       context_idx_ = vpip_add_item_to_context(this, vpip_peek_context_scope());
       size_ = wid;
+
+	// The instance storage is allocated per context, so this is
+	// only an estimate for one live instance.
+      mem_stats_add(mem_stats_current_scope(), MEM_STATS_SIGNAL,
+		    sizeof(*this) + mem_stats_vec4_bytes(wid));
 }
 
 vvp_fun_signal4_aa::~vvp_fun_signal4_aa()
@@ -378,9 +416,13 @@ void vvp_fun_signal4_aa::recv_vec4(vvp_net_ptr_t ptr, const vvp_vector4_t&bit,
       vvp_vector4_t*bits4 = static_cast<vvp_vector4_t*>
             (vvp_get_context_item(context, context_idx_));
 
-      if (!bits4->eeq(bit)) {
+      unsigned lo = 0, hi = bit.size();
+      if (bits4->size() != bit.size()) {
             *bits4 = bit;
-            ptr.ptr()->send_vec4(*bits4, context);
+            ptr.ptr()->send_vec4_window(*bits4, lo, hi, context);
+      } else if (bits4->changed_range(bit, lo, hi)) {
+            *bits4 = bit;
+            ptr.ptr()->send_vec4_window(*bits4, lo, hi, context);
       }
 }
 
@@ -458,6 +500,8 @@ bool bits_equal(double a, double b)
 vvp_fun_signal_real_sa::vvp_fun_signal_real_sa()
 {
       bits_ = 0.0;
+      mem_stats_add(mem_stats_current_scope(), MEM_STATS_SIGNAL,
+		    sizeof(*this));
 }
 
 double vvp_fun_signal_real_sa::real_unfiltered_value() const
@@ -474,7 +518,10 @@ void vvp_fun_signal_real_sa::recv_real(vvp_net_ptr_t ptr, double bit,
                   if (needs_init_ || !bits_equal(bits_, bit)) {
 			bits_ = bit;
 			needs_init_ = false;
-			ptr.ptr()->send_real(bit, 0);
+			if (vvp_batch_real_active())
+			      vvp_batch_real_defer(ptr.ptr(), bit);
+			else
+			      ptr.ptr()->send_real(bit, 0);
 		  }
 	    }
 	    break;
@@ -495,6 +542,8 @@ void vvp_fun_signal_real_sa::recv_real(vvp_net_ptr_t ptr, double bit,
 vvp_fun_signal_real_aa::vvp_fun_signal_real_aa()
 {
       context_idx_ = vpip_add_item_to_context(this, vpip_peek_context_scope());
+      mem_stats_add(mem_stats_current_scope(), MEM_STATS_SIGNAL,
+		    sizeof(*this));
 }
 
 vvp_fun_signal_real_aa::~vvp_fun_signal_real_aa()
@@ -591,6 +640,8 @@ void vvp_fun_signal_real_aa::operator delete(void*)
 
 vvp_fun_signal_string_sa::vvp_fun_signal_string_sa()
 {
+      mem_stats_add(mem_stats_current_scope(), MEM_STATS_SIGNAL,
+		    sizeof(*this));
 }
 
 #ifdef CHECK_WITH_VALGRIND
@@ -616,6 +667,8 @@ void vvp_fun_signal_string_sa::recv_string(vvp_net_ptr_t ptr, const std::string&
 vvp_fun_signal_string_aa::vvp_fun_signal_string_aa()
 {
       context_idx_ = vpip_add_item_to_context(this, vpip_peek_context_scope());
+      mem_stats_add(mem_stats_current_scope(), MEM_STATS_SIGNAL,
+		    sizeof(*this));
 }
 
 vvp_fun_signal_string_aa::~vvp_fun_signal_string_aa()
@@ -975,6 +1028,14 @@ void vvp_wire_vec4::vec4_value(vvp_vector4_t&val) const
 	    val.set_bit(idx, filtered_value_(idx));
 }
 
+const vvp_vector4_t* vvp_wire_vec4::vec4_direct() const
+{
+      if (test_force_mask_is_zero())
+	    return &bits4_;
+
+      return 0;
+}
+
 vvp_bit4_t vvp_wire_vec4::driven_value(unsigned idx) const
 {
       return bits4_.value(idx);
@@ -985,6 +1046,148 @@ bool vvp_wire_vec4::is_forced(unsigned idx) const
       return test_force_mask(idx);
 }
 
+vvp_var_vec4::vvp_var_vec4(vvp_fun_signal4_sa*fun)
+: fun_(fun)
+{
+}
+
+vvp_net_fil_t::prop_t vvp_var_vec4::filter_vec4(const vvp_vector4_t&bit,
+						vvp_vector4_t&rep,
+						unsigned base, unsigned)
+{
+	// The functor tracks the driven value and has already
+	// suppressed duplicate assignments, so with no force in
+	// effect there is nothing left here but the callbacks.
+      return filter_mask_(bit, force4_, rep, base);
+}
+
+unsigned vvp_var_vec4::filter_size() const
+{
+      return fun_->vec4_unfiltered_value().size();
+}
+
+void vvp_var_vec4::force_fil_vec4(const vvp_vector4_t&val, vvp_vector2_t mask)
+{
+      force_mask(mask);
+
+      if (force4_.size() == 0) {
+	    force4_ = val;
+      } else {
+	    for (unsigned idx = 0; idx < mask.size() ; idx += 1) {
+		  if (mask.value(idx) == 0)
+			continue;
+
+		  force4_.set_bit(idx, val.value(idx));
+	    }
+      }
+      run_vpi_callbacks();
+}
+
+void vvp_var_vec4::force_fil_vec8(const vvp_vector8_t&, vvp_vector2_t)
+{
+      assert(0);
+}
+
+void vvp_var_vec4::force_fil_real(double, vvp_vector2_t)
+{
+      assert(0);
+}
+
+void vvp_var_vec4::release(vvp_net_ptr_t ptr, bool net_flag)
+{
+      const vvp_vector4_t&bits4 = fun_->vec4_unfiltered_value();
+      vvp_vector2_t mask (vvp_vector2_t::FILL1, bits4.size());
+      if (net_flag) {
+	      // Nets revert to their unforced value after release.
+	    release_mask(mask);
+	    ptr.ptr()->send_vec4(bits4, 0);
+	    run_vpi_callbacks();
+      } else {
+	      // Variables keep the current value.
+	    vvp_vector4_t res (bits4.size());
+	    for (unsigned idx=0; idx<bits4.size(); idx += 1)
+		  res.set_bit(idx,value(idx));
+	    release_mask(mask);
+	    ptr.ptr()->fun->recv_vec4(ptr, res, 0);
+      }
+}
+
+void vvp_var_vec4::release_pv(vvp_net_ptr_t ptr, unsigned base, unsigned wid, bool net_flag)
+{
+      const vvp_vector4_t&bits4 = fun_->vec4_unfiltered_value();
+      assert(bits4.size() >= base + wid);
+
+      vvp_vector2_t mask (vvp_vector2_t::FILL0, bits4.size());
+      for (unsigned idx = 0 ; idx < wid ; idx += 1)
+	    mask.set_bit(base+idx, 1);
+
+      if (net_flag) {
+	      // Nets revert to their unforced value after release.
+	    release_mask(mask);
+	    ptr.ptr()->send_vec4_pv(bits4.subvalue(base,wid),
+				    base, wid, bits4.size(), 0);
+	    run_vpi_callbacks();
+      } else {
+	      // Variables keep the current value.
+	    vvp_vector4_t res (wid);
+	    for (unsigned idx=0; idx<wid; idx += 1)
+		  res.set_bit(idx,value(base+idx));
+	    release_mask(mask);
+	    ptr.ptr()->fun->recv_vec4_pv(ptr, res, base, wid, bits4.size(), 0);
+      }
+}
+
+unsigned vvp_var_vec4::value_size() const
+{
+      return fun_->vec4_unfiltered_value().size();
+}
+
+vvp_bit4_t vvp_var_vec4::filtered_value_(unsigned idx) const
+{
+      if (test_force_mask(idx))
+	    return force4_.value(idx);
+      else
+	    return fun_->vec4_unfiltered_value().value(idx);
+}
+
+vvp_bit4_t vvp_var_vec4::value(unsigned idx) const
+{
+      return filtered_value_(idx);
+}
+
+vvp_scalar_t vvp_var_vec4::scalar_value(unsigned idx) const
+{
+      return vvp_scalar_t(value(idx),6,6);
+}
+
+void vvp_var_vec4::vec4_value(vvp_vector4_t&val) const
+{
+      val = fun_->vec4_unfiltered_value();
+      if (test_force_mask_is_zero())
+	    return;
+
+      for (unsigned idx = 0 ; idx < val.size() ; idx += 1)
+	    val.set_bit(idx, filtered_value_(idx));
+}
+
+const vvp_vector4_t* vvp_var_vec4::vec4_direct() const
+{
+      if (test_force_mask_is_zero())
+	    return & fun_->vec4_unfiltered_value();
+
+      return 0;
+}
+
+vvp_bit4_t vvp_var_vec4::driven_value(unsigned idx) const
+{
+      return fun_->vec4_unfiltered_value().value(idx);
+}
+
+bool vvp_var_vec4::is_forced(unsigned idx) const
+{
+      return test_force_mask(idx);
+}
+
 vvp_wire_vec8::vvp_wire_vec8(unsigned wid)
 : bits8_(wid)
 {
@@ -104,6 +104,16 @@ class vvp_signal_value {
       virtual void vec4_value(vvp_vector4_t&) const =0;
       virtual double real_value() const;
 
+	// Return a pointer to the stored value vector if the value
+	// can be read directly, or nil if the value must be read
+	// through vec4_value. Signals whose drivers have settled are
+	// effectively constant storage, so readers (the %load family)
+	// use this to skip the filter copy. A force in effect makes
+	// the stored vector differ from the visible value, so this
+	// returns nil then. The pointer is stable, but the vector it
+	// names changes with the signal.
+      virtual const vvp_vector4_t* vec4_direct() const;
+
       virtual void get_signal_value(struct t_vpi_value*vp);
 };
 
@@ -422,6 +432,7 @@ class vvp_wire_vec4 : public vvp_wire_base {
       vvp_bit4_t value(unsigned idx) const;
       vvp_scalar_t scalar_value(unsigned idx) const;
       void vec4_value(vvp_vector4_t&) const;
+      const vvp_vector4_t* vec4_direct() const;
 
         // Support for $countdrivers
       vvp_bit4_t driven_value(unsigned idx) const;
@@ -436,6 +447,56 @@ class vvp_wire_vec4 : public vvp_wire_base {
       vvp_vector4_t force4_; // the value being forced
 };
 
+/*
+ * This is the filter for a static (non-automatic) variable. The
+ * vvp_fun_signal4_sa functor of the variable already tracks the
+ * driven value and suppresses duplicate propagations, so unlike
+ * vvp_wire_vec4 this filter does not keep a second copy of the
+ * vector. It reads the driven value back from the functor when a
+ * force or a value read needs it, and with no force in effect
+ * filtering an assignment flattens down to running the value change
+ * callbacks. Force and release are rare, so this takes the vector
+ * compare and copy out of every ordinary assignment.
+ */
+class vvp_var_vec4 : public vvp_wire_base {
+
+    public:
+      explicit vvp_var_vec4(class vvp_fun_signal4_sa*fun);
+
+	// The main filter behavior for this class. The force filters
+	// are applied, but there is no driven value to track here.
+      prop_t filter_vec4(const vvp_vector4_t&bit, vvp_vector4_t&rep,
+			 unsigned base, unsigned vwid);
+
+	// Abstract methods from vvp_vpi_callback
+      void get_value(struct t_vpi_value*value);
+	// Abstract methods from vvp_net_fil_t
+      unsigned filter_size() const;
+      void force_fil_vec4(const vvp_vector4_t&val, vvp_vector2_t mask);
+      void force_fil_vec8(const vvp_vector8_t&val, vvp_vector2_t mask);
+      void force_fil_real(double val, vvp_vector2_t mask);
+      void release(vvp_net_ptr_t ptr, bool net_flag);
+      void release_pv(vvp_net_ptr_t ptr, unsigned base, unsigned wid, bool net_flag);
+
+	// Implementation of vvp_signal_value methods
+      unsigned value_size() const;
+      vvp_bit4_t value(unsigned idx) const;
+      vvp_scalar_t scalar_value(unsigned idx) const;
+      void vec4_value(vvp_vector4_t&) const;
+      const vvp_vector4_t* vec4_direct() const;
+
+        // Support for $countdrivers
+      vvp_bit4_t driven_value(unsigned idx) const;
+      bool is_forced(unsigned idx) const;
+
+    private:
+      vvp_bit4_t filtered_value_(unsigned idx) const;
+
+    private:
+      class vvp_fun_signal4_sa*fun_;
+      vvp_vector4_t force4_; // the value being forced
+};
+
 class vvp_wire_vec8 : public vvp_wire_base {
 
     public:
@@ -1,9 +1,63 @@
 
 #include <cstdarg>
 #include "vpi_user.h"
+#include "vpi_priv.h"
+#include "vvp_net.h"
+#include "mem_stats.h"
+#include "sim_stats.h"
+#include "checkpoint.h"
 
+/*
+ * $ivl_real_batch_begin / $ivl_real_batch_flush
+ *
+ * Bracket a run of real-valued updates so they propagate through the
+ * net fanout in one deduplicated pass. See vvp_batch_real_begin() in
+ * vvp_net.h for the semantics.
+ */
+static PLI_INT32 real_batch_begin_calltf(ICARUS_VPI_CONST PLI_BYTE8*)
+{
+      vvp_batch_real_begin();
+      return 0;
+}
+
+static PLI_INT32 real_batch_flush_calltf(ICARUS_VPI_CONST PLI_BYTE8*)
+{
+      vvp_batch_real_flush();
+      return 0;
+}
+
+static void real_batch_register_systf(void)
+{
+      static const struct {
+	    const char*name;
+	    PLI_INT32 (*calltf)(ICARUS_VPI_CONST PLI_BYTE8*);
+      } table[2] = {
+	    { "$ivl_real_batch_begin", &real_batch_begin_calltf },
+	    { "$ivl_real_batch_flush", &real_batch_flush_calltf }
+      };
+
+      for (unsigned idx = 0 ;  idx < 2 ;  idx += 1) {
+	    s_vpi_systf_data tf_data;
+	    vpiHandle res;
+
+	    tf_data.type        = vpiSysTask;
+	    tf_data.calltf      = table[idx].calltf;
+	    tf_data.compiletf   = 0;
+	    tf_data.sizetf      = 0;
+	    tf_data.tfname      = table[idx].name;
+	    tf_data.user_data   = 0;
+	    res = vpi_register_systf(&tf_data);
+	    vpip_make_systf_system_defined(res);
+      }
+}
 
 void vvp_vpi_init()
 {
+	/* Register the system tasks that the core itself provides. */
+      mem_stats_register_systf();
+      sim_stats_register_systf();
+      checkpoint_register_systf();
+      watchpoint_register_systf();
+      real_batch_register_systf();
 }
 
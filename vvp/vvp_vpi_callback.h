@@ -21,6 +21,7 @@
 
 # include  "config.h"
 # include  "vpi_user.h"
+# include  <vector>
 
 class value_callback;
 
@@ -50,13 +51,25 @@ class vvp_vpi_callback {
 	// vpi to get at the vvp value of the object.
       virtual void get_value(struct t_vpi_value*value) =0;
 
+	// True if a value change on this object has anything to
+	// run. The scheduler uses this to tell whether a signal
+	// change can be observed. An array attachment counts, since
+	// callbacks may be attached to the array as a whole.
+      bool has_vpi_callbacks() const
+      { return array_ || !vpi_callbacks_.empty(); }
+
     protected:
 	// Derived classes call this method to indicate that it is
-	// time to call the callback.
-      void run_vpi_callbacks();
+	// time to call the callback. Most signals never have a
+	// callback attached, so the common case is a single test
+	// inline here and the dispatch work stays out of line.
+      void run_vpi_callbacks()
+      { if (array_ || !vpi_callbacks_.empty()) run_vpi_callbacks_(); }
 
     private:
-      value_callback*vpi_callbacks_;
+      void run_vpi_callbacks_();
+
+      std::vector<value_callback*> vpi_callbacks_;
       struct __vpiArray* array_;
       unsigned long array_word_;
 };
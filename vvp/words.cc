@@ -164,11 +164,13 @@ void compile_variable(char*label, char*name,
 	    net->fil = tmp;
             net->fun = tmp;
       } else if (vpi_type_code == vpiIntVar) {
-	    net->fil = new vvp_wire_vec4(wid, BIT4_0);
-            net->fun = new vvp_fun_signal4_sa(wid);
+	    vvp_fun_signal4_sa*tmp = new vvp_fun_signal4_sa(wid, BIT4_0);
+	    net->fil = new vvp_var_vec4(tmp);
+            net->fun = tmp;
       } else {
-	    net->fil = new vvp_wire_vec4(wid, BIT4_X);
-            net->fun = new vvp_fun_signal4_sa(wid);
+	    vvp_fun_signal4_sa*tmp = new vvp_fun_signal4_sa(wid, BIT4_X);
+	    net->fil = new vvp_var_vec4(tmp);
+            net->fun = tmp;
       }
       vvp_signal_value*vfil = dynamic_cast<vvp_signal_value*>(net->fil);
 